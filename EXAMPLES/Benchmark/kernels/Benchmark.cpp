@@ -0,0 +1,206 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: This file contains the implementation of Benchmark and
+// BenchmarkSuite.
+//
+#include <Benchmark.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <chrono>
+#include <algorithm>
+
+#ifndef OPS_BENCH_REVISION
+#  define OPS_BENCH_REVISION "unknown"
+#endif
+#ifndef OPS_BENCH_BUILD_TYPE
+#  define OPS_BENCH_BUILD_TYPE "unknown"
+#endif
+
+typedef std::chrono::steady_clock Clock;
+
+Benchmark::Benchmark(const char *theName)
+ :sink(0.0), name(theName)
+{
+
+}
+
+Benchmark::~Benchmark()
+{
+
+}
+
+const char *
+Benchmark::getName(void) const
+{
+  return name.c_str();
+}
+
+
+static void
+writeString(FILE *json, const char *s)
+{
+  fputc('"', json);
+  for (; *s != '\0'; s++) {
+    if (*s == '"' || *s == '\\')
+      fputc('\\', json);
+    fputc(*s, json);
+  }
+  fputc('"', json);
+}
+
+// times numIterations calls of run(); returns a negative value on failure
+static double
+timeIterations(Benchmark &theBenchmark, long numIterations)
+{
+  double seconds = 0.0;
+
+  if (theBenchmark.needsReset()) {
+    for (long i=0; i<numIterations; i++) {
+      if (theBenchmark.reset() < 0)
+        return -1.0;
+      Clock::time_point start = Clock::now();
+      int ok = theBenchmark.run();
+      seconds += std::chrono::duration<double>(Clock::now() - start).count();
+      if (ok < 0)
+        return -1.0;
+    }
+    return seconds;
+  }
+
+  Clock::time_point start = Clock::now();
+  for (long i=0; i<numIterations; i++)
+    if (theBenchmark.run() < 0)
+      return -1.0;
+
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+
+BenchmarkSuite::BenchmarkSuite(const char *theName)
+ :suiteName(theName)
+{
+
+}
+
+BenchmarkSuite::~BenchmarkSuite()
+{
+  for (Benchmark *theBenchmark : theBenchmarks)
+    delete theBenchmark;
+}
+
+void
+BenchmarkSuite::addBenchmark(Benchmark *theBenchmark)
+{
+  theBenchmarks.push_back(theBenchmark);
+}
+
+void
+BenchmarkSuite::list(FILE *out)
+{
+  for (Benchmark *theBenchmark : theBenchmarks)
+    fprintf(out, "%s\n", theBenchmark->getName());
+}
+
+int
+BenchmarkSuite::runAll(const char *filter, int numRepetitions, double minTime,
+                       FILE *json, FILE *log)
+{
+  int numFailed = 0;
+
+  // the statistics below need at least one timed repetition
+  if (numRepetitions < 1) {
+    if (log != nullptr)
+      fprintf(log, "BenchmarkSuite::runAll - numRepetitions must be at least 1\n");
+    return -1;
+  }
+
+  fprintf(json, "{\n  \"suite\": ");
+  writeString(json, suiteName.c_str());
+  fprintf(json, ",\n  \"revision\": ");
+  writeString(json, OPS_BENCH_REVISION);
+  fprintf(json, ",\n  \"build_type\": ");
+  writeString(json, OPS_BENCH_BUILD_TYPE);
+#ifdef __VERSION__
+  fprintf(json, ",\n  \"compiler\": ");
+  writeString(json, __VERSION__);
+#endif
+  fprintf(json, ",\n  \"timestamp\": %ld", (long)time(nullptr));
+  fprintf(json, ",\n  \"repetitions\": %d", numRepetitions);
+  fprintf(json, ",\n  \"min_time\": %g", minTime);
+  fprintf(json, ",\n  \"benchmarks\": [");
+
+  bool first = true;
+  for (Benchmark *theBenchmark : theBenchmarks) {
+    const char *name = theBenchmark->getName();
+    if (filter != nullptr && strstr(name, filter) == nullptr)
+      continue;
+
+    fprintf(json, first ? "\n    {\"name\": " : ",\n    {\"name\": ");
+    writeString(json, name);
+    first = false;
+
+    if (theBenchmark->setUp() < 0) {
+      theBenchmark->tearDown();
+      fprintf(json, ", \"error\": \"setUp failed\"}");
+      if (log != nullptr)
+        fprintf(log, "%-48s setUp failed\n", name);
+      numFailed++;
+      continue;
+    }
+
+    // grow the batch until one repetition takes at least minTime
+    long numIterations = 1;
+    double seconds = timeIterations(*theBenchmark, numIterations);
+    while (seconds >= 0.0 && seconds < minTime && numIterations < (1L << 30)) {
+      double factor = (seconds > 0.0) ? 1.4*minTime/seconds : 10.0;
+      factor = std::min(10.0, std::max(2.0, factor));
+      numIterations = (long)ceil(numIterations*factor);
+      seconds = timeIterations(*theBenchmark, numIterations);
+    }
+
+    std::vector<double> perIteration;
+    for (int r=0; r<numRepetitions && seconds >= 0.0; r++) {
+      seconds = timeIterations(*theBenchmark, numIterations);
+      perIteration.push_back(1.0e9*seconds/numIterations);
+    }
+
+    double ops = theBenchmark->getOperations();
+    theBenchmark->tearDown();
+
+    if (seconds < 0.0) {
+      fprintf(json, ", \"error\": \"run failed\"}");
+      if (log != nullptr)
+        fprintf(log, "%-48s run failed\n", name);
+      numFailed++;
+      continue;
+    }
+
+    std::sort(perIteration.begin(), perIteration.end());
+    int n = (int)perIteration.size();
+    double mean = 0.0, var = 0.0;
+    for (double t : perIteration)
+      mean += t/n;
+    for (double t : perIteration)
+      var += (t - mean)*(t - mean)/n;
+    double median = (n % 2 == 1) ? perIteration[n/2]
+                                 : 0.5*(perIteration[n/2-1] + perIteration[n/2]);
+
+    fprintf(json, ", \"iterations\": %ld, \"ns_per_iteration\": "
+            "{\"min\": %.6g, \"median\": %.6g, \"mean\": %.6g, \"stddev\": %.6g}",
+            numIterations, perIteration[0], median, mean, sqrt(var));
+    fprintf(json, ", \"operations_per_iteration\": %.6g, \"operation_unit\": ", ops);
+    writeString(json, theBenchmark->getOperationUnit());
+    fprintf(json, ", \"operations_per_second\": %.6g}", ops*1.0e9/median);
+
+    if (log != nullptr)
+      fprintf(log, "%-48s %14.1f ns/iter  %12.4g %s/s\n", name, median,
+              ops*1.0e9/median, theBenchmark->getOperationUnit());
+  }
+
+  fprintf(json, "\n  ]\n}\n");
+  return numFailed;
+}
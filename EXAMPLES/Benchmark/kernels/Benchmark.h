@@ -0,0 +1,73 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: Classes for timing small computational kernels. A
+// Benchmark performs one iteration of work in run(); the BenchmarkSuite
+// repeats it until each repetition lasts at least a minimum time and
+// writes the per-iteration timings as JSON.
+//
+#ifndef Benchmark_h
+#define Benchmark_h
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+class Benchmark
+{
+  public:
+    Benchmark(const char *name);
+    virtual ~Benchmark();
+
+    const char *getName(void) const;
+
+    // called once before timing starts, and not timed
+    virtual int setUp(void) {return 0;}
+
+    // one iteration of the kernel; a negative return aborts the benchmark
+    virtual int run(void) = 0;
+
+    // kernels which consume their input (e.g. a factorization) restore
+    // it here; when this returns true each iteration is timed on its
+    // own and reset() is excluded from the timings
+    virtual bool needsReset(void) {return false;}
+    virtual int reset(void) {return 0;}
+
+    // called once after the timings to release what setUp() built
+    virtual void tearDown(void) {}
+
+    // amount of work in one iteration, reported with the timings
+    virtual double getOperations(void) {return 1.0;}
+    virtual const char *getOperationUnit(void) {return "iteration";}
+
+  protected:
+    // accumulates results so the compiler cannot discard the work
+    double sink;
+
+  private:
+    std::string name;
+};
+
+class BenchmarkSuite
+{
+  public:
+    BenchmarkSuite(const char *suiteName);
+    ~BenchmarkSuite();
+
+    void addBenchmark(Benchmark *theBenchmark);
+    void list(FILE *out);
+
+    // runs every benchmark whose name contains filter (all if filter
+    // is 0) and writes the results to json; returns the number of
+    // benchmarks which failed, or -1 if numRepetitions is less than 1
+    int runAll(const char *filter, int numRepetitions, double minTime,
+               FILE *json, FILE *log);
+
+  private:
+    std::string suiteName;
+    std::vector<Benchmark *> theBenchmarks;
+};
+
+#endif
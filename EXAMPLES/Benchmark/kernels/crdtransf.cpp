@@ -0,0 +1,107 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: CrdTransf kernels. One iteration moves the end node of
+// a single member through a sequence of trial displacements and, for
+// each, updates the transformation, forms the basic deformations, and
+// transforms a basic force and stiffness to the global system.
+//
+#include <string>
+#include <vector>
+#include <math.h>
+#include <Benchmark.h>
+#include <kernels.h>
+
+#include <Vector.h>
+#include <Matrix.h>
+#include <Node.h>
+#include <LinearCrdTransf2d.h>
+#include <PDeltaCrdTransf2d.h>
+#include <CorotCrdTransf2d.h>
+#include <LinearCrdTransf3d.h>
+#include <PDeltaCrdTransf3d.h>
+#include <CorotCrdTransf3d.h>
+
+class CrdTransfBenchmark : public Benchmark
+{
+  public:
+    CrdTransfBenchmark(CrdTransf *theTransf, int ndm)
+     :Benchmark(("crdtransf/" + std::string(theTransf->getClassType())).c_str()),
+      theTransf(theTransf), nodeI(nullptr), nodeJ(nullptr),
+      q(ndm == 2 ? 3 : 6), kb(q.Size(), q.Size()), p0(ndm == 2 ? 3 : 5)
+    {
+      int ndf = (ndm == 2) ? 3 : 6;
+      if (ndm == 2) {
+        nodeI = new Node(1, ndf, 0.0, 0.0);
+        nodeJ = new Node(2, ndf, 120.0, 144.0);
+      } else {
+        nodeI = new Node(1, ndf, 0.0, 0.0, 0.0);
+        nodeJ = new Node(2, ndf, 120.0, 60.0, 144.0);
+      }
+
+      // a sway history with some rotation at every dof
+      const int numSteps = 20;
+      for (int i=0; i<numSteps; i++) {
+        Vector u(ndf);
+        for (int j=0; j<ndf; j++)
+          u(j) = ((j % 6) < 3 ? 2.0 : 0.02)*sin(2.0*M_PI*i/numSteps + j);
+        displacements.push_back(u);
+      }
+
+      for (int i=0; i<q.Size(); i++)
+        for (int j=0; j<q.Size(); j++)
+          kb(i,j) = (i == j) ? 1.0e4 : 1.0e2;
+    }
+
+    ~CrdTransfBenchmark()
+    {
+      delete theTransf;
+      delete nodeI;
+      delete nodeJ;
+    }
+
+    int setUp(void)
+    {
+      return theTransf->initialize(nodeI, nodeJ);
+    }
+
+    int run(void)
+    {
+      for (const Vector &u : displacements) {
+        nodeJ->setTrialDisp(u);
+        if (theTransf->update() < 0)
+          return -1;
+        q.addMatrixVector(0.0, kb, theTransf->getBasicTrialDisp(), 1.0);
+        sink += theTransf->getGlobalResistingForce(q, p0)(0);
+        sink += theTransf->getGlobalStiffMatrix(kb, q)(0,0);
+      }
+      return 0;
+    }
+
+    double getOperations(void) {return double(displacements.size());}
+    const char *getOperationUnit(void) {return "update";}
+
+  private:
+    CrdTransf *theTransf;
+    Node *nodeI, *nodeJ;
+    std::vector<Vector> displacements;
+    Vector q;
+    Matrix kb;
+    Vector p0;
+};
+
+void
+addCrdTransfBenchmarks(BenchmarkSuite &theSuite)
+{
+  Vector offset2d(2), offset3d(3), vecxz(3);
+  vecxz(2) = 1.0;
+
+  theSuite.addBenchmark(new CrdTransfBenchmark(new LinearCrdTransf2d(1), 2));
+  theSuite.addBenchmark(new CrdTransfBenchmark(new PDeltaCrdTransf2d(1), 2));
+  theSuite.addBenchmark(new CrdTransfBenchmark(new CorotCrdTransf2d(1, offset2d, offset2d), 2));
+  theSuite.addBenchmark(new CrdTransfBenchmark(new LinearCrdTransf3d(1, vecxz), 3));
+  theSuite.addBenchmark(new CrdTransfBenchmark(new PDeltaCrdTransf3d(1, vecxz), 3));
+  theSuite.addBenchmark(new CrdTransfBenchmark(new CorotCrdTransf3d(1, vecxz, offset3d, offset3d), 3));
+}
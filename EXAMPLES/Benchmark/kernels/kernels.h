@@ -0,0 +1,25 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: Functions which add the kernel benchmarks of each group
+// to a BenchmarkSuite.
+//
+#ifndef kernels_h
+#define kernels_h
+
+class BenchmarkSuite;
+class Domain;
+
+void addUniaxialBenchmarks(BenchmarkSuite &theSuite);
+void addSectionBenchmarks(BenchmarkSuite &theSuite);
+void addCrdTransfBenchmarks(BenchmarkSuite &theSuite);
+void addSystemBenchmarks(BenchmarkSuite &theSuite);
+void addRecorderBenchmarks(BenchmarkSuite &theSuite);
+
+// an n x n mesh of plane stress FourNodeQuad elements with a load
+// pattern pushing along the top; used by several groups
+Domain *newQuadMeshDomain(int n);
+
+#endif
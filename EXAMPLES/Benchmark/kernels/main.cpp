@@ -0,0 +1,77 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: Driver for the kernel benchmarks.
+//
+//   OpenSeesBench [-filter text] [-json file] [-repetitions n]
+//                 [-minTime seconds] [-list]
+//
+// Timings are printed as they complete and written as JSON to the
+// given file, or to standard output when no file is given.
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Benchmark.h>
+#include <kernels.h>
+
+int
+main(int argc, char **argv)
+{
+  const char *filter = nullptr;
+  const char *jsonFile = nullptr;
+  int numRepetitions = 5;
+  double minTime = 0.1;
+  bool listOnly = false;
+
+  for (int i=1; i<argc; i++) {
+    if (strcmp(argv[i], "-filter") == 0 && i+1 < argc)
+      filter = argv[++i];
+    else if (strcmp(argv[i], "-json") == 0 && i+1 < argc)
+      jsonFile = argv[++i];
+    else if (strcmp(argv[i], "-repetitions") == 0 && i+1 < argc)
+      numRepetitions = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-minTime") == 0 && i+1 < argc)
+      minTime = atof(argv[++i]);
+    else if (strcmp(argv[i], "-list") == 0)
+      listOnly = true;
+    else {
+      fprintf(stderr, "usage: %s [-filter text] [-json file] [-repetitions n] "
+                      "[-minTime seconds] [-list]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  if (numRepetitions < 1) {
+    fprintf(stderr, "OpenSeesBench - -repetitions must be at least 1\n");
+    return 2;
+  }
+
+  BenchmarkSuite theSuite("kernels");
+  addUniaxialBenchmarks(theSuite);
+  addSectionBenchmarks(theSuite);
+  addCrdTransfBenchmarks(theSuite);
+  addSystemBenchmarks(theSuite);
+  addRecorderBenchmarks(theSuite);
+
+  if (listOnly) {
+    theSuite.list(stdout);
+    return 0;
+  }
+
+  FILE *json = stdout;
+  if (jsonFile != nullptr && (json = fopen(jsonFile, "w")) == nullptr) {
+    fprintf(stderr, "OpenSeesBench - could not open %s\n", jsonFile);
+    return 2;
+  }
+
+  // progress goes to stderr so the JSON can be piped from stdout
+  int numFailed = theSuite.runAll(filter, numRepetitions, minTime, json, stderr);
+
+  if (json != stdout)
+    fclose(json);
+
+  return numFailed == 0 ? 0 : 1;
+}
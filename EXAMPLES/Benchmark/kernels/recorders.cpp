@@ -0,0 +1,127 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: Recorder kernels. One iteration records one step of a
+// plane stress mesh with a NodeRecorder or ElementRecorder writing to
+// a text or binary stream on the null device.
+//
+#include <string>
+#include <math.h>
+#include <Benchmark.h>
+#include <kernels.h>
+
+#include <Vector.h>
+#include <ID.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <NodeData.h>
+#include <NodeRecorder.h>
+#include <ElementRecorder.h>
+#include <DataFileStream.h>
+#include <BinaryFileStream.h>
+
+#ifdef _WIN32
+static const char *nullDevice = "NUL";
+#else
+static const char *nullDevice = "/dev/null";
+#endif
+
+class RecorderBenchmark : public Benchmark
+{
+  public:
+    RecorderBenchmark(const char *response, bool binary, int meshSize)
+     :Benchmark(("recorder/" + std::string(response) + (binary ? "/binary/" : "/text/")
+                 + std::to_string(meshSize) + "x" + std::to_string(meshSize)).c_str()),
+      response(response), binary(binary), meshSize(meshSize),
+      theDomain(nullptr), theRecorder(nullptr), commitTag(0)
+    {
+
+    }
+
+    ~RecorderBenchmark()
+    {
+      this->tearDown();
+    }
+
+    int setUp(void)
+    {
+      theDomain = newQuadMeshDomain(meshSize);
+
+      // a deformed shape so element responses are not trivially zero
+      Vector u(2);
+      Node *theNode;
+      NodeIter &theNodes = theDomain->getNodes();
+      while ((theNode = theNodes()) != nullptr) {
+        const Vector &x = theNode->getCrds();
+        u(0) = 1.0e-3*x(1)*x(1);
+        u(1) = 1.0e-4*sin(x(0));
+        theNode->setTrialDisp(u);
+        theNode->commitState();
+      }
+
+      OPS_Stream *theStream = binary ? (OPS_Stream *)new BinaryFileStream(nullDevice)
+                                     : (OPS_Stream *)new DataFileStream(nullDevice);
+
+      if (response == "disp") {
+        ID dofs(2);
+        dofs(0) = 0;
+        dofs(1) = 1;
+        ID nodes(theDomain->getNumNodes());
+        for (int i=0; i<nodes.Size(); i++)
+          nodes(i) = i+1;
+        theRecorder = new NodeRecorder(dofs, &nodes, -1, NodeData::DisplTrial, 0,
+                                       *theDomain, *theStream);
+      } else {
+        ID elements(theDomain->getNumElements());
+        for (int i=0; i<elements.Size(); i++)
+          elements(i) = i+1;
+        const char *argv[1] = {response.c_str()};
+        theRecorder = new ElementRecorder(&elements, argv, 1, true, *theDomain, *theStream);
+      }
+
+      // the first record sets up the responses; keep it out of the timings
+      return theRecorder->record(commitTag++, 0.0);
+    }
+
+    int run(void)
+    {
+      double time = 0.01*commitTag;
+      int result = theRecorder->record(commitTag, time);
+      commitTag++;
+      return result;
+    }
+
+    void tearDown(void)
+    {
+      // the recorder owns the stream
+      delete theRecorder;
+      delete theDomain;
+      theRecorder = nullptr;
+      theDomain = nullptr;
+    }
+
+    double getOperations(void) {return 1.0;}
+    const char *getOperationUnit(void) {return "step";}
+
+  private:
+    std::string response;
+    bool binary;
+    int meshSize;
+    Domain *theDomain;
+    Recorder *theRecorder;
+    int commitTag;
+};
+
+void
+addRecorderBenchmarks(BenchmarkSuite &theSuite)
+{
+  const int n = 64;
+  theSuite.addBenchmark(new RecorderBenchmark("disp", false, n));
+  theSuite.addBenchmark(new RecorderBenchmark("disp", true, n));
+  theSuite.addBenchmark(new RecorderBenchmark("forces", false, n));
+  theSuite.addBenchmark(new RecorderBenchmark("forces", true, n));
+  theSuite.addBenchmark(new RecorderBenchmark("stresses", false, n));
+}
@@ -0,0 +1,133 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: FiberSection state determination. One iteration drives
+// a reinforced concrete section through a cycle of curvature under a
+// constant axial strain, committing after every step.
+//
+#include <string>
+#include <vector>
+#include <math.h>
+#include <Benchmark.h>
+#include <kernels.h>
+
+#include <Vector.h>
+#include <Matrix.h>
+#include <ElasticMaterial.h>
+#include <Steel02.h>
+#include <Concrete02.h>
+#include <FiberSection2d.h>
+#include <FiberSection3d.h>
+#include <UniaxialFiber2d.h>
+#include <UniaxialFiber3d.h>
+
+class SectionBenchmark : public Benchmark
+{
+  public:
+    SectionBenchmark(const char *name, SectionForceDeformation *theSection, double maxCurvature)
+     :Benchmark(name), theSection(theSection), e(theSection->getOrder())
+    {
+      const int numSteps = 40;
+      for (int i=0; i<numSteps; i++)
+        curvatures.push_back(maxCurvature*sin(2.0*M_PI*i/numSteps));
+    }
+
+    ~SectionBenchmark()
+    {
+      delete theSection;
+    }
+
+    int setUp(void)
+    {
+      return theSection->revertToStart();
+    }
+
+    int run(void)
+    {
+      e.Zero();
+      e(0) = -0.0002;
+      for (double kappa : curvatures) {
+        e(1) = kappa;
+        if (e.Size() > 2)
+          e(2) = 0.5*kappa;
+        theSection->setTrialSectionDeformation(e);
+        sink += theSection->getStressResultant()(1) + theSection->getSectionTangent()(1,1);
+        theSection->commitState();
+      }
+      return 0;
+    }
+
+    double getOperations(void) {return double(curvatures.size());}
+    const char *getOperationUnit(void) {return "step";}
+
+  private:
+    SectionForceDeformation *theSection;
+    std::vector<double> curvatures;
+    Vector e;
+};
+
+// a b x h rectangle of concrete with bars at two faces (2d) or at the
+// corners and mid-sides (3d)
+static const double b = 12.0, h = 24.0, cover = 2.0, barArea = 0.79;
+
+static SectionForceDeformation *
+newSection2d(int numLayers)
+{
+  Concrete02 concrete(1, -4.0, -0.002, -0.8, -0.005, 0.1, 0.5, 250.0);
+  Steel02 steel(2, 60.0, 29000.0, 0.01);
+  FiberSection2d *theSection = new FiberSection2d(1, numLayers + 2);
+
+  int tag = 0;
+  double dy = h/numLayers;
+  for (int i=0; i<numLayers; i++) {
+    UniaxialFiber2d fiber(tag++, concrete, b*dy, -0.5*h + (i+0.5)*dy);
+    theSection->addFiber(fiber);
+  }
+  for (int side=-1; side<=1; side+=2) {
+    UniaxialFiber2d fiber(tag++, steel, 3*barArea, side*(0.5*h - cover));
+    theSection->addFiber(fiber);
+  }
+  return theSection;
+}
+
+static SectionForceDeformation *
+newSection3d(int numY, int numZ)
+{
+  Concrete02 concrete(1, -4.0, -0.002, -0.8, -0.005, 0.1, 0.5, 250.0);
+  Steel02 steel(2, 60.0, 29000.0, 0.01);
+  ElasticMaterial torsion(3, 1.0e8);
+  FiberSection3d *theSection = new FiberSection3d(1, numY*numZ + 8, torsion);
+
+  int tag = 0;
+  double dy = h/numY, dz = b/numZ;
+  Vector position(2);
+  for (int i=0; i<numY; i++)
+    for (int j=0; j<numZ; j++) {
+      position(0) = -0.5*h + (i+0.5)*dy;
+      position(1) = -0.5*b + (j+0.5)*dz;
+      UniaxialFiber3d fiber(tag++, concrete, dy*dz, position);
+      theSection->addFiber(fiber);
+    }
+
+  for (int i=-1; i<=1; i++)
+    for (int j=-1; j<=1; j++) {
+      if (i == 0 && j == 0)
+        continue;
+      position(0) = i*(0.5*h - cover);
+      position(1) = j*(0.5*b - cover);
+      UniaxialFiber3d fiber(tag++, steel, barArea, position);
+      theSection->addFiber(fiber);
+    }
+  return theSection;
+}
+
+void
+addSectionBenchmarks(BenchmarkSuite &theSuite)
+{
+  const double phi = 0.0015;
+  theSuite.addBenchmark(new SectionBenchmark("section/FiberSection2d/26", newSection2d(24), phi));
+  theSuite.addBenchmark(new SectionBenchmark("section/FiberSection2d/102", newSection2d(100), phi));
+  theSuite.addBenchmark(new SectionBenchmark("section/FiberSection3d/296", newSection3d(24, 12), phi));
+}
@@ -0,0 +1,31 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: Constructors for the systems of equations used by the
+// LinearSOE kernels. They are kept apart from the model headers as
+// SuperLU declares BLAS prototypes which conflict with theirs.
+//
+#include <FullGenLinSOE.h>
+#include <FullGenLinLapackSolver.h>
+#include <BandGenLinSOE.h>
+#include <BandGenLinLapackSolver.h>
+#include <BandSPDLinSOE.h>
+#include <BandSPDLinLapackSolver.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <SparseGenColLinSOE.h>
+#include <SuperLU.h>
+#include <SymSparseLinSOE.h>
+#include <SymSparseLinSolver.h>
+#include <UmfpackGenLinSOE.h>
+#include <UmfpackGenLinSolver.h>
+
+LinearSOE *newFullGenSOE(void)     {return new FullGenLinSOE(*(new FullGenLinLapackSolver()));}
+LinearSOE *newBandGenSOE(void)     {return new BandGenLinSOE(*(new BandGenLinLapackSolver()));}
+LinearSOE *newBandSPDSOE(void)     {return new BandSPDLinSOE(*(new BandSPDLinLapackSolver()));}
+LinearSOE *newProfileSPDSOE(void)  {return new ProfileSPDLinSOE(*(new ProfileSPDLinDirectSolver()));}
+LinearSOE *newSuperLUSOE(void)     {return new SparseGenColLinSOE(*(new SuperLU()));}
+LinearSOE *newSparseSYMSOE(void)   {return new SymSparseLinSOE(*(new SymSparseLinSolver()), 1);}
+LinearSOE *newUmfpackSOE(void)     {return new UmfpackGenLinSOE(*(new UmfpackGenLinSolver()));}
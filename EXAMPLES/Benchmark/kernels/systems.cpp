@@ -0,0 +1,253 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: LinearSOE kernels on the system of a plane stress mesh
+// of FourNodeQuad elements. For each system type three kernels are
+// timed: assembling the element matrices with addA(), factoring and
+// solving a freshly assembled system, and repeating the solve with
+// the factored system.
+//
+#include <string>
+#include <vector>
+#include <Benchmark.h>
+#include <kernels.h>
+
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <Domain.h>
+#include <Node.h>
+#include <SP_Constraint.h>
+#include <LoadPattern.h>
+#include <LinearSeries.h>
+#include <NodalLoad.h>
+#include <FourNodeQuad.h>
+#include <ElasticIsotropicPlaneStress2D.h>
+
+#include <StaticAnalysis.h>
+#include <AnalysisModel.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <PlainHandler.h>
+#include <DOF_Numberer.h>
+#include <RCM.h>
+#include <Linear.h>
+#include <LoadControl.h>
+
+#include <LinearSOE.h>
+
+// in solvers.cpp
+typedef LinearSOE *(*SOE_Constructor)(void);
+LinearSOE *newFullGenSOE(void);
+LinearSOE *newBandGenSOE(void);
+LinearSOE *newBandSPDSOE(void);
+LinearSOE *newProfileSPDSOE(void);
+LinearSOE *newSuperLUSOE(void);
+LinearSOE *newSparseSYMSOE(void);
+LinearSOE *newUmfpackSOE(void);
+
+class SystemBenchmark : public Benchmark
+{
+  public:
+    enum Kernel {ADD_A, FACTOR, SOLVE};
+
+    SystemBenchmark(const char *soeName, SOE_Constructor newSOE, int meshSize, Kernel kernel)
+     :Benchmark(("system/" + std::string(soeName) + "/"
+                 + (kernel == ADD_A ? "addA" : (kernel == FACTOR ? "factor" : "solve"))
+                 + "/" + std::to_string(meshSize) + "x" + std::to_string(meshSize)).c_str()),
+      newSOE(newSOE), meshSize(meshSize), kernel(kernel),
+      theDomain(nullptr), theModel(nullptr), theHandler(nullptr), theNumberer(nullptr),
+      theAlgorithm(nullptr), theIntegrator(nullptr), theSOE(nullptr), theAnalysis(nullptr)
+    {
+
+    }
+
+    ~SystemBenchmark()
+    {
+      this->tearDown();
+    }
+
+    int setUp(void);
+    void tearDown(void);
+
+    int run(void)
+    {
+      if (kernel == ADD_A)
+        return this->assemble();
+
+      return theSOE->solve();
+    }
+
+    bool needsReset(void) {return kernel == FACTOR;}
+
+    int reset(void)
+    {
+      if (this->assemble() < 0)
+        return -1;
+      theSOE->setB(b);
+      return 0;
+    }
+
+    double getOperations(void)
+    {
+      return (kernel == ADD_A) ? double(theMatrices.size()) : double(theSOE->getNumEqn());
+    }
+
+    const char *getOperationUnit(void)
+    {
+      return (kernel == ADD_A) ? "element" : "equation";
+    }
+
+  private:
+    int assemble(void)
+    {
+      theSOE->zeroA();
+      int numEle = (int)theMatrices.size();
+      for (int i=0; i<numEle; i++)
+        if (theSOE->addA(*theMatrices[i], *theIDs[i]) < 0)
+          return -1;
+      return 0;
+    }
+
+    SOE_Constructor newSOE;
+    int meshSize;
+    Kernel kernel;
+
+    Domain *theDomain;
+    AnalysisModel *theModel;
+    PlainHandler *theHandler;
+    DOF_Numberer *theNumberer;
+    Linear *theAlgorithm;
+    LoadControl *theIntegrator;
+    LinearSOE *theSOE;
+    StaticAnalysis *theAnalysis;
+
+    // copies of the element tangents and their equation numbers
+    std::vector<Matrix *> theMatrices;
+    std::vector<ID *> theIDs;
+    Vector b;
+};
+
+Domain *
+newQuadMeshDomain(int n)
+{
+  Domain *theDomain = new Domain();
+  ElasticIsotropicPlaneStress2D theMaterial(1, 3000.0, 0.2, 0.0);
+
+  // n x n unit quads, fixed along the bottom and pushed along the top
+  for (int j=0; j<=n; j++)
+    for (int i=0; i<=n; i++) {
+      int tag = j*(n+1) + i + 1;
+      theDomain->addNode(new Node(tag, 2, double(i), double(j)));
+      if (j == 0) {
+        theDomain->addSP_Constraint(new SP_Constraint(tag, 0, 0.0, true));
+        theDomain->addSP_Constraint(new SP_Constraint(tag, 1, 0.0, true));
+      }
+    }
+
+  for (int j=0; j<n; j++)
+    for (int i=0; i<n; i++) {
+      int nd1 = j*(n+1) + i + 1;
+      theDomain->addElement(new FourNodeQuad(j*n + i + 1, nd1, nd1 + 1, nd1 + n + 2, nd1 + n + 1,
+                                             theMaterial, "PlaneStress", 1.0));
+    }
+
+  LoadPattern *thePattern = new LoadPattern(1);
+  thePattern->setTimeSeries(new LinearSeries());
+  theDomain->addLoadPattern(thePattern);
+  Vector P(2);
+  P(0) = 1.0;
+  for (int i=0; i<=n; i++)
+    theDomain->addNodalLoad(new NodalLoad(i+1, n*(n+1) + i + 1, P), 1);
+
+  return theDomain;
+}
+
+int
+SystemBenchmark::setUp(void)
+{
+  theDomain = newQuadMeshDomain(meshSize);
+
+  theModel = new AnalysisModel();
+  theHandler = new PlainHandler();
+  theNumberer = new DOF_Numberer(*(new RCM()));
+  theAlgorithm = new Linear();
+  theIntegrator = new LoadControl(1.0, 1, 1.0, 1.0);
+  theSOE = newSOE();
+  theAnalysis = new StaticAnalysis(*theDomain, *theHandler, *theNumberer, *theModel,
+                                   *theAlgorithm, *theSOE, *theIntegrator);
+
+  // one step sizes the system and leaves it assembled and factored
+  if (theAnalysis->analyze(1) < 0)
+    return -1;
+
+  FE_Element *theFE;
+  FE_EleIter &theFEs = theModel->getFEs();
+  while ((theFE = theFEs()) != nullptr) {
+    theMatrices.push_back(new Matrix(theFE->getTangent(theIntegrator)));
+    theIDs.push_back(new ID(theFE->getID()));
+  }
+  b = theSOE->getB();
+
+  // the solve kernel starts from a factored system
+  if (kernel == SOLVE)
+    return this->reset() < 0 ? -1 : theSOE->solve();
+
+  return 0;
+}
+
+void
+SystemBenchmark::tearDown(void)
+{
+  for (Matrix *theMatrix : theMatrices)
+    delete theMatrix;
+  for (ID *theID : theIDs)
+    delete theID;
+  theMatrices.clear();
+  theIDs.clear();
+
+  // the analysis does not own its components
+  delete theAnalysis;
+  delete theSOE;
+  delete theIntegrator;
+  delete theAlgorithm;
+  delete theNumberer;
+  delete theHandler;
+  delete theModel;
+  delete theDomain;
+
+  theAnalysis = nullptr;
+  theSOE = nullptr;
+  theIntegrator = nullptr;
+  theAlgorithm = nullptr;
+  theNumberer = nullptr;
+  theHandler = nullptr;
+  theModel = nullptr;
+  theDomain = nullptr;
+}
+
+void
+addSystemBenchmarks(BenchmarkSuite &theSuite)
+{
+  struct {
+    const char *name;
+    SOE_Constructor newSOE;
+    int meshSize;
+  } systems[] = {
+    {"FullGeneral", newFullGenSOE,     16},
+    {"BandGeneral", newBandGenSOE,     64},
+    {"BandSPD",     newBandSPDSOE,     64},
+    {"ProfileSPD",  newProfileSPDSOE,  64},
+    {"SuperLU",     newSuperLUSOE,     64},
+    {"SparseSYM",   newSparseSYMSOE,   64},
+    {"Umfpack",     newUmfpackSOE,     64},
+  };
+
+  for (auto &system : systems) {
+    theSuite.addBenchmark(new SystemBenchmark(system.name, system.newSOE, system.meshSize, SystemBenchmark::ADD_A));
+    theSuite.addBenchmark(new SystemBenchmark(system.name, system.newSOE, system.meshSize, SystemBenchmark::FACTOR));
+    theSuite.addBenchmark(new SystemBenchmark(system.name, system.newSOE, system.meshSize, SystemBenchmark::SOLVE));
+  }
+}
@@ -0,0 +1,84 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: UniaxialMaterial state determination. One iteration
+// drives the material through a cyclic strain history, committing
+// after every step.
+//
+#include <string>
+#include <vector>
+#include <math.h>
+#include <Benchmark.h>
+#include <kernels.h>
+
+#include <UniaxialMaterial.h>
+#include <ElasticMaterial.h>
+#include <Steel01.h>
+#include <Steel02.h>
+#include <Concrete01.h>
+#include <Concrete02.h>
+#include <HystereticMaterial.h>
+
+class UniaxialBenchmark : public Benchmark
+{
+  public:
+    UniaxialBenchmark(UniaxialMaterial *theMaterial, double maxStrain, double minStrain)
+     :Benchmark(("uniaxial/" + std::string(theMaterial->getClassType())).c_str()),
+      theMaterial(theMaterial)
+    {
+      // cycles of growing amplitude between minStrain and maxStrain
+      const int numCycles = 5, stepsPerCycle = 40;
+      for (int c=1; c<=numCycles; c++) {
+        double amp = double(c)/numCycles;
+        for (int i=0; i<stepsPerCycle; i++) {
+          double s = sin(2.0*M_PI*i/stepsPerCycle);
+          strains.push_back(amp*(s >= 0.0 ? s*maxStrain : -s*minStrain));
+        }
+      }
+    }
+
+    ~UniaxialBenchmark()
+    {
+      delete theMaterial;
+    }
+
+    int setUp(void)
+    {
+      return theMaterial->revertToStart();
+    }
+
+    int run(void)
+    {
+      for (double strain : strains) {
+        theMaterial->setTrialStrain(strain);
+        sink += theMaterial->getStress() + theMaterial->getTangent();
+        theMaterial->commitState();
+      }
+      return 0;
+    }
+
+    double getOperations(void) {return double(strains.size());}
+    const char *getOperationUnit(void) {return "step";}
+
+  private:
+    UniaxialMaterial *theMaterial;
+    std::vector<double> strains;
+};
+
+void
+addUniaxialBenchmarks(BenchmarkSuite &theSuite)
+{
+  const double fy = 60.0, E = 29000.0, ey = fy/E;
+  const double fc = -4.0, ec = -0.002;
+
+  theSuite.addBenchmark(new UniaxialBenchmark(new ElasticMaterial(1, E), 5*ey, -5*ey));
+  theSuite.addBenchmark(new UniaxialBenchmark(new Steel01(1, fy, E, 0.01), 10*ey, -10*ey));
+  theSuite.addBenchmark(new UniaxialBenchmark(new Steel02(1, fy, E, 0.01), 10*ey, -10*ey));
+  theSuite.addBenchmark(new UniaxialBenchmark(new Concrete01(1, fc, ec, 0.2*fc, 2.5*ec), 0.0005, 2.5*ec));
+  theSuite.addBenchmark(new UniaxialBenchmark(new Concrete02(1, fc, ec, 0.2*fc, 2.5*ec, 0.1, 0.5, 250.0), 0.0005, 2.5*ec));
+  theSuite.addBenchmark(new UniaxialBenchmark(new HystereticMaterial(1, fy, ey, 1.2*fy, 8*ey, 0.2*fy, 20*ey,
+                                                                     -fy, -ey, -1.2*fy, -8*ey, -0.2*fy, -20*ey,
+                                                                     0.8, 0.2), 10*ey, -10*ey));
+}
@@ -0,0 +1,53 @@
+# Eigen.tcl: lowest modes of an elastic block of eight-node bricks.
+# Units: kN, m
+#
+# The block has (70*scale)^3 elements, about 10^6 equations at scale 1.
+
+if {![info exists bench(scale)]} {set bench(scale) 1}
+if {[info procs bench::phase] == ""} {namespace eval bench {proc phase {name} {}}}
+
+bench::phase build
+
+model basic -ndm 3 -ndf 3
+
+set n [expr max(2, int(round(70*$bench(scale))))]
+set d [expr 20.0/$n]
+
+proc nodeTag {i j k} {
+  global n
+  return [expr 1 + $i + ($n+1)*($j + ($n+1)*$k)]
+}
+
+for {set k 0} {$k <= $n} {incr k} {
+  for {set j 0} {$j <= $n} {incr j} {
+    for {set i 0} {$i <= $n} {incr i} {
+      node [nodeTag $i $j $k] [expr $i*$d] [expr $j*$d] [expr $k*$d]
+    }
+  }
+}
+for {set j 0} {$j <= $n} {incr j} {
+  for {set i 0} {$i <= $n} {incr i} {
+    fix [nodeTag $i $j 0] 1 1 1
+  }
+}
+
+nDMaterial ElasticIsotropic 1 2.5e7 0.2 2.4
+
+set eleTag 0
+for {set k 0} {$k < $n} {incr k} {
+  for {set j 0} {$j < $n} {incr j} {
+    for {set i 0} {$i < $n} {incr i} {
+      element stdBrick [incr eleTag] \
+        [nodeTag $i $j $k] [nodeTag [expr $i+1] $j $k] [nodeTag [expr $i+1] [expr $j+1] $k] [nodeTag $i [expr $j+1] $k] \
+        [nodeTag $i $j [expr $k+1]] [nodeTag [expr $i+1] $j [expr $k+1]] [nodeTag [expr $i+1] [expr $j+1] [expr $k+1]] [nodeTag $i [expr $j+1] [expr $k+1]] \
+        1
+    }
+  }
+}
+
+numberer RCM
+system SparseSYM
+
+bench::phase analysis
+set lambda [eigen 10]
+if {[llength $lambda] != 10} {error "eigen analysis failed"}
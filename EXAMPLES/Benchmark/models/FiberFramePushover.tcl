@@ -0,0 +1,99 @@
+# FiberFramePushover.tcl: multi-story, multi-bay R/C frame with fiber
+# force-based columns and girders, gravity followed by a displacement
+# controlled pushover.
+# Units: kip, in
+#
+# The frame has 4*scale stories and 3*scale bays; run from runBenchmarks.tcl
+# or stand-alone (scale defaults to 1).
+
+if {![info exists bench(scale)]} {set bench(scale) 1}
+if {[info procs bench::phase] == ""} {namespace eval bench {proc phase {name} {}}}
+
+bench::phase build
+
+model basic -ndm 2 -ndf 3
+
+set numStory [expr max(1, int(round(4*$bench(scale))))]
+set numBay   [expr max(1, int(round(3*$bench(scale))))]
+set H 144.0
+set L 288.0
+
+# nodes: tag = 100*floor + column line + 1
+for {set j 0} {$j <= $numStory} {incr j} {
+  for {set i 0} {$i <= $numBay} {incr i} {
+    node [expr 100*$j+$i+1] [expr $i*$L] [expr $j*$H]
+  }
+}
+for {set i 0} {$i <= $numBay} {incr i} {
+  fix [expr $i+1] 1 1 1
+}
+
+# core, cover concrete and reinforcing steel
+uniaxialMaterial Concrete02 1 -5.0 -0.005 -4.5 -0.02 0.1 0.5 300.0
+uniaxialMaterial Concrete02 2 -4.0 -0.002  0.0 -0.006 0.1 0.5 300.0
+uniaxialMaterial Steel02    3 60.0 29000.0 0.01 18.0 0.925 0.15
+
+# column section
+section Fiber 1 {
+  patch quad 1 12 1 -10.0 -10.0  10.0 -10.0  10.0  10.0 -10.0  10.0
+  patch quad 2 2  1 -12.0 -12.0  12.0 -12.0  12.0 -10.0 -12.0 -10.0
+  patch quad 2 2  1 -12.0  10.0  12.0  10.0  12.0  12.0 -12.0  12.0
+  layer straight 3 4 1.0 -9.0 -9.0 -9.0  9.0
+  layer straight 3 4 1.0  9.0 -9.0  9.0  9.0
+}
+
+# girder section
+section Fiber 2 {
+  patch quad 1 12 1 -12.0 -9.0  12.0 -9.0  12.0  9.0 -12.0  9.0
+  layer straight 3 3 1.0 -9.0 -9.0 -9.0  9.0
+  layer straight 3 3 1.0  9.0 -9.0  9.0  9.0
+}
+
+geomTransf PDelta 1
+geomTransf Linear 2
+
+set np 5
+set eleTag 0
+for {set j 1} {$j <= $numStory} {incr j} {
+  for {set i 0} {$i <= $numBay} {incr i} {
+    element forceBeamColumn [incr eleTag] [expr 100*($j-1)+$i+1] [expr 100*$j+$i+1] 1 Lobatto 1 $np
+  }
+  for {set i 0} {$i < $numBay} {incr i} {
+    element forceBeamColumn [incr eleTag] [expr 100*$j+$i+1] [expr 100*$j+$i+2] 2 Lobatto 2 $np
+  }
+}
+
+# gravity
+set P -180.0
+pattern Plain 1 Linear {
+  for {set j 1} {$j <= $numStory} {incr j} {
+    for {set i 0} {$i <= $numBay} {incr i} {
+      load [expr 100*$j+$i+1] 0.0 $P 0.0
+    }
+  }
+}
+
+system BandGeneral
+constraints Plain
+numberer RCM
+test NormDispIncr 1.0e-12 10
+algorithm Newton
+integrator LoadControl 0.1
+analysis Static
+
+bench::phase analysis
+if {[analyze 10] != 0} {error "gravity analysis failed"}
+loadConst -time 0.0
+
+# lateral load in proportion to floor height
+pattern Plain 2 Linear {
+  for {set j 1} {$j <= $numStory} {incr j} {
+    load [expr 100*$j+1] [expr double($j)/$numStory] 0.0 0.0
+  }
+}
+
+set roof [expr 100*$numStory+1]
+set dU   [expr 0.005*$numStory*$H/100.0]
+integrator DisplacementControl $roof 1 $dU
+test NormDispIncr 1.0e-8 25
+if {[analyze 100] != 0} {error "pushover analysis failed"}
@@ -0,0 +1,104 @@
+# ShellBuilding.tcl: box-shaped building of four-node MITC4 shells forming
+# floor slabs and perimeter walls, Newmark transient under a harmonic
+# ground acceleration.
+# Units: kN, m
+#
+# The building has 3*scale stories and a plan of (8*scale)x(8*scale) shells
+# per slab; walls are meshed with two shells per story height.
+
+if {![info exists bench(scale)]} {set bench(scale) 1}
+if {[info procs bench::phase] == ""} {namespace eval bench {proc phase {name} {}}}
+
+bench::phase build
+
+model basic -ndm 3 -ndf 6
+
+set numStory [expr max(1, int(round(3*$bench(scale))))]
+set n        [expr max(2, int(round(8*$bench(scale))))]
+set B   12.0
+set H    3.0
+set d   [expr $B/$n]
+set nzs 2
+
+# plan grid at every level z = k*H/nzs; interior plan nodes only exist at
+# floor levels.
+proc nodeTag {i j k} {
+  global n
+  return [expr 1 + $i + ($n+1)*($j + ($n+1)*$k)]
+}
+
+set numLevel [expr $numStory*$nzs]
+for {set k 0} {$k <= $numLevel} {incr k} {
+  set z [expr $k*$H/$nzs]
+  set floor [expr {$k % $nzs == 0 && $k > 0}]
+  for {set j 0} {$j <= $n} {incr j} {
+    for {set i 0} {$i <= $n} {incr i} {
+      set edge [expr {$i == 0 || $j == 0 || $i == $n || $j == $n}]
+      if {$edge || $floor} {
+        node [nodeTag $i $j $k] [expr $i*$d] [expr $j*$d] $z
+        if {$k == 0} {
+          fix [nodeTag $i $j $k] 1 1 1 1 1 1
+        }
+      }
+    }
+  }
+}
+
+#                                   tag E       nu   h    rho
+section ElasticMembranePlateSection 1   2.5e7   0.2  0.25 2.4
+section ElasticMembranePlateSection 2   2.5e7   0.2  0.20 2.4
+
+set eleTag 0
+# walls: walk the perimeter of the plan
+set ring {}
+for {set i 0} {$i < $n} {incr i} {lappend ring [list $i 0]}
+for {set j 0} {$j < $n} {incr j} {lappend ring [list $n $j]}
+for {set i $n} {$i > 0} {incr i -1} {lappend ring [list $i $n]}
+for {set j $n} {$j > 0} {incr j -1} {lappend ring [list 0 $j]}
+set numRing [llength $ring]
+for {set k 0} {$k < $numLevel} {incr k} {
+  for {set r 0} {$r < $numRing} {incr r} {
+    lassign [lindex $ring $r] i1 j1
+    lassign [lindex $ring [expr ($r+1) % $numRing]] i2 j2
+    element ShellMITC4 [incr eleTag] [nodeTag $i1 $j1 $k] [nodeTag $i2 $j2 $k] \
+      [nodeTag $i2 $j2 [expr $k+1]] [nodeTag $i1 $j1 [expr $k+1]] 1
+  }
+}
+
+# slabs
+for {set s 1} {$s <= $numStory} {incr s} {
+  set k [expr $s*$nzs]
+  for {set j 0} {$j < $n} {incr j} {
+    for {set i 0} {$i < $n} {incr i} {
+      element ShellMITC4 [incr eleTag] [nodeTag $i $j $k] [nodeTag [expr $i+1] $j $k] \
+        [nodeTag [expr $i+1] [expr $j+1] $k] [nodeTag $i [expr $j+1] $k] 2
+    }
+  }
+}
+
+# floor mass lumped at the slab nodes
+set m [expr 0.5*$d*$d]
+for {set s 1} {$s <= $numStory} {incr s} {
+  set k [expr $s*$nzs]
+  for {set j 0} {$j <= $n} {incr j} {
+    for {set i 0} {$i <= $n} {incr i} {
+      mass [nodeTag $i $j $k] $m $m $m 0.0 0.0 0.0
+    }
+  }
+}
+
+timeSeries Trig 1 0.0 2.0 0.4 -factor 2.0
+pattern UniformExcitation 1 1 -accel 1
+
+rayleigh 0.0 0.0 0.0 0.002
+
+system UmfPack
+constraints Plain
+numberer RCM
+test NormDispIncr 1.0e-8 10
+algorithm Newton
+integrator Newmark 0.5 0.25
+analysis Transient
+
+bench::phase analysis
+if {[analyze 200 0.01] != 0} {error "transient analysis failed"}
@@ -0,0 +1,94 @@
+# SoilBlock3D.tcl: nonlinear 3D soil block of eight-node bricks with a
+# pressure-dependent J2 plasticity material, gravity followed by cyclic
+# lateral loading of the surface.
+# Units: kN, m
+#
+# The block has (12*scale)x(12*scale)x(6*scale) elements.
+
+if {![info exists bench(scale)]} {set bench(scale) 1}
+if {[info procs bench::phase] == ""} {namespace eval bench {proc phase {name} {}}}
+
+bench::phase build
+
+model basic -ndm 3 -ndf 3
+
+set nx [expr max(1, int(round(12*$bench(scale))))]
+set ny $nx
+set nz [expr max(1, int(round(6*$bench(scale))))]
+set dx 1.0
+set dz 1.0
+
+proc nodeTag {i j k} {
+  global nx ny
+  return [expr 1 + $i + ($nx+1)*($j + ($ny+1)*$k)]
+}
+
+for {set k 0} {$k <= $nz} {incr k} {
+  for {set j 0} {$j <= $ny} {incr j} {
+    for {set i 0} {$i <= $nx} {incr i} {
+      node [nodeTag $i $j $k] [expr $i*$dx] [expr $j*$dx] [expr $k*$dz]
+    }
+  }
+}
+
+# base fixed, lateral boundaries on rollers
+for {set k 0} {$k <= $nz} {incr k} {
+  for {set j 0} {$j <= $ny} {incr j} {
+    for {set i 0} {$i <= $nx} {incr i} {
+      set fx [expr {$k == 0 || $i == 0 || $i == $nx}]
+      set fy [expr {$k == 0 || $j == 0 || $j == $ny}]
+      set fz [expr {$k == 0}]
+      if {$fx || $fy || $fz} {
+        fix [nodeTag $i $j $k] $fx $fy $fz
+      }
+    }
+  }
+}
+
+#                        tag  K       G       sig0  sigInf delta  H
+nDMaterial J2Plasticity   1   1.0e5   4.0e4   60.0  80.0   10.0   1.0e3
+
+set rho 1.8
+set eleTag 0
+for {set k 0} {$k < $nz} {incr k} {
+  for {set j 0} {$j < $ny} {incr j} {
+    for {set i 0} {$i < $nx} {incr i} {
+      element stdBrick [incr eleTag] \
+        [nodeTag $i $j $k] [nodeTag [expr $i+1] $j $k] [nodeTag [expr $i+1] [expr $j+1] $k] [nodeTag $i [expr $j+1] $k] \
+        [nodeTag $i $j [expr $k+1]] [nodeTag [expr $i+1] $j [expr $k+1]] [nodeTag [expr $i+1] [expr $j+1] [expr $k+1]] [nodeTag $i [expr $j+1] [expr $k+1]] \
+        1 0.0 0.0 [expr -9.81*$rho]
+    }
+  }
+}
+
+# gravity
+pattern Plain 1 Linear {
+  eleLoad -range 1 $eleTag -type -selfWeight 0.0 0.0 1.0
+}
+
+system UmfPack
+constraints Transformation
+numberer RCM
+test NormDispIncr 1.0e-8 20
+algorithm Newton
+integrator LoadControl 0.25
+analysis Static
+
+bench::phase analysis
+if {[analyze 4] != 0} {error "self-weight analysis failed"}
+loadConst -time 0.0
+
+# cyclic shear traction on the surface nodes
+timeSeries Trig 2 0.0 4.0 1.0
+pattern Plain 2 2 {
+  set q [expr 15.0*$dx*$dx]
+  for {set j 0} {$j <= $ny} {incr j} {
+    for {set i 0} {$i <= $nx} {incr i} {
+      load [nodeTag $i $j $nz] $q 0.0 0.0
+    }
+  }
+}
+
+algorithm KrylovNewton
+integrator LoadControl 0.05
+if {[analyze 80] != 0} {error "cyclic analysis failed"}
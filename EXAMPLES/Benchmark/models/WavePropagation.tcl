@@ -0,0 +1,71 @@
+# WavePropagation.tcl: explicit central difference analysis of a stress
+# pulse travelling through an elastic plane strain half-space of
+# four-node quads with lumped mass.
+# Units: kN, m
+#
+# The mesh has (200*scale)x(100*scale) elements; the time step is chosen
+# below the critical step of the mesh.
+
+if {![info exists bench(scale)]} {set bench(scale) 1}
+if {[info procs bench::phase] == ""} {namespace eval bench {proc phase {name} {}}}
+
+bench::phase build
+
+model basic -ndm 2 -ndf 2
+
+set nx [expr max(2, int(round(200*$bench(scale))))]
+set ny [expr max(1, int(round(100*$bench(scale))))]
+set d  0.5
+
+set E   2.0e5
+set nu  0.25
+set rho 2.0
+
+for {set j 0} {$j <= $ny} {incr j} {
+  for {set i 0} {$i <= $nx} {incr i} {
+    node [expr 1 + $i + ($nx+1)*$j] [expr $i*$d] [expr -$j*$d]
+  }
+}
+
+# base fixed, sides on rollers
+for {set i 0} {$i <= $nx} {incr i} {
+  fix [expr 1 + $i + ($nx+1)*$ny] 1 1
+}
+for {set j 0} {$j < $ny} {incr j} {
+  fix [expr 1 + ($nx+1)*$j] 1 0
+  fix [expr 1 + $nx + ($nx+1)*$j] 1 0
+}
+
+nDMaterial ElasticIsotropic 1 $E $nu
+
+set eleTag 0
+for {set j 0} {$j < $ny} {incr j} {
+  for {set i 0} {$i < $nx} {incr i} {
+    set n1 [expr 1 + $i + ($nx+1)*($j+1)]
+    element quad [incr eleTag] $n1 [expr $n1+1] [expr $n1+1-($nx+1)] [expr $n1-($nx+1)] \
+      1.0 PlaneStrain 1 0.0 $rho 0.0 0.0
+  }
+}
+
+# half-sine pulse at the center of the free surface
+set Tp 0.02
+timeSeries Trig 1 0.0 [expr $Tp/2.0] $Tp
+pattern Plain 1 1 {
+  load [expr 1 + $nx/2] 0.0 -100.0
+}
+
+# critical step from the P-wave speed, with a safety factor
+set vp [expr sqrt($E*(1.0-$nu)/((1.0+$nu)*(1.0-2.0*$nu)*$rho))]
+set dt [expr 0.5*$d/$vp]
+set numStep [expr int(ceil(0.5*$nx*$d/$vp/$dt))]
+
+system Diagonal
+constraints Transformation
+numberer Plain
+test FixedNumIter 1
+algorithm Linear
+integrator CentralDifference
+analysis Transient
+
+bench::phase analysis
+if {[analyze $numStep $dt] != 0} {error "transient analysis failed"}
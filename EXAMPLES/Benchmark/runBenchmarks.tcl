@@ -0,0 +1,136 @@
+# runBenchmarks.tcl: end-to-end benchmark driver
+#
+# Runs each model script in models/ in turn, timing the model build and the
+# analysis separately, and writes the results as JSON.
+#
+#   OpenSees runBenchmarks.tcl ?-scale s? ?-json file? ?-filter text?
+#
+# -scale  multiplies the mesh size of every model (default 1.0; the eigen
+#         model has about 10^6 equations at scale 1)
+# -json   output file (default stdout)
+# -filter only run models whose name contains text
+
+set benchDir [file dirname [file normalize [info script]]]
+
+set bench(scale)  1.0
+set bench(json)   ""
+set bench(filter) ""
+foreach {flag value} $argv {
+  switch -- $flag {
+    -scale  {set bench(scale)  $value}
+    -json   {set bench(json)   $value}
+    -filter {set bench(filter) $value}
+    default {
+      puts stderr "runBenchmarks.tcl: unknown option $flag"
+      exit 2
+    }
+  }
+}
+
+set models {
+  FiberFramePushover
+  SoilBlock3D
+  ShellBuilding
+  WavePropagation
+  Eigen
+}
+
+# called by the model scripts to mark the start of each phase
+namespace eval bench {
+  variable phases {}
+  variable current ""
+  variable start 0
+
+  proc phase {name} {
+    variable current
+    variable start
+    set now [clock microseconds]
+    finish $now
+    set current $name
+    set start $now
+  }
+
+  proc finish {now} {
+    variable phases
+    variable current
+    variable start
+    if {$current ne ""} {
+      dict incr phases $current [expr {$now - $start}]
+    }
+    set current ""
+  }
+
+  proc reset {} {
+    variable phases {}
+    variable current ""
+  }
+}
+
+proc equationCount {} {
+  set n 0
+  foreach node [getNodeTags] {
+    foreach eq [nodeDOFs $node] {
+      if {$eq >= 0} {incr n}
+    }
+  }
+  return $n
+}
+
+proc jsonString {s} {
+  return "\"[string map {\\ \\\\ \" \\\" \n \\n} $s]\""
+}
+
+set results {}
+set failed 0
+foreach model $models {
+  if {$bench(filter) ne "" && [string first $bench(filter) $model] < 0} {
+    continue
+  }
+  puts stderr "models/$model ..."
+
+  wipe
+  bench::reset
+  set t0 [clock microseconds]
+  set ok [catch {source [file join $benchDir models $model.tcl]} msg]
+  set t1 [clock microseconds]
+  bench::finish $t1
+
+  set entry "    \{\"name\": [jsonString models/$model], "
+  if {$ok != 0} {
+    incr failed
+    puts stderr "models/$model failed: $msg"
+    append entry "\"error\": [jsonString $msg]\}"
+  } else {
+    set phases {}
+    dict for {name us} $bench::phases {
+      lappend phases "[jsonString $name]: [format %.6f [expr {$us*1.0e-6}]]"
+    }
+    append entry "\"seconds\": [format %.6f [expr {($t1-$t0)*1.0e-6}]], "
+    append entry "\"phases\": \{[join $phases {, }]\}, "
+    append entry "\"nodes\": [llength [getNodeTags]], "
+    append entry "\"elements\": [llength [getEleTags]], "
+    append entry "\"equations\": [equationCount]\}"
+  }
+  lappend results $entry
+}
+wipe
+
+set json "\{\n"
+append json "  \"suite\": \"OpenSees models\",\n"
+append json "  \"timestamp\": [jsonString [clock format [clock seconds] -format {%Y-%m-%dT%H:%M:%SZ} -gmt 1]],\n"
+append json "  \"scale\": $bench(scale),\n"
+append json "  \"tcl_version\": [jsonString [info patchlevel]],\n"
+append json "  \"benchmarks\": \[\n[join $results ",\n"]\n  \]\n"
+append json "\}"
+
+if {$bench(json) eq ""} {
+  puts $json
+} else {
+  set fp [open $bench(json) w]
+  puts $fp $json
+  close $fp
+}
+
+if {$failed} {
+  exit 1
+}
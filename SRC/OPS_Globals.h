@@ -48,14 +48,35 @@ extern OPS_Stream *opserrPtr;
 class Domain;
 class Element;
 
-extern double   ops_Dt;                // current delta T for current domain doing an update
-extern int ops_Creep;
-extern Domain  *ops_TheActiveDomain;   // current domain undergoing an update
-extern Element *ops_TheActiveElement;  // current element undergoing an update
+// The state of the analysis under way is kept per thread, so that
+// independent models can be analyzed concurrently on separate threads.
+// A Domain sets it for the calling thread when it is updated.
+extern thread_local double   ops_Dt;                // current delta T for current domain doing an update
+extern thread_local int ops_Creep;
+extern thread_local Domain  *ops_TheActiveDomain;   // current domain undergoing an update
+extern thread_local Element *ops_TheActiveElement;  // current element undergoing an update
 
 // global variable for initial state analysis
 // added: Chris McGann, University of Washington
-extern bool  ops_InitialStateAnalysis;
+extern thread_local bool  ops_InitialStateAnalysis;
+
+// A copy of the analysis state of one thread, for work that is handed
+// to other threads on its behalf.
+struct OPS_ThreadState {
+  double   dt           = ops_Dt;
+  int      creep        = ops_Creep;
+  Domain  *domain       = ops_TheActiveDomain;
+  Element *element      = ops_TheActiveElement;
+  bool     initialState = ops_InitialStateAnalysis;
+
+  void install(void) const {
+    ops_Dt                   = dt;
+    ops_Creep                = creep;
+    ops_TheActiveDomain      = domain;
+    ops_TheActiveElement     = element;
+    ops_InitialStateAnalysis = initialState;
+  }
+};
 
 #define OPS_PRINT_CURRENTSTATE 0
 #define OPS_PRINT_PRINTMODEL_SECTION  1
@@ -0,0 +1,639 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Purpose: This file contains the implementation of PackedChannel.
+
+#include <PackedChannel.h>
+#include <MovableObject.h>
+#include <Message.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <OPS_Globals.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <algorithm>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define PACKED_ID      1
+#define PACKED_VECTOR  2
+#define PACKED_MATRIX  3
+#define PACKED_MSG     4
+
+namespace {
+  struct PackedHeader {
+    char magic[8];
+    int version;
+    int numRecords;
+    long long numBytes;
+  };
+
+  const char packedMagic[8] = "OPSPACK";
+
+  inline size_t padded(size_t n) {return (n + 7) & ~(size_t)7;}
+}
+
+
+bool
+PackedChannel::RecordKey::operator<(const RecordKey &other) const
+{
+  if (type != other.type) return type < other.type;
+  if (dbTag != other.dbTag) return dbTag < other.dbTag;
+  if (commitTag != other.commitTag) return commitTag < other.commitTag;
+  if (numRows != other.numRows) return numRows < other.numRows;
+  return numCols < other.numCols;
+}
+
+
+PackedChannel::PackedChannel()
+:buffer(0), numBytes(0), capacity(0), numRecords(0),
+ isPacking(false), isMapped(false), nextRecord(0), nextRecordNumber(0)
+{
+  this->clear();
+}
+
+
+PackedChannel::~PackedChannel()
+{
+  this->release();
+}
+
+
+void
+PackedChannel::release(void)
+{
+  if (buffer != 0) {
+#ifndef _WIN32
+    if (isMapped == true)
+      munmap(buffer, numBytes);
+    else 
+#endif
+    if (capacity != 0)
+      free(buffer);
+  }
+  buffer = 0;
+  numBytes = 0;
+  capacity = 0;
+  numRecords = 0;
+  isPacking = false;
+  isMapped = false;
+  records.clear();
+  isReplaced.clear();
+}
+
+
+int
+PackedChannel::clear(void)
+{
+  if (capacity == 0) {
+    this->release();
+    capacity = 4096;
+    buffer = (char *)malloc(capacity);
+    if (buffer == 0) {
+      opserr << "PackedChannel::clear() - out of memory\n";
+      capacity = 0;
+      return -1;
+    }
+  }
+
+  PackedHeader *header = (PackedHeader *)buffer;
+  memcpy(header->magic, packedMagic, sizeof(packedMagic));
+  header->version = PACKED_CHANNEL_VERSION;
+  header->numRecords = 0;
+  header->numBytes = sizeof(PackedHeader);
+
+  numBytes = sizeof(PackedHeader);
+  numRecords = 0;
+  isPacking = true;
+  nextRecord = sizeof(PackedHeader);
+  nextRecordNumber = 0;
+  records.clear();
+  isReplaced.clear();
+  return 0;
+}
+
+
+int
+PackedChannel::getNumRecords(void) const
+{
+  return numRecords;
+}
+
+
+int
+PackedChannel::pack(int type, int dbTag, int commitTag, int numRows, int numCols,
+		    const void *data, int dataSize)
+{
+  // sending on a channel laid over a buffer starts a new one
+  if (isPacking == false && this->clear() < 0)
+    return -1;
+
+  size_t recordSize = sizeof(Record) + padded(dataSize);
+  if (numBytes + recordSize > capacity) {
+    size_t newCapacity = 2*capacity;
+    while (newCapacity < numBytes + recordSize)
+      newCapacity *= 2;
+    char *newBuffer = (char *)realloc(buffer, newCapacity);
+    if (newBuffer == 0) {
+      opserr << "PackedChannel::pack() - out of memory for a buffer of ";
+      opserr << (double)newCapacity << " bytes\n";
+      return -1;
+    }
+    buffer = newBuffer;
+    capacity = newCapacity;
+  }
+
+  Record *theRecord = (Record *)(buffer + numBytes);
+  theRecord->type = type;
+  theRecord->dbTag = dbTag;
+  theRecord->commitTag = commitTag;
+  theRecord->numRows = numRows;
+  theRecord->numCols = numCols;
+  theRecord->numBytes = padded(dataSize);
+
+  char *payload = buffer + numBytes + sizeof(Record);
+  if (dataSize > 0)
+    memcpy(payload, data, dataSize);
+  memset(payload + dataSize, 0, padded(dataSize) - dataSize);
+
+  numBytes += recordSize;
+  numRecords++;
+
+  PackedHeader *header = (PackedHeader *)buffer;
+  header->numRecords = numRecords;
+  header->numBytes = numBytes;
+  return 0;
+}
+
+
+const char *
+PackedChannel::unpack(int type, int dbTag, int commitTag, int numRows, int numCols)
+{
+  // try the record after the last one read, unless a later record replaces it
+  if (nextRecord + sizeof(Record) <= numBytes) {
+    const Record *theRecord = (const Record *)(buffer + nextRecord);
+    if (theRecord->type == type && theRecord->dbTag == dbTag &&
+	theRecord->commitTag == commitTag && 
+	(numRows < 0 || (theRecord->numRows == numRows && theRecord->numCols == numCols)) &&
+	(isReplaced.empty() || isReplaced[nextRecordNumber] == false)) {
+      const char *payload = buffer + nextRecord + sizeof(Record);
+      nextRecord += sizeof(Record) + theRecord->numBytes;
+      nextRecordNumber++;
+      return payload;
+    }
+  }
+
+  // otherwise search for it; a size < 0, as for recvMsgUnknownSize(), matches any
+  RecordEntry entry;
+  RecordKey key = {type, dbTag, commitTag, numRows, numCols};
+  if (numRows < 0)
+    key.numRows = key.numCols = INT_MIN;
+  entry.key = key;
+  std::vector<RecordEntry>::const_iterator it = 
+    std::lower_bound(records.begin(), records.end(), entry);
+  if (it == records.end() || it->key.type != type || it->key.dbTag != dbTag ||
+      it->key.commitTag != commitTag)
+    return 0;
+  if (numRows >= 0 && (it->key.numRows != numRows || it->key.numCols != numCols))
+    return 0;
+
+  const Record *theRecord = (const Record *)(buffer + it->offset);
+  nextRecord = it->offset + sizeof(Record) + theRecord->numBytes;
+  nextRecordNumber = it->number + 1;
+  return buffer + it->offset + sizeof(Record);
+}
+
+
+int
+PackedChannel::index(void)
+{
+  records.clear();
+  isReplaced.clear();
+  numRecords = 0;
+  isPacking = false;
+  nextRecord = sizeof(PackedHeader);
+  nextRecordNumber = 0;
+
+  // a file may hold several buffers written one after the other, each
+  // starting with its own header; their records are taken in order
+  size_t segment = 0;
+  do {
+    const PackedHeader *header = (const PackedHeader *)(buffer + segment);
+    if (buffer == 0 || numBytes < segment + sizeof(PackedHeader) ||
+	memcmp(header->magic, packedMagic, sizeof(packedMagic)) != 0) {
+      opserr << "PackedChannel - buffer is not a packed channel buffer\n";
+      records.clear();
+      return -1;
+    }
+    if (header->version != PACKED_CHANNEL_VERSION) {
+      opserr << "PackedChannel - buffer has format version " << header->version;
+      opserr << ", this build reads version " << PACKED_CHANNEL_VERSION << endln;
+      records.clear();
+      return -1;
+    }
+    if (header->numBytes < (long long)sizeof(PackedHeader) || 
+	(size_t)header->numBytes > numBytes - segment) {
+      opserr << "PackedChannel - buffer is truncated\n";
+      records.clear();
+      return -1;
+    }
+    size_t end = segment + header->numBytes;
+
+    int firstRecord = numRecords;
+    records.reserve(records.size() + (header->numRecords > 0 ? header->numRecords : 0));
+    size_t offset = segment + sizeof(PackedHeader);
+    while (offset + sizeof(Record) <= end) {
+      const Record *theRecord = (const Record *)(buffer + offset);
+      if (theRecord->numBytes < 0 || offset + sizeof(Record) + theRecord->numBytes > end) {
+	opserr << "PackedChannel - corrupt record " << numRecords << endln;
+	records.clear();
+	return -1;
+      }
+      RecordEntry entry;
+      RecordKey key = {theRecord->type, theRecord->dbTag, theRecord->commitTag,
+		       theRecord->numRows, theRecord->numCols};
+      entry.key = key;
+      entry.offset = offset;
+      entry.number = numRecords;
+      records.push_back(entry);
+      offset += sizeof(Record) + theRecord->numBytes;
+      numRecords++;
+    }
+
+    if (numRecords - firstRecord != header->numRecords) {
+      opserr << "PackedChannel - buffer holds " << numRecords - firstRecord;
+      opserr << " records, header says " << header->numRecords << endln;
+      records.clear();
+      return -1;
+    }
+    segment = end;
+  } while (segment < numBytes);
+
+  // sort by key, keeping only the last record sent with a key
+  std::stable_sort(records.begin(), records.end());
+  size_t numKept = 0;
+  for (size_t i = 0; i < records.size(); i++) {
+    if (i+1 < records.size() && !(records[i] < records[i+1])) {
+      if (isReplaced.empty())
+	isReplaced.resize(numRecords, false);
+      isReplaced[records[i].number] = true;
+    } else
+      records[numKept++] = records[i];
+  }
+  records.resize(numKept);
+
+  return 0;
+}
+
+
+int
+PackedChannel::writeFile(const char *fileName, bool append)
+{
+  if (buffer == 0) {
+    opserr << "PackedChannel::writeFile() - no buffer\n";
+    return -1;
+  }
+
+  FILE *theFile = fopen(fileName, append ? "ab" : "wb");
+  if (theFile == 0) {
+    opserr << "PackedChannel::writeFile() - could not open " << fileName << endln;
+    return -1;
+  }
+  size_t numWritten = fwrite(buffer, 1, numBytes, theFile);
+  if (fclose(theFile) != 0 || numWritten != numBytes) {
+    opserr << "PackedChannel::writeFile() - failed writing " << fileName << endln;
+    return -1;
+  }
+  return 0;
+}
+
+
+int
+PackedChannel::flush(Channel &theChannel, int dbTag, int commitTag,
+		     ChannelAddress *theAddress)
+{
+  if (buffer == 0) {
+    opserr << "PackedChannel::flush() - no buffer\n";
+    return -1;
+  }
+  if (numBytes > INT_MAX) {
+    opserr << "PackedChannel::flush() - buffer too large for one message\n";
+    return -1;
+  }
+
+  ID sizeData(2);
+  sizeData(0) = (int)numBytes;
+  sizeData(1) = PACKED_CHANNEL_VERSION;
+  if (theChannel.sendID(dbTag, commitTag, sizeData, theAddress) < 0) {
+    opserr << "PackedChannel::flush() - failed to send the buffer size\n";
+    return -1;
+  }
+
+  Message theMessage(buffer, (int)numBytes);
+  if (theChannel.sendMsg(dbTag, commitTag, theMessage, theAddress) < 0) {
+    opserr << "PackedChannel::flush() - failed to send the buffer\n";
+    return -1;
+  }
+  return 0;
+}
+
+
+int
+PackedChannel::setBuffer(const char *data, size_t size)
+{
+  this->release();
+  buffer = (char *)data;
+  numBytes = size;
+  return this->index();
+}
+
+
+int
+PackedChannel::openFile(const char *fileName)
+{
+  this->release();
+
+#ifndef _WIN32
+  int fd = open(fileName, O_RDONLY);
+  struct stat fileStat;
+  if (fd < 0 || fstat(fd, &fileStat) != 0) {
+    opserr << "PackedChannel::openFile() - could not open " << fileName << endln;
+    if (fd >= 0)
+      close(fd);
+    return -1;
+  }
+
+  numBytes = fileStat.st_size;
+  void *mem = mmap(0, numBytes, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mem == MAP_FAILED) {
+    opserr << "PackedChannel::openFile() - could not map " << fileName << endln;
+    numBytes = 0;
+    return -1;
+  }
+  buffer = (char *)mem;
+  isMapped = true;
+#else
+  FILE *theFile = fopen(fileName, "rb");
+  if (theFile == 0) {
+    opserr << "PackedChannel::openFile() - could not open " << fileName << endln;
+    return -1;
+  }
+  fseek(theFile, 0, SEEK_END);
+  long size = ftell(theFile);
+  fseek(theFile, 0, SEEK_SET);
+  buffer = (char *)malloc(size);
+  if (buffer == 0 || fread(buffer, 1, size, theFile) != (size_t)size) {
+    opserr << "PackedChannel::openFile() - could not read " << fileName << endln;
+    fclose(theFile);
+    this->release();
+    return -1;
+  }
+  fclose(theFile);
+  numBytes = size;
+  capacity = size;
+#endif
+
+  if (this->index() < 0) {
+    this->release();
+    return -1;
+  }
+  return 0;
+}
+
+
+int
+PackedChannel::receive(Channel &theChannel, int dbTag, int commitTag,
+		       ChannelAddress *theAddress)
+{
+  ID sizeData(2);
+  if (theChannel.recvID(dbTag, commitTag, sizeData, theAddress) < 0) {
+    opserr << "PackedChannel::receive() - failed to receive the buffer size\n";
+    return -1;
+  }
+  if (sizeData(1) != PACKED_CHANNEL_VERSION) {
+    opserr << "PackedChannel::receive() - sender uses format version " << sizeData(1);
+    opserr << ", this build reads version " << PACKED_CHANNEL_VERSION << endln;
+    return -1;
+  }
+
+  this->release();
+  capacity = sizeData(0);
+  buffer = (char *)malloc(capacity);
+  if (buffer == 0) {
+    opserr << "PackedChannel::receive() - out of memory\n";
+    capacity = 0;
+    return -1;
+  }
+
+  Message theMessage(buffer, sizeData(0));
+  if (theChannel.recvMsg(dbTag, commitTag, theMessage, theAddress) < 0) {
+    opserr << "PackedChannel::receive() - failed to receive the buffer\n";
+    this->release();
+    return -1;
+  }
+  numBytes = sizeData(0);
+
+  if (this->index() < 0) {
+    this->release();
+    return -1;
+  }
+  return 0;
+}
+
+
+char *
+PackedChannel::addToProgram(void)
+{
+  opserr << "PackedChannel::addToProgram() - should not be called\n";
+  return 0;
+}
+
+
+int
+PackedChannel::setUpConnection(void)
+{
+  return 0;
+}
+
+
+int
+PackedChannel::setNextAddress(const ChannelAddress &theAddress)
+{
+  return 0;
+}
+
+
+ChannelAddress *
+PackedChannel::getLastSendersAddress(void)
+{
+  return 0;
+}
+
+
+int
+PackedChannel::sendObj(int commitTag,
+		       MovableObject &theObject, 
+		       ChannelAddress *theAddress)
+{
+  return theObject.sendSelf(commitTag, *this);
+}
+
+
+int
+PackedChannel::recvObj(int commitTag,
+		       MovableObject &theObject, 
+		       FEM_ObjectBroker &theBroker,
+		       ChannelAddress *theAddress)
+{
+  return theObject.recvSelf(commitTag, *this, theBroker);
+}
+
+
+int
+PackedChannel::sendMsg(int dbTag, int commitTag, 
+		       const Message &theMessage, 
+		       ChannelAddress *theAddress)
+{
+  return this->pack(PACKED_MSG, dbTag, commitTag, theMessage.length, 1,
+		    theMessage.data, theMessage.length);
+}
+
+
+int
+PackedChannel::recvMsg(int dbTag, int commitTag, 
+		       Message &theMessage, 
+		       ChannelAddress *theAddress)
+{
+  const char *data = this->unpack(PACKED_MSG, dbTag, commitTag, theMessage.length, 1);
+  if (data == 0) {
+    opserr << "PackedChannel::recvMsg() - no message of " << theMessage.length;
+    opserr << " bytes with dbTag " << dbTag << " and commitTag " << commitTag << endln;
+    return -1;
+  }
+  memcpy(theMessage.data, data, theMessage.length);
+  return 0;
+}
+
+
+int
+PackedChannel::recvMsgUnknownSize(int dbTag, int commitTag, 
+				  Message &theMessage, 
+				  ChannelAddress *theAddress)
+{
+  const char *data = this->unpack(PACKED_MSG, dbTag, commitTag, -1, -1);
+  if (data == 0) {
+    opserr << "PackedChannel::recvMsgUnknownSize() - no message with dbTag " << dbTag;
+    opserr << " and commitTag " << commitTag << endln;
+    return -1;
+  }
+
+  // the message points into the buffer; it is valid until the channel is cleared
+  const Record *theRecord = (const Record *)(data - sizeof(Record));
+  theMessage.setData((char *)data, theRecord->numRows);
+  return 0;
+}
+
+
+int
+PackedChannel::sendMatrix(int dbTag, int commitTag, 
+			  const Matrix &theMatrix, 
+			  ChannelAddress *theAddress)
+{
+  return this->pack(PACKED_MATRIX, dbTag, commitTag, theMatrix.numRows, theMatrix.numCols,
+		    theMatrix.data, theMatrix.dataSize*sizeof(double));
+}
+
+
+int
+PackedChannel::recvMatrix(int dbTag, int commitTag, 
+			  Matrix &theMatrix, 
+			  ChannelAddress *theAddress)
+{
+  const char *data = this->unpack(PACKED_MATRIX, dbTag, commitTag, 
+				  theMatrix.numRows, theMatrix.numCols);
+  if (data == 0) {
+    opserr << "PackedChannel::recvMatrix() - no " << theMatrix.numRows << "x" << theMatrix.numCols;
+    opserr << " matrix with dbTag " << dbTag << " and commitTag " << commitTag << endln;
+    return -1;
+  }
+  memcpy(theMatrix.data, data, theMatrix.dataSize*sizeof(double));
+  return 0;
+}
+
+
+int
+PackedChannel::sendVector(int dbTag, int commitTag, 
+			  const Vector &theVector, 
+			  ChannelAddress *theAddress)
+{
+  return this->pack(PACKED_VECTOR, dbTag, commitTag, theVector.sz, 1,
+		    theVector.theData, theVector.sz*sizeof(double));
+}
+
+
+int
+PackedChannel::recvVector(int dbTag, int commitTag, 
+			  Vector &theVector, 
+			  ChannelAddress *theAddress)
+{
+  const char *data = this->unpack(PACKED_VECTOR, dbTag, commitTag, theVector.sz, 1);
+  if (data == 0) {
+    opserr << "PackedChannel::recvVector() - no vector of size " << theVector.sz;
+    opserr << " with dbTag " << dbTag << " and commitTag " << commitTag << endln;
+    return -1;
+  }
+  memcpy(theVector.theData, data, theVector.sz*sizeof(double));
+  return 0;
+}
+
+
+int
+PackedChannel::sendID(int dbTag, int commitTag,
+		      const ID &theID, 
+		      ChannelAddress *theAddress)
+{
+  return this->pack(PACKED_ID, dbTag, commitTag, theID.sz, 1,
+		    theID.data, theID.sz*sizeof(int));
+}
+
+
+int
+PackedChannel::recvID(int dbTag, int commitTag,
+		      ID &theID, 
+		      ChannelAddress *theAddress)
+{
+  const char *data = this->unpack(PACKED_ID, dbTag, commitTag, theID.sz, 1);
+  if (data == 0) {
+    opserr << "PackedChannel::recvID() - no ID of size " << theID.sz;
+    opserr << " with dbTag " << dbTag << " and commitTag " << commitTag << endln;
+    return -1;
+  }
+  memcpy(theID.data, data, theID.sz*sizeof(int));
+  return 0;
+}
@@ -0,0 +1,160 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Purpose: This file contains the class definition for PackedChannel.
+// PackedChannel is a sub-class of channel that does not communicate.
+// In its packing state the send calls an object graph makes in its
+// sendSelf() are appended, each as a record with its dbTag and
+// commitTag, to one contiguous buffer; that buffer can then be written
+// to a file with one write, or passed on another channel as a single
+// message. In its unpacking state the channel is laid over such a
+// buffer, held in memory or mapped from a file, and the recv calls of
+// recvSelf() are served from it. Records are found by type, size,
+// dbTag and commitTag; as recvSelf() normally asks for them in the
+// order they were sent, the record after the last one read is tried
+// first. A later record with the same key replaces an earlier one, as
+// in FE_Datastore.
+//
+// The payloads are copied into the buffer when sent: sendSelf()
+// implementations commonly send a static or local ID or Vector and
+// reuse it, so a reference to it is not valid until the buffer is
+// written. Receiving copies straight from the (mapped) buffer into
+// the object's storage.
+//
+// The buffer starts with a header holding a magic string, a format
+// version and the number of records; every record and payload starts
+// on an 8 byte boundary. Buffers may be appended to one file; when the
+// file is read back their records are taken in the order written, so
+// a record in a later buffer replaces one with the same key before it.
+
+#ifndef PackedChannel_h
+#define PackedChannel_h
+
+#include <Channel.h>
+#include <stddef.h>
+#include <vector>
+
+#define PACKED_CHANNEL_VERSION 1
+
+class PackedChannel : public Channel
+{
+  public:
+    PackedChannel();
+    ~PackedChannel();
+
+    // packing
+    int clear(void);
+    const char *getBuffer(void) const {return buffer;}
+    size_t getNumBytes(void) const {return numBytes;}
+    int getNumRecords(void) const;
+    int writeFile(const char *fileName, bool append = false);
+    int flush(Channel &theChannel, int dbTag, int commitTag,
+	      ChannelAddress *theAddress =0);
+
+    // unpacking
+    int setBuffer(const char *data, size_t size);
+    int openFile(const char *fileName);
+    int receive(Channel &theChannel, int dbTag, int commitTag,
+		ChannelAddress *theAddress =0);
+
+    char *addToProgram(void);
+    int setUpConnection(void);
+    int setNextAddress(const ChannelAddress &otherChannelAddress);
+    ChannelAddress *getLastSendersAddress(void);
+
+    int sendObj(int commitTag,
+		MovableObject &theObject, 
+		ChannelAddress *theAddress =0);
+    int recvObj(int commitTag,
+		MovableObject &theObject, 
+		FEM_ObjectBroker &theBroker,
+		ChannelAddress *theAddress =0);
+
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag,
+	       const ID &theID,
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+	       ID &theID,
+	       ChannelAddress *theAddress =0);
+
+  private:
+    struct Record {
+      int type;
+      int dbTag;
+      int commitTag;
+      int numRows;       // entries of an ID or Vector, rows of a Matrix, bytes of a Message
+      int numCols;       // columns of a Matrix, otherwise 1
+      int numBytes;      // payload size, padded to 8 bytes
+    };
+    struct RecordKey {
+      int type, dbTag, commitTag, numRows, numCols;
+      bool operator<(const RecordKey &other) const;
+    };
+    struct RecordEntry {
+      RecordKey key;
+      size_t offset;
+      int number;
+      bool operator<(const RecordEntry &other) const {return key < other.key;}
+    };
+
+    int pack(int type, int dbTag, int commitTag, int numRows, int numCols,
+	     const void *data, int dataSize);
+    const char *unpack(int type, int dbTag, int commitTag, int numRows, int numCols);
+    int index(void);
+    void release(void);
+
+    char *buffer;              // packing buffer, or the buffer unpacked
+    size_t numBytes;
+    size_t capacity;           // 0 if buffer is not ours
+    int numRecords;
+    bool isPacking;            // appending to buffer, not reading it
+
+    bool isMapped;             // buffer is a mapped file
+    size_t nextRecord;         // offset of the record after the last read
+    int nextRecordNumber;
+    std::vector<RecordEntry> records;  // last record of each key, sorted by key
+    std::vector<bool> isReplaced;      // by record number, empty if no key repeats
+};
+
+#endif
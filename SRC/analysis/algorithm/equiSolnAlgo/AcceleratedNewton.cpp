@@ -247,7 +247,7 @@ AcceleratedNewton::getTest(void)
 int
 AcceleratedNewton::sendSelf(int cTag, Channel &theChannel)
 {
-  static ID data(2);
+  static thread_local ID data(2);
   data(0) = tangent;
   if (theAccelerator != 0)
     data(1) = theAccelerator->getClassTag();
@@ -275,7 +275,7 @@ int
 AcceleratedNewton::recvSelf(int cTag, Channel &theChannel, 
                             FEM_ObjectBroker &theBroker)
 {
-  static ID data(2);
+  static thread_local ID data(2);
   int res = theChannel.recvID(0, cTag, data);
 
   if (res < 0) {
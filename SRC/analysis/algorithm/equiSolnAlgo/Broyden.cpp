@@ -428,7 +428,7 @@ Broyden::getConvergenceTest(void)
 int
 Broyden::sendSelf(int cTag, Channel &theChannel)
 {
-  static ID data(2);
+  static thread_local ID data(2);
   data(0) = tangent;
   data(1) = numberLoops;
   if (theChannel.sendID(0, cTag, data) < 0) {
@@ -443,7 +443,7 @@ Broyden::recvSelf(int cTag,
                   Channel &theChannel, 
                   FEM_ObjectBroker &theBroker)
 {
-  static ID data(2);
+  static thread_local ID data(2);
   if (theChannel.recvID(0, cTag, data) < 0) {
     opserr << "Broyden::recvSelf() - failed to recv data\n";
     return -1;
@@ -162,7 +162,7 @@ ExpressNewton::setConvergenceTest(ConvergenceTest *theNewTest)
 int
 ExpressNewton::sendSelf(int cTag, Channel &theChannel)
 {
-  static Vector data(4);
+  static thread_local Vector data(4);
   data(0) = nIter;
   data(1) = kMultiplier1;
   data(1) = kMultiplier2;
@@ -175,7 +175,7 @@ ExpressNewton::sendSelf(int cTag, Channel &theChannel)
 int
 ExpressNewton::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  static Vector data(4);
+  static thread_local Vector data(4);
   theChannel.recvVector(this->getDbTag(), cTag, data);
   nIter = int(data(0));
   kMultiplier1 = data(1);
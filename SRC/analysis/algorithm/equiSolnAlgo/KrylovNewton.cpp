@@ -220,7 +220,7 @@ KrylovNewton::solveCurrentStep(void)
 int
 KrylovNewton::sendSelf(int cTag, Channel &theChannel)
 {
-  static ID data(2);
+  static thread_local ID data(2);
   data(0) = tangent;
   data(1) = maxDimension;
   if (theChannel.sendID(cTag, 0, data) < 0) {
@@ -234,7 +234,7 @@ int
 KrylovNewton::recvSelf(int cTag, Channel &theChannel, 
                                            FEM_ObjectBroker &theBroker)
 {
-  static ID data(2);
+  static thread_local ID data(2);
   if (theChannel.recvID(cTag, 0, data) <  0) {
     opserr << "KrylovNewton::recvSelf() - failed\n";
     return -1;
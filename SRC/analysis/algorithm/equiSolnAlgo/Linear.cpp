@@ -103,7 +103,7 @@ Linear::setConvergenceTest(ConvergenceTest *theNewTest)
 int
 Linear::sendSelf(int cTag, Channel &theChannel)
 {
-  static ID iData(2);
+  static thread_local ID iData(2);
   iData(0) = incrTangent;
   iData(1) = factorOnce;
   return theChannel.sendID(cTag, 0, iData);
@@ -112,7 +112,7 @@ Linear::sendSelf(int cTag, Channel &theChannel)
 int
 Linear::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  static ID iData(2);
+  static thread_local ID iData(2);
   theChannel.recvID(cTag, 0, iData);
   incrTangent = iData(0);
   factorOnce = iData(1);
@@ -160,7 +160,7 @@ ModifiedNewton::solveCurrentStep(void)
 int
 ModifiedNewton::sendSelf(int cTag, Channel &theChannel)
 {
-  static Vector data(3);
+  static thread_local Vector data(3);
   data(0) = tangent;
   data(1) = iFactor;
   data(2) = cFactor;
@@ -172,7 +172,7 @@ ModifiedNewton::recvSelf(int cTag,
                         Channel &theChannel, 
                         FEM_ObjectBroker &theBroker)
 {
-  static Vector data(3);
+  static thread_local Vector data(3);
   theChannel.recvVector(this->getDbTag(), cTag, data);
   tangent = data(0);
   iFactor = data(1);
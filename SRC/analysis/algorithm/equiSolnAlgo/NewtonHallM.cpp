@@ -205,7 +205,7 @@ NewtonHallM::solveCurrentStep(void)
 int
 NewtonHallM::sendSelf(int cTag, Channel &theChannel)
 {
-  static Vector data(4);
+  static thread_local Vector data(4);
   data(0) = iFactor;;
   data(1) = method;
   data(2) = alpha;
@@ -218,7 +218,7 @@ NewtonHallM::recvSelf(int cTag,
                       Channel &theChannel, 
                       FEM_ObjectBroker &theBroker)
 {
-  static Vector data(4);
+  static thread_local Vector data(4);
   theChannel.recvVector(this->getDbTag(), cTag, data);
   iFactor = data(0);
   method = data(1);
@@ -191,7 +191,7 @@ NewtonLineSearch::getConvergenceTest(void)
 int
 NewtonLineSearch::sendSelf(int cTag, Channel &theChannel)
 {
-  static ID data(1);
+  static thread_local ID data(1);
   data(0) = theLineSearch->getClassTag();
   if (theChannel.sendID(0, cTag, data) < 0) {
     opserr << "NewtonLineSearch::sendSelf(int cTag, Channel &theChannel)   - failed to send date\n";
@@ -211,7 +211,7 @@ NewtonLineSearch::recvSelf(int cTag,
                         Channel &theChannel, 
                         FEM_ObjectBroker &theBroker)
 {
-  static ID data(1);
+  static thread_local ID data(1);
   if (theChannel.recvID(0, cTag, data) < 0) {
     opserr << "NewtonLineSearch::recvSelf(int cTag, Channel &theChannel) - failed to recv data\n";
     return -1;
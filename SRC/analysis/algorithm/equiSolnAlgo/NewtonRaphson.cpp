@@ -200,7 +200,7 @@ NewtonRaphson::solveCurrentStep(void)
 int
 NewtonRaphson::sendSelf(int cTag, Channel &theChannel)
 {
-  static Vector data(3);
+  static thread_local Vector data(3);
   data(0) = tangent;
   data(1) = iFactor;
   data(2) = cFactor;
@@ -212,7 +212,7 @@ NewtonRaphson::recvSelf(int cTag,
                         Channel &theChannel, 
                         FEM_ObjectBroker &theBroker)
 {
-  static Vector data(3);
+  static thread_local Vector data(3);
   theChannel.recvVector(this->getDbTag(), cTag, data);
   tangent = int(data(0));
   iFactor = data(1);
@@ -153,7 +153,7 @@ PeriodicNewton::sendSelf(int cTag, Channel &theChannel)
 {
   int result = 0;
   int dataTag = this->getDbTag();
-  static ID data(3);
+  static thread_local ID data(3);
   data(0) = theTest->getClassTag();
   data(1) = theTest->getDbTag();
   data(2) = maxCount;
@@ -178,7 +178,7 @@ PeriodicNewton::recvSelf(int cTag,
                         Channel &theChannel, 
                         FEM_ObjectBroker &theBroker)
 {
-    static ID data(3);
+    static thread_local ID data(3);
     int result;
     int dataTag = this->getDbTag();
 
@@ -332,7 +332,7 @@ KrylovAccelerator::Print(OPS_Stream &s, int flag)
 int
 KrylovAccelerator::sendSelf(int commitTag, Channel &theChannel)
 {
-  static ID data(2);
+  static thread_local ID data(2);
   data(0) = theTangent;
   data(1) = maxDimension;
   return theChannel.sendID(0, commitTag, data);
@@ -342,7 +342,7 @@ int
 KrylovAccelerator::recvSelf(int commitTag, Channel &theChannel, 
                             FEM_ObjectBroker &theBroker)
 {
-  static ID data(2);
+  static thread_local ID data(2);
   int res = theChannel.recvID(0, commitTag, data);
   theTangent = data(0);
   maxDimension = data(1);
@@ -145,7 +145,7 @@ PeriodicAccelerator::Print(OPS_Stream &s, int flag)
 int
 PeriodicAccelerator::sendSelf(int commitTag, Channel &theChannel)
 {
-  static ID data(2);
+  static thread_local ID data(2);
   data(0) = theTangent;
   data(1) = maxIter;
   return theChannel.sendID(0, commitTag, data);
@@ -156,7 +156,7 @@ int
 PeriodicAccelerator::recvSelf(int commitTag, Channel &theChannel, 
 			    FEM_ObjectBroker &theBroker)
 {
-  static ID data(2);
+  static thread_local ID data(2);
   int res = theChannel.recvID(0, commitTag, data);
   theTangent = data(0);
   maxIter = data(1);
@@ -111,7 +111,7 @@ RaphsonAccelerator::Print(OPS_Stream &s, int flag)
 int
 RaphsonAccelerator::sendSelf(int commitTag, Channel &theChannel)
 {
-  static ID data(1);
+  static thread_local ID data(1);
   data(0) = theTangent;
   return theChannel.sendID(0, commitTag, data);
 }
@@ -120,7 +120,7 @@ int
 RaphsonAccelerator::recvSelf(int commitTag, Channel &theChannel, 
 			    FEM_ObjectBroker &theBroker)
 {
-  static ID data(1);
+  static thread_local ID data(1);
   int res = theChannel.recvID(0, commitTag, data);
   theTangent = data(0);
   return res;
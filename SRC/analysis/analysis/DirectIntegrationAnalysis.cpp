@@ -183,6 +183,17 @@ DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 
 int 
 DirectIntegrationAnalysis::analyzeStep(double dT)
+{
+  return this->analyzeStep(theAlgorithm, theTest, dT);
+}
+
+//
+// Take one step with the given algorithm and test; an algorithm other
+// than that of the analysis is first linked to the model, integrator
+// and system of the analysis.
+//
+int 
+DirectIntegrationAnalysis::analyzeStep(EquiSolnAlgo *algorithm, ConvergenceTest *test, double dT)
 {
   int result = 0;
   Domain *the_Domain = this->getDomainPtr();
@@ -197,13 +208,21 @@ DirectIntegrationAnalysis::analyzeStep(double dT)
   // check if domain has undergone change
   int stamp = the_Domain->hasDomainChanged();
   if (stamp != domainStamp) {
+    bool onlyNodesAdded = the_Domain->hasOnlyAddedNodes(domainStamp);
     domainStamp = stamp;	
-    if (this->domainChanged() < 0) {
+    if (onlyNodesAdded)
+      result = this->nodesAdded();
+    else
+      result = this->domainChanged();
+    if (result < 0) {
       opserr << "DirectIntegrationAnalysis::analyze() - domainChanged() failed\n";
       return -1;
     }	
   }
   
+  if (algorithm != theAlgorithm)
+    algorithm->setLinks(*theAnalysisModel, *theIntegrator, *theSOE, test);
+
   if (theIntegrator->newStep(dT) < 0) {
     opserr << "DirectIntegrationAnalysis::analyze() - the Integrator failed";
     opserr << " at time " << the_Domain->getCurrentTime() << endln;
@@ -212,7 +231,7 @@ DirectIntegrationAnalysis::analyzeStep(double dT)
     return -2;
   }
   
-  result = theAlgorithm->solveCurrentStep();
+  result = algorithm->solveCurrentStep();
   if (result < 0) {
     opserr << "DirectIntegrationAnalysis::analyze() - the Algorithm failed";
     opserr << " at time " << the_Domain->getCurrentTime() << endln;
@@ -383,6 +402,39 @@ DirectIntegrationAnalysis::eigen(int numMode, bool generalized, bool findSmalles
 
 
 
+// 
+// Nodes added to the domain on their own are numbered after the
+// existing equations by the constraint handler; the model is not
+// handled and numbered again, only the system of equations is resized.
+//
+int
+DirectIntegrationAnalysis::nodesAdded(void)
+{
+    if (theConstraintHandler->handleAddedNodes() < 0)
+      return this->domainChanged();
+
+    Graph &theGraph = theAnalysisModel->getDOFGraph();
+    if (theSOE->setSize(theGraph) < 0) {
+	opserr << "DirectIntegrationAnalysis::nodesAdded() - ";
+	opserr << "LinearSOE::setSize() failed";
+	return -3;
+    }	    
+
+    if (theEigenSOE != 0 && theEigenSOE->setSize(theGraph) < 0) {
+	opserr << "DirectIntegrationAnalysis::nodesAdded() - ";
+	opserr << "EigenSOE::setSize() failed";
+	return -3;
+    }	    
+
+    theAnalysisModel->clearDOFGraph();
+
+    // we invoke domainChange() on the integrator and algorithm
+    theIntegrator->domainChanged();
+    theAlgorithm->domainChanged();
+
+    return 0;
+}
+
 int
 DirectIntegrationAnalysis::domainChanged(void)
 {
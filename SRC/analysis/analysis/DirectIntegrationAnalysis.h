@@ -69,6 +69,7 @@ class DirectIntegrationAnalysis: public TransientAnalysis
     
     int analyze(int numSteps, double dT);
     int analyzeStep(double dT);
+    int analyzeStep(EquiSolnAlgo *theAlgorithm, ConvergenceTest *theTest, double dT);
     int analyzeSubLevel(int level, double dT);
     int eigen(int numMode, bool generlzed = true, bool findSmallest = true);
     int initialize(void);
@@ -91,6 +92,8 @@ class DirectIntegrationAnalysis: public TransientAnalysis
   protected:
     
   private:
+    int nodesAdded(void);
+
     ConstraintHandler 	*theConstraintHandler;    
     DOF_Numberer 	*theDOF_Numberer;
     AnalysisModel 	*theAnalysisModel;
@@ -718,7 +718,7 @@ DomainDecompositionAnalysis::setConvergenceTest(ConvergenceTest &theTest)
 int 
 DomainDecompositionAnalysis::checkAllResult(int mine)
 {
-  static ID data(1);
+  static thread_local ID data(1);
   data(0) = mine;
   if (myChannel != 0) {
     myChannel->sendID(0,0,data);
@@ -98,7 +98,7 @@ OPS_ADD_RUNTIME_VXV(OPS_ResponseSpectrumAnalysis)
 	// responseSpectrum $tsTag $dir <-scale $scale>
 
 	// some kudos
-	static bool first_done = false;
+	static thread_local bool first_done = false;
 	if (!first_done) {
 		opserr << "Using ResponseSpectrumAnalysis - Developed by: Massimo Petracca, Guido Camata, ASDEA Software Technology\n";
 		first_done = true;
@@ -127,91 +127,114 @@ StaticAnalysis::clearAll(void)
 
 int 
 StaticAnalysis::analyze(int numSteps)
+{
+    for (int i=0; i<numSteps; i++) {
+	int result = this->analyzeStep(theAlgorithm, theTest, 0.0);
+	if (result < 0) {
+	    if (result != -3) {
+		opserr << "StaticAnalysis::analyze() - failed at step " << i;
+		opserr << " of " << numSteps << endln;
+	    }
+	    return result;
+	}
+    }
+    
+    return 0;
+}
+
+
+//
+// Take one step with the given algorithm and test; an algorithm other
+// than that of the analysis is first linked to the model, integrator
+// and system of the analysis.
+//
+int 
+StaticAnalysis::analyzeStep(EquiSolnAlgo *algorithm, ConvergenceTest *test, double dT)
 {
     int result = 0;
     Domain *the_Domain = this->getDomainPtr();
 
-    for (int i=0; i<numSteps; i++) {
-
-	result = theAnalysisModel->analysisStep();
+    result = theAnalysisModel->analysisStep(dT);
 
-	if (result < 0) {
-	    opserr << "StaticAnalysis::analyze() - the AnalysisModel failed";
-	    opserr << " at step: " << i << " with domain at load factor ";
-	    opserr << the_Domain->getCurrentTime() << endln;
-	    the_Domain->revertToLastCommit();
-	    return -2;
-	}
+    if (result < 0) {
+	opserr << "StaticAnalysis::analyze() - the AnalysisModel failed";
+	opserr << " with domain at load factor ";
+	opserr << the_Domain->getCurrentTime() << endln;
+	the_Domain->revertToLastCommit();
+	return -2;
+    }
 
-	// Check for change in Domain since last step. As a change can
-	// occur in a commit() in a domaindecomp with load balancing
-	// this must now be inside the loop
+    // Check for change in Domain since last step. As a change can
+    // occur in a commit() in a domaindecomp with load balancing
+    // this must now be inside the loop
 
-	int stamp = the_Domain->hasDomainChanged();
+    int stamp = the_Domain->hasDomainChanged();
 
-	
-	if (stamp != domainStamp) {
-	    domainStamp = stamp;
+    
+    if (stamp != domainStamp) {
+	bool onlyNodesAdded = the_Domain->hasOnlyAddedNodes(domainStamp);
+	domainStamp = stamp;
 
+	if (onlyNodesAdded)
+	    result = this->nodesAdded();
+	else
 	    result = this->domainChanged();
 
-	    if (result < 0) {
-		opserr << "StaticAnalysis::analyze() - domainChanged failed";
-		opserr << " at step " << i << " of " << numSteps << endln;
-		return -1;
-	    }	
-	}
-
-	result = theIntegrator->newStep();
 	if (result < 0) {
-	    opserr << "StaticAnalysis::analyze() - the Integrator failed";
-	    opserr << " at step: " << i << " with domain at load factor ";
-	    opserr << the_Domain->getCurrentTime() << endln;
-	    the_Domain->revertToLastCommit();
-	    theIntegrator->revertToLastStep();
- 
-	    return -2;
-	}
+	    opserr << "StaticAnalysis::analyze() - domainChanged failed\n";
+	    return -1;
+	}	
+    }
 
-        result = theAlgorithm->solveCurrentStep();
-	if (result < 0) {
-	    // opserr << "StaticAnalysis::analyze() - the Algorithm failed";
-	    // opserr << " at step: " << i << " with domain at load factor ";
-	    // opserr << the_Domain->getCurrentTime() << endln;
-	    the_Domain->revertToLastCommit();	    
-	    theIntegrator->revertToLastStep();
+    if (algorithm != theAlgorithm)
+	algorithm->setLinks(*theAnalysisModel, *theIntegrator, *theSOE, test);
 
-	    return -3;
-	}    
+    result = theIntegrator->newStep();
+    if (result < 0) {
+	opserr << "StaticAnalysis::analyze() - the Integrator failed";
+	opserr << " with domain at load factor ";
+	opserr << the_Domain->getCurrentTime() << endln;
+	the_Domain->revertToLastCommit();
+	theIntegrator->revertToLastStep();
+
+	return -2;
+    }
+
+    result = algorithm->solveCurrentStep();
+    if (result < 0) {
+	the_Domain->revertToLastCommit();	    
+	theIntegrator->revertToLastStep();
+
+	return -3;
+    }    
 
 #ifdef _RELIABILITY
 
-	if (theIntegrator->shouldComputeAtEachStep()) {
-
-	    result = theIntegrator->computeSensitivities();
-	    if (result < 0) {
-		opserr << "StaticAnalysis::analyze() - the SensitivityAlgorithm failed";
-		opserr << " at step: " << i << " with domain at load factor ";
-		opserr << the_Domain->getCurrentTime() << endln;
-		the_Domain->revertToLastCommit();	    
-		theIntegrator->revertToLastStep();
-		return -5;
-	    }    
-	}
-#endif
+    if (theIntegrator->shouldComputeAtEachStep()) {
 
-	result = theIntegrator->commit();
+	result = theIntegrator->computeSensitivities();
 	if (result < 0) {
-	    opserr << "StaticAnalysis::analyze() - ";
-	    opserr << "the Integrator failed to commit";
-	    opserr << " at step: " << i << " with domain at load factor ";
+	    opserr << "StaticAnalysis::analyze() - the SensitivityAlgorithm failed";
+	    opserr << " with domain at load factor ";
 	    opserr << the_Domain->getCurrentTime() << endln;
 	    the_Domain->revertToLastCommit();	    
 	    theIntegrator->revertToLastStep();
-
-	    return -4;
-	}    	
+	    return -5;
+	}    
     }
+#endif
+
+    result = theIntegrator->commit();
+    if (result < 0) {
+	opserr << "StaticAnalysis::analyze() - ";
+	opserr << "the Integrator failed to commit";
+	opserr << " with domain at load factor ";
+	opserr << the_Domain->getCurrentTime() << endln;
+	the_Domain->revertToLastCommit();	    
+	theIntegrator->revertToLastStep();
+
+	return -4;
+    }    	
     
     return 0;
 }
@@ -347,6 +370,47 @@ StaticAnalysis::initialize(void)
     return 0;
 }
 
+// 
+// Nodes added to the domain on their own are numbered after the
+// existing equations by the constraint handler; the model is not
+// handled and numbered again, only the system of equations is resized.
+//
+int
+StaticAnalysis::nodesAdded(void)
+{
+    if (theConstraintHandler->handleAddedNodes() < 0)
+	return this->domainChanged();
+
+    Graph &theGraph = theAnalysisModel->getDOFGraph();
+    if (theSOE->setSize(theGraph) < 0) {
+	opserr << "StaticAnalysis::nodesAdded() - ";
+	opserr << "LinearSOE::setSize() failed";
+	return -3;
+    }	    
+
+    if (theEigenSOE != nullptr && theEigenSOE->setSize(theGraph) < 0) {
+	opserr << "StaticAnalysis::nodesAdded() - ";
+	opserr << "EigenSOE::setSize() failed";
+	return -3;
+    }	    
+
+    theAnalysisModel->clearDOFGraph();
+
+    if (theIntegrator->domainChanged() < 0) {
+	opserr << "StaticAnalysis::nodesAdded() - ";
+	opserr << "Integrator::domainChanged() failed";
+	return -4;
+    }	    
+
+    if (theAlgorithm->domainChanged() < 0) {
+	opserr << "StaticAnalysis::nodesAdded() - ";
+	opserr << "Algorithm::domainChanged() failed";
+	return -5;
+    }	        
+
+    return 0;
+}
+
 int
 StaticAnalysis::domainChanged(void)
 {
@@ -64,6 +64,7 @@ class StaticAnalysis: public Analysis
     void clearAll(void);	    
     
     int analyze(int numSteps);
+    int analyzeStep(EquiSolnAlgo *theAlgorithm, ConvergenceTest *theTest, double dT = 0.0);
     int eigen(int numMode, bool generlzed = true, bool findSmallest = true);
     int initialize(void);
     int domainChanged(void);
@@ -82,6 +83,8 @@ class StaticAnalysis: public Analysis
   protected: 
     
   private:
+    int nodesAdded(void);
+
     ConstraintHandler 	*theConstraintHandler;    
     DOF_Numberer 	*theDOF_Numberer;
     AnalysisModel 	*theAnalysisModel;
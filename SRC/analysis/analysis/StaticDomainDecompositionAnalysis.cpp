@@ -491,7 +491,7 @@ StaticDomainDecompositionAnalysis::formTangVectProduct(Vector &force)
 const Matrix &
 StaticDomainDecompositionAnalysis::getTangent(void)
 {
-  static Matrix errMatrix;
+  static thread_local Matrix errMatrix;
   opserr << "StaticDomainDecompositionAnalysis::getTangent() - should never be called\n";
   return errMatrix;
 }
@@ -499,7 +499,7 @@ StaticDomainDecompositionAnalysis::getTangent(void)
 const Vector &
 StaticDomainDecompositionAnalysis::getResidual(void)
 {
-  static Vector errVector;
+  static thread_local Vector errVector;
   opserr << "StaticDomainDecompositionAnalysis::getResidual() - should never be called\n";
   return errVector;
 }
@@ -507,7 +507,7 @@ StaticDomainDecompositionAnalysis::getResidual(void)
 const Vector &
 StaticDomainDecompositionAnalysis::getTangVectProduct(void)
 {
-  static Vector errVector;
+  static thread_local Vector errVector;
   opserr << "StaticDomainDecompositionAnalysis::getTangVectProduct() - should never be called\n";
   return errVector;
 }
@@ -517,7 +517,7 @@ StaticDomainDecompositionAnalysis::sendSelf(int commitTag, Channel &theChannel)
 {
   // receive the data identifyng the objects in the aggregation
   int dataTag = this->getDbTag();
-  static ID data(8);
+  static thread_local ID data(8);
 
   if (theAlgorithm == 0) {
     opserr << "StaticDomainDecompositionAnalysis::sendSelf() - no objects exist!\n";
@@ -596,7 +596,7 @@ StaticDomainDecompositionAnalysis::recvSelf(int commitTag, Channel &theChannel,
   Domain *the_Domain = this->getSubdomainPtr();
 
   // receive the data identifyng the objects in the aggregation
-  static ID data(8);
+  static thread_local ID data(8);
   int dataTag = this->getDbTag();
   theChannel.recvID(dataTag, commitTag, data);
 
@@ -480,7 +480,7 @@ TransientDomainDecompositionAnalysis::formTangVectProduct(Vector &force)
 const Matrix &
 TransientDomainDecompositionAnalysis::getTangent(void)
 {
-  static Matrix errMatrix;
+  static thread_local Matrix errMatrix;
   opserr << "TransientDomainDecompositionAnalysis::getTangent() - should never be called\n";
   return errMatrix;
 }
@@ -488,7 +488,7 @@ TransientDomainDecompositionAnalysis::getTangent(void)
 const Vector &
 TransientDomainDecompositionAnalysis::getResidual(void)
 {
-  static Vector errVector;
+  static thread_local Vector errVector;
   opserr << "TransientDomainDecompositionAnalysis::getResidual() - should never be called\n";
   return errVector;
 }
@@ -496,7 +496,7 @@ TransientDomainDecompositionAnalysis::getResidual(void)
 const Vector &
 TransientDomainDecompositionAnalysis::getTangVectProduct(void)
 {
-  static Vector errVector;
+  static thread_local Vector errVector;
   opserr << "TransientDomainDecompositionAnalysis::getTangVectProduct() - should never be called\n";
   return errVector;
 }
@@ -507,7 +507,7 @@ TransientDomainDecompositionAnalysis::sendSelf(int commitTag, Channel &theChanne
 
   // receive the data identifyng the objects in the aggregation
   int dataTag = this->getDbTag();
-  static ID data(8);
+  static thread_local ID data(8);
 
   if (theAlgorithm == 0) {
     opserr << "TransientDomainDecompositionAnalysis::sendSelf() - no objects exist!\n";
@@ -588,7 +588,7 @@ TransientDomainDecompositionAnalysis::recvSelf(int commitTag, Channel &theChanne
   Domain *the_Domain = this->getSubdomainPtr();
 
   // receive the data identifyng the objects in the aggregation
-  static ID data(8);
+  static thread_local ID data(8);
   int dataTag = this->getDbTag();
   theChannel.recvID(dataTag, commitTag, data);
 
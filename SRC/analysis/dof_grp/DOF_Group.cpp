@@ -38,11 +38,11 @@
 
 
 // static variables initialisation
-Matrix DOF_Group::errMatrix(1,1);
-Vector DOF_Group::errVect(1);
-Matrix **DOF_Group::theMatrices; // array of pointers to class wide matrices
-Vector **DOF_Group::theVectors;  // array of pointers to class widde vectors
-int DOF_Group::numDOFs(0);           // number of objects
+thread_local Matrix DOF_Group::errMatrix(1,1);
+thread_local Vector DOF_Group::errVect(1);
+thread_local Matrix **DOF_Group::theMatrices; // array of pointers to class wide matrices
+thread_local Vector **DOF_Group::theVectors;  // array of pointers to class widde vectors
+thread_local int DOF_Group::numDOFs(0);           // number of objects
 
 
 //  DOF_Group(Node *);
@@ -138,11 +138,11 @@ class DOF_Group: public TaggedObject
     int numDOF;
 
     // static variables - single copy for all objects of the class	    
-    static Matrix errMatrix;
-    static Vector errVect;
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numDOFs;          // number of objects    
+    static thread_local Matrix errMatrix;
+    static thread_local Vector errVect;
+    static thread_local Matrix **theMatrices; // array of pointers to class wide matrices
+    static thread_local Vector **theVectors;  // array of pointers to class widde vectors
+    static thread_local int numDOFs;          // number of objects    
 };
 
 #endif
@@ -48,10 +48,10 @@
 #define MAX_NUM_DOF 16
 
 // static variables initialisation
-Matrix **TransformationDOF_Group::modMatrices; 
-Vector **TransformationDOF_Group::modVectors;  
-int TransformationDOF_Group::numTransDOFs(0);     // number of objects
-TransformationConstraintHandler *TransformationDOF_Group::theHandler = 0;     // number of objects
+thread_local Matrix **TransformationDOF_Group::modMatrices; 
+thread_local Vector **TransformationDOF_Group::modVectors;  
+thread_local int TransformationDOF_Group::numTransDOFs(0);     // number of objects
+thread_local TransformationConstraintHandler *TransformationDOF_Group::theHandler = 0;     // number of objects
 
 TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node, 
 						 MP_Constraint *mp,
@@ -332,7 +332,7 @@ TransformationDOF_Group::getEigenvectors(void)
     Matrix *T = this->getT();
     if (T != 0) {
 	// *modTangent = (*T) ^ unmodTangent * (*T);
-      static Matrix res;
+      static thread_local Matrix res;
       res = (*T) ^ unmodTangent;
       return res;
       // modTangent->addMatrixTripleProduct(0.0, *T, unmodTangent, 1.0);
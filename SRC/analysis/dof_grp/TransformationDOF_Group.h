@@ -125,10 +125,10 @@ class TransformationDOF_Group: public DOF_Group
     SP_Constraint **theSPs;
     
     // static variables - single copy for all objects of the class	    
-    static Matrix **modMatrices; // array of pointers to class wide matrices
-    static Vector **modVectors;  // array of pointers to class widde vectors
-    static int numTransDOFs;           // number of objects        
-    static TransformationConstraintHandler *theHandler;
+    static thread_local Matrix **modMatrices; // array of pointers to class wide matrices
+    static thread_local Vector **modVectors;  // array of pointers to class widde vectors
+    static thread_local int numTransDOFs;           // number of objects        
+    static thread_local TransformationConstraintHandler *theHandler;
 };
 
 #endif
@@ -42,11 +42,11 @@
 #define MAX_NUM_DOF 64
 
 // static variables initialisation
-Matrix FE_Element::errMatrix(1,1);
-Vector FE_Element::errVector(1);
-Matrix **FE_Element::theMatrices; // pointers to class wide matrices
-Vector **FE_Element::theVectors;  // pointers to class widde vectors
-int FE_Element::numFEs(0);           // number of objects
+thread_local Matrix FE_Element::errMatrix(1,1);
+thread_local Vector FE_Element::errVector(1);
+thread_local Matrix **FE_Element::theMatrices; // pointers to class wide matrices
+thread_local Vector **FE_Element::theVectors;  // pointers to class widde vectors
+thread_local int FE_Element::numFEs(0);           // number of objects
 
 //  FE_Element(Element *, Integrator *theIntegrator);
 //        construictor that take the corresponding model element.
@@ -191,6 +191,11 @@ FE_Element::~FE_Element()
         delete [] theMatrices;
         delete [] theVectors;
     }
+
+    if (lastKt != nullptr)
+      delete lastKt;
+    if (lastR != nullptr)
+      delete lastR;
 }
 
 
@@ -262,7 +267,10 @@ FE_Element::getTangent(Integrator *theNewIntegrator)
   assert(myEle != nullptr);
 
   if (myEle->isSubdomain() == false) {
-    if (theNewIntegrator != nullptr)
+    // an inactive element keeps its place in the system with a zero tangent
+    if (myEle->isActive() == false)
+      theTangent->Zero();
+    else if (theNewIntegrator != nullptr)
       theNewIntegrator->formEleTangent(this);
     return *theTangent;
 
@@ -284,7 +292,10 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
     assert(myEle != nullptr);
 
     if (myEle->isSubdomain() == false) {
-      theNewIntegrator->formEleResidual(this);
+      if (myEle->isActive() == false)
+        theResidual->Zero();
+      else
+        theNewIntegrator->formEleResidual(this);
       return *theResidual;
 
     } else {
@@ -296,6 +307,27 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
 
 
 
+//
+// Returns the signature of the element state when the Domain performs
+// incremental updates and the element was last updated in the current
+// state, and 0 otherwise. Responses computed under the same non-zero
+// signature can be reused.
+//
+unsigned long
+FE_Element::getStateSignature(void)
+{
+    Domain *theDomain = myEle->getDomain();
+    if (theDomain == nullptr || theDomain->getIncrementalUpdate() == false)
+        return 0;
+
+    unsigned long signature = myEle->getStateSignature(theDomain->getStateEpoch());
+    if (signature != myEle->getUpdateSignature())
+        return 0;
+
+    return signature;
+}
+
+
 void
 FE_Element::zeroTangent(void)
 {
@@ -313,8 +345,23 @@ FE_Element::addKtToTang(double fact)
     // check for a quick return
     if (fact == 0.0)
         return;
-    else
-        theTangent->addMatrix(1.0, myEle->getTangentStiff(),fact);
+
+    unsigned long signature = this->getStateSignature();
+    if (signature != 0 && signature == lastKtSignature) {
+        theTangent->addMatrix(1.0, *lastKt, fact);
+        return;
+    }
+
+    const Matrix &Kt = myEle->getTangentStiff();
+    theTangent->addMatrix(1.0, Kt, fact);
+
+    if (signature != 0) {
+        if (lastKt == nullptr)
+            lastKt = new Matrix(Kt);
+        else
+            *lastKt = Kt;
+        lastKtSignature = signature;
+    }
 }
 
 void
@@ -426,9 +473,21 @@ FE_Element::addRtoResidual(double fact)
   if (fact == 0.0)
     return;
 
-  else {
-    const Vector &eleResisting = myEle->getResistingForce();
-    theResidual->addVector(1.0, eleResisting, -fact);
+  unsigned long signature = this->getStateSignature();
+  if (signature != 0 && signature == lastRSignature) {
+    theResidual->addVector(1.0, *lastR, -fact);
+    return;
+  }
+
+  const Vector &eleResisting = myEle->getResistingForce();
+  theResidual->addVector(1.0, eleResisting, -fact);
+
+  if (signature != 0) {
+    if (lastR == nullptr)
+      lastR = new Vector(eleResisting);
+    else
+      *lastR = eleResisting;
+    lastRSignature = signature;
   }
 }
 
@@ -459,7 +518,7 @@ FE_Element::getTangForce(const Vector &disp, double fact)
     theResidual->Zero();
 
     // check for a quick return
-    if (fact == 0.0)
+    if (fact == 0.0 || myEle->isActive() == false)
       return *theResidual;
 
     // get the components we need out of the vector
@@ -503,7 +562,7 @@ FE_Element::getK_Force(const Vector &disp, double fact)
     theResidual->Zero();
 
     // check for a quick return
-    if (fact == 0.0)
+    if (fact == 0.0 || myEle->isActive() == false)
         return *theResidual;
 
     // get the components we need out of the vector
@@ -535,7 +594,7 @@ FE_Element::getKi_Force(const Vector &disp, double fact)
     theResidual->Zero();
 
     // check for a quick return
-    if (fact == 0.0)
+    if (fact == 0.0 || myEle->isActive() == false)
       return *theResidual;
 
     // get the components we need out of the vector
@@ -567,7 +626,7 @@ FE_Element::getM_Force(const Vector &disp, double fact)
     theResidual->Zero();
 
     // check for a quick return
-    if (fact == 0.0)
+    if (fact == 0.0 || myEle->isActive() == false)
         return *theResidual;
 
     // get the components we need out of the vector
@@ -599,7 +658,7 @@ FE_Element::getC_Force(const Vector &disp, double fact)
     theResidual->Zero();
 
     // check for a quick return
-    if (fact == 0.0)
+    if (fact == 0.0 || myEle->isActive() == false)
         return *theResidual;
 
     // get the components we need out of the vector
@@ -917,35 +976,18 @@ FE_Element::commitSensitivity(int gradNum, int numGrads)
 // AddingSensitivity:END ////////////////////////////////////
 
 
+bool
+FE_Element::isActive(void) const
+{
+  return myEle == nullptr || myEle->isActive();
+}
+
 int
 FE_Element::updateElement(void)
 {
-  if (myEle != nullptr) {
+  if (myEle != nullptr && myEle->isActive()) {
     return myEle->update();
   }
   return 0;
 }
 
-#if 0
-void FE_Element::activate()
-{
-        myEle->activate();
-}
-
-
-void FE_Element::deactivate()
-{
-        myEle->deactivate();
-}
-
-
-bool FE_Element::isActive()
-{
-    if (myEle->isActive()) {
-            return true;
-    }
-    else {
-            return false;
-    }
-}
-#endif
@@ -95,11 +95,7 @@ class FE_Element: public TaggedObject
     virtual int  commitSensitivity           (int gradNum, int numGrads);
     // AddingSensitivity:END //////////////////////////////////////
    
-#if 0
-    void activate();
-    void deactivate();
-    bool isActive();
-#endif
+    bool isActive(void) const;
   protected:
     void  addLocalM_Force(const Vector &accel, double fact = 1.0);
     void  addLocalD_Force(const Vector &vel, double fact = 1.0);
@@ -111,6 +107,8 @@ class FE_Element: public TaggedObject
     ID myID;
 
   private:
+    unsigned long getStateSignature(void);
+
     // private variables - a copy for each object of the class    
     int numDOF;
     AnalysisModel *theModel;
@@ -118,13 +116,20 @@ class FE_Element: public TaggedObject
     Vector *theResidual;
     Matrix *theTangent;
     Integrator *theIntegrator; // need for Subdomain
+
+    // element tangent and resisting force kept for reuse while the
+    // element state is unchanged, with incremental update in the Domain
+    Matrix *lastKt = nullptr;
+    Vector *lastR = nullptr;
+    unsigned long lastKtSignature = 0;
+    unsigned long lastRSignature = 0;
     
     // static variables - single copy for all objects of the class	
-    static Matrix errMatrix;
-    static Vector errVector;
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numFEs;           // number of objects
+    static thread_local Matrix errMatrix;
+    static thread_local Vector errVector;
+    static thread_local Matrix **theMatrices; // array of pointers to class wide matrices
+    static thread_local Vector **theVectors;  // array of pointers to class widde vectors
+    static thread_local int numFEs;           // number of objects
 
 };
 
@@ -50,8 +50,8 @@
 #include <SP_Constraint.h>
 #include <DOF_Group.h>
 
-Matrix PenaltySP_FE::tang(1,1);
-Vector PenaltySP_FE::resid(1);
+thread_local Matrix PenaltySP_FE::tang(1,1);
+thread_local Vector PenaltySP_FE::resid(1);
 
 PenaltySP_FE::PenaltySP_FE(int tag, Domain &theDomain, 
 			   SP_Constraint &TheSP, double Alpha)
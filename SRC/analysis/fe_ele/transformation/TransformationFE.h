@@ -92,16 +92,16 @@ class TransformationFE: public FE_Element
     int numOriginalDOF;
     
     // static variables - single copy for all objects of the class	
-    static Matrix **modMatrices; // array of pointers to class wide matrices
-    static Vector **modVectors;  // array of pointers to class widde vectors
-    static Matrix **theTransformations; // for holding pointers to the T matrices
-    static int numTransFE;     // number of objects    
-    static int transCounter;   // a counter used to indicate when to do something
-    static int sizeTransformations; // size of theTransformations array
-    static double *dataBuffer;
-    static double *localKbuffer;
-    static int    *dofData;
-    static int sizeBuffer;
+    static thread_local Matrix **modMatrices; // array of pointers to class wide matrices
+    static thread_local Vector **modVectors;  // array of pointers to class widde vectors
+    static thread_local Matrix **theTransformations; // for holding pointers to the T matrices
+    static thread_local int numTransFE;     // number of objects    
+    static thread_local int transCounter;   // a counter used to indicate when to do something
+    static thread_local int sizeTransformations; // size of theTransformations array
+    static thread_local double *dataBuffer;
+    static thread_local double *localKbuffer;
+    static thread_local int    *dofData;
+    static thread_local int sizeBuffer;
 };
 
 #endif
@@ -36,6 +36,10 @@
 #include <Integrator.h>
 #include <FE_EleIter.h>
 #include <FE_Element.h>
+#include <DOF_Group.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <ID.h>
 
 ConstraintHandler::ConstraintHandler(int clasTag)
 :MovableObject(clasTag),
@@ -60,6 +64,47 @@ ConstraintHandler::doneNumberingDOF(void)
   return 0;
 }
 
+// 
+// The nodes that have been added to the domain since handle() was
+// invoked, without any constraints or elements, are given DOF_Groups
+// numbered after the existing equations; the DOF_Groups and equation
+// numbers already assigned are left as they are.
+//
+int
+ConstraintHandler::handleAddedNodes(void)
+{
+  int numDOF_Grp = theAnalysisModelPtr->getNumDOF_Groups();
+  int numEqn = theAnalysisModelPtr->getNumEqn();
+  int numAdded = 0;
+
+  NodeIter &theNodes = theDomainPtr->getNodes();
+  Node *nodPtr;
+  while ((nodPtr = theNodes()) != 0) {
+    if (nodPtr->getDOF_GroupPtr() != 0)
+      continue;
+
+    DOF_Group *dofPtr = new DOF_Group(numDOF_Grp++, nodPtr);
+    const ID &id = dofPtr->getID();
+    for (int j = 0; j < id.Size(); j++)
+      dofPtr->setID(j, numEqn++);
+
+    nodPtr->setDOF_GroupPtr(dofPtr);
+    if (theAnalysisModelPtr->addDOF_Group(dofPtr) == false) {
+      opserr << "WARNING ConstraintHandler::handleAddedNodes() - failed to add ";
+      opserr << "the DOF_Group for node " << nodPtr->getTag() << endln;
+      delete dofPtr;
+      return -1;
+    }
+    numAdded++;
+  }
+
+  theAnalysisModelPtr->setNumEqn(numEqn);
+  theAnalysisModelPtr->clearDOFGraph();
+  theAnalysisModelPtr->clearDOFGroupGraph();
+
+  return numAdded;
+}
+
 void 
 ConstraintHandler::setLinks(Domain &theDomain, 
 			    AnalysisModel &theModel,
@@ -64,6 +64,10 @@ class ConstraintHandler : public MovableObject
     virtual int doneNumberingDOF(void);
     virtual void clearAll(void) =0;    
 
+    // numbers the nodes added to the domain since handle() after
+    // the existing equations
+    int handleAddedNodes(void);
+
   protected:
     Domain *getDomainPtr(void) const;
     AnalysisModel *getAnalysisModelPtr(void) const;
@@ -534,9 +534,9 @@ ArcLength::formTangDispSensitivity(int gradNumber)
    ////////////////////////////////////////////////////////
    // Loop through the loadPatterns and add the dPext/dh contributions
 
-   static Vector oneDimVectorWithOne(1);
+   static thread_local Vector oneDimVectorWithOne(1);
    oneDimVectorWithOne(0) = 1.0;
-   static ID oneDimID(1);
+   static thread_local ID oneDimID(1);
    Node *aNode;
    DOF_Group *aDofGroup;
 
@@ -788,9 +788,9 @@ ArcLength::formSensitivityRHS(int passedGradNumber)
 
 
    // Loop through the loadPatterns and add the dPext/dh contributions
-   static Vector oneDimVectorWithOne(1);
+   static thread_local Vector oneDimVectorWithOne(1);
    oneDimVectorWithOne(0) = 1.0;
-   static ID oneDimID(1);
+   static thread_local ID oneDimID(1);
 
    Node *aNode;
    DOF_Group *aDofGroup;
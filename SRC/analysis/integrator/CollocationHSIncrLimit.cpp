@@ -460,7 +460,7 @@ CollocationHSIncrLimit::getVel()
 
 int CollocationHSIncrLimit::sendSelf(int cTag, Channel &theChannel)
 {
-    static Vector data(5);
+    static thread_local Vector data(5);
     data(0) = theta;
     data(1) = beta;
     data(2) = gamma;
@@ -429,7 +429,7 @@ int CollocationHSIncrReduct::commit(void)
 
 int CollocationHSIncrReduct::sendSelf(int cTag, Channel &theChannel)
 {
-    static Vector data(4);
+    static thread_local Vector data(4);
     data(0) = theta;
     data(1) = beta;
     data(2) = gamma;
@@ -481,6 +481,35 @@ DisplacementControl::domainChanged(void)
    return 0;
 }
 
+double
+DisplacementControl::getIncrement(void)
+{
+  return theIncrement;
+}
+
+int
+DisplacementControl::setIncrement(double newValue)
+{
+  if (theIncrement == 0.0)
+    return -1;
+
+  // scale the bounds with the increment so that newStep() does not
+  // clip the new value back to the old range
+  double ratio = newValue/theIncrement;
+  minIncrement *= ratio;
+  maxIncrement *= ratio;
+  if (minIncrement > maxIncrement) {
+    double tmp = minIncrement;
+    minIncrement = maxIncrement;
+    maxIncrement = tmp;
+  }
+
+  // the #iter of the last step is taken as Jd so the value is used as is
+  theIncrement = newValue;
+  numIncrLastStep = specNumIncrStep;
+  return 0;
+}
+
 int
 DisplacementControl::sendSelf(int cTag,
       Channel &theChannel)
@@ -542,9 +571,9 @@ DisplacementControl::formTangDispSensitivity(Vector *dUhatdh,int gradNumber)
    // if the parameter is a load parameter.
    // Loop through the loadPatterns and add the dPext/dh contributions
 
-   static Vector oneDimVectorWithOne(1);
+   static thread_local Vector oneDimVectorWithOne(1);
    oneDimVectorWithOne(0) = 1.0;
-   static ID oneDimID(1);
+   static thread_local ID oneDimID(1);
    Node *aNode;
    DOF_Group *aDofGroup;
 
@@ -759,9 +788,9 @@ DisplacementControl::formSensitivityRHS(int passedGradNumber)
 
 
   // Loop through the loadPatterns and add the dPext/dh contributions
-  static Vector oneDimVectorWithOne(1);
+  static thread_local Vector oneDimVectorWithOne(1);
   oneDimVectorWithOne(0) = 1.0;
-  static ID oneDimID(1);
+  static thread_local ID oneDimID(1);
   
   Node *aNode;
   DOF_Group *aDofGroup;
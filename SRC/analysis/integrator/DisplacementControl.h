@@ -63,6 +63,8 @@ class DisplacementControl : public StaticIntegrator
       int newStep(void);    
       int update(const Vector &deltaU);
       int domainChanged(void);
+      double getIncrement(void);
+      int setIncrement(double increment);
 
       int sendSelf(int commitTag, Channel &theChannel);
       int recvSelf(int commitTag, Channel &theChannel, 
@@ -280,7 +280,7 @@ DistributedDisplacementControl::domainChanged(void)
       }
     }
 
-    static ID data(1);    
+    static thread_local ID data(1);    
 
     if (processID != 0) {
       Channel *theChannel = theChannels[0];
@@ -447,7 +447,7 @@ DistributedDisplacementControl::sendSelf(int cTag, Channel &theChannel)
     sendID = processID;
 
   // send remotes processID & info about node, dof and numIncr
-  static ID idData(3);
+  static thread_local ID idData(3);
   idData(0) = sendID;
   idData(1) = theNode;
   idData(2) = theDof;
@@ -457,7 +457,7 @@ DistributedDisplacementControl::sendSelf(int cTag, Channel &theChannel)
     return -1;
   }
 
-  static Vector dData(5);
+  static thread_local Vector dData(5);
   dData(0) = theIncrement;
   dData(1) = minIncrement;
   dData(2) = maxIncrement;
@@ -477,7 +477,7 @@ int
 DistributedDisplacementControl::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 			      
 {
-  static ID idData(3);
+  static thread_local ID idData(3);
   int res = theChannel.recvID(0, cTag, idData);
   if (res < 0) {
     opserr <<"WARNING DistributedDisplacementControl::recvSelf() - failed to recv id data\n";
@@ -487,7 +487,7 @@ DistributedDisplacementControl::recvSelf(int cTag, Channel &theChannel, FEM_Obje
   theNode = idData(1);
   theDof  = idData(2);
 
-  static Vector dData(5);
+  static thread_local Vector dData(5);
   res = theChannel.recvVector(0, cTag, dData);
   if (res < 0) {
     opserr <<"WARNING DistributedDisplacementControl::recvSelf() - failed to recv vector data\n";
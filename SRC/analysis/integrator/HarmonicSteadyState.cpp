@@ -286,9 +286,9 @@ HarmonicSteadyState::formSensitivityRHS(int passedGradNumber)
     }
 
     // Loop through the loadPatterns and add the dPext/dh contributions
-    static Vector oneDimVectorWithOne(1);
+    static thread_local Vector oneDimVectorWithOne(1);
     oneDimVectorWithOne(0) = 1.0;
-    static ID oneDimID(1);
+    static thread_local ID oneDimID(1);
 
     Node *aNode;
     DOF_Group *aDofGroup;
@@ -376,97 +376,7 @@ return false;
 int
 HarmonicSteadyState::computeSensitivities(void)
 {
-//  opserr<<" computeSensitivity::start"<<endln;
-    LinearSOE *theSOE = this->getLinearSOE();
-
-    /*
-  if (theAlgorithm == 0) {
-    opserr << "ERROR the FE algorithm must be defined before ";
-    opserr << "the sensitivity algorithm\n";
-    return -1;
-  }
-*/
-/*
-   // Get pointer to the system of equations (SOE)
-	LinearSOE *theSOE = theAlgorithm->getLinearSOEptr();
-	if (theSOE == 0) {
-	  opserr << "ERROR the FE linearSOE must be defined before ";
-	  opserr << "the sensitivity algorithm\n";
-	  return -1;
-	}
-
-	// Get pointer to incremental integrator
-	IncrementalIntegrator *theIncInt = theAlgorithm->getIncrementalIntegratorPtr();
-//	IncrementalIntegrator *theIncIntSens=theAlgorithm->getIncrementalIntegratorPtr();//Abbas
-	if (theIncInt == 0 ) {
-	  opserr << "ERROR the FE integrator must be defined before ";
-	  opserr << "the sensitivity algorithm\n";
-	  return -1;
-	}
-
-	// Form current tangent at converged state
-	// (would be nice with an if-statement here in case
-	// the current tangent is already formed)
-	if (this->formTangent(CURRENT_TANGENT) < 0){
-		opserr << "WARNING SensitivityAlgorithm::computeGradients() -";
-		opserr << "the Integrator failed in formTangent()\n";
-		return -1;
-	}
-	*/
-	// Zero out the old right-hand side of the SOE
-	theSOE->zeroB();
-
-
-	// if (this == 0) {
-	//   opserr << "ERROR SensitivityAlgorithm::computeSensitivities() -";
-	//   opserr << "the SensitivityIntegrator is NULL\n";
-	//   return -1;
-	// }
-
-	// Form the part of the RHS which are indepent of parameter
-	this->formIndependentSensitivityRHS();
-	AnalysisModel *theModel = this->getAnalysisModel();
-	Domain *theDomain=theModel->getDomainPtr();
-	ParameterIter &paramIter = theDomain->getParameters();
-
-	Parameter *theParam;
-	// De-activate all parameters
-	while ((theParam = paramIter()) != 0)
-	  theParam->activate(false);
-
-	// Now, compute sensitivity wrt each parameter
-	int numGrads = theDomain->getNumParameters();
-	paramIter = theDomain->getParameters();
-
-	while ((theParam = paramIter()) != 0) {
-
-	  // Activate this parameter
-	  theParam->activate(true);
-
-	  // Zero the RHS vector
-	  theSOE->zeroB();
-
-	  // Get the grad index for this parameter
-	  int gradIndex = theParam->getGradIndex();
-
-	  // Form the RHS
-	  this->formSensitivityRHS(gradIndex);
-
-	  // Solve for displacement sensitivity
-
-	  theSOE->solve();
-	  // Save sensitivity to nodes
-	  this->saveSensitivity( theSOE->getX(), gradIndex, numGrads );
-
-
-
-	  // Commit unconditional history variables (also for elastic problems; strain sens may be needed anyway)
-	  this->commitSensitivity(gradIndex, numGrads);
-
-	  // De-activate this parameter for next sensitivity calc
-	  theParam->activate(false);
-	//  opserr<<"HarmonicSteadyState::..........ComputeSensitivities. end"<<endln;
-	}
-
-	return 0;
+    // all parameters share the factored tangent, so their right-hand
+    // sides are solved together
+    return this->computeSensitivitiesBlocked();
 }
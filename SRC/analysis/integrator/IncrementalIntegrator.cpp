@@ -33,6 +33,11 @@
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
 #include <EigenSOE.h>
+#include <Matrix.h>
+#include <Domain.h>
+#include <Parameter.h>
+#include <ParameterIter.h>
+#include <vector>
 #include <cmath>
 
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
@@ -89,6 +94,7 @@ IncrementalIntegrator::formTangent(int statFlag)
 
     // zero the A matrix of the linearSOE
     theSOE->zeroA();
+    theSOE->setLowRankUpdate(nullptr, nullptr);
 
     // the loops to form and add the tangents are broken into two for 
     // efficiency when performing parallel computations - CHANGE
@@ -103,9 +109,96 @@ IncrementalIntegrator::formTangent(int statFlag)
 	    result = -3;
 	}
 
+    if (this->formInactiveTangent() < 0)
+	result = -3;
+
     return result;
 }
 
+
+//
+// While elements are switched off, or nodes have been added to the
+// analysis without elements, the equations that are not connected to
+// an active element are held: a unit stiffness on the diagonal keeps
+// the system nonsingular and their unbalance is zeroed, so that their
+// increments are zero.
+//
+static int
+getHeldEquations(AnalysisModel &theModel, int numEqn, std::vector<int> &theEqns)
+{
+    theEqns.clear();
+    Domain *theDomain = theModel.getDomainPtr();
+    if (theDomain == nullptr || (theDomain->getNumInactiveElements() == 0 &&
+				 theDomain->getNodesAddedStamp() < 0))
+	return 0;
+
+    std::vector<char> connected(numEqn, 0);
+
+    FE_Element *elePtr;
+    FE_EleIter &theEles = theModel.getFEs();
+    while ((elePtr = theEles()) != nullptr) {
+	if (elePtr->isActive() == false)
+	    continue;
+	const ID &id = elePtr->getID();
+	for (int i = 0; i < id.Size(); i++)
+	    if (id(i) >= 0 && id(i) < numEqn)
+		connected[id(i)] = 1;
+    }
+
+    for (int i = 0; i < numEqn; i++)
+	if (connected[i] == 0)
+	    theEqns.push_back(i);
+
+    return theEqns.size();
+}
+
+int
+IncrementalIntegrator::formInactiveTangent(void)
+{
+    std::vector<int> theEqns;
+    if (getHeldEquations(*theAnalysisModel, theSOE->getNumEqn(), theEqns) == 0)
+	return 0;
+
+    Matrix one(1, 1);
+    one(0, 0) = 1.0;
+    ID dof(1);
+    for (size_t i = 0; i < theEqns.size(); i++) {
+	dof(0) = theEqns[i];
+	if (theSOE->addA(one, dof) < 0) {
+	    opserr << "WARNING IncrementalIntegrator::formInactiveTangent -";
+	    opserr << " failed in addA for equation " << theEqns[i] << endln;
+	    return -1;
+	}
+    }
+
+    return 0;
+}
+
+int
+IncrementalIntegrator::formInactiveUnbalance(void)
+{
+    std::vector<int> theEqns;
+    int numHeld = getHeldEquations(*theAnalysisModel, theSOE->getNumEqn(), theEqns);
+    if (numHeld == 0)
+	return 0;
+
+    const Vector &B = theSOE->getB();
+    Vector unbalance(numHeld);
+    ID dofs(numHeld);
+    for (int i = 0; i < numHeld; i++) {
+	dofs(i) = theEqns[i];
+	unbalance(i) = B(theEqns[i]);
+    }
+
+    if (theSOE->addB(unbalance, dofs, -1.0) < 0) {
+	opserr << "WARNING IncrementalIntegrator::formInactiveUnbalance -";
+	opserr << " failed in addB\n";
+	return -1;
+    }
+
+    return 0;
+}
+
 int 
 IncrementalIntegrator::formTangent(int statFlag, double iFact, double cFact)
 {
@@ -120,6 +213,110 @@ IncrementalIntegrator::formIndependentSensitivityLHS(int statFlag)
     return this->formTangent(statFlag);
 }
 
+int
+IncrementalIntegrator::computeSensitivitiesBlocked(void)
+{
+    // number of right-hand sides held in memory at once
+    static const int maxBlockSize = 32;
+
+    if (theAnalysisModel == 0 || theSOE == 0) {
+	opserr << "WARNING IncrementalIntegrator::computeSensitivities -";
+	opserr << " no AnalysisModel or LinearSOE has been set\n";
+	return -1;
+    }
+
+    // Zero out the old right-hand side of the SOE
+    theSOE->zeroB();
+
+    // Form the part of the RHS which are indepent of parameter
+    this->formIndependentSensitivityRHS();
+
+    Domain *theDomain = theAnalysisModel->getDomainPtr();
+    int numGrads = theDomain->getNumParameters();
+
+    // De-activate all parameters
+    std::vector<Parameter *> theParams;
+    theParams.reserve(numGrads);
+    ParameterIter &paramIter = theDomain->getParameters();
+    Parameter *theParam;
+    while ((theParam = paramIter()) != nullptr) {
+      theParam->activate(false);
+      theParams.push_back(theParam);
+    }
+
+    int numEqn = theSOE->getNumEqn();
+    int numParams = theParams.size();
+    if (numEqn == 0)
+      return 0;
+
+    // Without a native multiple right-hand side solve the blocks would
+    // only add storage; solve for one parameter at a time
+    if (theSOE->hasSolveMultiple() == false) {
+      for (int j = 0; j < numParams; j++) {
+	theParam = theParams[j];
+	theParam->activate(true);
+	theSOE->zeroB();
+	int gradIndex = theParam->getGradIndex();
+	this->formSensitivityRHS(gradIndex);
+
+	if (theSOE->solve() < 0) {
+	  opserr << "WARNING IncrementalIntegrator::computeSensitivities -";
+	  opserr << " the LinearSOE failed in solve()\n";
+	  return -1;
+	}
+
+	this->saveSensitivity(theSOE->getX(), gradIndex, numGrads);
+	this->commitSensitivity(gradIndex, numGrads);
+
+	theParam->activate(false);
+      }
+      return 0;
+    }
+
+    for (int first = 0; first < numParams; first += maxBlockSize) {
+      int blockSize = numParams - first < maxBlockSize ? numParams - first : maxBlockSize;
+      Matrix B(numEqn, blockSize);
+      Matrix X(numEqn, blockSize);
+
+      // Form the RHS of each parameter in the block; the element
+      // contributions depend on which parameter is active
+      for (int j = 0; j < blockSize; j++) {
+	theParam = theParams[first + j];
+	theParam->activate(true);
+	theSOE->zeroB();
+	this->formSensitivityRHS(theParam->getGradIndex());
+	const Vector &b = theSOE->getB();
+	for (int i = 0; i < numEqn; i++)
+	  B(i,j) = b(i);
+	theParam->activate(false);
+      }
+
+      // Solve for displacement sensitivities with the factored tangent
+      if (theSOE->solveMultiple(B, X) < 0) {
+	opserr << "WARNING IncrementalIntegrator::computeSensitivities -";
+	opserr << " the LinearSOE failed in solveMultiple()\n";
+	return -1;
+      }
+
+      for (int j = 0; j < blockSize; j++) {
+	theParam = theParams[first + j];
+	theParam->activate(true);
+	int gradIndex = theParam->getGradIndex();
+
+	// Save sensitivity to nodes
+	Vector x(&X(0,j), numEqn);
+	this->saveSensitivity(x, gradIndex, numGrads);
+
+	// Commit unconditional history variables (also for elastic problems; strain sens may be needed anyway)
+	this->commitSensitivity(gradIndex, numGrads);
+
+	theParam->activate(false);
+      }
+    }
+
+    return 0;
+}
+
 int 
 IncrementalIntegrator::formUnbalance(void)
 {
@@ -143,6 +340,9 @@ IncrementalIntegrator::formUnbalance(void)
 	return -2;
     }    
 
+    if (this->formInactiveUnbalance() < 0)
+	return -3;
+
     return 0;
 }
     
@@ -518,35 +718,23 @@ IncrementalIntegrator::addModalDampingForce(const Vector *modalDampingValues)
 
   const Vector &vel = this->getVel();
 
-  dampingForces->Zero();
+  // f = -Phi diag(2 zeta w) Phi' v, with Phi holding the mass-weighted
+  // mode shapes column by column
+  Matrix Phi(eigenVectors, numDOF, numModes);
+  Vector y(numModes);
+  y.addMatrixTransposeVector(0.0, Phi, vel, 1.0);
 
   for (int i=0; i<numModes; i++) {
-
     double eigenvalue = (*eigenValues)(i);
     double modalDampingValue = (*modalDampingValues)(i);
-    if (eigenvalue > 0 && modalDampingValue != 0.0) {
-      double wn = sqrt(eigenvalue);
-
-      double *eigenVectorI = &eigenVectors[numDOF*i];
-      double beta = 0.0;
-      
-      for (int j=0; j<numDOF; j++) {
-	double eij = eigenVectorI[j];
-	if (eij != 0) {
-	  beta += eij * vel(j);
-	}
-      }
-
-      beta = -2.0 * modalDampingValue * wn * beta;
-
-      for (int j=0; j<numDOF; j++) {
-	double eij = eigenVectorI[j];
-	if (eij != 0)
-	  (*dampingForces)(j) += beta * eij;
-      }
-    }
+    if (eigenvalue > 0 && modalDampingValue != 0.0)
+      y(i) *= -2.0 * modalDampingValue * sqrt(eigenvalue);
+    else
+      y(i) = 0.0;
   }
 
+  dampingForces->addMatrixVector(0.0, Phi, y, 1.0);
+
   theSOE->setB(*dampingForces);
   
   return res;
@@ -579,37 +767,33 @@ IncrementalIntegrator::addModalDampingMatrix(const Vector *modalDampingValues) {
     this->setupModal(modalDampingValues);
   }
 
-  for (int dof = 0; dof<numDOF; dof++) {
-    dampingForces->Zero();
-    bool zeroCol = true;
+  // C = Phi diag(2 zeta w cFactor) Phi' is dense but of rank numModes,
+  // so it is handed to the SOE as a low rank term; systems that cannot
+  // solve with it assemble it instead
+  int numActive = 0;
+  for (int i=0; i<numModes; i++)
+    if ((*eigenValues)(i) > 0 && (*modalDampingValues)(i) != 0.0)
+      numActive++;
 
-    for (int i=0; i<numModes; i++) {
+  if (numActive == 0)
+    return 0;
 
-      double eigenvalue = (*eigenValues)(i);
-      double modalDampingValue = (*modalDampingValues)(i);      
-      if (eigenvalue > 0 && modalDampingValue != 0.0) {
-	double wn = sqrt(eigenvalue);
-	double *eigenVectorI = &eigenVectors[numDOF*i];
-	double ei_dof = eigenVectors[numDOF*i+dof];
-	
-	if (ei_dof != 0.0) {
-	  zeroCol = false;
-	
-	  double beta = 2.0 * modalDampingValue * wn * ei_dof * cFactor;
-	  
-	  for (int j=0; j<numDOF; j++) {
-	    double eij = eigenVectorI[j];
-	    if (eij != 0)
-	      (*dampingForces)(j) += beta * eij;
-	  }
-	}
-      }
+  Matrix U(numDOF, numActive);
+  Vector d(numActive);
+  for (int i=0, k=0; i<numModes; i++) {
+    double eigenvalue = (*eigenValues)(i);
+    double modalDampingValue = (*modalDampingValues)(i);
+    if (eigenvalue > 0 && modalDampingValue != 0.0) {
+      double *eigenVectorI = &eigenVectors[numDOF*i];
+      for (int j=0; j<numDOF; j++)
+	U(j,k) = eigenVectorI[j];
+      d(k) = 2.0 * modalDampingValue * sqrt(eigenvalue) * cFactor;
+      k++;
     }
-    
-    if (zeroCol == false)
-      theSOE->addColA(*dampingForces, dof, 1.0);
-
   }
+
+  res = theSOE->setLowRankUpdate(&U, &d);
+
   return res;
 }
 
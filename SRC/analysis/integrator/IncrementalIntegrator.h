@@ -102,12 +102,19 @@ class IncrementalIntegrator : public Integrator
     virtual int getLastResponse(Vector &result, const ID &id);
     
   protected:
+    // direct differentiation for all parameters of the domain; when the
+    // solver supports it, the right-hand sides are solved in blocks
+    // against the factored tangent
+    int computeSensitivitiesBlocked(void);
+
     LinearSOE       *getLinearSOE(void) const;
     AnalysisModel   *getAnalysisModel(void) const;
     ConvergenceTest *getConvergenceTest(void) const;
 
     virtual int  formNodalUnbalance(void);        
     virtual int  formElementResidual(void);            
+    int  formInactiveTangent(void);
+    int  formInactiveUnbalance(void);
     int statusFlag;
     double iFactor;
     double cFactor;
@@ -192,12 +192,14 @@ int KRAlphaExplicit::newStep(double _deltaT)
         c2 = gamma*deltaT;
         c3 = 1.0;
         this->TransientIntegrator::formTangent(INITIAL_TANGENT);
+        theFullLinSOE->assembleLowRankUpdate();
         Matrix A(*tmp);
         
         c1 *= (1.0 - alphaF);
         c2 *= (1.0 - alphaF);
         c3 = (1.0 - alphaM);
         this->TransientIntegrator::formTangent(INITIAL_TANGENT);
+        theFullLinSOE->assembleLowRankUpdate();
         Matrix B3(*tmp);
         
         // solve [M + gamma*deltaT*C + beta*deltaT^2*K]*[alpha3] = 
@@ -208,6 +210,7 @@ int KRAlphaExplicit::newStep(double _deltaT)
         c2 = 0.0;
         c3 = 1.0;
         this->TransientIntegrator::formTangent(INITIAL_TANGENT);
+        theFullLinSOE->assembleLowRankUpdate();
         Matrix B1(*tmp);
         
         // solve [M + gamma*deltaT*C + beta*deltaT^2*K]*[alpha1] = [M] for alpha1
@@ -292,6 +295,7 @@ int KRAlphaExplicit::formTangent(int statFlag)
     }
     
     theLinSOE->zeroA();
+    theLinSOE->setLowRankUpdate(nullptr, nullptr);
     
     int size = theLinSOE->getNumEqn();
     ID id(size);
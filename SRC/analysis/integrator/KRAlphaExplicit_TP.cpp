@@ -180,12 +180,14 @@ int KRAlphaExplicit_TP::newStep(double _deltaT)
         c2 = gamma*deltaT;
         c3 = 1.0;
         this->TransientIntegrator::formTangent(INITIAL_TANGENT);
+        theFullLinSOE->assembleLowRankUpdate();
         Matrix A(*tmp);
         
         c1 *= (1.0 - alphaF);
         c2 *= (1.0 - alphaF);
         c3 = (1.0 - alphaI);
         this->TransientIntegrator::formTangent(INITIAL_TANGENT);
+        theFullLinSOE->assembleLowRankUpdate();
         Matrix B3(*tmp);
         
         // solve [M + gamma*deltaT*C + beta*deltaT^2*K]*[alpha3] = 
@@ -196,6 +198,7 @@ int KRAlphaExplicit_TP::newStep(double _deltaT)
         c2 = 0.0;
         c3 = 1.0;
         this->TransientIntegrator::formTangent(INITIAL_TANGENT);
+        theFullLinSOE->assembleLowRankUpdate();
         Matrix B1(*tmp);
         
         // solve [M + gamma*deltaT*C + beta*deltaT^2*K]*[alpha1] = [M] for alpha1
@@ -290,6 +293,7 @@ int KRAlphaExplicit_TP::formTangent(int statFlag)
     }
     
     theLinSOE->zeroA();
+    theLinSOE->setLowRankUpdate(nullptr, nullptr);
     
     int size = theLinSOE->getNumEqn();
     ID id(size);
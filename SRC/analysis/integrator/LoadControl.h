@@ -59,6 +59,8 @@ class LoadControl : public StaticIntegrator
     int newStep(void);    
     int update(const Vector &deltaU);
     int setDeltaLambda(double newDeltaLambda);
+    double getIncrement(void);
+    int setIncrement(double increment);
 
     // Public methods for Output
     int sendSelf(int commitTag, Channel &theChannel);
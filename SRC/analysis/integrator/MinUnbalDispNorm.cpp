@@ -541,9 +541,9 @@ MinUnbalDispNorm::formTangDispSensitivity(Vector *dUhatdh,int gradNumber)
    ////////////////////////////////////////////////////////
    // Loop through the loadPatterns and add the dPext/dh contributions
 
-   static Vector oneDimVectorWithOne(1);
+   static thread_local Vector oneDimVectorWithOne(1);
    oneDimVectorWithOne(0) = 1.0;
-   static ID oneDimID(1);
+   static thread_local ID oneDimID(1);
    Node *aNode;
    DOF_Group *aDofGroup;
 
@@ -738,9 +738,9 @@ MinUnbalDispNorm::formSensitivityRHS(int passedGradNumber)
   theSOE->setB(*Residual);
   
   // Loop through the loadPatterns and add the dPext/dh contributions
-  static Vector oneDimVectorWithOne(1);
+  static thread_local Vector oneDimVectorWithOne(1);
   oneDimVectorWithOne(0) = 1.0;
-  static ID oneDimID(1);
+  static thread_local ID oneDimID(1);
   
   Node *aNode;
   DOF_Group *aDofGroup;
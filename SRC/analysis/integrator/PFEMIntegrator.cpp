@@ -353,6 +353,7 @@ PFEMIntegrator::formTangent(int statFlag)
     // efficiency when performing parallel computations
 
     theLinSOE->zeroA();
+    theLinSOE->setLowRankUpdate(nullptr, nullptr);
 
     // do modal damping
     bool inclModalMatrix=theModel->inclModalDampingMatrix();
@@ -186,8 +186,8 @@ int StagedLoadControl::formTangent(int statFlag)
         if (is_lonely_dof)
         {
             double uno = 1.0;
-            static ID dofid(1);
-            static Matrix one(1, 1);
+            static thread_local ID dofid(1);
+            static thread_local Matrix one(1, 1);
             one(0, 0) = uno;
             dofid(0) = i;
             theSOE->addA(one, dofid);
@@ -118,3 +118,15 @@ StaticIntegrator::formEleTangentSensitivity(FE_Element *theEle,int gradNumber)
   return 0;
 }    
 
+
+double
+StaticIntegrator::getIncrement(void)
+{
+  return 0.0;
+}
+
+int
+StaticIntegrator::setIncrement(double increment)
+{
+  return -1;
+}
@@ -56,6 +56,11 @@ class StaticIntegrator : public IncrementalIntegrator
     using IncrementalIntegrator::newStep;
     virtual int newStep(void) =0;    
 
+    // size of the next increment, for integrators that take a
+    // prescribed one; setIncrement() returns -1 if it cannot be changed
+    virtual double getIncrement(void);
+    virtual int setIncrement(double increment);
+
   protected:
 
  
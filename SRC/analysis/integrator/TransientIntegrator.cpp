@@ -82,6 +82,7 @@ TransientIntegrator::formTangent(int statFlag)
     // efficiency when performing parallel computations
     
     theLinSOE->zeroA();
+    theLinSOE->setLowRankUpdate(nullptr, nullptr);
 
     // do modal damping
     bool inclModalMatrix=theModel->inclModalDampingMatrix();
@@ -113,6 +114,10 @@ TransientIntegrator::formTangent(int statFlag)
 	    result = -2;
 	}
     }
+
+    if (this->formInactiveTangent() < 0)
+	result = -2;
+
     return result;
 }
 
@@ -149,6 +154,9 @@ TransientIntegrator::formUnbalance(void) {
 	return -2;
     }    
 
+    if (this->formInactiveUnbalance() < 0)
+	return -3;
+
     return 0;
 }
     
@@ -1124,6 +1124,8 @@
 #define SOLVER_TAGS_CuSP                                31
 #define SOLVER_TAGS_PFEMQuasiSolver                     32
 #define SOLVER_TAGS_PFEMDiaSolver                       33
+#define SOLVER_TAGS_ProfileSPDLinMixedSolver            34
+#define SOLVER_TAGS_ProfileSPDLinOutOfCoreSolver        35
 
 #define RECORDER_TAGS_ElementRecorder		1
 #define RECORDER_TAGS_NodeRecorder		2
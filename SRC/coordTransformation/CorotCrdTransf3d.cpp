@@ -43,19 +43,19 @@ using namespace OpenSees;
 #include <CorotCrdTransf3d.h>
 
 // initialize static variables
-Matrix CorotCrdTransf3d::RI(3,3);
-Matrix CorotCrdTransf3d::RJ(3,3);
-Matrix CorotCrdTransf3d::Rbar(3,3);
-Matrix CorotCrdTransf3d::e(3,3);
-Matrix CorotCrdTransf3d::Tp(6,7);
-Matrix CorotCrdTransf3d::T(7,12);
-Matrix CorotCrdTransf3d::Tlg(12,12);
-Matrix CorotCrdTransf3d::TlgInv(12, 12);
-Matrix CorotCrdTransf3d::Tbl(6,12);
-Matrix CorotCrdTransf3d::kg(12,12);
-Matrix CorotCrdTransf3d::Lr2(12,3);
-Matrix CorotCrdTransf3d::Lr3(12,3);
-Matrix CorotCrdTransf3d::A(3,3);
+thread_local Matrix CorotCrdTransf3d::RI(3,3);
+thread_local Matrix CorotCrdTransf3d::RJ(3,3);
+thread_local Matrix CorotCrdTransf3d::Rbar(3,3);
+thread_local Matrix CorotCrdTransf3d::e(3,3);
+thread_local Matrix CorotCrdTransf3d::Tp(6,7);
+thread_local Matrix CorotCrdTransf3d::T(7,12);
+thread_local Matrix CorotCrdTransf3d::Tlg(12,12);
+thread_local Matrix CorotCrdTransf3d::TlgInv(12, 12);
+thread_local Matrix CorotCrdTransf3d::Tbl(6,12);
+thread_local Matrix CorotCrdTransf3d::kg(12,12);
+thread_local Matrix CorotCrdTransf3d::Lr2(12,3);
+thread_local Matrix CorotCrdTransf3d::Lr3(12,3);
+thread_local Matrix CorotCrdTransf3d::A(3,3);
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_CorotCrdTransf3d)
@@ -306,9 +306,9 @@ CorotCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
       initialDispChecked = true;
     }
 
-    static Vector XAxis(3);
-    static Vector YAxis(3);
-    static Vector ZAxis(3);
+    static thread_local Vector XAxis(3);
+    static thread_local Vector YAxis(3);
+    static thread_local Vector ZAxis(3);
 
     // get 3by3 rotation matrix
     if ((error = this->getLocalAxes(XAxis, YAxis, ZAxis)))
@@ -337,8 +337,8 @@ CorotCrdTransf3d::update(void)
      // get the iterative spins dAlphaI and dAlphaJ
      // (rotational displacement increments at both nodes)
 
-      static Vector dAlphaI(3);
-      static Vector dAlphaJ(3);
+      static thread_local Vector dAlphaI(3);
+      static thread_local Vector dAlphaJ(3);
 
 
       for (int k = 0; k < 3; k++) {
@@ -349,8 +349,8 @@ CorotCrdTransf3d::update(void)
     /**************************************************************/
 
     // determine global displacement increments from last iteration
-    static Vector dispI(6);
-    static Vector dispJ(6);
+    static thread_local Vector dispI(6);
+    static thread_local Vector dispJ(6);
     dispI = nodeIPtr->getTrialDisp();
     dispJ = nodeJPtr->getTrialDisp();
 
@@ -379,8 +379,8 @@ CorotCrdTransf3d::update(void)
     /************** END OF REPLACEMENT **************************/
 
     // update the nodal triads TI and RJ using quaternions
-    static Vector dAlphaIq(4);
-    static Vector dAlphaJq(4);
+    static thread_local Vector dAlphaIq(4);
+    static thread_local Vector dAlphaJq(4);
 
     dAlphaIq = this->getQuaternionFromPseudoRotVector (dAlphaI);
     dAlphaJq = this->getQuaternionFromPseudoRotVector (dAlphaJ);
@@ -392,8 +392,8 @@ CorotCrdTransf3d::update(void)
     RJ = this->getRotationMatrixFromQuaternion(alphaJq);
 
     // compute the mean nodal triad
-    static Matrix dRgamma(3,3);
-    static Vector gammaq(4);
+    static thread_local Matrix dRgamma(3,3);
+    static thread_local Vector gammaq(4);
 
     dRgamma.Zero();
 
@@ -572,8 +572,8 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
     Lr2 = this->getLMatrix(r2);
     Lr3 = this->getLMatrix(r3);
 
-    static Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
-    static Vector Se(3), At(3);
+    static thread_local Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
+    static thread_local Vector Se(3), At(3);
 
     //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
     //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
@@ -662,7 +662,7 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
     }
 
     // setup tranformation matrix
-    static Vector Lr(12);
+    static thread_local Vector Lr(12);
 
     // T(:,1) += Lr3*rI2 - Lr2*rI3;
     // T(:,2) +=           Lr2*rI1;
@@ -764,8 +764,8 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
     Lr2 = this->getLMatrix (r2);
     Lr3 = this->getLMatrix (r3);
 
-    static Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
-    static Vector Se(3), At(3);
+    static thread_local Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
+    static thread_local Vector Se(3), At(3);
 
     // O = zeros(3,1);
     // hI1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
@@ -860,7 +860,7 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
 
     // T = F'
     T.Zero();
-    static Vector Lr(12);
+    static thread_local Vector Lr(12);
 
     // f1 =  [-e1' O' e1' O'];
     for (int i = 0; i<3; i++) {
@@ -868,8 +868,8 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         T(i+3,0) = e1[i];
     }
 
-    static Vector thetaI(3);
-    static Vector thetaJ(3);
+    static thread_local Vector thetaI(3);
+    static thread_local Vector thetaJ(3);
 
 
     thetaI(0) = ul(0);
@@ -957,7 +957,7 @@ CorotCrdTransf3d::compTransfMatrixBasicLocal(Matrix &Tbl)
   Tbl.Zero();
 
   // first get transformation matrix from basic to global
-  static Matrix Tbg(6, 12);
+  static thread_local Matrix Tbg(6, 12);
   Tbg.addMatrixProduct(0.0, Tp, T, 1.0);
 
   // get inverse of transformation matrix from local to global
@@ -972,7 +972,7 @@ CorotCrdTransf3d::compTransfMatrixBasicLocal(Matrix &Tbl)
 const Vector &
 CorotCrdTransf3d::getBasicTrialDisp(void)
 {
-    static Vector ub(6);
+    static thread_local Vector ub(6);
 
     // use transformation matrix to renumber the degrees of freedom
     ub.addMatrixVector(0.0, Tp, ul, 1.0);
@@ -984,8 +984,8 @@ CorotCrdTransf3d::getBasicTrialDisp(void)
 const Vector &
 CorotCrdTransf3d::getBasicIncrDeltaDisp(void)
 {
-    static Vector dub(6);
-    static Vector dul(7);
+    static thread_local Vector dub(6);
+    static thread_local Vector dul(7);
 
     // dul = ul - ulpr;
     dul = ul;
@@ -1001,8 +1001,8 @@ CorotCrdTransf3d::getBasicIncrDeltaDisp(void)
 const Vector &
 CorotCrdTransf3d::getBasicIncrDisp(void)
 {
-    static Vector Dub(6);
-    static Vector Dul(7);
+    static thread_local Vector Dub(6);
+    static thread_local Vector Dul(7);
 
     // Dul = ul - ulcommit;
     Dul = ul;
@@ -1021,7 +1021,7 @@ CorotCrdTransf3d::getBasicTrialVel(void)
   opserr << "WARNING CorotCrdTransf3d::getBasicTrialVel()"
       << " - has not been implemented yet. Returning zeros." << endln;
 
-  static Vector dummy(6);
+  static thread_local Vector dummy(6);
   return dummy;
 }
 
@@ -1032,7 +1032,7 @@ CorotCrdTransf3d::getBasicTrialAccel(void)
   opserr << "WARNING CorotCrdTransf3d::getBasicTrialAccel()"
       << " - has not been implemented yet. Returning zeros." << endln;
 
-  static Vector dummy(6);
+  static thread_local Vector dummy(6);
   return dummy;
 }
 
@@ -1042,13 +1042,13 @@ CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
     this->update();
 
-    static Vector pg(12);
+    static thread_local Vector pg(12);
     pg.Zero();
 
     // if there are no element loads present
     if (p0 == 0.0) {
         // transform resisting forces from the basic system to local coordinates
-        static Vector pl(7);
+        static thread_local Vector pl(7);
         pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
 
         // transform resisting forces from local to global coordinates
@@ -1062,7 +1062,7 @@ CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
         // ===========================================
         // transform resisting forces from the basic system to local coordinates
         this->compTransfMatrixBasicLocal(Tbl);
-        static Vector pl(12);
+        static thread_local Vector pl(12);
         pl.addMatrixTransposeVector(0.0, Tbl, pb, 1.0);    // pl = Tbl ^ pb;
 
         // add end forces due to element p0 loads
@@ -1079,7 +1079,7 @@ CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
         // FASTER!!!! TRANSFORM REACTIONS AND ADD AT END
         // =============================================
         // transform resisting forces from the basic system to local coordinates
-        static Vector pl(7);
+        static thread_local Vector pl(7);
         pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
 
         // transform resisting forces from local to global coordinates
@@ -1087,7 +1087,7 @@ CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 
         // add end forces due to element p0 loads
         // assuming member loads are in local system
-        static Vector pl0(12), pg0(12);
+        static thread_local Vector pl0(12), pg0(12);
         pl0.Zero();
         pl0(0) = p0(0);
         pl0(1) = p0(1);
@@ -1110,20 +1110,28 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     this->update();
 
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(7,7);
-    kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0);      // kl = Tp ^ kb * Tp;
+    MatrixND<6,7> Tpn;
+    MatrixND<6,6> kbn;
+    MatrixND<7,7> kl;
+    Tpn = Tp;
+    kbn = kb;
+    kl.addMatrixTripleProduct(0.0, Tpn, kbn, 1.0);    // kl = Tp ^ kb * Tp;
 
     // transform resisting forces from the basic system to local coordinates
-    static Vector pl(7);
+    static thread_local Vector pl(7);
     pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
 
     // transform tangent  stiffness matrix from local to global coordinates
     //static Matrix kg(12,12);
 
     // compute the tangent stiffness matrix in global coordinates
-    kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
+    MatrixND<7,12> Tn;
+    MatrixND<12,12> kgn;
+    Tn = T;
+    kgn.addMatrixTripleProduct(0.0, Tn, kl, 1.0);
+    kg = kgn;
 
-    static Vector m(6);
+    static thread_local Vector m(6);
     for (int i = 0; i < 6; i++)
       m(i) = 0.5*pl(i)/cos(ul(i));
 
@@ -1199,8 +1207,8 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 
     //     ks3 = [o kbar2 o kbar4];
 
-    static Matrix Sm(3,3);
-    static Matrix kbar(12,3);
+    static thread_local Matrix Sm(3,3);
+    static thread_local Matrix kbar(12,3);
 
     Sm.addMatrix(0.0, SrI3,  m(3));
     Sm.addMatrix(1.0, SrI1,  m(1));
@@ -1244,7 +1252,7 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     //           O    O     O    O;
     //           O    O     O  Ks4_44];
 
-    static Matrix ks33(3,3);
+    static thread_local Matrix ks33(3,3);
 
     ks33.addMatrixProduct(0.0, Se2, SrI3,  m(3));
     ks33.addMatrixProduct(1.0, Se3, SrI2, -m(3));
@@ -1285,7 +1293,7 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     v /= Ln;
 
     //Ks5_11 = A*v*e1' + e1*v'*A + (e1'*v)*A;
-    static Matrix m33(3,3);
+    static thread_local Matrix m33(3,3);
     double  e1tv = e1.dot(v);   // dot product e1. v
 
     ks33.addMatrix (0.0, A, e1tv);
@@ -1363,14 +1371,22 @@ const Matrix &
 CorotCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &kb)
 {
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(7,7);
-    kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0);      // kl = Tp ^ kb * Tp;
+    MatrixND<6,7> Tpn;
+    MatrixND<6,6> kbn;
+    MatrixND<7,7> kl;
+    Tpn = Tp;
+    kbn = kb;
+    kl.addMatrixTripleProduct(0.0, Tpn, kbn, 1.0);    // kl = Tp ^ kb * Tp;
 
     // transform tangent  stiffness matrix from local to global coordinates
     //static Matrix kg(12,12);
 
     // compute the tangent stiffness matrix in global coordinates
-    kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
+    MatrixND<7,12> Tn;
+    MatrixND<12,12> kgn;
+    Tn = T;
+    kgn.addMatrixTripleProduct(0.0, Tn, kl, 1.0);
+    kg = kgn;
 
     return kg;
 }
@@ -1381,7 +1397,7 @@ CorotCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
 {
     // element projection
 
-    static Vector dx(3);
+    static thread_local Vector dx(3);
 
     dx = (nodeJPtr->getCrds() + nodeJOffset) - (nodeIPtr->getCrds() + nodeIOffset);
     if (nodeIInitialDisp != 0) {
@@ -1412,7 +1428,7 @@ CorotCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
     XAxis(0) = xAxis(0);    XAxis(1) = xAxis(1);    XAxis(2) = xAxis(2);
 
     // calculate the cross-product y = v * x
-    static Vector yAxis(3), zAxis(3);
+    static thread_local Vector yAxis(3), zAxis(3);
 
     yAxis(0) = vAxis(1)*xAxis(2) - vAxis(2)*xAxis(1);
     yAxis(1) = vAxis(2)*xAxis(0) - vAxis(0)*xAxis(2);
@@ -1466,7 +1482,7 @@ CorotCrdTransf3d::getQuaternionFromRotMatrix(const Matrix &R) const
     // obtains the normalised quaternion from the rotation matrix
     double trR;              // trace of R
     double a    ;
-    static Vector q(4);      // normalized quaternion
+    static thread_local Vector q(4);      // normalized quaternion
 
     trR = R(0,0) + R(1,1) + R(2,2);
 
@@ -1507,7 +1523,7 @@ CorotCrdTransf3d::getQuaternionFromPseudoRotVector(const Vector  &theta) const
 {
     double t;                // norm of the pseudo rotation vector
     double factor;
-    static Vector q(4);      // normalized quaternion
+    static thread_local Vector q(4);      // normalized quaternion
 
     t = theta.Norm();
 
@@ -1529,8 +1545,8 @@ const Vector &
 CorotCrdTransf3d::quaternionProduct(const Vector &q1, const Vector &q2) const
 {
 
-    static Vector q12(4);
-    static Vector q1xq2(3);     // cross product
+    static thread_local Vector q12(4);
+    static thread_local Vector q1xq2(3);     // cross product
     double q1Tq2 = 0;  // dot product
 
     // calculate the dot product q1.q2
@@ -1556,10 +1572,10 @@ const Matrix &
 CorotCrdTransf3d::getRotationMatrixFromQuaternion(const Vector &q) const
 {
     double factor;
-    static Matrix I(3,3); // identity matrix
-    static Matrix qqT(3,3);
-    static Matrix S(3,3);
-    static Matrix R(3,3);
+    static thread_local Matrix I(3,3); // identity matrix
+    static thread_local Matrix qqT(3,3);
+    static thread_local Matrix S(3,3);
+    static thread_local Matrix R(3,3);
 
     // R = (q0^2 - q' * q) * I + 2 * q * q' + 2*q0*S(q);
 
@@ -1588,7 +1604,7 @@ CorotCrdTransf3d::getRotationMatrixFromQuaternion(const Vector &q) const
 const Vector &
 CorotCrdTransf3d::getTangScaledPseudoVectorFromQuaternion(const Vector &q) const
 {
-  static Vector w(3);
+  static thread_local Vector w(3);
 
   for (int i = 0; i < 3; i++)
     w(i) = 2.0 * q(i)/q(3);
@@ -1601,9 +1617,9 @@ const Matrix &
 CorotCrdTransf3d::getRotMatrixFromTangScaledPseudoVector(const Vector &w) const
 {
     // Rotation matrix in terms of the tangent-scaled pseudo-vector
-    static Matrix S(3,3);
-    static Matrix S2(3,3);
-    static Matrix R(3,3);
+    static thread_local Matrix S(3,3);
+    static thread_local Matrix S2(3,3);
+    static thread_local Matrix R(3,3);
 
     S = this->getSkewSymMatrix(w);
 
@@ -1628,7 +1644,7 @@ CorotCrdTransf3d::getRotMatrixFromTangScaledPseudoVector(const Vector &w) const
 const Matrix &
 CorotCrdTransf3d::getSkewSymMatrix(const Vector &theta) const
 {
-    static Matrix S(3,3);
+    static thread_local Matrix S(3,3);
 
     //  St = [   0       -theta(2)  theta(1);
     //         theta(2)     0      -theta(0);
@@ -1653,14 +1669,14 @@ CorotCrdTransf3d::getSkewSymMatrix(const Vector &theta) const
 const Matrix &
 CorotCrdTransf3d::getLMatrix(const Vector &ri) const
 {
-  static Matrix L1(3,3), L2(3,3);
-  static Matrix rie1r1(3,3);
-  static Matrix e1e1r1(3,3);
-  static Matrix Sri(3,3);
-  static Matrix Sr1(3,3);
-  static Matrix L(12,3);
+  static thread_local Matrix L1(3,3), L2(3,3);
+  static thread_local Matrix rie1r1(3,3);
+  static thread_local Matrix e1e1r1(3,3);
+  static thread_local Matrix Sri(3,3);
+  static thread_local Matrix Sr1(3,3);
+  static thread_local Matrix L(12,3);
 
-  static Vector r1(3), e1(3);
+  static thread_local Vector r1(3), e1(3);
 
   for (int j = 0; j < 3; j++) {
     e1[j] =    e(j,0);
@@ -1708,8 +1724,8 @@ CorotCrdTransf3d::getLMatrix(const Vector &ri) const
 const Matrix &
 CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
 {
-    static Matrix ks2(12,12);
-    static Vector e1(3), r1(3);
+    static thread_local Matrix ks2(12,12);
+    static thread_local Vector e1(3), r1(3);
 
     //  Ksigma2 = [ K11   K12 -K11   K12;
     //              K12t  K22 -K12t  K22;
@@ -1731,9 +1747,9 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
       ztr1  += z(i)*r1(i);
     }
 
-    static Matrix zrit(3,3), ze1t(3,3);
-    static Matrix rizt(3,3), r1e1t(3,3), rie1t(3,3);
-    static Matrix e1zt(3,3);
+    static thread_local Matrix zrit(3,3), ze1t(3,3);
+    static thread_local Matrix rizt(3,3), r1e1t(3,3), rie1t(3,3);
+    static thread_local Matrix e1zt(3,3);
 
     for (int i = 0; i < 3; i++)
       for (int j = 0; j < 3; j++) {
@@ -1745,7 +1761,7 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
         rie1t(i,j) = ri(i)*e1(j);
       }
 
-    static Matrix U(3,3);
+    static thread_local Matrix U(3,3);
 
     U.addMatrixTripleProduct(0.0, A, zrit, -0.5);
 
@@ -1755,7 +1771,7 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
     U.addMatrixProduct (1.0, A, rie1t, (zte1 + ztr1)/(2*Ln));
 
     //opserr << "U: " << U;
-    static Matrix ks(3,3);
+    static thread_local Matrix ks(3,3);
 
     //K11 = U + U' + ri'*e1*(2*(e1'*z)+z'*r1)*A/(2*Ln);
 
@@ -1777,7 +1793,7 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
     ks2.Assemble(ks, 6, 0, -1.0);
     ks2.Assemble(ks, 6, 6,  1.0);
 
-    static Matrix Sri(3,3), Sr1(3,3), Sz(3,3), Se1(3,3);
+    static thread_local Matrix Sri(3,3), Sr1(3,3), Sz(3,3), Se1(3,3);
 
     Sri = this->getSkewSymMatrix(ri);
     Sr1 = this->getSkewSymMatrix(r1);
@@ -1786,7 +1802,7 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
 
     //K12 = (1/4)*(-A*z*e1'*Sri - A*ri*z'*Sr1 - z'*(e1+r1)*A*Sri);
 
-    static Matrix m1(3,3);
+    static thread_local Matrix m1(3,3);
 
     m1.addMatrixProduct(0.0, A, ze1t, -1.0);
     ks.addMatrixProduct(0.0, m1, Sri, 0.25);
@@ -1869,7 +1885,7 @@ CorotCrdTransf3d::getCopy3d(void)
 int
 CorotCrdTransf3d::sendSelf(int cTag, Channel &theChannel)
 {
-  static Vector data(48);
+  static thread_local Vector data(48);
   for (int i = 0; i<7; i++)
     data(i) = ulcommit(i);
 
@@ -1933,7 +1949,7 @@ CorotCrdTransf3d::sendSelf(int cTag, Channel &theChannel)
 int
 CorotCrdTransf3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  static Vector data(48);
+  static thread_local Vector data(48);
   if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0) {
     opserr << " CorotCrdTransf3d::recvSelf() - data could not be received\n" ;
     return -1;
@@ -2003,7 +2019,7 @@ CorotCrdTransf3d::getGlobalMatrixFromLocal(const Matrix &local)
 const Vector &
 CorotCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-    static Vector xg(3);
+    static thread_local Vector xg(3);
     opserr << " CorotCrdTransf3d::getPointGlobalCoordFromLocal: not implemented yet" ;
 
     return xg;
@@ -2013,7 +2029,7 @@ CorotCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl)
 const Vector &
 CorotCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
 {
-    static Vector uxg(3);
+    static thread_local Vector uxg(3);
     opserr << " CorotCrdTransf3d::getPointGlobalDisplFromBasic: not implemented yet" ;
 
     return uxg;
@@ -2023,7 +2039,7 @@ CorotCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
 const Vector &
 CorotCrdTransf3d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
 {
-    static Vector uxg(3);
+    static thread_local Vector uxg(3);
     opserr << " CorotCrdTransf3d::getPointLocalDisplFromBasic: not implemented yet" ;
 
     return uxg;
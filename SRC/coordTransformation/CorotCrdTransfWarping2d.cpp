@@ -46,13 +46,13 @@
 #include <CorotCrdTransfWarping2d.h>
 
 // initialize static variables
-Matrix CorotCrdTransfWarping2d::Tlg(8, 8);
-Matrix CorotCrdTransfWarping2d::Tbl(5, 8);
-Vector CorotCrdTransfWarping2d::uxg(5);
-Vector CorotCrdTransfWarping2d::pg(8);
-Vector CorotCrdTransfWarping2d::dub(5);
-Vector CorotCrdTransfWarping2d::Dub(5);
-Matrix CorotCrdTransfWarping2d::kg(8, 8);
+thread_local Matrix CorotCrdTransfWarping2d::Tlg(8, 8);
+thread_local Matrix CorotCrdTransfWarping2d::Tbl(5, 8);
+thread_local Vector CorotCrdTransfWarping2d::uxg(5);
+thread_local Vector CorotCrdTransfWarping2d::pg(8);
+thread_local Vector CorotCrdTransfWarping2d::dub(5);
+thread_local Vector CorotCrdTransfWarping2d::Dub(5);
+thread_local Matrix CorotCrdTransfWarping2d::kg(8, 8);
 
 // constructor:
 CorotCrdTransfWarping2d::CorotCrdTransfWarping2d(int tag,
@@ -182,7 +182,7 @@ CorotCrdTransfWarping2d::update(void)
   const Vector &dispI = nodeIPtr->getTrialDisp();
   const Vector &dispJ = nodeJPtr->getTrialDisp();
 
-  static Vector ug(8);
+  static thread_local Vector ug(8);
   for (int i = 0; i < 4; i++) {
     ug(i)     = dispI(i);
     ug(i + 4) = dispJ(i);
@@ -208,7 +208,7 @@ CorotCrdTransfWarping2d::update(void)
   }
 
   // transform global end displacements to local coordinates
-  static Vector ul(8);
+  static thread_local Vector ul(8);
 
   ul(0) = cosTheta * ug(0) + sinTheta * ug(1);
   ul(1) = cosTheta * ug(1) - sinTheta * ug(0);
@@ -236,7 +236,7 @@ int
 CorotCrdTransfWarping2d::compElemtLengthAndOrient(void)
 {
   // element projection
-  static Vector dx(2);
+  static thread_local Vector dx(2);
 
   if (nodeOffsets == true)
     dx = (nodeJPtr->getCrds() + nodeJOffset) -
@@ -422,14 +422,14 @@ CorotCrdTransfWarping2d::getBasicTrialVel(void)
   const Vector &vel1 = nodeIPtr->getTrialVel();
   const Vector &vel2 = nodeJPtr->getTrialVel();
 
-  static double vg[8];
+  static thread_local double vg[8];
   for (int i = 0; i < 4; i++) {
     vg[i]     = vel1(i);
     vg[i + 4] = vel2(i);
   }
 
   // transform global end velocities to local coordinates
-  static Vector vl(8);
+  static thread_local Vector vl(8);
 
   vl(0) = cosTheta * vg[0] + sinTheta * vg[1];
   vl(1) = cosTheta * vg[1] - sinTheta * vg[0];
@@ -444,7 +444,7 @@ CorotCrdTransfWarping2d::getBasicTrialVel(void)
   Lydot = vl(5) - vl(1);
 
   // transform local velocities to basic coordinates
-  static Vector vb(5);
+  static thread_local Vector vb(5);
 
   vb(0) = (Lx * Lxdot + Ly * Lydot) / Ln;
   vb(1) = vl(2) - (Lx * Lydot - Ly * Lxdot) / Ln / Ln;
@@ -462,7 +462,7 @@ CorotCrdTransfWarping2d::getBasicTrialAccel(void)
   const Vector &vel1 = nodeIPtr->getTrialVel();
   const Vector &vel2 = nodeJPtr->getTrialVel();
 
-  static double vg[8];
+  static thread_local double vg[8];
   int i;
   for (i = 0; i < 4; i++) {
     vg[i]     = vel1(i);
@@ -470,7 +470,7 @@ CorotCrdTransfWarping2d::getBasicTrialAccel(void)
   }
 
   // transform global end velocities to local coordinates
-  static Vector vl(8);
+  static thread_local Vector vl(8);
   vl(0) = cosTheta * vg[0] + sinTheta * vg[1];
   vl(1) = cosTheta * vg[1] - sinTheta * vg[0];
   vl(2) = vg[2];
@@ -487,14 +487,14 @@ CorotCrdTransfWarping2d::getBasicTrialAccel(void)
   const Vector &accel1 = nodeIPtr->getTrialAccel();
   const Vector &accel2 = nodeJPtr->getTrialAccel();
 
-  static double ag[8];
+  static thread_local double ag[8];
   for (i = 0; i < 4; i++) {
     ag[i]     = accel1(i);
     ag[i + 4] = accel2(i);
   }
 
   // transform global end accelerations to local coordinates
-  static Vector al(8);
+  static thread_local Vector al(8);
 
   al(0) = cosTheta * ag[0] + sinTheta * ag[1];
   al(1) = cosTheta * ag[1] - sinTheta * ag[0];
@@ -509,7 +509,7 @@ CorotCrdTransfWarping2d::getBasicTrialAccel(void)
   Lydotdot = al(5) - al(1);
 
   // transform local accelerations to basic coordinates
-  static Vector ab(5);
+  static thread_local Vector ab(5);
 
   ab(0) = (Lxdot * Lxdot + Lx * Lxdotdot + Ly * Lydotdot + Lydot * Lydot) / Ln -
           pow(Lx * Lxdot + Ly * Lydot, 2) / pow(Ln, 3);
@@ -530,7 +530,7 @@ CorotCrdTransfWarping2d::getGlobalResistingForce(const Vector &pb,
 
   // transform resisting forces from the basic system to local coordinates
   this->getTransfMatrixBasicLocal(Tbl);
-  static Vector pl(8);
+  static thread_local Vector pl(8);
   pl.addMatrixTransposeVector(0.0, Tbl, pb, 1.0); // pl = Tbl ^ pb;
 
   // add end forces due to element p0 loads
@@ -576,7 +576,7 @@ CorotCrdTransfWarping2d::getGlobalStiffMatrix(const Matrix &kb,
                                               const Vector &pb)
 {
   // transform tangent stiffness matrix from the basic system to local coordinates
-  static Matrix kl(8, 8);
+  static thread_local Matrix kl(8, 8);
   this->getTransfMatrixBasicLocal(Tbl);
   kl.addMatrixTripleProduct(0.0, Tbl, kb, 1.0); // kl = Tbl ^ kb * Tbl;
 
@@ -593,8 +593,8 @@ const Matrix &
 CorotCrdTransfWarping2d::getInitialGlobalStiffMatrix(const Matrix &kb)
 {
   // transform tangent stiffness matrix from the basic system to local coordinates
-  static Matrix kl(8, 8);
-  static Matrix T(5, 8);
+  static thread_local Matrix kl(8, 8);
+  static thread_local Matrix T(5, 8);
 
   // int nn = 3;
 
@@ -668,7 +668,7 @@ CorotCrdTransfWarping2d::getGeomStiffMatrix(const Vector &pb) const
   c2 = cosAlpha * cosAlpha;
   cs = sinAlpha * cosAlpha;
 
-  static Matrix kg0(8, 8), kg12(8, 8);
+  static thread_local Matrix kg0(8, 8), kg12(8, 8);
   kg0.Zero();
 
   kg12.Zero();
@@ -697,7 +697,7 @@ CorotCrdTransfWarping2d::getGeomStiffMatrix(const Vector &pb) const
 
   kg12 *= (pb(1) + pb(3)) / (Ln * Ln);
 
-  static Matrix kg(8, 8);
+  static thread_local Matrix kg(8, 8);
   // kg = kg0 + kg12;
   kg = kg0;
   kg.addMatrix(1.0, kg12, 1.0);
@@ -844,7 +844,7 @@ CorotCrdTransfWarping2d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 CorotCrdTransfWarping2d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-  static Vector xg(5);
+  static thread_local Vector xg(5);
   opserr << " CorotCrdTransfWarping2d::getPointGlobalCoordFromLocal: not "
             "implemented yet";
 
@@ -897,7 +897,7 @@ const Vector &
 CorotCrdTransfWarping2d::getGlobalResistingForceShapeSensitivity(
     const Vector &q, const Vector &p0, int gradNumber)
 {
-  static Vector dpgdh(8);
+  static thread_local Vector dpgdh(8);
   dpgdh.Zero();
 
   int nodeIid = nodeIPtr->getCrdsSensitivity();
@@ -950,13 +950,13 @@ CorotCrdTransfWarping2d::getGlobalResistingForceShapeSensitivity(
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static Vector U(6);
+  static thread_local Vector U(6);
   for (int i = 0; i < 4; i++) {
     U(i)     = disp1(i);
     U(i + 4) = disp2(i);
   }
 
-  static Vector u(8);
+  static thread_local Vector u(8);
 
   // double dux = cosTheta * (U(4) - U(0)) + sinTheta * (U(5) - U(1));
   // double duy = -sinTheta * (U(4) - U(0)) + cosTheta * (U(5) - U(1));
@@ -975,7 +975,7 @@ CorotCrdTransfWarping2d::getGlobalResistingForceShapeSensitivity(
   double q3 = q(3);
   double q4 = q(4);
 
-  static Vector dpldh(8);
+  static thread_local Vector dpldh(8);
   dpldh.Zero();
 
   dpldh(0) =
@@ -995,10 +995,10 @@ CorotCrdTransfWarping2d::getGlobalResistingForceShapeSensitivity(
   dpgdh.addMatrixTransposeVector(0.0, Tlg, dpldh,
                                  1.0); // pg = Tlg ^ pl; residual
 
-  static Vector pl(8);
+  static thread_local Vector pl(8);
   pl.Zero();
 
-  static Matrix Abl(5, 8);
+  static thread_local Matrix Abl(5, 8);
   this->getTransfMatrixBasicLocal(Abl);
 
   pl.addMatrixTransposeVector(0.0, Abl, q, 1.0); // OPTIMIZE LATER
@@ -1018,7 +1018,7 @@ CorotCrdTransfWarping2d::getGlobalResistingForceShapeSensitivity(
 const Vector &
 CorotCrdTransfWarping2d::getBasicDisplSensitivity(int gradNumber)
 {
-  static Vector dvdh(5);
+  static thread_local Vector dvdh(5);
   dvdh.Zero();
 
   int nodeIid = nodeIPtr->getCrdsSensitivity();
@@ -1060,8 +1060,8 @@ CorotCrdTransfWarping2d::getBasicDisplSensitivity(int gradNumber)
     dsinThetadh = 1 / L - sinTheta / L * dLdh;
   }
 
-  static Vector U(8);
-  static Vector dUdh(8);
+  static thread_local Vector U(8);
+  static thread_local Vector dUdh(8);
 
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
@@ -1072,7 +1072,7 @@ CorotCrdTransfWarping2d::getBasicDisplSensitivity(int gradNumber)
     dUdh(i + 4) = nodeJPtr->getDispSensitivity((i + 1), gradNumber);
   }
 
-  static Vector dudh(8);
+  static thread_local Vector dudh(8);
 
   dudh(0) = cosTheta * dUdh(0) + sinTheta * dUdh(1);
   dudh(1) = -sinTheta * dUdh(0) + cosTheta * dUdh(1);
@@ -1109,7 +1109,7 @@ CorotCrdTransfWarping2d::getBasicDisplSensitivity(int gradNumber)
 const Vector &
 CorotCrdTransfWarping2d::getBasicTrialDispShapeSensitivity(void)
 {
-  static Vector dvdh(5);
+  static thread_local Vector dvdh(5);
   dvdh.Zero();
 
   int nodeIid = nodeIPtr->getCrdsSensitivity();
@@ -1118,7 +1118,7 @@ CorotCrdTransfWarping2d::getBasicTrialDispShapeSensitivity(void)
   if (nodeIid == 0 && nodeJid == 0)
     return dvdh;
 
-  static Matrix Abl(5, 8);
+  static thread_local Matrix Abl(5, 8);
 
   this->update();
   this->getTransfMatrixBasicLocal(Abl);
@@ -1160,7 +1160,7 @@ CorotCrdTransfWarping2d::getBasicTrialDispShapeSensitivity(void)
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static Vector U(8);
+  static thread_local Vector U(8);
   for (int i = 0; i < 4; i++) {
     U(i)     = disp1(i);
     U(i + 4) = disp2(i);
@@ -1170,7 +1170,7 @@ CorotCrdTransfWarping2d::getBasicTrialDispShapeSensitivity(void)
   dvdh(1) = (sinAlpha / Ln) * dLdh;
   dvdh(2) = (sinAlpha / Ln) * dLdh;
 
-  static Vector dAdh_U(8);
+  static thread_local Vector dAdh_U(8);
   // dAdh * U
   dAdh_U(0) = dcosThetadh * U(0) + dsinThetadh * U(1);
   dAdh_U(1) = -dsinThetadh * U(0) + dcosThetadh * U(1);
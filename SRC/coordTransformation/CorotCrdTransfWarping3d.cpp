@@ -48,23 +48,23 @@ using std::string;
 using namespace std;
 
 // initialize static variables
-Matrix CorotCrdTransfWarping3d::RI(3, 3);
-Matrix CorotCrdTransfWarping3d::RJ(3, 3);
-Matrix CorotCrdTransfWarping3d::Rbar(3, 3);
-Matrix CorotCrdTransfWarping3d::e(3, 3);
-Matrix CorotCrdTransfWarping3d::Tp(6, 7);
-Matrix CorotCrdTransfWarping3d::T(
+thread_local Matrix CorotCrdTransfWarping3d::RI(3, 3);
+thread_local Matrix CorotCrdTransfWarping3d::RJ(3, 3);
+thread_local Matrix CorotCrdTransfWarping3d::Rbar(3, 3);
+thread_local Matrix CorotCrdTransfWarping3d::e(3, 3);
+thread_local Matrix CorotCrdTransfWarping3d::Tp(6, 7);
+thread_local Matrix CorotCrdTransfWarping3d::T(
     9, 14); // chagne dimension of the matrix to suit for warping degrees
-Matrix CorotCrdTransfWarping3d::Tlg(
+thread_local Matrix CorotCrdTransfWarping3d::Tlg(
     14, 14); // chagne dimension of the matrix to suit for warping degrees
-Matrix CorotCrdTransfWarping3d::TlgInv(
+thread_local Matrix CorotCrdTransfWarping3d::TlgInv(
     14, 14); // chagne dimension of the matrix to suit for warping degrees
-Matrix CorotCrdTransfWarping3d::kg(14, 14);
-Matrix CorotCrdTransfWarping3d::Lr2(
+thread_local Matrix CorotCrdTransfWarping3d::kg(14, 14);
+thread_local Matrix CorotCrdTransfWarping3d::Lr2(
     14, 3); // chagne dimension of the matrix to suit for warping degrees
-Matrix CorotCrdTransfWarping3d::Lr3(
+thread_local Matrix CorotCrdTransfWarping3d::Lr3(
     14, 3); // chagne dimension of the matrix to suit for warping degrees
-Matrix CorotCrdTransfWarping3d::A(3, 3);
+thread_local Matrix CorotCrdTransfWarping3d::A(3, 3);
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_CorotCrdTransfWarping3d)
@@ -315,9 +315,9 @@ CorotCrdTransfWarping3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
     initialDispChecked = true;
   }
 
-  static Vector XAxis(3);
-  static Vector YAxis(3);
-  static Vector ZAxis(3);
+  static thread_local Vector XAxis(3);
+  static thread_local Vector YAxis(3);
+  static thread_local Vector ZAxis(3);
 
   // get 3by3 rotation matrix
   if ((error = this->getLocalAxes(XAxis, YAxis, ZAxis)))
@@ -340,8 +340,8 @@ CorotCrdTransfWarping3d::update(void)
      // get the iterative spins dAlphaI and dAlphaJ 
      // (rotational displacement increments at both nodes)
      
-      static Vector dAlphaI(3);
-      static Vector dAlphaJ(3);
+      static thread_local Vector dAlphaI(3);
+      static thread_local Vector dAlphaJ(3);
       
        
         for (k = 0; k < 3; k++)
@@ -353,8 +353,8 @@ CorotCrdTransfWarping3d::update(void)
 #endif
 
   // determine global displacement increments from last iteration
-  static Vector dispI(7);
-  static Vector dispJ(7);
+  static thread_local Vector dispI(7);
+  static thread_local Vector dispJ(7);
   dispI = nodeIPtr->getTrialDisp();
   dispJ = nodeJPtr->getTrialDisp();
 
@@ -371,8 +371,8 @@ CorotCrdTransfWarping3d::update(void)
   // get the iterative spins dAlphaI and dAlphaJ
   // (rotational displacement increments at both nodes)
 
-  static Vector dAlphaI(3);
-  static Vector dAlphaJ(3);
+  static thread_local Vector dAlphaI(3);
+  static thread_local Vector dAlphaJ(3);
 
   for (k = 0; k < 3; k++) {
     dAlphaI(k) = dispI(k + 3) - alphaI(k);
@@ -384,8 +384,8 @@ CorotCrdTransfWarping3d::update(void)
   // ************* END OF REPLACEMENT *************************
 
   // update the nodal triads TI and RJ using quaternions
-  static Vector dAlphaIq(4);
-  static Vector dAlphaJq(4);
+  static thread_local Vector dAlphaIq(4);
+  static thread_local Vector dAlphaJq(4);
 
   dAlphaIq = this->getQuaternionFromPseudoRotVector(dAlphaI);
   dAlphaJq = this->getQuaternionFromPseudoRotVector(dAlphaJ);
@@ -397,9 +397,9 @@ CorotCrdTransfWarping3d::update(void)
   RJ = this->getRotationMatrixFromQuaternion(alphaJq);
 
   // compute the mean nodal triad
-  static Matrix dRgamma(3, 3);
-  static Vector gammaq(4);
-  static Vector gammaw(3);
+  static thread_local Matrix dRgamma(3, 3);
+  static thread_local Vector gammaq(4);
+  static thread_local Vector gammaw(3);
 
   dRgamma.Zero();
 
@@ -418,17 +418,17 @@ CorotCrdTransfWarping3d::update(void)
   Rbar.addMatrixProduct(0.0, dRgamma, RI, 1.0);
 
   // compute the base vectors e1, e2, e3
-  static Vector e1(3);
-  static Vector e2(3);
-  static Vector e3(3);
+  static thread_local Vector e1(3);
+  static thread_local Vector e2(3);
+  static thread_local Vector e3(3);
 
   // relative translation displacements
-  static Vector dJI(3);
+  static thread_local Vector dJI(3);
   for (int kk = 0; kk < 3; kk++) {
     dJI(kk) = dispJ(kk) - dispI(kk);
   }
   // element projection
-  static Vector xJI(3);
+  static thread_local Vector xJI(3);
   xJI = nodeJPtr->getCrds() - nodeIPtr->getCrds();
 
   if (nodeIInitialDisp != 0) {
@@ -443,7 +443,7 @@ CorotCrdTransfWarping3d::update(void)
     xJI(2) += nodeJInitialDisp[2];
   }
 
-  static Vector dx(3);
+  static thread_local Vector dx(3);
   // dx = xJI + dJI;
   dx = xJI;
   dx.addVector(1.0, dJI, 1.0);
@@ -461,9 +461,9 @@ CorotCrdTransfWarping3d::update(void)
 
   // 'rotate' the mean rotation matrix Rbar on to e1 to
   // obtain e2 and e3 (using the 'mid-point' procedure)
-  static Vector r1(3);
-  static Vector r2(3);
-  static Vector r3(3);
+  static thread_local Vector r1(3);
+  static thread_local Vector r2(3);
+  static thread_local Vector r3(3);
 
   for (k = 0; k < 3; k++) {
     r1(k) = Rbar(k, 0);
@@ -474,7 +474,7 @@ CorotCrdTransfWarping3d::update(void)
   //    e2 = r2 - (e1 + r1)*((r2^ e1)*0.5);
   // e3 = r3 - (e1 + r1)*((r3^ e1)*0.5);
 
-  static Vector tmp(3);
+  static thread_local Vector tmp(3);
   tmp = e1;
   tmp += r1;
 
@@ -490,8 +490,8 @@ CorotCrdTransfWarping3d::update(void)
   e3.addVector(-1.0, r3, 1.0);
 
   // compute the basic rotations
-  static Vector rI1(3), rI2(3), rI3(3);
-  static Vector rJ1(3), rJ2(3), rJ3(3);
+  static thread_local Vector rI1(3), rI2(3), rI3(3);
+  static thread_local Vector rJ1(3), rJ2(3), rJ3(3);
 
   for (k = 0; k < 3; k++) {
     e(k, 0) = e1(k);
@@ -535,10 +535,10 @@ CorotCrdTransfWarping3d::compTransfMatrixBasicGlobal(void)
   int i, j, k;
 
   //opserr << "comprTransfMatrixBasicGlobal: *****************************\n";
-  static Vector r1(3), r2(3), r3(3);
-  static Vector e1(3), e2(3), e3(3);
-  static Vector rI1(3), rI2(3), rI3(3);
-  static Vector rJ1(3), rJ2(3), rJ3(3);
+  static thread_local Vector r1(3), r2(3), r3(3);
+  static thread_local Vector e1(3), e2(3), e3(3);
+  static thread_local Vector rI1(3), rI2(3), rI3(3);
+  static thread_local Vector rJ1(3), rJ2(3), rJ3(3);
 
   for (k = 0; k < 3; k++) {
     r1(k) = Rbar(k, 0);
@@ -560,7 +560,7 @@ CorotCrdTransfWarping3d::compTransfMatrixBasicGlobal(void)
 
   // compute the transformation matrix from the basic to the
   // global system
-  static Matrix I(3, 3);
+  static thread_local Matrix I(3, 3);
 
   //   A = (1/Ln)*(I - e1*e1');
   for (i = 0; i < 3; i++)
@@ -573,8 +573,8 @@ CorotCrdTransfWarping3d::compTransfMatrixBasicGlobal(void)
   Lr2 = this->getLMatrix(r2);
   Lr3 = this->getLMatrix(r3);
 
-  static Matrix Sr1(3, 3), Sr2(3, 3), Sr3(3, 3);
-  static Vector Se(3), At(3);
+  static thread_local Matrix Sr1(3, 3), Sr2(3, 3), Sr3(3, 3);
+  static thread_local Vector Se(3), At(3);
 
   //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',   0  O', O', 0]';
   //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', 0, -(A*rI2)', O', 0]';
@@ -664,7 +664,7 @@ CorotCrdTransfWarping3d::compTransfMatrixBasicGlobal(void)
   }
 
   // setup tranformation matrix
-  static Vector Lr(14);
+  static thread_local Vector Lr(14);
 
   // T(:,1) += Lr3*rI2 - Lr2*rI3;
   // T(:,2) +=           Lr2*rI1;
@@ -736,10 +736,10 @@ CorotCrdTransfWarping3d::compTransfMatrixBasicGlobalNew(void)
   int i, j, k;
 
   //opserr << "comprTransfMatrixBasicGlobal: *****************************\n";
-  static Vector r1(3), r2(3), r3(3);
-  static Vector e1(3), e2(3), e3(3);
-  static Vector rI1(3), rI2(3), rI3(3);
-  static Vector rJ1(3), rJ2(3), rJ3(3);
+  static thread_local Vector r1(3), r2(3), r3(3);
+  static thread_local Vector e1(3), e2(3), e3(3);
+  static thread_local Vector rI1(3), rI2(3), rI3(3);
+  static thread_local Vector rJ1(3), rJ2(3), rJ3(3);
 
   for (k = 0; k < 3; k++) {
     r1(k) = Rbar(k, 0);
@@ -761,7 +761,7 @@ CorotCrdTransfWarping3d::compTransfMatrixBasicGlobalNew(void)
 
   // compute the transformation matrix from the basic to the
   // global system
-  static Matrix I(3, 3);
+  static thread_local Matrix I(3, 3);
 
   //   A = (1/Ln)*(I - e1*e1');
   for (i = 0; i < 3; i++)
@@ -774,8 +774,8 @@ CorotCrdTransfWarping3d::compTransfMatrixBasicGlobalNew(void)
   Lr2 = this->getLMatrix(r2);
   Lr3 = this->getLMatrix(r3);
 
-  static Matrix Sr1(3, 3), Sr2(3, 3), Sr3(3, 3);
-  static Vector Se(3), At(3);
+  static thread_local Matrix Sr1(3, 3), Sr2(3, 3), Sr3(3, 3);
+  static thread_local Vector Se(3), At(3);
 
   // O = zeros(3,1);
   // hI1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
@@ -785,12 +785,12 @@ CorotCrdTransfWarping3d::compTransfMatrixBasicGlobalNew(void)
   // hJ2 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
   // hJ3 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
 
-  static Vector hI1(12);
-  static Vector hI2(12);
-  static Vector hI3(12);
-  static Vector hJ1(12);
-  static Vector hJ2(12);
-  static Vector hJ3(12);
+  static thread_local Vector hI1(12);
+  static thread_local Vector hI2(12);
+  static thread_local Vector hI3(12);
+  static thread_local Vector hJ1(12);
+  static thread_local Vector hJ2(12);
+  static thread_local Vector hJ3(12);
 
   Sr1 = this->getSkewSymMatrix(rI1);
   Sr2 = this->getSkewSymMatrix(rI2);
@@ -873,7 +873,7 @@ CorotCrdTransfWarping3d::compTransfMatrixBasicGlobalNew(void)
 
   // T = F'
   T.Zero();
-  static Vector Lr(12);
+  static thread_local Vector Lr(12);
 
   // f1 =  [-e1' O' e1' O'];
   for (i = 0; i < 3; i++) {
@@ -881,8 +881,8 @@ CorotCrdTransfWarping3d::compTransfMatrixBasicGlobalNew(void)
     T(i + 3, 0) = e1(i);
   }
 
-  static Vector thetaI(3);
-  static Vector thetaJ(3);
+  static thread_local Vector thetaI(3);
+  static thread_local Vector thetaJ(3);
 
   thetaI(0) = ul(0);
   thetaI(1) = -ul(2);
@@ -966,7 +966,7 @@ CorotCrdTransfWarping3d::compTransfMatrixBasicLocal(Matrix &Tbl)
   Tbl.Zero();
 
   // first get transformation matrix from basic to global
-  static Matrix Tbg(6, 12);
+  static thread_local Matrix Tbg(6, 12);
   Tbg.addMatrixProduct(0.0, Tp, T, 1.0);
 
   // get inverse of transformation matrix from local to global
@@ -982,7 +982,7 @@ CorotCrdTransfWarping3d::compTransfMatrixBasicLocal(Matrix &Tbl)
 const Vector &
 CorotCrdTransfWarping3d::getBasicTrialDisp(void)
 {
-  static Vector ub(9);
+  static thread_local Vector ub(9);
   //basic system equals to local system
   ub = ul;
   return ub;
@@ -991,8 +991,8 @@ CorotCrdTransfWarping3d::getBasicTrialDisp(void)
 const Vector &
 CorotCrdTransfWarping3d::getBasicIncrDeltaDisp(void)
 {
-  static Vector dub(9);
-  static Vector dul(9);
+  static thread_local Vector dub(9);
+  static thread_local Vector dul(9);
 
   dul = ul;
   dul.addVector(1.0, ulpr, -1.0);
@@ -1005,8 +1005,8 @@ CorotCrdTransfWarping3d::getBasicIncrDeltaDisp(void)
 const Vector &
 CorotCrdTransfWarping3d::getBasicIncrDisp(void)
 {
-  static Vector Dub(9);
-  static Vector Dul(9);
+  static thread_local Vector Dub(9);
+  static thread_local Vector Dul(9);
 
   // Dul = ul - ulcommit;
   Dul = ul;
@@ -1022,7 +1022,7 @@ CorotCrdTransfWarping3d::getBasicTrialVel(void)
   opserr << "ERROR CorotCrdTransfWarping3d::getBasicTrialVel()"
          << " - has not been implemented yet." << endln;
 
-  static Vector dummy(1);
+  static thread_local Vector dummy(1);
   return dummy;
 }
 
@@ -1032,7 +1032,7 @@ CorotCrdTransfWarping3d::getBasicTrialAccel(void)
   opserr << "ERROR CorotCrdTransfWarping3d::getBasicTrialAccel()"
          << " - has not been implemented yet." << endln;
 
-  static Vector dummy(1);
+  static thread_local Vector dummy(1);
   return dummy;
 }
 
@@ -1041,14 +1041,14 @@ CorotCrdTransfWarping3d::getGlobalResistingForce(const Vector &pb,
                                                  const Vector &unifLoad)
 {
   this->update();
-  static Vector pl(9);
+  static thread_local Vector pl(9);
   // do not transform, basic equals to local
   pl = pb;
 
   // check distributed load is zero (not implemented yet)
 
   // transform resisting forces  from local to global coordinates
-  static Vector pg(14);
+  static thread_local Vector pg(14);
   pg.addMatrixTransposeVector(0.0, T, pl, 1.0); // pg = T ^ pl; residua
 
   return pg;
@@ -1063,23 +1063,23 @@ CorotCrdTransfWarping3d::getGlobalStiffMatrix(const Matrix &kb,
 
   int i, j, k;
   // transform tangent stiffness matrix from the basic system to local coordinates
-  static Matrix kl(9, 9);
+  static thread_local Matrix kl(9, 9);
   // do not transform, basic equals to local
   kl = kb;
   // transform resisting forces from the basic system to local coordinates
-  static Vector pl(9);
+  static thread_local Vector pl(9);
   pl = pb;
 
   // transform tangent  stiffness matrix from local to global coordinates
-  static Matrix kg(14, 14);
+  static thread_local Matrix kg(14, 14);
   kg.Zero();
-  static Matrix kgConvert(12, 12);
+  static thread_local Matrix kgConvert(12, 12);
   kgConvert.Zero();
   // compute the tangent stiffness matrix in global coordinates
   // first compute Kt1
   kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
   // second compute ktsigma
-  static Vector m(6);
+  static thread_local Vector m(6);
   for (i = 0; i < 3; i++)
     m(i) = pl(i) / (2 * cos(ul(i)));
 
@@ -1087,10 +1087,10 @@ CorotCrdTransfWarping3d::getGlobalStiffMatrix(const Matrix &kb,
     m(i) = pl(i + 1) / (2 * cos(ul(i + 1)));
   // compute the basic rotations
 
-  static Vector e1(3), e2(3), e3(3);
-  static Vector r1(3), r2(3), r3(3);
-  static Vector rI1(3), rI2(3), rI3(3);
-  static Vector rJ1(3), rJ2(3), rJ3(3);
+  static thread_local Vector e1(3), e2(3), e3(3);
+  static thread_local Vector r1(3), r2(3), r3(3);
+  static thread_local Vector rI1(3), rI2(3), rI3(3);
+  static thread_local Vector rJ1(3), rJ2(3), rJ3(3);
 
   for (k = 0; k < 3; k++) {
     e1(k) = e(k, 0);
@@ -1116,10 +1116,10 @@ CorotCrdTransfWarping3d::getGlobalStiffMatrix(const Matrix &kb,
   //        m(5)*ks2r2u1 + m(6)*ks2r3u1 + ...
   //        ks3 + ks3' + ks4 + ks5;
 
-  static Matrix Se1(3, 3), Se2(3, 3), Se3(3, 3);
-  static Matrix SrI1(3, 3), SrI2(3, 3), SrI3(3, 3);
-  static Matrix SrJ1(3, 3), SrJ2(3, 3), SrJ3(3, 3);
-  static Matrix LLr2(12, 3), LLr3(12, 3);
+  static thread_local Matrix Se1(3, 3), Se2(3, 3), Se3(3, 3);
+  static thread_local Matrix SrI1(3, 3), SrI2(3, 3), SrI3(3, 3);
+  static thread_local Matrix SrJ1(3, 3), SrJ2(3, 3), SrJ3(3, 3);
+  static thread_local Matrix LLr2(12, 3), LLr3(12, 3);
   LLr2.Zero();
   LLr3.Zero();
   for (i = 0; i < 6; i++) {
@@ -1170,8 +1170,8 @@ CorotCrdTransfWarping3d::getGlobalStiffMatrix(const Matrix &kb,
 
   //     ks3 = [o kbar2 o kbar4];
 
-  static Matrix Sm(3, 3);
-  static Matrix kbar(12, 3);
+  static thread_local Matrix Sm(3, 3);
+  static thread_local Matrix kbar(12, 3);
 
   Sm.addMatrix(0.0, SrI3, m(3));
   Sm.addMatrix(1.0, SrI1, m(1));
@@ -1212,7 +1212,7 @@ CorotCrdTransfWarping3d::getGlobalStiffMatrix(const Matrix &kb,
   //           O    O     O    O;
   //           O    O     O  Ks4_44];
 
-  static Matrix ks33(3, 3);
+  static thread_local Matrix ks33(3, 3);
 
   ks33.addMatrixProduct(0.0, Se2, SrI3, m(3));
   ks33.addMatrixProduct(1.0, Se3, SrI2, -m(3));
@@ -1246,7 +1246,7 @@ CorotCrdTransfWarping3d::getGlobalStiffMatrix(const Matrix &kb,
   //          Ks5_14t     O   -Ks5_14t   O];
 
   // v = (1/Ln)*(m(2)*rI2 + m(3)*rI3 + m(5)*rJ2 + m(6)*rJ3);
-  static Vector v(3);
+  static thread_local Vector v(3);
   v.addVector(0.0, rI2, m(1));
   v.addVector(1.0, rI3, m(2));
   v.addVector(1.0, rJ2, m(4));
@@ -1255,7 +1255,7 @@ CorotCrdTransfWarping3d::getGlobalStiffMatrix(const Matrix &kb,
   v /= Ln;
 
   //Ks5_11 = A*v*e1' + e1*v'*A + (e1'*v)*A;
-  static Matrix m33(3, 3);
+  static thread_local Matrix m33(3, 3);
   double e1tv = 0; // dot product e1. v
 
   for (i = 0; i < 3; i++)
@@ -1305,7 +1305,7 @@ CorotCrdTransfWarping3d::getGlobalStiffMatrix(const Matrix &kb,
   //opserr << "kg += ksigma5: " << kg;
 
   // Ksigma -------------------------------
-  static Vector rm(3);
+  static thread_local Vector rm(3);
 
   rm = rI3;
   rm.addVector(1.0, rJ3, -1.0);
@@ -1321,10 +1321,10 @@ CorotCrdTransfWarping3d::getGlobalStiffMatrix(const Matrix &kb,
   kgConvert.addMatrix(1.0, this->getKs2Matrix(r3, rJ1), m(5));
   //  T * diag (M .* tan(thetal))*T'
 
-  static Vector ulg(6);
+  static thread_local Vector ulg(6);
   //ul(0),ul(1),ul(2),ul(4),ul(5),ul(6)
-  static Vector plg(6);
-  static Matrix Tg(7, 12);
+  static thread_local Vector plg(6);
+  static thread_local Matrix Tg(7, 12);
   //transformed from T(9,12)
   for (i = 0; i < 3; i++)
     ulg(i) = ul(i);
@@ -1393,12 +1393,12 @@ const Matrix &
 CorotCrdTransfWarping3d::getInitialGlobalStiffMatrix(const Matrix &kb)
 {
   // transform tangent stiffness matrix from the basic system to local coordinates
-  static Matrix kl(9, 9);
+  static thread_local Matrix kl(9, 9);
   kl = kb;
   //kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0);      // kl = Tp ^ kb * Tp;
 
   // transform tangent  stiffness matrix from local to global coordinates
-  static Matrix kg(14, 14);
+  static thread_local Matrix kg(14, 14);
 
   // compute the tangent stiffness matrix in global coordinates
   kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
@@ -1412,7 +1412,7 @@ CorotCrdTransfWarping3d::getLocalAxes(Vector &XAxis, Vector &YAxis,
 {
   // element projection
 
-  static Vector dx(3);
+  static thread_local Vector dx(3);
 
   dx =
       (nodeJPtr->getCrds() + nodeJOffset) - (nodeIPtr->getCrds() + nodeIOffset);
@@ -1447,7 +1447,7 @@ CorotCrdTransfWarping3d::getLocalAxes(Vector &XAxis, Vector &YAxis,
   XAxis(2) = xAxis(2);
 
   // calculate the cross-product y = v * x
-  static Vector yAxis(3), zAxis(3);
+  static thread_local Vector yAxis(3), zAxis(3);
 
   yAxis(0) = vAxis(1) * xAxis(2) - vAxis(2) * xAxis(1);
   yAxis(1) = vAxis(2) * xAxis(0) - vAxis(0) * xAxis(2);
@@ -1503,7 +1503,7 @@ CorotCrdTransfWarping3d::getQuaternionFromRotMatrix(const Matrix &R) const
   int i, j, k;
   double trR; // trace of R
   double a;
-  static Vector q(4); // normalized quaternion
+  static thread_local Vector q(4); // normalized quaternion
 
   trR = R(0, 0) + R(1, 1) + R(2, 2);
 
@@ -1543,7 +1543,7 @@ CorotCrdTransfWarping3d::getQuaternionFromPseudoRotVector(
 {
   double t; // norm of the pseudo rotation vector
   double factor;
-  static Vector q(4); // normalized quaternion
+  static thread_local Vector q(4); // normalized quaternion
 
   t = theta.Norm();
 
@@ -1565,10 +1565,10 @@ CorotCrdTransfWarping3d::quaternionProduct(const Vector &q1,
                                            const Vector &q2) const
 {
 
-  static Vector q12(4);
+  static thread_local Vector q12(4);
   int i;
   double q1Tq2 = 0;       // dot product
-  static Vector q1xq2(3); // cross product
+  static thread_local Vector q1xq2(3); // cross product
 
   // calculate the dot product q1.q2
   for (i = 0; i < 3; i++) // NOTE i <3, not i<4
@@ -1593,10 +1593,10 @@ CorotCrdTransfWarping3d::getRotationMatrixFromQuaternion(const Vector &q) const
 {
   int i, j;
   double factor;
-  static Matrix I(3, 3); // identity matrix
-  static Matrix qqT(3, 3);
-  static Matrix S(3, 3);
-  static Matrix R(3, 3);
+  static thread_local Matrix I(3, 3); // identity matrix
+  static thread_local Matrix qqT(3, 3);
+  static thread_local Matrix S(3, 3);
+  static thread_local Matrix R(3, 3);
 
   // R = (q0^2 - q' * q) * I + 2 * q * q' + 2*q0*S(q);
 
@@ -1625,7 +1625,7 @@ const Vector &
 CorotCrdTransfWarping3d::getTangScaledPseudoVectorFromQuaternion(
     const Vector &q) const
 {
-  static Vector w(3);
+  static thread_local Vector w(3);
 
   for (int i = 0; i < 3; i++)
     w(i) = 2.0 * q(i) / q(3);
@@ -1638,9 +1638,9 @@ CorotCrdTransfWarping3d::getRotMatrixFromTangScaledPseudoVector(
     const Vector &w) const
 {
   // Rotation matrix in terms of the tangent-scaled pseudo-vector
-  static Matrix S(3, 3);
-  static Matrix S2(3, 3);
-  static Matrix R(3, 3);
+  static thread_local Matrix S(3, 3);
+  static thread_local Matrix S2(3, 3);
+  static thread_local Matrix R(3, 3);
   double normw2;
 
   S = this->getSkewSymMatrix(w);
@@ -1665,7 +1665,7 @@ CorotCrdTransfWarping3d::getRotMatrixFromTangScaledPseudoVector(
 const Matrix &
 CorotCrdTransfWarping3d::getSkewSymMatrix(const Vector &theta) const
 {
-  static Matrix S(3, 3);
+  static thread_local Matrix S(3, 3);
 
   //  St = [   0       -theta(2)  theta(1);
   //         theta(2)     0      -theta(0);
@@ -1692,14 +1692,14 @@ CorotCrdTransfWarping3d::getSkewSymMatrix(const Vector &theta) const
 const Matrix &
 CorotCrdTransfWarping3d::getLMatrix(const Vector &ri) const
 {
-  static Matrix L1(3, 3), L2(3, 3);
-  static Vector r1(3), e1(3);
+  static thread_local Matrix L1(3, 3), L2(3, 3);
+  static thread_local Vector r1(3), e1(3);
   double rie1, e1r1k;
-  static Matrix rie1r1(3, 3);
-  static Matrix e1e1r1(3, 3);
-  static Matrix Sri(3, 3);
-  static Matrix Sr1(3, 3);
-  static Matrix L(14, 3);
+  static thread_local Matrix rie1r1(3, 3);
+  static thread_local Matrix e1e1r1(3, 3);
+  static thread_local Matrix Sri(3, 3);
+  static thread_local Matrix Sr1(3, 3);
+  static thread_local Matrix L(14, 3);
 
   int j, k;
 
@@ -1754,8 +1754,8 @@ CorotCrdTransfWarping3d::getLMatrix(const Vector &ri) const
 const Matrix &
 CorotCrdTransfWarping3d::getKs2Matrix(const Vector &ri, const Vector &z) const
 {
-  static Matrix ks2(12, 12);
-  static Vector e1(3), r1(3);
+  static thread_local Matrix ks2(12, 12);
+  static thread_local Vector e1(3), r1(3);
 
   //  Ksigma2 = [ K11   K12 -K11   K12;
   //              K12t  K22 -K12t  K22;
@@ -1778,9 +1778,9 @@ CorotCrdTransfWarping3d::getKs2Matrix(const Vector &ri, const Vector &z) const
     ztr1 += z(i) * r1(i);
   }
 
-  static Matrix zrit(3, 3), ze1t(3, 3);
-  static Matrix rizt(3, 3), r1e1t(3, 3), rie1t(3, 3);
-  static Matrix e1zt(3, 3);
+  static thread_local Matrix zrit(3, 3), ze1t(3, 3);
+  static thread_local Matrix rizt(3, 3), r1e1t(3, 3), rie1t(3, 3);
+  static thread_local Matrix e1zt(3, 3);
 
   for (i = 0; i < 3; i++)
     for (j = 0; j < 3; j++) {
@@ -1792,7 +1792,7 @@ CorotCrdTransfWarping3d::getKs2Matrix(const Vector &ri, const Vector &z) const
       rie1t(i, j) = ri(i) * e1(j);
     }
 
-  static Matrix U(3, 3);
+  static thread_local Matrix U(3, 3);
 
   U.addMatrixTripleProduct(0.0, A, zrit, -0.5);
 
@@ -1801,7 +1801,7 @@ CorotCrdTransfWarping3d::getKs2Matrix(const Vector &ri, const Vector &z) const
   U.addMatrixProduct(1.0, A, rie1t, (zte1 + ztr1) / (2 * Ln));
 
   //opserr << "U: " << U;
-  static Matrix ks(3, 3);
+  static thread_local Matrix ks(3, 3);
 
   //K11 = U + U' + ri'*e1*(2*(e1'*z)+z'*r1)*A/(2*Ln);
 
@@ -1823,7 +1823,7 @@ CorotCrdTransfWarping3d::getKs2Matrix(const Vector &ri, const Vector &z) const
   ks2.Assemble(ks, 6, 0, -1.0);
   ks2.Assemble(ks, 6, 6, 1.0);
 
-  static Matrix Sri(3, 3), Sr1(3, 3), Sz(3, 3), Se1(3, 3);
+  static thread_local Matrix Sri(3, 3), Sr1(3, 3), Sz(3, 3), Se1(3, 3);
 
   Sri = this->getSkewSymMatrix(ri);
   Sr1 = this->getSkewSymMatrix(r1);
@@ -1832,7 +1832,7 @@ CorotCrdTransfWarping3d::getKs2Matrix(const Vector &ri, const Vector &z) const
 
   //K12 = (1/4)*(-A*z*e1'*Sri - A*ri*z'*Sr1 - z'*(e1+r1)*A*Sri);
 
-  static Matrix m1(3, 3);
+  static thread_local Matrix m1(3, 3);
 
   m1.addMatrixProduct(0.0, A, ze1t, -1.0);
   ks.addMatrixProduct(0.0, m1, Sri, 0.25);
@@ -2042,7 +2042,7 @@ CorotCrdTransfWarping3d::getGlobalMatrixFromLocal(const Matrix &local)
 const Vector &
 CorotCrdTransfWarping3d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-  static Vector xg(3);
+  static thread_local Vector xg(3);
   opserr << " CorotCrdTransfWarping3d::getPointGlobalCoordFromLocal: not "
             "implemented yet";
 
@@ -2053,7 +2053,7 @@ const Vector &
 CorotCrdTransfWarping3d::getPointGlobalDisplFromBasic(double xi,
                                                       const Vector &uxb)
 {
-  static Vector uxg(3);
+  static thread_local Vector uxg(3);
   opserr << " CorotCrdTransfWarping3d::getPointGlobalDisplFromBasic: not "
             "implemented yet";
 
@@ -2064,7 +2064,7 @@ const Vector &
 CorotCrdTransfWarping3d::getPointLocalDisplFromBasic(double xi,
                                                      const Vector &uxb)
 {
-  static Vector uxg(3);
+  static thread_local Vector uxg(3);
   opserr << " CorotCrdTransfWarping3d::getPointLocalDisplFromBasic: not "
             "implemented yet";
 
@@ -117,17 +117,17 @@ private:
     Vector ulcommit;            // commited local displacements
     Vector ulpr;                // previous local displacements
     
-    static Matrix RI;           // nodal triad for node 1
-    static Matrix RJ;           // nodal triad for node 2
-    static Matrix Rbar;         // mean nodal triad 
-    static Matrix e;            // base vectors
-    static Matrix Tp;           // transformation matrix to renumber dofs
-    static Matrix T;            // transformation matrix from basic to global system
-    static Matrix TlgInv;       // inverse of transformation matrix from global to local system
+    static thread_local Matrix RI;           // nodal triad for node 1
+    static thread_local Matrix RJ;           // nodal triad for node 2
+    static thread_local Matrix Rbar;         // mean nodal triad 
+    static thread_local Matrix e;            // base vectors
+    static thread_local Matrix Tp;           // transformation matrix to renumber dofs
+    static thread_local Matrix T;            // transformation matrix from basic to global system
+    static thread_local Matrix TlgInv;       // inverse of transformation matrix from global to local system
     //static Matrix Tbl;          // transformation matrix from local to basic system
-    static Matrix Tlg;          // transformation matrix from global to local system    
-    static Matrix kg;           // global stiffness matrix    
-    static Matrix Lr2, Lr3, A;  // auxiliary matrices	
+    static thread_local Matrix Tlg;          // transformation matrix from global to local system    
+    static thread_local Matrix kg;           // global stiffness matrix    
+    static thread_local Matrix Lr2, Lr3, A;  // auxiliary matrices	
     
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
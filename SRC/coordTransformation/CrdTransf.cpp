@@ -127,7 +127,7 @@ CrdTransf::getBasicDisplSensitivity(int gradNumber)
     opserr << "WARNING CrdTransf::getBasicDisplSensitivity() - this method "
         << " should not be called." << endln;
     
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
 }
 
@@ -139,7 +139,7 @@ CrdTransf::getGlobalResistingForceShapeSensitivity(const Vector &pb,
     opserr << "ERROR CrdTransf::getGlobalResistingForceSensitivity() - has not been"
         << " implemented yet for the chosen transformation." << endln;
     
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
 }
 
@@ -150,7 +150,7 @@ CrdTransf::getGlobalResistingForceShapeSensitivity(const Vector &pb,
     opserr << "ERROR CrdTransf::getGlobalResistingForceSensitivity() - has not been"
         << " implemented yet for the chosen transformation." << endln;
     
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
 }
 
@@ -160,7 +160,7 @@ CrdTransf::getBasicTrialDispShapeSensitivity(void)
     opserr << "ERROR CrdTransf::getBasicTrialDispShapeSensitivity() - has not been"
         << " implemented yet for the chosen transformation." << endln;
     
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
 }
 
@@ -173,6 +173,6 @@ CrdTransf::getBasicDisplSensitivity(int gradNumber, int)
     opserr << "WARNING CrdTransf::getBasicDisplSensitivity() - this method "
         << " should not be called." << endln;
     
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
 }
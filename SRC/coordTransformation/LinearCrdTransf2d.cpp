@@ -40,8 +40,8 @@
 #include <LinearCrdTransf2d.h>
 
 // initialize static variables
-Matrix LinearCrdTransf2d::Tlg(6, 6);
-Matrix LinearCrdTransf2d::kg(6, 6);
+thread_local Matrix LinearCrdTransf2d::Tlg(6, 6);
+thread_local Matrix LinearCrdTransf2d::kg(6, 6);
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_LinearCrdTransf2d)
@@ -207,7 +207,7 @@ int
 LinearCrdTransf2d::computeElemtLengthAndOrient()
 {
   // element projection
-  static Vector dx(2);
+  static thread_local Vector dx(2);
 
   const Vector &ndICoords = nodeIPtr->getCrds();
   const Vector &ndJCoords = nodeJPtr->getCrds();
@@ -283,7 +283,7 @@ LinearCrdTransf2d::getBasicTrialDisp(void)
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static double ug[6];
+  static thread_local double ug[6];
   for (int i = 0; i < 3; i++) {
     ug[i]     = disp1(i);
     ug[i + 3] = disp2(i);
@@ -299,7 +299,7 @@ LinearCrdTransf2d::getBasicTrialDisp(void)
       ug[j + 3] -= nodeJInitialDisp[j];
   }
 
-  static Vector ub(3);
+  static thread_local Vector ub(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -336,13 +336,13 @@ LinearCrdTransf2d::getBasicIncrDisp(void)
   const Vector &disp1 = nodeIPtr->getIncrDisp();
   const Vector &disp2 = nodeJPtr->getIncrDisp();
 
-  static double dug[6];
+  static thread_local double dug[6];
   for (int i = 0; i < 3; i++) {
     dug[i]     = disp1(i);
     dug[i + 3] = disp2(i);
   }
 
-  static Vector dub(3);
+  static thread_local Vector dub(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -379,13 +379,13 @@ LinearCrdTransf2d::getBasicIncrDeltaDisp(void)
   const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
   const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
 
-  static double Dug[6];
+  static thread_local double Dug[6];
   for (int i = 0; i < 3; i++) {
     Dug[i]     = disp1(i);
     Dug[i + 3] = disp2(i);
   }
 
-  static Vector Dub(3);
+  static thread_local Vector Dub(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -422,13 +422,13 @@ LinearCrdTransf2d::getBasicTrialVel(void)
   const Vector &vel1 = nodeIPtr->getTrialVel();
   const Vector &vel2 = nodeJPtr->getTrialVel();
 
-  static double vg[6];
+  static thread_local double vg[6];
   for (int i = 0; i < 3; i++) {
     vg[i]     = vel1(i);
     vg[i + 3] = vel2(i);
   }
 
-  static Vector vb(3);
+  static thread_local Vector vb(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -465,13 +465,13 @@ LinearCrdTransf2d::getBasicTrialAccel(void)
   const Vector &accel1 = nodeIPtr->getTrialAccel();
   const Vector &accel2 = nodeJPtr->getTrialAccel();
 
-  static double ag[6];
+  static thread_local double ag[6];
   for (int i = 0; i < 3; i++) {
     ag[i]     = accel1(i);
     ag[i + 3] = accel2(i);
   }
 
-  static Vector ab(3);
+  static thread_local Vector ab(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -505,7 +505,7 @@ const Vector &
 LinearCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
   // transform resisting forces from the basic system to local coordinates
-  static double pl[6];
+  static thread_local double pl[6];
 
   double q0 = pb(0);
   double q1 = pb(1);
@@ -527,7 +527,7 @@ LinearCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
   pl[4] += p0(2);
 
   // transform resisting forces  from local to global coordinates
-  static Vector pg(6);
+  static thread_local Vector pg(6);
 
   pg(0) = cosTheta * pl[0] - sinTheta * pl[1];
   pg(1) = sinTheta * pl[0] + cosTheta * pl[1];
@@ -560,7 +560,7 @@ LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb,
                                                            const Vector &p0)
 {
   // transform resisting forces from the basic system to local coordinates
-  static double pl[6];
+  static thread_local double pl[6];
 
   double q0 = pb(0);
   double q1 = pb(1);
@@ -582,10 +582,10 @@ LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb,
   //	pl[4] += p0(2);
 
   // transform resisting forces  from local to global coordinates
-  static Vector pg(6);
+  static thread_local Vector pg(6);
   pg.Zero();
 
-  static ID nodeParameterID(2);
+  static thread_local ID nodeParameterID(2);
   nodeParameterID(0) = nodeIPtr->getCrdsSensitivity();
   nodeParameterID(1) = nodeJPtr->getCrdsSensitivity();
 
@@ -639,7 +639,7 @@ LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb,
 const Matrix &
 LinearCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 {
-  static double tmp[6][6];
+  static thread_local double tmp[6][6];
   double oneOverL = 1.0 / L;
   double kb00, kb01, kb02, kb10, kb11, kb12, kb20, kb21, kb22;
 
@@ -765,7 +765,7 @@ LinearCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 const Matrix &
 LinearCrdTransf2d::getInitialGlobalStiffMatrix(const Matrix &kb)
 {
-  static double tmp[6][6];
+  static thread_local double tmp[6][6];
   double oneOverL = 1.0 / L;
   double kb00, kb01, kb02, kb10, kb11, kb12, kb20, kb21, kb22;
 
@@ -924,7 +924,7 @@ LinearCrdTransf2d::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
 
-  static Vector data(12);
+  static thread_local Vector data(12);
   data(0) = this->getTag();
   data(1) = L;
   if (nodeIOffset != 0) {
@@ -978,7 +978,7 @@ LinearCrdTransf2d::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(12);
+  static thread_local Vector data(12);
 
   res += theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
@@ -1055,7 +1055,7 @@ LinearCrdTransf2d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 LinearCrdTransf2d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-  static Vector xg(2);
+  static thread_local Vector xg(2);
 
   const Vector &nodeICoords = nodeIPtr->getCrds();
   xg(0)                     = nodeICoords(0);
@@ -1080,7 +1080,7 @@ LinearCrdTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static Vector ug(6);
+  static thread_local Vector ug(6);
   for (int i = 0; i < 3; i++) {
     ug(i)     = disp1(i);
     ug(i + 3) = disp2(i);
@@ -1097,7 +1097,7 @@ LinearCrdTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
   }
 
   // transform global end displacements to local coordinates
-  static Vector ul(6); // total displacements
+  static thread_local Vector ul(6); // total displacements
 
   ul(0) = cosTheta * ug(0) + sinTheta * ug(1);
   ul(1) = -sinTheta * ug(0) + cosTheta * ug(1);
@@ -1123,7 +1123,7 @@ LinearCrdTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
   }
 
   // compute displacements at point xi, in local coordinates
-  static Vector uxl(2), uxg(2);
+  static thread_local Vector uxl(2), uxg(2);
 
   uxl(0) = uxb(0) + ul(0);
   uxl(1) = uxb(1) + (1 - xi) * ul(1) + xi * ul(4);
@@ -1143,7 +1143,7 @@ LinearCrdTransf2d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static Vector ug(6);
+  static thread_local Vector ug(6);
   for (int i = 0; i < 3; i++) {
     ug(i)     = disp1(i);
     ug(i + 3) = disp2(i);
@@ -1160,7 +1160,7 @@ LinearCrdTransf2d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
   }
 
   // transform global end displacements to local coordinates
-  static Vector ul(6); // total displacements
+  static thread_local Vector ul(6); // total displacements
 
   ul(0) = cosTheta * ug(0) + sinTheta * ug(1);
   ul(1) = -sinTheta * ug(0) + cosTheta * ug(1);
@@ -1186,7 +1186,7 @@ LinearCrdTransf2d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
   }
 
   // compute displacements at point xi, in local coordinates
-  static Vector uxl(2);
+  static thread_local Vector uxl(2);
 
   uxl(0) = uxb(0) + ul(0);
   uxl(1) = uxb(1) + (1 - xi) * ul(1) + xi * ul(4);
@@ -1228,7 +1228,7 @@ LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb,
                                                            int gradNumber)
 {
   // transform resisting forces from the basic system to local coordinates
-  static double pl[6];
+  static thread_local double pl[6];
 
   double q0 = pb(0);
   double q1 = pb(1);
@@ -1250,10 +1250,10 @@ LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb,
   pl[4] += p0(2);
 
   // transform resisting forces  from local to global coordinates
-  static Vector pg(6);
+  static thread_local Vector pg(6);
   pg.Zero();
 
-  static ID nodeParameterID(2);
+  static thread_local ID nodeParameterID(2);
   nodeParameterID(0) = nodeIPtr->getCrdsSensitivity();
   nodeParameterID(1) = nodeJPtr->getCrdsSensitivity();
 
@@ -1307,8 +1307,8 @@ LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb,
 const Vector &
 LinearCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
 {
-  static Vector U(6);
-  static Vector dUdh(6);
+  static thread_local Vector U(6);
+  static thread_local Vector dUdh(6);
 
   const Vector &dispI = nodeIPtr->getTrialDisp();
   const Vector &dispJ = nodeJPtr->getTrialDisp();
@@ -1320,7 +1320,7 @@ LinearCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
     dUdh(i + 3) = nodeJPtr->getDispSensitivity((i + 1), gradNumber);
   }
 
-  static Vector dvdh(3);
+  static thread_local Vector dvdh(3);
 
   double dcosThetadh = 0.0;
   double dsinThetadh = 0.0;
@@ -1352,7 +1352,7 @@ LinearCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
     dcosThetadh = -dx * dy / (L * L * L);
   }
 
-  static Vector dudh(6);
+  static thread_local Vector dudh(6);
   //dudh = A*dUdh + dAdh*U;
   dudh(0) = cosTheta * dUdh(0) + sinTheta * dUdh(1) + dcosThetadh * U(0) +
             dsinThetadh * U(1);
@@ -1365,7 +1365,7 @@ LinearCrdTransf2d::getBasicDisplSensitivity(int gradNumber)
             dcosThetadh * U(4);
   dudh(5) = dUdh(5);
 
-  static Vector u(6);
+  static thread_local Vector u(6);
   //u = A*U;
   u(0) = cosTheta * U(0) + sinTheta * U(1);
   u(1) = -sinTheta * U(0) + cosTheta * U(1);
@@ -1460,7 +1460,7 @@ LinearCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static double ug[6];
+  static thread_local double ug[6];
   for (int i = 0; i < 3; i++) {
     ug[i]     = disp1(i);
     ug[i + 3] = disp2(i);
@@ -1476,10 +1476,10 @@ LinearCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
       ug[j + 3] -= nodeJInitialDisp[j];
   }
 
-  static Vector ub(3);
+  static thread_local Vector ub(3);
   ub.Zero();
 
-  static ID nodeParameterID(2);
+  static thread_local ID nodeParameterID(2);
   nodeParameterID(0) = nodeIPtr->getCrdsSensitivity();
   nodeParameterID(1) = nodeJPtr->getCrdsSensitivity();
 
@@ -1544,13 +1544,13 @@ LinearCrdTransf2d::getBasicDisplSensitivity(int gradNumber, int flag)
   // up the nodal displacements we just pick up
   // the nodal displacement sensitivities.
 
-  static double ug[6];
+  static thread_local double ug[6];
   for (int i = 0; i < 3; i++) {
     ug[i]     = nodeIPtr->getDispSensitivity((i + 1), gradNumber);
     ug[i + 3] = nodeJPtr->getDispSensitivity((i + 1), gradNumber);
   }
 
-  static Vector ub(3);
+  static thread_local Vector ub(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -20,8 +20,8 @@
 
 
 // initialize static variables
-Matrix LinearShearTransf2d::Tlg(6,6);
-Matrix LinearShearTransf2d::kg(6,6);
+thread_local Matrix LinearShearTransf2d::Tlg(6,6);
+thread_local Matrix LinearShearTransf2d::kg(6,6);
 
 
 // constructor:
@@ -147,7 +147,7 @@ int
 LinearShearTransf2d::computeElemtLengthAndOrient()
 {
    // element projection
-   static Vector dx(2);
+   static thread_local Vector dx(2);
 
    const Vector &ndICoords = nodeIPtr->getCrds();
    const Vector &ndJCoords = nodeJPtr->getCrds();
@@ -224,13 +224,13 @@ LinearShearTransf2d::getBasicTrialDisp(void)
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-    static double ug[6];
+    static thread_local double ug[6];
     for (int i = 0; i < 3; i++) {
         ug[i]   = disp1(i);
         ug[i+3] = disp2(i);
     }
 
-    static Vector ub(3);
+    static thread_local Vector ub(3);
 
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -270,13 +270,13 @@ LinearShearTransf2d::getBasicTrialDispInt(void)    //LMS
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-    static double ug[6];
+    static thread_local double ug[6];
     for (int i = 0; i < 3; i++) {
         ug[i]   = disp1(i);
         ug[i+3] = disp2(i);
     }
 
-    static Vector ub(6);
+    static thread_local Vector ub(6);
 
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -305,16 +305,16 @@ LinearShearTransf2d::getBasicTrialDispShapeSensitivity(void)
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-    static double ug[6];
+    static thread_local double ug[6];
     for (int i = 0; i < 3; i++) {
         ug[i]   = disp1(i);
         ug[i+3] = disp2(i);
     }
 
-    static Vector ub(3);
+    static thread_local Vector ub(3);
     ub.Zero();
 
-    static ID nodeParameterID(2);
+    static thread_local ID nodeParameterID(2);
     nodeParameterID(0) = nodeIPtr->getCrdsSensitivity();
     nodeParameterID(1) = nodeJPtr->getCrdsSensitivity();
 
@@ -374,13 +374,13 @@ LinearShearTransf2d::getBasicIncrDisp(void)
     const Vector &disp1 = nodeIPtr->getIncrDisp();
     const Vector &disp2 = nodeJPtr->getIncrDisp();
 
-    static double dug[6];
+    static thread_local double dug[6];
     for (int i = 0; i < 3; i++) {
         dug[i]   = disp1(i);
         dug[i+3] = disp2(i);
     }
 
-    static Vector dub(3);
+    static thread_local Vector dub(3);
 
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -419,13 +419,13 @@ LinearShearTransf2d::getBasicIncrDeltaDisp(void)
     const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
     const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
 
-    static double Dug[6];
+    static thread_local double Dug[6];
     for (int i = 0; i < 3; i++) {
         Dug[i]   = disp1(i);
         Dug[i+3] = disp2(i);
     }
 
-    static Vector Dub(3);
+    static thread_local Vector Dub(3);
 
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -461,7 +461,7 @@ const Vector &
 LinearShearTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
     // transform resisting forces from the basic system to local coordinates
-    static double pl[6];
+    static thread_local double pl[6];
 
     double q0 = pb(0);
     double q1 = pb(1);
@@ -483,7 +483,7 @@ LinearShearTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
     pl[4] += p0(2);
 
     // transform resisting forces  from local to global coordinates
-    static Vector pg(6);
+    static thread_local Vector pg(6);
 
     pg(0) = cosTheta*pl[0] - sinTheta*pl[1];
     pg(1) = sinTheta*pl[0] + cosTheta*pl[1];
@@ -517,7 +517,7 @@ const Vector &
 LinearShearTransf2d::getGlobalResistingForceInt(const Vector &pb, const Vector &p0)    //LMS
 {
     // transform resisting forces from the basic system to local coordinates
-    static double pl[6];
+    static thread_local double pl[6];
 
     pl[0] =  pb(0);
     pl[1] =  pb(1);
@@ -528,7 +528,7 @@ LinearShearTransf2d::getGlobalResistingForceInt(const Vector &pb, const Vector &
 
 
     // transform resisting forces  from local to global coordinates
-    static Vector pg(6);
+    static thread_local Vector pg(6);
 
     pg(0) = cosTheta*pl[0] - sinTheta*pl[1];
     pg(1) = sinTheta*pl[0] + cosTheta*pl[1];
@@ -550,7 +550,7 @@ const Vector &
 LinearShearTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb, const Vector &p0)
 {
     // transform resisting forces from the basic system to local coordinates
-    static double pl[6];
+    static thread_local double pl[6];
 
     double q0 = pb(0);
     double q1 = pb(1);
@@ -572,10 +572,10 @@ LinearShearTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb, c
 //    pl[4] += p0(2);
 
     // transform resisting forces  from local to global coordinates
-    static Vector pg(6);
+    static thread_local Vector pg(6);
     pg.Zero();
 
-    static ID nodeParameterID(2);
+    static thread_local ID nodeParameterID(2);
     nodeParameterID(0) = nodeIPtr->getCrdsSensitivity();
     nodeParameterID(1) = nodeJPtr->getCrdsSensitivity();
 
@@ -630,7 +630,7 @@ LinearShearTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb, c
 const Matrix &
 LinearShearTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 {
-    static double tmp [6][6];
+    static thread_local double tmp [6][6];
     
     double oneOverL = 1.0/L;
     
@@ -820,7 +820,7 @@ LinearShearTransf2d::getGlobalStiffMatrixInt(const Matrix &kb, const Vector &pb)
 const Matrix &
 LinearShearTransf2d::getInitialGlobalStiffMatrix(const Matrix &kb)
 {
-  static double tmp [6][6];
+  static thread_local double tmp [6][6];
   
   double oneOverL = 1.0/L;
   
@@ -1044,7 +1044,7 @@ LinearShearTransf2d::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(10);
+  static thread_local Vector data(10);
   data(0) = this->getTag();
   data(1) = L;
   if (nodeIOffset != 0) {
@@ -1079,7 +1079,7 @@ LinearShearTransf2d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &t
 {
   int res = 0;
   
-  static Vector data(10);
+  static thread_local Vector data(10);
   
   res += theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
@@ -1124,7 +1124,7 @@ LinearShearTransf2d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 LinearShearTransf2d::getPointGlobalCoordFromLocal(const Vector &xl)    
 {
-   static Vector xg(2);
+   static thread_local Vector xg(2);
 
    const Vector &nodeICoords = nodeIPtr->getCrds();
    xg(0) = nodeICoords(0);
@@ -1150,7 +1150,7 @@ LinearShearTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
    const Vector &disp1 = nodeIPtr->getTrialDisp();
    const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-   static Vector ug(6);
+   static thread_local Vector ug(6);
    for (int i = 0; i < 3; i++)
    {
       ug(i)   = disp1(i);
@@ -1158,7 +1158,7 @@ LinearShearTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
    }
 
    // transform global end displacements to local coordinates
-   static Vector ul(6);      // total displacements
+   static thread_local Vector ul(6);      // total displacements
 
    ul(0) =  cosTheta*ug(0) + sinTheta*ug(1);
    ul(1) = -sinTheta*ug(0) + cosTheta*ug(1);
@@ -1184,7 +1184,7 @@ LinearShearTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
    }
 
    // compute displacements at point xi, in local coordinates
-   static Vector uxl(2),  uxg(2);
+   static thread_local Vector uxl(2),  uxg(2);
 
    uxl(0) = uxb(0) +        ul(0);
    uxl(1) = uxb(1) + (1-xi)*ul(1) + xi*ul(4);
@@ -1203,7 +1203,7 @@ LinearShearTransf2d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
    const Vector &disp1 = nodeIPtr->getTrialDisp();
    const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-   static Vector ug(6);
+   static thread_local Vector ug(6);
    for (int i = 0; i < 3; i++)
    {
       ug(i)   = disp1(i);
@@ -1211,7 +1211,7 @@ LinearShearTransf2d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
    }
 
    // transform global end displacements to local coordinates
-   static Vector ul(6);      // total displacements
+   static thread_local Vector ul(6);      // total displacements
 
    ul(0) =  cosTheta*ug(0) + sinTheta*ug(1);
    ul(1) = -sinTheta*ug(0) + cosTheta*ug(1);
@@ -1237,7 +1237,7 @@ LinearShearTransf2d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
    }
 
    // compute displacements at point xi, in local coordinates
-   static Vector uxl(2);
+   static thread_local Vector uxl(2);
 
    uxl(0) = uxb(0) +        ul(0);
    uxl(1) = uxb(1) + (1-xi)*ul(1) + xi*ul(4);
@@ -1267,13 +1267,13 @@ LinearShearTransf2d::getBasicDisplSensitivity(int gradNumber)
     // up the nodal displacements we just pick up 
     // the nodal displacement sensitivities. 
 
-    static double ug[6];
+    static thread_local double ug[6];
     for (int i = 0; i < 3; i++) {
         ug[i]   = nodeIPtr->getDispSensitivity((i+1),gradNumber);
         ug[i+3] = nodeJPtr->getDispSensitivity((i+1),gradNumber);
     }
 
-    static Vector ub(3);
+    static thread_local Vector ub(3);
 
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -1312,13 +1312,13 @@ LinearShearTransf2d::getBasicTrialVel(void)
     const Vector &vel1 = nodeIPtr->getTrialVel();
     const Vector &vel2 = nodeJPtr->getTrialVel();
     
-    static double vg[6];
+    static thread_local double vg[6];
     for (int i = 0; i < 3; i++) {
         vg[i]   = vel1(i);
         vg[i+3] = vel2(i);
     }
     
-    static Vector vb(3);
+    static thread_local Vector vb(3);
     
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -1357,13 +1357,13 @@ LinearShearTransf2d::getBasicTrialAccel(void)
     const Vector &accel1 = nodeIPtr->getTrialAccel();
     const Vector &accel2 = nodeJPtr->getTrialAccel();
     
-    static double ag[6];
+    static thread_local double ag[6];
     for (int i = 0; i < 3; i++) {
         ag[i]   = accel1(i);
         ag[i+3] = accel2(i);
     }
     
-    static Vector ab(3);
+    static thread_local Vector ab(3);
     
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -40,9 +40,9 @@
 // global variables
 StandardStream sserr;
 OPS_Stream &opserr = sserr;
-double   ops_Dt =0;                
-Domain  *ops_TheActiveDomain  =0;   
-Element *ops_TheActiveElement =0;  
+thread_local double   ops_Dt =0;                
+thread_local Domain  *ops_TheActiveDomain  =0;   
+thread_local Element *ops_TheActiveElement =0;  
 
 int main(int argc, char **argv)
 {
@@ -0,0 +1,153 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the class implementation for PackedDatastore.
+
+#include <PackedDatastore.h>
+#include <OPS_Globals.h>
+
+#include <stdio.h>
+#include <string.h>
+
+PackedDatastore::PackedDatastore(const char *fileBase, 
+				 Domain &theDomain, 
+				 FEM_ObjectBroker &theBroker)
+  :FE_Datastore(theDomain, theBroker), fileName(0), fileStarted(false)
+{
+  fileName = new char[strlen(fileBase)+6];
+  strcpy(fileName, fileBase);
+  strcat(fileName, ".pack");
+}
+
+
+PackedDatastore::~PackedDatastore()
+{
+  if (fileName != 0)
+    delete [] fileName;
+}
+
+
+int
+PackedDatastore::commitState(int commitTag)
+{
+  theChannel.clear();
+
+  int res = FE_Datastore::commitState(commitTag);
+  if (res < 0)
+    return res;
+
+  // the first commit starts the file afresh, so that commits of an
+  // earlier run with the same fileBase are not restored
+  if (theChannel.writeFile(fileName, fileStarted) < 0) {
+    opserr << "PackedDatastore::commitState - failed to write " << fileName << endln;
+    return -1;
+  }
+  fileStarted = true;
+
+  return res;
+}
+
+
+int
+PackedDatastore::restoreState(int commitTag)
+{
+  if (theChannel.openFile(fileName) < 0) {
+    opserr << "PackedDatastore::restoreState - failed to open " << fileName << endln;
+    return -1;
+  }
+
+  // commits after a restore add to the file it was restored from
+  fileStarted = true;
+
+  return FE_Datastore::restoreState(commitTag);
+}
+
+
+int 
+PackedDatastore::sendMsg(int dataTag, int commitTag, 
+			 const Message &theMessage, 
+			 ChannelAddress *theAddress)
+{
+  return theChannel.sendMsg(dataTag, commitTag, theMessage, theAddress);
+}
+
+int 
+PackedDatastore::recvMsg(int dataTag, int commitTag, 
+			 Message &theMessage, 
+			 ChannelAddress *theAddress)
+{
+  return theChannel.recvMsg(dataTag, commitTag, theMessage, theAddress);
+}
+
+int 
+PackedDatastore::recvMsgUnknownSize(int dataTag, int commitTag, 
+				    Message &theMessage, 
+				    ChannelAddress *theAddress)
+{
+  return theChannel.recvMsgUnknownSize(dataTag, commitTag, theMessage, theAddress);
+}
+
+int 
+PackedDatastore::sendMatrix(int dataTag, int commitTag, 
+			    const Matrix &theMatrix, 
+			    ChannelAddress *theAddress)
+{
+  return theChannel.sendMatrix(dataTag, commitTag, theMatrix, theAddress);
+}
+
+int 
+PackedDatastore::recvMatrix(int dataTag, int commitTag, 
+			    Matrix &theMatrix, 
+			    ChannelAddress *theAddress)
+{
+  return theChannel.recvMatrix(dataTag, commitTag, theMatrix, theAddress);
+}
+
+int 
+PackedDatastore::sendVector(int dataTag, int commitTag, 
+			    const Vector &theVector, 
+			    ChannelAddress *theAddress)
+{
+  return theChannel.sendVector(dataTag, commitTag, theVector, theAddress);
+}
+
+int 
+PackedDatastore::recvVector(int dataTag, int commitTag, 
+			    Vector &theVector, 
+			    ChannelAddress *theAddress)
+{
+  return theChannel.recvVector(dataTag, commitTag, theVector, theAddress);
+}
+
+int 
+PackedDatastore::sendID(int dataTag, int commitTag, 
+			const ID &theID, 
+			ChannelAddress *theAddress)
+{
+  return theChannel.sendID(dataTag, commitTag, theID, theAddress);
+}
+
+int 
+PackedDatastore::recvID(int dataTag, int commitTag, 
+			ID &theID, 
+			ChannelAddress *theAddress)
+{
+  return theChannel.recvID(dataTag, commitTag, theID, theAddress);
+}
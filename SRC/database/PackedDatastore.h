@@ -0,0 +1,88 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the class definition for PackedDatastore.
+// PackedDatastore is a concrete subclass of FE_Datastore. Each commitState()
+// packs the data sent by the domain into one buffer with a PackedChannel,
+// and appends that buffer with a single write to the file fileBase.pack,
+// which the first commit truncates unless the datastore was restored from it;
+// restoreState() maps the file back in and the domain receives its data
+// straight from the mapping. As the objects only send the data that has
+// changed since their last send to the datastore, e.g. the domain its
+// geometry, all the commits are kept in the one file; as in the other
+// datastores, the last data written with a dbTag and commitTag is the
+// data received.
+
+#ifndef PackedDatastore_h
+#define PackedDatastore_h
+
+#include <FE_Datastore.h>
+#include <PackedChannel.h>
+
+class PackedDatastore: public FE_Datastore
+{
+  public:
+    PackedDatastore(const char *fileBase,
+		    Domain &theDomain, 
+		    FEM_ObjectBroker &theBroker);    
+    ~PackedDatastore();
+
+    // methods for sending and receiving the data
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag,
+	       const ID &theID,
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+	       ID &theID,
+	       ChannelAddress *theAddress =0);
+
+    int commitState(int commitTag);        
+    int restoreState(int commitTag);        
+
+  private:
+    char *fileName;
+    bool fileStarted;     // true once this datastore has written or read fileName
+    PackedChannel theChannel;
+};
+
+#endif
@@ -97,7 +97,7 @@ ElementParameter::update(double newValue)
   if (numChannels != 0) {
     // due to stupid design of parameter class (aka addComponnet)
     // we have to always check if eleTags has changed
-    static ID idData(1);
+    static thread_local ID idData(1);
     if (numChannels > 0) {
       idData(0) = eleTags.Size();
       for (int i=0; i<numChannels; i++) {
@@ -149,7 +149,7 @@ ElementStateParameter::setDomain(Domain *theDomain)
 int 
 ElementStateParameter::sendSelf(int commitTag, Channel &theChannel)
 {
-  static ID iData(3);
+  static thread_local ID iData(3);
   iData(0) = flag;
   iData(1) = argc;
   if (theEleIDs != 0)
@@ -159,7 +159,7 @@ ElementStateParameter::sendSelf(int commitTag, Channel &theChannel)
 
   theChannel.sendID(commitTag, 0, iData);
 
-  static Vector dData(1);
+  static thread_local Vector dData(1);
   dData(0) = currentValue;
   theChannel.sendVector(commitTag, 0, dData);
 
@@ -183,14 +183,14 @@ ElementStateParameter::sendSelf(int commitTag, Channel &theChannel)
 int 
 ElementStateParameter::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  static ID iData(3);
+  static thread_local ID iData(3);
   theChannel.recvID(commitTag, 0, iData);
   flag = iData(0);
   argc = iData(1);
   int numEle = iData(2);
 
 
-  static Vector dData(1);
+  static thread_local Vector dData(1);
   theChannel.recvVector(commitTag, 0, dData);
   currentValue = dData(0);
 
@@ -68,7 +68,7 @@ InitialStateParameter::setDomain(Domain *theDomain)
 int 
 InitialStateParameter::sendSelf(int commitTag, Channel &theChannel)
 {
-  static ID theData(2);
+  static thread_local ID theData(2);
   theData[0] = this->getTag();
   theData[1] = flag;
   theChannel.sendID(commitTag, 0, theData);
@@ -81,7 +81,7 @@ InitialStateParameter::recvSelf(int commitTag,
 				Channel &theChannel, 
 				FEM_ObjectBroker &theBroker)
 {
-  static ID theData(2);  
+  static thread_local ID theData(2);  
   theChannel.recvID(commitTag, 0, theData);
 
   this->setTag(theData[0]);
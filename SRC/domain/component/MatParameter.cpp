@@ -96,7 +96,7 @@ MatParameter::setDomain(Domain *theDomain)
 int 
 MatParameter::sendSelf(int commitTag, Channel &theChannel)
 {
-  static ID theData(3);
+  static thread_local ID theData(3);
   theData[0] = this->getTag();
   theData[1] = theMaterialTag;
   if (theParameterName != 0)
@@ -117,7 +117,7 @@ MatParameter::sendSelf(int commitTag, Channel &theChannel)
 int 
 MatParameter::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  static ID theData(3);  
+  static thread_local ID theData(3);  
   theChannel.recvID(commitTag, 0, theData);
   this->setTag(theData[0]);
   theMaterialTag = theData[1];
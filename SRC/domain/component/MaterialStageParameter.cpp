@@ -89,7 +89,7 @@ int
 MaterialStageParameter::sendSelf(int commitTag, Channel &theChannel)
 {
 
-  static ID theData(2);
+  static thread_local ID theData(2);
   theData[0] = this->getTag();
   theData[1] = theMaterialTag;
   theChannel.sendID(commitTag, 0, theData);
@@ -100,7 +100,7 @@ MaterialStageParameter::sendSelf(int commitTag, Channel &theChannel)
 int 
 MaterialStageParameter::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  static ID theData(2);  
+  static thread_local ID theData(2);  
   theChannel.recvID(commitTag, 0, theData);
   this->setTag(theData[0]);
   theMaterialTag = theData[1];
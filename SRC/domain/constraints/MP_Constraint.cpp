@@ -178,7 +178,7 @@ MP_Constraint::getConstraint(void)
 int 
 MP_Constraint::sendSelf(int cTag, Channel &theChannel)
 {
-    static ID data(10);
+    static thread_local ID data(10);
     int dataTag = this->getDbTag();
 
     data(0) = this->getTag(); 
@@ -241,7 +241,7 @@ MP_Constraint::recvSelf(int cTag, Channel &theChannel,
 			FEM_ObjectBroker &theBroker)
 {
     int dataTag = this->getDbTag();
-    static ID data(10);
+    static thread_local ID data(10);
     int result = theChannel.recvID(dataTag, cTag, data);
     if (result < 0) {
 	opserr << "WARNING MP_Constraint::recvSelf - error receiving ID data\n";
@@ -0,0 +1,329 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the implementation of the
+// ContactManager class; see ContactManager.h
+//
+#include <math.h>
+#include <iterator>
+#include <ContactManager.h>
+#include <Domain.h>
+#include <Element.h>
+#include <Node.h>
+#include <Vector.h>
+#include <OPS_Stream.h>
+
+static const uint64_t NO_CELL = ~(uint64_t)0;
+
+ContactManager::ContactManager(int tag, const ID &primary, const ID &secondary,
+                               double gapTolerance, int firstElementTag,
+                               ElementFactory factory)
+  : TaggedObject(tag),
+    primaryNodes(primary), secondaryNodes(secondary),
+    gapTol(gapTolerance), nextTag(firstElementTag),
+    theFactory(factory), theDomain(nullptr), ndm(0),
+    nodeCells(primary.Size(), NO_CELL)
+{
+
+}
+
+ContactManager::~ContactManager()
+{
+  // the contact elements are owned by the Domain
+}
+
+void
+ContactManager::setDomain(Domain *domain)
+{
+  theDomain = domain;
+  theCells.clear();
+  nodeCells.assign(primaryNodes.Size(), NO_CELL);
+  primaryPtrs.assign(primaryNodes.Size(), nullptr);
+  secondaryPtrs.assign(secondaryNodes.Size(), nullptr);
+
+  if (theDomain == nullptr)
+    return;
+
+  for (int i = 0; i < primaryNodes.Size(); i++) {
+    primaryPtrs[i] = theDomain->getNode(primaryNodes(i));
+    if (primaryPtrs[i] == nullptr)
+      opserr << "WARNING ContactManager::setDomain - primary node "
+             << primaryNodes(i) << " does not exist\n";
+  }
+
+  for (int i = 0; i < secondaryNodes.Size(); i++) {
+    secondaryPtrs[i] = theDomain->getNode(secondaryNodes(i));
+    if (secondaryPtrs[i] == nullptr)
+      opserr << "WARNING ContactManager::setDomain - secondary node "
+             << secondaryNodes(i) << " does not exist\n";
+  }
+
+  ndm = 0;
+  for (Node *theNode : primaryPtrs)
+    if (theNode != nullptr) {
+      ndm = theNode->getCrds().Size();
+      break;
+    }
+}
+
+int
+ContactManager::currentPosition(const Node *theNode, double *x) const
+{
+  const Vector &crd = theNode->getCrds();
+  const Vector &disp = const_cast<Node *>(theNode)->getTrialDisp();
+
+  for (int i = 0; i < 3; i++)
+    x[i] = 0.0;
+
+  for (int i = 0; i < ndm && i < crd.Size(); i++)
+    x[i] = crd(i) + (i < disp.Size() ? disp(i) : 0.0);
+
+  return 0;
+}
+
+uint64_t
+ContactManager::cellKey(const double *x) const
+{
+  // 21 bits per coordinate, offset so that negative cells pack cleanly
+  uint64_t key = 0;
+  for (int i = 0; i < 3; i++) {
+    int64_t c = (int64_t)floor(x[i]/gapTol) + (1 << 20);
+    key = (key << 21) | ((uint64_t)c & 0x1FFFFF);
+  }
+  return key;
+}
+
+void
+ContactManager::insertNode(int index, uint64_t key)
+{
+  theCells[key].push_back(index);
+  nodeCells[index] = key;
+}
+
+void
+ContactManager::eraseNode(int index, uint64_t key)
+{
+  auto cell = theCells.find(key);
+  if (cell == theCells.end())
+    return;
+
+  std::vector<int> &nodes = cell->second;
+  for (std::size_t i = 0; i < nodes.size(); i++)
+    if (nodes[i] == index) {
+      nodes[i] = nodes.back();
+      nodes.pop_back();
+      break;
+    }
+
+  if (nodes.empty())
+    theCells.erase(cell);
+}
+
+int
+ContactManager::nearestPrimary(const double *x, double &dist) const
+{
+  int nearest = -1;
+  dist = gapTol;
+
+  // a node within gapTol of x lies in one of the neighbouring cells
+  const int range[3] = {1, ndm > 1 ? 1 : 0, ndm > 2 ? 1 : 0};
+  double y[3];
+
+  for (int i = -range[0]; i <= range[0]; i++)
+    for (int j = -range[1]; j <= range[1]; j++)
+      for (int k = -range[2]; k <= range[2]; k++) {
+        y[0] = x[0] + i*gapTol;
+        y[1] = x[1] + j*gapTol;
+        y[2] = x[2] + k*gapTol;
+
+        auto cell = theCells.find(this->cellKey(y));
+        if (cell == theCells.end())
+          continue;
+
+        for (int index : cell->second) {
+          double z[3];
+          this->currentPosition(primaryPtrs[index], z);
+          double d = sqrt((z[0]-x[0])*(z[0]-x[0]) +
+                          (z[1]-x[1])*(z[1]-x[1]) +
+                          (z[2]-x[2])*(z[2]-x[2]));
+          if (d <= dist) {
+            dist = d;
+            nearest = index;
+          }
+        }
+      }
+
+  return nearest;
+}
+
+int
+ContactManager::setActive(int eleTag, bool active)
+{
+  ID eleTags(1);
+  eleTags(0) = eleTag;
+
+  int res = active ? theDomain->activateElements(eleTags)
+                   : theDomain->deactivateElements(eleTags);
+  if (res != 0) {
+    opserr << "WARNING ContactManager::update - contact element "
+           << eleTag << " is no longer in the domain\n";
+    return -1;
+  }
+  return 0;
+}
+
+int
+ContactManager::releasePair(std::map<Pair, int>::iterator pair)
+{
+  int eleTag = pair->second;
+  idlePairs[pair->first] = eleTag;
+  thePairs.erase(pair);
+
+  // the element keeps its place in the graph
+  return this->setActive(eleTag, false);
+}
+
+int
+ContactManager::update(void)
+{
+  if (theDomain == nullptr) {
+    opserr << "WARNING ContactManager::update - no domain has been set\n";
+    return -1;
+  }
+
+  double x[3], y[3];
+
+  //
+  // move the primary nodes whose cell has changed
+  //
+  for (int i = 0; i < primaryNodes.Size(); i++) {
+    if (primaryPtrs[i] == nullptr)
+      continue;
+
+    this->currentPosition(primaryPtrs[i], x);
+    uint64_t key = this->cellKey(x);
+    if (key == nodeCells[i])
+      continue;
+
+    if (nodeCells[i] != NO_CELL)
+      this->eraseNode(i, nodeCells[i]);
+    this->insertNode(i, key);
+  }
+
+  //
+  // release the pairs whose nodes have separated; pairs that stay
+  // within the tolerance keep their element and its history
+  //
+  std::vector<char> paired(secondaryNodes.Size(), 0);
+
+  for (auto pair = thePairs.begin(); pair != thePairs.end(); ) {
+    auto next = std::next(pair);
+    int p = pair->first.first;
+    int s = pair->first.second;
+
+    this->currentPosition(primaryPtrs[p], x);
+    this->currentPosition(secondaryPtrs[s], y);
+    double d = sqrt((x[0]-y[0])*(x[0]-y[0]) +
+                    (x[1]-y[1])*(x[1]-y[1]) +
+                    (x[2]-y[2])*(x[2]-y[2]));
+
+    if (d > gapTol) {
+      if (this->releasePair(pair) != 0)
+        return -1;
+    } else
+      paired[s] = 1;
+
+    pair = next;
+  }
+
+  //
+  // pair each free secondary node with its nearest primary node
+  //
+  for (int s = 0; s < secondaryNodes.Size(); s++) {
+    if (paired[s] != 0 || secondaryPtrs[s] == nullptr)
+      continue;
+
+    this->currentPosition(secondaryPtrs[s], y);
+    double dist;
+    int p = this->nearestPrimary(y, dist);
+    if (p < 0 || primaryNodes(p) == secondaryNodes(s))
+      continue;
+
+    // a pair that was in contact before gets its element back
+    auto idle = idlePairs.find(Pair(p, s));
+    if (idle != idlePairs.end()) {
+      int eleTag = idle->second;
+      Element *theEle = theDomain->getElement(eleTag);
+      if (theEle == nullptr || this->setActive(eleTag, true) != 0)
+        return -1;
+
+      theEle->revertToStart();
+      idlePairs.erase(idle);
+      thePairs[Pair(p, s)] = eleTag;
+      continue;
+    }
+
+    int eleTag = nextTag++;
+    Element *theEle = theFactory(eleTag, primaryNodes(p), secondaryNodes(s));
+    if (theEle == nullptr) {
+      opserr << "WARNING ContactManager::update - could not create contact element "
+             << eleTag << " between nodes " << primaryNodes(p) << " and "
+             << secondaryNodes(s) << "\n";
+      return -1;
+    }
+
+    if (theDomain->addElement(theEle) == false) {
+      opserr << "WARNING ContactManager::update - could not add contact element "
+             << eleTag << " to the domain\n";
+      delete theEle;
+      return -1;
+    }
+
+    thePairs[Pair(p, s)] = eleTag;
+  }
+
+  return (int)thePairs.size();
+}
+
+void
+ContactManager::getActiveElements(ID &eleTags) const
+{
+  eleTags.resize((int)thePairs.size());
+  int i = 0;
+  for (const auto &pair : thePairs)
+    eleTags(i++) = pair.second;
+}
+
+void
+ContactManager::Print(OPS_Stream &s, int flag)
+{
+  s << "ContactManager: " << this->getTag() << "\n";
+  s << "\tprimary nodes: " << primaryNodes.Size()
+    << ", secondary nodes: " << secondaryNodes.Size() << "\n";
+  s << "\tgap tolerance: " << gapTol << "\n";
+  s << "\tactive pairs: " << (int)thePairs.size()
+    << ", released pairs: " << (int)idlePairs.size() << "\n";
+
+  if (flag == 1)
+    for (const auto &pair : thePairs)
+      s << "\t\t" << primaryNodes(pair.first.first) << " - "
+        << secondaryNodes(pair.first.second) << " : element "
+        << pair.second << "\n";
+}
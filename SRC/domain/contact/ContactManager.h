@@ -0,0 +1,107 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the class definition for
+// ContactManager. A ContactManager detects node-to-node contact
+// between a primary and a secondary node set. The current positions
+// of the primary nodes are kept in a uniform spatial hash whose cell
+// size is the gap tolerance; each secondary node is paired with the
+// nearest primary node within the tolerance and a contact element is
+// created for the pair through a user supplied factory. Pairs whose
+// nodes separate beyond the tolerance are released: their element is
+// deactivated but kept in the Domain, and is reactivated from its
+// initial state when the same two nodes come back into contact.
+//
+// The Domain calls update() after each commit. Only a pair that has
+// never been in contact adds an element, and so a domain change that
+// makes the analysis rebuild the DOF numbering and SOE graph; once the
+// set of pairs settles, contact opening and closing leaves the graph
+// alone. Elements owned by a ContactManager must not be referenced by
+// element recorders.
+//
+#ifndef ContactManager_h
+#define ContactManager_h
+
+#include <map>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+#include <stdint.h>
+#include <TaggedObject.h>
+#include <ID.h>
+
+class Domain;
+class Element;
+class Node;
+
+class ContactManager : public TaggedObject
+{
+  public:
+    // factory(tag, primaryNode, secondaryNode) returns a new contact element
+    typedef std::function<Element *(int, int, int)> ElementFactory;
+
+    ContactManager(int tag, const ID &primaryNodes, const ID &secondaryNodes,
+                   double gapTolerance, int firstElementTag,
+                   ElementFactory factory);
+    virtual ~ContactManager();
+
+    virtual void setDomain(Domain *theDomain);
+
+    // rebuild the spatial hash and update the active pairs; returns
+    // the number of active pairs or a negative value on error
+    virtual int update(void);
+
+    int getNumActivePairs(void) const {return (int)thePairs.size();}
+    void getActiveElements(ID &eleTags) const;
+
+    virtual void Print(OPS_Stream &s, int flag =0);
+
+  private:
+    // (primary, secondary) indices into primaryNodes and secondaryNodes
+    typedef std::pair<int, int> Pair;
+
+    int  currentPosition(const Node *theNode, double *x) const;
+    uint64_t cellKey(const double *x) const;
+    void insertNode(int index, uint64_t key);
+    void eraseNode(int index, uint64_t key);
+    int  nearestPrimary(const double *x, double &dist) const;
+    int  releasePair(std::map<Pair, int>::iterator pair);
+    int  setActive(int eleTag, bool active);
+
+    ID primaryNodes;
+    ID secondaryNodes;
+    double gapTol;
+    int nextTag;
+    ElementFactory theFactory;
+    Domain *theDomain;
+    int ndm;
+
+    // spatial hash over the primary nodes; entries are indices into
+    // primaryNodes, nodeCells holds the current cell of each node
+    std::unordered_map<uint64_t, std::vector<int> > theCells;
+    std::vector<uint64_t> nodeCells;
+    std::vector<Node *> primaryPtrs;
+    std::vector<Node *> secondaryPtrs;
+
+    std::map<Pair, int> thePairs;      // active pairs -> element tag
+    std::map<Pair, int> idlePairs;     // released pairs -> inactive element tag
+};
+
+#endif
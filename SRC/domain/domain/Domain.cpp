@@ -29,6 +29,9 @@
 #include <stdlib.h>
 #include <math.h>
 #include <map>
+#include <set>
+#include <vector>
+#include <algorithm>
 #include <OPS_Globals.h>
 #include <Domain.h>
 #include <DummyStream.h>
@@ -50,6 +53,7 @@
 
 #include <MapOfTaggedObjects.h>
 #include <MapOfTaggedObjectsIter.h>
+#include <SequenceOfTaggedObjects.h>
 
 #include <SingleDomEleIter.h>
 #include <SingleDomNodIter.h>
@@ -68,22 +72,26 @@
 #include <Vertex.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <GraphNumberer.h>
 #include <Recorder.h>
 #include <MeshRegion.h>
+#include <ContactManager.h>
+#include <SpatialIndex.h>
 #include <Analysis.h>
 #include <FE_Datastore.h>
 #include <FEM_ObjectBroker.h>
 
 #include <DomainModalProperties.h>
+#include <NDMaterialBatch.h>
 
 //
 // global variables
 //
 
-Domain       *ops_TheActiveDomain = 0;
-double        ops_Dt = 0.0;
-bool          ops_InitialStateAnalysis = false;
-int           ops_Creep = 0;
+thread_local Domain *ops_TheActiveDomain = 0;
+thread_local double  ops_Dt = 0.0;
+thread_local bool    ops_InitialStateAnalysis = false;
+thread_local int     ops_Creep = 0;
 
 Domain::Domain()
 :theRecorders(0), numRecorders(0),
@@ -92,7 +100,9 @@ Domain::Domain()
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false),  nodeGraphBuiltFlag(false), theNodeGraph(nullptr), 
  theElementGraph(nullptr), 
- theRegions(0), numRegions(0), commitTag(0), 
+ theRegions(0), numRegions(0),
+ theContactManagers(nullptr), numContactManagers(0),
+ theNodeIndex(nullptr), theElementIndex(nullptr), commitTag(0), 
  initBounds(true), resetBounds(false), theBounds(6), 
  theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0), theModalDampingFactors(0), inclModalMatrix(false),
@@ -136,7 +146,9 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(nullptr), 
  theElementGraph(nullptr),
- theRegions(0), numRegions(0), commitTag(0), initBounds(true), resetBounds(false),
+ theRegions(0), numRegions(0),
+ theContactManagers(nullptr), numContactManagers(0),
+ theNodeIndex(nullptr), theElementIndex(nullptr), commitTag(0), initBounds(true), resetBounds(false),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
  theModalDampingFactors(0), inclModalMatrix(false),
@@ -186,7 +198,9 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
  theSPs(&theSPsStorage),
  theMPs(&theMPsStorage), 
  theLoadPatterns(&theLoadPatternsStorage),
- theRegions(nullptr), numRegions(0), commitTag(0),
+ theRegions(nullptr), numRegions(0),
+ theContactManagers(nullptr), numContactManagers(0),
+ theNodeIndex(nullptr), theElementIndex(nullptr), commitTag(0),
  initBounds(true), resetBounds(false),
  theBounds(6), theEigenvalues(nullptr), theEigenvalueSetTime(0), 
  theModalProperties(nullptr), theModalDampingFactors(nullptr), inclModalMatrix(false),
@@ -232,7 +246,9 @@ Domain::Domain(TaggedObjectStorage &theStorage)
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(nullptr), 
  theElementGraph(nullptr), 
- theRegions(0), numRegions(0), commitTag(0),initBounds(true), resetBounds(false),
+ theRegions(0), numRegions(0),
+ theContactManagers(nullptr), numContactManagers(0),
+ theNodeIndex(nullptr), theElementIndex(nullptr), commitTag(0),initBounds(true), resetBounds(false),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
  theModalDampingFactors(0), inclModalMatrix(false),
@@ -339,6 +355,9 @@ Domain::~Domain()
 
   if (theModalDampingFactors != nullptr)
     delete theModalDampingFactors;
+
+  if (theMaterialBatch != nullptr)
+    delete theMaterialBatch;
   
   for (int i=0; i<numRecorders; i++) 
     if (theRecorders[i] != nullptr)
@@ -356,6 +375,14 @@ Domain::~Domain()
     delete [] theRegions;
     theRegions = nullptr;
   }
+
+  for (int i=0; i<numContactManagers; i++)
+    delete theContactManagers[i];
+
+  if (theContactManagers != nullptr) {
+    delete [] theContactManagers;
+    theContactManagers = nullptr;
+  }
   
   theRecorders = nullptr;
   numRecorders = 0;
@@ -396,6 +423,8 @@ Domain::addElement(Element *element)
   if (result == true) {
     element->setDomain(this);
     element->update();
+    if (element->isActive() == false)
+      numInactiveElements++;
 
     // finally check the ele has correct number of dof
 #ifdef _G3DEBUG
@@ -408,6 +437,9 @@ Domain::addElement(Element *element)
 
     // mark the Domain as having been changed
     this->domainChange();
+
+    delete theElementIndex;
+    theElementIndex = nullptr;
   } else 
     opserr << "Domain::addElement - element " << eleTag << "could not be added to container\n";      
 
@@ -433,7 +465,16 @@ Domain::addNode(Node * node)
   bool result = theNodes->addComponent(node);
   if (result == true) {
       node->setDomain(this);
+
+      // keep track of a run of changes that only add nodes
+      int addedStamp = nodesAddedStamp;
+      if (addedStamp < 0 && hasDomainChangedFlag == false)
+	addedStamp = currentGeoTag;
       this->domainChange();
+      nodesAddedStamp = addedStamp;
+
+      delete theNodeIndex;
+      theNodeIndex = nullptr;
 
       if (!resetBounds) {
           // see if the physical bounds are changed
@@ -552,6 +593,80 @@ Domain::addSP_Constraint(SP_Constraint *spConstraint)
   return true;
 }
 
+// int reserve(int numNodes, int numElements);
+//	Method to size the node and element containers ahead of
+//	adding a known number of components.
+//
+int
+Domain::reserve(int numNodes, int numElements)
+{
+  int result = 0;
+  if (numNodes > 0 && theNodes->setSize(theNodes->getNumComponents() + numNodes) < 0)
+    result = -1;
+  if (numElements > 0 && theElements->setSize(theElements->getNumComponents() + numElements) < 0)
+    result = -1;
+  return result;
+}
+
+// int addSP_Constraints(int numSPs, SP_Constraint **);
+//	Method to add a batch of single point constraints. Unlike
+//	addSP_Constraint(SP_Constraint*), the existing constraints are
+//	only traversed once to check for duplicate (node, dof) pairs.
+//	Returns the number of constraints added; those that are not
+//	added are left to the caller.
+//
+int
+Domain::addSP_Constraints(int numSPs, SP_Constraint **spConstraints)
+{
+  // (node, dof) pairs that are already constrained
+  std::set<std::pair<int,int> > constrained;
+  SP_ConstraintIter &theExistingSPs = this->getSPs();
+  SP_Constraint *theExistingSP;
+  while ((theExistingSP = theExistingSPs()) != nullptr)
+    constrained.insert({theExistingSP->getNodeTag(), theExistingSP->getDOF_Number()});
+
+  int numAdded = 0;
+  for (int i=0; i<numSPs; i++) {
+    SP_Constraint *spConstraint = spConstraints[i];
+    int nodeTag = spConstraint->getNodeTag();
+    int dof = spConstraint->getDOF_Number();
+
+    Node *nodePtr = this->getNode(nodeTag);
+    if (nodePtr == nullptr) {
+      opserr << "Domain::addSP_Constraints - cannot add constraint, node with tag " <<
+        nodeTag << " does not exist in model\n";
+      continue;
+    }
+
+    if (nodePtr->getNumberDOF() < dof) {
+      opserr << "Domain::addSP_Constraints - cannot add as node with tag " <<
+        nodeTag << " does not have associated constrained DOF\n";
+      continue;
+    }
+
+    if (constrained.insert({nodeTag, dof}).second == false) {
+      opserr << "Domain::addSP_Constraints - cannot add as node " << nodeTag
+             << " already constrained in dof " << dof+1 << "\n";
+      continue;
+    }
+
+    if (theSPs->addComponent(spConstraint) == false) {
+      opserr << "Domain::addSP_Constraints - cannot add constraint with tag " <<
+        spConstraint->getTag() << " to the container\n";
+      constrained.erase({nodeTag, dof});
+      continue;
+    }
+
+    spConstraint->setDomain(this);
+    numAdded++;
+  }
+
+  if (numAdded > 0)
+    this->domainChange();
+
+  return numAdded;
+}
+
 // void addPressure_Constraint(Pressure_Constraint *);
 //	Method to add a constraint to the model.
 //
@@ -922,6 +1037,12 @@ Domain::clearAll(void) {
   // clean out the containers
   theElements->clearAll();
   theNodes->clearAll();
+  numInactiveElements = 0;
+
+  delete theNodeIndex;
+  theNodeIndex = nullptr;
+  delete theElementIndex;
+  theElementIndex = nullptr;
   theSPs->clearAll();
   thePCs->clearAll();
   theMPs->clearAll();
@@ -950,6 +1071,15 @@ Domain::clearAll(void) {
     theRegions = 0;
   }
 
+  for (i=0; i<numContactManagers; i++)
+    delete theContactManagers[i];
+  numContactManagers = 0;
+
+  if (theContactManagers != 0) {
+    delete [] theContactManagers;
+    theContactManagers = 0;
+  }
+
   // set the time back to 0.0
   currentTime = 0.0;
   committedTime = 0.0;
@@ -968,6 +1098,7 @@ Domain::clearAll(void) {
   
   currentGeoTag = 0;
   lastGeoSendTag = -1;
+  nodesAddedStamp = -1;
   
   // rest the flag to be as initial
   hasDomainChangedFlag = false;
@@ -992,6 +1123,8 @@ Domain::clearAll(void) {
   if (theElementGraph != 0)
     delete theElementGraph;
   theElementGraph = 0;
+
+  materialBatchValid = false;
   
   dbEle =0; dbNod =0; dbSPs =0; dbPCs = 0; dbMPs =0; dbLPs = 0; dbParam = 0;
 }
@@ -1009,10 +1142,15 @@ Domain::removeElement(int tag)
 
   // otherwise mark the domain as having changed
   this->domainChange();
+
+  delete theElementIndex;
+  theElementIndex = nullptr;
   
   // perform a downward cast to an Element (safe as only Element added to
   // this container, 0 the Elements DomainPtr and return the result of the cast  
   Element *result = (Element *)mc;
+  if (result->isActive() == false)
+    numInactiveElements--;
   //  result->setDomain(0);
   return result;
 }
@@ -1032,6 +1170,9 @@ Domain::removeNode(int tag)
 
   // adjust node bounds 
   resetBounds = true;
+
+  delete theNodeIndex;
+  theNodeIndex = nullptr;
   
   // perform a downward cast to a Node (safe as only Node added to
   // this container and return the result of the cast
@@ -1786,6 +1927,7 @@ Domain::setCommitTag(int newTag)
 void
 Domain::setCurrentTime(double newTime)
 {
+    stateEpoch++;
     currentTime = newTime;
     dT = currentTime - committedTime;
 }
@@ -1800,19 +1942,32 @@ Domain::setCommittedTime(double newTime)
 void
 Domain::setCreep(int newCreep)
 {
+  creep = newCreep;
   ops_Creep = newCreep;
 }
 
 int
 Domain::getCreep(void) const
 {
-  return ops_Creep;
+  return creep;
+}
+
+void
+Domain::makeCurrent(void)
+{
+  ops_Dt = dT;
+  ops_Creep = creep;
+  ops_TheActiveDomain = this;
 }
 
 void
 Domain::applyLoad(double timeStep)
 {
 
+    // the element loads and time change, so every element is updated
+    // at least once for the new load level
+    stateEpoch++;
+
     // set the current pseudo time in the domai to be newTime
     currentTime = timeStep;
     dT = currentTime - committedTime;
@@ -1853,7 +2008,28 @@ Domain::applyLoad(double timeStep)
       theSP->applyConstraint(timeStep);
     }
 
-    ops_Dt = dT;
+    this->makeCurrent();
+}
+
+
+void
+Domain::setIncrementalUpdate(bool flag)
+{
+    incrementalUpdate = flag;
+    stateEpoch++;
+}
+
+
+void
+Domain::setMaterialBatch(int numThreads)
+{
+    materialBatchThreads = numThreads > 0 ? numThreads : 0;
+    if (materialBatchThreads == 0 && theMaterialBatch != nullptr) {
+      delete theMaterialBatch;
+      theMaterialBatch = nullptr;
+    }
+    materialBatchValid = false;
+    stateEpoch++;
 }
 
 
@@ -1866,6 +2042,8 @@ Domain::setLoadConstant(void)
     LoadPatternIter &thePatterns = this->getLoadPatterns();
     while((thePattern = thePatterns()) != 0)
       thePattern->setLoadConstant();
+
+    stateEpoch++;
 }
 
 
@@ -1939,6 +2117,8 @@ Domain::record(bool fromAnalysis)
 int
 Domain::commit(void)
 {
+    this->makeCurrent();
+
     // 
     // first invoke commit on all nodes and elements in the domain
     //
@@ -1951,13 +2131,18 @@ Domain::commit(void)
     Element *elePtr;
     ElementIter &theElemIter = this->getElements();    
     while ((elePtr = theElemIter()) != nullptr) {
-      elePtr->commitState();
+      if (elePtr->isActive())
+        elePtr->commitState();
     }
 
     // set the new committed time in the domain
     committedTime = currentTime;
+    stateEpoch++;
     dT = 0.0;
 
+    // update the contact pairs for the next step
+    this->updateContact();
+
     // invoke record on all recorders
     for (int i=0; i<numRecorders; i++)
       if (theRecorders[i] != 0)
@@ -1971,6 +2156,8 @@ Domain::commit(void)
 int
 Domain::revertToLastCommit(void)
 {
+    this->makeCurrent();
+
     // 
     // first invoke revertToLastCommit  on all nodes and elements in the domain
     //
@@ -1999,6 +2186,8 @@ Domain::revertToLastCommit(void)
 int
 Domain::revertToStart(void)
 {
+    this->makeCurrent();
+
     // 
     // first invoke revertToLastCommit  on all nodes and 
     // elements in the domain
@@ -2036,18 +2225,71 @@ int
 Domain::update(void)
 {
   // set the global constants
-  ops_Dt = dT;
-  ops_TheActiveDomain = this;
+  this->makeCurrent();
 
   int ok = 0;
 
+  // collect the material points of the elements that can be updated
+  // as a group; the points are gathered again whenever the elements
+  // may have changed
+  NDMaterialBatch *theBatch = nullptr;
+  if (materialBatchThreads > 0) {
+    if (theMaterialBatch == nullptr)
+      theMaterialBatch = new NDMaterialBatch();
+    if (materialBatchValid == false) {
+      theMaterialBatch->clear();
+      ElementIter &theBatchEles = this->getElements();
+      Element *theEle;
+      while ((theEle = theBatchEles()) != nullptr)
+        if (theEle->isActive())
+          theEle->addMaterialPoints(*theMaterialBatch);
+      materialBatchValid = true;
+    }
+    if (theMaterialBatch->getNumPoints() > 0)
+      theBatch = theMaterialBatch;
+  }
+
   // invoke update on all the ele's
   ElementIter &theEles = this->getElements();
   Element *theEle;
 
-  while ((theEle = theEles()) != nullptr) {
-    ops_TheActiveElement = theEle;
-    ok += theEle->update();
+  if (incrementalUpdate) {
+    // skip the elements whose nodes have not changed since their
+    // last update in the current epoch
+    while ((theEle = theEles()) != nullptr) {
+      if (theEle->isActive() == false)
+        continue;
+
+      unsigned long signature = theEle->getStateSignature(stateEpoch);
+      if (signature != 0 && signature == theEle->getUpdateSignature())
+        continue;
+
+      ops_TheActiveElement = theEle;
+      int res = -1;
+      if (theBatch != nullptr)
+        res = theEle->setMaterialBatchStrains(*theBatch);
+      if (res < 0)
+        res = theEle->update();
+      ok += res;
+      theEle->setUpdateSignature(res == 0 ? signature : 0);
+    }
+
+  } else {
+    while ((theEle = theEles()) != nullptr) {
+      if (theEle->isActive() == false)
+        continue;
+      ops_TheActiveElement = theEle;
+      if (theBatch == nullptr || theEle->setMaterialBatchStrains(*theBatch) < 0)
+        ok += theEle->update();
+    }
+  }
+
+  // the points of elements skipped above keep the strains of their last
+  // update, for which the materials return the same state again
+  if (theBatch != nullptr && theBatch->evaluate(false, materialBatchThreads) < 0) {
+    // the signatures set above cannot be trusted
+    stateEpoch++;
+    ok += -1;
   }
 
   if (ok != 0)
@@ -2070,6 +2312,9 @@ Domain::update(double newTime, double dT)
 int
 Domain::updateParameter(int tag, int value)
 {
+  stateEpoch++;
+  loadStamp++;
+
   // get the object from the container 
   TaggedObject *mc = theParameters->getComponentPtr(tag);
   
@@ -2087,6 +2332,9 @@ Domain::updateParameter(int tag, int value)
 int
 Domain::updateParameter(int tag, double value)
 {
+  stateEpoch++;
+  loadStamp++;
+
   // remove the object from the container    
   TaggedObject *mc = theParameters->getComponentPtr(tag);
   
@@ -2231,12 +2479,24 @@ void
 Domain::setDomainChangeStamp(int newStamp)
 {
     currentGeoTag = newStamp;
+    nodesAddedStamp = -1;
+}
+
+
+bool
+Domain::hasOnlyAddedNodes(int stamp) const
+{
+    return nodesAddedStamp > 0 && stamp >= nodesAddedStamp && stamp <= currentGeoTag;
 }
 
 
 void
 Domain::domainChange(void)
 {
+    nodesAddedStamp = -1;
+    stateEpoch++;
+    materialBatchValid = false;
+    loadStamp++;
     hasDomainChangedFlag = true;
 }
 
@@ -2501,6 +2761,330 @@ Domain::getRegionTags(ID& rtags) const
 
 }
 
+int  
+Domain::addContactManager(ContactManager &theManager)
+{
+    ContactManager **newManagers = new ContactManager *[numContactManagers + 1]; 
+
+    for (int i=0; i<numContactManagers; i++)
+	newManagers[i] = theContactManagers[i];
+    newManagers[numContactManagers] = &theManager;
+    theManager.setDomain(this);
+    if (theContactManagers != 0)
+      delete [] theContactManagers;
+    
+    theContactManagers = newManagers;
+    numContactManagers++;
+    return 0;
+}
+
+ContactManager *
+Domain::getContactManager(int tag)
+{
+    for (int i=0; i<numContactManagers; i++)
+      if (theContactManagers[i]->getTag() == tag)
+	return theContactManagers[i];
+
+    return 0;
+}
+
+int
+Domain::updateContact(void)
+{
+    int result = 0;
+    for (int i=0; i<numContactManagers; i++)
+      if (theContactManagers[i]->update() < 0)
+	result = -1;
+
+    return result;
+}
+
+static void
+toPoint(const Vector &v, double *x)
+{
+    for (int i=0; i<3; i++)
+      x[i] = (i < v.Size()) ? v(i) : 0.0;
+}
+
+static void
+copyTags(const std::vector<int> &tags, ID &result)
+{
+    result.resize((int)tags.size());
+    for (int i=0; i<(int)tags.size(); i++)
+      result(i) = tags[i];
+}
+
+static SpatialIndex *
+buildNodeIndex(Domain &theDomain)
+{
+    SpatialIndex *theIndex = new SpatialIndex();
+
+    double x[3];
+    Node *theNode;
+    NodeIter &theNodes = theDomain.getNodes();
+    while ((theNode = theNodes()) != nullptr) {
+      toPoint(theNode->getCrds(), x);
+      theIndex->add(theNode->getTag(), x);
+    }
+
+    theIndex->build();
+    return theIndex;
+}
+
+int
+Domain::findNodesInBox(const Vector &lo, const Vector &hi, ID &nodeTags)
+{
+    if (theNodeIndex == nullptr)
+      theNodeIndex = buildNodeIndex(*this);
+
+    double blo[3], bhi[3];
+    toPoint(lo, blo);
+    toPoint(hi, bhi);
+
+    std::vector<int> tags;
+    theNodeIndex->findInBox(blo, bhi, tags);
+    copyTags(tags, nodeTags);
+    return nodeTags.Size();
+}
+
+int
+Domain::findNodesInSphere(const Vector &center, double radius, ID &nodeTags)
+{
+    if (theNodeIndex == nullptr)
+      theNodeIndex = buildNodeIndex(*this);
+
+    double c[3];
+    toPoint(center, c);
+
+    std::vector<int> tags;
+    theNodeIndex->findInSphere(c, radius, tags);
+    copyTags(tags, nodeTags);
+    return nodeTags.Size();
+}
+
+int
+Domain::findNearestNode(const Vector &point, double *distance)
+{
+    if (theNodeIndex == nullptr)
+      theNodeIndex = buildNodeIndex(*this);
+
+    double x[3], d;
+    toPoint(point, x);
+
+    int tag = theNodeIndex->findNearest(x, d);
+    if (distance != nullptr)
+      *distance = d;
+    return tag;
+}
+
+int
+Domain::findElementsInBox(const Vector &lo, const Vector &hi, ID &eleTags)
+{
+    if (theElementIndex == nullptr) {
+      theElementIndex = new SpatialIndex();
+
+      // index each element by the center and half extent of the
+      // bounding box of its nodes
+      double x[3], xmin[3], xmax[3], h[3];
+      Element *theEle;
+      ElementIter &theEles = this->getElements();
+      while ((theEle = theEles()) != nullptr) {
+        const ID &nodes = theEle->getExternalNodes();
+        for (int i=0; i<nodes.Size(); i++) {
+          Node *theNode = this->getNode(nodes(i));
+          if (theNode == nullptr)
+            continue;
+          toPoint(theNode->getCrds(), x);
+          for (int j=0; j<3; j++) {
+            xmin[j] = (i == 0 || x[j] < xmin[j]) ? x[j] : xmin[j];
+            xmax[j] = (i == 0 || x[j] > xmax[j]) ? x[j] : xmax[j];
+          }
+        }
+        if (nodes.Size() == 0)
+          continue;
+
+        for (int j=0; j<3; j++) {
+          x[j] = 0.5*(xmin[j] + xmax[j]);
+          h[j] = 0.5*(xmax[j] - xmin[j]);
+        }
+        theElementIndex->add(theEle->getTag(), x, h);
+      }
+      theElementIndex->build();
+    }
+
+    double blo[3], bhi[3];
+    toPoint(lo, blo);
+    toPoint(hi, bhi);
+
+    std::vector<int> tags;
+    theElementIndex->findInBox(blo, bhi, tags);
+    copyTags(tags, eleTags);
+    return eleTags.Size();
+}
+
+static SequenceOfTaggedObjects *
+toSequence(TaggedObjectStorage *&theStorage)
+{
+    SequenceOfTaggedObjects *theSequence = dynamic_cast<SequenceOfTaggedObjects *>(theStorage);
+    if (theSequence != nullptr)
+      return theSequence;
+
+    // move the components over in their current order
+    theSequence = new SequenceOfTaggedObjects();
+    theSequence->setSize(theStorage->getNumComponents());
+    TaggedObjectIter &theObjects = theStorage->getComponents();
+    TaggedObject *theObject;
+    while ((theObject = theObjects()) != nullptr)
+      theSequence->addComponent(theObject);
+
+    theStorage->clearAll(false);
+    delete theStorage;
+    theStorage = theSequence;
+    return theSequence;
+}
+
+int
+Domain::reorder(const ID &eleTags)
+{
+    for (int i=0; i<eleTags.Size(); i++)
+      if (theElements->getComponentPtr(eleTags(i)) == nullptr) {
+        opserr << "Domain::reorder - no element with tag " << eleTags(i) << endln;
+        return -1;
+      }
+
+    SequenceOfTaggedObjects *theEleSequence = toSequence(theElements);
+    SequenceOfTaggedObjects *theNodeSequence = toSequence(theNodes);
+    delete theEleIter;
+    theEleIter = new SingleDomEleIter(theElements);
+    delete theNodIter;
+    theNodIter = new SingleDomNodIter(theNodes);
+
+    if (theEleSequence->reorder(eleTags) < 0)
+      return -1;
+
+    // nodes follow the order in which the elements first reach them
+    std::vector<int> nodeOrder;
+    std::set<int> placed;
+    nodeOrder.reserve(theNodes->getNumComponents());
+    Element *theEle;
+    ElementIter &theEles = this->getElements();
+    while ((theEle = theEles()) != nullptr) {
+      const ID &nodes = theEle->getExternalNodes();
+      for (int i=0; i<nodes.Size(); i++)
+        if (theNodes->getComponentPtr(nodes(i)) != nullptr && placed.insert(nodes(i)).second)
+          nodeOrder.push_back(nodes(i));
+    }
+
+    ID nodeTags;
+    copyTags(nodeOrder, nodeTags);
+    if (theNodeSequence->reorder(nodeTags) < 0)
+      return -1;
+
+    // the analysis must renumber the equations for the new order
+    this->clearElementGraph();
+    this->clearNodeGraph();
+    this->domainChange();
+    return 0;
+}
+
+// spreads the low 21 bits of x so there are two zero bits between each
+static unsigned long long
+spreadBits(unsigned long long x)
+{
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffffULL;
+    x = (x | x << 16) & 0x1f0000ff0000ffULL;
+    x = (x | x << 8)  & 0x100f00f00f00f00fULL;
+    x = (x | x << 4)  & 0x10c30c30c30c30c3ULL;
+    x = (x | x << 2)  & 0x1249249249249249ULL;
+    return x;
+}
+
+int
+Domain::getSpaceFillingOrder(ID &eleTags)
+{
+    // element centroids from the nodal coordinates
+    int numEle = this->getNumElements();
+    std::vector<int> tags;
+    std::vector<double> centroids;
+    tags.reserve(numEle);
+    centroids.reserve(3*numEle);
+
+    double lo[3], hi[3], x[3];
+    for (int j=0; j<3; j++) {
+      lo[j] = 1.0e300;
+      hi[j] = -1.0e300;
+    }
+
+    Element *theEle;
+    ElementIter &theEles = this->getElements();
+    while ((theEle = theEles()) != nullptr) {
+      const ID &nodes = theEle->getExternalNodes();
+      double c[3] = {0.0, 0.0, 0.0};
+      int numFound = 0;
+      for (int i=0; i<nodes.Size(); i++) {
+        Node *theNode = this->getNode(nodes(i));
+        if (theNode == nullptr)
+          continue;
+        toPoint(theNode->getCrds(), x);
+        for (int j=0; j<3; j++)
+          c[j] += x[j];
+        numFound++;
+      }
+      for (int j=0; j<3; j++) {
+        if (numFound != 0)
+          c[j] /= numFound;
+        lo[j] = (c[j] < lo[j]) ? c[j] : lo[j];
+        hi[j] = (c[j] > hi[j]) ? c[j] : hi[j];
+        centroids.push_back(c[j]);
+      }
+      tags.push_back(theEle->getTag());
+    }
+
+    // sort on the Morton (Z-order) key of the centroid in the bounding box
+    int n = (int)tags.size();
+    std::vector<std::pair<unsigned long long, int> > keys(n);
+    for (int i=0; i<n; i++) {
+      unsigned long long key = 0;
+      for (int j=0; j<3; j++) {
+        double range = hi[j] - lo[j];
+        double s = (range > 0.0) ? (centroids[3*i+j] - lo[j])/range : 0.0;
+        key |= spreadBits((unsigned long long)(s*0x1fffff)) << j;
+      }
+      keys[i] = std::make_pair(key, i);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    eleTags.resize(n);
+    for (int i=0; i<n; i++)
+      eleTags(i) = tags[keys[i].second];
+    return 0;
+}
+
+int
+Domain::getGraphOrder(GraphNumberer &theNumberer, ID &eleTags)
+{
+    Graph &theGraph = this->getElementGraph();
+    const ID &theOrder = theNumberer.number(theGraph);
+    int n = theOrder.Size();
+    if (n != this->getNumElements()) {
+      opserr << "Domain::getGraphOrder - the numberer failed to order the element graph\n";
+      return -1;
+    }
+
+    // the numberer returns vertex tags; their references are the element tags
+    eleTags.resize(n);
+    for (int i=0; i<n; i++) {
+      Vertex *theVertex = theGraph.getVertexPtr(theOrder(i));
+      if (theVertex == nullptr) {
+        opserr << "Domain::getGraphOrder - no vertex " << theOrder(i) << " in the element graph\n";
+        return -1;
+      }
+      eleTags(i) = theVertex->getRef();
+    }
+    return 0;
+}
+
 typedef std::map<int, int>    MAP_INT;
 typedef MAP_INT::value_type   MAP_INT_TYPE;
 typedef MAP_INT::iterator     MAP_INT_ITERATOR;
@@ -2786,7 +3370,7 @@ Domain::sendSelf(int cTag, Channel &theChannel)
 
   /*
   if (theChannel.isDatastore() == 1) {
-    static ID theLastSendTag(1);
+    static thread_local ID theLastSendTag(1);
     if (theChannel.recvID(0,0,theLastSendTag) == 0)
       lastGeoSendTag = theLastSendTag(0);
     else
@@ -3009,7 +3593,7 @@ Domain::sendSelf(int cTag, Channel &theChannel)
     lastGeoSendTag = currentGeoTag;
     /*
     if (theChannel.isDatastore() == 1) {
-      static ID theLastSendTag(1);
+      static thread_local ID theLastSendTag(1);
       theLastSendTag(0) = lastGeoSendTag;
       theChannel.sendID(0,0, theLastSendTag);
     }
@@ -3127,7 +3711,7 @@ Domain::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 
   /*
   if (theChannel.isDatastore() == 1) {
-    static ID theLastSendTag(1);
+    static thread_local ID theLastSendTag(1);
     if (theChannel.recvID(0,0,theLastSendTag) == 0)
       lastGeoSendTag = theLastSendTag(0);
   }
@@ -3593,35 +4177,54 @@ Domain::getRecorder(int tag)
 
 
 
-#if 0
-int Domain::activateElements(const ID& elementList)
+//
+// Element birth and death. Switching an element on or off does not
+// change the domain: the element keeps its place in the analysis model
+// and in the graph of the system of equations, so the numbering and the
+// storage of the system, and any symbolic factorization of it, are kept.
+// Only the element contributions are masked.
+//
+int
+Domain::activateElements(const ID &elementList)
 {
-    Element* theElement;
-    for (int i = 0; i < elementList.Size(); ++i)
-    {
-        int eleTag = elementList(i);
-        theElement = this->getElement(eleTag);
-        if (theElement != 0)
-        {
-            theElement->activate();
-        }
+  int res = 0;
+  for (int i = 0; i < elementList.Size(); i++) {
+    Element *theElement = this->getElement(elementList(i));
+    if (theElement == nullptr) {
+      opserr << "Domain::activateElements - no element with tag " << elementList(i) << endln;
+      res = -1;
+      continue;
     }
-    return 0;
+    if (theElement->isActive())
+      continue;
+
+    theElement->activate();
+    numInactiveElements--;
+    stateEpoch++;
+    materialBatchValid = false;
+  }
+  return res;
 }
 
 
-int Domain::deactivateElements(const ID& elementList)
+int
+Domain::deactivateElements(const ID &elementList)
 {
-    Element* theElement;
-    for (int i = 0; i < elementList.Size(); ++i)
-    {
-        int eleTag = elementList(i);
-        theElement = this->getElement(eleTag);
-        if (theElement != 0)
-        {
-            theElement->deactivate();
-        }
+  int res = 0;
+  for (int i = 0; i < elementList.Size(); i++) {
+    Element *theElement = this->getElement(elementList(i));
+    if (theElement == nullptr) {
+      opserr << "Domain::deactivateElements - no element with tag " << elementList(i) << endln;
+      res = -1;
+      continue;
     }
-    return 0;
+    if (theElement->isActive() == false)
+      continue;
+
+    theElement->deactivate();
+    numInactiveElements++;
+    stateEpoch++;
+    materialBatchValid = false;
+  }
+  return res;
 }
-#endif
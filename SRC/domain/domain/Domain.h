@@ -61,6 +61,9 @@ class SingleDomAllSP_Iter;
 class SingleDomParamIter;
 
 class MeshRegion;
+class ContactManager;
+class SpatialIndex;
+class GraphNumberer;
 class Recorder;
 class Graph;
 class NodeGraph;
@@ -69,6 +72,7 @@ class Channel;
 class FEM_ObjectBroker;
 
 class TaggedObjectStorage;
+class NDMaterialBatch;
 
 class DomainModalProperties;
 
@@ -101,6 +105,10 @@ class Domain
     virtual  bool addMP_Constraint(MP_Constraint *); 
     virtual  bool addLoadPattern(LoadPattern *);            
     virtual  bool addParameter(Parameter *);            
+
+    // methods to populate a domain in bulk
+    virtual  int  reserve(int numNodes, int numElements);
+    virtual  int  addSP_Constraints(int numSPs, SP_Constraint **);
     
     // methods to add components to a LoadPattern object
     virtual  bool addSP_Constraint(SP_Constraint *, int loadPatternTag); 
@@ -175,6 +183,30 @@ class Domain
     virtual  void setCommittedTime(double newTime);
     virtual void setCreep(int newCreep);
     virtual  void applyLoad(double pseudoTime);
+
+    // incremental state determination: update() skips elements whose
+    // nodes have not changed since their last update; the epoch changes
+    // whenever every element must be updated again
+    void setIncrementalUpdate(bool flag);
+    bool getIncrementalUpdate(void) const {return incrementalUpdate;}
+    unsigned long getStateEpoch(void) const {return stateEpoch;}
+    void invalidateState(void) {stateEpoch++;}
+
+    // grouped state determination: with numThreads > 0, update() sets the
+    // trial strains of the material points of the elements that support
+    // it in one NDMaterialBatch and evaluates them together on up to
+    // numThreads threads; 0 updates every element on its own
+    void setMaterialBatch(int numThreads);
+
+    // load patterns compile their loads against the nodes and elements
+    // of the domain; the stamp changes whenever those may be stale
+    int getLoadStamp(void) const {return loadStamp;}
+    void invalidateLoads(void) {loadStamp++;}
+
+    // sets the analysis state read by elements and materials through
+    // OPS_Globals.h to this domain, for the calling thread
+    void makeCurrent(void);
+
     virtual  void setLoadConstant(void);
     virtual void  unsetLoadConstant(void);
     virtual  int  initialize(void);    
@@ -208,6 +240,13 @@ class Domain
     virtual void domainChange(void);
     virtual void setDomainChangeStamp(int newStamp);
 
+    // nodes added on their own are recorded so that an analysis can
+    // number them without rebuilding: hasOnlyAddedNodes() is true if
+    // the only changes since hasDomainChanged() returned stamp are the
+    // addition of nodes
+    bool hasOnlyAddedNodes(int stamp) const;
+    int getNodesAddedStamp(void) const {return nodesAddedStamp;}
+
 
     // methods for output
     virtual int  addRecorder(Recorder &theRecorder);    	
@@ -220,6 +259,25 @@ class Domain
     virtual MeshRegion *getRegion(int region);    	
     virtual void getRegionTags(ID& rtags) const;
 
+    virtual int  addContactManager(ContactManager &theManager);
+    virtual ContactManager *getContactManager(int tag);
+    virtual int  updateContact(void);
+
+    // geometric queries on the nodal coordinates and element bounding
+    // boxes; the indices are built on first use and discarded when
+    // nodes or elements are added or removed
+    virtual int  findNodesInBox(const Vector &lo, const Vector &hi, ID &nodeTags);
+    virtual int  findNodesInSphere(const Vector &center, double radius, ID &nodeTags);
+    virtual int  findNearestNode(const Vector &x, double *distance = nullptr);
+    virtual int  findElementsInBox(const Vector &lo, const Vector &hi, ID &eleTags);
+
+    // optional pass after the model is built to visit the elements in
+    // the given order, and the nodes in the order the elements first
+    // use them; the get*Order methods compute orderings to pass in
+    virtual int  reorder(const ID &eleTags);
+    virtual int  getSpaceFillingOrder(ID &eleTags);
+    virtual int  getGraphOrder(GraphNumberer &theNumberer, ID &eleTags);
+
     virtual void Print(OPS_Stream &s, int flag =0);
     virtual void Print(OPS_Stream &s, ID *nodeTags, ID *eleTags, int flag =0);
 
@@ -237,10 +295,11 @@ class Domain
     
     Recorder* getRecorder(int tag);
 
-#if 0
+    // element birth and death without a change of the domain
     virtual int activateElements(const ID& elementList);
     virtual int deactivateElements(const ID& elementList);
-#endif
+    int getNumInactiveElements(void) const {return numInactiveElements;}
+
   protected:    
 
     virtual int buildEleGraph(Graph *theEleGraph);
@@ -250,6 +309,16 @@ class Domain
     int numRecorders;    
 
   private:
+    bool incrementalUpdate = false;
+    unsigned long stateEpoch = 1;
+    int loadStamp = 0;
+    int creep = 0;
+    int numInactiveElements = 0;
+    int nodesAddedStamp = -1;         // stamp since which only nodes were added, -1 if none
+    int materialBatchThreads = 0;
+    NDMaterialBatch *theMaterialBatch = nullptr;
+    bool materialBatchValid = false;  // the batch holds the points of the current elements
+
     double currentTime;               // current pseudo time
     double committedTime;             // the committed pseudo time
     double dT;                        // difference between committed and current time
@@ -285,6 +354,12 @@ class Domain
     MeshRegion **theRegions;
     int numRegions;    
 
+    ContactManager **theContactManagers;
+    int numContactManagers;
+
+    SpatialIndex *theNodeIndex;
+    SpatialIndex *theElementIndex;
+
     int commitTag;
     
     Vector theBounds;
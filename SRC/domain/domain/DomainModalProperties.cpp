@@ -374,7 +374,7 @@ OPS_ADD_RUNTIME_VXV(OPS_DomainModalProperties)
     // modalProperties <-print> <-file $fileName> <-unorm>
 
     // some kudos
-    static bool first_done = false;
+    static thread_local bool first_done = false;
     if (!first_done) {
         opserr << "Using DomainModalProperties - Developed by: Massimo Petracca, Guido Camata, ASDEA Software Technology\n";
         first_done = true;
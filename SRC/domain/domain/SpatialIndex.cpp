@@ -0,0 +1,209 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the implementation of the
+// SpatialIndex class; see SpatialIndex.h
+//
+#include <math.h>
+#include <algorithm>
+#include <SpatialIndex.h>
+
+SpatialIndex::SpatialIndex()
+{
+  this->clear();
+}
+
+void
+SpatialIndex::clear(void)
+{
+  points.clear();
+  splitDim.clear();
+  for (int i = 0; i < 3; i++)
+    maxExtent[i] = 0.0;
+}
+
+void
+SpatialIndex::add(int tag, const double *x, const double *halfExtent)
+{
+  Item item;
+  item.tag = tag;
+  for (int i = 0; i < 3; i++) {
+    item.x[i] = x[i];
+    item.h[i] = (halfExtent != nullptr) ? halfExtent[i] : 0.0;
+    if (item.h[i] > maxExtent[i])
+      maxExtent[i] = item.h[i];
+  }
+  points.push_back(item);
+}
+
+void
+SpatialIndex::build(void)
+{
+  splitDim.assign(points.size(), 0);
+  this->buildRange(0, (int)points.size());
+}
+
+void
+SpatialIndex::buildRange(int lo, int hi)
+{
+  if (hi - lo < 2)
+    return;
+
+  // split along the direction of largest spread
+  double xmin[3], xmax[3];
+  for (int d = 0; d < 3; d++)
+    xmin[d] = xmax[d] = points[lo].x[d];
+  for (int i = lo + 1; i < hi; i++)
+    for (int d = 0; d < 3; d++) {
+      xmin[d] = std::min(xmin[d], points[i].x[d]);
+      xmax[d] = std::max(xmax[d], points[i].x[d]);
+    }
+
+  int dim = 0;
+  for (int d = 1; d < 3; d++)
+    if (xmax[d] - xmin[d] > xmax[dim] - xmin[dim])
+      dim = d;
+
+  int mid = (lo + hi)/2;
+  std::nth_element(points.begin() + lo, points.begin() + mid, points.begin() + hi,
+                   [dim](const Item &a, const Item &b) {return a.x[dim] < b.x[dim];});
+  splitDim[mid] = (char)dim;
+
+  this->buildRange(lo, mid);
+  this->buildRange(mid + 1, hi);
+}
+
+void
+SpatialIndex::boxRange(int lo, int hi, const double *blo, const double *bhi,
+                       std::vector<int> &tags) const
+{
+  if (lo >= hi)
+    return;
+
+  int mid = (lo + hi)/2;
+  const Item &p = points[mid];
+
+  bool inside = true;
+  for (int d = 0; d < 3 && inside; d++)
+    if (p.x[d] + p.h[d] < blo[d] || p.x[d] - p.h[d] > bhi[d])
+      inside = false;
+  if (inside)
+    tags.push_back(p.tag);
+
+  // an item left of the split can reach at most maxExtent past it
+  int dim = splitDim[mid];
+  if (blo[dim] - maxExtent[dim] <= p.x[dim])
+    this->boxRange(lo, mid, blo, bhi, tags);
+  if (bhi[dim] + maxExtent[dim] >= p.x[dim])
+    this->boxRange(mid + 1, hi, blo, bhi, tags);
+}
+
+void
+SpatialIndex::sphereRange(int lo, int hi, const double *c, double r2,
+                          std::vector<int> &tags) const
+{
+  if (lo >= hi)
+    return;
+
+  int mid = (lo + hi)/2;
+  const Item &p = points[mid];
+
+  double d2 = 0.0;
+  for (int d = 0; d < 3; d++)
+    d2 += (p.x[d] - c[d])*(p.x[d] - c[d]);
+  if (d2 <= r2)
+    tags.push_back(p.tag);
+
+  int dim = splitDim[mid];
+  double delta = c[dim] - p.x[dim];
+  if (delta <= 0.0 || delta*delta <= r2)
+    this->sphereRange(lo, mid, c, r2, tags);
+  if (delta >= 0.0 || delta*delta <= r2)
+    this->sphereRange(mid + 1, hi, c, r2, tags);
+}
+
+void
+SpatialIndex::nearestRange(int lo, int hi, const double *x,
+                           int &best, double &best2) const
+{
+  if (lo >= hi)
+    return;
+
+  int mid = (lo + hi)/2;
+  const Item &p = points[mid];
+
+  double d2 = 0.0;
+  for (int d = 0; d < 3; d++)
+    d2 += (p.x[d] - x[d])*(p.x[d] - x[d]);
+  if (d2 < best2 || (d2 == best2 && p.tag < points[best].tag)) {
+    best2 = d2;
+    best = mid;
+  }
+
+  // search the side containing x first
+  int dim = splitDim[mid];
+  double delta = x[dim] - p.x[dim];
+  if (delta < 0.0) {
+    this->nearestRange(lo, mid, x, best, best2);
+    if (delta*delta <= best2)
+      this->nearestRange(mid + 1, hi, x, best, best2);
+  } else {
+    this->nearestRange(mid + 1, hi, x, best, best2);
+    if (delta*delta <= best2)
+      this->nearestRange(lo, mid, x, best, best2);
+  }
+}
+
+int
+SpatialIndex::findInBox(const double *lo, const double *hi, std::vector<int> &tags) const
+{
+  tags.clear();
+  this->boxRange(0, (int)points.size(), lo, hi, tags);
+  std::sort(tags.begin(), tags.end());
+  return (int)tags.size();
+}
+
+int
+SpatialIndex::findInSphere(const double *center, double radius, std::vector<int> &tags) const
+{
+  tags.clear();
+  this->sphereRange(0, (int)points.size(), center, radius*radius, tags);
+  std::sort(tags.begin(), tags.end());
+  return (int)tags.size();
+}
+
+int
+SpatialIndex::findNearest(const double *x, double &distance) const
+{
+  if (points.empty()) {
+    distance = 0.0;
+    return -1;
+  }
+
+  int best = (int)points.size()/2;
+  double best2 = 0.0;
+  for (int d = 0; d < 3; d++)
+    best2 += (points[best].x[d] - x[d])*(points[best].x[d] - x[d]);
+
+  this->nearestRange(0, (int)points.size(), x, best, best2);
+
+  distance = sqrt(best2);
+  return points[best].tag;
+}
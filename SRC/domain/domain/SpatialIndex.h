@@ -0,0 +1,77 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the class definition for
+// SpatialIndex. A SpatialIndex is a static, balanced k-d tree over a
+// set of tagged points in up to three dimensions. Each point may
+// carry a half extent in every direction, so that the index also
+// serves axis aligned boxes (e.g. element bounding boxes); box queries
+// then return every item whose box overlaps the query box.
+//
+// The tree is stored implicitly: build() permutes the points so that
+// the median of every range [lo,hi) sits at (lo+hi)/2. Query results
+// are returned in ascending tag order.
+//
+#ifndef SpatialIndex_h
+#define SpatialIndex_h
+
+#include <vector>
+
+class SpatialIndex
+{
+  public:
+    SpatialIndex();
+
+    void clear(void);
+    void add(int tag, const double *x, const double *halfExtent = nullptr);
+    void build(void);
+
+    int  size(void) const {return (int)points.size();}
+
+    // all items whose (box) overlaps [lo, hi]
+    int  findInBox(const double *lo, const double *hi, std::vector<int> &tags) const;
+
+    // all points within radius of center
+    int  findInSphere(const double *center, double radius, std::vector<int> &tags) const;
+
+    // tag of the point closest to x, or -1 if the index is empty
+    int  findNearest(const double *x, double &distance) const;
+
+  private:
+    struct Item {
+      double x[3];
+      double h[3];
+      int    tag;
+    };
+
+    void buildRange(int lo, int hi);
+    void boxRange(int lo, int hi, const double *blo, const double *bhi,
+                  std::vector<int> &tags) const;
+    void sphereRange(int lo, int hi, const double *c, double r2,
+                     std::vector<int> &tags) const;
+    void nearestRange(int lo, int hi, const double *x,
+                      int &best, double &best2) const;
+
+    std::vector<Item> points;
+    std::vector<char> splitDim;  // split dimension of the node at each mid
+    double maxExtent[3];         // largest half extent in each direction
+};
+
+#endif
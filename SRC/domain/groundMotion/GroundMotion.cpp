@@ -339,8 +339,8 @@ GroundMotion::sendSelf(int commitTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static ID idData(8);
-  static Vector data(2);
+  static thread_local ID idData(8);
+  static thread_local Vector data(2);
   
   if (theAccelSeries != 0) {
     idData(0) = theAccelSeries->getClassTag();
@@ -439,8 +439,8 @@ GroundMotion::recvSelf(int commitTag, Channel &theChannel,
 {
 	  int dbTag = this->getDbTag();
 
-  static ID idData(8);
-  static Vector data(2);
+  static thread_local ID idData(8);
+  static thread_local Vector data(2);
   int res = theChannel.recvID(dbTag, commitTag, idData);
   res += theChannel.recvVector(dbTag, commitTag, data);
   if (res < 0) {
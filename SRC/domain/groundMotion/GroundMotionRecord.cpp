@@ -259,7 +259,7 @@ GroundMotionRecord::sendSelf(int commitTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static ID idData(6);
+  static thread_local ID idData(6);
   
   if (theAccelTimeSeries != 0) {
     idData(0) = theAccelTimeSeries->getClassTag();
@@ -333,7 +333,7 @@ int
 GroundMotionRecord::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
   int dbTag = this->getDbTag();
-  static ID idData(6);
+  static thread_local ID idData(6);
   int res = theChannel.recvID(dbTag, commitTag, idData);
   if (res < 0) {
     opserr << "GroundMotionRecord::recvSelf() - channel failed to send data\n";
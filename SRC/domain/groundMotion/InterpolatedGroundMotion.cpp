@@ -197,7 +197,7 @@ InterpolatedGroundMotion::getDispVelAccel(double time)
   }
 
   data.Zero();
-  static Vector motionData(3);
+  static thread_local Vector motionData(3);
 
   int numMotions = factors->Size();
   for (int i=0; i<numMotions; i++) {
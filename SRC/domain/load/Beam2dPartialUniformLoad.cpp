@@ -30,7 +30,7 @@
 #include <Information.h>
 #include <Parameter.h>
 
-Vector Beam2dPartialUniformLoad::data(6);
+thread_local Vector Beam2dPartialUniformLoad::data(6);
 
 Beam2dPartialUniformLoad::Beam2dPartialUniformLoad(int tag, double wt, double wa,
 						   int theElementTag)
@@ -87,7 +87,7 @@ Beam2dPartialUniformLoad::sendSelf(int commitTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static Vector vectData(8);
+  static thread_local Vector vectData(8);
   vectData(0) = wTrans_a;
   vectData(1) = wTrans_b;  
   vectData(2) = wAxial_a;
@@ -111,7 +111,7 @@ Beam2dPartialUniformLoad::recvSelf(int commitTag, Channel &theChannel,  FEM_Obje
 {
   int dbTag = this->getDbTag();
 
-  static Vector vectData(8);
+  static thread_local Vector vectData(8);
 
   int result = theChannel.recvVector(dbTag, commitTag, vectData);
   if (result < 0) {
@@ -61,7 +61,7 @@ class Beam2dPartialUniformLoad : public ElementalLoad
   double wAxial_b;
   double aOverL;
   double bOverL;
-  static Vector data;
+  static thread_local Vector data;
   
   int parameterID;
 };
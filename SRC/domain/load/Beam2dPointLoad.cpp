@@ -33,7 +33,7 @@
 #include <Information.h>
 #include <Parameter.h>
 
-Vector Beam2dPointLoad::data(3);
+thread_local Vector Beam2dPointLoad::data(3);
 
 Beam2dPointLoad::Beam2dPointLoad(int tag, double Pt, double dist,
 				 int theElementTag, double Pa)
@@ -70,7 +70,7 @@ Beam2dPointLoad::sendSelf(int commitTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static Vector vectData(5);
+  static thread_local Vector vectData(5);
   vectData(0) = Ptrans;
   vectData(1) = Paxial;
   vectData(2) = x;  
@@ -91,7 +91,7 @@ Beam2dPointLoad::recvSelf(int commitTag, Channel &theChannel,  FEM_ObjectBroker
 {
   int dbTag = this->getDbTag();
 
-  static Vector vectData(5);
+  static thread_local Vector vectData(5);
 
   int result = theChannel.recvVector(dbTag, commitTag, vectData);
   if (result < 0) {
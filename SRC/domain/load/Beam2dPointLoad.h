@@ -58,7 +58,7 @@ class Beam2dPointLoad : public ElementalLoad
     double Ptrans;     // magnitude of the transverse load
     double Paxial;     // magnitude of the axial load
     double x;     // relative distance (x/L) along length from end 1 of element
-    static Vector data;
+    static thread_local Vector data;
 
     int parameterID;
 };
@@ -34,7 +34,7 @@
 #include <Information.h>
 #include <Parameter.h>
 
-Vector Beam2dUniformLoad::data(2);
+thread_local Vector Beam2dUniformLoad::data(2);
 
 Beam2dUniformLoad::Beam2dUniformLoad(int tag, double wt, double wa,
 				     int theElementTag)
@@ -71,7 +71,7 @@ Beam2dUniformLoad::sendSelf(int commitTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static Vector vectData(4);
+  static thread_local Vector vectData(4);
   vectData(0) = wTrans;
   vectData(1) = wAxial;
   vectData(2) = eleTag;
@@ -91,7 +91,7 @@ Beam2dUniformLoad::recvSelf(int commitTag, Channel &theChannel,  FEM_ObjectBroke
 {
   int dbTag = this->getDbTag();
 
-  static Vector vectData(4);
+  static thread_local Vector vectData(4);
 
   int result = theChannel.recvVector(dbTag, commitTag, vectData);
   if (result < 0) {
@@ -55,7 +55,7 @@ class Beam2dUniformLoad : public ElementalLoad
   private:
     double wTrans;
     double wAxial;
-    static Vector data;
+    static thread_local Vector data;
 
     int parameterID;
 };
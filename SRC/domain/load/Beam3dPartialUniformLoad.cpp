@@ -30,7 +30,7 @@
 #include <Information.h>
 #include <Parameter.h>
 
-Vector Beam3dPartialUniformLoad::data(5);
+thread_local Vector Beam3dPartialUniformLoad::data(5);
 
 Beam3dPartialUniformLoad::Beam3dPartialUniformLoad(int tag, double wy, double wz, double wa,
 						   double aL, double bL, int theElementTag)
@@ -70,7 +70,7 @@ Beam3dPartialUniformLoad::sendSelf(int commitTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static Vector vectData(7);
+  static thread_local Vector vectData(7);
   vectData(0) = wTransy;
   vectData(1) = wTransz;  
   vectData(2) = wAxial;
@@ -93,7 +93,7 @@ Beam3dPartialUniformLoad::recvSelf(int commitTag, Channel &theChannel,  FEM_Obje
 {
   int dbTag = this->getDbTag();
 
-  static Vector vectData(7);
+  static thread_local Vector vectData(7);
 
   int result = theChannel.recvVector(dbTag, commitTag, vectData);
   if (result < 0) {
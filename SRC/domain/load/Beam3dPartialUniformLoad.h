@@ -58,7 +58,7 @@ class Beam3dPartialUniformLoad : public ElementalLoad
   double wAxial;
   double aOverL;
   double bOverL;
-  static Vector data;
+  static thread_local Vector data;
   
   int parameterID;
 };
@@ -31,7 +31,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 
-Vector Beam3dPointLoad::data(4);
+thread_local Vector Beam3dPointLoad::data(4);
 
 Beam3dPointLoad::Beam3dPointLoad(int tag, double py, double pz, double dist,
 				 int theElementTag, double px)
@@ -69,7 +69,7 @@ Beam3dPointLoad::sendSelf(int commitTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static Vector vectData(6);
+  static thread_local Vector vectData(6);
   vectData(0) = Px;
   vectData(1) = Py;
   vectData(2) = Pz;
@@ -91,7 +91,7 @@ Beam3dPointLoad::recvSelf(int commitTag, Channel &theChannel,  FEM_ObjectBroker
 {
   int dbTag = this->getDbTag();
 
-  static Vector vectData(6);
+  static thread_local Vector vectData(6);
 
   int result = theChannel.recvVector(dbTag, commitTag, vectData);
   if (result < 0) {
@@ -32,7 +32,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 
-Vector Beam3dUniformLoad::data(3);
+thread_local Vector Beam3dUniformLoad::data(3);
 
 Beam3dUniformLoad::Beam3dUniformLoad(int tag, double wY, double wZ, double wX,
 				     int theElementTag)
@@ -70,7 +70,7 @@ Beam3dUniformLoad::sendSelf(int commitTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static Vector vectData(5);
+  static thread_local Vector vectData(5);
   vectData(4) = this->getTag();
   vectData(0) = wx;
   vectData(1) = wy;
@@ -92,7 +92,7 @@ Beam3dUniformLoad::recvSelf(int commitTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static Vector vectData(5);
+  static thread_local Vector vectData(5);
 
   int result = theChannel.recvVector(dbTag, commitTag, vectData);
   if (result < 0) {
@@ -33,7 +33,7 @@
 #include <BrickSelfWeight.h>
 #include <Vector.h>
 
-Vector BrickSelfWeight::data(1);
+thread_local Vector BrickSelfWeight::data(1);
 
 BrickSelfWeight::BrickSelfWeight(int tag, int theElementTag)
   :ElementalLoad(tag, LOAD_TAG_BrickSelfWeight, theElementTag)
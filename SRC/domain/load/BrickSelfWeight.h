@@ -24,7 +24,7 @@ class BrickSelfWeight : public ElementalLoad
   protected:
 	
   private:
-    static Vector data;
+    static thread_local Vector data;
 };
 
 #endif
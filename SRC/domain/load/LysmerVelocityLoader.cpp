@@ -59,7 +59,7 @@ int
 LysmerVelocityLoader::sendSelf(int commitTag, Channel &theChannel)
 {
 	int res = 0;
-    static ID iddata(4);
+    static thread_local ID iddata(4);
     int dataTag = this->getDbTag();
     iddata(0) = this->getTag();
     iddata(1) = dataTag;
@@ -79,7 +79,7 @@ int
 LysmerVelocityLoader::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
     int res = 0;
-    static ID iddata(4);
+    static thread_local ID iddata(4);
     int dataTag = this->getDbTag();
 
     res = theChannel.recvID(dataTag, commitTag, iddata);
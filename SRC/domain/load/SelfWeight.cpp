@@ -30,7 +30,7 @@
 #include <Information.h>
 #include <Parameter.h>
 
-Vector SelfWeight::data(3);
+thread_local Vector SelfWeight::data(3);
 
 SelfWeight::SelfWeight(int tag, double xf, double yf, double zf, int theElementTag)
   : ElementalLoad(tag, LOAD_TAG_SelfWeight, theElementTag),
@@ -64,7 +64,7 @@ SelfWeight::sendSelf(int commitTag, Channel &theChannel)
 {
 	int dbTag = this->getDbTag();
 
-    static Vector vData(5);
+    static thread_local Vector vData(5);
     vData(0) = xFact;
     vData(1) = yFact;
     vData(2) = zFact;
@@ -85,7 +85,7 @@ SelfWeight::recvSelf(int commitTag, Channel &theChannel,  FEM_ObjectBroker &theB
 {
 	int dbTag = this->getDbTag();
 
-    static Vector vData(5);
+    static thread_local Vector vData(5);
 
     int result = theChannel.recvVector(dbTag, commitTag, vData);
     if (result < 0) {
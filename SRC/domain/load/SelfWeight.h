@@ -45,7 +45,7 @@ class SelfWeight : public ElementalLoad
   protected:
 	
   private:
-    static Vector data;
+    static thread_local Vector data;
     double xFact;
     double yFact;
     double zFact;
@@ -56,7 +56,7 @@ int
 SurfaceLoader::sendSelf(int commitTag, Channel &theChannel)
 {
 	int res = 0;
-    static ID iddata(3);
+    static thread_local ID iddata(3);
     int dataTag = this->getDbTag();
     iddata(0) = this->getTag();
     iddata(1) = dataTag;
@@ -75,7 +75,7 @@ int
 SurfaceLoader::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
     int res = 0;
-    static ID iddata(3);
+    static thread_local ID iddata(3);
     int dataTag = this->getDbTag();
 
     res = theChannel.recvID(dataTag, commitTag, iddata);
@@ -39,7 +39,7 @@
 #include <elementAPI.h>
 
 // AddingSensitivity:BEGIN /////////////////////////////////////
-Vector NodalLoad::gradientVector(1);
+thread_local Vector NodalLoad::gradientVector(1);
 // AddingSensitivity:END ///////////////////////////////////////
 
 NodalLoad::NodalLoad(int theClasTag)
@@ -277,6 +277,11 @@ NodalLoad::setParameter(const char **argv, int argc, Parameter &param)
 int
 NodalLoad::updateParameter(int parameterID, Information &info)
 {
+  // load patterns keep a compiled copy of the load
+  Domain *theDomain = this->getDomain();
+  if (theDomain != 0 && parameterID > 0)
+    theDomain->invalidateLoads();
+
   switch (parameterID) {
   case -1:
     return -1;
@@ -47,6 +47,7 @@ class NodalLoad : public Load
 
     virtual void setDomain(Domain *newDomain);
     virtual int getNodeTag(void) const;
+    bool isLoadConstant(void) const {return konstant;}
     virtual void applyLoad(double loadFactor);
     virtual void applyLoadSensitivity(double loadFactor);
     
@@ -77,7 +78,7 @@ class NodalLoad : public Load
     bool  konstant;     // true if load is load factor independent
     // AddingSensitivity:BEGIN /////////////////////////////////////
     int parameterID;
-    static Vector gradientVector;
+    static thread_local Vector gradientVector;
     // AddingSensitivity:END ///////////////////////////////////////
 };
 
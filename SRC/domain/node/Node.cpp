@@ -50,8 +50,8 @@
 
 #include <OPS_Globals.h>
 
-Matrix **Node::theMatrices = 0;
-int Node::numMatrices = 0;
+thread_local Matrix **Node::theMatrices = 0;
+thread_local int Node::numMatrices = 0;
 
 
 // for FEM_Object Broker to use
@@ -540,6 +540,8 @@ Node::setTrialDisp(double value, int dof)
     // perform the assignment .. we don't go through Vector interface
     // as we are sure of size and this way is quicker
     double tDisp = value;
+    if (tDisp != disp[dof])
+        trialRevision++;
     disp[dof+2*numberDOF] = tDisp - disp[dof+numberDOF];
     disp[dof+3*numberDOF] = tDisp - disp[dof];	
     disp[dof] = tDisp;
@@ -569,12 +571,17 @@ Node::setTrialDisp(const Vector &newTrialDisp)
 
     // perform the assignment .. we don't go through Vector interface
     // as we are sure of size and this way is quicker
+    bool changed = false;
     for (int i=0; i<numberDOF; i++) {
         double tDisp = newTrialDisp(i);
+	if (tDisp != disp[i])
+	    changed = true;
 	disp[i+2*numberDOF] = tDisp - disp[i+numberDOF];
 	disp[i+3*numberDOF] = tDisp - disp[i];	
 	disp[i] = tDisp;
     }
+    if (changed)
+        trialRevision++;
 
     return 0;
 }
@@ -599,8 +606,14 @@ Node::setTrialVel(const Vector &newTrialVel)
     }      
     
     // set the trial quantities
-    for (int i=0; i<numberDOF; i++)
+    bool changed = false;
+    for (int i=0; i<numberDOF; i++) {
+	if (vel[i] != newTrialVel(i))
+	    changed = true;
 	vel[i] = newTrialVel(i);
+    }
+    if (changed)
+        trialRevision++;
     return 0;
 }
 
@@ -623,8 +636,14 @@ Node::setTrialAccel(const Vector &newTrialAccel)
     }        
     
     // use vector assignment otherwise        
-    for (int i=0; i<numberDOF; i++)
+    bool changed = false;
+    for (int i=0; i<numberDOF; i++) {
+	if (accel[i] != newTrialAccel(i))
+	    changed = true;
 	accel[i] = newTrialAccel(i);
+    }
+    if (changed)
+        trialRevision++;
 
     return 0;
 }
@@ -650,16 +669,22 @@ Node::incrTrialDisp(const Vector &incrDispl)
 	  disp[i+2*numberDOF] = incrDispI;
 	  disp[i+3*numberDOF] = incrDispI;
 	}
+	trialRevision++;
 	return 0;
     }
 
     // otherwise set trial = incr + trial
+    bool changed = false;
     for (int i = 0; i<numberDOF; i++) {
 	  double incrDispI = incrDispl(i);
+	  if (incrDispI != 0.0)
+	    changed = true;
 	  disp[i] += incrDispI;
 	  disp[i+2*numberDOF] += incrDispI;
 	  disp[i+3*numberDOF] = incrDispI;
     }
+    if (changed)
+        trialRevision++;
 
     return 0;
 }
@@ -683,12 +708,19 @@ Node::incrTrialVel(const Vector &incrVel)
 	for (int i = 0; i<numberDOF; i++)
 	    vel[i] = incrVel(i);
 
+	trialRevision++;
 	return 0;
     }
 
     // otherwise set trial = incr + trial
-    for (int i = 0; i<numberDOF; i++)
+    bool changed = false;
+    for (int i = 0; i<numberDOF; i++) {
+	if (incrVel(i) != 0.0)
+	    changed = true;
 	vel[i] += incrVel(i);    
+    }
+    if (changed)
+        trialRevision++;
 
     return 0;
 }
@@ -712,12 +744,19 @@ Node::incrTrialAccel(const Vector &incrAccel)
 	for (int i = 0; i<numberDOF; i++)
 	    accel[i] = incrAccel(i);
 
+	trialRevision++;
 	return 0;
     }
 
     // otherwise set trial = incr + trial
-    for (int i = 0; i<numberDOF; i++)
+    bool changed = false;
+    for (int i = 0; i<numberDOF; i++) {
+	if (incrAccel(i) != 0.0)
+	    changed = true;
 	accel[i] += incrAccel(i);    
+    }
+    if (changed)
+        trialRevision++;
 
     return 0;
 }
@@ -793,6 +832,18 @@ Node::addInertiaLoadToUnbalance(const Vector &accelG, double fact)
 }
 
 
+int
+Node::getInertiaInfluence(Matrix &MR)
+{
+  if (mass == 0 || R == 0)
+    return 0;
+
+  MR.resize(mass->noRows(), R->noCols());
+  MR.addMatrixProduct(0.0, *mass, *R, -1.0);
+  return 1;
+}
+
+
 
 int
 Node::addInertiaLoadSensitivityToUnbalance(const Vector &accelG, double fact, bool somethingRandomInMotions)
@@ -875,6 +926,8 @@ Node::getUnbalancedLoadIncInertia(void)
 int
 Node::commitState()
 {
+    trialRevision++;
+
     // check disp exists, if does set commit = trial, incr = 0.0
     if (trialDisp != 0) {
       for (int i=0; i<numberDOF; i++) {
@@ -905,6 +958,8 @@ Node::commitState()
 int
 Node::revertToLastCommit()
 {
+    trialRevision++;
+
     // check disp exists, if does set trial = last commit, incr = 0
     if (disp != 0) {
       for (int i=0 ; i<numberDOF; i++) {
@@ -934,6 +989,8 @@ Node::revertToLastCommit()
 int
 Node::revertToStart()
 {
+    trialRevision++;
+
     // check disp exists, if does set all to zero
     if (disp != 0) {
       for (int i=0 ; i<4*numberDOF; i++)
@@ -979,7 +1036,7 @@ Node::revertToStart()
 const Matrix &
 Node::getMass(void) 
 {
-    if (index == -1) {
+    if (this->hasGlobalMatrix() == false) {
 	setGlobalMatrices();
     }
     
@@ -1002,7 +1059,7 @@ Node::setRayleighDampingFactor(double alpham) {
 const Matrix &
 Node::getDamp(void) 
 {
-    if (index == -1) {
+    if (this->hasGlobalMatrix() == false) {
 	setGlobalMatrices();
     }
     
@@ -1022,7 +1079,7 @@ Node::getDamp(void)
 const Matrix &
 Node::getDampSensitivity(void) 
 {
-    if (index == -1) {
+    if (this->hasGlobalMatrix() == false) {
 	setGlobalMatrices();
     }
     
@@ -1049,6 +1106,11 @@ Node::setMass(const Matrix &newMass)
 	return -1;
     }	
 
+    // the inertia loads compiled by load patterns depend on the mass
+    Domain *theDomain = this->getDomain();
+    if (theDomain != nullptr)
+      theDomain->invalidateLoads();
+
     // create a matrix if no mass yet set
     if (mass == 0) {
 	mass = new Matrix(newMass);
@@ -1569,7 +1631,7 @@ Node::createAccel(void)
 Matrix
 Node::getMassSensitivity(void)
 {
-  if (index == -1)
+  if (this->hasGlobalMatrix() == false)
       setGlobalMatrices();
 
   if (mass == 0) {
@@ -1912,11 +1974,14 @@ Node::getResponse(NodeData responseType)
 void
 Node::setCrds(double Crd1)
 {
+  trialRevision++;
+
   if (Crd != 0 && Crd->Size() >= 1)
     (*Crd)(0) = Crd1;
 
   // Need to "setDomain" to make the change take effect. 
   Domain *theDomain = this->getDomain();
+  theDomain->invalidateLoads();
   ElementIter &theElements = theDomain->getElements();
   Element *theElement;
   while ((theElement = theElements()) != nullptr)
@@ -1927,12 +1992,15 @@ Node::setCrds(double Crd1)
 void
 Node::setCrds(double Crd1, double Crd2)
 {
+  trialRevision++;
+
   if (Crd != 0 && Crd->Size() >= 2) {
     (*Crd)(0) = Crd1;
     (*Crd)(1) = Crd2;
 
     // Need to "setDomain" to make the change take effect. 
     Domain *theDomain = this->getDomain();
+    theDomain->invalidateLoads();
     ElementIter &theElements = theDomain->getElements();
     Element *theElement;
     while ((theElement = theElements()) != nullptr)
@@ -1943,6 +2011,8 @@ Node::setCrds(double Crd1, double Crd2)
 void
 Node::setCrds(double Crd1, double Crd2, double Crd3)
 {
+  trialRevision++;
+
   if (Crd != 0 && Crd->Size() >= 3) {
     (*Crd)(0) = Crd1;
     (*Crd)(1) = Crd2;
@@ -1950,6 +2020,7 @@ Node::setCrds(double Crd1, double Crd2, double Crd3)
 
     // Need to "setDomain" to make the change take effect. 
     Domain *theDomain = this->getDomain();
+    theDomain->invalidateLoads();
     ElementIter &theElements = theDomain->getElements();
     Element *theElement;
     while ((theElement = theElements()) != nullptr)
@@ -1960,9 +2031,14 @@ Node::setCrds(double Crd1, double Crd2, double Crd3)
 void
 Node::setCrds(const Vector &newCrds) 
 {
+  trialRevision++;
+
   if (Crd != 0 && Crd->Size() == newCrds.Size()) {
     (*Crd) = newCrds;
 
+    if (this->getDomain() != nullptr)
+      this->getDomain()->invalidateLoads();
+
 	return;
 
     // Need to "setDomain" to make the change take effect. 
@@ -2084,10 +2160,22 @@ Node::setNodalThermalActionPtr(NodalThermalAction* theAction)
 }
 //Add Pointer to NodalThermalAction id applicable-----end------L.Jiang, {SIF]
 
+// 
+// The matrices are shared by the nodes of a thread; an index found on
+// another thread, e.g. when a model is built on one and analyzed on
+// another, is found again on this thread.
+//
+bool
+Node::hasGlobalMatrix(void) const
+{
+    return index >= 0 && index < numMatrices && theMatrices[index]->noRows() == numberDOF;
+}
+
 int
 Node::setGlobalMatrices()
 {
-    if (index == -1) {
+    if (this->hasGlobalMatrix() == false) {
+	index = -1;
 	for (int i=0; i<numMatrices; i++) {
 	    if (theMatrices[i]->noRows() == numberDOF) {
 		index = i;
@@ -116,6 +116,10 @@ class Node :
     VIRTUAL int incrTrialVel(const Vector &);
     VIRTUAL int incrTrialAccel(const Vector &);
 
+    // counts the changes to the trial response; Domain::update() uses it
+    // to skip elements whose nodes did not move
+    unsigned long getTrialRevision(void) const {return trialRevision;}
+
     // Thermodynamics
     virtual NodalThermalAction* getNodalThermalActionPtr(void);
     virtual void setNodalThermalActionPtr(NodalThermalAction* theAction);
@@ -148,6 +152,9 @@ class Node :
     VIRTUAL void zeroUnbalancedLoad(void);
     VIRTUAL int addUnbalancedLoad(const Vector &load, double fact = 1.0);
     VIRTUAL int addInertiaLoadToUnbalance(const Vector &accel, double fact = 1.0);
+    // -M*R, the inertia load per unit ground acceleration; returns 0
+    // when the node has no mass or no R
+    int getInertiaInfluence(Matrix &MR);
     VIRTUAL const Vector &getUnbalancedLoad(void);
     VIRTUAL const Vector &getUnbalancedLoadIncInertia(void);
 
@@ -203,10 +210,11 @@ class Node :
 
     // Private global state
     int setGlobalMatrices();
-    static Matrix **theMatrices;
-    static int numMatrices;
-    static Matrix **theVectors;
-    static int numVectors;
+    bool hasGlobalMatrix(void) const;
+    static thread_local Matrix **theMatrices;
+    static thread_local int numMatrices;
+    static thread_local Matrix **theVectors;
+    static thread_local int numVectors;
     int index;
 
 
@@ -218,6 +226,7 @@ class Node :
 
     // private data associated with each node object
     int numberDOF;                    // number of dof at Node
+    unsigned long trialRevision = 0;  // see getTrialRevision()
     DOF_Group *theDOF_GroupPtr;       // pointer to associated DOF_Group
     Vector *Crd;                      // original nodal coords
     Vector *commitDisp, *commitVel, *commitAccel;  // committed quantities
@@ -44,7 +44,8 @@
 #include <stdlib.h>
 
 EarthquakePattern::EarthquakePattern(int tag, int _classTag)
-  :LoadPattern(tag, _classTag), theMotions(0), numMotions(0), uDotG(0), uDotDotG(0), currentTime(0.0), parameterID(0)
+  :LoadPattern(tag, _classTag), theMotions(0), numMotions(0), uDotG(0), uDotDotG(0), currentTime(0.0), parameterID(0),
+   compiledLoadStamp(-1)
 {
 
 }
@@ -91,16 +92,68 @@ EarthquakePattern::applyLoad(double time)
     (*uDotDotG)(i) = theMotions[i]->getAccel(currentTime);
   }
 
+  if (compiledLoadStamp != theDomain->getLoadStamp())
+    this->compileInertia(theDomain);
+
+  for (Influence &influence : influences) {
+    influence.load.addMatrixVector(0.0, influence.MR, *uDotDotG, 1.0);
+    influence.node->addUnbalancedLoad(influence.load, 1.0);
+  }
+
+  for (Node *theNode : otherNodes)
+    theNode->addInertiaLoadToUnbalance(*uDotDotG, 1.0);
+
+  for (Element *theElement : elements)
+    theElement->addInertiaLoadToUnbalance(*uDotDotG);
+}
+
+void
+EarthquakePattern::setDomain(Domain *theDomain)
+{
+  this->LoadPattern::setDomain(theDomain);
+  compiledLoadStamp = -1;
+}
+
+void
+EarthquakePattern::compileInertia(Domain *theDomain)
+{
+  influences.clear();
+  otherNodes.clear();
+  elements.clear();
+
   NodeIter &theNodes = theDomain->getNodes();
   Node *theNode;
-  while ((theNode = theNodes()) != 0) 
-    theNode->addInertiaLoadToUnbalance(*uDotDotG, 1.0);
-  
+  while ((theNode = theNodes()) != 0) {
+    Influence influence;
+    if (theNode->getInertiaInfluence(influence.MR) == 0)
+      continue;
+
+    // a node whose R does not match the motions reports the error itself
+    if (influence.MR.noCols() != numMotions) {
+      otherNodes.push_back(theNode);
+      continue;
+    }
+
+    // nodes without mass in the direction of the motion carry no load
+    bool zero = true;
+    for (int i = 0; i < influence.MR.noRows() && zero; i++)
+      for (int j = 0; j < numMotions && zero; j++)
+        if (influence.MR(i,j) != 0.0)
+          zero = false;
+    if (zero)
+      continue;
+
+    influence.node = theNode;
+    influence.load.resize(influence.MR.noRows());
+    influences.push_back(influence);
+  }
 
   ElementIter &theElements = theDomain->getElements();
   Element *theElement;
   while ((theElement = theElements()) != 0) 
-    theElement->addInertiaLoadToUnbalance(*uDotDotG);
+    elements.push_back(theElement);
+
+  compiledLoadStamp = theDomain->getLoadStamp();
 }
     
 void 
@@ -35,9 +35,13 @@
 // EarthquakePattern is an abstract class.
 
 #include <LoadPattern.h>
+#include <Matrix.h>
+#include <vector>
 
 class GroundMotion;
 class Vector;
+class Node;
+class Element;
 
 class EarthquakePattern : public LoadPattern
 {
@@ -45,6 +49,7 @@ class EarthquakePattern : public LoadPattern
     EarthquakePattern(int tag, int classTag);
     virtual ~EarthquakePattern();
 
+    virtual void setDomain(Domain *theDomain);
     virtual void applyLoad(double time);
     virtual bool addSP_Constraint(SP_Constraint *);
     virtual bool addNodalLoad(NodalLoad *);
@@ -75,6 +80,20 @@ class EarthquakePattern : public LoadPattern
     Vector *uDotG, *uDotDotG;
     double currentTime;
 
+    // the inertia load of a node per unit ground acceleration, -M*R; it
+    // is formed from the R last set on the node and rebuilt with the
+    // load stamp of the domain
+    struct Influence {
+      Node  *node;
+      Matrix MR;
+      Vector load;
+    };
+    void compileInertia(Domain *theDomain);
+    std::vector<Influence> influences;
+    std::vector<Node *>    otherNodes;
+    std::vector<Element *> elements;
+    int compiledLoadStamp;
+
 // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
 // AddingSensitivity:END ///////////////////////////////////////////
@@ -26,6 +26,7 @@
 //
 #include <string.h>
 #include <string>
+#include <map>
 #include <stdlib.h>
 
 #include <LoadPattern.h>
@@ -33,6 +34,9 @@
 #include <ID.h>
 #include <TimeSeries.h>
 #include <NodalLoad.h>
+#include <Node.h>
+#include <Domain.h>
+#include <classTags.h>
 #include <ElementalLoad.h>
 #include <SP_Constraint.h>
 #include <MapOfTaggedObjects.h>
@@ -104,7 +108,8 @@ LoadPattern::LoadPattern(int tag, int clasTag, double fact)
     : TaggedObject(tag), MovableObject(clasTag), isConstant(1), loadFactor(0),
       scaleFactor(fact), theSeries(0), currentGeoTag(0), lastGeoSendTag(-1),
       theNodalLoads(0), theElementalLoads(0), theSPs(0), theNodIter(0),
-      theEleIter(0), theSpIter(0), lastChannel(0)
+      theEleIter(0), theSpIter(0), lastChannel(0), theDomain(0),
+      compiledGeoTag(-1), compiledLoadStamp(-1)
 {
   // constructor for subclass
   theNodalLoads     = new MapOfTaggedObjects();
@@ -140,7 +145,7 @@ LoadPattern::LoadPattern()
     loadFactor(0), scaleFactor(1.0), theSeries(0), currentGeoTag(0),
     lastGeoSendTag(-1), dbSPs(0), dbNod(0), dbEle(0), theNodalLoads(0),
     theElementalLoads(0), theSPs(0), theNodIter(0), theEleIter(0), theSpIter(0),
-    lastChannel(0)
+    lastChannel(0), theDomain(0), compiledGeoTag(-1), compiledLoadStamp(-1)
 {
   theNodalLoads     = new MapOfTaggedObjects();
   theElementalLoads = new MapOfTaggedObjects();
@@ -175,7 +180,7 @@ LoadPattern::LoadPattern(int tag, double fact)
     loadFactor(0.), scaleFactor(fact), theSeries(0), currentGeoTag(0),
     lastGeoSendTag(-1), dbSPs(0), dbNod(0), dbEle(0), theNodalLoads(0),
     theElementalLoads(0), theSPs(0), theNodIter(0), theEleIter(0), theSpIter(0),
-    lastChannel(0)
+    lastChannel(0), theDomain(0), compiledGeoTag(-1), compiledLoadStamp(-1)
 {
   theNodalLoads     = new MapOfTaggedObjects();
   theElementalLoads = new MapOfTaggedObjects();
@@ -270,6 +275,7 @@ void LoadPattern::setDomain(Domain *theDomain)
 #else
   this->theDomain = theDomain;
 #endif
+  compiledGeoTag = -1;
 }
 
 bool LoadPattern::addNodalLoad(NodalLoad *load)
@@ -394,21 +400,95 @@ void LoadPattern::applyLoad(double pseudoTime)
     loadFactor *= scaleFactor;
   }
 
+  if (theDomain == 0) {
+    NodalLoad *nodLoad;
+    NodalLoadIter &theNodalIter = this->getNodalLoads();
+    while ((nodLoad = theNodalIter()) != 0)
+      nodLoad->applyLoad(loadFactor);
+
+    ElementalLoad *eleLoad;
+    ElementalLoadIter &theElementalIter = this->getElementalLoads();
+    while ((eleLoad = theElementalIter()) != 0)
+      eleLoad->applyLoad(loadFactor);
+
+    SP_Constraint *sp;
+    SP_ConstraintIter &theIter = this->getSPs();
+    while ((sp = theIter()) != 0)
+      sp->applyConstraint(loadFactor);
+    return;
+  }
+
+  if (compiledGeoTag != currentGeoTag || compiledLoadStamp != theDomain->getLoadStamp())
+    this->compileLoads();
+
+  for (CompiledLoad &nodLoad : compiledNodalLoads)
+    nodLoad.node->addUnbalancedLoad(nodLoad.load, nodLoad.constant ? 1.0 : loadFactor);
+
+  for (NodalLoad *nodLoad : otherNodalLoads)
+    nodLoad->applyLoad(loadFactor);
+
+  for (ElementalLoad *eleLoad : compiledEleLoads)
+    eleLoad->applyLoad(loadFactor);
+
+  for (SP_Constraint *sp : compiledSPs)
+    sp->applyConstraint(loadFactor);
+}
+
+void LoadPattern::compileLoads(void)
+{
+  compiledNodalLoads.clear();
+  otherNodalLoads.clear();
+  compiledEleLoads.clear();
+  compiledSPs.clear();
+
+  // index of the compiled load of each node, for loads that vary and
+  // for loads that are constant
+  std::map<Node *, int> location[2];
+
   NodalLoad *nodLoad;
   NodalLoadIter &theNodalIter = this->getNodalLoads();
+  while ((nodLoad = theNodalIter()) != 0) {
+    Node *theNode = 0;
+    if (nodLoad->getClassTag() == LOAD_TAG_NodalLoad)
+      theNode = theDomain->getNode(nodLoad->getNodeTag());
+
+    int type;
+    const Vector &load = nodLoad->getData(type);
+
+    // anything that cannot be summed is applied by the load itself, so
+    // that it also reports its own errors
+    if (theNode == 0 || load.Size() != theNode->getNumberDOF()) {
+      otherNodalLoads.push_back(nodLoad);
+      continue;
+    }
 
-  while ((nodLoad = theNodalIter()) != 0)
-    nodLoad->applyLoad(loadFactor);
+    bool constant = nodLoad->isLoadConstant();
+    auto found = location[constant].find(theNode);
+    if (found != location[constant].end()) {
+      compiledNodalLoads[found->second].load += load;
+      continue;
+    }
+
+    location[constant][theNode] = (int)compiledNodalLoads.size();
+    CompiledLoad compiled;
+    compiled.node = theNode;
+    compiled.load = load;
+    compiled.constant = constant;
+    compiledNodalLoads.push_back(compiled);
+  }
 
   ElementalLoad *eleLoad;
   ElementalLoadIter &theElementalIter = this->getElementalLoads();
   while ((eleLoad = theElementalIter()) != 0)
-    eleLoad->applyLoad(loadFactor);
+    compiledEleLoads.push_back(eleLoad);
 
   SP_Constraint *sp;
   SP_ConstraintIter &theIter = this->getSPs();
   while ((sp = theIter()) != 0)
-    sp->applyConstraint(loadFactor);
+    compiledSPs.push_back(sp);
+
+  compiledGeoTag = currentGeoTag;
+  compiledLoadStamp = theDomain->getLoadStamp();
 }
 
 void LoadPattern::setLoadConstant(void) { isConstant = 0; }
@@ -495,7 +575,7 @@ int LoadPattern::sendSelf(int cTag, Channel &theChannel)
 
   /*
   if (theChannel.isDatastore() == 1) {
-    static ID theLastSendTag(1);
+    static thread_local ID theLastSendTag(1);
     if (theChannel.recvID(myDbTag,0,theLastSendTag) == 0)
       lastGeoSendTag = theLastSendTag(0);
     else
@@ -612,7 +692,7 @@ int LoadPattern::sendSelf(int cTag, Channel &theChannel)
     // set the lst send db tag so we don't have to do all that again
     lastGeoSendTag = currentGeoTag;
     if (theChannel.isDatastore() == 1) {
-      static ID theLastSendTag(1);
+      static thread_local ID theLastSendTag(1);
       theLastSendTag(0) = lastGeoSendTag;
       theChannel.sendID(myDbTag, 0, theLastSendTag);
     }
@@ -707,7 +787,7 @@ int LoadPattern::recvSelf(int cTag, Channel &theChannel,
 
   /*
   if (theChannel.isDatastore() == 1) {
-    static ID theLastSendTag(1);
+    static thread_local ID theLastSendTag(1);
     if (theChannel.recvID(myDbTag,0,theLastSendTag) == 0)
       lastGeoSendTag = theLastSendTag(0);
   }
@@ -42,7 +42,9 @@
 #include <TaggedObject.h>
 #include <MovableObject.h>
 #include <Vector.h>
+#include <vector>
 
+class Node;
 class NodalLoad;
 class TimeSeries;
 class ElementalLoad;
@@ -151,6 +153,24 @@ class LoadPattern :
     int lastChannel; 
 
     Domain* theDomain;
+
+    // The loads as applied by applyLoad(). The reference loads of the
+    // plain NodalLoads are summed per node, separately for the loads that
+    // are constant; the other loads are kept in a list. The lists are
+    // rebuilt when the loads of the pattern or the load stamp of the
+    // domain change.
+    struct CompiledLoad {
+      Node  *node;
+      Vector load;
+      bool   constant;
+    };
+    void compileLoads(void);
+    std::vector<CompiledLoad>    compiledNodalLoads;
+    std::vector<NodalLoad *>     otherNodalLoads;
+    std::vector<ElementalLoad *> compiledEleLoads;
+    std::vector<SP_Constraint *> compiledSPs;
+    int compiledGeoTag;
+    int compiledLoadStamp;
 };
 
 #endif
@@ -187,7 +187,7 @@ MultiSupportPattern::sendSelf(int commitTag, Channel &theChannel)
     return -1;
   }
 
-  static ID myData(3);
+  static thread_local ID myData(3);
   myData(0) = numMotions;
   if (dbMotions == 0)
     dbMotions = theChannel.getDbTag();
@@ -264,7 +264,7 @@ MultiSupportPattern::recvSelf(int commitTag, Channel &theChannel,
   // now we rebuild the motions
   //
 
-  static ID myData(3);
+  static thread_local ID myData(3);
   if (theChannel.recvID(myDbTag, commitTag, myData) < 0) {
     opserr << "MultiSupportPattern::sendSelf - channel failed to send the initial ID\n";
     return -1;
@@ -242,7 +242,7 @@ UniformExcitation::activateParameter(int pparameterID)
 void
 UniformExcitation::setDomain(Domain *theDomain) 
 {
-  this->LoadPattern::setDomain(theDomain);
+  this->EarthquakePattern::setDomain(theDomain);
 
   // now we go through and set all the node velocities to be vel0 
   // for those nodes not fixed in the dirn!
@@ -371,7 +371,7 @@ UniformExcitation::sendSelf(int commitTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static Vector data(6);
+  static thread_local Vector data(6);
   data(0) = this->getTag();
   data(1) = theDof;
   data(2) = vel0;
@@ -407,7 +407,7 @@ UniformExcitation::recvSelf(int commitTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static Vector data(6);
+  static thread_local Vector data(6);
   int res = theChannel.recvVector(dbTag, commitTag, data);
   if (res < 0) {
     opserr << "UniformExcitation::recvSelf() - channel failed to recv data\n";
@@ -106,7 +106,7 @@ int DRMLoadPatternWrapper::sendSelf(int commitTag, Channel& theChannel)
 {
   int dbTag = this->getDbTag();
   
-  static ID i_Data(22);
+  static thread_local ID i_Data(22);
   
   i_Data(0) = this->getTag();
   i_Data(1) = this->fileData_size;
@@ -123,7 +123,7 @@ int DRMLoadPatternWrapper::sendSelf(int commitTag, Channel& theChannel)
     return -1;
   }
 
-  static Vector d_Data(11);
+  static thread_local Vector d_Data(11);
   
   d_Data(0) = this->dt;
   for (int i=0; i<6; i++)
@@ -172,7 +172,7 @@ int DRMLoadPatternWrapper::recvSelf(int commitTag, Channel& theChannel, FEM_Obje
 
   int dbTag = this->getDbTag();
   
-  static ID i_Data(22);
+  static thread_local ID i_Data(22);
   if (theChannel.recvID(dbTag, commitTag, i_Data) < 0) {
     opserr << "DRMLoadPatternWrapper::recvSelf L.176 failed to recvID \n";
     return -1;
@@ -195,7 +195,7 @@ int DRMLoadPatternWrapper::recvSelf(int commitTag, Channel& theChannel, FEM_Obje
   this->myPattern = 0;
   this->initialized = false;
   
-  static Vector d_Data(11);
+  static thread_local Vector d_Data(11);
   
   if (theChannel.recvVector(dbTag, commitTag, d_Data) < 0) {
     opserr << "DRMLoadPatternWrapper::recvSelf L.200 failed to recvVector \n";
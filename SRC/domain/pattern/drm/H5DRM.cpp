@@ -45,6 +45,8 @@
 
 
 #include <limits>   //For std::numeric_limits<double>::epsilon()
+#include <thread>
+#include <string.h>
 
 #include <Node.h>
 #include <NodeIter.h>
@@ -95,14 +97,42 @@ OPS_ADD_RUNTIME_VPV(OPS_H5DRM)
     OPS_GetDoubleInput(&num, &factor);
 
     double crd_scale = 1.0;
+    int window_size = H5DRM_NUM_OF_PRECOMPUTED_TIMESTEPS;
+    int number_of_threads = 1;
 
-    if (OPS_GetNumRemainingInputArgs() < 3)
+    // <crd_scale> <-window $nsteps> <-threads $n>
+    while (OPS_GetNumRemainingInputArgs() > 0)
     {
-        OPS_GetDoubleInput(&num, &crd_scale);
-        opserr << "crd_scale = " << crd_scale << endln;
+        const char *option = OPS_GetString();
+        if (strcmp(option, "-window") == 0)
+        {
+            if (OPS_GetIntInput(&num, &window_size) < 0 || window_size < 8)
+            {
+                opserr << "H5DRM - -window needs at least 8 time steps\n";
+                return 0;
+            }
+        }
+        else if (strcmp(option, "-threads") == 0)
+        {
+            if (OPS_GetIntInput(&num, &number_of_threads) < 0 || number_of_threads < 1)
+            {
+                opserr << "H5DRM - -threads needs a positive integer\n";
+                return 0;
+            }
+        }
+        else
+        {
+            OPS_ResetCurrentInputArg(-1);
+            if (OPS_GetDoubleInput(&num, &crd_scale) < 0)
+            {
+                opserr << "H5DRM - unknown option " << option << "\n";
+                return 0;
+            }
+            opserr << "crd_scale = " << crd_scale << endln;
+        }
     }
 
-    thePattern = new H5DRM(tag, filename, factor, crd_scale);
+    thePattern = new H5DRM(tag, filename, factor, crd_scale, 1e-3, window_size, number_of_threads);
 
     return thePattern;
 }
@@ -133,8 +163,13 @@ H5DRM::H5DRM()
       crd_scale(0),
       distance_tolerance(0),
       maxnodetag(0),
-      station_id2data_pos(100)
+      station_id2data_pos(100),
+      window_size(H5DRM_NUM_OF_PRECOMPUTED_TIMESTEPS),
+      current_window(0),
+      async_read(false),
+      number_of_threads(1)
 {
+    window_first[0] = window_first[1] = -1;
     is_initialized = false;
     t1 =  t2 =  tend = 0;
     cFactor = 1;
@@ -156,7 +191,9 @@ H5DRM::H5DRM(
     std::string HDF5filename_,
     double cFactor_,
     double crd_scale_,
-    double distance_tolerance_)
+    double distance_tolerance_,
+    int window_size_,
+    int number_of_threads_)
     : LoadPattern(tag, PATTERN_TAG_H5DRM),
       HDF5filename(HDF5filename_),
       DRMForces(100),
@@ -166,8 +203,13 @@ H5DRM::H5DRM(
       crd_scale(crd_scale_),
       distance_tolerance(distance_tolerance_),
       maxnodetag(0),
-      station_id2data_pos(100)
+      station_id2data_pos(100),
+      window_size(window_size_ < 8 ? 8 : window_size_),
+      current_window(0),
+      async_read(false),
+      number_of_threads(number_of_threads_ < 1 ? 1 : number_of_threads_)
 {
+    window_first[0] = window_first[1] = -1;
 
     id_velocity = id_displacement = id_acceleration = 0;
     id_velocity_dataspace = id_displacement_dataspace = id_acceleration_dataspace = 0;
@@ -536,6 +578,30 @@ void H5DRM::intitialize()
 
     id_xfer_plist = H5Pcreate( H5P_DATASET_XFER);
 
+    //===========================================================================
+    // Set up the motion windows and the DRM layer matrices
+    //===========================================================================
+    int number_of_local_nodes = DRMDisplacements.Size() / 3;
+    local_pos2data_pos.resize(number_of_local_nodes);
+    for (int i = 0; i < number_of_local_nodes; ++i)
+    {
+        int station_id = nodetag2station_id[Nodes(i)];
+        local_pos2data_pos[i] = station_id2data_pos[station_id];
+    }
+    for (int w = 0; w < 2; ++w)
+    {
+        window_data[w].assign((size_t) number_of_local_nodes * 3 * window_size, 0.0);
+        window_first[w] = -1;
+    }
+    current_window = 0;
+
+    // a serial HDF5 build must only ever be called from one thread
+    hbool_t is_threadsafe = 0;
+    H5is_library_threadsafe(&is_threadsafe);
+    async_read = is_threadsafe > 0;
+
+    form_element_matrices();
+
 
 //===========================================================================
 // Set status to initialized and ready to compute loads
@@ -567,6 +633,9 @@ H5DRM::~H5DRM()
 
 void H5DRM::clean_all_data()
 {
+    if (window_read.valid())
+        window_read.wait();
+    window_first[0] = window_first[1] = -1;
 
     nodetag2station_id.clear();
     nodetag2local_pos.clear();
@@ -687,14 +756,14 @@ H5DRM::applyLoad(double time)
         }
 
         Node *theNode = 0;
-        static Vector load(3);
+        static thread_local Vector load(3);
         load.Zero();
 
         FILE* fptr_forces = 0;
         FILE* fptr_displ = 0;
         FILE* fptr_accel = 0;
 
-        static int step = 0;
+        static thread_local int step = 0;
         char mshfilename[100];
 
         // drmforces
@@ -981,24 +1050,26 @@ bool H5DRM::drm_differentiate_displacements(double t)
 
     double dtau = (t - t1)/(t2-t1);
 
-    id_displacement_dataspace = H5Dget_space(id_displacement);
-    hsize_t i_first = i1 - 1;
-    hsize_t i_last  = i1 + 2;
-
-    i_first = i_first < 0 ? 0 : i_first;
-    i_first = i_first > (hsize_t) number_of_timesteps-1 ? number_of_timesteps-1 : i_first;
-
-    i_last = i_last < 0 ? 0 : i_last;
-    i_last = i_last > (hsize_t) number_of_timesteps-1 ? number_of_timesteps-1 : i_last;
+    // samples i1-1 to i1+2 are needed, windows overlap by three samples
+    // so any four consecutive ones lie in a single window
+    int last_sample = number_of_timesteps - 1;
+    int w = -1;
+    if (i1 > 2)
+    {
+        int stride = window_size - 3;
+        w = get_window(((i1 - 1) / stride) * stride);
+        if (w < 0)
+        {
+            H5DRMerror << "Failed to read displacement array!! (i1 = " << i1 << ")\n";
+            return false;
+        }
+    }
 
-    hsize_t i_len = (i_last - i_first) + 1; 
     H5DRMout << "t = " << t 
         << " dt = " << dt 
         << " i1 = " << i1 
         << " i2 = " << i2 
-        << " i_first = " << i_first
-        << " i_last = " << i_last
-        << " i_len = " << i_len
+        << " window = " << (w < 0 ? -1 : window_first[w])
         << " t1 = " << t1 
         << " t2 = " << t2 
         << " dtau = " << dtau << endln;
@@ -1009,61 +1080,29 @@ bool H5DRM::drm_differentiate_displacements(double t)
     double amin =  std::numeric_limits<double>::infinity();
     double dt2 = dt*dt;
 
+    int number_of_local_nodes = (int) local_pos2data_pos.size();
 
-
-    for (int n = 0; n < Nodes.Size(); ++n)
+    for (int local_pos = 0; local_pos < number_of_local_nodes; ++local_pos)
     {
-        int nodeTag = Nodes(n);
-        int station_id = nodetag2station_id[nodeTag];
-        int data_pos = station_id2data_pos[station_id];
-        int local_pos = nodetag2local_pos[nodeTag];
-        
         double d0[3][4];
         double d1[3], d2[3];
         double a1[3], a2[3];
 
-        d0[0][0] = d0[1][0] = d0[2][0] = 0.;
-        d0[0][1] = d0[1][1] = d0[2][1] = 0.;
-        d0[0][2] = d0[1][2] = d0[2][2] = 0.;
-        d0[0][3] = d0[1][3] = d0[2][3] = 0.;
-        d1[0] = d1[1] = d1[2] = 0.;
-        d2[0] = d2[1] = d2[2] = 0.;
-        a1[0] = a1[1] = a1[2] = 0.;
-        a2[0] = a2[1] = a2[2] = 0.;
-
-        hsize_t start[2]  = {(hsize_t) data_pos , (hsize_t) i_first};
-        hsize_t stride[2] = {1                  , 1};
-        hsize_t count[2]  = {3                  , i_len};
-        hsize_t block[2]  = {1                  , 1};
-
-        //Selection in dataspace
-        H5Sselect_hyperslab(
-            id_displacement_dataspace,
-            H5S_SELECT_SET, start, stride, count, block );
-
-        //Selection in memspace
-        hsize_t rank_two_array = 2;
-        hsize_t one_node_data_dims[2] = {3, i_len};
-        hsize_t one_node_data_maxdims[2] = {3, i_len};
-        hid_t memspace  = H5Screate_simple(rank_two_array, one_node_data_dims, one_node_data_maxdims);       // create dataspace of memory
-
-
-        hsize_t mem_start[2] = {0, 0};
-        hsize_t mem_stride[2] = {1, 1};
-        hsize_t mem_count[2] = {3, i_len};
-        hsize_t mem_block[2] = {1, 1};
-        H5Sselect_hyperslab(
-            memspace,
-            H5S_SELECT_SET, mem_start, mem_stride, mem_count, mem_block );
+        for (int dof = 0; dof < 3; ++dof)
+            for (int k = 0; k < 4; ++k)
+                d0[dof][k] = 0.;
 
-        //Read data
-        herr_t errorflag1 = 0;
-        if (i1 > 2)
+        if (w >= 0)
         {
-            errorflag1 = H5Dread( id_displacement, H5T_NATIVE_DOUBLE, memspace,
-                                    id_displacement_dataspace, id_xfer_plist,  d0 );
+            const double *u = &window_data[w][(size_t) local_pos * 3 * window_size];
+            for (int dof = 0; dof < 3; ++dof)
+                for (int k = 0; k < 4; ++k)
+                {
+                    int sample = i1 - 1 + k;
+                    sample = sample > last_sample ? last_sample : sample;
+                    d0[dof][k] = u[dof * window_size + sample - window_first[w]];
+                }
         }
-        
 
         for (int dof = 0; dof < 3; ++dof)
         {
@@ -1073,9 +1112,6 @@ bool H5DRM::drm_differentiate_displacements(double t)
             a2[dof] = (d0[dof][1] -2*d0[dof][2] +d0[dof][3])/dt2;
         }
 
-
-        H5Sclose(memspace);
-
         bool nanfound = false;
         for (int i = 0; i < 3; ++i)
         {
@@ -1098,24 +1134,15 @@ bool H5DRM::drm_differentiate_displacements(double t)
         }
 
 
-        if (errorflag1 < 0 || 
-            // errorflag2 < 0 || errorflag3 < 0 || errorflag4 < 0 || 
-            nanfound)
+        if (nanfound)
         {
             H5DRMerror << "Failed to read displacement or acceleration array!!\n" <<
-                       " n = " << n << endln <<
-                       " nodeTag = " << nodeTag << endln <<
-                       " station_id = " << station_id << endln <<
+                       " nodeTag = " << Nodes(local_pos) << endln <<
                        " i1 = " << i1 << endln <<
-                       " data_pos = " << data_pos << endln <<
+                       " data_pos = " << local_pos2data_pos[local_pos] << endln <<
                        " local_pos = " << local_pos << endln <<
-                       " Nt = " << 1 << endln <<
-                       " last_integration_time = " << last_integration_time << endln <<
-                       " start   = [" << start[0] << ", " << start[1] << "]" << endln <<
-                       " mem_start  = [" << mem_start[0] << ", " << mem_start[1] << "]" << endln <<
-                       " stride  = [" << stride[0] << ", " << stride[1] << "]" << endln <<
-                       " count   = [" << count[0] << ", " << count[1] << "]" << endln <<
-                       " block   = [" << block[0] << ", " << block[1] << "]" << endln;
+                       " window = " << (w < 0 ? -1 : window_first[w]) << endln <<
+                       " last_integration_time = " << last_integration_time << endln;
             exit(-1);
         }
 
@@ -1139,6 +1166,79 @@ bool H5DRM::drm_differentiate_displacements(double t)
     return true;
 }
 
+
+// Reads samples [first_sample, first_sample + window_size) of the
+// displacements of every local DRM node into window_data[which]. Runs
+// on the reader thread when async_read is set, so it only touches its
+// own window and HDF5.
+bool H5DRM::read_window(int which, int first_sample)
+{
+    int number_of_samples = std::min(window_size, number_of_timesteps - first_sample);
+    if (number_of_samples <= 0)
+        return false;
+
+    hid_t dataspace = H5Dget_space(id_displacement);
+
+    hsize_t mem_dims[2] = {3, (hsize_t) window_size};
+    hid_t memspace = H5Screate_simple(2, mem_dims, mem_dims);
+    hsize_t mem_start[2] = {0, 0};
+    hsize_t mem_count[2] = {3, (hsize_t) number_of_samples};
+    H5Sselect_hyperslab(memspace, H5S_SELECT_SET, mem_start, NULL, mem_count, NULL);
+
+    bool ok = true;
+    int number_of_local_nodes = (int) local_pos2data_pos.size();
+    for (int local_pos = 0; local_pos < number_of_local_nodes && ok; ++local_pos)
+    {
+        hsize_t start[2] = {(hsize_t) local_pos2data_pos[local_pos], (hsize_t) first_sample};
+        hsize_t count[2] = {3, (hsize_t) number_of_samples};
+        H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, start, NULL, count, NULL);
+
+        double *u = &window_data[which][(size_t) local_pos * 3 * window_size];
+        ok = H5Dread(id_displacement, H5T_NATIVE_DOUBLE, memspace,
+                     dataspace, id_xfer_plist, u) >= 0;
+    }
+
+    H5Sclose(memspace);
+    H5Sclose(dataspace);
+
+    window_first[which] = ok ? first_sample : -1;
+    return ok;
+}
+
+
+// Returns the window holding samples from first_sample on, reading it
+// if neither buffer has it, and starts the read of the window after it
+// into the other buffer.
+int H5DRM::get_window(int first_sample)
+{
+    int other = 1 - current_window;
+
+    if (window_first[current_window] != first_sample)
+    {
+        bool ok = true;
+        if (window_read.valid())
+            ok = window_read.get();
+
+        if (ok && window_first[other] == first_sample)
+        {
+            current_window = other;
+            other = 1 - current_window;
+        }
+        else if (!read_window(current_window, first_sample))
+            return -1;
+
+        int next_sample = first_sample + window_size - 3;
+        if (async_read && next_sample < number_of_timesteps)
+        {
+            window_first[other] = -1;
+            window_read = std::async(std::launch::async, &H5DRM::read_window, this, other, next_sample);
+        }
+    }
+
+    return current_window;
+}
+
+
 bool H5DRM::drm_integrate_velocity(double next_integration_time)
 {
 
@@ -1431,18 +1531,6 @@ H5DRM::ComputeDRMLoads(double t)
     if (myrank == 0)
         H5DRMout << "ComputeDRMLoads.... Begin (t = " <<  t << ").\n";
 
-
-    int NDOF = 3;
-    int NIEMAX = 8;
-    static Vector Fm(NIEMAX * NDOF); Fm.Zero();
-    static Vector Fk(NIEMAX * NDOF); Fk.Zero();
-    static Vector u_e(NIEMAX * NDOF); u_e.Zero();
-    static Vector udd_e(NIEMAX * NDOF); udd_e.Zero();
-    static Vector v1(NDOF); v1.Zero();
-    static Vector v2(NDOF); v2.Zero();
-    static ID B_node(NIEMAX); B_node.Zero();
-    static ID E_node(NIEMAX); E_node.Zero();
-
     DRMForces.Zero();
     
     if ( t < tstart || tend < t)
@@ -1459,123 +1547,43 @@ H5DRM::ComputeDRMLoads(double t)
         if (!computed)
             return false;
 
-        Domain *theDomain = this->getDomain();
-
-        Element *theElement = theDomain->getElement( Elements[0] );
-        int NIE = 8;
-        B_node.resize(NIEMAX);
-        E_node.resize(NIEMAX);
-
-        for (int e = 0; e < Elements.Size(); e++)
+        // element forces in parallel, each thread on its own range of
+        // elements and its own part of layer_forces
+        int number_of_layer_elements = (int) layer_element_start.size() - 1;
+        int nthreads = std::min(number_of_threads, number_of_layer_elements);
+        if (nthreads > 1)
         {
-            int eleTag = Elements[e];
-
-            //Pointer to current element
-            theElement = theDomain->getElement(eleTag);
-
-            //List of current element nodes
-            const ID &elementNodes = theElement->getExternalNodes();
-
-            //Identify boundary and exterior nodes for this element
-            NIE = elementNodes.Size();
-            
-            int nB = 0, nE = 0;
-            for ( int ii = 0; ii < NIE; ii++)
-            {
-                int nodeTag = elementNodes(ii);
-                int local_pos = nodetag2local_pos[nodeTag];
-
-                if ( IsBoundary[local_pos] == 1 )
-                {
-                    B_node(nB) = ii;
-                    nB ++;
-                }
-                else
-                {
-                    E_node(nE) = ii;
-                    nE ++;
-                }
-            }
+            std::vector<std::thread> workers;
+            for (int i = 1; i < nthreads; ++i)
+                workers.push_back(std::thread(&H5DRM::compute_element_forces, this,
+                                              (i * number_of_layer_elements) / nthreads,
+                                              ((i + 1) * number_of_layer_elements) / nthreads));
+            compute_element_forces(0, number_of_layer_elements / nthreads);
+            for (size_t i = 0; i < workers.size(); ++i)
+                workers[i].join();
+        }
+        else
+            compute_element_forces(0, number_of_layer_elements);
 
-            if ( nB != 0 and nE != 0 )
+        // assembly stays serial and in element order, so the result does
+        // not depend on the number of threads
+        for (int e = 0; e < number_of_layer_elements; e++)
+        {
+            for (int k = layer_element_start[e]; k < layer_element_start[e + 1]; k++)
             {
-                //Mass and stiffness matrices
-                Matrix Me = theElement->getMass();
-                Matrix Ke = theElement->getTangentStiff();
-
-                //Zero out the diagonal block of Boundary nodes
-                for (int m = 0; m < nB; m++)
-                    for (int n = 0; n < nB; n++)
-                        for (int d = 0; d < NDOF; d++)
-                            for (int e = 0; e < NDOF; e++)
-                            {
-                                Me( B_node(m)*NDOF + d, B_node(n)*NDOF + e ) = 0.0;
-                                Ke( B_node(m)*NDOF + d, B_node(n)*NDOF + e ) = 0.0;
-                            }
-
-
-                //Zero out the diagonal block of Exterior nodes
-                for (int m = 0; m < nE; m++)
-                    for (int n = 0; n < nE; n++)
-                        for (int d = 0; d < NDOF; d++)
-                            for (int e = 0; e < NDOF; e++)
-                            {
-                                Me( E_node(m)*NDOF + d, E_node(n)*NDOF + e ) = 0.0;
-                                Ke( E_node(m)*NDOF + d, E_node(n)*NDOF + e ) = 0.0;
-                            }
-
-                u_e.resize(3 * NIE);
-                udd_e.resize(3 * NIE);
-                Fm.resize(3 * NIE);
-                Fk.resize(3 * NIE);
-
-                u_e.Zero();
-                udd_e.Zero();
-                Fm.Zero();
-                Fk.Zero();
-
-                for (int k = 0; k < NIE; ++k)
-                {
-                    int nodeTag = elementNodes(k);
-                    int local_pos = nodetag2local_pos[nodeTag];
-                    u_e(3 * k      ) = DRMDisplacements[3 * local_pos];// - DRMDisplacements0[3 * local_pos] ;
-                    u_e(3 * k + 1  ) = DRMDisplacements[3 * local_pos + 1];// - DRMDisplacements0[3 * local_pos + 1] ;
-                    u_e(3 * k + 2  ) = DRMDisplacements[3 * local_pos + 2];// - DRMDisplacements0[3 * local_pos + 2] ;
-                    udd_e(3 * k    ) = DRMAccelerations[3 * local_pos];
-                    udd_e(3 * k + 1) = DRMAccelerations[3 * local_pos + 1];
-                    udd_e(3 * k + 2) = DRMAccelerations[3 * local_pos + 2];
-                }
-                // cout << endl;
-
-                Fm.addMatrixVector(0.0, Me, udd_e, 1.0);
-                Fk.addMatrixVector(0.0, Ke, u_e, 1.0);
-
-                for (int k = 0; k < NIE; k++)
+                int local_pos = layer_element_nodes[k];
+                DRMForces( 3 * local_pos  + 0) +=  layer_forces[3 * k + 0];
+                DRMForces( 3 * local_pos  + 1) +=  layer_forces[3 * k + 1];
+                DRMForces( 3 * local_pos  + 2) +=  layer_forces[3 * k + 2];
+
+                if (isnan(DRMForces( 3 * local_pos  + 0) ) ||
+                        isnan(DRMForces( 3 * local_pos  + 1) ) ||
+                        isnan(DRMForces( 3 * local_pos  + 2) ) )
                 {
-                    int nodeTag = elementNodes(k);
-                    int local_pos = nodetag2local_pos[nodeTag];
-                    DRMForces( 3 * local_pos  + 0) +=  Fk(3 * k  + 0) + Fm(3 * k  + 0);
-                    DRMForces( 3 * local_pos  + 1) +=  Fk(3 * k  + 1) + Fm(3 * k  + 1);
-                    DRMForces( 3 * local_pos  + 2) +=  Fk(3 * k  + 2) + Fm(3 * k  + 2);
-
-
-                    if (isnan(DRMForces( 3 * local_pos  + 0) ) ||
-                            isnan(DRMForces( 3 * local_pos  + 1) ) ||
-                            isnan(DRMForces( 3 * local_pos  + 2) ) )
-                    {
-                        H5DRMerror << "NAN Detected!!! \n";
-                        H5DRMerror << "    nodeTag = " << nodeTag << endln;
-                        H5DRMerror << "    local_pos = " << local_pos << endln;
-                        for (int dd = 0; dd < NIE; dd++)
-                        {
-                            H5DRMerror << "    Fk(" << dd << ") = " << Fk(dd) <<
-                                       "  u_e(" << dd << ") = " << u_e(dd) <<
-                                       "  Fm(" << dd << ") = " << Fm(dd) <<
-                                       "  udd_e(" << dd << ") = " << udd_e(dd) << endln;
-                        }
-                        exit(-1);
-
-                    }
+                    H5DRMerror << "NAN Detected!!! \n";
+                    H5DRMerror << "    nodeTag = " << Nodes(local_pos) << endln;
+                    H5DRMerror << "    local_pos = " << local_pos << endln;
+                    exit(-1);
                 }
             }
         }
@@ -1609,16 +1617,151 @@ H5DRM::ComputeDRMLoads(double t)
 
 
 
+// Forms, for every DRM layer element with both boundary and exterior
+// nodes, its mass and stiffness with the boundary-boundary and
+// exterior-exterior blocks zeroed. The layer is linear in the DRM, so
+// this is done once each time the pattern is initialized.
+void
+H5DRM::form_element_matrices()
+{
+    int NDOF = 3;
+    Domain *theDomain = this->getDomain();
+
+    layer_element_start.assign(1, 0);
+    layer_element_nodes.clear();
+    layer_matrix_start.assign(1, 0);
+    layer_matrices.clear();
+
+    ID B_node(8);
+    ID E_node(8);
+
+    for (int e = 0; e < Elements.Size(); e++)
+    {
+        Element *theElement = theDomain->getElement(Elements[e]);
+        if (theElement == 0)
+            continue;
+
+        //List of current element nodes
+        const ID &elementNodes = theElement->getExternalNodes();
+        int NIE = elementNodes.Size();
+
+        //Identify boundary and exterior nodes for this element
+        int nB = 0, nE = 0;
+        for ( int ii = 0; ii < NIE; ii++)
+        {
+            int local_pos = nodetag2local_pos[elementNodes(ii)];
+            if ( IsBoundary[local_pos] == 1 )
+                B_node[nB++] = ii;
+            else
+                E_node[nE++] = ii;
+        }
+
+        if ( nB == 0 || nE == 0 )
+            continue;
+
+        //Mass and stiffness matrices
+        Matrix Me = theElement->getMass();
+        Matrix Ke = theElement->getTangentStiff();
+
+        //Zero out the diagonal blocks of Boundary and Exterior nodes
+        for (int m = 0; m < nB; m++)
+            for (int n = 0; n < nB; n++)
+                for (int d = 0; d < NDOF; d++)
+                    for (int f = 0; f < NDOF; f++)
+                    {
+                        Me( B_node(m)*NDOF + d, B_node(n)*NDOF + f ) = 0.0;
+                        Ke( B_node(m)*NDOF + d, B_node(n)*NDOF + f ) = 0.0;
+                    }
+
+        for (int m = 0; m < nE; m++)
+            for (int n = 0; n < nE; n++)
+                for (int d = 0; d < NDOF; d++)
+                    for (int f = 0; f < NDOF; f++)
+                    {
+                        Me( E_node(m)*NDOF + d, E_node(n)*NDOF + f ) = 0.0;
+                        Ke( E_node(m)*NDOF + d, E_node(n)*NDOF + f ) = 0.0;
+                    }
+
+        for (int k = 0; k < NIE; ++k)
+            layer_element_nodes.push_back(nodetag2local_pos[elementNodes(k)]);
+        layer_element_start.push_back((int) layer_element_nodes.size());
+
+        int n = NDOF * NIE;
+        for (int j = 0; j < n; ++j)
+            for (int i = 0; i < n; ++i)
+                layer_matrices.push_back(Ke(i, j));
+        for (int j = 0; j < n; ++j)
+            for (int i = 0; i < n; ++i)
+                layer_matrices.push_back(Me(i, j));
+        layer_matrix_start.push_back((int) layer_matrices.size());
+    }
+
+    layer_forces.assign(3 * layer_element_nodes.size(), 0.0);
+
+    H5DRMout << "Formed matrices of " << layer_element_start.size() - 1 << " DRM layer elements.\n";
+}
+
+
+// Effective forces Ke u_e + Me udd_e of layer elements [first, last)
+// into layer_forces. Called concurrently on disjoint ranges.
+void
+H5DRM::compute_element_forces(int first, int last)
+{
+    double u_data[3 * 27], udd_data[3 * 27], fk_data[3 * 27], fm_data[3 * 27];
+
+    for (int e = first; e < last; e++)
+    {
+        int node0 = layer_element_start[e];
+        int NIE = layer_element_start[e + 1] - node0;
+        int n = 3 * NIE;
+
+        if (n > 3 * 27)
+        {
+            H5DRMerror << "DRM layer element with more than 27 nodes.\n";
+            exit(-1);
+        }
+
+        Vector u_e(u_data, n);
+        Vector udd_e(udd_data, n);
+        Vector Fk(fk_data, n);
+        Vector Fm(fm_data, n);
+
+        for (int k = 0; k < NIE; ++k)
+        {
+            int local_pos = layer_element_nodes[node0 + k];
+            for (int d = 0; d < 3; ++d)
+            {
+                u_e(3 * k + d) = DRMDisplacements[3 * local_pos + d];
+                udd_e(3 * k + d) = DRMAccelerations[3 * local_pos + d];
+            }
+        }
+
+        double *KM = &layer_matrices[layer_matrix_start[e]];
+        Matrix Ke(KM, n, n);
+        Matrix Me(KM + n * n, n, n);
+
+        Fm.addMatrixVector(0.0, Me, udd_e, 1.0);
+        Fk.addMatrixVector(0.0, Ke, u_e, 1.0);
+
+        double *F = &layer_forces[3 * node0];
+        for (int i = 0; i < n; ++i)
+            F[i] = Fk(i) + Fm(i);
+    }
+}
+
+
 int
 H5DRM::sendSelf(int commitTag, Channel & theChannel)
 {
 
     H5DRMout << "sending filename: " << HDF5filename << endl;
 
-    static Vector data(3);
+    static thread_local Vector data(5);
     data(0) = cFactor;
     data(1) = crd_scale;
     data(2) = distance_tolerance;
+    data(3) = window_size;
+    data(4) = number_of_threads;
 
     char drmfilename[H5DRM_MAX_FILENAME];
     strcpy(drmfilename, HDF5filename.c_str());
@@ -1645,7 +1788,7 @@ H5DRM::recvSelf(int commitTag, Channel & theChannel,
                 FEM_ObjectBroker & theBroker)
 {
     H5DRMout << "receiving...\n";
-    static Vector data(3);
+    static thread_local Vector data(5);
     char drmfilename[H5DRM_MAX_FILENAME];
     Message filename_msg(drmfilename, H5DRM_MAX_FILENAME);
 
@@ -1665,6 +1808,8 @@ H5DRM::recvSelf(int commitTag, Channel & theChannel,
     cFactor = data(0);
     crd_scale = data(1);
     distance_tolerance = data(2);
+    window_size = (int) data(3);
+    number_of_threads = (int) data(4);
 
     HDF5filename = drmfilename;
     H5DRMout << "received filename is " <<  drmfilename << "\n";
@@ -1684,7 +1829,8 @@ H5DRM::Print(ostream & s, int flag)
 LoadPattern *
 H5DRM::getCopy(void)
 {
-    return new H5DRM(this->getTag(), HDF5filename);
+    return new H5DRM(this->getTag(), HDF5filename, 1.0, 1, 1e-3,
+                     window_size, number_of_threads);
 }
 
 
@@ -1831,7 +1977,7 @@ void H5DRM::node_matching_BruteForce(double d_tol, const ID & internal, const Ma
         if (fabs(dmin) < d_tol)
         {
             int station_id = ii_station_min;
-            static Vector station_xyz(3);
+            static thread_local Vector station_xyz(3);
             for (int dir = 0; dir < 3; ++dir)
                 station_xyz(dir) = xyz(station_id, dir);
             double this_d_err = (station_xyz - node_xyz - drmbox_x0).Norm();
@@ -2114,9 +2260,9 @@ Plane::~Plane()
 
 bool Plane::locate_point(const Vector & x, double & xi1_, double & xi2_, double & distance) const
 {
-    static Matrix A(2, 2);
-    static Vector b(2);
-    static Vector xi(2);
+    static thread_local Matrix A(2, 2);
+    static thread_local Vector b(2);
+    static thread_local Vector xi(2);
 
     A(0, 0) = v1 ^ v1;
     A(0, 1) = v1 ^ v2;
@@ -63,6 +63,13 @@
 //    some case, I would be happy to discuss and implement this and also
 //    know why it might be needed. (coupled poroelasticity?)
 //  + It has been tested to work in parallel. 
+//  + Motions are read a window of time samples at a time (-window, 
+//    default H5DRM_NUM_OF_PRECOMPUTED_TIMESTEPS) into one of two buffers, 
+//    and while one is in use the next window is read in the background 
+//    if the HDF5 library was built thread safe. The partitioned element 
+//    mass and stiffness matrices of the DRM layer, which must be linear 
+//    for the method to hold, are formed once per initialization, and the 
+//    effective forces are computed over them with -threads threads. 
 //  + The H5DRM data format specification is documented in [3].
 //  + Based on and and extends the work done for my PhD thesis [4].
 // 
@@ -104,6 +111,7 @@
 #include <vector>
 #include <algorithm>  // For std::min and std::max functions
 #include <string>
+#include <future>
 
 #define H5DRM_NUM_OF_PRECOMPUTED_TIMESTEPS 50
 #define H5DRM_MAX_RETURN_OPEN_OBJS 100
@@ -149,7 +157,8 @@ class H5DRM : public LoadPattern
 {
 public:
     H5DRM();
-    H5DRM(int tag, std::string HDF5filename_, double cFactor_ = 1.0, double crd_scale_ = 1, double distance_tolerance_ = 1e-3);
+    H5DRM(int tag, std::string HDF5filename_, double cFactor_ = 1.0, double crd_scale_ = 1, double distance_tolerance_ = 1e-3,
+          int window_size_ = H5DRM_NUM_OF_PRECOMPUTED_TIMESTEPS, int number_of_threads_ = 1);
     ~H5DRM();
     void clean_all_data(); // Called by destructor and if domain changes
 
@@ -172,6 +181,10 @@ protected:
     bool  drm_differentiate_displacements(double next_integration_time);
     bool  drm_integrate_velocity(double next_integration_time);
     bool  drm_direct_read(double next_integration_time);
+    bool  read_window(int which, int first_sample);
+    int   get_window(int first_sample);
+    void  form_element_matrices();
+    void  compute_element_forces(int first, int last);
     Vector *getNodalLoad(int node, double time);
 
     void intitialize();
@@ -232,6 +245,23 @@ private:
     int myrank;         // MPI Process-id (rank) in the case of parallel processing
 
     std::vector<Plane*> planes;
+
+    // windows of displacement samples, stored [local_pos][dof][sample]
+    int window_size;
+    std::vector<int> local_pos2data_pos;
+    std::vector<double> window_data[2];
+    int window_first[2];                // first sample held, -1 if empty
+    int current_window;
+    bool async_read;                    // HDF5 can be called from a reader thread
+    std::future<bool> window_read;      // read of the other window in flight
+
+    // DRM layer elements with both boundary and exterior nodes
+    int number_of_threads;
+    std::vector<int> layer_element_start;   // into layer_element_nodes, per element
+    std::vector<int> layer_element_nodes;   // local_pos of each element node
+    std::vector<int> layer_matrix_start;    // into layer_matrices, per element
+    std::vector<double> layer_matrices;     // partitioned K then M, column major
+    std::vector<double> layer_forces;       // per element node and dof
 };
 
 #endif
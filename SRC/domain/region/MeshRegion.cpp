@@ -33,6 +33,7 @@
 // What: "@(#) MeshRegion.h, revA"
 
 
+#include <unordered_set>
 #include <MeshRegion.h>
 #include <stdlib.h>
 #include <string.h>
@@ -100,12 +101,13 @@ MeshRegion::setNodes(const ID &theNods)
   }
 
   // add nodes to the node list if in the domain
+  std::unordered_set<int> nodeSet;
   int loc = 0;
   for (int i=0; i<numNodes; i++) {
     int nodeTag = theNods(i);
     Node *theNode = theDomain->getNode(nodeTag);
     if (theNode != 0) {
-      if (theNodes->getLocation(nodeTag) < 0)
+      if (nodeSet.insert(nodeTag).second)
 	(*theNodes)[loc++] = nodeTag;      
     }
   }
@@ -129,7 +131,7 @@ MeshRegion::setNodes(const ID &theNods)
 
     for (int i=0; i<numNodes; i++) {
       int nodeTag = theEleNodes(i);
-      if (theNodes->getLocation(nodeTag) < 0) {
+      if (nodeSet.count(nodeTag) == 0) {
 	in = false;
 	i = numNodes;
       }
@@ -165,12 +167,13 @@ MeshRegion::setNodesOnly(const ID &theNods)
     }
     
     // add nodes to the node list if in the domain
+    std::unordered_set<int> nodeSet;
     int loc = 0;
     for (int i = 0; i<numNodes; i++) {
         int nodeTag = theNods(i);
         Node *theNode = theDomain->getNode(nodeTag);
         if (theNode != 0) {
-            if (theNodes->getLocation(nodeTag) < 0)
+            if (nodeSet.insert(nodeTag).second)
                 (*theNodes)[loc++] = nodeTag;
         }
     }
@@ -209,13 +212,14 @@ MeshRegion::setElements(const ID &theEles)
     return -1;
   }
 
+  std::unordered_set<int> eleSet, nodeSet;
   Element *theEle;
   for (int i=0; i<numEle; i++) {
     int eleTag = theEles(i);
     theEle = theDomain->getElement(eleTag);
     if (theEle != 0) {
 
-      if (theElements->getLocation(eleTag) < 0)
+      if (eleSet.insert(eleTag).second)
 	  (*theElements)[locEle++] = eleTag;
 
       const ID &theEleNodes = theEle->getExternalNodes();
@@ -223,7 +227,7 @@ MeshRegion::setElements(const ID &theEles)
       for (int i=0; i<theEleNodes.Size(); i++) {
 	int nodeTag = theEleNodes(i);
 	// add the node tag if not already there
-	if (theNodes->getLocation(nodeTag) < 0)
+	if (nodeSet.insert(nodeTag).second)
 	  (*theNodes)[locNode++] = nodeTag;
       }
     }
@@ -254,12 +258,13 @@ MeshRegion::setElementsOnly(const ID &theEles)
     }
 
     // add elements to the ele list if in the domain
+    std::unordered_set<int> eleSet;
     int loc = 0;
     for (int i = 0; i<numEles; i++) {
         int eleTag = theEles(i);
         Element *theEle = theDomain->getElement(eleTag);
         if (theEle != 0) {
-            if (theElements->getLocation(eleTag) < 0)
+            if (eleSet.insert(eleTag).second)
                 (*theElements)[loc++] = eleTag;
         }
     }
@@ -66,11 +66,22 @@ ActorSubdomain::~ActorSubdomain()
 }
 
 
+// Receive an object sent by ShadowSubdomain::sendPacked()
+int
+ActorSubdomain::recvPacked(MovableObject &theObject)
+{
+  if (thePackedChannel.receive(*theChannel, 0, 0, this->getShadowsAddressPtr()) < 0)
+    return -1;
+
+  return theObject.recvSelf(0, thePackedChannel, *theBroker);
+}
+
+
 int
 ActorSubdomain::run(void)
 {
-    static Vector theVect(4);
-	static Vector theVect1(1);
+    static thread_local Vector theVect(4);
+	static thread_local Vector theVect1(1);
     bool exitYet = false;
     int res = 0;
 
@@ -185,7 +196,7 @@ ActorSubdomain::run(void)
 
 	    if (theEle != 0) {
 		theEle->setDbTag(dbTag);		
-		this->recvObject(*theEle);
+		this->recvPacked(*theEle);
 		bool result = this->addElement(theEle);
 		if (result == true)
 		    msgData(0) = 0;
@@ -238,7 +249,7 @@ ActorSubdomain::run(void)
 
 	    if (theNod != 0) {
 		theNod->setDbTag(dbTag);		
-		this->recvObject(*theNod); 
+		this->recvPacked(*theNod); 
 		bool result = this->addNode(theNod);
 		if (result == true)
 		  msgData(0) = 0;
@@ -1067,7 +1078,7 @@ ActorSubdomain::update(void)
 int
 ActorSubdomain::updateTimeDt(void)
 {
-  static Vector data(2);
+  static thread_local Vector data(2);
 
   this->recvVector(data);
 
@@ -1080,7 +1091,7 @@ ActorSubdomain::updateTimeDt(void)
 int
 ActorSubdomain::barrierCheck(int myResult)
 {
-  static ID data(1);
+  static thread_local ID data(1);
   data(0) = myResult;
   this->sendID(data);
   this->recvID(data);
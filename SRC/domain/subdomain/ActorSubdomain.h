@@ -38,6 +38,7 @@
 
 #include "Subdomain.h"
 #include <Actor.h>
+#include <PackedChannel.h>
 
 class ActorSubdomain: public Subdomain, public Actor
 {
@@ -58,7 +59,10 @@ class ActorSubdomain: public Subdomain, public Actor
 
     
   private:
+    int recvPacked(MovableObject &theObject);
+
     ID msgData;
+    PackedChannel thePackedChannel; // holds the sendSelf() of one object
     Vector *lastResponse;
 };
 	
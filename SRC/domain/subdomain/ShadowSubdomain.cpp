@@ -197,6 +197,18 @@ int ShadowSubdomain::getRemoteData(void)
   return 0;
 }
 
+// Send the sendSelf() of an object to the actor as one message instead
+// of one per send call; the actor reads it with recvPacked().
+int
+ShadowSubdomain::sendPacked(MovableObject &theObject)
+{
+  if (thePackedChannel.clear() < 0 ||
+      theObject.sendSelf(0, thePackedChannel) < 0)
+    return -1;
+
+  return thePackedChannel.flush(*theChannel, 0, 0, this->getActorAddressPtr());
+}
+
 bool ShadowSubdomain::addElement(Element *theEle)
 {
   int tag = theEle->getTag();
@@ -205,7 +217,7 @@ bool ShadowSubdomain::addElement(Element *theEle)
   msgData(1) = theEle->getClassTag();
   msgData(2) = theEle->getDbTag();
   this->sendID(msgData);
-  this->sendObject(*theEle);
+  this->sendPacked(*theEle);
   theElements[numElements] = tag;
   numElements++;
   //    this->Domain::domainChange();
@@ -223,7 +235,7 @@ bool ShadowSubdomain::addNode(Node *theNode)
   msgData(1) = theNode->getClassTag();
   msgData(2) = theNode->getDbTag();
   this->sendID(msgData);
-  this->sendObject(*theNode);
+  this->sendPacked(*theNode);
   theNodes[numNodes] = tag;
   numNodes++;
   // this->Domain::domainChange();
@@ -279,7 +291,7 @@ int ShadowSubdomain::addSP_Constraint(int axisDirn, double axisValue,
   this->sendID(msgData);
 
   this->sendID(fixityCodes);
-  static Vector data(2);
+  static thread_local Vector data(2);
   data(0) = axisValue;
   data(1) = tol;
   this->sendVector(data);
@@ -813,7 +825,7 @@ int ShadowSubdomain::setRayleighDampingFactors(double alphaM, double betaK,
 
   this->sendID(msgData);
 
-  static Vector data(4);
+  static thread_local Vector data(4);
   data(0) = alphaM;
   data(1) = betaK;
   data(2) = betaK0;
@@ -834,7 +846,7 @@ int ShadowSubdomain::update(void)
 
 int ShadowSubdomain::update(double newTime, double dT)
 {
-  static Vector data(2);
+  static thread_local Vector data(2);
   DomainDecompositionAnalysis *theDDA = this->getDDAnalysis();
   if (theDDA != 0 && theDDA->doesIndependentAnalysis() != true) {
     msgData(0) = ShadowActorSubdomain_updateTimeDt;
@@ -849,14 +861,14 @@ int ShadowSubdomain::update(double newTime, double dT)
 
 int ShadowSubdomain::barrierCheckIN(void)
 {
-  static ID data(1);
+  static thread_local ID data(1);
   this->recvID(data);
   return data(0);
 }
 
 int ShadowSubdomain::barrierCheckOUT(int result)
 {
-  static ID data(1);
+  static thread_local ID data(1);
   data(0) = result;
   this->sendID(data);
 
@@ -1219,7 +1231,7 @@ int ShadowSubdomain::analysisStep(double dT)
   msgData(0) = ShadowActorSubdomain_analysisStep;
   this->sendID(msgData);
 
-  static Vector timeStep(4);
+  static thread_local Vector timeStep(4);
   timeStep(0) = dT;
 
   this->sendVector(timeStep);
@@ -1329,7 +1341,7 @@ int ShadowSubdomain::buildMap(void)
 
 double ShadowSubdomain::getNodeDisp(int nodeTag, int dof, int &errorFlag)
 {
-  static Vector data(1);
+  static thread_local Vector data(1);
   data(0) = 0.0;
 
   msgData(0) = ShadowActorSubdomain_getNodeDisp;
@@ -1363,7 +1375,7 @@ const Vector *ShadowSubdomain::getNodeResponse(int tag,
   if (theNodes.getLocation(tag) < 0)
     return NULL;
 
-  static Vector data(0);
+  static thread_local Vector data(0);
 
   msgData(0) = ShadowActorSubdomain_getNodeResponse;
   msgData(1) = tag;
@@ -1390,7 +1402,7 @@ const Vector *ShadowSubdomain::getElementResponse(int tag, const char **argv,
   if (theElements.getLocation(tag) < 0)
     return NULL;
 
-  static Vector data(0);
+  static thread_local Vector data(0);
 
   msgData(0) = ShadowActorSubdomain_getElementResponse;
   msgData(1) = tag;
@@ -1495,7 +1507,7 @@ int ShadowSubdomain::updateParameter(int tag, double value)
 
   this->sendID(msgData);
 
-  static Vector data(1);
+  static thread_local Vector data(1);
   data(0) = value;
   this->sendVector(data);
 
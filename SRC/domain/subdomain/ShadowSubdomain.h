@@ -39,6 +39,7 @@
 
 #include <Subdomain.h>
 #include <actor/shadow/Shadow.h>
+#include <PackedChannel.h>
 #include <remote.h>
 
 class ShadowSubdomain: public Shadow, public Subdomain
@@ -186,7 +187,10 @@ class ShadowSubdomain: public Shadow, public Subdomain
     virtual int buildNodeGraph(Graph *theNodeGraph);    
     
   private:
+    int sendPacked(MovableObject &theObject);
+
     ID msgData;
+    PackedChannel thePackedChannel; // batches the sendSelf() of one object
     ID theElements;
     ID theNodes;
     ID theExternalNodes;    
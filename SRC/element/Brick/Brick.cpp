@@ -40,10 +40,12 @@
 #include <ErrorHandler.h>
 #include <Brick.h>
 #include <shp3d.h>
+#include <ShapeFunctionCache.h>
 #include <Renderer.h>
 #include <ElementResponse.h>
 #include <Parameter.h>
 #include <ElementalLoad.h>
+#include <NDMaterialBatch.h>
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -91,6 +93,8 @@ void * OPS_ADD_RUNTIME_VPV(OPS_Brick)
 //static data
 double  Brick::xl[3][8] ;
 
+ShapeFunctionCache  Brick::shapes(8, 3, 4*8*8 + 8, &Brick::computeShapeData) ;
+
 Matrix  Brick::stiff(24,24) ;
 Vector  Brick::resid(24) ;
 Matrix  Brick::mass(24,24) ;
@@ -112,7 +116,7 @@ static Matrix B(6,3) ;
 //null constructor
 Brick::Brick( ) 
 :Element( 0, ELE_TAG_Brick ),
- connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
+ connectedExternalNodes(8), applyLoad(0), load(0), Ki(0), batchPoint(-1)
 {
   B.Zero();
 
@@ -141,7 +145,7 @@ Brick::Brick(int tag,
 	     NDMaterial &theMaterial,
 	     double b1, double b2, double b3)
   :Element(tag, ELE_TAG_Brick),
-   connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
+   connectedExternalNodes(8), applyLoad(0), load(0), Ki(0), batchPoint(-1)
 {
   B.Zero();
 
@@ -385,7 +389,6 @@ const Matrix&  Brick::getInitialStiff( )
     return *Ki;
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
-  static const int ndm = 3 ;
   static const int ndf = 3 ; 
   static const int nstress = 6 ;
   static const int numberNodes = 8 ;
@@ -396,13 +399,8 @@ const Matrix&  Brick::getInitialStiff( )
   int jj, kk ;
 
   
-  static double volume ;
-  static double xsj ;  // determinant jacaobian matrix 
-  static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
   static Vector strain(nstress) ;  //strain
   static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
   static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
   static Matrix dd(nstress,nstress) ;  //material tangent
 
@@ -423,42 +421,10 @@ const Matrix&  Brick::getInitialStiff( )
   //zero stiffness and residual 
   stiff.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
-
-	count++ ;
-
-      } // end for k
-    } // end for j
-  } // end for i 
+  //shape functions and volume elements, shared by bricks of the same geometry
+  const double *shapeData = getShapeData( ) ;
+  const double (*Shape)[numberNodes][numberGauss] = (const double (*)[numberNodes][numberGauss])shapeData ;
+  const double *dvol = shapeData + nShape*numberNodes*numberGauss ;
   
 
   //gauss loop 
@@ -660,8 +626,6 @@ const Vector&  Brick::getResistingForceIncInertia( )
 void   Brick::formInertiaTerms( int tangFlag ) 
 {
 
-  static const int ndm = 3 ;
-
   static const int ndf = 3 ; 
 
   static const int numberNodes = 8 ;
@@ -672,16 +636,8 @@ void   Brick::formInertiaTerms( int tangFlag )
 
   static const int massIndex = nShape - 1 ;
 
-  double xsj ;  // determinant jacaobian matrix 
-
-  double dvol[numberGauss] ; //volume element
-
   static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
-  static double gaussPoint[ndm] ;
-
   static Vector momentum(ndf) ;
 
   int i, j, k, p, q ;
@@ -693,39 +649,10 @@ void   Brick::formInertiaTerms( int tangFlag )
   //zero mass 
   mass.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
+  //shape functions and volume elements, shared by bricks of the same geometry
+  const double *shapeData = getShapeData( ) ;
+  const double (*Shape)[numberNodes][numberGauss] = (const double (*)[numberNodes][numberGauss])shapeData ;
+  const double *dvol = shapeData + nShape*numberNodes*numberGauss ;
   
 
 
@@ -794,91 +721,107 @@ void   Brick::formInertiaTerms( int tangFlag )
 }
 
 //*********************************************************************
-//form residual and tangent
+//send the gauss point strains to the materials
 int  
 Brick::update(void) 
 {
+  static const int nstress = 6 ;
 
-  //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
+  static const int numberGauss = 8 ;
 
-  static const int ndm = 3 ;
+  static double strains[nstress*numberGauss] ;  //strains at all gauss points
 
-  static const int ndf = 3 ; 
+  formStrains( strains ) ;
 
-  static const int nstress = 6 ;
- 
-  static const int numberNodes = 8 ;
+  //send the strains to the materials in one batch
+  materialPointers[0]->setTrialStrains( materialPointers, numberGauss, strains ) ;
 
-  static const int numberGauss = 8 ;
+  return 0;
+}
 
-  static const int nShape = 4 ;
 
-  int i, j, k, p, q ;
-  int success ;
-  
-  static double volume ;
+//*********************************************************************
+//add the gauss points to a batch shared with other elements
+int
+Brick::addMaterialPoints(NDMaterialBatch &theBatch)
+{
+  batchPoint = theBatch.addPoint( materialPointers[0] ) ;
+  for ( int i = 1; i < 8; i++ )
+    theBatch.addPoint( materialPointers[i] ) ;
 
-  static double xsj ;  // determinant jacaobian matrix 
+  return 0;
+}
 
-  static double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+//*********************************************************************
+//set the gauss point strains in the batch, in place of update()
+int
+Brick::setMaterialBatchStrains(NDMaterialBatch &theBatch)
+{
+  static const int nstress = 6 ;
 
-  static Vector strain(nstress) ;  //strain
+  static const int numberGauss = 8 ;
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static double strains[nstress*numberGauss] ;  //strains at all gauss points
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static Vector strain(nstress) ;
 
-  //---------B-matrices------------------------------------
+  if ( batchPoint < 0 )
+    return -1;
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+  formStrains( strains ) ;
 
-    static Matrix BJtran(ndf,nstress) ;
+  for ( int i = 0; i < numberGauss; i++ ) {
+    for ( int p = 0; p < nstress; p++ )
+      strain(p) = strains[p*numberGauss + i] ;
+    if ( theBatch.setTrialStrain( batchPoint + i, strain ) < 0 )
+      return -1;
+  }
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+  return 0;
+}
 
-    static Matrix BJtranD(ndf,nstress) ;
 
-  //-------------------------------------------------------
+//*********************************************************************
+//strains at the gauss points, component-major
+void
+Brick::formStrains( double *strains )
+{
 
-  
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
+  //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
 
-  //gauss loop to compute and save shape functions 
+  static const int ndf = 3 ; 
 
-  int count = 0 ;
-  volume = 0.0 ;
+  static const int nstress = 6 ;
+ 
+  static const int numberNodes = 8 ;
 
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
+  static const int numberGauss = 8 ;
 
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
+  static const int nShape = 4 ;
 
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
+  int i, j, p, q ;
+  
+  static Vector strain(nstress) ;  //strain
 
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
+  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
+  //---------B-matrices------------------------------------
 
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
+    static Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-	//volume += dvol[count] ;
+    static Matrix BJtran(ndf,nstress) ;
 
-	count++ ;
+    static Matrix BK(nstress,ndf) ;      // B matrix node k
+
+    static Matrix BJtranD(ndf,nstress) ;
+
+  //-------------------------------------------------------
 
-      } //end for k
-    } //end for j
-  } // end for i 
+  
+  //shape functions and volume elements, shared by bricks of the same geometry
+  const double *shapeData = getShapeData( ) ;
+  const double (*Shape)[numberNodes][numberGauss] = (const double (*)[numberNodes][numberGauss])shapeData ;
   
 
   //gauss loop 
@@ -952,12 +895,12 @@ Brick::update(void)
 
     } // end for j
     
-    //send the strain to the material 
-    success = materialPointers[i]->setTrialStrain( strain ) ;
+    //save the strain, component-major over the gauss points
+    for ( p = 0; p < nstress; p++ )
+      strains[p*numberGauss + i] = strain(p) ;
 
   } //end for i gauss loop 
 
-  return 0;
 }
 
 
@@ -968,8 +911,6 @@ void  Brick::formResidAndTangent( int tang_flag )
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
 
-  static const int ndm = 3 ;
-
   static const int ndf = 3 ; 
 
   static const int nstress = 6 ;
@@ -983,18 +924,8 @@ void  Brick::formResidAndTangent( int tang_flag )
   int i, j, k, p, q ;
 
 
-  static double volume ;
-
-  static double xsj ;  // determinant jacaobian matrix 
-
-  static double dvol[numberGauss] ; //volume element
-
-  static double gaussPoint[ndm] ;
-
   static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
   static Vector residJ(ndf) ; //nodeJ residual 
 
   static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
@@ -1003,6 +934,10 @@ void  Brick::formResidAndTangent( int tang_flag )
 
   static Matrix dd(nstress,nstress) ;  //material tangent
 
+  static double stresses[nstress*numberGauss] ;  //stresses at all gauss points
+
+  static double tangents[nstress*nstress*numberGauss] ;  //tangents at all gauss points
+
 
   //---------B-matrices------------------------------------
 
@@ -1021,44 +956,16 @@ void  Brick::formResidAndTangent( int tang_flag )
   stiff.Zero( ) ;
   resid.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
+  //shape functions and volume elements, shared by bricks of the same geometry
+  const double *shapeData = getShapeData( ) ;
+  const double (*Shape)[numberNodes][numberGauss] = (const double (*)[numberNodes][numberGauss])shapeData ;
+  const double *dvol = shapeData + nShape*numberNodes*numberGauss ;
   
 
+  //get the stresses and tangents of all gauss points in one batch
+  materialPointers[0]->getResponses( materialPointers, numberGauss, stresses,
+                                     tang_flag == 1 ? tangents : nullptr ) ;
+
   //gauss loop 
   for ( i = 0; i < numberGauss; i++ ) {
 
@@ -1070,14 +977,18 @@ void  Brick::formResidAndTangent( int tang_flag )
 
 
     //compute the stress
-    stress = materialPointers[i]->getStress( ) ;
+    for ( p = 0; p < nstress; p++ )
+      stress(p) = stresses[p*numberGauss + i] ;
 
 
     //multiply by volume element
     stress  *= dvol[i] ;
 
     if ( tang_flag == 1 ) {
-      dd = materialPointers[i]->getTangent( ) ;
+      for ( p = 0; p < nstress; p++ ) {
+        for ( q = 0; q < nstress; q++ )
+          dd(p,q) = tangents[(p*nstress + q)*numberGauss + i] ;
+      } // end for p
       dd *= dvol[i] ;
     } //end if tang_flag
 
@@ -1203,6 +1114,75 @@ void   Brick::computeBasis( )
 
 }
 
+
+//*************************************************************************
+//shape functions at the gauss points, Shape[4][8][8] followed by dvol[8]
+
+const double*  Brick::getShapeData( ) 
+{
+  static double work[4*8*8 + 8] ;
+
+  computeBasis( ) ;
+
+  return shapes.find( &xl[0][0], work ) ;
+}
+
+
+void  Brick::computeShapeData( const double *crds, double *data ) 
+{
+  static const int numberNodes = 8 ;
+
+  static const int numberGauss = 8 ;
+
+  static const int nShape = 4 ;
+
+  double xsj ;  // determinant jacaobian matrix 
+
+  double gaussPoint[3] ;
+
+  double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+
+  double xlocal[3][numberNodes] ;
+
+  int i, j, k, p, q ;
+
+  for ( p = 0; p < 3; p++ ) {
+    for ( q = 0; q < numberNodes; q++ )
+      xlocal[p][q] = crds[p*numberNodes + q] ;
+  }
+
+  double *dvol = data + nShape*numberNodes*numberGauss ;
+
+  int count = 0 ;
+
+  for ( i = 0; i < 2; i++ ) {
+    for ( j = 0; j < 2; j++ ) {
+      for ( k = 0; k < 2; k++ ) {
+
+        gaussPoint[0] = sg[i] ;        
+	gaussPoint[1] = sg[j] ;        
+	gaussPoint[2] = sg[k] ;
+
+	//get shape functions    
+	shp3d( gaussPoint, xsj, shp, xlocal ) ;
+
+	//save shape functions
+	for ( p = 0; p < nShape; p++ ) {
+	  for ( q = 0; q < numberNodes; q++ )
+	    data[(p*numberNodes + q)*numberGauss + count] = shp[p][q] ;
+	} // end for p
+
+	//volume element to also be saved
+	dvol[count] = wg[count] * xsj ;  
+
+	count++ ;
+
+      } //end for k
+    } //end for j
+  } // end for i 
+
+}
+
 //*************************************************************************
 //compute B
 
@@ -42,6 +42,8 @@
 #include <Node.h>
 #include <NDMaterial.h>
 
+class ShapeFunctionCache ;
+
 
 class Brick : public Element {
 
@@ -94,6 +96,10 @@ class Brick : public Element {
     // update
     int update(void);
 
+    // grouped update through a NDMaterialBatch
+    int addMaterialPoints(NDMaterialBatch &theBatch);
+    int setMaterialBatchStrains(NDMaterialBatch &theBatch);
+
     //print out element data
     void Print( OPS_Stream &s, int flag ) ;
 	
@@ -145,6 +151,8 @@ class Brick : public Element {
     Vector *load;
     Matrix *Ki;
 
+    int batchPoint;             // index of the first material point in the batch
+
     //
     // static attributes
     //
@@ -163,6 +171,9 @@ class Brick : public Element {
     //local nodal coordinates, three coordinates for each of four nodes
     static double xl[3][8] ; 
 
+    //gauss point data shared by bricks of the same geometry
+    static ShapeFunctionCache shapes ;
+
     //
     // private methods
     //
@@ -173,9 +184,16 @@ class Brick : public Element {
     //form residual and tangent					  
     void formResidAndTangent( int tang_flag ) ;
 
+    //strains at the gauss points, component-major
+    void formStrains( double *strains ) ;
+
     //compute coordinate system
     void computeBasis( ) ;
 
+    //shape functions and volume elements at the gauss points
+    const double *getShapeData( ) ;
+    static void computeShapeData( const double *xl, double *data ) ;
+
     //compute B matrix
     const Matrix& computeB( int node, const double shp[4][8] ) ;
   
@@ -39,12 +39,12 @@
 #include <Node.h>
 #include <Domain.h>
 
-Element  *ops_TheActiveElement = 0;
+thread_local Element *ops_TheActiveElement = 0;
 
-Matrix **Element::theMatrices; 
-Vector **Element::theVectors1; 
-Vector **Element::theVectors2; 
-int  Element::numMatrices(0);
+thread_local Matrix **Element::theMatrices; 
+thread_local Vector **Element::theVectors1; 
+thread_local Vector **Element::theVectors2; 
+thread_local int  Element::numMatrices(0);
 
 // Element(int tag, int noExtNodes);
 // 	constructor that takes the element's unique tag and the number
@@ -53,8 +53,8 @@ int  Element::numMatrices(0);
 Element::Element(int tag, int cTag) 
   :DomainComponent(tag, cTag), alphaM(0.0), 
   betaK(0.0), betaK0(0.0), betaKc(0.0), 
-      Kc(0), previousK(0), numPreviousK(0), index(-1), nodeIndex(-1)
-      /* is_this_element_active(true) */
+      Kc(0), previousK(0), numPreviousK(0), index(-1), nodeIndex(-1),
+      is_this_element_active(true)
 {
   // does nothing
   ops_TheActiveElement = this;
@@ -81,12 +81,43 @@ Element::commitState(void)
   return 0;
 }
 
+unsigned long
+Element::getStateSignature(unsigned long epoch)
+{
+  // the trial revisions of the nodes only grow, so the sum changes
+  // whenever any of them does
+  Node **theNodes = this->getNodePtrs();
+  if (theNodes == nullptr)
+    return 0;
+
+  unsigned long signature = epoch;
+  int numNodes = this->getNumExternalNodes();
+  for (int i = 0; i < numNodes; i++) {
+    if (theNodes[i] == nullptr)
+      return 0;
+    signature += theNodes[i]->getTrialRevision();
+  }
+  return signature;
+}
+
 int
 Element::update(void)
 {
     return 0;
 }
 
+int
+Element::addMaterialPoints(NDMaterialBatch &theBatch)
+{
+    return -1;
+}
+
+int
+Element::setMaterialBatchStrains(NDMaterialBatch &theBatch)
+{
+    return -1;
+}
+
 int
 Element::revertToStart(void)
 {
@@ -117,8 +148,9 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
 
   // check that memory has been allocated to store compute/return
   // damping matrix & residual force calculations
-  if (index == -1) {
+  if (this->hasScratchIndex() == false) {
     int numDOF = this->getNumDOF();
+    index = -1;
 
     for (int i=0; i<numMatrices; i++) {
       Matrix *aMatrix = theMatrices[i];
@@ -183,10 +215,22 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
   return 0;
 }
 
+// 
+// The matrices and vectors are shared by the elements of a thread; an
+// index found on another thread, e.g. when a model is built on one and
+// analyzed on another, is found again on this thread.
+//
+bool
+Element::hasScratchIndex(void)
+{
+  return index >= 0 && index < numMatrices &&
+    theMatrices[index]->noRows() == this->getNumDOF();
+}
+
 const Matrix &
 Element::getDamp(void) 
 {
-  if (index  == -1) {
+  if (this->hasScratchIndex() == false) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
@@ -209,7 +253,7 @@ Element::getDamp(void)
 const Matrix &
 Element::getMass(void)
 {
-  if (index  == -1) {
+  if (this->hasScratchIndex() == false) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
@@ -222,7 +266,7 @@ Element::getMass(void)
 const Vector &
 Element::getResistingForceIncInertia(void) 
 {
-  if (index == -1) {
+  if (this->hasScratchIndex() == false) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
@@ -289,7 +333,7 @@ const Vector &
 Element::getRayleighDampingForces(void) 
 {
 
-  if (index == -1) {
+  if (this->hasScratchIndex() == false) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
@@ -399,7 +443,7 @@ Element::setResponse(const char **argv, int argc, OPS_Stream &output)
   output.attr("eleTag",this->getTag());
   int numNodes = this->getNumExternalNodes();
   const ID &nodes = this->getExternalNodes();
-  static char nodeData[32];
+  static thread_local char nodeData[32];
 
   for (int i=0; i<numNodes; i++) {
     sprintf(nodeData,"node%d",i+1);
@@ -482,7 +526,7 @@ Element::getResponseSensitivity(int responseID, int gradIndex,
 const Vector &
 Element::getResistingForceSensitivity(int gradIndex)
 {
-  if (index == -1) {
+  if (this->hasScratchIndex() == false) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
@@ -495,7 +539,7 @@ Element::getResistingForceSensitivity(int gradIndex)
 const Matrix &
 Element::getTangentStiffSensitivity(int gradIndex)
 {
-  if (index == -1) {
+  if (this->hasScratchIndex() == false) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
@@ -515,7 +559,7 @@ const Matrix &
 
 Element::getInitialStiffSensitivity(int gradIndex)
 {
-  if (index == -1) {
+  if (this->hasScratchIndex() == false) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
@@ -534,7 +578,7 @@ Element::getInitialStiffSensitivity(int gradIndex)
 const Matrix &
 Element::getCommittedStiffSensitivity(int gradIndex)
 {
-  if (index == -1) {
+  if (this->hasScratchIndex() == false) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
@@ -553,7 +597,7 @@ Element::getCommittedStiffSensitivity(int gradIndex)
 const Matrix &
 Element::getMassSensitivity(int gradIndex)
 {
-  if (index == -1) {
+  if (this->hasScratchIndex() == false) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
@@ -583,7 +627,7 @@ Element::addInertiaLoadSensitivityToUnbalance(const Vector &accel, bool tag)
 const Matrix &
 Element::getDampSensitivity(int gradIndex) 
 {
-  if (index  == -1) {
+  if (this->hasScratchIndex() == false) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
@@ -615,7 +659,7 @@ Element::addResistingForceToNodalReaction(int flag)
   int numNodes = this->getNumExternalNodes();
   Node **theNodes = this->getNodePtrs();
 
-  static Vector theVector(48);
+  static thread_local Vector theVector(48);
 
   //
   // now determine the resisting force
@@ -743,7 +787,7 @@ Element::displaySelf(Renderer &, int mode, float fact, const char **displayModes
 const Matrix &
 Element::getGeometricTangentStiff()
 {
-    if (index == -1) {
+    if (this->hasScratchIndex() == false) {
 	this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
     }
     
@@ -753,52 +797,28 @@ Element::getGeometricTangentStiff()
     return *theMatrix;
 }
 
-#if 0
-void Element::activate()
+void
+Element::activate()
 {
-    // opserr << "Activating element # " << this->getTag() << endln;
-    is_this_element_active = true;
-    this->onActivate();
+  is_this_element_active = true;
+  this->onActivate();
 }
 
-void Element::deactivate()
+void
+Element::deactivate()
 {
-    // opserr << "Deactivating element # " << this->getTag() << endln;
-    is_this_element_active = false;
-    this->onDeactivate();
+  is_this_element_active = false;
+  this->onDeactivate();
 }
 
-void Element::onActivate()
+void
+Element::onActivate()
 {
-    static bool report_once = true;
-    if (report_once)
-    {
-        opserr << "onActivate not implemented for this element. classTag = " << this->getClassTag() << endln;
-        report_once = false;
-    }
+  // an element that is born from its current state needs no action
 }
 
-void Element::onDeactivate()
-{   static bool report_once = true;
-    if (report_once)
-    {
-        opserr << "onDeactivate not implemented for this element. classTag = " << this->getClassTag() << endln;
-        report_once = false;
-    }
-}    
-
-
-bool  Element::isActive()
+void
+Element::onDeactivate()
 {
-    // opserr << "Element::isActive() [tag = " << this->getTag() << "] = ";
-    // if (is_this_element_active)
-    // {
-    //     opserr << "TRUE" << endln;
-    // }
-    // else
-    // {
-    //     opserr << "FALSE" << endln;
-    // }
-    return is_this_element_active;
+
 }
-#endif
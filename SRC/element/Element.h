@@ -46,6 +46,7 @@ class Info;
 class Response;
 class ElementalLoad;
 class Node;
+class NDMaterialBatch;
 
 class Element : public DomainComponent
 {
@@ -66,6 +67,21 @@ class Element : public DomainComponent
     virtual int revertToStart(void);                
     virtual int update(void);
     virtual bool isSubdomain(void);
+
+    // bookkeeping for incremental state determination: the signature of
+    // the nodal trial state is 0 when it cannot be formed, and the update
+    // signature is the one seen at the last Domain::update() of the element
+    unsigned long getStateSignature(unsigned long epoch);
+    unsigned long getUpdateSignature(void) const {return updateSignature;}
+    void setUpdateSignature(unsigned long signature) {updateSignature = signature;}
+
+    // grouped state determination of nD material points: an element that
+    // supports it adds its points to the batch once, and then in place of
+    // update() sets their trial strains in the batch, which the Domain
+    // evaluates for all such elements at once; both return -1 if the
+    // element does not take part
+    virtual int addMaterialPoints(NDMaterialBatch &theBatch);
+    virtual int setMaterialBatchStrains(NDMaterialBatch &theBatch);
     
     // methods to return the current linearized stiffness,
     // damping and mass matrices
@@ -111,15 +127,16 @@ class Element : public DomainComponent
 
     virtual int storePreviousK(int numK);
     virtual const Matrix *getPreviousK(int num);
-#if 0
+    // element birth and death; an inactive element stays in the model,
+    // and so in the graph of the system of equations, but is neither
+    // updated nor assembled
     virtual void onActivate();
     virtual void onDeactivate();
 
     void activate();
     void deactivate();
 
-    bool isActive();
-#endif
+    bool isActive() const {return is_this_element_active;}
 
 
 protected:
@@ -132,14 +149,16 @@ protected:
     int numPreviousK;
 
   private:
+    bool hasScratchIndex(void);
 
     int index, nodeIndex;
-    static Matrix ** theMatrices; 
-    static Vector ** theVectors1; 
-    static Vector ** theVectors2; 
-    static int numMatrices;
+    static thread_local Matrix ** theMatrices; 
+    static thread_local Vector ** theVectors1; 
+    static thread_local Vector ** theVectors2; 
+    static thread_local int numMatrices;
 
     bool is_this_element_active;
+    unsigned long updateSignature = 0;
 
 };
 
@@ -54,9 +54,9 @@
 
 #include <map>
 
-Matrix ElasticBeam2d::K(6,6);
-Vector ElasticBeam2d::P(6);
-Matrix ElasticBeam2d::kb(3,3);
+thread_local Matrix ElasticBeam2d::K(6,6);
+thread_local Vector ElasticBeam2d::P(6);
+thread_local Matrix ElasticBeam2d::kb(3,3);
 
 void *OPS_DECL_RUNTIME_VPID(OPS_ElasticBeam2d, const ID &info) {
     /*!
@@ -625,7 +625,7 @@ ElasticBeam2d::getMass(void)
             K(0,0) = K(1,1) = K(3,3) = K(4,4) = m;
         } else  {
             // consistent mass matrix
-            static Matrix ml(6,6);
+            static thread_local Matrix ml(6,6);
             double m = rho*L/420.0;
             ml(0,0) = ml(3,3) = m*140.0;
             ml(0,3) = ml(3,0) = m*70.0;
@@ -844,7 +844,7 @@ ElasticBeam2d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(4) -= m * Raccel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(6);
+    static thread_local Vector Raccel(6);
     for (int i=0; i<3; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+3) = Raccel2(i);
@@ -886,7 +886,7 @@ ElasticBeam2d::getResistingForceIncInertia()
     P(4) += m * accel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(6);
+    static thread_local Vector accel(6);
     for (int i=0; i<3; i++)  {
       accel(i)   = accel1(i);
       accel(i+3) = accel2(i);
@@ -947,7 +947,7 @@ ElasticBeam2d::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
 
-    static Vector data(17);
+    static thread_local Vector data(17);
     
     data(0) = A;
     data(1) = E; 
@@ -999,7 +999,7 @@ ElasticBeam2d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBrok
 {
     int res = 0;
 	
-    static Vector data(17);
+    static thread_local Vector data(17);
 
     res += theChannel.recvVector(this->getDbTag(), cTag, data);
     if (res < 0) {
@@ -1105,9 +1105,9 @@ ElasticBeam2d::Print(OPS_Stream &s, int flag)
 int
 ElasticBeam2d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numMode)
 {
-  static Vector v1(3);
-  static Vector v2(3);
-  static Vector vp(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
+  static thread_local Vector vp(3);
 
   theNodes[0]->getDisplayCrds(v1, fact, displayMode);
   theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -1140,7 +1140,7 @@ ElasticBeam2d::displaySelf(Renderer &theViewer, int displayMode, float fact, con
 
       d1 = q(1);
       d2 = q(2);
-      static Vector delta(3); delta = v2-v1; delta/=20.;
+      static thread_local Vector delta(3); delta = v2-v1; delta/=20.;
       res += theViewer.drawPoint(v1+delta, d1, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d2, this->getTag(), i);
 
@@ -1148,7 +1148,7 @@ ElasticBeam2d::displaySelf(Renderer &theViewer, int displayMode, float fact, con
       d1 = q(0);
       d2 = q(1);
       d3 = q(2);
-      static Vector delta(3); delta = v2-v1; delta/=20;
+      static thread_local Vector delta(3); delta = v2-v1; delta/=20;
       res += theViewer.drawPoint(v1+delta, d2, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d3, this->getTag(), i);
       res +=theViewer.drawLine(v1, v2, d1, d1, this->getTag(), i);
@@ -1161,7 +1161,7 @@ ElasticBeam2d::displaySelf(Renderer &theViewer, int displayMode, float fact, con
 
       d1 = vp(1);
       d2 = vp(2);
-      static Vector delta(3); delta = v2-v1; delta/=20.;
+      static thread_local Vector delta(3); delta = v2-v1; delta/=20.;
       res += theViewer.drawPoint(v1+delta, d1, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d2, this->getTag(), i);
 
@@ -1169,7 +1169,7 @@ ElasticBeam2d::displaySelf(Renderer &theViewer, int displayMode, float fact, con
       d1 = vp(0);
       d2 = vp(1);
       d3 = vp(2);
-      static Vector delta(3); delta = v2-v1; delta/=20;
+      static thread_local Vector delta(3); delta = v2-v1; delta/=20;
       res += theViewer.drawPoint(v1+delta, d2, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d3, this->getTag(), i);
       res +=theViewer.drawLine(v1, v2, d1, d1, this->getTag(), i);
@@ -1178,7 +1178,7 @@ ElasticBeam2d::displaySelf(Renderer &theViewer, int displayMode, float fact, con
       d1 = 0.;
       d2 = 0.;
       d3 = 0.;
-      static Vector delta(3); delta = v2-v1; delta/=20;
+      static thread_local Vector delta(3); delta = v2-v1; delta/=20;
       res += theViewer.drawPoint(v1+delta, d2, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d3, this->getTag(), i);
       res +=theViewer.drawLine(v1, v2, d1, d1, this->getTag(), i);
@@ -50,9 +50,9 @@
 #include <string>
 #include <elementAPI.h>
 
-Matrix ElasticBeam3d::K(12,12);
-Vector ElasticBeam3d::P(12);
-Matrix ElasticBeam3d::kb(6,6);
+thread_local Matrix ElasticBeam3d::K(12,12);
+thread_local Vector ElasticBeam3d::P(12);
+thread_local Matrix ElasticBeam3d::kb(6,6);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ElasticBeam3d)
 {
@@ -538,7 +538,7 @@ ElasticBeam3d::getMass(void)
             K(8,8) = m;
         } else  {
             // consistent mass matrix
-            static Matrix ml(12,12);
+            static thread_local Matrix ml(12,12);
             double m = rho*L/420.0;
             ml(0,0) = ml(6,6) = m*140.0;
             ml(0,6) = ml(6,0) = m*70.0;
@@ -770,7 +770,7 @@ ElasticBeam3d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(8) -= m * Raccel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(12);
+    static thread_local Vector Raccel(12);
     for (int i=0; i<6; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+6) = Raccel2(i);
@@ -813,7 +813,7 @@ ElasticBeam3d::getResistingForceIncInertia()
     P(8) += m * accel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(12);
+    static thread_local Vector accel(12);
     for (int i=0; i<6; i++)  {
       accel(i)   = accel1(i);
       accel(i+6) = accel2(i);
@@ -903,7 +903,7 @@ ElasticBeam3d::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(19);
+    static thread_local Vector data(19);
     
     data(0) = A;
     data(1) = E; 
@@ -956,7 +956,7 @@ int
 ElasticBeam3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(19);
+  static thread_local Vector data(19);
 
   res += theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
@@ -1058,9 +1058,9 @@ ElasticBeam3d::Print(OPS_Stream &s, int flag)
 	else if (flag == 2) {
 		this->getResistingForce(); // in case linear algo
 
-		static Vector xAxis(3);
-		static Vector yAxis(3);
-		static Vector zAxis(3);
+		static thread_local Vector xAxis(3);
+		static thread_local Vector yAxis(3);
+		static thread_local Vector zAxis(3);
 
 		theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
@@ -1151,8 +1151,8 @@ ElasticBeam3d::Print(OPS_Stream &s, int flag)
 int
 ElasticBeam3d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numMode)
 {
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
 
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -1182,7 +1182,7 @@ ElasticBeam3d::displaySelf(Renderer &theViewer, int displayMode, float fact, con
     } else if (strcmp(theMode, "endMoments") == 0) {
       d1 = q(1);
       d2 = q(2);
-      static Vector delta(3); delta = v2-v1; delta/=10;
+      static thread_local Vector delta(3); delta = v2-v1; delta/=10;
       res += theViewer.drawPoint(v1+delta, d1, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d2, this->getTag(), i);
       
@@ -1301,9 +1301,9 @@ ElasticBeam3d::getResponse (int responseID, Information &eleInfo)
   double N, V, M1, M2, T;
   double L = theCoordTransf->getInitialLength();
   double oneOverL = 1.0/L;
-  static Vector Res(12);
+  static thread_local Vector Res(12);
   Res = this->getResistingForce();
-  static Vector s(6);
+  static thread_local Vector s(6);
   
   switch (responseID) {
   case 1: // stiffness
@@ -1368,9 +1368,9 @@ ElasticBeam3d::getResponse (int responseID, Information &eleInfo)
   }
 
   if (responseID >= 201 && responseID <= 203) {
-    static Vector xlocal(3);
-    static Vector ylocal(3);
-    static Vector zlocal(3);
+    static thread_local Vector xlocal(3);
+    static thread_local Vector ylocal(3);
+    static thread_local Vector zlocal(3);
     
     theCoordTransf->getLocalAxes(xlocal,ylocal,zlocal);
     
@@ -83,6 +83,7 @@ using std::ifstream;
 #include <CompositeResponse.h>
 #include <ElementalLoad.h>
 #include <ElementIter.h>
+#include <MatrixND.h>
 
 #define DefaultLoverGJ 1.0e-10
 
@@ -489,7 +490,9 @@ ForceBeamColumn3d::getInitialStiff(void)
   // invert3by3Matrix(f, kv);
   static Matrix kvInit(NEBD, NEBD);
   // if (f.Solve(I, kvInit) < 0)
-  if (f.Invert(kvInit) < 0)
+  OpenSees::MatrixND<NEBD,NEBD> fn;
+  fn = f;
+  if (fn.invert(kvInit) < 0)
     opserr << "ForceBeamColumn3d::getInitialStiff -- could not invert flexibility";
 
     Ki = new Matrix(crdTransf->getInitialGlobalStiffMatrix(kvInit));
@@ -1054,7 +1057,9 @@ ForceBeamColumn3d::update()
             // FRANK
             // if (f.SolveSVD(I, kvTrial, 1.0e-12) < 0)
             // if (f.Solve(I, kvTrial) < 0)
-            if (f.Invert(kvTrial) < 0)
+            OpenSees::MatrixND<NEBD,NEBD> fn;
+            fn = f;
+            if (fn.invert(kvTrial) < 0)
               opserr << "ForceBeamColumn3d::update -- could not invert flexibility\n";
             
             // dv = vin + dvTrial  - vr
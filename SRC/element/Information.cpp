@@ -30,28 +30,32 @@
 
 Information::Information() 
   :theType(UnknownType),
-   theID(0), theVector(0), theMatrix(0), theString(0)
+   theID(0), theVector(0), theMatrix(0), theString(0),
+  theOutput(0), outputSize(0), outputWritten(false)
 {
     // does nothing
 }
 
 Information::Information(int val) 
   :theType(IntType), theInt(val),
-  theID(0), theVector(0), theMatrix(0), theString(0)
+  theID(0), theVector(0), theMatrix(0), theString(0),
+  theOutput(0), outputSize(0), outputWritten(false)
 {
     // does nothing
 }
 
 Information::Information(double val) 
   :theType(DoubleType), theDouble(val),
-  theID(0), theVector(0), theMatrix(0), theString(0)
+  theID(0), theVector(0), theMatrix(0), theString(0),
+  theOutput(0), outputSize(0), outputWritten(false)
 {
   // does nothing
 }
 
 Information::Information(const ID &val) 
   :theType(IdType),
-  theID(0), theVector(0), theMatrix(0), theString(0)
+  theID(0), theVector(0), theMatrix(0), theString(0),
+  theOutput(0), outputSize(0), outputWritten(false)
 {
   // Make a copy
   theID = new ID(val);
@@ -62,7 +66,8 @@ Information::Information(const ID &val)
 
 Information::Information(const Vector &val) 
   :theType(VectorType),
-  theID(0), theVector(0), theMatrix(0), theString(0)
+  theID(0), theVector(0), theMatrix(0), theString(0),
+  theOutput(0), outputSize(0), outputWritten(false)
 {
   // Make a copy
   theVector = new Vector(val);
@@ -73,7 +78,8 @@ Information::Information(const Vector &val)
 
 Information::Information(const Matrix &val) 
   :theType(MatrixType),
-   theID(0), theVector(0), theMatrix(0), theString(0)
+   theID(0), theVector(0), theMatrix(0), theString(0),
+  theOutput(0), outputSize(0), outputWritten(false)
 {
   // Make a copy
   theMatrix = new Matrix(val);
@@ -84,7 +90,8 @@ Information::Information(const Matrix &val)
 
 Information::Information(const ID &val1, const Vector &val2) 
   :theType(IdType),
-   theID(0), theVector(0), theMatrix(0), theString(0)
+   theID(0), theVector(0), theMatrix(0), theString(0),
+  theOutput(0), outputSize(0), outputWritten(false)
 {
   // Make a copy
   theID = new ID(val1);
@@ -112,6 +119,11 @@ int
 Information::setInt(int newInt)
 {
   theInt = newInt;
+
+  if (theOutput != 0 && theType == IntType && outputSize == 1) {
+    theOutput[0] = newInt;
+    outputWritten = true;
+  }
   
   return 0;
 }
@@ -120,6 +132,11 @@ int
 Information::setDouble(double newDouble)
 {
   theDouble = newDouble;
+
+  if (theOutput != 0 && theType == DoubleType && outputSize == 1) {
+    theOutput[0] = newDouble;
+    outputWritten = true;
+  }
   
   return 0;
 }
@@ -127,6 +144,13 @@ Information::setDouble(double newDouble)
 int 
 Information::setID(const ID &newID)
 {
+  if (theOutput != 0 && theType == IdType && outputSize == newID.Size()) {
+    for (int i=0; i<outputSize; i++)
+      theOutput[i] = newID(i);
+    outputWritten = true;
+    return 0;
+  }
+
   if (theID != 0) {
     *theID = newID;
   } else {
@@ -138,6 +162,13 @@ Information::setID(const ID &newID)
 int 
 Information::setVector(const Vector &newVector)
 {
+  if (theOutput != 0 && theType == VectorType && outputSize == newVector.Size()) {
+    for (int i=0; i<outputSize; i++)
+      theOutput[i] = newVector(i);
+    outputWritten = true;
+    return 0;
+  }
+
   if (theVector != 0) {
     *theVector = newVector;
   } else {
@@ -150,6 +181,18 @@ Information::setVector(const Vector &newVector)
 int 
 Information::setMatrix(const Matrix &newMatrix)
 {
+  int noRows = newMatrix.noRows();
+  int noCols = newMatrix.noCols();
+  if (theOutput != 0 && theType == MatrixType && outputSize == noRows*noCols) {
+    // same order as getData()
+    int count = 0;
+    for (int i=0; i<noRows; i++)
+      for (int j=0; j<noCols; j++)
+	theOutput[count++] = newMatrix(i,j);
+    outputWritten = true;
+    return 0;
+  }
+
   if (theMatrix != 0) {
     *theMatrix = newMatrix;
   } else {
@@ -230,6 +273,16 @@ Information::Print(ofstream &s, int flag)
   return;
 }
 
+int
+Information::setOutput(double *output, int size)
+{
+  theOutput = output;
+  outputSize = size;
+  outputWritten = false;
+
+  return 0;
+}
+
 const Vector &
 Information::getData(void) 
 {
@@ -71,6 +71,11 @@ class Information
     VIRTUAL void Print(ofstream &s, int flag = 0);
     VIRTUAL const Vector &getData(void);
 
+    // storage, owned elsewhere, that the set methods write the data
+    // straight into when it is of the type and size getData() returns;
+    // outputWritten is set when they do
+    VIRTUAL int setOutput(double *output, int size);
+
     // data that is stored in the information object
     InfoType	theType;    // information about data type
     int		theInt;     // an integer value
@@ -80,6 +85,10 @@ class Information
     Matrix	*theMatrix; // pointer to a Matrix object, created elsewhere
     char        *theString; // pointer to string
 
+    double      *theOutput; // pointer to output storage, created elsewhere
+    int         outputSize;
+    bool        outputWritten;
+
   protected:
     
   private:        
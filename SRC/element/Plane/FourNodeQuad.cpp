@@ -38,6 +38,7 @@
 #include <Parameter.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <ShapeFunctionCache.h>
 #include <ElementResponse.h>
 #include <ElementalLoad.h>
 using namespace OpenSees;
@@ -109,10 +110,11 @@ void * OPS_ADD_RUNTIME_VPV(OPS_FourNodeQuad)
 #endif
 
 
-double FourNodeQuad::matrixData[64];
-Matrix FourNodeQuad::K(matrixData, 8, 8);
-Vector FourNodeQuad::P(8);
-double FourNodeQuad::shp[3][4];
+thread_local double FourNodeQuad::matrixData[64];
+thread_local Matrix FourNodeQuad::K(matrixData, 8, 8);
+thread_local Vector FourNodeQuad::P(8);
+thread_local double FourNodeQuad::shp[3][4];
+ShapeFunctionCache FourNodeQuad::shapes(4, 2, 13*nip, &FourNodeQuad::computeShapeData);
 // double FourNodeQuad::pts[4][2];
 // double FourNodeQuad::wts[4];
 
@@ -319,10 +321,12 @@ FourNodeQuad::update()
 
     int ret = 0;
 
+    const double *shapeData = this->getShapeData();
+
     // Loop over the integration points
     for (int i = 0; i < nip; i++) {
         // Determine Jacobian for this integration point
-        this->shapeFunction(pts[i][0], pts[i][1]);
+        this->shapeFunction(shapeData, i);
 
         // Interpolate strains
         //eps = B*u;
@@ -351,11 +355,13 @@ FourNodeQuad::getTangentStiff()
     double dvol;
     double DB[3][2];
 
+    const double *shapeData = this->getShapeData();
+
     // Loop over the integration points
     for (int i = 0; i < nip; i++) {
 
       // Determine Jacobian for this integration point
-      dvol = this->shapeFunction(pts[i][0], pts[i][1]);
+      dvol = this->shapeFunction(shapeData, i);
       dvol *= (thickness*wts[i]);
       
       // Get the material tangent
@@ -411,11 +417,13 @@ FourNodeQuad::getInitialStiff()
   double dvol;
   double DB[3][2];
   
+  const double *shapeData = this->getShapeData();
+
   // Loop over the integration points
   for (int i = 0; i < nip; i++) {
     
     // Determine Jacobian for this integration point
-    dvol = this->shapeFunction(pts[i][0], pts[i][1]);
+    dvol = this->shapeFunction(shapeData, i);
     dvol *= (thickness*wts[i]);
     
     // Get the material tangent
@@ -459,7 +467,7 @@ FourNodeQuad::getMass()
     K.Zero();
 
     int i;
-    static double rhoi[4];
+    static thread_local double rhoi[4];
     double sum = 0.0;
     for (i = 0; i < nip; i++) {
       if (rho == 0)
@@ -474,10 +482,12 @@ FourNodeQuad::getMass()
 
     double rhodvol, Nrho;
 
+    const double *shapeData = this->getShapeData();
+
     // Compute a lumped mass matrix
     for (int i = 0; i < 4; i++) {
         // Determine Jacobian for this integration point
-        rhodvol = this->shapeFunction(pts[i][0], pts[i][1]);
+        rhodvol = this->shapeFunction(shapeData, i);
 
         // Element plus material density ... MAY WANT TO REMOVE ELEMENT DENSITY
         rhodvol *= (rhoi[i]*thickness*wts[i]);
@@ -530,7 +540,7 @@ int
 FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int i;
-  static double rhoi[4];
+  static thread_local double rhoi[4];
   double sum = 0.0;
   for (i = 0; i < 4; i++) {
     rhoi[i] = theMaterial[i]->getRho();
@@ -552,7 +562,7 @@ FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
     return -1;
   }
   
-  static double ra[8];
+  static thread_local double ra[8];
   
   ra[0] = Raccel1(0);
   ra[1] = Raccel1(1);
@@ -581,10 +591,12 @@ FourNodeQuad::getResistingForce()
 
     double dvol;
 
+    const double *shapeData = this->getShapeData();
+
     // Loop over the integration points
     for (int i = 0; i < 4; i++) {
         // Determine Jacobian for this integration point
-        dvol = this->shapeFunction(pts[i][0], pts[i][1]);
+        dvol = this->shapeFunction(shapeData, i);
         dvol *= (thickness*wts[i]);
 
         // Get material stress response
@@ -627,7 +639,7 @@ const Vector&
 FourNodeQuad::getResistingForceIncInertia()
 {
     int i;
-    static double rhoi[4];
+    static thread_local double rhoi[4];
     double sum = 0.0;
     for (i = 0; i < 4; i++) {
       rhoi[i] = theMaterial[i]->getRho();
@@ -690,7 +702,7 @@ FourNodeQuad::sendSelf(int commitTag, Channel &theChannel)
   
   // Quad packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(9);
+  static thread_local Vector data(9);
   data(0) = this->getTag();
   data(1) = thickness;
   data(2) = b[0];
@@ -712,7 +724,7 @@ FourNodeQuad::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(12);
+  static thread_local ID idData(12);
   
   int i;
   for (i = 0; i < 4; i++) {
@@ -761,7 +773,7 @@ FourNodeQuad::recvSelf(int commitTag, Channel &theChannel,
 
   // Quad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(9);
+  static thread_local Vector data(9);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING FourNodeQuad::recvSelf() - failed to receive Vector\n";
@@ -779,7 +791,7 @@ FourNodeQuad::recvSelf(int commitTag, Channel &theChannel,
   betaK0 = data(7);
   betaKc = data(8);
 
-  static ID idData(12);
+  static thread_local ID idData(12);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -866,8 +878,8 @@ FourNodeQuad::Print(OPS_Stream &s, int flag)
     // spit out the section location & invoke print on the scetion
     const int numMaterials = 4;
 
-    static Vector avgStress(nstress);
-    static Vector avgStrain(nstress);
+    static thread_local Vector avgStress(nstress);
+    static thread_local Vector avgStrain(nstress);
     avgStress.Zero();
     avgStrain.Zero();
     for (i=0; i<numMaterials; i++) {
@@ -921,17 +933,17 @@ int
 FourNodeQuad::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numMode)
 {
     // get the end point display coords
-    static Vector v1(3);
-    static Vector v2(3);
-    static Vector v3(3);
-    static Vector v4(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
+    static thread_local Vector v3(3);
+    static thread_local Vector v4(3);
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
     theNodes[2]->getDisplayCrds(v3, fact, displayMode);
     theNodes[3]->getDisplayCrds(v4, fact, displayMode);
 
     // place values in coords matrix
-    static Matrix coords(4, 3);
+    static thread_local Matrix coords(4, 3);
     for (int i = 0; i < 3; i++) {
         coords(0, i) = v1(i);
         coords(1, i) = v2(i);
@@ -941,7 +953,7 @@ FourNodeQuad::displaySelf(Renderer &theViewer, int displayMode, float fact, cons
 
 // set the quantity to be displayed at the nodes;
 // if displayMode is 1 through 3 we will plot material stresses otherwise 0.0
-    static Vector values(4);
+    static thread_local Vector values(4);
     if (displayMode < 4 && displayMode > 0) {
         for (int i = 0; i < 4; i++) {
               const Vector& stress = theMaterial[i]->getStress();
@@ -1078,7 +1090,7 @@ FourNodeQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 3) {
 
     // Loop over the integration points
-    static Vector stresses(12);
+    static thread_local Vector stresses(12);
     int cnt = 0;
     for (int i = 0; i < 4; i++) {
 
@@ -1095,8 +1107,8 @@ FourNodeQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 11) {
 
     // extrapolate stress from Gauss points to element nodes
-    static Vector stressGP(12);      // 3*nip
-    static Vector stressAtNodes(12); // 3*nnodes
+    static thread_local Vector stressGP(12);      // 3*nip
+    static thread_local Vector stressAtNodes(12); // 3*nnodes
     stressAtNodes.Zero();
     int cnt = 0;
         // first get stress components (xx, yy, xy) at Gauss points
@@ -1132,7 +1144,7 @@ FourNodeQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 4) {
 
     // Loop over the integration points
-    static Vector stresses(12);
+    static thread_local Vector stresses(12);
     int cnt = 0;
     for (int i = 0; i < 4; i++) {
 
@@ -1230,13 +1242,8 @@ FourNodeQuad::updateParameter(int parameterID, Information &info)
   }
 }
 
-double FourNodeQuad::shapeFunction(double xi, double eta)
+double FourNodeQuad::shapeFunction(double xi, double eta, const double *xl)
 {
-    const Vector &nd1Crds = theNodes[0]->getCrds();
-    const Vector &nd2Crds = theNodes[1]->getCrds();
-    const Vector &nd3Crds = theNodes[2]->getCrds();
-    const Vector &nd4Crds = theNodes[3]->getCrds();
-
     double oneMinuseta = 1.0-eta;
     double onePluseta = 1.0+eta;
     double oneMinusxi = 1.0-xi;
@@ -1249,17 +1256,17 @@ double FourNodeQuad::shapeFunction(double xi, double eta)
 
     double J[2][2];
 
-    J[0][0] = 0.25 * (-nd1Crds(0)*oneMinuseta + nd2Crds(0)*oneMinuseta +
-                            nd3Crds(0)*(onePluseta) - nd4Crds(0)*(onePluseta));
+    J[0][0] = 0.25 * (-xl[0]*oneMinuseta + xl[1]*oneMinuseta +
+                            xl[2]*(onePluseta) - xl[3]*(onePluseta));
 
-    J[0][1] = 0.25 * (-nd1Crds(0)*oneMinusxi - nd2Crds(0)*onePlusxi +
-                            nd3Crds(0)*onePlusxi + nd4Crds(0)*oneMinusxi);
+    J[0][1] = 0.25 * (-xl[0]*oneMinusxi - xl[1]*onePlusxi +
+                            xl[2]*onePlusxi + xl[3]*oneMinusxi);
 
-    J[1][0] = 0.25 * (-nd1Crds(1)*oneMinuseta + nd2Crds(1)*oneMinuseta +
-                            nd3Crds(1)*onePluseta - nd4Crds(1)*onePluseta);
+    J[1][0] = 0.25 * (-xl[4]*oneMinuseta + xl[5]*oneMinuseta +
+                            xl[6]*onePluseta - xl[7]*onePluseta);
 
-    J[1][1] = 0.25 * (-nd1Crds(1)*oneMinusxi - nd2Crds(1)*onePlusxi +
-                            nd3Crds(1)*onePlusxi + nd4Crds(1)*oneMinusxi);
+    J[1][1] = 0.25 * (-xl[4]*oneMinusxi - xl[5]*onePlusxi +
+                            xl[6]*onePlusxi + xl[7]*oneMinusxi);
 
     double detJ = J[0][0]*J[1][1] - J[0][1]*J[1][0];
     double oneOverdetJ = 1.0/detJ;
@@ -1300,6 +1307,44 @@ double FourNodeQuad::shapeFunction(double xi, double eta)
     return detJ;
 }
 
+double FourNodeQuad::shapeFunction(const double *shapeData, int ip)
+{
+    const double *data = shapeData + 13*ip;
+    for (int i = 0; i < 3; i++)
+        for (int alpha = 0; alpha < 4; alpha++)
+            shp[i][alpha] = data[4*i + alpha];
+
+    return data[12];
+}
+
+const double *
+FourNodeQuad::getShapeData()
+{
+    static double work[13*nip];
+    double xl[8];
+
+    for (int alpha = 0; alpha < 4; alpha++) {
+        const Vector &crds = theNodes[alpha]->getCrds();
+        xl[alpha]   = crds(0);
+        xl[4+alpha] = crds(1);
+    }
+
+    return shapes.find(xl, work);
+}
+
+void
+FourNodeQuad::computeShapeData(const double *xl, double *data)
+{
+    // shp[3][4] followed by detJ for each integration point
+    for (int ip = 0; ip < nip; ip++) {
+        double detJ = shapeFunction(pts[ip][0], pts[ip][1], xl);
+        for (int i = 0; i < 3; i++)
+            for (int alpha = 0; alpha < 4; alpha++)
+                data[13*ip + 4*i + alpha] = shp[i][alpha];
+        data[13*ip + 12] = detJ;
+    }
+}
+
 void 
 FourNodeQuad::setPressureLoadAtNodes(void)
 {
@@ -44,6 +44,7 @@
 class Node;
 class NDMaterial;
 class Response;
+class ShapeFunctionCache;
 
 class FourNodeQuad : public Element,
                      protected LegendreFixedQuadrilateral<4>
@@ -60,6 +61,9 @@ class FourNodeQuad : public Element,
     const char *getClassType(void) const {return "FourNodeQuad";};
     static constexpr const char* class_name = "FourNodeQuad";
 
+    // the material of integration point i = 0..3
+    NDMaterial *getMaterial(int i) {return theMaterial[i];}
+
     int getNumExternalNodes(void) const;
     const ID &getExternalNodes(void);
     Node **getNodePtrs(void);
@@ -119,9 +123,9 @@ class FourNodeQuad : public Element,
 
     Node *theNodes[4];
 
-    static double matrixData[64];  // array data for matrix
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local double matrixData[64];  // array data for matrix
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
     Vector Q;		        // Applied nodal loads
     double b[2];		// Body forces
 
@@ -134,12 +138,17 @@ class FourNodeQuad : public Element,
     double pressure;	        // Normal surface traction (pressure) over entire element
 					 // Note: positive for outward normal
     double rho;
-    static double shp[3][4];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double shp[3][4];	// Stores shape functions and derivatives (overwritten)
 //  static double pts[4][2];	// Stores quadrature points
 //  static double wts[4];		// Stores quadrature weights
 
+    static ShapeFunctionCache shapes;  // shp and detJ shared by quads of the same geometry
+
     // private member functions - only objects of this class can call these
-    double shapeFunction(double xi, double eta);
+    static double shapeFunction(double xi, double eta, const double *xl);
+    double shapeFunction(const double *shapeData, int ip);
+    const double *getShapeData(void);
+    static void computeShapeData(const double *xl, double *data);
     void setPressureLoadAtNodes(void);
 
     Matrix *Ki;
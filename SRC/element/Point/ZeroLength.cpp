@@ -49,14 +49,14 @@
 #include <vector>
 
 // initialise the class wide variables
-Matrix ZeroLength::ZeroLengthM2(2,2);
-Matrix ZeroLength::ZeroLengthM4(4,4);
-Matrix ZeroLength::ZeroLengthM6(6,6);
-Matrix ZeroLength::ZeroLengthM12(12,12);
-Vector ZeroLength::ZeroLengthV2(2);
-Vector ZeroLength::ZeroLengthV4(4);
-Vector ZeroLength::ZeroLengthV6(6);
-Vector ZeroLength::ZeroLengthV12(12);
+thread_local Matrix ZeroLength::ZeroLengthM2(2,2);
+thread_local Matrix ZeroLength::ZeroLengthM4(4,4);
+thread_local Matrix ZeroLength::ZeroLengthM6(6,6);
+thread_local Matrix ZeroLength::ZeroLengthM12(12,12);
+thread_local Vector ZeroLength::ZeroLengthV2(2);
+thread_local Vector ZeroLength::ZeroLengthV4(4);
+thread_local Vector ZeroLength::ZeroLengthV6(6);
+thread_local Vector ZeroLength::ZeroLengthV12(12);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ZeroLength)
 {
@@ -960,7 +960,7 @@ ZeroLength::sendSelf(int commitTag, Channel &theChannel)
 
 	// Make one size bigger so not a multiple of 3, otherwise will conflict
 	// with classTags ID
-	static ID idData(7);
+	static thread_local ID idData(7);
 
 	idData(0) = this->getTag();
 	idData(1) = dimension;
@@ -1032,7 +1032,7 @@ ZeroLength::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBr
   // ZeroLength creates an ID, receives the ID and then sets the 
   // internal data with the data in the ID
 
-  static ID idData(7);
+  static thread_local ID idData(7);
 
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -1147,8 +1147,8 @@ ZeroLength::displaySelf(Renderer &theViewer, int displayMode, float fact, const
        return 0;
 
     // get the end point display coords    
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
 
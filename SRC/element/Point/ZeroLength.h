@@ -109,6 +109,10 @@ class ZeroLength : public Element
     const char *getClassType(void) const {return "ZeroLength";};
     static constexpr const char* class_name = "ZeroLength";
 
+    // the materials, followed by the damping materials if any
+    int getNumMaterials(void) const {return useRayleighDamping == 2 ? 2*numMaterials1d : numMaterials1d;}
+    UniaxialMaterial *getMaterial(int i) {return theMaterial1d[i];}
+
     // public methods to obtain information about dof & connectivity    
     int getNumExternalNodes(void) const;
     const ID &getExternalNodes(void);
@@ -193,14 +197,14 @@ class ZeroLength : public Element
     Vector *v0;
 
     // static data - single copy for all objects of the class	
-    static Matrix ZeroLengthM2;   // class wide matrix for 2*2
-    static Matrix ZeroLengthM4;   // class wide matrix for 4*4
-    static Matrix ZeroLengthM6;   // class wide matrix for 6*6
-    static Matrix ZeroLengthM12;  // class wide matrix for 12*12
-    static Vector ZeroLengthV2;   // class wide Vector for size 2
-    static Vector ZeroLengthV4;   // class wide Vector for size 4
-    static Vector ZeroLengthV6;   // class wide Vector for size 6
-    static Vector ZeroLengthV12;  // class wide Vector for size 12
+    static thread_local Matrix ZeroLengthM2;   // class wide matrix for 2*2
+    static thread_local Matrix ZeroLengthM4;   // class wide matrix for 4*4
+    static thread_local Matrix ZeroLengthM6;   // class wide matrix for 6*6
+    static thread_local Matrix ZeroLengthM12;  // class wide matrix for 12*12
+    static thread_local Vector ZeroLengthV2;   // class wide Vector for size 2
+    static thread_local Vector ZeroLengthV4;   // class wide Vector for size 4
+    static thread_local Vector ZeroLengthV6;   // class wide Vector for size 6
+    static thread_local Vector ZeroLengthV12;  // class wide Vector for size 12
 
     int mInitialize;  // tag to fix bug in recvSelf/setDomain when using database command
 };
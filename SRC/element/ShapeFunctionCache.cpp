@@ -0,0 +1,111 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the implementation of
+// ShapeFunctionCache; see ShapeFunctionCache.h
+//
+#include <cmath>
+#include <ShapeFunctionCache.h>
+
+// relative tolerance, as a power of two, of the rounded coordinates
+static const int toleranceBits = 32;
+
+size_t
+ShapeFunctionCache::KeyHash::operator()(const std::vector<long long> &key) const
+{
+  // FNV-1a over the rounded coordinates
+  size_t hash = 1469598103934665603ULL;
+  for (long long k : key) {
+    hash ^= (size_t)k;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+ShapeFunctionCache::ShapeFunctionCache(int nen, int dim, int n,
+                                       ComputeFunction function, int maxGeometries)
+  : numNodes(nen), ndm(dim), size(n), capacity(maxGeometries), compute(function)
+{
+
+}
+
+const double *
+ShapeFunctionCache::find(const double xl[], double *work)
+{
+  const int numCrds = ndm*numNodes;
+
+  // scratch reused between calls, one per thread
+  static thread_local std::vector<double> rel;
+  static thread_local std::vector<long long> key;
+  rel.resize(numCrds);
+  key.resize(numCrds + 1);
+
+  // coordinates relative to the first node
+  double scale = 0.0;
+  for (int i = 0; i < ndm; i++)
+    for (int a = 0; a < numNodes; a++) {
+      double x = xl[i*numNodes + a] - xl[i*numNodes];
+      rel[i*numNodes + a] = x;
+      scale = std::fmax(scale, std::fabs(x));
+    }
+
+  if (scale == 0.0 || !std::isfinite(scale)) {
+    compute(rel.data(), work);
+    return work;
+  }
+
+  // round to a power of two grid scaled with the element, which is
+  // part of the key so that similar elements of other sizes differ
+  int exponent = std::ilogb(scale) - toleranceBits;
+  key[numCrds] = exponent;
+  for (int i = 0; i < numCrds; i++)
+    key[i] = std::llround(std::ldexp(rel[i], -exponent));
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = geometries.find(key);
+    if (found != geometries.end())
+      return found->second.data();
+  }
+
+  compute(rel.data(), work);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if ((int)geometries.size() >= capacity)
+    return work;
+
+  // unordered_map nodes do not move, so the data stays valid until clear()
+  auto inserted = geometries.emplace(key, std::vector<double>(work, work + size));
+  return inserted.first->second.data();
+}
+
+int
+ShapeFunctionCache::getNumGeometries(void) const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return (int)geometries.size();
+}
+
+void
+ShapeFunctionCache::clear(void)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  geometries.clear();
+}
@@ -0,0 +1,78 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the class definition for
+// ShapeFunctionCache. A ShapeFunctionCache holds the integration point
+// data of an element class (shape function derivatives, weighted
+// Jacobian determinants, ...) for each distinct element geometry, so
+// that the elements of a structured mesh, which differ only by a
+// translation, share a single copy computed once.
+//
+// The geometry is identified by the nodal coordinates relative to the
+// first node, rounded to about 1e-10 of the element size. Data is
+// computed from these relative coordinates by the compute function
+// given to the constructor, which must therefore be invariant under
+// translation. When the cache holds capacity geometries, further ones
+// are computed into the caller's work array without being stored, so
+// unstructured meshes fall back to the uncached cost.
+//
+#ifndef ShapeFunctionCache_h
+#define ShapeFunctionCache_h
+
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+class ShapeFunctionCache
+{
+  public:
+    // compute(xl, data): xl[i*numNodes + a] is coordinate i of node a
+    typedef void (*ComputeFunction)(const double *xl, double *data);
+
+    ShapeFunctionCache(int numNodes, int ndm, int size,
+                       ComputeFunction compute, int capacity = 16384);
+
+    // data for the element with nodal coordinates xl (laid out as
+    // above); work must hold getSize() doubles and is returned when
+    // the geometry is not stored
+    const double *find(const double xl[], double *work);
+
+    int getSize(void) const {return size;}
+    int getNumGeometries(void) const;
+
+    // release all stored data; no element may be using it
+    void clear(void);
+
+  private:
+    struct KeyHash {
+      size_t operator()(const std::vector<long long> &key) const;
+    };
+
+    int numNodes;
+    int ndm;
+    int size;
+    int capacity;
+    ComputeFunction compute;
+
+    std::unordered_map<std::vector<long long>, std::vector<double>, KeyHash> geometries;
+    mutable std::mutex mutex;
+};
+
+#endif
@@ -607,7 +607,7 @@ CorotTruss::update(void)
 const Matrix &
 CorotTruss::getTangentStiff(void)
 {
-    static Matrix kl(3,3);
+    static thread_local Matrix kl(3,3);
 
     // Material stiffness
     //
@@ -634,7 +634,7 @@ CorotTruss::getTangentStiff(void)
     }
     
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    static thread_local Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
     Matrix &K = *theMatrix;
@@ -658,14 +658,14 @@ CorotTruss::getTangentStiff(void)
 const Matrix &
 CorotTruss::getInitialStiff(void)
 {
-    static Matrix kl(3,3);
+    static thread_local Matrix kl(3,3);
 
     // Material stiffness
     kl.Zero();
     kl(0,0) = A * theMaterial->getInitialTangent() / Lo;
 
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    static thread_local Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
     Matrix &K = *theMatrix;
@@ -689,7 +689,7 @@ CorotTruss::getInitialStiff(void)
 const Matrix &
 CorotTruss::getDamp(void)
 {
-    static Matrix kl(3,3);
+    static thread_local Matrix kl(3,3);
 
     Matrix a(3,1);
     a(0,0) = (Lo+d21[0])/Ln;
@@ -702,7 +702,7 @@ CorotTruss::getDamp(void)
     kl.addMatrixTripleProduct(0.0, a, cb, 1.0);
 
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    static thread_local Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
     Matrix &K = *theMatrix;
@@ -815,13 +815,13 @@ CorotTruss::getResistingForce()
 	double SA = A*theMaterial->getStress();
 	SA /= Ln;
 
-    static Vector ql(3);
+    static thread_local Vector ql(3);
 
 	ql(0) = d21[0]*SA;
 	ql(1) = d21[1]*SA;
 	ql(2) = d21[2]*SA;
 
-    static Vector qg(3);
+    static thread_local Vector qg(3);
     qg.addMatrixTransposeVector(0.0, R, ql, 1.0);
 
     Vector &P = *theVector;
@@ -899,7 +899,7 @@ CorotTruss::sendSelf(int commitTag, Channel &theChannel)
   // truss packs it's data into a Vector and sends this to theChannel
   // along with it's dbTag and the commitTag passed in the arguments
 
-  static Vector data(9);
+  static thread_local Vector data(9);
   data(0) = this->getTag();
   data(1) = numDIM;
   data(2) = numDOF;
@@ -952,7 +952,7 @@ CorotTruss::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBr
   // truss creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
 
-  static Vector data(9);
+  static thread_local Vector data(9);
   res = theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING Truss::recvSelf() - failed to receive Vector\n";
@@ -1013,8 +1013,8 @@ CorotTruss::displaySelf(Renderer &theViewer, int displayMode, float fact, const
 	if (Ln == 0.0)
 		return 0;
 
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
 
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -539,7 +539,7 @@ CorotTruss2::computeCurrentNormalStrain(void)
 const Matrix &
 CorotTruss2::getTangentStiff(void)
 {
-    static Matrix kl(3,3);
+    static thread_local Matrix kl(3,3);
 
     // Material stiffness
     //
@@ -566,7 +566,7 @@ CorotTruss2::getTangentStiff(void)
     }
     
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    static thread_local Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
     Matrix &K = *theMatrix;
@@ -589,14 +589,14 @@ CorotTruss2::getTangentStiff(void)
 const Matrix &
 CorotTruss2::getInitialStiff(void)
 {
-    static Matrix kl(3,3);
+    static thread_local Matrix kl(3,3);
 
     // Material stiffness
     kl.Zero();
     kl(0,0) = A * theMaterial->getInitialTangent() / Lo;
 
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    static thread_local Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
     Matrix &K = *theMatrix;
@@ -666,13 +666,13 @@ CorotTruss2::getResistingForce()
 	double SA = A*theMaterial->getStress();
 	SA /= Ln;
 
-    static Vector ql(3);
+    static thread_local Vector ql(3);
 
 	ql(0) = d21[0]*SA;
 	ql(1) = d21[1]*SA;
 	ql(2) = d21[2]*SA;
 
-    static Vector qg(3);
+    static thread_local Vector qg(3);
     qg.addMatrixTransposeVector(0.0, R, ql, 1.0);
 
     Vector &P = *theVector;
@@ -729,7 +729,7 @@ CorotTruss2::sendSelf(int commitTag, Channel &theChannel)
   // truss packs it's data into a Vector and sends this to theChannel
   // along with it's dbTag and the commitTag passed in the arguments
 
-  static Vector data(7);
+  static thread_local Vector data(7);
   data(0) = this->getTag();
   data(1) = numDIM;
   data(2) = numDOF;
@@ -786,7 +786,7 @@ CorotTruss2::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theB
   // truss creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
 
-  static Vector data(7);
+  static thread_local Vector data(7);
   res = theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING Truss::recvSelf() - failed to receive Vector\n";
@@ -852,8 +852,8 @@ CorotTruss2::displaySelf(Renderer &theViewer, int displayMode, float fact, const
 	if (Ln == 0.0)
 		return 0;
 
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
 
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
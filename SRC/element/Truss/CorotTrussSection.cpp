@@ -443,7 +443,7 @@ CorotTrussSection::update(void)
 const Matrix &
 CorotTrussSection::getTangentStiff(void)
 {
-    static Matrix kl(3,3);
+    static thread_local Matrix kl(3,3);
 
     // Material stiffness
     //
@@ -484,7 +484,7 @@ CorotTrussSection::getTangentStiff(void)
     }
     
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    static thread_local Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
     Matrix &K = *theMatrix;
@@ -507,7 +507,7 @@ CorotTrussSection::getTangentStiff(void)
 const Matrix &
 CorotTrussSection::getInitialStiff(void)
 {
-    static Matrix kl(3,3);
+    static thread_local Matrix kl(3,3);
 
     // Material stiffness
     //
@@ -529,7 +529,7 @@ CorotTrussSection::getInitialStiff(void)
     kl(0,0) = EA / Lo;
 
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    static thread_local Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
     
     Matrix &K = *theMatrix;
@@ -657,13 +657,13 @@ CorotTrussSection::getResistingForce()
 
 	SA /= Ln;
 
-    static Vector ql(3);
+    static thread_local Vector ql(3);
 
 	ql(0) = d21[0]*SA;
 	ql(1) = d21[1]*SA;
 	ql(2) = d21[2]*SA;
 
-    static Vector qg(3);
+    static thread_local Vector qg(3);
     qg.addMatrixTransposeVector(0.0, R, ql, 1.0);
 
     Vector &P = *theVector;
@@ -739,7 +739,7 @@ CorotTrussSection::sendSelf(int commitTag, Channel &theChannel)
   // truss packs it's data into a Vector and sends this to theChannel
   // along with it's dbTag and the commitTag passed in the arguments
 
-  static Vector data(8);
+  static thread_local Vector data(8);
   data(0) = this->getTag();
   data(1) = numDIM;
   data(2) = numDOF;
@@ -791,7 +791,7 @@ CorotTrussSection::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   // truss creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
 
-  static Vector data(8);
+  static thread_local Vector data(8);
   res = theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING CorotTrussSection::recvSelf() - failed to receive Vector\n";
@@ -852,8 +852,8 @@ CorotTrussSection::displaySelf(Renderer &theViewer, int displayMode, float fact,
 	if (Ln == 0.0)
 		return 0;
 
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
 
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -650,7 +650,7 @@ InertiaTruss::sendSelf(int commitTag, Channel &theChannel)
   // truss packs it's data into a Vector and sends this to theChannel
   // along with it's dbTag and the commitTag passed in the arguments
 
-  static Vector data(12);
+  static thread_local Vector data(12);
   data(0) = this->getTag();
   data(1) = dimension;
   data(2) = numDOF;
@@ -686,7 +686,7 @@ InertiaTruss::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &the
   // inertiatruss creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
 
-  static Vector data(12);
+  static thread_local Vector data(12);
   res = theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr <<"WARNING InertiaTruss::recvSelf() - failed to receive Vector\n";
@@ -729,8 +729,8 @@ int
 InertiaTruss::displaySelf(Renderer &theViewer, int displayMode, float fact, 
 		   const char **displayModes, int numModes)
 {
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
     int res = 0;
     if (L == 0.0)
         return res;
@@ -843,8 +843,8 @@ int
 InertiaTruss::getResponse(int responseID, Information &eleInfo)
 {
     int numDOF2 = numDOF / 2;
-    static Vector fVec_Acc(1);
-    static Vector fVec_AxialForce(1);
+    static thread_local Vector fVec_Acc(1);
+    static thread_local Vector fVec_AxialForce(1);
     const Vector& acc1 = theNodes[0]->getTrialAccel();
     const Vector& acc2 = theNodes[1]->getTrialAccel();
     Vector toret = acc2 - acc1;
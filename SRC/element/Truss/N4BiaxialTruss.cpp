@@ -858,7 +858,7 @@ N4BiaxialTruss::sendSelf(int commitTag, Channel &theChannel)
 	// N4BiaxialTruss packs it's data into a Vector and sends this to theChannel
 	// along with it's dbTag and the commitTag passed in the arguments
 
-	static Vector data(11);
+	static thread_local Vector data(11);
 	data(0) = this->getTag();
 	data(1) = dimension;
 	data(2) = numDOF;
@@ -926,7 +926,7 @@ N4BiaxialTruss::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &t
 
 	// N4BiaxialTruss creates a Vector, receives the Vector and then sets the 
 	// internal data with the data in the Vector
-	static Vector data(11);
+	static thread_local Vector data(11);
 	res = theChannel.recvVector(dataTag, commitTag, data);
 	if (res < 0) {
 		opserr <<"WARNING N4BiaxialTruss::recvSelf() - failed to receive Vector\n";
@@ -1023,10 +1023,10 @@ N4BiaxialTruss::displaySelf(Renderer &theViewer, int displayMode, float fact, co
 	return 0;
 
 	// get display coordinates
-	static Vector v1(3);
-	static Vector v2(3);
-	static Vector v3(3);
-	static Vector v4(3);
+	static thread_local Vector v1(3);
+	static thread_local Vector v2(3);
+	static thread_local Vector v3(3);
+	static thread_local Vector v4(3);
 	theNodes[0]->getDisplayCrds(v1, fact, displayMode);
 	theNodes[1]->getDisplayCrds(v2, fact, displayMode);
 	theNodes[2]->getDisplayCrds(v3, fact, displayMode);
@@ -44,14 +44,14 @@
 //#include <fstream>
 
 // initialise the class wide variables
-Matrix Truss::trussM2(2,2);
-Matrix Truss::trussM4(4,4);
-Matrix Truss::trussM6(6,6);
-Matrix Truss::trussM12(12,12);
-Vector Truss::trussV2(2);
-Vector Truss::trussV4(4);
-Vector Truss::trussV6(6);
-Vector Truss::trussV12(12);
+thread_local Matrix Truss::trussM2(2,2);
+thread_local Matrix Truss::trussM4(4,4);
+thread_local Matrix Truss::trussM6(6,6);
+thread_local Matrix Truss::trussM12(12,12);
+thread_local Vector Truss::trussV2(2);
+thread_local Vector Truss::trussV4(4);
+thread_local Vector Truss::trussV6(6);
+thread_local Vector Truss::trussV12(12);
 
 // constructor:
 //  responsible for allocating the necessary space needed by each object
@@ -855,7 +855,7 @@ Truss::sendSelf(int commitTag, Channel &theChannel)
   // truss packs it's data into a Vector and sends this to theChannel
   // along with it's dbTag and the commitTag passed in the arguments
 
-  static Vector data(12);
+  static thread_local Vector data(12);
   data(0) = this->getTag();
   data(1) = dimension;
   data(2) = numDOF;
@@ -914,7 +914,7 @@ Truss::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
   // truss creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
 
-  static Vector data(12);
+  static thread_local Vector data(12);
   res = theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr <<"WARNING Truss::recvSelf() - failed to receive Vector\n";
@@ -993,8 +993,8 @@ Truss::displaySelf(Renderer &theViewer, int displayMode, float fact,
   if (L == 0.0)
     return res;
 
-  static Vector v1(3);
-  static Vector v2(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
   float d1 = 0.0;
   float d2 = 0.0;
 
@@ -1220,8 +1220,8 @@ int
 Truss::getResponse(int responseID, Information &eleInfo)
 {
   double strain, force;
-    static Vector fVec(1);
-    static Matrix kVec(1,1);
+    static thread_local Vector fVec(1);
+    static thread_local Matrix kVec(1,1);
 
     switch (responseID) {
     case 1:
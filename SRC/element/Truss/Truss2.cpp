@@ -866,7 +866,7 @@ int Truss2::sendSelf(int commitTag, Channel &theChannel)
 	// truss packs it's data into a Vector and sends this to theChannel
 	// along with it's dbTag and the commitTag passed in the arguments
 
-	static Vector data(8);
+	static thread_local Vector data(8);
 	data(0) = this->getTag();
 	data(1) = dimension;
 	data(2) = numDOF;
@@ -931,7 +931,7 @@ int
 	// truss creates a Vector, receives the Vector and then sets the 
 	// internal data with the data in the Vector
 
-	static Vector data(8);
+	static thread_local Vector data(8);
 	res = theChannel.recvVector(dataTag, commitTag, data);
 	if (res < 0) {
 		opserr <<"WARNING Truss2::recvSelf() - failed to receive Vector\n";
@@ -1008,8 +1008,8 @@ Truss2::displaySelf(Renderer &theViewer, int displayMode, float fact, const char
 		return 0;
 
 	// get display coordinates
-	static Vector v1(3);
-	static Vector v2(3);
+	static thread_local Vector v1(3);
+	static thread_local Vector v2(3);
 	theNodes[0]->getDisplayCrds(v1, fact, displayMode);
 	theNodes[1]->getDisplayCrds(v2, fact, displayMode);
 
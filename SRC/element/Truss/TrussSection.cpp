@@ -783,7 +783,7 @@ TrussSection::sendSelf(int commitTag, Channel &theChannel)
   // truss packs it's data into a Vector and sends this to theChannel
   // along with it's dbTag and the commitTag passed in the arguments
 
-  static Vector data(11);
+  static thread_local Vector data(11);
   data(0) = this->getTag();
   data(1) = dimension;
   data(2) = numDOF;
@@ -841,7 +841,7 @@ TrussSection::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &the
   // truss creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
 
-  static Vector data(11);
+  static thread_local Vector data(11);
   res = theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING TrussSection::recvSelf() - failed to receive Vector\n";
@@ -923,8 +923,8 @@ TrussSection::displaySelf(Renderer &theViewer, int displayMode, float fact, cons
     // first determine the two end points of the truss based on
     // the display factor (a measure of the distorted image)
     // store this information in 2 3d vectors v1 and v2
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
     float d1 = 0.0;
     float d2 = 0.0;
 
@@ -1157,9 +1157,9 @@ int
 TrussSection::getResponse(int responseID, Information &eleInfo)
 {
     double strain, force;
-    static Vector sVec(1);
-    static Vector fVec(1);
-    static Matrix kVec(1,1);
+    static thread_local Vector sVec(1);
+    static thread_local Vector fVec(1);
+    static thread_local Matrix kVec(1,1);
 
     switch (responseID) {
   case 1:
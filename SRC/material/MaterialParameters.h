@@ -0,0 +1,70 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the class template MaterialParameters.
+// A MaterialParameters<Block> holds a pointer to an immutable block of
+// constitutive constants that is shared between a material and all
+// the copies made of it with getCopy(), so that a copy only stores its
+// state variables. Modifying the constants (e.g. through updateParameter)
+// first gives the material a block of its own if the block is shared, so
+// that a shared block is never written. A material must not be copied
+// while it is being edited: use_count() cannot see a copy that another
+// thread is making at the same time.
+//
+// A material family declares its constants as a plain struct, e.g.
+//
+//   struct Parameters {double Fy, E0, b;};
+//   MaterialParameters<Parameters> theParameters;
+//
+// reads them with theParameters->Fy and modifies them with
+// theParameters.edit().Fy = value.
+//
+#ifndef MaterialParameters_h
+#define MaterialParameters_h
+
+#include <memory>
+
+template <typename Block>
+class MaterialParameters
+{
+  public:
+    MaterialParameters()
+      : block(std::make_shared<Block>()) {}
+    explicit MaterialParameters(const Block &values)
+      : block(std::make_shared<Block>(values)) {}
+
+    const Block &operator*() const {return *block;}
+    const Block *operator->() const {return block.get();}
+
+    // the block to modify, copied first if other materials share it
+    Block &edit() {
+      if (block.use_count() > 1)
+        block = std::make_shared<Block>(*block);
+      return *block;
+    }
+
+    // number of materials sharing this block
+    long getNumShared() const {return block.use_count();}
+
+  private:
+    std::shared_ptr<Block> block;
+};
+
+#endif
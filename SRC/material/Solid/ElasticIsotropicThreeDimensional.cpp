@@ -182,6 +182,60 @@ ElasticIsotropicThreeDimensional::getStrain (void)
   return epsilon;
 }
 
+int
+ElasticIsotropicThreeDimensional::setTrialStrains(NDMaterial **points, int numPoints,
+                                                  const double *strain,
+                                                  double *stress, double *tangent)
+{
+  for (int p = 0; p < numPoints; p++) {
+    Vector &eps = ((ElasticIsotropicThreeDimensional *)points[p])->epsilon;
+    for (int i = 0; i < 6; i++)
+      eps(i) = strain[i*numPoints + p];
+  }
+
+  if (stress != nullptr || tangent != nullptr)
+    return this->getResponses(points, numPoints, stress, tangent);
+
+  return 0;
+}
+
+int
+ElasticIsotropicThreeDimensional::getResponses(NDMaterial **points, int numPoints,
+                                               double *stress, double *tangent)
+{
+  // computed from the moduli of each point, without the class-wide sigma and D
+  for (int p = 0; p < numPoints; p++) {
+    const ElasticIsotropicThreeDimensional *theMaterial = (ElasticIsotropicThreeDimensional *)points[p];
+
+    double mu2 = theMaterial->E/(1.0+theMaterial->v);
+    double lam = theMaterial->v*mu2/(1.0-2.0*theMaterial->v);
+    double mu = 0.50*mu2;
+    mu2 += lam;
+
+    if (stress != nullptr) {
+      const Vector &eps = theMaterial->epsilon;
+      stress[0*numPoints + p] = mu2*eps(0) + lam*(eps(1)+eps(2));
+      stress[1*numPoints + p] = mu2*eps(1) + lam*(eps(0)+eps(2));
+      stress[2*numPoints + p] = mu2*eps(2) + lam*(eps(0)+eps(1));
+      stress[3*numPoints + p] = mu*eps(3);
+      stress[4*numPoints + p] = mu*eps(4);
+      stress[5*numPoints + p] = mu*eps(5);
+    }
+
+    if (tangent != nullptr) {
+      for (int i = 0; i < 36; i++)
+        tangent[i*numPoints + p] = 0.0;
+      for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+          tangent[(i*6 + j)*numPoints + p] = (i == j) ? mu2 : lam;
+      for (int i = 3; i < 6; i++)
+        tangent[(i*6 + i)*numPoints + p] = mu;
+    }
+  }
+
+  return 0;
+}
+
 int
 ElasticIsotropicThreeDimensional::commitState (void)
 {
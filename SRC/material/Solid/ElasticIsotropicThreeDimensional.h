@@ -56,6 +56,11 @@ class ElasticIsotropicThreeDimensional : public ElasticIsotropicMaterial
     
     const Vector &getStress (void);
     const Vector &getStrain (void);
+
+    int setTrialStrains(NDMaterial **points, int numPoints, const double *strain,
+                        double *stress = nullptr, double *tangent = nullptr);
+    int getResponses(NDMaterial **points, int numPoints, double *stress, double *tangent);
+    bool isBatchThreadSafe(void) const {return true;}
     
     int commitState (void);
     int revertToLastCommit (void);
@@ -273,3 +273,68 @@ const Matrix& J2ThreeDimensional :: getInitialTangent( )
 } 
 
 
+//batched state determination; the integrator works on the members
+//of each point, so only the class-wide return vectors are bypassed
+int J2ThreeDimensional :: setTrialStrains( NDMaterial **points, int numPoints,
+                                           const double *strain_from_element,
+                                           double *stress_out, double *tangent_out )
+{
+  for ( int p = 0; p < numPoints; p++ ) {
+    J2ThreeDimensional *theMaterial = (J2ThreeDimensional *)points[p] ;
+    Matrix &eps = theMaterial->strain ;
+
+    eps(0,0) =        strain_from_element[0*numPoints + p] ;
+    eps(1,1) =        strain_from_element[1*numPoints + p] ;
+    eps(2,2) =        strain_from_element[2*numPoints + p] ;
+
+    eps(0,1) = 0.50 * strain_from_element[3*numPoints + p] ;
+    eps(1,0) =        eps(0,1) ;
+
+    eps(1,2) = 0.50 * strain_from_element[4*numPoints + p] ;
+    eps(2,1) =        eps(1,2) ;
+
+    eps(2,0) = 0.50 * strain_from_element[5*numPoints + p] ;
+    eps(0,2) =        eps(2,0) ;
+
+    theMaterial->plastic_integrator( ) ;
+  }
+
+  if ( stress_out != nullptr || tangent_out != nullptr )
+    return this->getResponses( points, numPoints, stress_out, tangent_out ) ;
+
+  return 0 ;
+}
+
+
+int J2ThreeDimensional :: getResponses( NDMaterial **points, int numPoints,
+                                        double *stress_out, double *tangent_out )
+{
+  int ii, jj ;
+  int i, j, k, l ;
+
+  for ( int p = 0; p < numPoints; p++ ) {
+    J2ThreeDimensional *theMaterial = (J2ThreeDimensional *)points[p] ;
+
+    if ( stress_out != nullptr ) {
+      const Matrix &sig = theMaterial->stress ;
+      stress_out[0*numPoints + p] = sig(0,0) ;
+      stress_out[1*numPoints + p] = sig(1,1) ;
+      stress_out[2*numPoints + p] = sig(2,2) ;
+      stress_out[3*numPoints + p] = sig(0,1) ;
+      stress_out[4*numPoints + p] = sig(1,2) ;
+      stress_out[5*numPoints + p] = sig(2,0) ;
+    }
+
+    if ( tangent_out != nullptr ) {
+      for ( ii = 0; ii < 6; ii++ ) {
+        for ( jj = 0; jj < 6; jj++ ) {
+          index_map( ii, i, j ) ;
+          index_map( jj, k, l ) ;
+          tangent_out[(ii*6 + jj)*numPoints + p] = theMaterial->tangent[i][j][k][l] ;
+        } //end for jj
+      } //end for ii
+    }
+  }
+
+  return 0 ;
+}
@@ -118,6 +118,12 @@ class J2ThreeDimensional : public J2Plasticity {
   const Matrix& getTangent( ) ;
   const Matrix& getInitialTangent( ) ;
 
+  //batched state determination of a group of J2ThreeDimensional points
+  int setTrialStrains( NDMaterial **points, int numPoints, const double *strain,
+                       double *stress = nullptr, double *tangent = nullptr ) ;
+  int getResponses( NDMaterial **points, int numPoints, double *stress, double *tangent ) ;
+  bool isBatchThreadSafe( ) const { return true ; }
+
   private :
 
   //static vectors and matrices
@@ -282,11 +282,11 @@ void J2Plasticity :: plastic_integrator( )
 
   const double dt = ops_Dt ; //time step
 
-  static Matrix dev_strain(3,3) ; //deviatoric strain
+  static thread_local Matrix dev_strain(3,3) ; //deviatoric strain
 
-  static Matrix dev_stress(3,3) ; //deviatoric stress
+  static thread_local Matrix dev_stress(3,3) ; //deviatoric stress
  
-  static Matrix normal(3,3) ;     //normal to yield surface
+  static thread_local Matrix normal(3,3) ;     //normal to yield surface
 
   double NbunN ; //normal bun normal 
   double norm_tau = 0.0 ;   //norm of deviatoric stress 
@@ -210,6 +210,61 @@ NDMaterial::getStrain(void)
    return errVector;    
 }
 
+// components per point in the batched arrays; materials that do not
+// report their order are sized by their stress vector
+static int
+batchOrder(NDMaterial *theMaterial)
+{
+  int order = theMaterial->getOrder();
+  if (order <= 0)
+    order = theMaterial->getStress().Size();
+  return order;
+}
+
+int
+NDMaterial::setTrialStrains(NDMaterial **points, int numPoints, const double *strain,
+                            double *stress, double *tangent)
+{
+  int order = batchOrder(this);
+  Vector eps(order);
+
+  int result = 0;
+  for (int p = 0; p < numPoints; p++) {
+    for (int i = 0; i < order; i++)
+      eps(i) = strain[i*numPoints + p];
+    if (points[p]->setTrialStrain(eps) < 0)
+      result = -1;
+  }
+
+  if (stress != nullptr || tangent != nullptr)
+    if (this->getResponses(points, numPoints, stress, tangent) < 0)
+      result = -1;
+
+  return result;
+}
+
+int
+NDMaterial::getResponses(NDMaterial **points, int numPoints, double *stress, double *tangent)
+{
+  int order = batchOrder(this);
+
+  for (int p = 0; p < numPoints; p++) {
+    if (stress != nullptr) {
+      const Vector &sig = points[p]->getStress();
+      for (int i = 0; i < order; i++)
+        stress[i*numPoints + p] = sig(i);
+    }
+    if (tangent != nullptr) {
+      const Matrix &D = points[p]->getTangent();
+      for (int i = 0; i < order; i++)
+        for (int j = 0; j < order; j++)
+          tangent[(i*order + j)*numPoints + p] = D(i,j);
+    }
+  }
+
+  return 0;
+}
+
 //Functions for obtaining and updating temperature-dependent information Added by L.Jiang [SIF]
 double
 NDMaterial::getThermalTangentAndElongation(double &TempT, double &ET, double &Elong)
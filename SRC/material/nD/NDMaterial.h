@@ -72,6 +72,22 @@ class NDMaterial : public Material
     virtual const Vector &getStress(void);
     virtual const Vector &getStrain(void);
 
+    // Batched state determination for numPoints material points of the
+    // same class as this material, e.g. the Gauss points of an element.
+    // Arrays are component-major: strain[i*numPoints+p] is component i
+    // at point p and tangent[(i*order+j)*numPoints+p] is entry (i,j) at
+    // point p, with order = getOrder() (the size of the stress vector for
+    // materials that do not report it). stress and tangent may be null.
+    // The defaults loop over the points through the single point methods.
+    virtual int setTrialStrains(NDMaterial **points, int numPoints, const double *strain,
+                                double *stress = nullptr, double *tangent = nullptr);
+    virtual int getResponses(NDMaterial **points, int numPoints,
+                             double *stress, double *tangent);
+
+    // true if the batched methods may run concurrently on disjoint
+    // sets of points, i.e. they use no class-wide scratch storage
+    virtual bool isBatchThreadSafe(void) const {return false;}
+
     virtual int commitState(void) = 0;
     virtual int revertToLastCommit(void) = 0;
     virtual int revertToStart(void) = 0;
@@ -0,0 +1,202 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the implementation of
+// NDMaterialBatch; see NDMaterialBatch.h
+//
+#include <thread>
+#include <atomic>
+#include <NDMaterialBatch.h>
+#include <NDMaterial.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <OPS_Globals.h>
+
+NDMaterialBatch::NDMaterialBatch(int size)
+  : chunkSize(size > 0 ? size : 128), isAllocated(false)
+{
+
+}
+
+int
+NDMaterialBatch::addPoint(NDMaterial *theMaterial)
+{
+  int classTag = theMaterial->getClassTag();
+
+  auto open = openChunk.find(classTag);
+  if (open == openChunk.end() || (int)chunks[open->second].points.size() == chunkSize) {
+    Chunk chunk;
+    chunk.order = theMaterial->getOrder();
+    if (chunk.order <= 0)
+      chunk.order = theMaterial->getStress().Size();
+    chunk.threadSafe = theMaterial->isBatchThreadSafe();
+    chunk.result = 0;
+    chunk.points.reserve(chunkSize);
+    chunks.push_back(chunk);
+    openChunk[classTag] = (int)chunks.size() - 1;
+    open = openChunk.find(classTag);
+  }
+
+  Chunk &chunk = chunks[open->second];
+  location.push_back(std::make_pair(open->second, (int)chunk.points.size()));
+  chunk.points.push_back(theMaterial);
+  isAllocated = false;
+
+  return (int)location.size() - 1;
+}
+
+void
+NDMaterialBatch::allocate(void)
+{
+  // the arrays are component-major over the points of a chunk, so they
+  // can only be laid out once the chunk is complete
+  for (Chunk &chunk : chunks) {
+    int n = (int)chunk.points.size();
+    chunk.strain.assign(chunk.order*n, 0.0);
+    chunk.stress.assign(chunk.order*n, 0.0);
+    chunk.tangent.assign(chunk.order*chunk.order*n, 0.0);
+  }
+  isAllocated = true;
+}
+
+int
+NDMaterialBatch::getNumPoints(void) const
+{
+  return (int)location.size();
+}
+
+void
+NDMaterialBatch::clear(void)
+{
+  chunks.clear();
+  location.clear();
+  openChunk.clear();
+  isAllocated = false;
+}
+
+int
+NDMaterialBatch::setTrialStrain(int point, const Vector &strain)
+{
+  if (!isAllocated)
+    this->allocate();
+
+  Chunk &chunk = chunks[location[point].first];
+  int p = location[point].second;
+  int n = (int)chunk.points.size();
+
+  if (strain.Size() != chunk.order) {
+    opserr << "NDMaterialBatch::setTrialStrain - strain of size " << strain.Size()
+           << " for a material of order " << chunk.order << "\n";
+    return -1;
+  }
+
+  for (int i = 0; i < chunk.order; i++)
+    chunk.strain[i*n + p] = strain(i);
+
+  return 0;
+}
+
+int
+NDMaterialBatch::evaluateChunk(Chunk &chunk, bool computeTangent)
+{
+  int n = (int)chunk.points.size();
+  chunk.result = chunk.points[0]->setTrialStrains(chunk.points.data(), n, chunk.strain.data(),
+                                                  chunk.stress.data(),
+                                                  computeTangent ? chunk.tangent.data() : nullptr);
+  return chunk.result;
+}
+
+int
+NDMaterialBatch::evaluate(bool computeTangent, int numThreads)
+{
+  if (!isAllocated)
+    this->allocate();
+
+  std::vector<int> shared;
+  for (int c = 0; c < (int)chunks.size(); c++) {
+    if (chunks[c].threadSafe && numThreads > 1)
+      shared.push_back(c);
+    else
+      this->evaluateChunk(chunks[c], computeTangent);
+  }
+
+  if (!shared.empty()) {
+    // the workers see the analysis state of the calling thread
+    OPS_ThreadState state;
+    std::atomic<int> next(0);
+    auto work = [&]() {
+      state.install();
+      for (int k = next++; k < (int)shared.size(); k = next++)
+        this->evaluateChunk(chunks[shared[k]], computeTangent);
+    };
+
+    // the calling thread takes part in the work
+    std::vector<std::thread> threads;
+    for (int t = 1; t < numThreads && t < (int)shared.size(); t++)
+      threads.emplace_back(work);
+    work();
+    for (std::thread &thread : threads)
+      thread.join();
+  }
+
+  int result = 0;
+  for (const Chunk &chunk : chunks)
+    if (chunk.result < 0)
+      result = -1;
+
+  if (result < 0)
+    opserr << "NDMaterialBatch::evaluate - failed to determine the state of some points\n";
+
+  return result;
+}
+
+int
+NDMaterialBatch::getStress(int point, Vector &stress) const
+{
+  const Chunk &chunk = chunks[location[point].first];
+  int p = location[point].second;
+  int n = (int)chunk.points.size();
+
+  if (stress.Size() != chunk.order)
+    stress.resize(chunk.order);
+
+  for (int i = 0; i < chunk.order; i++)
+    stress(i) = chunk.stress[i*n + p];
+
+  return 0;
+}
+
+int
+NDMaterialBatch::getTangent(int point, Matrix &tangent) const
+{
+  const Chunk &chunk = chunks[location[point].first];
+  int p = location[point].second;
+  int n = (int)chunk.points.size();
+  int order = chunk.order;
+
+  if (tangent.noRows() != order || tangent.noCols() != order)
+    tangent.resize(order, order);
+
+  for (int i = 0; i < order; i++)
+    for (int j = 0; j < order; j++)
+      tangent(i,j) = chunk.tangent[(i*order + j)*n + p];
+
+  return 0;
+}
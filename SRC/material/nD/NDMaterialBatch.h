@@ -0,0 +1,82 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the class definition for
+// NDMaterialBatch. An NDMaterialBatch collects material points, e.g. all
+// the integration points of a set of elements, groups them by material
+// class into chunks and evaluates each chunk with a single call to
+// NDMaterial::setTrialStrains. Strains, stresses and tangents of a chunk
+// are stored component-major, as expected by the batched NDMaterial
+// methods.
+//
+// Chunks of classes that report isBatchThreadSafe() are distributed
+// over numThreads threads; the others are evaluated on the calling
+// thread. All points must be added before strains are set; the strain,
+// stress and tangent arrays are sized when the first strain is set.
+//
+#ifndef NDMaterialBatch_h
+#define NDMaterialBatch_h
+
+#include <vector>
+#include <map>
+
+class NDMaterial;
+class Vector;
+class Matrix;
+
+class NDMaterialBatch
+{
+  public:
+    NDMaterialBatch(int chunkSize = 128);
+
+    // add a point and return its index in the batch
+    int addPoint(NDMaterial *theMaterial);
+    int getNumPoints(void) const;
+    void clear(void);
+
+    int setTrialStrain(int point, const Vector &strain);
+    int evaluate(bool computeTangent, int numThreads = 1);
+
+    // responses of the last evaluate()
+    int getStress(int point, Vector &stress) const;
+    int getTangent(int point, Matrix &tangent) const;
+
+  private:
+    struct Chunk {
+      int order;
+      bool threadSafe;
+      std::vector<NDMaterial *> points;
+      std::vector<double> strain;
+      std::vector<double> stress;
+      std::vector<double> tangent;
+      int result;
+    };
+
+    void allocate(void);
+    int evaluateChunk(Chunk &chunk, bool computeTangent);
+
+    int chunkSize;
+    std::vector<Chunk> chunks;
+    std::vector<std::pair<int,int> > location;  // (chunk, position) of each point
+    std::map<int,int> openChunk;                // class tag -> chunk being filled
+    bool isAllocated;
+};
+
+#endif
@@ -113,3 +113,36 @@ const Matrix& DruckerPrager3D :: getInitialTangent( )
   return mCe ;
 } 
 
+//batched state determination of a group of DruckerPrager3D points
+int DruckerPrager3D :: setTrialStrains(NDMaterial **points, int numPoints,
+                                       const double *strain, double *stress, double *tangent)
+{
+	for (int p = 0; p < numPoints; p++) {
+		DruckerPrager3D *theMaterial = (DruckerPrager3D *)points[p];
+		for (int i = 0; i < 6; i++)
+			theMaterial->mEpsilon(i) = strain[i*numPoints + p];
+		theMaterial->plastic_integrator();
+	}
+
+	if (stress != nullptr || tangent != nullptr)
+		return this->getResponses(points, numPoints, stress, tangent);
+
+	return 0;
+}
+
+int DruckerPrager3D :: getResponses(NDMaterial **points, int numPoints, double *stress, double *tangent)
+{
+	for (int p = 0; p < numPoints; p++) {
+		DruckerPrager3D *theMaterial = (DruckerPrager3D *)points[p];
+		if (stress != nullptr)
+			for (int i = 0; i < 6; i++)
+				stress[i*numPoints + p] = theMaterial->mSigma(i);
+		if (tangent != nullptr)
+			for (int i = 0; i < 6; i++)
+				for (int j = 0; j < 6; j++)
+					tangent[(i*6 + j)*numPoints + p] = theMaterial->mCep(i,j);
+	}
+
+	return 0;
+}
+
@@ -71,6 +71,12 @@ class DruckerPrager3D : public DruckerPrager {
   const Matrix& getTangent( ) ;
   const Matrix& getInitialTangent( ) ;
 
+  //batched state determination of a group of DruckerPrager3D points
+  int setTrialStrains(NDMaterial **points, int numPoints, const double *strain,
+                      double *stress = nullptr, double *tangent = nullptr);
+  int getResponses(NDMaterial **points, int numPoints, double *stress, double *tangent);
+  bool isBatchThreadSafe(void) const {return true;}
+
   private :
 
 
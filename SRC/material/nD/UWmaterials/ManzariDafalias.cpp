@@ -133,6 +133,8 @@ ManzariDafalias::ManzariDafalias(int tag, double G0, double nu,
     double P_atm, double m, double h0, double ch, double nb, double A0, double nd,
     double z_max, double cz, double mDen, int integrationScheme, int tangentType, 
     int JacoType, double TolF, double TolR): NDMaterial(tag,ND_TAG_ManzariDafalias),
+    theParameters(Parameters{G0, nu, e_init, Mc, c, lambda_c, e0, ksi, P_atm, m, h0,
+                             ch, nb, A0, nd, z_max, cz}),
     mEpsilon(6), 
     mEpsilon_n(6),
     mEpsilonE(6),
@@ -149,24 +151,6 @@ ManzariDafalias::ManzariDafalias(int tag, double G0, double nu,
     mCep(6,6),
     mCep_Consistent(6,6)
 {
-    m_G0        = G0;
-    m_nu        = nu;
-    m_e_init    = e_init;
-    m_Mc        = Mc;
-    m_c         = c;
-    m_lambda_c  = lambda_c;
-    m_e0        = e0;
-    m_ksi       = ksi;
-    m_P_atm     = P_atm;
-    m_m         = m;
-    m_h0        = h0;
-    m_ch        = ch;
-    m_nb        = nb;
-    m_A0        = A0;
-    m_nd        = nd;
-    m_z_max     = z_max;
-    m_cz        = cz;
-
     massDen                = mDen;
     mTolF                  = TolF;
     mTolR                  = TolR;
@@ -186,6 +170,8 @@ ManzariDafalias::ManzariDafalias(int tag, int classTag, double G0, double nu,
     double P_atm, double m, double h0, double ch, double nb, double A0, double nd,
     double z_max, double cz, double mDen, int integrationScheme, int tangentType, 
     int JacoType, double TolF, double TolR): NDMaterial(tag, classTag),
+    theParameters(Parameters{G0, nu, e_init, Mc, c, lambda_c, e0, ksi, P_atm, m, h0,
+                             ch, nb, A0, nd, z_max, cz}),
     mEpsilon(6), 
     mEpsilon_n(6),
     mEpsilonE(6),
@@ -202,24 +188,6 @@ ManzariDafalias::ManzariDafalias(int tag, int classTag, double G0, double nu,
     mCep(6,6),
     mCep_Consistent(6,6)
 {
-    m_G0        = G0;
-    m_nu        = nu;
-    m_e_init    = e_init;
-    m_Mc        = Mc;
-    m_c         = c;
-    m_lambda_c  = lambda_c;
-    m_e0        = e0;
-    m_ksi       = ksi;
-    m_P_atm     = P_atm;
-    m_m         = m;
-    m_h0        = h0;
-    m_ch        = ch;
-    m_nb        = nb;
-    m_A0        = A0;
-    m_nd        = nd;
-    m_z_max     = z_max;
-    m_cz        = cz;
-
     massDen                = mDen;
     mTolF                  = TolF;
     mTolR                  = TolR;
@@ -253,24 +221,6 @@ ManzariDafalias ::ManzariDafalias(int classTag)
     mCep(6,6),
     mCep_Consistent(6,6)
 {
-    m_G0        = 0.0;
-    m_nu        = 0.0;
-    m_e_init    = 0.0;
-    m_Mc        = 0.0;
-    m_c         = 0.0;
-    m_lambda_c  = 0.0;
-    m_e0        = 0.0;
-    m_ksi       = 0.0;
-    m_P_atm     = 0.0;
-    m_m         = 0.0;
-    m_h0        = 0.0;
-    m_ch        = 0.0;
-    m_nb        = 0.0;
-    m_A0        = 0.0;
-    m_nd        = 0.0;
-    m_z_max     = 0.0;
-    m_cz        = 0.0;
-
     massDen      = 0.0;
     mTolF        = 1.0e-7;
     mTolR        = 1.0e-7;
@@ -306,24 +256,6 @@ ManzariDafalias ::ManzariDafalias()
     mCep(6,6),
     mCep_Consistent(6,6)
 {
-    m_G0        = 0.0;
-    m_nu        = 0.0;
-    m_e_init    = 0.0;
-    m_Mc        = 0.0;
-    m_c         = 0.0;
-    m_lambda_c  = 0.0;
-    m_e0        = 0.0;
-    m_ksi       = 0.0;
-    m_P_atm     = 0.0;
-    m_m         = 0.0;
-    m_h0        = 0.0;
-    m_ch        = 0.0;
-    m_nb        = 0.0;
-    m_A0        = 0.0;
-    m_nd        = 0.0;
-    m_z_max     = 0.0;
-    m_cz        = 0.0;
-
     massDen                = 0.0;
     mTolF                  = 1.0e-7;
     mTolR                  = 1.0e-7;
@@ -345,17 +277,22 @@ ManzariDafalias::~ManzariDafalias()
 NDMaterial*
 ManzariDafalias::getCopy(const char *type)
 {
+    // the copy shares the constants of this material
+    const Parameters &par = *theParameters;
+
     if (strcmp(type,"PlaneStrain2D") == 0 || strcmp(type,"PlaneStrain") == 0) {
         ManzariDafaliasPlaneStrain *clone;
-        clone = new ManzariDafaliasPlaneStrain(this->getTag(), m_G0,  m_nu,  m_e_init,  m_Mc,  
-                       m_c, m_lambda_c,  m_e0,  m_ksi,  m_P_atm, m_m, m_h0, m_ch, m_nb, m_A0, 
-                       m_nd, m_z_max, m_cz, massDen, mScheme, mTangType, mJacoType, mTolF, mTolR);
+        clone = new ManzariDafaliasPlaneStrain(this->getTag(), par.G0,  par.nu,  par.e_init,  par.Mc,  
+                       par.c, par.lambda_c,  par.e0,  par.ksi,  par.P_atm, par.m, par.h0, par.ch, par.nb, par.A0, 
+                       par.nd, par.z_max, par.cz, massDen, mScheme, mTangType, mJacoType, mTolF, mTolR);
+        clone->theParameters = theParameters;
         return clone;
     } else if (strcmp(type,"ThreeDimensional")==0 || strcmp(type,"3D") ==0) {
         ManzariDafalias3D *clone;
-             clone = new ManzariDafalias3D(this->getTag(), m_G0,  m_nu,  m_e_init,  m_Mc,  m_c, m_lambda_c,
-                         m_e0,  m_ksi,  m_P_atm, m_m, m_h0, m_ch, m_nb, m_A0, m_nd, m_z_max, m_cz, massDen, 
+             clone = new ManzariDafalias3D(this->getTag(), par.G0,  par.nu,  par.e_init,  par.Mc,  par.c, par.lambda_c,
+                         par.e0,  par.ksi,  par.P_atm, par.m, par.h0, par.ch, par.nb, par.A0, par.nd, par.z_max, par.cz, massDen, 
                          mScheme, mTangType, mJacoType, mTolF, mTolR);
+         clone->theParameters = theParameters;
          return clone;
       } else {
           opserr << "ManzariDafalias::getCopy failed to get copy: " << type << endln;
@@ -377,7 +314,7 @@ ManzariDafalias::commitState(void)
     mAlpha_n    = mAlpha;
     mFabric_n   = mFabric;
     mDGamma_n   = mDGamma;
-    mVoidRatio  = m_e_init - (1 + m_e_init) * GetTrace(mEpsilon);
+    mVoidRatio  = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(mEpsilon);
 
 	// This is needed for the ManzariDafaliasRO subclass
     GetStateDependent(mSigma, mAlpha, mFabric, mVoidRatio, mAlpha_in, 
@@ -403,7 +340,7 @@ ManzariDafalias::commitState(void)
 // opserr << "n = " << n;
 //  opserr << endln;
 
-    if (GetTrace(mSigma) > 0.01 * m_P_atm)
+    if (GetTrace(mSigma) > 0.01 * theParameters->P_atm)
         mUseElasticTan = false;
 
     return 0;
@@ -534,23 +471,23 @@ ManzariDafalias::sendSelf(int commitTag, Channel &theChannel)
 
     data(0) = this->getTag();
 
-    data(1)  = m_G0;
-    data(2)  = m_nu;
-    data(3)  = m_e_init;
-    data(4)  = m_Mc;
-    data(5)  = m_c;
-    data(6)  = m_lambda_c;
-    data(7)  = m_e0;
-    data(8)  = m_ksi;
-    data(9)  = m_P_atm;
-    data(10) = m_m;
-    data(11) = m_h0;
-    data(12) = m_ch;
-    data(13) = m_nb;
-    data(14) = m_A0;
-    data(15) = m_nd;
-    data(16) = m_z_max;
-    data(17) = m_cz;    
+    data(1)  = theParameters->G0;
+    data(2)  = theParameters->nu;
+    data(3)  = theParameters->e_init;
+    data(4)  = theParameters->Mc;
+    data(5)  = theParameters->c;
+    data(6)  = theParameters->lambda_c;
+    data(7)  = theParameters->e0;
+    data(8)  = theParameters->ksi;
+    data(9)  = theParameters->P_atm;
+    data(10) = theParameters->m;
+    data(11) = theParameters->h0;
+    data(12) = theParameters->ch;
+    data(13) = theParameters->nb;
+    data(14) = theParameters->A0;
+    data(15) = theParameters->nd;
+    data(16) = theParameters->z_max;
+    data(17) = theParameters->cz;    
     data(18) = massDen;
     
     data(19) = mTolF;
@@ -616,23 +553,10 @@ ManzariDafalias::recvSelf(int commitTag, Channel &theChannel,
     // set member variables
     this->setTag((int)data(0));
 
-    m_G0        = data(1);    
-    m_nu        = data(2);
-    m_e_init    = data(3);
-    m_Mc        = data(4);
-    m_c         = data(5);
-    m_lambda_c  = data(6);
-    m_e0        = data(7);
-    m_ksi       = data(8);
-    m_P_atm     = data(9);
-    m_m         = data(10);
-    m_h0        = data(11);
-    m_ch        = data(12);
-    m_nb        = data(13);
-    m_A0        = data(14);
-    m_nd        = data(15);
-    m_z_max     = data(16);
-    m_cz        = data(17);
+    // the received constants replace the block, which may be shared
+    theParameters = MaterialParameters<Parameters>(Parameters{data(1), data(2),
+        data(3), data(4), data(5), data(6), data(7), data(8), data(9), data(10),
+        data(11), data(12), data(13), data(14), data(15), data(16), data(17)});
     massDen     = data(18);
 
     mTolF        = data(19); 
@@ -670,7 +594,7 @@ ManzariDafalias::recvSelf(int commitTag, Channel &theChannel,
     mG        = data(95); 
     m_Pmin    = data(96); 
 
-    mVoidRatio  = m_e_init - (1 + m_e_init) * GetTrace(mEpsilon);
+    mVoidRatio  = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(mEpsilon);
 
     //GetElasticModuli(mSigma, mVoidRatio, mK, mG);
     mCe  = GetStiffness(mK, mG);
@@ -751,16 +675,16 @@ ManzariDafalias::updateParameter(int responseID, Information &info)
     }
     // called update refShearModulus
     else if (responseID == 6) {
-        m_G0 = info.theDouble;
+        theParameters.edit().G0 = info.theDouble;
     }
     // called update poissonRatio
     else if (responseID == 7) {
-        m_nu = info.theDouble;
+        theParameters.edit().nu = info.theDouble;
     }
     // called update voidRatio
     else if (responseID == 8) {
         double eps_v = GetTrace(mEpsilon);
-        m_e_init = (info.theDouble + eps_v) / (1 - eps_v);
+        theParameters.edit().e_init = (info.theDouble + eps_v) / (1 - eps_v);
     }
 	// flag to apply stress correction
     else if (responseID == 9) {
@@ -780,13 +704,13 @@ ManzariDafalias::initialize()
 {
     // set Initial Ce with p = p_atm
     Vector mSig(6);
-    mSig(0) = m_P_atm;
-    mSig(1) = m_P_atm;
-    mSig(2) = m_P_atm;
+    mSig(0) = theParameters->P_atm;
+    mSig(1) = theParameters->P_atm;
+    mSig(2) = theParameters->P_atm;
 
     // set minimum allowable p
-    m_Pmin      = 1.0e-4 * m_P_atm;
-    m_Presidual = 1.0e-2 * m_P_atm;
+    m_Pmin      = 1.0e-4 * theParameters->P_atm;
+    m_Presidual = 1.0e-2 * theParameters->P_atm;
 
     // strain and stress terms
     mEpsilon.Zero();
@@ -802,7 +726,7 @@ ManzariDafalias::initialize()
     mDGamma = 0.0;
     mFabric.Zero();
     mFabric_n.Zero();
-    mVoidRatio = m_e_init;
+    mVoidRatio = theParameters->e_init;
 
     // calculate initial stiffness parameters
     GetElasticModuli(mSig,mVoidRatio,mK,mG);
@@ -901,7 +825,7 @@ void ManzariDafalias::elastic_integrator(const Vector& CurStress, const Vector&
     // calculate elastic response
     // dStrain               = NextStrain - CurStrain;
 	dStrain = NextStrain; dStrain -= CurStrain;
-    NextVoidRatio         = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
+    NextVoidRatio         = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(NextStrain);
     // NextElasticStrain     = CurElasticStrain + dStrain;
 	NextElasticStrain = CurElasticStrain; NextElasticStrain += dStrain;
     GetElasticModuli(CurStress, NextVoidRatio, K, G); 
@@ -964,7 +888,7 @@ void ManzariDafalias::explicit_integrator(const Vector& CurStress, const Vector&
     Vector dSigma(6), dStrain(6), dElasStrain(6);
     bool   p_tr_pos = true;
 
-    NextVoidRatio          = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
+    NextVoidRatio          = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(NextStrain);
     // dStrain                = NextStrain - CurStrain;
 	dStrain = NextStrain; dStrain -= CurStrain;
 	// NextElasticStrain     = CurElasticStrain + dStrain;
@@ -1214,8 +1138,8 @@ void ManzariDafalias::ForwardEuler(const Vector& CurStress, const Vector& CurStr
         Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
         double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent) 
 {    
-    double CurVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(CurStrain);
-    NextVoidRatio     = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
+    double CurVoidRatio = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(CurStrain);
+    NextVoidRatio     = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(NextStrain);
     NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
     aC = GetStiffness(K, G);
     Vector n(6), d(6), b(6), R(6), dPStrain(6); 
@@ -1242,7 +1166,7 @@ void ManzariDafalias::ForwardEuler(const Vector& CurStress, const Vector& CurStr
     Vector dSigma   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1 - Macauley(NextDGamma)*
               (2.0*G*(B*n-C*(SingleDot(n,n)-one3*mI1)) + K*D*mI1);
     Vector dAlpha   = Macauley(NextDGamma) * two3 * h * b;
-    Vector dFabric  = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + CurFabric);
+    Vector dFabric  = -1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0*D) * (theParameters->z_max * n + CurFabric);
            dPStrain = NextDGamma * ToCovariant(R);
 
     Matrix temp1 = 2.0*G*mIIdevMix + K*mIIvol;
@@ -1302,9 +1226,9 @@ void ManzariDafalias::ModifiedEuler(const Vector& CurStress, const Vector& CurSt
 
     while (T < 1.0)
     {
-        // NextVoidRatio     = m_e_init - (1 + m_e_init) * GetTrace(NextStrain + T * (NextStrain - CurStrain));
+        // NextVoidRatio     = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(NextStrain + T * (NextStrain - CurStrain));
 		tmp0 = dStrain; tmp0 *= T; tmp0 += NextStrain;
-		NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(tmp0);
+		NextVoidRatio = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(tmp0);
         
         // dVolStrain = dT * GetTrace(NextStrain - CurStrain);
         // dDevStrain = dT * GetDevPart(NextStrain - CurStrain);
@@ -1357,11 +1281,11 @@ void ManzariDafalias::ModifiedEuler(const Vector& CurStress, const Vector& CurSt
 
                 // dAlpha1   = Macauley(NextDGamma) * two3 * h * b;
 				dAlpha1 = b; dAlpha1 *= (Macauley(NextDGamma) * two3 * h);
-                // dFabric1  = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + NextFabric);
+                // dFabric1  = -1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0*D) * (theParameters->z_max * n + NextFabric);
 				dFabric1 = n;
-				dFabric1 *= m_z_max;
+				dFabric1 *= theParameters->z_max;
 				dFabric1 += NextFabric;
-				dFabric1 *= -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0 * D);
+				dFabric1 *= -1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0 * D);
                 // dPStrain1 = NextDGamma * ToCovariant(R);
 				dPStrain1 = ToCovariant(R); dPStrain1 *= NextDGamma;
             }
@@ -1427,12 +1351,12 @@ void ManzariDafalias::ModifiedEuler(const Vector& CurStress, const Vector& CurSt
 
                 // dAlpha2   = Macauley(NextDGamma) * two3 * h * b;
 				dAlpha2 = b; dAlpha2 *= (Macauley(NextDGamma) * two3 * h);
-                // dFabric2  = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + NextFabric + dFabric1);
+                // dFabric2  = -1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0*D) * (theParameters->z_max * n + NextFabric + dFabric1);
 				dFabric2 = n;
-				dFabric2 *= m_z_max;
+				dFabric2 *= theParameters->z_max;
 				dFabric2 += NextFabric;
 				dFabric2 += dFabric1;
-				dFabric2 *= (-1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0 * D));
+				dFabric2 *= (-1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0 * D));
                 // dPStrain2 = NextDGamma * ToCovariant(R);
 				dPStrain2 = ToCovariant(R);  dPStrain2 *= NextDGamma;
             }
@@ -1491,8 +1415,8 @@ void ManzariDafalias::ModifiedEuler(const Vector& CurStress, const Vector& CurSt
 				NextElasticStrain -= tmp0;
                 NextStress = nStress;
                 double eta = sqrt(13.5) * GetNorm_Contr(GetDevPart(NextStress)) / GetTrace(NextStress);
-                if (eta > m_Mc)
-                    NextStress = one3 * GetTrace(NextStress) * mI1 + m_Mc / eta * GetDevPart(NextStress);
+                if (eta > theParameters->Mc)
+                    NextStress = one3 * GetTrace(NextStress) * mI1 + theParameters->Mc / eta * GetDevPart(NextStress);
                 NextAlpha  = CurAlpha + 3.0 * (GetDevPart(NextStress)/GetTrace(NextStress) - GetDevPart(CurStress)/GetTrace(CurStress));
                 
                 T += dT;
@@ -1546,8 +1470,8 @@ void ManzariDafalias::RungeKutta4(const Vector& CurStress, const Vector& CurStra
         dPStrain1(6), dPStrain2(6), dPStrain3(6), dPStrain4(6), dPStrain(6);
     double temp4, q;
     
-    CurVoidRatio      = m_e_init - (1 + m_e_init) * GetTrace(CurStrain);
-    NextVoidRatio     = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
+    CurVoidRatio      = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(CurStrain);
+    NextVoidRatio     = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(NextStrain);
     NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
 
     GetElasticModuli(CurStress, CurVoidRatio, K, G);
@@ -1559,7 +1483,7 @@ void ManzariDafalias::RungeKutta4(const Vector& CurStress, const Vector& CurStra
 
     while (T < 1.0)
     {
-        NextVoidRatio     = m_e_init - (1 + m_e_init) * GetTrace(NextStrain + T * (NextStrain - CurStrain));
+        NextVoidRatio     = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(NextStrain + T * (NextStrain - CurStrain));
         
         dVolStrain = dT * GetTrace(NextStrain - CurStrain);
         dDevStrain = dT * GetDevPart(NextStrain - CurStrain);
@@ -1582,7 +1506,7 @@ void ManzariDafalias::RungeKutta4(const Vector& CurStress, const Vector& CurStra
         dSigma1   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1 - Macauley(NextDGamma)*
              (2.0*G*(B*n-C*(SingleDot(n,n)-1.0/3.0*mI1)) + K*D*mI1);
         dAlpha1   = Macauley(NextDGamma) * two3 * h * b;
-        dFabric1  = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + CurFabric);
+        dFabric1  = -1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0*D) * (theParameters->z_max * n + CurFabric);
         dPStrain1 = NextDGamma * ToCovariant(R);
 
         // Calc Delta 2
@@ -1603,7 +1527,7 @@ void ManzariDafalias::RungeKutta4(const Vector& CurStress, const Vector& CurStra
         dSigma2   = 2.0*G*0.5* ToContraviant(dDevStrain) + K*0.5*dVolStrain*mI1 - Macauley(NextDGamma)*
               (2.0*G*(B*n-C*(SingleDot(n,n)-1.0/3.0*mI1)) + K*D*mI1);
         dAlpha2   = Macauley(NextDGamma) * two3 * h * b;
-        dFabric2  = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + CurFabric + 0.5 * dFabric1);
+        dFabric2  = -1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0*D) * (theParameters->z_max * n + CurFabric + 0.5 * dFabric1);
         dPStrain2 = NextDGamma * ToCovariant(R);
 
         // Calc Delta 3
@@ -1624,7 +1548,7 @@ void ManzariDafalias::RungeKutta4(const Vector& CurStress, const Vector& CurStra
         dSigma3   = 2.0*G*0.5* ToContraviant(dDevStrain) + K*0.5*dVolStrain*mI1 - Macauley(NextDGamma)*
              (2.0*G*(B*n-C*(SingleDot(n,n)-1.0/3.0*mI1)) + K*D*mI1);
         dAlpha3   = Macauley(NextDGamma) * two3 * h * b;
-        dFabric3  = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + CurFabric + 0.5 * dFabric2);
+        dFabric3  = -1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0*D) * (theParameters->z_max * n + CurFabric + 0.5 * dFabric2);
         dPStrain3 = NextDGamma * ToCovariant(R);
 
         // Calc Delta 4
@@ -1645,7 +1569,7 @@ void ManzariDafalias::RungeKutta4(const Vector& CurStress, const Vector& CurStra
         dSigma4   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1 - Macauley(NextDGamma)*
              (2.0*G*(B*n-C*(SingleDot(n,n)-1.0/3.0*mI1)) + K*D*mI1);
         dAlpha4   = Macauley(NextDGamma) * two3 * h * b;
-        dFabric4  = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + CurFabric + dFabric3);
+        dFabric4  = -1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0*D) * (theParameters->z_max * n + CurFabric + dFabric3);
         dPStrain4 = NextDGamma * ToCovariant(R);
         
         // RK
@@ -1745,8 +1669,8 @@ void ManzariDafalias::RungeKutta45(const Vector& CurStress, const Vector& CurStr
     aCep1.Zero(); aCep2.Zero(); aCep3.Zero(); aCep4.Zero(); aCep5.Zero(); aCep6.Zero(); aCep_thisStep.Zero(); aD.Zero();
     thisSigma.Zero(); thisAlpha.Zero(); thisFabric.Zero();    
     
-    CurVoidRatio      = m_e_init - (1 + m_e_init) * GetTrace(CurStrain);
-    NextVoidRatio     = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
+    CurVoidRatio      = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(CurStrain);
+    NextVoidRatio     = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(NextStrain);
     NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
 
     GetElasticModuli(CurStress, CurVoidRatio, K, G);
@@ -1771,7 +1695,7 @@ void ManzariDafalias::RungeKutta45(const Vector& CurStress, const Vector& CurStr
 
     while (T < 1.0)
     {
-        NextVoidRatio     = m_e_init - (1 + m_e_init) * GetTrace(NextStrain + T * (NextStrain - CurStrain));
+        NextVoidRatio     = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(NextStrain + T * (NextStrain - CurStrain));
         
         dVolStrain = dT * GetTrace(NextStrain - CurStrain);
         dDevStrain = dT * GetDevPart(NextStrain - CurStrain);
@@ -1794,7 +1718,7 @@ void ManzariDafalias::RungeKutta45(const Vector& CurStress, const Vector& CurStr
         dSigma1   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1 - Macauley(NextDGamma)*
              (2.0*G*(B*n-C*(SingleDot(n,n)-1.0/3.0*mI1)) + K*D*mI1);
         dAlpha1   = Macauley(NextDGamma) * two3 * h * b;
-        dFabric1   = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + thisFabric);
+        dFabric1   = -1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0*D) * (theParameters->z_max * n + thisFabric);
         dPStrain1 = NextDGamma * ToCovariant(R);
         
         aCep1 = GetElastoPlasticTangent(thisSigma, NextDGamma, CurStrain, NextStrain, G, K, B, C, D, h, n, d, b);
@@ -1816,7 +1740,7 @@ void ManzariDafalias::RungeKutta45(const Vector& CurStress, const Vector& CurStr
         dSigma2   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1 - Macauley(NextDGamma)*
              (2.0*G*(B*n-C*(SingleDot(n,n)-1.0/3.0*mI1)) + K*D*mI1);
         dAlpha2   = Macauley(NextDGamma) * two3 * h * b;
-        dFabric2   = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + thisFabric);
+        dFabric2   = -1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0*D) * (theParameters->z_max * n + thisFabric);
         dPStrain2 = NextDGamma * ToCovariant(R);
 
         aCep2 = GetElastoPlasticTangent(thisSigma, NextDGamma, CurStrain, NextStrain, G, K, B, C, D, h, n, d, b);
@@ -1836,7 +1760,7 @@ void ManzariDafalias::RungeKutta45(const Vector& CurStress, const Vector& CurStr
         NextDGamma      = (2.0*G*DoubleDot2_2_Mixed(n,dDevStrain) - K*dVolStrain*DoubleDot2_2_Contr(n,r))/temp4;
         dSigma3   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1 - Macauley(NextDGamma)*
              (2.0*G*(B*n-C*(SingleDot(n,n)-1.0/3.0*mI1)) + K*D*mI1);
-        dFabric3   = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + thisFabric);
+        dFabric3   = -1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0*D) * (theParameters->z_max * n + thisFabric);
         dPStrain3 = NextDGamma * ToCovariant(R);
 
         aCep3 = GetElastoPlasticTangent(thisSigma, NextDGamma, CurStrain, NextStrain, G, K, B, C, D, h, n, d, b);
@@ -1856,7 +1780,7 @@ void ManzariDafalias::RungeKutta45(const Vector& CurStress, const Vector& CurStr
         NextDGamma      = (2.0*G*DoubleDot2_2_Mixed(n,dDevStrain) - K*dVolStrain*DoubleDot2_2_Contr(n,r))/temp4;
         dSigma4   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1 - Macauley(NextDGamma)*
              (2.0*G*(B*n-C*(SingleDot(n,n)-1.0/3.0*mI1)) + K*D*mI1);
-        dFabric4   = -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + thisFabric);
+        dFabric4   = -1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0*D) * (theParameters->z_max * n + thisFabric);
         dPStrain4 = NextDGamma * ToCovariant(R);
 
         aCep4 = GetElastoPlasticTangent(thisSigma, NextDGamma, CurStrain, NextStrain, G, K, B, C, D, h, n, d, b);
@@ -1877,7 +1801,7 @@ void ManzariDafalias::RungeKutta45(const Vector& CurStress, const Vector& CurStr
         dSigma5   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1 - Macauley(NextDGamma)*
              (2.0*G*(B*n-C*(SingleDot(n,n)-1.0/3.0*mI1)) + K*D*mI1);
         dAlpha5   = Macauley(NextDGamma) * two3 * h * b;
-        dFabric5   =  -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + thisFabric);
+        dFabric5   =  -1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0*D) * (theParameters->z_max * n + thisFabric);
         dPStrain5 = NextDGamma * ToCovariant(R);
    
         aCep5 = GetElastoPlasticTangent(thisSigma, NextDGamma, CurStrain, NextStrain, G, K, B, C, D, h, n, d, b);
@@ -1898,7 +1822,7 @@ void ManzariDafalias::RungeKutta45(const Vector& CurStress, const Vector& CurStr
         dSigma6   = 2.0*G* ToContraviant(dDevStrain) + K*dVolStrain*mI1 - Macauley(NextDGamma)*
              (2.0*G*(B*n-C*(SingleDot(n,n)-1.0/3.0*mI1)) + K*D*mI1);
         dAlpha6   = Macauley(NextDGamma) * two3 * h * b;
-        dFabric6   =  -1.0 * Macauley(NextDGamma) * m_cz * Macauley(-1.0*D) * (m_z_max * n + thisFabric);
+        dFabric6   =  -1.0 * Macauley(NextDGamma) * theParameters->cz * Macauley(-1.0*D) * (theParameters->z_max * n + thisFabric);
         dPStrain6 = NextDGamma * ToCovariant(R);
 
         aCep6 = GetElastoPlasticTangent(thisSigma, NextDGamma, CurStrain, NextStrain, G, K, B, C, D, h, n, d, b);
@@ -1956,8 +1880,8 @@ void ManzariDafalias::RungeKutta45(const Vector& CurStress, const Vector& CurStr
                 NextElasticStrain -= dPStrain;// 0.5* (dPStrain1 + dPStrain2);
                 NextStress = nStress;
                 double eta = sqrt(13.5) * GetNorm_Contr(GetDevPart(NextStress)) / GetTrace(NextStress);
-                if (eta > m_Mc)
-                    NextStress = one3 * GetTrace(NextStress) * mI1 + m_Mc / eta * GetDevPart(NextStress);
+                if (eta > theParameters->Mc)
+                    NextStress = one3 * GetTrace(NextStress) * mI1 + theParameters->Mc / eta * GetDevPart(NextStress);
                 NextAlpha  = CurAlpha + 3.0 * (GetDevPart(NextStress)/GetTrace(NextStress) - GetDevPart(CurStress)/GetTrace(CurStress));
                 
                 // ++N_nonconverged;
@@ -2030,8 +1954,8 @@ int ManzariDafalias::BackwardEuler_CPPM(const Vector& CurStress, const Vector& C
     Matrix aC(6,6), aCep(6,6), aCepConsistent(6,6);
     double CurVoidRatio;
 
-    CurVoidRatio      = m_e_init - (1 + m_e_init) * GetTrace(CurStrain);
-    NextVoidRatio     = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
+    CurVoidRatio      = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(CurStrain);
+    NextVoidRatio     = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(NextStrain);
 
     // elastic trial strain
     NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
@@ -2291,12 +2215,12 @@ ManzariDafalias::IntersectionFactor(const Vector& CurStress, const Vector& CurSt
 
     strainInc = NextStrain - CurStrain;
 
-    vR      = m_e_init - (1 + m_e_init) * GetTrace(CurStrain + a0 * strainInc);
+    vR      = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(CurStrain + a0 * strainInc);
     GetElasticModuli(CurStress, vR, K, G);
     dSigma0 = a0 * DoubleDot4_2(GetStiffness(K, G), strainInc);
     f0 = GetF(CurStress + dSigma0, CurAlpha);
 
-    vR      = m_e_init - (1 + m_e_init) * GetTrace(CurStrain + a1 * strainInc);
+    vR      = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(CurStrain + a1 * strainInc);
     GetElasticModuli(CurStress, vR, K, G);
     dSigma1 = a1 * DoubleDot4_2(GetStiffness(K, G), strainInc);
     f1 = GetF(CurStress + dSigma1, CurAlpha);
@@ -2345,7 +2269,7 @@ ManzariDafalias::IntersectionFactor_Unloading(const Vector& CurStress, const Vec
     strainInc = NextStrain - CurStrain;
     
     
-    vR    = m_e_init - (1 + m_e_init) * GetTrace(CurStrain ); 
+    vR    = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(CurStrain ); 
     GetElasticModuli(CurStress, vR, K, G);
     dSigma = DoubleDot4_2(GetStiffness(K, G), strainInc);
 
@@ -2418,14 +2342,14 @@ ManzariDafalias::Stress_Correction(const Vector& CurStress, const Vector& CurStr
             NextDLambda = 0.0;
 
             Vector N(6); N = GetDevPart(NextStress) - p*NextAlpha;
-            double fr1  = GetNorm_Contr(N)-root23*m_m*p;
+            double fr1  = GetNorm_Contr(N)-root23*theParameters->m*p;
             double fr2  = m_Pmin - p;
             double J11, J12, J21, J22;
 
             for (int i = 1; i <= maxIter; i++)
             {
-                J11 = DoubleDot2_2_Contr(N/GetNorm_Contr(N),-2.0*G*R+K*D*NextAlpha)+root23*m_m*K*D;
-                J12 = DoubleDot2_2_Contr(N/GetNorm_Contr(N),-K*NextAlpha)-root23*m_m*K;
+                J11 = DoubleDot2_2_Contr(N/GetNorm_Contr(N),-2.0*G*R+K*D*NextAlpha)+root23*theParameters->m*K*D;
+                J12 = DoubleDot2_2_Contr(N/GetNorm_Contr(N),-K*NextAlpha)-root23*theParameters->m*K;
                 J21 = K*D;
                 J22 = -K;
                 
@@ -2436,7 +2360,7 @@ ManzariDafalias::Stress_Correction(const Vector& CurStress, const Vector& CurStr
 
                 N = GetDevPart(NextStress) - p*NextAlpha - 2.0*G*NextDGamma*R + K*(D*NextDGamma-NextDLambda)*NextAlpha;
 
-                fr1  = GetNorm_Contr(N)-root23*m_m*(p-K*(D*NextDGamma-NextDLambda));
+                fr1  = GetNorm_Contr(N)-root23*theParameters->m*(p-K*(D*NextDGamma-NextDLambda));
                 fr2  = m_Pmin - p + K*(D*NextDGamma-NextDLambda);
 
 
@@ -2832,7 +2756,7 @@ ManzariDafalias::NewtonRes(const Vector& x, const Vector& inVar)
     // p = one3 * GetTrace(stress);
     // p = p < small ? small : p;
     aBar = two3 * h * b;
-    zBar = -1.0 * m_cz * Macauley(-1.0 * D) * (m_z_max * n + fabric);
+    zBar = -1.0 * theParameters->cz * Macauley(-1.0 * D) * (theParameters->z_max * n + fabric);
         
     dEstrain = aD * (stress - curStress);
     eStrain = curEStrain + dEstrain;
@@ -2936,9 +2860,9 @@ ManzariDafalias::NewtonSol(const Vector &xo, const Vector &inVar, Vector& del, M
     r = devStress - p * alpha;
     normR = GetNorm_Contr(r);
     dnFlag = (normR == 0 ? 0.0 : 1.0);
-    gc = g(Cos3Theta, m_c);
+    gc = g(Cos3Theta, theParameters->c);
     aBar = two3 * h * b;
-    zBar = -1.0 * m_cz * Macauley(-1.0 * D) * (m_z_max * n + fabric);
+    zBar = -1.0 * theParameters->cz * Macauley(-1.0 * D) * (theParameters->z_max * n + fabric);
         
     dEstrain = aD * (stress - curStress);
     eStrain = curEStrain + dEstrain;
@@ -2952,23 +2876,23 @@ ManzariDafalias::NewtonSol(const Vector &xo, const Vector &inVar, Vector& del, M
     // d...OverdSigma : Arranged by order of dependence
     dnOverdSigma          = dnFlag * ( 1.0 / normR * (mIIdevCon - dpFlag*one3*Dyadic2_2(alpha,mI1) - 
         Dyadic2_2(n,n) + dpFlag*one3*DoubleDot2_2_Contr(alpha,n)*Dyadic2_2(n,mI1)));
-    dPsiOverdSigma        = dpFlag * one3 * m_ksi * m_lambda_c / m_P_atm * pow(p/m_P_atm, m_ksi-1) * mI1;
+    dPsiOverdSigma        = dpFlag * one3 * theParameters->ksi * theParameters->lambda_c / theParameters->P_atm * pow(p/theParameters->P_atm, theParameters->ksi-1) * mI1;
     db0OverdSigma         = dpFlag*(-b0 / (6.0*p) * mI1);
 
     dCos3ThetaOverdSigma  = 3.0 * sqrt(6.0) * DoubleDot2_4(n2, ToCovariant(dnOverdSigma));
-    dAdOverdSigma         = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
+    dAdOverdSigma         = theParameters->A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
         DoubleDot2_4(fabric, ToCovariant(dnOverdSigma));
     dhOverdSigma          = dhFlag * (1.0 / AlphaAlphaInDotN * (db0OverdSigma - 
         h*DoubleDot2_4(alpha-alpha_in, ToCovariant(dnOverdSigma))));
 
-    dgOverdSigma          = pow(gc,2.0) * (1.0-m_c)/(2.0*m_c) * dCos3ThetaOverdSigma;
+    dgOverdSigma          = pow(gc,2.0) * (1.0-theParameters->c)/(2.0*theParameters->c) * dCos3ThetaOverdSigma;
 
-    dAlphaDOverdSigma     = m_Mc * exp(m_nd * psi) * (dgOverdSigma + m_nd * gc * dPsiOverdSigma);
-    dCOverdSigma          = 3.0 * sqrt(1.5) * (1 - m_c)/m_c * dgOverdSigma;
-    dBOverdSigma          = 1.5 * (1.0 - m_c)/m_c * (dgOverdSigma * Cos3Theta + gc * dCos3ThetaOverdSigma);
-    dAlphaBOverdSigma     = m_Mc * exp(-1.0*m_nb*psi) * (dgOverdSigma - m_nb * gc * dPsiOverdSigma);
+    dAlphaDOverdSigma     = theParameters->Mc * exp(theParameters->nd * psi) * (dgOverdSigma + theParameters->nd * gc * dPsiOverdSigma);
+    dCOverdSigma          = 3.0 * sqrt(1.5) * (1 - theParameters->c)/theParameters->c * dgOverdSigma;
+    dBOverdSigma          = 1.5 * (1.0 - theParameters->c)/theParameters->c * (dgOverdSigma * Cos3Theta + gc * dCos3ThetaOverdSigma);
+    dAlphaBOverdSigma     = theParameters->Mc * exp(-1.0*theParameters->nb*psi) * (dgOverdSigma - theParameters->nb * gc * dPsiOverdSigma);
 
-	if (p < 0.05 * m_P_atm)
+	if (p < 0.05 * theParameters->P_atm)
 	{
 		double be = 7.2713;
 		double temp1 = exp(7.6349 - 7.2713 * p);
@@ -2987,24 +2911,24 @@ ManzariDafalias::NewtonSol(const Vector &xo, const Vector &inVar, Vector& del, M
     dROverdSigma          = B * dnOverdSigma + Dyadic2_2(n, dBOverdSigma) - C * 
         (Trans_SingleDot4T_2(dnOverdSigma,n) + SingleDot2_4(n, dnOverdSigma)) -
         Dyadic2_2((n2 - one3 * mI1),dCOverdSigma) + one3 * Dyadic2_2(mI1, dDOverdSigma);
-	dZbarOverdSigma       = m_cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(m_z_max*n + fabric, dDOverdSigma)
-		- m_cz * Macauley(-1.0 * D) * m_z_max * dnOverdSigma;
+	dZbarOverdSigma       = theParameters->cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(theParameters->z_max*n + fabric, dDOverdSigma)
+		- theParameters->cz * Macauley(-1.0 * D) * theParameters->z_max * dnOverdSigma;
 
     // d...OverdAlpha : Arranged by order of dependence
     dnOverdAlpha          = dnFlag * (p / normR * (Dyadic2_2(n,n) - mIIcon));
 
     dCos3ThetaOverdAlpha  = 3.0 * sqrt(6.0) * DoubleDot2_4(n2, ToCovariant(dnOverdAlpha));
-    dAdOverdAlpha         = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
+    dAdOverdAlpha         = theParameters->A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
         DoubleDot2_4(fabric, ToCovariant(dnOverdAlpha));
     dhOverdAlpha          = dhFlag * (-1.0*h / AlphaAlphaInDotN * (n + 
         DoubleDot2_4(alpha-alpha_in,ToCovariant(dnOverdAlpha))));
 
-    dgOverdAlpha          = pow(gc,2.0) * (1.0-m_c)/(2.0*m_c) * dCos3ThetaOverdAlpha;
+    dgOverdAlpha          = pow(gc,2.0) * (1.0-theParameters->c)/(2.0*theParameters->c) * dCos3ThetaOverdAlpha;
 
-    dAlphaDOverdAlpha     = m_Mc * exp(m_nd * psi) * dgOverdAlpha;
-    dCOverdAlpha          = 3.0 * sqrt(1.5) * (1 - m_c)/m_c * dgOverdAlpha;
-    dBOverdAlpha          = 1.5 * (1.0 - m_c)/m_c * (dgOverdAlpha * Cos3Theta + gc * dCos3ThetaOverdAlpha);
-    dAlphaBOverdAlpha     = m_Mc * exp(-1.0*m_nb*psi) * dgOverdAlpha;
+    dAlphaDOverdAlpha     = theParameters->Mc * exp(theParameters->nd * psi) * dgOverdAlpha;
+    dCOverdAlpha          = 3.0 * sqrt(1.5) * (1 - theParameters->c)/theParameters->c * dgOverdAlpha;
+    dBOverdAlpha          = 1.5 * (1.0 - theParameters->c)/theParameters->c * (dgOverdAlpha * Cos3Theta + gc * dCos3ThetaOverdAlpha);
+    dAlphaBOverdAlpha     = theParameters->Mc * exp(-1.0*theParameters->nb*psi) * dgOverdAlpha;
 
     dDOverdAlpha          = dAdOverdAlpha * (root23 * alphaDtheta - 
         DoubleDot2_2_Contr(alpha, n)) + A * (root23 * dAlphaDOverdAlpha -
@@ -3015,21 +2939,21 @@ ManzariDafalias::NewtonSol(const Vector &xo, const Vector &inVar, Vector& del, M
     dROverdAlpha          = B * dnOverdAlpha + Dyadic2_2(n, dBOverdAlpha) - C * 
         (Trans_SingleDot4T_2(dnOverdAlpha,n) + SingleDot2_4(n, dnOverdAlpha)) -
         Dyadic2_2((n2 - one3 * mI1),dCOverdAlpha) + one3 * Dyadic2_2(mI1, dDOverdAlpha);
-	dZbarOverdAlpha       = m_cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(m_z_max*n + fabric, dDOverdAlpha)
-		- m_cz * Macauley(-1.0 * D) * m_z_max * dnOverdAlpha;
+	dZbarOverdAlpha       = theParameters->cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(theParameters->z_max*n + fabric, dDOverdAlpha)
+		- theParameters->cz * Macauley(-1.0 * D) * theParameters->z_max * dnOverdAlpha;
 
     // d...OverdFabric : Arranged by order of dependence
-    dAdOverdFabric        = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * n;
+    dAdOverdFabric        = theParameters->A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * n;
 
     dDOverdFabric         = dAdOverdFabric * (root23 * alphaDtheta - DoubleDot2_2_Contr(alpha, n));
     
     dROverdFabric         = one3 * Dyadic2_2(mI1, dDOverdFabric);
 
-	dZbarOverdFabric      = m_cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(m_z_max*n + fabric, dDOverdFabric)
-		- m_cz * Macauley(-1.0 * D) *  mIIcon;
+	dZbarOverdFabric      = theParameters->cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(theParameters->z_max*n + fabric, dDOverdFabric)
+		- theParameters->cz * Macauley(-1.0 * D) *  mIIcon;
 
         
-    dfOverdSigma        = n - one3 * (DoubleDot2_2_Contr(n, alpha) + root23 * m_m) * mI1;
+    dfOverdSigma        = n - one3 * (DoubleDot2_2_Contr(n, alpha) + root23 * theParameters->m) * mI1;
     dfOverdAlpha        = -1.0 * p * n;
 
     // -------------------------------------------------------------------------
@@ -3344,9 +3268,9 @@ ManzariDafalias::NewtonSol2(const Vector &xo, const Vector &inVar, Vector& res,
     r = devStress - p * alpha;
     normR = GetNorm_Contr(r);
     dnFlag = normR == 0 ? 0.0 : 1.0;
-    gc = g(Cos3Theta, m_c);
+    gc = g(Cos3Theta, theParameters->c);
     aBar = two3 * h * b;
-    zBar = -1.0 * m_cz * Macauley(-1.0 * D) * (m_z_max * n + fabric);
+    zBar = -1.0 * theParameters->cz * Macauley(-1.0 * D) * (theParameters->z_max * n + fabric);
         
     dEstrain = aD * (stress - curStress);
     eStrain = curEStrain + dEstrain;
@@ -3365,23 +3289,23 @@ ManzariDafalias::NewtonSol2(const Vector &xo, const Vector &inVar, Vector& res,
     // d...OverdSigma : Arranged by order of dependence
     dnOverdSigma          = dnFlag * ( 1.0 / normR * (mIIdevCon - dpFlag*one3*Dyadic2_2(alpha,mI1) - 
         Dyadic2_2(n,n) + dpFlag*one3*DoubleDot2_2_Contr(alpha,n)*Dyadic2_2(n,mI1)));
-    dPsiOverdSigma        = dpFlag * one3 * m_ksi * m_lambda_c / m_P_atm * pow(p/m_P_atm, m_ksi-1) * mI1;
+    dPsiOverdSigma        = dpFlag * one3 * theParameters->ksi * theParameters->lambda_c / theParameters->P_atm * pow(p/theParameters->P_atm, theParameters->ksi-1) * mI1;
     db0OverdSigma         = dpFlag*(-b0 / (6.0*p) * mI1);
 
     dCos3ThetaOverdSigma  = 3.0 * sqrt(6.0) * DoubleDot2_4(n2, ToCovariant(dnOverdSigma));
-    dAdOverdSigma         = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
+    dAdOverdSigma         = theParameters->A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
         DoubleDot2_4(fabric, ToCovariant(dnOverdSigma));
     dhOverdSigma          = dhFlag * (1.0 / AlphaAlphaInDotN * (db0OverdSigma - 
         h*DoubleDot2_4(alpha-alpha_in, ToCovariant(dnOverdSigma))));
 
-    dgOverdSigma          = pow(gc,2.0) * (1.0-m_c)/(2.0*m_c) * dCos3ThetaOverdSigma;
+    dgOverdSigma          = pow(gc,2.0) * (1.0-theParameters->c)/(2.0*theParameters->c) * dCos3ThetaOverdSigma;
 
-    dAlphaDOverdSigma     = m_Mc * exp(m_nd * psi) * (dgOverdSigma + m_nd * gc * dPsiOverdSigma);
-    dCOverdSigma          = 3.0 * sqrt(1.5) * (1 - m_c)/m_c * dgOverdSigma;
-    dBOverdSigma          = 1.5 * (1.0 - m_c)/m_c * (dgOverdSigma * Cos3Theta + gc * dCos3ThetaOverdSigma);
-    dAlphaBOverdSigma     = m_Mc * exp(-1.0*m_nb*psi) * (dgOverdSigma - m_nb * gc * dPsiOverdSigma);
+    dAlphaDOverdSigma     = theParameters->Mc * exp(theParameters->nd * psi) * (dgOverdSigma + theParameters->nd * gc * dPsiOverdSigma);
+    dCOverdSigma          = 3.0 * sqrt(1.5) * (1 - theParameters->c)/theParameters->c * dgOverdSigma;
+    dBOverdSigma          = 1.5 * (1.0 - theParameters->c)/theParameters->c * (dgOverdSigma * Cos3Theta + gc * dCos3ThetaOverdSigma);
+    dAlphaBOverdSigma     = theParameters->Mc * exp(-1.0*theParameters->nb*psi) * (dgOverdSigma - theParameters->nb * gc * dPsiOverdSigma);
 
-    if (p < 0.001 * m_P_atm)
+    if (p < 0.001 * theParameters->P_atm)
     {
         double be       = 207232.6584 * 2.0 * m_Pmin ;
         double temp1    = exp(20.72326584 - be*p);
@@ -3399,24 +3323,24 @@ ManzariDafalias::NewtonSol2(const Vector &xo, const Vector &inVar, Vector& res,
     dROverdSigma          = B * dnOverdSigma + Dyadic2_2(n, dBOverdSigma) - C * 
         (Trans_SingleDot4T_2(dnOverdSigma,n) + SingleDot2_4(n, dnOverdSigma)) -
         Dyadic2_2((n2 - one3 * mI1),dCOverdSigma) + one3 * Dyadic2_2(mI1, dDOverdSigma);
-    dZbarOverdSigma       = -1.0 * m_cz * MacauleyIndex(-1.0*D) * 
-        (-1.0*Dyadic2_2(m_z_max*n + fabric, dDOverdSigma) - m_z_max * D * dnOverdSigma);
+    dZbarOverdSigma       = -1.0 * theParameters->cz * MacauleyIndex(-1.0*D) * 
+        (-1.0*Dyadic2_2(theParameters->z_max*n + fabric, dDOverdSigma) - theParameters->z_max * D * dnOverdSigma);
 
     // d...OverdAlpha : Arranged by order of dependence
     dnOverdAlpha          = dnFlag * (p / normR * (Dyadic2_2(n,n) - mIIcon));
 
     dCos3ThetaOverdAlpha  = 3.0 * sqrt(6.0) * DoubleDot2_4(n2, ToCovariant(dnOverdAlpha));
-    dAdOverdAlpha         = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
+    dAdOverdAlpha         = theParameters->A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
         DoubleDot2_4(fabric, ToCovariant(dnOverdAlpha));
     dhOverdAlpha          = dhFlag * (-1.0*h / AlphaAlphaInDotN * (n + 
         DoubleDot2_4(alpha-alpha_in,ToCovariant(dnOverdAlpha))));
 
-    dgOverdAlpha          = pow(gc,2.0) * (1.0-m_c)/(2.0*m_c) * dCos3ThetaOverdAlpha;
+    dgOverdAlpha          = pow(gc,2.0) * (1.0-theParameters->c)/(2.0*theParameters->c) * dCos3ThetaOverdAlpha;
 
-    dAlphaDOverdAlpha     = m_Mc * exp(m_nd * psi) * dgOverdAlpha;
-    dCOverdAlpha          = 3.0 * sqrt(1.5) * (1 - m_c)/m_c * dgOverdAlpha;
-    dBOverdAlpha          = 1.5 * (1.0 - m_c)/m_c * (dgOverdAlpha * Cos3Theta + gc * dCos3ThetaOverdAlpha);
-    dAlphaBOverdAlpha     = m_Mc * exp(-1.0*m_nb*psi) * dgOverdAlpha;
+    dAlphaDOverdAlpha     = theParameters->Mc * exp(theParameters->nd * psi) * dgOverdAlpha;
+    dCOverdAlpha          = 3.0 * sqrt(1.5) * (1 - theParameters->c)/theParameters->c * dgOverdAlpha;
+    dBOverdAlpha          = 1.5 * (1.0 - theParameters->c)/theParameters->c * (dgOverdAlpha * Cos3Theta + gc * dCos3ThetaOverdAlpha);
+    dAlphaBOverdAlpha     = theParameters->Mc * exp(-1.0*theParameters->nb*psi) * dgOverdAlpha;
 
     dDOverdAlpha          = dAdOverdAlpha * (root23 * alphaDtheta - 
         DoubleDot2_2_Contr(alpha, n)) + A * (root23 * dAlphaDOverdAlpha -
@@ -3427,21 +3351,21 @@ ManzariDafalias::NewtonSol2(const Vector &xo, const Vector &inVar, Vector& res,
     dROverdAlpha          = B * dnOverdAlpha + Dyadic2_2(n, dBOverdAlpha) - C * 
         (Trans_SingleDot4T_2(dnOverdAlpha,n) + SingleDot2_4(n, dnOverdAlpha)) -
         Dyadic2_2((n2 - one3 * mI1),dCOverdAlpha) + one3 * Dyadic2_2(mI1, dDOverdAlpha);
-    dZbarOverdAlpha       = -1.0*m_cz*MacauleyIndex(-1.0*D) * (-1.0*
-        Dyadic2_2(m_z_max*n + fabric, dDOverdAlpha) - m_z_max * D * dnOverdAlpha);
+    dZbarOverdAlpha       = -1.0*theParameters->cz*MacauleyIndex(-1.0*D) * (-1.0*
+        Dyadic2_2(theParameters->z_max*n + fabric, dDOverdAlpha) - theParameters->z_max * D * dnOverdAlpha);
 
     // d...OverdFabric : Arranged by order of dependence
-    dAdOverdFabric        = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * n;
+    dAdOverdFabric        = theParameters->A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * n;
 
     dDOverdFabric         = dAdOverdFabric * (root23 * alphaDtheta - DoubleDot2_2_Contr(alpha, n));
     
     dROverdFabric         = one3 * Dyadic2_2(mI1, dDOverdFabric);
 
-    dZbarOverdFabric      = -1.0*m_cz* MacauleyIndex(-1.0*D) * 
-        (-1.0*Dyadic2_2(m_z_max * n + fabric, dDOverdFabric) - D * mIIcon);
+    dZbarOverdFabric      = -1.0*theParameters->cz* MacauleyIndex(-1.0*D) * 
+        (-1.0*Dyadic2_2(theParameters->z_max * n + fabric, dDOverdFabric) - D * mIIcon);
 
         
-    dfOverdSigma        = n - one3 * (DoubleDot2_2_Contr(n, alpha) + root23 * m_m) * mI1;
+    dfOverdSigma        = n - one3 * (DoubleDot2_2_Contr(n, alpha) + root23 * theParameters->m) * mI1;
     dfOverdAlpha        = -1.0 * p * n;
 
     // -------------------------------------------------------------------------
@@ -3750,9 +3674,9 @@ ManzariDafalias::NewtonSol_negP(const Vector &xo, const Vector &inVar, Vector& d
     r = devStress - p * alpha;
     normR = GetNorm_Contr(r);
     dnFlag = (normR == 0 ? 0.0 : 1.0);
-    gc = g(Cos3Theta, m_c);
+    gc = g(Cos3Theta, theParameters->c);
     aBar = two3 * h * b;
-    zBar = -1.0 * m_cz * Macauley(-1.0 * D) * (m_z_max * n + fabric);
+    zBar = -1.0 * theParameters->cz * Macauley(-1.0 * D) * (theParameters->z_max * n + fabric);
         
     dEstrain = aD * (stress - curStress);
     eStrain = curEStrain + dEstrain;
@@ -3767,23 +3691,23 @@ ManzariDafalias::NewtonSol_negP(const Vector &xo, const Vector &inVar, Vector& d
     // d...OverdSigma : Arranged by order of dependence
     dnOverdSigma          = dnFlag * ( 1.0 / normR * (mIIdevCon - dpFlag*one3*Dyadic2_2(alpha,mI1) - 
         Dyadic2_2(n,n) + dpFlag*one3*DoubleDot2_2_Contr(alpha,n)*Dyadic2_2(n,mI1)));
-    dPsiOverdSigma        = dpFlag * one3 * m_ksi * m_lambda_c / m_P_atm * pow(p/m_P_atm, m_ksi-1) * mI1;
+    dPsiOverdSigma        = dpFlag * one3 * theParameters->ksi * theParameters->lambda_c / theParameters->P_atm * pow(p/theParameters->P_atm, theParameters->ksi-1) * mI1;
     db0OverdSigma         = dpFlag*(-b0 / (6.0*p) * mI1);
 
     dCos3ThetaOverdSigma  = 3.0 * sqrt(6.0) * DoubleDot2_4(n2, ToCovariant(dnOverdSigma));
-    dAdOverdSigma         = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
+    dAdOverdSigma         = theParameters->A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
         DoubleDot2_4(fabric, ToCovariant(dnOverdSigma));
     dhOverdSigma          = dhFlag * (1.0 / AlphaAlphaInDotN * (db0OverdSigma - 
         h*DoubleDot2_4(alpha-alpha_in, ToCovariant(dnOverdSigma))));
 
-    dgOverdSigma          = pow(gc,2.0) * (1.0-m_c)/(2.0*m_c) * dCos3ThetaOverdSigma;
+    dgOverdSigma          = pow(gc,2.0) * (1.0-theParameters->c)/(2.0*theParameters->c) * dCos3ThetaOverdSigma;
 
-    dAlphaDOverdSigma     = m_Mc * exp(m_nd * psi) * (dgOverdSigma + m_nd * gc * dPsiOverdSigma);
-    dCOverdSigma          = 3.0 * sqrt(1.5) * (1 - m_c)/m_c * dgOverdSigma;
-    dBOverdSigma          = 1.5 * (1.0 - m_c)/m_c * (dgOverdSigma * Cos3Theta + gc * dCos3ThetaOverdSigma);
-    dAlphaBOverdSigma     = m_Mc * exp(-1.0*m_nb*psi) * (dgOverdSigma - m_nb * gc * dPsiOverdSigma);
+    dAlphaDOverdSigma     = theParameters->Mc * exp(theParameters->nd * psi) * (dgOverdSigma + theParameters->nd * gc * dPsiOverdSigma);
+    dCOverdSigma          = 3.0 * sqrt(1.5) * (1 - theParameters->c)/theParameters->c * dgOverdSigma;
+    dBOverdSigma          = 1.5 * (1.0 - theParameters->c)/theParameters->c * (dgOverdSigma * Cos3Theta + gc * dCos3ThetaOverdSigma);
+    dAlphaBOverdSigma     = theParameters->Mc * exp(-1.0*theParameters->nb*psi) * (dgOverdSigma - theParameters->nb * gc * dPsiOverdSigma);
 
-	if (p < 0.05 * m_P_atm)
+	if (p < 0.05 * theParameters->P_atm)
 	{
 		double be = 7.2713;
 		double temp1 = exp(7.6349 - 7.2713 * p);
@@ -3803,24 +3727,24 @@ ManzariDafalias::NewtonSol_negP(const Vector &xo, const Vector &inVar, Vector& d
     dROverdSigma          = B * dnOverdSigma + Dyadic2_2(n, dBOverdSigma) - C * 
         (Trans_SingleDot4T_2(dnOverdSigma,n) + SingleDot2_4(n, dnOverdSigma)) -
         Dyadic2_2((n2 - one3 * mI1),dCOverdSigma) + one3 * Dyadic2_2(mI1, dDOverdSigma);
-	dZbarOverdSigma       = m_cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(m_z_max*n + fabric, dDOverdSigma)
-		- m_cz * Macauley(-1.0 * D) * m_z_max * dnOverdSigma;
+	dZbarOverdSigma       = theParameters->cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(theParameters->z_max*n + fabric, dDOverdSigma)
+		- theParameters->cz * Macauley(-1.0 * D) * theParameters->z_max * dnOverdSigma;
 
     // d...OverdAlpha : Arranged by order of dependence
     dnOverdAlpha          = dnFlag * (p / normR * (Dyadic2_2(n,n) - mIIcon));
 
     dCos3ThetaOverdAlpha  = 3.0 * sqrt(6.0) * DoubleDot2_4(n2, ToCovariant(dnOverdAlpha));
-    dAdOverdAlpha         = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
+    dAdOverdAlpha         = theParameters->A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
         DoubleDot2_4(fabric, ToCovariant(dnOverdAlpha));
     dhOverdAlpha          = dhFlag * (-1.0*h / AlphaAlphaInDotN * (n + 
         DoubleDot2_4(alpha-alpha_in,ToCovariant(dnOverdAlpha))));
 
-    dgOverdAlpha          = pow(gc,2.0) * (1.0-m_c)/(2.0*m_c) * dCos3ThetaOverdAlpha;
+    dgOverdAlpha          = pow(gc,2.0) * (1.0-theParameters->c)/(2.0*theParameters->c) * dCos3ThetaOverdAlpha;
 
-    dAlphaDOverdAlpha     = m_Mc * exp(m_nd * psi) * dgOverdAlpha;
-    dCOverdAlpha          = 3.0 * sqrt(1.5) * (1 - m_c)/m_c * dgOverdAlpha;
-    dBOverdAlpha          = 1.5 * (1.0 - m_c)/m_c * (dgOverdAlpha * Cos3Theta + gc * dCos3ThetaOverdAlpha);
-    dAlphaBOverdAlpha     = m_Mc * exp(-1.0*m_nb*psi) * dgOverdAlpha;
+    dAlphaDOverdAlpha     = theParameters->Mc * exp(theParameters->nd * psi) * dgOverdAlpha;
+    dCOverdAlpha          = 3.0 * sqrt(1.5) * (1 - theParameters->c)/theParameters->c * dgOverdAlpha;
+    dBOverdAlpha          = 1.5 * (1.0 - theParameters->c)/theParameters->c * (dgOverdAlpha * Cos3Theta + gc * dCos3ThetaOverdAlpha);
+    dAlphaBOverdAlpha     = theParameters->Mc * exp(-1.0*theParameters->nb*psi) * dgOverdAlpha;
 
     dDOverdAlpha          = dAdOverdAlpha * (root23 * alphaDtheta - 
         DoubleDot2_2_Contr(alpha, n)) + A * (root23 * dAlphaDOverdAlpha -
@@ -3831,21 +3755,21 @@ ManzariDafalias::NewtonSol_negP(const Vector &xo, const Vector &inVar, Vector& d
     dROverdAlpha          = B * dnOverdAlpha + Dyadic2_2(n, dBOverdAlpha) - C * 
         (Trans_SingleDot4T_2(dnOverdAlpha,n) + SingleDot2_4(n, dnOverdAlpha)) -
         Dyadic2_2((n2 - one3 * mI1),dCOverdAlpha) + one3 * Dyadic2_2(mI1, dDOverdAlpha);
-	dZbarOverdAlpha       = m_cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(m_z_max*n + fabric, dDOverdAlpha)
-		- m_cz * Macauley(-1.0 * D) * m_z_max * dnOverdAlpha;
+	dZbarOverdAlpha       = theParameters->cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(theParameters->z_max*n + fabric, dDOverdAlpha)
+		- theParameters->cz * Macauley(-1.0 * D) * theParameters->z_max * dnOverdAlpha;
 
     // d...OverdFabric : Arranged by order of dependence
-    dAdOverdFabric        = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * n;
+    dAdOverdFabric        = theParameters->A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * n;
 
     dDOverdFabric         = dAdOverdFabric * (root23 * alphaDtheta - DoubleDot2_2_Contr(alpha, n));
     
     dROverdFabric         = one3 * Dyadic2_2(mI1, dDOverdFabric);
 
-	dZbarOverdFabric      = m_cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(m_z_max*n + fabric, dDOverdFabric)
-		- m_cz * Macauley(-1.0 * D) *  mIIcon;
+	dZbarOverdFabric      = theParameters->cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(theParameters->z_max*n + fabric, dDOverdFabric)
+		- theParameters->cz * Macauley(-1.0 * D) *  mIIcon;
 
         
-    dfOverdSigma        = n - one3 * (DoubleDot2_2_Contr(n, alpha) + root23 * m_m) * mI1;
+    dfOverdSigma        = n - one3 * (DoubleDot2_2_Contr(n, alpha) + root23 * theParameters->m) * mI1;
     dfOverdAlpha        = -1.0 * p * n;
 
     // -------------------------------------------------------------------------
@@ -4041,7 +3965,7 @@ ManzariDafalias::NewtonRes_negP(const Vector& x, const Vector& inVar)
     // p = one3 * GetTrace(stress);
     // p = p < small ? small : p;
     aBar = two3 * h * b;
-    zBar = -1.0 * m_cz * Macauley(-1.0 * D) * (m_z_max * n + fabric);
+    zBar = -1.0 * theParameters->cz * Macauley(-1.0 * D) * (theParameters->z_max * n + fabric);
         
     dEstrain = aD * (stress - curStress);
     eStrain = curEStrain + dEstrain;
@@ -4126,7 +4050,7 @@ ManzariDafalias::GetResidual(const Vector& x, const Vector& inVar)
     double p = one3 * GetTrace(stress);
     p = p < small ? small : p;
     Vector aBar(6); aBar = two3 * h * b;
-    Vector zBar(6); zBar = -1.0 * m_cz * Macauley(-1.0 * D) * (m_z_max * n + fabric);
+    Vector zBar(6); zBar = -1.0 * theParameters->cz * Macauley(-1.0 * D) * (theParameters->z_max * n + fabric);
 
     Matrix De = GetCompliance(mK, mG);
     Vector dEstrain(6);
@@ -4208,9 +4132,9 @@ ManzariDafalias::GetJacobian(const Vector &x, const Vector &inVar)
     Vector r(6); r = devStress - p * alpha;
     double normR = GetNorm_Contr(r);
     dnFlag = normR == 0 ? 0.0 : 1.0;
-    double gc = g(Cos3Theta, m_c);
+    double gc = g(Cos3Theta, theParameters->c);
     Vector aBar(6); aBar = two3 * h * b;
-    Vector zBar(6); zBar = -1.0 * m_cz * Macauley(-1.0 * D) * (m_z_max * n + fabric);
+    Vector zBar(6); zBar = -1.0 * theParameters->cz * Macauley(-1.0 * D) * (theParameters->z_max * n + fabric);
 
     //double G, K;
     //GetElasticModuli(curStress, curVoidRatio, voidRatio, TrialElasticStrain, curEStrain, K, G);
@@ -4232,23 +4156,23 @@ ManzariDafalias::GetJacobian(const Vector &x, const Vector &inVar)
     // d...OverdSigma : Arranged by order of dependence
     dnOverdSigma          = dnFlag * ( 1.0 / normR * (mIIdevCon - dpFlag*one3*Dyadic2_2(alpha,mI1) - 
         Dyadic2_2(n,n) + dpFlag*one3*DoubleDot2_2_Contr(alpha,n)*Dyadic2_2(n,mI1)));
-    dPsiOverdSigma        = dpFlag * one3 * m_ksi * m_lambda_c / m_P_atm * pow(p/m_P_atm, m_ksi-1) * mI1;
+    dPsiOverdSigma        = dpFlag * one3 * theParameters->ksi * theParameters->lambda_c / theParameters->P_atm * pow(p/theParameters->P_atm, theParameters->ksi-1) * mI1;
     db0OverdSigma         = dpFlag*(-b0 / (6.0*p) * mI1);
 
     dCos3ThetaOverdSigma  = 3.0 * sqrt(6.0) * DoubleDot2_4(n2, ToCovariant(dnOverdSigma));
-    dAdOverdSigma         = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
+    dAdOverdSigma         = theParameters->A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
         DoubleDot2_4(fabric, ToCovariant(dnOverdSigma));
     dhOverdSigma          = dhFlag * (1.0 / AlphaAlphaInDotN * (db0OverdSigma - 
         h*DoubleDot2_4(alpha-alpha_in, ToCovariant(dnOverdSigma))));
 
-    dgOverdSigma          = pow(gc,2.0) * (1.0-m_c)/(2.0*m_c) * dCos3ThetaOverdSigma;
+    dgOverdSigma          = pow(gc,2.0) * (1.0-theParameters->c)/(2.0*theParameters->c) * dCos3ThetaOverdSigma;
 
-    dAlphaDOverdSigma     = m_Mc * exp(m_nd * psi) * (dgOverdSigma + m_nd * gc * dPsiOverdSigma);
-    dCOverdSigma          = 3.0 * sqrt(1.5) * (1 - m_c)/m_c * dgOverdSigma;
-    dBOverdSigma          = 1.5 * (1.0 - m_c)/m_c * (dgOverdSigma * Cos3Theta + gc * dCos3ThetaOverdSigma);
-    dAlphaBOverdSigma     = m_Mc * exp(-1.0*m_nb*psi) * (dgOverdSigma - m_nb * gc * dPsiOverdSigma);
+    dAlphaDOverdSigma     = theParameters->Mc * exp(theParameters->nd * psi) * (dgOverdSigma + theParameters->nd * gc * dPsiOverdSigma);
+    dCOverdSigma          = 3.0 * sqrt(1.5) * (1 - theParameters->c)/theParameters->c * dgOverdSigma;
+    dBOverdSigma          = 1.5 * (1.0 - theParameters->c)/theParameters->c * (dgOverdSigma * Cos3Theta + gc * dCos3ThetaOverdSigma);
+    dAlphaBOverdSigma     = theParameters->Mc * exp(-1.0*theParameters->nb*psi) * (dgOverdSigma - theParameters->nb * gc * dPsiOverdSigma);
 
-	if (p < 0.05 * m_P_atm)
+	if (p < 0.05 * theParameters->P_atm)
 	{
 		double be = 7.2713;
 		double temp1 = exp(7.6349 - 7.2713 * p);
@@ -4267,24 +4191,24 @@ ManzariDafalias::GetJacobian(const Vector &x, const Vector &inVar)
     dROverdSigma          = B * dnOverdSigma + Dyadic2_2(n, dBOverdSigma) - C * 
         (Trans_SingleDot4T_2(dnOverdSigma,n) + SingleDot2_4(n, dnOverdSigma)) -
         Dyadic2_2((n2 - one3 * mI1),dCOverdSigma) + one3 * Dyadic2_2(mI1, dDOverdSigma);
-	dZbarOverdSigma       = m_cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(m_z_max*n + fabric, dDOverdSigma)
-		- m_cz * Macauley(-1.0 * D) * m_z_max * dnOverdSigma;
+	dZbarOverdSigma       = theParameters->cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(theParameters->z_max*n + fabric, dDOverdSigma)
+		- theParameters->cz * Macauley(-1.0 * D) * theParameters->z_max * dnOverdSigma;
 
     // d...OverdAlpha : Arranged by order of dependence
     dnOverdAlpha          = dnFlag * (p / normR * (Dyadic2_2(n,n) - mIIcon));
 
     dCos3ThetaOverdAlpha  = 3.0 * sqrt(6.0) * DoubleDot2_4(n2, ToCovariant(dnOverdAlpha));
-    dAdOverdAlpha         = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
+    dAdOverdAlpha         = theParameters->A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
         DoubleDot2_4(fabric, ToCovariant(dnOverdAlpha));
     dhOverdAlpha          = dhFlag * (-1.0*h / AlphaAlphaInDotN * (n + 
         DoubleDot2_4(alpha-alpha_in,ToCovariant(dnOverdAlpha))));
 
-    dgOverdAlpha          = pow(gc,2.0) * (1.0-m_c)/(2.0*m_c) * dCos3ThetaOverdAlpha;
+    dgOverdAlpha          = pow(gc,2.0) * (1.0-theParameters->c)/(2.0*theParameters->c) * dCos3ThetaOverdAlpha;
 
-    dAlphaDOverdAlpha     = m_Mc * exp(m_nd * psi) * dgOverdAlpha;
-    dCOverdAlpha          = 3.0 * sqrt(1.5) * (1 - m_c)/m_c * dgOverdAlpha;
-    dBOverdAlpha          = 1.5 * (1.0 - m_c)/m_c * (dgOverdAlpha * Cos3Theta + gc * dCos3ThetaOverdAlpha);
-    dAlphaBOverdAlpha     = m_Mc * exp(-1.0*m_nb*psi) * dgOverdAlpha;
+    dAlphaDOverdAlpha     = theParameters->Mc * exp(theParameters->nd * psi) * dgOverdAlpha;
+    dCOverdAlpha          = 3.0 * sqrt(1.5) * (1 - theParameters->c)/theParameters->c * dgOverdAlpha;
+    dBOverdAlpha          = 1.5 * (1.0 - theParameters->c)/theParameters->c * (dgOverdAlpha * Cos3Theta + gc * dCos3ThetaOverdAlpha);
+    dAlphaBOverdAlpha     = theParameters->Mc * exp(-1.0*theParameters->nb*psi) * dgOverdAlpha;
 
     dDOverdAlpha          = dAdOverdAlpha * (root23 * alphaDtheta - 
         DoubleDot2_2_Contr(alpha, n)) + A * (root23 * dAlphaDOverdAlpha -
@@ -4295,18 +4219,18 @@ ManzariDafalias::GetJacobian(const Vector &x, const Vector &inVar)
     dROverdAlpha          = B * dnOverdAlpha + Dyadic2_2(n, dBOverdAlpha) - C * 
         (Trans_SingleDot4T_2(dnOverdAlpha,n) + SingleDot2_4(n, dnOverdAlpha)) -
         Dyadic2_2((n2 - one3 * mI1),dCOverdAlpha) + one3 * Dyadic2_2(mI1, dDOverdAlpha);
-	dZbarOverdAlpha       = m_cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(m_z_max*n + fabric, dDOverdAlpha)
-		- m_cz * Macauley(-1.0 * D) * m_z_max * dnOverdAlpha;
+	dZbarOverdAlpha       = theParameters->cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(theParameters->z_max*n + fabric, dDOverdAlpha)
+		- theParameters->cz * Macauley(-1.0 * D) * theParameters->z_max * dnOverdAlpha;
 
     // d...OverdFabric : Arranged by order of dependence
-    dAdOverdFabric        = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * n;
+    dAdOverdFabric        = theParameters->A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * n;
 
     dDOverdFabric         = dAdOverdFabric * (root23 * alphaDtheta - DoubleDot2_2_Contr(alpha, n));
     
     dROverdFabric         = one3 * Dyadic2_2(mI1, dDOverdFabric);
 
-    dZbarOverdFabric      = m_cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(m_z_max*n + fabric, dDOverdFabric)
-		- m_cz * Macauley(-1.0 * D) *  mIIcon;
+    dZbarOverdFabric      = theParameters->cz * MacauleyIndex(-1.0 * D) * Dyadic2_2(theParameters->z_max*n + fabric, dDOverdFabric)
+		- theParameters->cz * Macauley(-1.0 * D) *  mIIcon;
 
     // Derivatives of residuals
     Matrix dR1OverdSigma(6,6), dR2OverdSigma(6,6), dR3OverdSigma(6,6); Vector dR1OverdDGamma(6);
@@ -4330,7 +4254,7 @@ ManzariDafalias::GetJacobian(const Vector &x, const Vector &inVar)
     dR3OverdFabric        =  mIImix - dGamma * dZbarOverdFabric * mIIco;
     dR3OverdDGamma        =  -1.0 * zBar;
 
-    dR4OverdSigma         = ToCovariant(n - one3 * (DoubleDot2_2_Contr(n,alpha) + root23 * m_m) * mI1);
+    dR4OverdSigma         = ToCovariant(n - one3 * (DoubleDot2_2_Contr(n,alpha) + root23 * theParameters->m) * mI1);
     dR4OverdAlpha         = -1.0 * ToCovariant(p * n);
     dR4OverdFabric.Zero();  
     dR4OverdDGamma         = 0;
@@ -4468,14 +4392,14 @@ ManzariDafalias::GetF(const Vector& nStress, const Vector& nAlpha)
     Vector s(6); s = GetDevPart(nStress);
     double p = one3 * GetTrace(nStress) + m_Presidual;
     s -= p * nAlpha;
-    return GetNorm_Contr(s) - root23 * m_m * p;
+    return GetNorm_Contr(s) - root23 * theParameters->m * p;
 }
 
 
 double 
 ManzariDafalias::GetPSI(const double& e, const double& p)
 {
-    return e - (m_e0 - m_lambda_c * pow((p / m_P_atm),m_ksi));
+    return e - (theParameters->e0 - theParameters->lambda_c * pow((p / theParameters->P_atm),theParameters->ksi));
 }
 
 
@@ -4503,21 +4427,21 @@ ManzariDafalias::GetElasticModuli(const Vector& sigma, const double& en, const d
     //if (fabs(GetTrace(nEStrain - cEStrain)) < small)
     if (fabs(en1 - en) < small)
     {
-        G = m_G0 * m_P_atm * pow((2.97 - en),2) / (1 + en) * sqrt(pn / m_P_atm);
-        K = two3 * (1 + m_nu) / (1 - 2 * m_nu) * G;
+        G = theParameters->G0 * theParameters->P_atm * pow((2.97 - en),2) / (1 + en) * sqrt(pn / theParameters->P_atm);
+        K = two3 * (1 + theParameters->nu) / (1 - 2 * theParameters->nu) * G;
     } else {
         double ken = pow((2.97 - en),2) / (1+en);
         double ken1= pow((2.97 - en1),2) / (1+en1);
-        double pn1 = pow((sqrt(pn) + 0.5* two3 * (1 + m_nu) / (1 - 2 * m_nu) * m_G0 * sqrt(m_P_atm) * (ken1*GetTrace(nEStrain) - ken*GetTrace(cEStrain))),2);
+        double pn1 = pow((sqrt(pn) + 0.5* two3 * (1 + theParameters->nu) / (1 - 2 * theParameters->nu) * theParameters->G0 * sqrt(theParameters->P_atm) * (ken1*GetTrace(nEStrain) - ken*GetTrace(cEStrain))),2);
         K = (pn1-pn) / (GetTrace(nEStrain - cEStrain));
-        G = 1.5 * (1 - 2 * m_nu) / (1 + m_nu) * K;
+        G = 1.5 * (1 - 2 * theParameters->nu) / (1 + theParameters->nu) * K;
     }
     */
     if (mElastFlag == 0) 
-        G = m_G0 * m_P_atm * pow((2.97 - m_e_init),2) / (1 + m_e_init);
+        G = theParameters->G0 * theParameters->P_atm * pow((2.97 - theParameters->e_init),2) / (1 + theParameters->e_init);
     else
-        G = m_G0 * m_P_atm * pow((2.97 - m_e_init),2) / (1 + m_e_init) * sqrt(pn / m_P_atm);
-    K = two3 * (1 + m_nu) / (1 - 2 * m_nu) * G;
+        G = theParameters->G0 * theParameters->P_atm * pow((2.97 - theParameters->e_init),2) / (1 + theParameters->e_init) * sqrt(pn / theParameters->P_atm);
+    K = two3 * (1 + theParameters->nu) / (1 - 2 * theParameters->nu) * G;
 }
 
 
@@ -4529,10 +4453,10 @@ ManzariDafalias::GetElasticModuli(const Vector& sigma, const double& en, double
     pn = (pn <= m_Pmin) ? m_Pmin : pn;
 
     if (mElastFlag == 0) 
-        G = m_G0 * m_P_atm * pow((2.97 - m_e_init),2) / (1 + m_e_init);
+        G = theParameters->G0 * theParameters->P_atm * pow((2.97 - theParameters->e_init),2) / (1 + theParameters->e_init);
     else
-        G = m_G0 * m_P_atm * pow((2.97 - m_e_init),2) / (1 + m_e_init) * sqrt(pn / m_P_atm);
-    K = two3 * (1 + m_nu) / (1 - 2 * m_nu) * G;
+        G = theParameters->G0 * theParameters->P_atm * pow((2.97 - theParameters->e_init),2) / (1 + theParameters->e_init) * sqrt(pn / theParameters->P_atm);
+    K = two3 * (1 + theParameters->nu) / (1 - 2 * theParameters->nu) * G;
 }
 
 
@@ -4544,10 +4468,10 @@ ManzariDafalias::GetElasticModuli(const Vector& sigma, const double& en, double
     pn = (pn <= m_Pmin) ? m_Pmin : pn;
 
     if (mElastFlag == 0) 
-        G = m_G0 * m_P_atm * pow((2.97 - m_e_init),2) / (1 + m_e_init);
+        G = theParameters->G0 * theParameters->P_atm * pow((2.97 - theParameters->e_init),2) / (1 + theParameters->e_init);
     else
-        G = m_G0 * m_P_atm * pow((2.97 - m_e_init),2) / (1 + m_e_init) * sqrt(pn / m_P_atm);
-    K = two3 * (1 + m_nu) / (1 - 2 * m_nu) * G;
+        G = theParameters->G0 * theParameters->P_atm * pow((2.97 - theParameters->e_init),2) / (1 + theParameters->e_init) * sqrt(pn / theParameters->P_atm);
+    K = two3 * (1 + theParameters->nu) / (1 - 2 * theParameters->nu) * G;
 }
 
 
@@ -4703,11 +4627,11 @@ ManzariDafalias::GetStateDependent(const Vector &stress, const Vector &alpha, co
 
     cos3Theta = GetLodeAngle(n);
 
-    alphaBtheta = g(cos3Theta, m_c) * m_Mc * exp(-1.0 * m_nb * psi) - m_m;
+    alphaBtheta = g(cos3Theta, theParameters->c) * theParameters->Mc * exp(-1.0 * theParameters->nb * psi) - theParameters->m;
     
-    alphaDtheta = g(cos3Theta, m_c) * m_Mc * exp(m_nd * psi) - m_m;
+    alphaDtheta = g(cos3Theta, theParameters->c) * theParameters->Mc * exp(theParameters->nd * psi) - theParameters->m;
 
-    b0 = m_G0 * m_h0 * (1.0 - m_ch * e) / sqrt(p / m_P_atm);
+    b0 = theParameters->G0 * theParameters->h0 * (1.0 - theParameters->ch * e) / sqrt(p / theParameters->P_atm);
     
     // d    = root23 * alphaDtheta * n - alpha;
 	d = n; d *= (root23 * alphaDtheta); d -= alpha;
@@ -4719,12 +4643,12 @@ ManzariDafalias::GetStateDependent(const Vector &stress, const Vector &alpha, co
 	else
 		h = b0 / AlphaAlphaInDotN;
 
-    A = m_A0 * (1 + Macauley(DoubleDot2_2_Contr(fabric, n)));
+    A = theParameters->A0 * (1 + Macauley(DoubleDot2_2_Contr(fabric, n)));
 
     D = A * DoubleDot2_2_Contr(d, n);
 
     // Apply a factor to D so it doesn't go very big when p is small
-    if (p < 0.05 * m_P_atm)
+    if (p < 0.05 * theParameters->P_atm)
     {
         D_factor = 1.0 / (1.0 + (exp(7.6349 - 7.2713 * p)));
     } else {
@@ -4733,9 +4657,9 @@ ManzariDafalias::GetStateDependent(const Vector &stress, const Vector &alpha, co
 
     D *= D_factor;
 
-    B = 1.0 + 1.5 * (1 - m_c)/ m_c * g(cos3Theta, m_c) * cos3Theta;
+    B = 1.0 + 1.5 * (1 - theParameters->c)/ theParameters->c * g(cos3Theta, theParameters->c) * cos3Theta;
 
-    C = 3.0 * sqrt(1.5) * (1 - m_c)/ m_c * g(cos3Theta, m_c);
+    C = 3.0 * sqrt(1.5) * (1 - theParameters->c)/ theParameters->c * g(cos3Theta, theParameters->c);
 
     // R = B * n - C * (SingleDot(n,n) - one3 * mI1) + one3 * D * mI1;
 	R = n; R *= B;
@@ -4757,13 +4681,13 @@ ManzariDafalias::Elastic2Plastic()
     double curM = sqrt(1.5) * GetNorm_Contr(GetDevPart(mSigma));
     double p = one3 * GetTrace(mSigma) + m_Presidual;
     curM = curM / p;
-    if (curM > m_Mc)
+    if (curM > theParameters->Mc)
     {  
-         m_Mc = 1.1 * curM;
+         theParameters.edit().Mc = 1.1 * curM;
     //     opserr << "Outside Bounding!" << endln;
     //     opserr << "Before = " << mSigma;
-    //     mAlpha = mAlpha_n = (m_Mc - m_m) / curM * GetDevPart(mSigma) / p;
-    //     mSigma = mSigma_n = one3 * GetTrace(mSigma) * mI1 + (m_Mc / curM) * GetDevPart(mSigma);
+    //     mAlpha = mAlpha_n = (theParameters->Mc - theParameters->m) / curM * GetDevPart(mSigma) / p;
+    //     mSigma = mSigma_n = one3 * GetTrace(mSigma) * mI1 + (theParameters->Mc / curM) * GetDevPart(mSigma);
     //     mAlpha_in = mAlpha_in_n = mAlpha;
     //     opserr << "After = " << mSigma << endln;
     }
@@ -33,6 +33,7 @@
 #include <fstream>
 
 #include <NDMaterial.h>
+#include <MaterialParameters.h>
 #include <Matrix.h>
 #include <Vector.h>
 
@@ -107,24 +108,27 @@ class ManzariDafalias : public NDMaterial
 
   protected:
 
-	// Material constants
-	double m_G0;
-	double m_nu;
-	double m_e_init;
-	double m_Mc;
-	double m_c;
-	double m_lambda_c;
-	double m_e0;
-	double m_ksi;
-	double m_P_atm;
-	double m_m;
-	double m_h0;
-	double m_ch;
-	double m_nb;
-	double m_A0;
-	double m_nd;
-	double m_z_max;
-	double m_cz;
+	// Material constants, shared by all copies
+	struct Parameters {
+		double G0;
+		double nu;
+		double e_init;
+		double Mc;
+		double c;
+		double lambda_c;
+		double e0;
+		double ksi;
+		double P_atm;
+		double m;
+		double h0;
+		double ch;
+		double nb;
+		double A0;
+		double nd;
+		double z_max;
+		double cz;
+	};
+	MaterialParameters<Parameters> theParameters;
 	
 	// internal variables
 	Vector mEpsilon;    // strain tensor
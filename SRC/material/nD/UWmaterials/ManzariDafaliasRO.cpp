@@ -134,17 +134,22 @@ ManzariDafaliasRO::~ManzariDafaliasRO()
 NDMaterial*
 ManzariDafaliasRO::getCopy(const char *type)
 {
+	// the copy shares the constants of this material
+	const Parameters &par = *theParameters;
+
 	if (strcmp(type,"PlaneStrain2D") == 0 || strcmp(type,"PlaneStrain") == 0) {
 		ManzariDafaliasPlaneStrainRO *clone;
-		clone = new ManzariDafaliasPlaneStrainRO(this->getTag(), m_G0,  m_nu, m_B, m_a1, m_gamma1, m_e_init,  m_Mc,  
-				m_c, m_lambda_c,  m_e0,  m_ksi,  m_P_atm, m_m, m_h0, m_ch, m_nb, m_A0, 
-				m_nd, m_z_max, m_cz, massDen, m_kappa, mScheme, mTangType, mJacoType, mTolF, mTolR);
+		clone = new ManzariDafaliasPlaneStrainRO(this->getTag(), par.G0,  par.nu, m_B, m_a1, m_gamma1, par.e_init,  par.Mc,  
+				par.c, par.lambda_c,  par.e0,  par.ksi,  par.P_atm, par.m, par.h0, par.ch, par.nb, par.A0, 
+				par.nd, par.z_max, par.cz, massDen, m_kappa, mScheme, mTangType, mJacoType, mTolF, mTolR);
+		clone->theParameters = theParameters;
 		return clone;
 	} else if (strcmp(type,"ThreeDimensional")==0 || strcmp(type,"3D") ==0) {
 		ManzariDafalias3DRO *clone;
-     		clone = new ManzariDafalias3DRO(this->getTag(), m_G0,  m_nu, m_B, m_a1, m_gamma1, m_e_init,  m_Mc,  m_c, m_lambda_c,
-				m_e0,  m_ksi,  m_P_atm, m_m, m_h0, m_ch, m_nb, m_A0, m_nd, m_z_max, m_cz, massDen, 
+     		clone = new ManzariDafalias3DRO(this->getTag(), par.G0,  par.nu, m_B, m_a1, m_gamma1, par.e_init,  par.Mc,  par.c, par.lambda_c,
+				par.e0,  par.ksi,  par.P_atm, par.m, par.h0, par.ch, par.nb, par.A0, par.nd, par.z_max, par.cz, massDen, 
 				m_kappa, mScheme, mTangType, mJacoType, mTolF, mTolR);
+		clone->theParameters = theParameters;
 	 	return clone;
   	} else {
 	  	opserr << "ManzariDafaliasRO::getCopy failed to get copy: " << type << endln;
@@ -165,7 +170,7 @@ ManzariDafaliasRO::integrate()
 	if (mIsFirstShear && fabs(chi_e - chi_en) < 1.0e-10) { // This is required in case of consolidation (mEta1 should be updated)
 		// how small should 1.0e-10 be?
 		double p = one3 * GetTrace(mSigma_n);
-		double Gmax  = m_B * m_P_atm / (0.3 + 0.7 * mVoidRatio*mVoidRatio) * sqrt(p / m_P_atm);
+		double Gmax  = m_B * theParameters->P_atm / (0.3 + 0.7 * mVoidRatio*mVoidRatio) * sqrt(p / theParameters->P_atm);
 		mEta1 = m_a1 * Gmax * m_gamma1 / p;
 		chi_e = chi_en = 0.0;
 	}
@@ -175,7 +180,7 @@ ManzariDafaliasRO::integrate()
 		//mSigmaSR(3) = mSigmaSR(4) = mSigmaSR(5) -= 0.1;
 		mDevEpsSR = GetDevPart(mEpsilon_n);
 		double pSR = one3 * GetTrace(mSigmaSR);
-		double GmaxSR  = m_B * m_P_atm / (0.3 + 0.7 * mVoidRatio*mVoidRatio) * sqrt(pSR / m_P_atm);
+		double GmaxSR  = m_B * theParameters->P_atm / (0.3 + 0.7 * mVoidRatio*mVoidRatio) * sqrt(pSR / theParameters->P_atm);
 		mEta1 = m_a1 * GmaxSR * m_gamma1 / pSR;
 		mIsFirstShear = false;
 		GetElasticModuli(mSigma_n, mVoidRatio, mK, mG);
@@ -252,7 +257,7 @@ ManzariDafaliasRO::initialize()
 	mSigma_n = mSigma = mSigmaSR = m_Pmin * mI1;
 	
 	mDChi_e = 0.0;
-	double GmaxSR  = m_B * m_P_atm / (0.3 + 0.7 * mVoidRatio*mVoidRatio) * sqrt(m_Pmin / m_P_atm);
+	double GmaxSR  = m_B * theParameters->P_atm / (0.3 + 0.7 * mVoidRatio*mVoidRatio) * sqrt(m_Pmin / theParameters->P_atm);
 	mEta1 = m_a1 * GmaxSR * m_gamma1 / m_Pmin;
 	mIsFirstShear = true;
 
@@ -280,7 +285,7 @@ ManzariDafaliasRO::GetElasticModuli(const Vector& sigma, const double& en, const
 	pSR = (pSR <= m_Pmin) ? m_Pmin : pSR;
 	rSR = GetDevPart(mSigmaSR) / pSR;
 
-	Gmax = m_B * m_P_atm / (0.3 + 0.7 * en * en) * sqrt(p / m_P_atm);
+	Gmax = m_B * theParameters->P_atm / (0.3 + 0.7 * en * en) * sqrt(p / theParameters->P_atm);
 	if (mElastFlag == 0) {
 		mIsFirstShear = true;
 		T = 1.0;
@@ -296,7 +301,7 @@ ManzariDafaliasRO::GetElasticModuli(const Vector& sigma, const double& en, const
 	}
 
 	G = Gmax / T;
-	K = two3 * (1 + m_nu) / (1 - 2 * m_nu) * G;	
+	K = two3 * (1 + theParameters->nu) / (1 - 2 * theParameters->nu) * G;	
 }
 /*************************************************************/
 // GetElasticModuli() ---------------------------------------------
@@ -315,7 +320,7 @@ ManzariDafaliasRO::GetElasticModuli(const Vector& sigma, const double& en, doubl
 	pSR = (pSR <= m_Pmin) ? m_Pmin : pSR;
 	rSR = GetDevPart(mSigmaSR) / pSR;
 
-	Gmax = m_B * m_P_atm / (0.3 + 0.7 * en * en) * sqrt(p / m_P_atm);
+	Gmax = m_B * theParameters->P_atm / (0.3 + 0.7 * en * en) * sqrt(p / theParameters->P_atm);
 	if (mElastFlag == 0) {
 		mIsFirstShear = true;
 		T = 1.0;
@@ -331,5 +336,5 @@ ManzariDafaliasRO::GetElasticModuli(const Vector& sigma, const double& en, doubl
 	}
 
 	G = Gmax / T;
-	K = two3 * (1 + m_nu) / (1 - 2 * m_nu) * G;	
+	K = two3 * (1 + theParameters->nu) / (1 - 2 * theParameters->nu) * G;	
 }
@@ -178,44 +178,46 @@ PM4Sand::PM4Sand(int tag, int classTag, double Dr, double G0, double hp0, double
 	mCep_Consistent(3, 3),
 	mTracker(3)
 {
-	m_Dr = Dr;
-	m_G0 = G0;
-	m_hpo = hp0;
+	Parameters &par = theParameters.edit();
+
+	par.Dr = Dr;
+	par.G0 = G0;
+	par.hpo = hp0;
 	massDen = mDen;
-	m_P_atm = (P_atm < 0) ? 101.3 : P_atm;
-	m_h0 = (h0 < 0) ? fmax(0.3, (0.25 + m_Dr) / 2) : h0;
-	m_emax = (emax < 0) ? 0.8 : emax;
-	m_emin = (emin < 0) ? 0.5 : emin;
-	m_nb = (nb < 0) ? 0.5 : nb;
-	m_nd = (nd < 0) ? 0.1 : nd;
-	m_Ado = Ado;
-	m_z_max = z_max;
-	m_cz = (cz < 0) ? 250.0 : cz;
+	par.P_atm = (P_atm < 0) ? 101.3 : P_atm;
+	par.h0 = (h0 < 0) ? fmax(0.3, (0.25 + par.Dr) / 2) : h0;
+	par.emax = (emax < 0) ? 0.8 : emax;
+	par.emin = (emin < 0) ? 0.5 : emin;
+	par.nb = (nb < 0) ? 0.5 : nb;
+	par.nd = (nd < 0) ? 0.1 : nd;
+	par.Ado = Ado;
+	par.z_max = z_max;
+	par.cz = (cz < 0) ? 250.0 : cz;
 	if (ce > 0)
-		m_ce = ce;
+		par.ce = ce;
 	else {
 		// Different from manual, but matches Flac outputs
-		if (m_Dr > 0.75)
-			m_ce = 0.2;
-		else if (m_Dr < 0.55)
-			m_ce = 0.5;
+		if (par.Dr > 0.75)
+			par.ce = 0.2;
+		else if (par.Dr < 0.55)
+			par.ce = 0.5;
 		else
-			m_ce = 0.5 - (m_Dr - 0.55) * 1.5;
-	}
-	m_Mc = (phi_cv < 0) ? 2 * sin(33.0 / 180.0 * 3.14159265359) : 2 * sin(phi_cv / 180.0 * 3.14159265359);
-	m_nu = (nu < 0) ? 0.3: nu;
-	m_Cgd = (Cgd < 0) ? 2.0 : Cgd;
-	m_Cdr = (Cdr < 0.0) ? (5 + 25 * (m_Dr - 0.35)) : Cdr;
-	m_Cdr = fmin(m_Cdr, 10.0);
-	m_Ckaf = (Ckaf < 0) ? (5.0 + 220.0 *pow((m_Dr - 0.26), 3)) : Ckaf;
-	m_Ckaf = m_Ckaf > 35 ? 35 : m_Ckaf;
-	m_Ckaf = m_Ckaf < 4 ? 4 : m_Ckaf;
-	m_Q = (Q < 0) ? 10.0: Q;
-	m_R = (R < 0) ? 1.5 : R;
-	m_m = (m < 0) ? 0.01 : m;
-	m_Fsed_min = (Fsed_min < 0.0) ? (0.03 * exp(2.6 * m_Dr)) : Fsed_min;
-	m_Fsed_min = fmin(m_Fsed_min, 0.99);
-	m_p_sedo = (p_sdeo < 0.0) ? (m_P_atm / 5.0) : p_sdeo;
+			par.ce = 0.5 - (par.Dr - 0.55) * 1.5;
+	}
+	par.Mc = (phi_cv < 0) ? 2 * sin(33.0 / 180.0 * 3.14159265359) : 2 * sin(phi_cv / 180.0 * 3.14159265359);
+	par.nu = (nu < 0) ? 0.3: nu;
+	par.Cgd = (Cgd < 0) ? 2.0 : Cgd;
+	par.Cdr = (Cdr < 0.0) ? (5 + 25 * (par.Dr - 0.35)) : Cdr;
+	par.Cdr = fmin(par.Cdr, 10.0);
+	par.Ckaf = (Ckaf < 0) ? (5.0 + 220.0 *pow((par.Dr - 0.26), 3)) : Ckaf;
+	par.Ckaf = par.Ckaf > 35 ? 35 : par.Ckaf;
+	par.Ckaf = par.Ckaf < 4 ? 4 : par.Ckaf;
+	par.Q = (Q < 0) ? 10.0: Q;
+	par.R = (R < 0) ? 1.5 : R;
+	par.m = (m < 0) ? 0.01 : m;
+	par.Fsed_min = (Fsed_min < 0.0) ? (0.03 * exp(2.6 * par.Dr)) : Fsed_min;
+	par.Fsed_min = fmin(par.Fsed_min, 0.99);
+	par.p_sedo = (p_sdeo < 0.0) ? (par.P_atm / 5.0) : p_sdeo;
 	m_FirstCall = 0;
 	m_PostShake = 0;
 	mScheme = integrationScheme;
@@ -223,7 +225,7 @@ PM4Sand::PM4Sand(int tag, int classTag, double Dr, double G0, double hp0, double
 	mTolF = TolF;
 	mTolR = TolR;
 
-	m_e_init = m_emax - (m_emax - m_emin) * m_Dr;
+	par.e_init = par.emax - (par.emax - par.emin) * par.Dr;
 	mIter = 0;
 
 	initialize();
@@ -263,44 +265,46 @@ PM4Sand::PM4Sand(int tag, double Dr, double G0, double hp0, double mDen, double
 	mCep_Consistent(3, 3),
 	mTracker(3)
 {
-	m_Dr = Dr;
-	m_G0 = G0;
-	m_hpo = hp0;
+	Parameters &par = theParameters.edit();
+
+	par.Dr = Dr;
+	par.G0 = G0;
+	par.hpo = hp0;
 	massDen = mDen;
-	m_P_atm = (P_atm < 0) ? 101.3 : P_atm;
-	m_h0 = (h0 < 0) ? fmax(0.3, (0.25 + m_Dr) / 2) : h0;
-	m_emax = (emax < 0) ? 0.8 : emax;
-	m_emin = (emin < 0) ? 0.5 : emin;
-	m_nb = (nb < 0) ? 0.5 : nb;
-	m_nd = (nd < 0) ? 0.1 : nd;
-	m_Ado = Ado;
-	m_z_max = z_max;
-	m_cz = (cz < 0) ? 250.0 : cz;
+	par.P_atm = (P_atm < 0) ? 101.3 : P_atm;
+	par.h0 = (h0 < 0) ? fmax(0.3, (0.25 + par.Dr) / 2) : h0;
+	par.emax = (emax < 0) ? 0.8 : emax;
+	par.emin = (emin < 0) ? 0.5 : emin;
+	par.nb = (nb < 0) ? 0.5 : nb;
+	par.nd = (nd < 0) ? 0.1 : nd;
+	par.Ado = Ado;
+	par.z_max = z_max;
+	par.cz = (cz < 0) ? 250.0 : cz;
 	if (ce > 0)
-		m_ce = ce;
+		par.ce = ce;
 	else {
 		// Different from manual, but matches Flac outputs
-		if (m_Dr > 0.75)
-			m_ce = 0.2;
-		else if (m_Dr < 0.55)
-			m_ce = 0.5;
+		if (par.Dr > 0.75)
+			par.ce = 0.2;
+		else if (par.Dr < 0.55)
+			par.ce = 0.5;
 		else
-			m_ce = 0.5 - (m_Dr - 0.55) * 1.5;
-	}
-	m_Mc = (phi_cv < 0) ? 2 * sin(33.0 / 180.0 * 3.14159265359) : 2 * sin(phi_cv / 180.0 * 3.14159265359);
-	m_nu = (nu < 0) ? 0.3 : nu;
-	m_Cgd = (Cgd < 0) ? 2.0 : Cgd;
-	m_Cdr = (Cdr < 0.0) ? (5 + 25 * (m_Dr - 0.35)) : Cdr;
-	m_Cdr = fmin(m_Cdr, 10.0);
-	m_Ckaf = (Ckaf < 0) ? (5.0 + 220.0 *pow((m_Dr - 0.26), 3)) : Ckaf;
-	m_Ckaf = m_Ckaf > 35 ? 35 : m_Ckaf;
-	m_Ckaf = m_Ckaf < 4 ? 4 : m_Ckaf;
-	m_Q = (Q < 0) ? 10.0 : Q;
-	m_R = (R < 0) ? 1.5 : R;
-	m_m = (m < 0) ? 0.01 : m;
-	m_Fsed_min = (Fsed_min < 0.0) ? (0.03 * exp(2.6 * m_Dr)) : Fsed_min;
-	m_Fsed_min = fmin(m_Fsed_min, 0.99);
-	m_p_sedo = (p_sdeo < 0.0) ? (m_P_atm / 5.0) : p_sdeo;
+			par.ce = 0.5 - (par.Dr - 0.55) * 1.5;
+	}
+	par.Mc = (phi_cv < 0) ? 2 * sin(33.0 / 180.0 * 3.14159265359) : 2 * sin(phi_cv / 180.0 * 3.14159265359);
+	par.nu = (nu < 0) ? 0.3 : nu;
+	par.Cgd = (Cgd < 0) ? 2.0 : Cgd;
+	par.Cdr = (Cdr < 0.0) ? (5 + 25 * (par.Dr - 0.35)) : Cdr;
+	par.Cdr = fmin(par.Cdr, 10.0);
+	par.Ckaf = (Ckaf < 0) ? (5.0 + 220.0 *pow((par.Dr - 0.26), 3)) : Ckaf;
+	par.Ckaf = par.Ckaf > 35 ? 35 : par.Ckaf;
+	par.Ckaf = par.Ckaf < 4 ? 4 : par.Ckaf;
+	par.Q = (Q < 0) ? 10.0 : Q;
+	par.R = (R < 0) ? 1.5 : R;
+	par.m = (m < 0) ? 0.01 : m;
+	par.Fsed_min = (Fsed_min < 0.0) ? (0.03 * exp(2.6 * par.Dr)) : Fsed_min;
+	par.Fsed_min = fmin(par.Fsed_min, 0.99);
+	par.p_sedo = (p_sdeo < 0.0) ? (par.P_atm / 5.0) : p_sdeo;
 	m_FirstCall = 0;
 	m_PostShake = 0;
 	mScheme = integrationScheme;
@@ -308,7 +312,7 @@ PM4Sand::PM4Sand(int tag, double Dr, double G0, double hp0, double mDen, double
 	mTolF = TolF;
 	mTolR = TolR;
 
-	m_e_init = m_emax - (m_emax - m_emin) * m_Dr;
+	par.e_init = par.emax - (par.emax - par.emin) * par.Dr;
 	mIter = 0;
 
 	initialize();
@@ -345,30 +349,7 @@ PM4Sand::PM4Sand()
 	mCep_Consistent(3, 3),
 	mTracker(3)
 {
-	m_Dr = 0.0;
-	m_G0 = 0.0;
-	m_hpo = 0.0;
 	massDen = 0.0;
-	m_P_atm = 0.0;
-	m_h0 = 0.0;
-	m_emax = 0.0;
-	m_emin = 0.0;
-	m_nb = 0.0;
-	m_nd = 0.0;
-	m_Ado = 0.0;
-	m_z_max = 0.0;
-	m_cz = 0.0;
-	m_ce = 0.0;
-	m_Mc = 0.0;
-	m_nu = 0.0;
-	m_Cgd = 0.0;
-	m_Cdr = 0.0;
-	m_Ckaf = 0.0;
-	m_Q = 0.0;
-	m_R = 0.0;
-	m_m = 0.0;
-	m_Fsed_min = 0.0;
-	m_p_sedo = 0.0;
 	m_FirstCall = 0;
 	m_PostShake = 0;
 	mScheme = 2;
@@ -376,8 +357,6 @@ PM4Sand::PM4Sand()
 	mTolF = 1.0e-9;
 	mTolR = 1.0e-10;
 
-	m_e_init = 0.0;
-
 	mIter = 0;
 
 	this->initialize();
@@ -391,12 +370,16 @@ PM4Sand::~PM4Sand()
 NDMaterial*
 PM4Sand::getCopy(const char *type)
 {
+	// the copy shares the constants of this material
+	const Parameters &par = *theParameters;
+
 	if (strcmp(type, "PlaneStrain2D") == 0 || strcmp(type, "PlaneStrain") == 0) {
 		PM4Sand *clone;
-		double phi_cv = asin(m_Mc / 2.0) * 180.0 / 3.14159265359;
-		clone = new PM4Sand(this->getTag(), m_Dr, m_G0, m_hpo, massDen, m_P_atm, m_h0, m_emax,
-			m_emin, m_nb, m_nd, m_Ado, m_z_max, m_cz, m_ce, phi_cv, m_nu, m_Cgd, m_Cdr, m_Ckaf, m_Q,
-			m_R, m_m, m_Fsed_min, m_p_sedo, mScheme, mTangType, mTolF, mTolR);
+		double phi_cv = asin(par.Mc / 2.0) * 180.0 / 3.14159265359;
+		clone = new PM4Sand(this->getTag(), par.Dr, par.G0, par.hpo, massDen, par.P_atm, par.h0, par.emax,
+			par.emin, par.nb, par.nd, par.Ado, par.z_max, par.cz, par.ce, phi_cv, par.nu, par.Cgd, par.Cdr, par.Ckaf, par.Q,
+			par.R, par.m, par.Fsed_min, par.p_sedo, mScheme, mTangType, mTolF, mTolR);
+		clone->theParameters = theParameters;
 		return clone;
 	}
 	else if (strcmp(type, "ThreeDimensional") == 0 || strcmp(type, "3D") == 0) {
@@ -419,7 +402,7 @@ PM4Sand::commitState(void)
 		double p = 0.5 * GetTrace(mSigma);
 		Vector r = (mSigma - p * mI1) * (mMb / mMcur / p);
 		mSigma = p * mI1 + r * p;
-		mAlpha = r * (mMb - m_m) / mMb;
+		mAlpha = r * (mMb - theParameters->m) / mMb;
 	}
 	mAlpha_in_n = mAlpha_in;
 	mAlpha_n = mAlpha;
@@ -437,7 +420,7 @@ PM4Sand::commitState(void)
 	mFabric_n = mFabric;
 	mFabric_in_n = mFabric_in;
 	mDGamma_n = mDGamma;
-	mVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(mEpsilon);
+	mVoidRatio = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(mEpsilon);
 
 	mCe = GetStiffness(mK, mG);
 	mCep = GetElastoPlasticTangent(mSigma_n, mCe, R, n, mKp);
@@ -556,31 +539,31 @@ PM4Sand::sendSelf(int commitTag, Channel &theChannel)
 
 	data(0) = this->getTag();
 
-	data(1) = m_Dr;
-	data(2) = m_G0;
-	data(3) = m_hpo;
+	data(1) = theParameters->Dr;
+	data(2) = theParameters->G0;
+	data(3) = theParameters->hpo;
 	data(4) = massDen;
-	data(5) = m_P_atm;
-	data(6) = m_h0;
-	data(7) = m_emax;
-	data(8) = m_emin;
-	data(9) = m_e_init;
-	data(10) = m_nb;
-	data(11) = m_nd;
-	data(12) = m_Ado;
-	data(13) = m_cz;
-	data(14) = m_ce;
-	data(15) = m_Mc;
-	data(16) = m_nu;
-	data(17) = m_Cgd;
-	data(18) = m_Cdr;
-	data(19) = m_Ckaf;
-	data(20) = m_Q;
-	data(21) = m_R;
-	data(22) = m_m;
-	data(23) = m_z_max;
-	data(24) = m_Fsed_min;
-	data(25) = m_p_sedo;
+	data(5) = theParameters->P_atm;
+	data(6) = theParameters->h0;
+	data(7) = theParameters->emax;
+	data(8) = theParameters->emin;
+	data(9) = theParameters->e_init;
+	data(10) = theParameters->nb;
+	data(11) = theParameters->nd;
+	data(12) = theParameters->Ado;
+	data(13) = theParameters->cz;
+	data(14) = theParameters->ce;
+	data(15) = theParameters->Mc;
+	data(16) = theParameters->nu;
+	data(17) = theParameters->Cgd;
+	data(18) = theParameters->Cdr;
+	data(19) = theParameters->Ckaf;
+	data(20) = theParameters->Q;
+	data(21) = theParameters->R;
+	data(22) = theParameters->m;
+	data(23) = theParameters->z_max;
+	data(24) = theParameters->Fsed_min;
+	data(25) = theParameters->p_sedo;
 	data(26) = m_FirstCall;
 	data(27) = m_PostShake;
 
@@ -646,31 +629,34 @@ PM4Sand::recvSelf(int commitTag, Channel &theChannel,
 	}
 	this->setTag((int)data(0));
 
-	m_Dr = data(1);
-	m_G0 = data(2);
-	m_hpo = data(3);
+	// the received constants replace the block, which may be shared
+	Parameters par;
+	par.Dr = data(1);
+	par.G0 = data(2);
+	par.hpo = data(3);
 	massDen = data(4);
-	m_P_atm = data(5);
-	m_h0 = data(6);
-	m_emax = data(7);
-	m_emin = data(8);
-	m_e_init = data(9);
-	m_nb = data(10);
-	m_nd = data(11);
-	m_Ado = data(12);
-	m_cz = data(13);
-	m_ce = data(14);
-	m_Mc = data(15);
-	m_nu = data(16);
-	m_Cgd = data(17);
-	m_Cdr = data(18);
-	m_Ckaf = data(19);
-	m_Q = data(20);
-	m_R = data(21);
-	m_m = data(22);
-	m_z_max = data(23);
-	m_Fsed_min = data(24);
-	m_p_sedo = data(25);
+	par.P_atm = data(5);
+	par.h0 = data(6);
+	par.emax = data(7);
+	par.emin = data(8);
+	par.e_init = data(9);
+	par.nb = data(10);
+	par.nd = data(11);
+	par.Ado = data(12);
+	par.cz = data(13);
+	par.ce = data(14);
+	par.Mc = data(15);
+	par.nu = data(16);
+	par.Cgd = data(17);
+	par.Cdr = data(18);
+	par.Ckaf = data(19);
+	par.Q = data(20);
+	par.R = data(21);
+	par.m = data(22);
+	par.z_max = data(23);
+	par.Fsed_min = data(24);
+	par.p_sedo = data(25);
+	theParameters = MaterialParameters<Parameters>(par);
 	m_FirstCall = data(26);
 	m_PostShake = data(27);
 
@@ -744,11 +730,11 @@ PM4Sand::setParameter(const char **argv, int argc, Parameter &param)
 		}
 		else if ((strcmp(argv[0], "refShearModulus") == 0) ||
 			(strcmp(argv[0], "ShearModulus") == 0)) {         // change G0
-		  param.setValue(m_G0);
+		  param.setValue(theParameters->G0);
 			return param.addObject(6, this);
 		}
 		else if (strcmp(argv[0], "poissonRatio") == 0) {      // change nu
-		  param.setValue(m_nu);
+		  param.setValue(theParameters->nu);
 			return param.addObject(7, this);
 		}
 		else if (strcmp(argv[0], "FirstCall") == 0) {       // update first call, remove fabric
@@ -781,11 +767,11 @@ PM4Sand::updateParameter(int responseID, Information &info)
 	}
 	// called update refShearModulus
 	else if (responseID == 6) {
-		m_G0 = info.theDouble;
+		theParameters.edit().G0 = info.theDouble;
 	}
 	// called update poissonRatio
 	else if (responseID == 7) {
-		m_nu = info.theDouble;
+		theParameters.edit().nu = info.theDouble;
 	}
 	//called update first call
 	else if (responseID == 8) {
@@ -796,7 +782,7 @@ PM4Sand::updateParameter(int responseID, Information &info)
 	// called update voidRatio
 	else if (responseID == 9) {
 		double eps_v = GetTrace(mEpsilon);
-		m_e_init = (info.theDouble + eps_v) / (1 - eps_v);
+		theParameters.edit().e_init = (info.theDouble + eps_v) / (1 - eps_v);
 	}
 	// called PostShake
 	else if (responseID == 13) {
@@ -818,7 +804,7 @@ PM4Sand::initialize(Vector initStress)
 	double p0;
 	p0 = 0.5 * GetTrace(initStress);
 	// minimum p'
-	m_Pmin = fmax(p0 / 200.0, m_P_atm / 200.0);
+	m_Pmin = fmax(p0 / 200.0, theParameters->P_atm / 200.0);
 	// p_min for stress
 	m_Pmin2 = m_Pmin * 10.0;
 
@@ -839,30 +825,30 @@ PM4Sand::initialize(Vector initStress)
 		mAlpha_n = GetDevPart(initStress) / p0 ;
 	}
 
-	double ksi = GetKsi(m_Dr, p0);
-	if (m_z_max < 0) {
-		m_z_max = fmin(0.7 * exp(-6.1 * ksi), 20.0);
+	double ksi = GetKsi(theParameters->Dr, p0);
+	if (theParameters->z_max < 0) {
+		theParameters.edit().z_max = fmin(0.7 * exp(-6.1 * ksi), 20.0);
 	}
 
 	if (ksi < 0) {
 		// dense of critical
-		mMb = m_Mc * exp(-1.0 * m_nb * ksi);
-		mMd = m_Mc * exp(m_nd * ksi);
-		if (m_Ado < 0) {
+		mMb = theParameters->Mc * exp(-1.0 * theParameters->nb * ksi);
+		mMd = theParameters->Mc * exp(theParameters->nd * ksi);
+		if (theParameters->Ado < 0) {
 			if (mMb > 2.0) {
 				opserr << "Warning, Mb is larger than 2, using Ado = 1.5. \n";
-				m_Ado = 1.5;
+				theParameters.edit().Ado = 1.5;
 			}
 			else {
-				m_Ado = 2.5 * (asin(mMb / 2.0) - asin(m_Mc / 2.0)) / (mMb - mMd);
+				theParameters.edit().Ado = 2.5 * (asin(mMb / 2.0) - asin(theParameters->Mc / 2.0)) / (mMb - mMd);
 			}
 		}
 	}
 	else {
-		mMb = m_Mc * exp(-1.0 * m_nb / 4.0 * ksi);
-		mMd = m_Mc * exp(m_nd * 4.0 * ksi);
-		if (m_Ado < 0) {
-			m_Ado = 1.24;
+		mMb = theParameters->Mc * exp(-1.0 * theParameters->nb / 4.0 * ksi);
+		mMd = theParameters->Mc * exp(theParameters->nd * 4.0 * ksi);
+		if (theParameters->Ado < 0) {
+			theParameters.edit().Ado = 1.24;
 		}
 	}
 
@@ -877,7 +863,7 @@ PM4Sand::initialize(Vector initStress)
 		// the difference will be added to the stress returned to element to maintain global equilibrium
 		mSigma_n = p0 * mI1 + r * p0;
 		mSigma_b = initStress - mSigma_n;
-		mAlpha_n = r * (Mcut - m_m) / Mcut;
+		mAlpha_n = r * (Mcut - theParameters->m) / Mcut;
 	}
 	mzcum = 0.0;
 	GetElasticModuli(mSigma_n, mK, mG, mMcur, mzcum);
@@ -900,7 +886,7 @@ PM4Sand::initialize(Vector initStress)
 	mFabric_n.Zero();
 	// internal parameter tracker
 	mTracker.Zero();
-	mzpeak = m_z_max / 100000.0;
+	mzpeak = theParameters->z_max / 100000.0;
 	mpzp = fmax(p0, m_Pmin) / 100.0;
 	mzxp = 0.0;
 	m_pzpFlag = true;
@@ -913,14 +899,14 @@ PM4Sand::initialize()
 {
 	// set Initial parameters with p = p_atm
 	Vector mSig(3);
-	m_Pmin = m_P_atm / 200.0;
+	m_Pmin = theParameters->P_atm / 200.0;
 	m_Pmin2 = m_Pmin * 5.0;
-	mSig(0) = m_P_atm;
-	mSig(1) = m_P_atm;
+	mSig(0) = theParameters->P_atm;
+	mSig(1) = theParameters->P_atm;
 	mSig(2) = 0.0;
 
 	mzcum = 0.0;
-	mzpeak = m_z_max / 100000.0;
+	mzpeak = theParameters->z_max / 100000.0;
 	GetElasticModuli(mSig, mK, mG);
 	mCe = mCep = mCep_Consistent = GetStiffness(mK, mG);
 
@@ -1131,7 +1117,7 @@ void PM4Sand::elastic_integrator(const Vector& CurStress, const Vector& CurStrai
 	// calculate elastic response
 	// dStrain = NextStrain - CurStrain;
 	dStrain = NextStrain; dStrain -= CurStrain;
-	NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
+	NextVoidRatio = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(NextStrain);
 	// NextElasticStrain = CurElasticStrain + dStrain;
 	NextElasticStrain = CurElasticStrain; NextElasticStrain += dStrain;
 	GetElasticModuli(CurStress, K, G);
@@ -1182,7 +1168,7 @@ void PM4Sand::explicit_integrator(const Vector& CurStress, const Vector& CurStra
 	double elasticRatio, f, fn, dVolStrain;
 	Vector dStrain(3), dSigma(3), dDevStrain(3), n(3), tmp(3), dElasStrain(3);
 
-	NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
+	NextVoidRatio = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(NextStrain);
 	// NextElasticStrain = CurElasticStrain + NextStrain - CurStrain;
 	// dVolStrain = GetTrace(NextStrain - CurStrain);
 	// dDevStrain = (NextStrain - CurStrain) - dVolStrain / 3.0 * mI1;
@@ -1277,11 +1263,11 @@ void PM4Sand::ForwardEuler(const Vector& CurStress, const Vector& CurStrain, con
 	Vector dSigma(3), dAlpha(3), dFabric(3);
 
 	this->GetElasticModuli(NextStress, K, G, mMcur, mzcum);
-	CurVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(CurStrain);
-	CurDr = (m_emax - CurVoidRatio) / (m_emax - m_emin);
+	CurVoidRatio = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(CurStrain);
+	CurDr = (theParameters->emax - CurVoidRatio) / (theParameters->emax - theParameters->emin);
 	p = 0.5 * GetTrace(CurStress);
 	p = p < m_Pmin ? m_Pmin : p;
-	NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
+	NextVoidRatio = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(NextStrain);
 	// NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
 	dStrain = NextStrain; dStrain -= CurStrain;
 	NextElasticStrain = CurElasticStrain; NextElasticStrain += dStrain;
@@ -1334,11 +1320,11 @@ void PM4Sand::ForwardEuler(const Vector& CurStress, const Vector& CurStrain, con
 			dSigma += tmp2; dSigma += tmp1;
 			// update fabric
 			if (DoubleDot2_2_Contr(alphaD - CurAlpha, n) < 0.0) {
-				// dFabric = m_cz / (1 + Macauley(mzcum / 2.0 / m_z_max - 1.0)) * Macauley(NextL)*MacauleyIndex(-D)*(m_z_max * n + CurFabric);
+				// dFabric = theParameters->cz / (1 + Macauley(mzcum / 2.0 / theParameters->z_max - 1.0)) * Macauley(NextL)*MacauleyIndex(-D)*(theParameters->z_max * n + CurFabric);
 				dFabric = n;
-				dFabric *= m_z_max;
+				dFabric *= theParameters->z_max;
 				dFabric += CurFabric;
-				dFabric *= (-1.0 * m_cz / (1 + Macauley(mzcum / 2.0 / m_z_max - 1.0)) * Macauley(NextL) * MacauleyIndex(-D));
+				dFabric *= (-1.0 * theParameters->cz / (1 + Macauley(mzcum / 2.0 / theParameters->z_max - 1.0)) * Macauley(NextL) * MacauleyIndex(-D));
 			}
 			// update alpha
 			// dAlpha = two3 * NextL * h * b;
@@ -1356,7 +1342,7 @@ void PM4Sand::ForwardEuler(const Vector& CurStress, const Vector& CurStrain, con
 	// NextAlpha = CurAlpha + dAlpha;
 	NextAlpha = CurAlpha;  NextAlpha += dAlpha;
 	Stress_Correction(NextStress, NextAlpha, alpha_in, alpha_in_p, CurFabric, NextVoidRatio);
-	// Stress_Correction(NextStress, NextAlpha, dAlpha, m_m, R, n, r);
+	// Stress_Correction(NextStress, NextAlpha, dAlpha, theParameters->m, R, n, r);
 	return;
 }
 // -------------------------------------------------------------------------------------------------------
@@ -1455,10 +1441,10 @@ void PM4Sand::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, co
 	}
 	while (T < 1.0)
 	{
-		//NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(CurStrain + T*(NextStrain - CurStrain));
+		//NextVoidRatio = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(CurStrain + T*(NextStrain - CurStrain));
 		tmp0 = NextStrain; tmp0 -= CurStrain; tmp0 *= T; tmp0 += CurStrain;
-		NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(tmp0);
-		NextDr = (m_emax - NextVoidRatio) / (m_emax - m_emin);
+		NextVoidRatio = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(tmp0);
+		NextDr = (theParameters->emax - NextVoidRatio) / (theParameters->emax - theParameters->emin);
 		//dVolStrain = dT * GetTrace(NextStrain - CurStrain);
 		tmp0 = NextStrain; tmp0 -= CurStrain;
 		dVolStrain = dT * GetTrace(tmp0);
@@ -1511,11 +1497,11 @@ void PM4Sand::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, co
 				alphaD_NextAlpha = alphaD; alphaD_NextAlpha -= NextAlpha;
 				if (DoubleDot2_2_Contr(alphaD_NextAlpha, n) < 0.0) {
 					// Equation 57
-					// dFabric1 = -1.0 * m_cz / (1 + Macauley(mzcum / 2.0 / m_z_max - 1.0)) * Macauley(NextL)*MacauleyIndex(-D)*(m_z_max * n + NextFabric);
+					// dFabric1 = -1.0 * theParameters->cz / (1 + Macauley(mzcum / 2.0 / theParameters->z_max - 1.0)) * Macauley(NextL)*MacauleyIndex(-D)*(theParameters->z_max * n + NextFabric);
 					dFabric1 = n;
-					dFabric1 *= m_z_max;
+					dFabric1 *= theParameters->z_max;
 					dFabric1 += NextFabric;
-					dFabric1 *= (-1.0 * m_cz / (1 + Macauley(mzcum / 2.0 / m_z_max - 1.0)) * Macauley(NextL) * MacauleyIndex(-D));
+					dFabric1 *= (-1.0 * theParameters->cz / (1 + Macauley(mzcum / 2.0 / theParameters->z_max - 1.0)) * Macauley(NextL) * MacauleyIndex(-D));
 				}
 				// dPStrain1 = NextL * ToCovariant(R1);
 				// dAlpha1 = two3 * NextL * h * b;
@@ -1587,12 +1573,12 @@ void PM4Sand::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, co
 				alphaD_NextAlpha = alphaD; alphaD_NextAlpha -= NextAlpha; alphaD_NextAlpha -= dAlpha1;
 				if (DoubleDot2_2_Contr(alphaD_NextAlpha, n) < 0.0) {
 					// Equation 57
-					//dFabric2 = -1.0 * m_cz / (1 + Macauley(mzcum / 2.0 / m_z_max - 1.0)) * Macauley(NextL)*MacauleyIndex(-D)*(m_z_max * n + NextFabric + dFabric1);
+					//dFabric2 = -1.0 * theParameters->cz / (1 + Macauley(mzcum / 2.0 / theParameters->z_max - 1.0)) * Macauley(NextL)*MacauleyIndex(-D)*(theParameters->z_max * n + NextFabric + dFabric1);
 					dFabric2 = n;
-					dFabric2 *= m_z_max;
+					dFabric2 *= theParameters->z_max;
 					dFabric2 += NextFabric;
 					dFabric2 += dFabric1;
-					dFabric2 *= (-1.0 * m_cz / (1 + Macauley(mzcum / 2.0 / m_z_max - 1.0)) * Macauley(NextL) * MacauleyIndex(-D));
+					dFabric2 *= (-1.0 * theParameters->cz / (1 + Macauley(mzcum / 2.0 / theParameters->z_max - 1.0)) * Macauley(NextL) * MacauleyIndex(-D));
 				}
 				// dPStrain2 = NextL * mIIco * R2;
 				// dAlpha2 = two3 * NextL * h * b;
@@ -1653,7 +1639,7 @@ void PM4Sand::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, co
 				NextStress = nStress;
 				NextAlpha = nAlpha;
 				Stress_Correction(NextStress, NextAlpha, alpha_in, alpha_in_p, CurFabric, NextVoidRatio);
-				//Stress_Correction(NextStress, NextAlpha, dAlpha, m_m, 0.5 * (R1 + R2), n, r);
+				//Stress_Correction(NextStress, NextAlpha, dAlpha, theParameters->m, 0.5 * (R1 + R2), n, r);
 				T += dT;
 			}
 			dT = fmax(q * dT, dT_min);
@@ -1666,7 +1652,7 @@ void PM4Sand::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, co
 			NextAlpha = nAlpha;
 			NextFabric = nFabric;
 			Stress_Correction(NextStress, NextAlpha, alpha_in, alpha_in_p, CurFabric, NextVoidRatio);
-			//Stress_Correction(NextStress, NextAlpha, dAlpha, m_m, 0.5 * (R1 + R2), n, r);
+			//Stress_Correction(NextStress, NextAlpha, dAlpha, theParameters->m, 0.5 * (R1 + R2), n, r);
 
 			T += dT;
 			q = fmax(0.8 * sqrt(TolE / curStepError), 0.5);
@@ -1708,8 +1694,8 @@ void PM4Sand::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 	}
 	while (T < 1.0)
 	{
-		NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(CurStrain + T*(NextStrain - CurStrain));
-		NextDr = (m_emax - NextVoidRatio) / (m_emax - m_emin);
+		NextVoidRatio = theParameters->e_init - (1 + theParameters->e_init) * GetTrace(CurStrain + T*(NextStrain - CurStrain));
+		NextDr = (theParameters->emax - NextVoidRatio) / (theParameters->emax - theParameters->emin);
 		dVolStrain = dT * GetTrace(NextStrain - CurStrain);
 		dDevStrain = dT * (NextStrain - CurStrain) - dVolStrain / 3.0 * mI1;
 		p = 0.5 * GetTrace(NextStress);
@@ -1751,7 +1737,7 @@ void PM4Sand::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 					(2.0 * mG * n + mK * D * mI1);
 				// update fabric
 				if (DoubleDot2_2_Contr(alphaD - CurAlpha, n) < 0.0) {
-					dFabric1 = -1.0 * m_cz / (1 + Macauley(mzcum / 2.0 / m_z_max - 1.0)) * Macauley(NextL)*MacauleyIndex(-D)*(m_z_max * n + CurFabric);
+					dFabric1 = -1.0 * theParameters->cz / (1 + Macauley(mzcum / 2.0 / theParameters->z_max - 1.0)) * Macauley(NextL)*MacauleyIndex(-D)*(theParameters->z_max * n + CurFabric);
 				}
 				dPStrain1 = NextL * mIIco * R1;
 				dAlpha1 = two3 * NextL * h * b;
@@ -1792,7 +1778,7 @@ void PM4Sand::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 					(2.0 * mG * n + mK * D * mI1);
 				// update fabric
 				if (DoubleDot2_2_Contr(alphaD - CurAlpha, n) < 0.0) {
-					dFabric2 = -1.0 * m_cz / (1 + Macauley(mzcum / 2.0 / m_z_max - 1.0)) * Macauley(NextL)*MacauleyIndex(-D)*(m_z_max * n + CurFabric + 0.5 * dFabric1);
+					dFabric2 = -1.0 * theParameters->cz / (1 + Macauley(mzcum / 2.0 / theParameters->z_max - 1.0)) * Macauley(NextL)*MacauleyIndex(-D)*(theParameters->z_max * n + CurFabric + 0.5 * dFabric1);
 				}
 				dPStrain2 = NextL * mIIco * R2;
 				dAlpha2 = two3 * NextL * h * b;
@@ -1833,7 +1819,7 @@ void PM4Sand::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 					(2.0 * mG * n + mK * D * mI1);
 				// update fabric
 				if (DoubleDot2_2_Contr(alphaD - CurAlpha, n) < 0.0) {
-					dFabric3 = -1.0 * m_cz / (1 + Macauley(mzcum / 2.0 / m_z_max - 1.0)) * Macauley(NextL)*MacauleyIndex(-D)*(m_z_max * n + CurFabric + 0.5 * dFabric2);
+					dFabric3 = -1.0 * theParameters->cz / (1 + Macauley(mzcum / 2.0 / theParameters->z_max - 1.0)) * Macauley(NextL)*MacauleyIndex(-D)*(theParameters->z_max * n + CurFabric + 0.5 * dFabric2);
 				}
 				dPStrain3 = NextL * mIIco * R3;
 				dAlpha3 = two3 * NextL * h * b;
@@ -1874,7 +1860,7 @@ void PM4Sand::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 					(2.0 * mG * n + mK * D * mI1);
 				// update fabric
 				if (DoubleDot2_2_Contr(alphaD - CurAlpha, n) < 0.0) {
-					dFabric4 = -1.0 * m_cz / (1 + Macauley(mzcum / 2.0 / m_z_max - 1.0)) * Macauley(NextL)*MacauleyIndex(-D)*(m_z_max * n + CurFabric + dFabric3);
+					dFabric4 = -1.0 * theParameters->cz / (1 + Macauley(mzcum / 2.0 / theParameters->z_max - 1.0)) * Macauley(NextL)*MacauleyIndex(-D)*(theParameters->z_max * n + CurFabric + dFabric3);
 				}
 				dPStrain4 = NextL * mIIco * R4;
 				dAlpha4 = two3 * NextL * h * b;
@@ -1897,7 +1883,7 @@ void PM4Sand::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 		NextAlpha = nAlpha;
 		NextFabric = nFabric;
 		Stress_Correction(NextStress, NextAlpha, alpha_in, alpha_in_p, CurFabric, NextVoidRatio);
-		// Stress_Correction(NextStress, NextAlpha, dAlpha, m_m, (R1 + R4 + 2.0 * (R2 + R3)) / 6, n, r);
+		// Stress_Correction(NextStress, NextAlpha, dAlpha, theParameters->m, (R1 + R4 + 2.0 * (R2 + R3)) / 6, n, r);
 		T += dT;
 		//q = fmax(0.8 * sqrt(TolE / curStepError), 0.5);
 		//dT = fmax(q * dT, dT_min);
@@ -2056,9 +2042,9 @@ PM4Sand::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 		else {
 			// stress state outside yield surface
 			NextStress = m_Pmin / 5.0 * mI1;
-			NextStress(2) = 0.8 * m_Mc * m_Pmin / 5.0;
+			NextStress(2) = 0.8 * theParameters->Mc * m_Pmin / 5.0;
 			NextAlpha.Zero();
-			NextAlpha(2) = 0.8 * m_Mc;
+			NextAlpha(2) = 0.8 * theParameters->Mc;
 			return;
 		}
 	}
@@ -2069,7 +2055,7 @@ PM4Sand::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 			return;
 		}
 		else {
-			double CurDr = (m_emax - NextVoidRatio) / (m_emax - m_emin);
+			double CurDr = (theParameters->emax - NextVoidRatio) / (theParameters->emax - theParameters->emin);
 			nStress = NextStress;
 			nAlpha = NextAlpha;
 			for (int i = 1; i <= maxIter; i++) {
@@ -2209,7 +2195,7 @@ PM4Sand::GetF(const Vector& nStress, const Vector& nAlpha)
 	double p = 0.5 * GetTrace(nStress);
 	// s = s - p * nAlpha;
 	s -= p * nAlpha;
-	double f = GetNorm_Contr(s) - root12 * m_m * p;
+	double f = GetNorm_Contr(s) - root12 * theParameters->m * p;
 	return f;
 }
 /*************************************************************/
@@ -2220,7 +2206,7 @@ PM4Sand::GetKsi(const double& dr, const double& p)
 	double pn = p;
 	pn = (pn <= m_Pmin) ? (m_Pmin) : pn;
 	//Bolton
-	double ksi = m_R / (m_Q - log(100.0 * pn / m_P_atm)) - dr;
+	double ksi = theParameters->R / (theParameters->Q - log(100.0 * pn / theParameters->P_atm)) - dr;
 	return ksi;
 }
 /*************************************************************/
@@ -2238,21 +2224,21 @@ PM4Sand::GetElasticModuli(const Vector& sigma, double &K, double &G, double &Mcu
 	// Mcur = 2 * sqrt(2) * GetNorm_Contr(GetDevPart(sigma)) / GetTrace(sigma);
 	Mcur = qn / pn;
 	double Csr = 1 - Csr0 * fmin(1.0, pow((Mcur / mMb), msr));
-	double temp = zcum / m_z_max;
+	double temp = zcum / theParameters->z_max;
 	if (me2p == 0)
-		G = m_G0 * m_P_atm;
+		G = theParameters->G0 * theParameters->P_atm;
 	else {
-		G = m_G0 * m_P_atm * sqrt(pn / m_P_atm) * Csr * (1 + temp) / (1 + temp * m_Cgd);
+		G = theParameters->G0 * theParameters->P_atm * sqrt(pn / theParameters->P_atm) * Csr * (1 + temp) / (1 + temp * theParameters->Cgd);
 		if (m_PostShake) {
 			// reduce elastic shear modulus for post shaking consolidation
 			double p = 0.5 * GetTrace(sigma);
-			double p_sed = m_p_sedo * (mzcum / (mzcum + m_z_max)) * pow(Macauley(1 - mMcur / mMd), 0.25);
-			double F_sed = fmin(m_Fsed_min + (1 - m_Fsed_min) * (p / 20.0 / (p_sed + small)), 1.0);
+			double p_sed = theParameters->p_sedo * (mzcum / (mzcum + theParameters->z_max)) * pow(Macauley(1 - mMcur / mMd), 0.25);
+			double F_sed = fmin(theParameters->Fsed_min + (1 - theParameters->Fsed_min) * (p / 20.0 / (p_sed + small)), 1.0);
 			G = G * F_sed;
 		}
 	}
-	m_nu = (m_nu == 0.5) ? 0.4999 : m_nu;
-	K = two3 * (1 + m_nu) / (1 - 2 * m_nu) * G;
+	double nu = (theParameters->nu == 0.5) ? 0.4999 : theParameters->nu;
+	K = two3 * (1 + nu) / (1 - 2 * nu) * G;
 }
 void
 PM4Sand::GetElasticModuli(const Vector& sigma, double &K, double &G)
@@ -2262,11 +2248,11 @@ PM4Sand::GetElasticModuli(const Vector& sigma, double &K, double &G)
 	pn = (pn <= m_Pmin) ? m_Pmin : pn;
 
 	if (me2p == 0)
-		G = m_G0 * m_P_atm;
+		G = theParameters->G0 * theParameters->P_atm;
 	else
-		G = m_G0 * m_P_atm * sqrt(pn / m_P_atm);
-	m_nu = (m_nu == 0.5) ? 0.4999 : m_nu;
-	K = two3 * (1 + m_nu) / (1 - 2 * m_nu) * G;
+		G = theParameters->G0 * theParameters->P_atm * sqrt(pn / theParameters->P_atm);
+	double nu = (theParameters->nu == 0.5) ? 0.4999 : theParameters->nu;
+	K = two3 * (1 + nu) / (1 - 2 * nu) * G;
 }
 /*************************************************************/
 // GetStiffness() ---------------------------------------------
@@ -2377,28 +2363,28 @@ PM4Sand::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 	n = GetNormalToYield(stress, alpha);
 	if (ksi <= 0.0) {
 		// dense of critical
-		mMb = m_Mc * exp(-1.0 * m_nb * ksi);
-		mMd = m_Mc * exp(m_nd * ksi);
+		mMb = theParameters->Mc * exp(-1.0 * theParameters->nb * ksi);
+		mMd = theParameters->Mc * exp(theParameters->nd * ksi);
 	}
 	else {
 		// loose of critical
-		mMb = m_Mc * exp(-1.0 * m_nb / 4.0 * ksi);
-		mMd = m_Mc * exp(m_nd * 4.0 * ksi);
+		mMb = theParameters->Mc * exp(-1.0 * theParameters->nb / 4.0 * ksi);
+		mMd = theParameters->Mc * exp(theParameters->nd * 4.0 * ksi);
 	}
 
-	//Vector alphaB = root12 * (mMb - m_m) * n;
+	//Vector alphaB = root12 * (mMb - theParameters->m) * n;
 	Vector alphaB(n);
-	alphaB *= (root12 * (mMb - m_m));
+	alphaB *= (root12 * (mMb - theParameters->m));
 
-	//alphaD = root12 * (mMd - m_m) * n;
-	alphaD = n; alphaD *= (root12 * (mMd - m_m));
+	//alphaD = root12 * (mMd - theParameters->m) * n;
+	alphaD = n; alphaD *= (root12 * (mMd - theParameters->m));
 
-	Czpk1 = zpeak / (zcum + m_z_max / 5.0);
-	Czpk2 = zpeak / (zcum + m_z_max / 100.0);
+	Czpk1 = zpeak / (zcum + theParameters->z_max / 5.0);
+	Czpk2 = zpeak / (zcum + theParameters->z_max / 100.0);
 	if (Czpk2 > 1.0 - small)
 		Czpk2 = 1.0 - small;
 	Cpzp2 = Macauley((pzp - p)) / (Macauley((pzp - p)) + m_Pmin);
-	Cg1 = m_h0 / 200.0;
+	Cg1 = theParameters->h0 / 200.0;
 	Ckp = 2.0;
 
 	//b = alphaB - alpha;
@@ -2411,7 +2397,7 @@ PM4Sand::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 	// double AlphaAlphaInTrueDotN = Macauley(DoubleDot2_2_Contr(alpha - mAlpha_in_true, n));
 	alpha_mAlpha_in_true = alpha; alpha_mAlpha_in_true -= mAlpha_in_true;
 	AlphaAlphaInTrueDotN = Macauley(DoubleDot2_2_Contr(alpha_mAlpha_in_true, n));
-	Cka = 1.0 + m_Ckaf / (1.0 + pow(2.5*AlphaAlphaInTrueDotN, 2))*Cpzp2*Czpk1;
+	Cka = 1.0 + theParameters->Ckaf / (1.0 + pow(2.5*AlphaAlphaInTrueDotN, 2))*Cpzp2*Czpk1;
 	// updataed K_p formulation following PM4Sand V3.1. mAlpha_in is the apparent back-stress ratio. 
 	// if (DoubleDot2_2_Contr(alpha - alpha_in_p, n) <= 0) {
 	alpha_mAlpha_p = alpha; alpha_mAlpha_p -= alpha_in_p;
@@ -2420,42 +2406,42 @@ PM4Sand::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 		h = 1.0e10;
 	}
 	else if (DoubleDot2_2_Contr(alpha_mAlpha_p, n) <= 0) {
-		h = 1.5 * G * m_h0 / p / (exp(AlphaAlphaInDotN) - 1 + Cg1) / sqrt(fabs(AlphaAlphaBDotN)) *
-			Cka / (1 + Ckp * zpeak / m_z_max * Macauley(AlphaAlphaBDotN) * sqrt(1 - Czpk2));
+		h = 1.5 * G * theParameters->h0 / p / (exp(AlphaAlphaInDotN) - 1 + Cg1) / sqrt(fabs(AlphaAlphaBDotN)) *
+			Cka / (1 + Ckp * zpeak / theParameters->z_max * Macauley(AlphaAlphaBDotN) * sqrt(1 - Czpk2));
 		h = h * (AlphaAlphaInDotN + Cg1) / (AlphaAlphaInTrueDotN + Cg1);
 	}
 	else {
-		h = 1.5 * G * m_h0 / p / (exp(AlphaAlphaInDotN) - 1 + Cg1) / sqrt(fabs(AlphaAlphaBDotN)) *
-			Cka / (1 + Ckp * zpeak / m_z_max * Macauley(AlphaAlphaBDotN) * sqrt(1 - Czpk2));
+		h = 1.5 * G * theParameters->h0 / p / (exp(AlphaAlphaInDotN) - 1 + Cg1) / sqrt(fabs(AlphaAlphaBDotN)) *
+			Cka / (1 + Ckp * zpeak / theParameters->z_max * Macauley(AlphaAlphaBDotN) * sqrt(1 - Czpk2));
 	}
 
 	K_p = two3 * h * p * DoubleDot2_2_Contr(b, n);
-	Czin1 = Macauley(1.0 - exp(-2.0*fabs((DoubleDot2_2_Contr(fabric_in, n) - DoubleDot2_2_Contr(fabric, n)) / m_z_max)));
+	Czin1 = Macauley(1.0 - exp(-2.0*fabs((DoubleDot2_2_Contr(fabric_in, n) - DoubleDot2_2_Contr(fabric, n)) / theParameters->z_max)));
 	// rotated dilatancy surface
 	minusFabric = fabric; minusFabric *= (-1.0);
-	Crot1 = fmax((1.0 + 2 * Macauley(DoubleDot2_2_Contr(minusFabric, n)) / (sqrt(2.0)*m_z_max)*(1 - Czin1)), 1.0);
+	Crot1 = fmax((1.0 + 2 * Macauley(DoubleDot2_2_Contr(minusFabric, n)) / (sqrt(2.0)*theParameters->z_max)*(1 - Czin1)), 1.0);
 	Mdr = mMd / Crot1;
-	// Vector alphaDr = root12 * (Mdr - m_m) * n;
-	alphaDr_alpha = n; alphaDr_alpha *= (root12 * (Mdr - m_m)); alphaDr_alpha -= alpha;
+	// Vector alphaDr = root12 * (Mdr - theParameters->m) * n;
+	alphaDr_alpha = n; alphaDr_alpha *= (root12 * (Mdr - theParameters->m)); alphaDr_alpha -= alpha;
 	alphaD_alpha = alphaD; alphaD_alpha -= alpha;
 	if (DoubleDot2_2_Contr(alphaDr_alpha, n) <= 0) {
 		// dilation
 		double Cpzp, Cpmin, Czin2, temp, Ad, Drot;
 		Cpzp = (pzp == 0.0) ? 1.0 : 1.0 / (1.0 + pow((2.5*p / pzp), 5.0));
 		Cpmin = 1.0 / (1.0 + pow((m_Pmin2 / p), 2));
-		Czin2 = (1 + Czin1*(zcum - zpeak) / 3.0 / m_z_max) / (1 + 3.0 * Czin1*(zcum - zpeak) / 3.0 / m_z_max);
+		Czin2 = (1 + Czin1*(zcum - zpeak) / 3.0 / theParameters->z_max) / (1 + 3.0 * Czin1*(zcum - zpeak) / 3.0 / theParameters->z_max);
 		// double temp = pow((1.0 - Macauley(DoubleDot2_2_Contr(-1.0 * fabric, n)) * root12 / zpeak), 3);
 		temp = pow((1.0 - Macauley(DoubleDot2_2_Contr(minusFabric, n)) * root12 / zpeak), 3);
-		Ad = m_Ado * Czin2 / ((pow(zcum, 2) / m_z_max)* temp * pow(m_ce, 2)*Cpzp*Cpmin*Czin1 + 1.0);
+		Ad = theParameters->Ado * Czin2 / ((pow(zcum, 2) / theParameters->z_max)* temp * pow(theParameters->ce, 2)*Cpzp*Cpmin*Czin1 + 1.0);
 		// D = Ad * DoubleDot2_2_Contr(alphaD - alpha, n);
 		D = Ad * DoubleDot2_2_Contr(alphaD_alpha, n);
-		// double Drot = Ad * Macauley(DoubleDot2_2_Contr(-1.0*fabric, n)) / (sqrt(2.0)*m_z_max) * DoubleDot2_2_Contr(alphaDr - alpha, n) / m_Cdr;
-		Drot = Ad * Macauley(DoubleDot2_2_Contr(minusFabric, n)) / (sqrt(2.0)*m_z_max) * DoubleDot2_2_Contr(alphaDr_alpha, n) / m_Cdr;
+		// double Drot = Ad * Macauley(DoubleDot2_2_Contr(-1.0*fabric, n)) / (sqrt(2.0)*theParameters->z_max) * DoubleDot2_2_Contr(alphaDr - alpha, n) / theParameters->Cdr;
+		Drot = Ad * Macauley(DoubleDot2_2_Contr(minusFabric, n)) / (sqrt(2.0)*theParameters->z_max) * DoubleDot2_2_Contr(alphaDr_alpha, n) / theParameters->Cdr;
 		if (D > Drot) {
 			D = D + (Drot - D)*Macauley(mMb - Mcur) / (Macauley(mMb - Mcur) + 0.01);
 		}
 		if (m_Pmin <= p && p <= 2 * m_Pmin) {
-			D = fmin(D, -3.5 * m_Ado * Macauley(mMb - mMd) * (2 * m_Pmin - p) / m_Pmin);
+			D = fmin(D, -3.5 * theParameters->Ado * Macauley(mMb - mMd) * (2 * m_Pmin - p) / m_Pmin);
 		}
 	}
 	else {
@@ -2463,14 +2449,14 @@ PM4Sand::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 		double hp, Crot2, Cdz, Adc, Cin, C_pmin2;
 		// bound K_p to non - negative, following flac practice
 		K_p = fmax(0.0, K_p);
-		hp = m_hpo * exp(-0.7 + 7.0 * pow(Macauley(0.5 - ksi), 2.0));
+		hp = theParameters->hpo * exp(-0.7 + 7.0 * pow(Macauley(0.5 - ksi), 2.0));
 		Crot2 = 1 - Czpk2;
-		Cdz = fmax((1 - Crot2*sqrt(2.0)*zpeak / m_z_max)*(m_z_max / (m_z_max + Crot2*zcum)), 1 / (1 + m_z_max / 2.0));
-		Adc = m_Ado * (1 + Macauley(DoubleDot2_2_Contr(fabric, n))) / hp / Cdz;
-		Cin = 2.0 * Macauley(DoubleDot2_2_Contr(fabric, n)) / sqrt(2.0) / m_z_max;
-		// D = fmin(Adc * pow((DoubleDot2_2_Contr(alpha - mAlpha_in, n) + Cin), 2), 1.5 * m_Ado) *
+		Cdz = fmax((1 - Crot2*sqrt(2.0)*zpeak / theParameters->z_max)*(theParameters->z_max / (theParameters->z_max + Crot2*zcum)), 1 / (1 + theParameters->z_max / 2.0));
+		Adc = theParameters->Ado * (1 + Macauley(DoubleDot2_2_Contr(fabric, n))) / hp / Cdz;
+		Cin = 2.0 * Macauley(DoubleDot2_2_Contr(fabric, n)) / sqrt(2.0) / theParameters->z_max;
+		// D = fmin(Adc * pow((DoubleDot2_2_Contr(alpha - mAlpha_in, n) + Cin), 2), 1.5 * theParameters->Ado) *
 		// 	DoubleDot2_2_Contr(alphaD - alpha, n) / (DoubleDot2_2_Contr(alphaD - alpha, n) + 0.16);
-		D = fmin(Adc * pow((DoubleDot2_2_Contr(alpha_mAlpha_in, n) + Cin), 2), 1.5 * m_Ado) *
+		D = fmin(Adc * pow((DoubleDot2_2_Contr(alpha_mAlpha_in, n) + Cin), 2), 1.5 * theParameters->Ado) *
 			DoubleDot2_2_Contr(alphaD_alpha, n) / (DoubleDot2_2_Contr(alphaD_alpha, n) + 0.16);
 		// Apply a factor to D so it doesn't go very big when p is small
 		if (p < m_Pmin * 2.0)
@@ -37,6 +37,7 @@
 #include <math.h>
 
 #include <NDMaterial.h>
+#include <MaterialParameters.h>
 #include <Matrix.h>
 #include <Vector.h>
 
@@ -121,32 +122,35 @@ public:
 
 protected:
 
-	// Material constants
-	double m_Dr;
-	double m_G0;
-	double m_hpo;
+	// Material constants, shared by all copies
+	struct Parameters {
+		double Dr;
+		double G0;
+		double hpo;
+		double P_atm;
+		double h0;
+		double emax;
+		double emin;
+		double e_init;
+		double nb;
+		double nd;
+		double Ado;
+		double cz;
+		double ce;
+		double Mc;
+		double nu;
+		double Cgd;
+		double Cdr;
+		double Ckaf;
+		double Q;
+		double R;
+		double m;
+		double z_max;
+		double Fsed_min;
+		double p_sedo;
+	};
+	MaterialParameters<Parameters> theParameters;
 	double massDen;     // mass density for dynamic analysis
-	double m_P_atm;
-	double m_h0;
-	double m_emax;
-	double m_emin;
-	double m_e_init;
-	double m_nb;
-	double m_nd;
-	double m_Ado;
-	double m_cz;
-	double m_ce;
-	double m_Mc;
-	double m_nu;
-	double m_Cgd;
-	double m_Cdr;
-	double m_Ckaf;
-	double m_Q;
-	double m_R;
-	double m_m;
-	double m_z_max;
-	double m_Fsed_min;
-	double m_p_sedo;
 	int m_FirstCall;
 	int m_PostShake;
 
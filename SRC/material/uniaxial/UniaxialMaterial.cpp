@@ -321,11 +321,11 @@ UniaxialMaterial::setResponse(const char **argv, int argc,
 int 
 UniaxialMaterial::getResponse(int responseID, Information &matInfo)
 {
-  static Vector stressStrain(2);
-  static Vector stressStrainTangent(3);
+  static thread_local Vector stressStrain(2);
+  static thread_local Vector stressStrainTangent(3);
 
-  static Vector tempData(2);  //L.jiang [SIF]
-  static Information infoData(tempData);  //L.jiang [SIF]
+  static thread_local Vector tempData(2);  //L.jiang [SIF]
+  static thread_local Information infoData(tempData);  //L.jiang [SIF]
 
   // each subclass must implement its own stuff   
 
@@ -0,0 +1,254 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the implementation of
+// UniaxialMaterialBatch; see UniaxialMaterialBatch.h
+//
+#include <thread>
+#include <atomic>
+#include <math.h>
+#include <UniaxialMaterialBatch.h>
+#include <UniaxialMaterial.h>
+#include <OPS_Globals.h>
+
+UniaxialMaterialBatch::UniaxialMaterialBatch(Control c)
+  : control(c), tol(1.0e-8), maxIter(25)
+{
+
+}
+
+UniaxialMaterialBatch::~UniaxialMaterialBatch()
+{
+  for (UniaxialMaterial *theMaterial : materials)
+    delete theMaterial;
+}
+
+int
+UniaxialMaterialBatch::addMaterial(UniaxialMaterial *theMaterial)
+{
+  materials.push_back(theMaterial);
+  return (int)materials.size() - 1;
+}
+
+int
+UniaxialMaterialBatch::getNumMaterials(void) const
+{
+  return (int)materials.size();
+}
+
+int
+UniaxialMaterialBatch::setHistory(const double *values, int numSteps)
+{
+  if (numSteps < 1) {
+    opserr << "UniaxialMaterialBatch::setHistory - empty history\n";
+    return -1;
+  }
+  history.assign(values, values + numSteps);
+  measured.clear();
+  return 0;
+}
+
+int
+UniaxialMaterialBatch::setMeasured(const double *values, int numSteps)
+{
+  if (numSteps != (int)history.size()) {
+    opserr << "UniaxialMaterialBatch::setMeasured - " << numSteps
+           << " measured values for a history of " << (int)history.size() << " steps\n";
+    return -1;
+  }
+  measured.assign(values, values + numSteps);
+  return 0;
+}
+
+void
+UniaxialMaterialBatch::setTolerance(double newTol, int newMaxIter)
+{
+  tol = newTol;
+  maxIter = newMaxIter;
+}
+
+int
+UniaxialMaterialBatch::runMaterial(int m)
+{
+  UniaxialMaterial *theMaterial = materials[m];
+  const int numSteps = (int)history.size();
+  double *out = &response[m*numSteps];
+
+  theMaterial->revertToStart();
+
+  int step = 0;
+  if (control == StrainControl) {
+    for ( ; step < numSteps; step++) {
+      if (theMaterial->setTrialStrain(history[step]) < 0)
+        break;
+      out[step] = theMaterial->getStress();
+      theMaterial->commitState();
+    }
+
+  } else {
+    // residuals are measured against the largest stress in the history
+    double scale = 0.0;
+    for (double s : history)
+      if (fabs(s) > scale)
+        scale = fabs(s);
+    if (scale == 0.0)
+      scale = 1.0;
+
+    double strain = 0.0;
+    for ( ; step < numSteps; step++) {
+      bool converged = false;
+      for (int iter = 0; iter < maxIter; iter++) {
+        if (theMaterial->setTrialStrain(strain) < 0)
+          break;
+        double residual = history[step] - theMaterial->getStress();
+        if (fabs(residual) <= tol*scale) {
+          converged = true;
+          break;
+        }
+        // the first correction of a step is elastic, so that a load
+        // reversal does not start from the tangent of the last branch
+        double tangent = (iter == 0) ? theMaterial->getInitialTangent()
+                                     : theMaterial->getTangent();
+        if (!(tangent > 0.0))
+          tangent = theMaterial->getInitialTangent();
+        if (!(tangent > 0.0))
+          break;
+        strain += residual/tangent;
+      }
+      if (!converged)
+        break;
+      out[step] = strain;
+      theMaterial->commitState();
+    }
+  }
+
+  for (int i = step; i < numSteps; i++)
+    out[i] = NAN;
+
+  return (step == numSteps) ? 0 : -1;
+}
+
+int
+UniaxialMaterialBatch::run(int numThreads)
+{
+  const int numMaterials = (int)materials.size();
+  const int numSteps = (int)history.size();
+
+  if (numSteps == 0) {
+    opserr << "UniaxialMaterialBatch::run - no history has been set\n";
+    return -1;
+  }
+
+  response.assign(numMaterials*numSteps, 0.0);
+  result.assign(numMaterials, 0);
+
+  // the workers see the analysis state of the calling thread
+  OPS_ThreadState state;
+  std::atomic<int> next(0);
+  auto work = [&]() {
+    state.install();
+    for (int m = next++; m < numMaterials; m = next++)
+      result[m] = this->runMaterial(m);
+  };
+
+  // the calling thread takes part in the work
+  std::vector<std::thread> threads;
+  for (int t = 1; t < numThreads && t < numMaterials; t++)
+    threads.emplace_back(work);
+  work();
+  for (std::thread &thread : threads)
+    thread.join();
+
+  // misfit against the measured response
+  Misfit none = {NAN, NAN, NAN, NAN};
+  misfit.assign(numMaterials, none);
+  if (!measured.empty()) {
+    const double *strain = (control == StrainControl) ? history.data() : measured.data();
+    const double *stress = (control == StrainControl) ? measured.data() : history.data();
+
+    double sumMeasured = 0.0;
+    double energyMeasured = 0.0;
+    for (int i = 0; i < numSteps; i++) {
+      sumMeasured += measured[i]*measured[i];
+      if (i > 0)
+        energyMeasured += 0.5*(stress[i] + stress[i-1])*(strain[i] - strain[i-1]);
+    }
+    double rmsMeasured = sqrt(sumMeasured/numSteps);
+
+    for (int m = 0; m < numMaterials; m++) {
+      if (result[m] < 0)
+        continue;
+
+      const double *out = &response[m*numSteps];
+      if (control == StrainControl)
+        stress = out;
+      else
+        strain = out;
+
+      double sum = 0.0, maxError = 0.0, energy = 0.0;
+      for (int i = 0; i < numSteps; i++) {
+        double error = fabs(out[i] - measured[i]);
+        sum += error*error;
+        if (error > maxError)
+          maxError = error;
+        if (i > 0)
+          energy += 0.5*(stress[i] + stress[i-1])*(strain[i] - strain[i-1]);
+      }
+
+      Misfit &fit = misfit[m];
+      fit.rms = sqrt(sum/numSteps);
+      fit.normalizedRms = (rmsMeasured > 0.0) ? fit.rms/rmsMeasured : NAN;
+      fit.maxError = maxError;
+      fit.energyError = (energyMeasured != 0.0) ? (energy - energyMeasured)/fabs(energyMeasured)
+                                                : energy - energyMeasured;
+    }
+  }
+
+  int failed = 0;
+  for (int m = 0; m < numMaterials; m++)
+    if (result[m] < 0)
+      failed++;
+
+  if (failed != 0) {
+    opserr << "UniaxialMaterialBatch::run - " << failed << " of " << numMaterials
+           << " materials failed to complete the history\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+UniaxialMaterialBatch::getResult(int m) const
+{
+  return result[m];
+}
+
+const double *
+UniaxialMaterialBatch::getResponse(int m) const
+{
+  return &response[m*history.size()];
+}
+
+const UniaxialMaterialBatch::Misfit &
+UniaxialMaterialBatch::getMisfit(int m) const
+{
+  return misfit[m];
+}
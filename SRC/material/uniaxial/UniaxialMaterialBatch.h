@@ -0,0 +1,93 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the class definition for
+// UniaxialMaterialBatch. A UniaxialMaterialBatch drives a set of
+// independent UniaxialMaterial instances, typically the same model
+// built with different parameter sets, through one loading history and
+// records the response of each. The history is either a strain history,
+// in which case the stress is recorded, or a stress history, in which
+// case the strain that satisfies it is found by Newton iteration on the
+// material tangent.
+//
+// When a measured response is given, the misfit of each instance is
+// reported as the root mean square error, the same normalized by the
+// root mean square of the measured response, the maximum absolute
+// error, and the relative error in dissipated energy.
+//
+// Instances are distributed over numThreads threads. Each instance is
+// only touched by one thread, so any material whose state
+// determination does not write to static storage can be run this way.
+//
+#ifndef UniaxialMaterialBatch_h
+#define UniaxialMaterialBatch_h
+
+#include <vector>
+
+class UniaxialMaterial;
+
+class UniaxialMaterialBatch
+{
+  public:
+    enum Control {StrainControl, StressControl};
+
+    struct Misfit {
+      double rms;
+      double normalizedRms;
+      double maxError;
+      double energyError;
+    };
+
+    UniaxialMaterialBatch(Control control = StrainControl);
+    ~UniaxialMaterialBatch();
+
+    // the batch takes ownership of the material; returns its index
+    int addMaterial(UniaxialMaterial *theMaterial);
+    int getNumMaterials(void) const;
+
+    int setHistory(const double *history, int numSteps);
+    int setMeasured(const double *measured, int numSteps);
+    void setTolerance(double tol, int maxIter);
+
+    // returns 0 if all instances completed the history, -1 otherwise
+    int run(int numThreads = 1);
+
+    // results of the last run(); the response has one value per step
+    int getResult(int material) const;
+    const double *getResponse(int material) const;
+    const Misfit &getMisfit(int material) const;
+
+  private:
+    int runMaterial(int material);
+
+    Control control;
+    double tol;
+    int maxIter;
+
+    std::vector<double> history;
+    std::vector<double> measured;
+
+    std::vector<UniaxialMaterial *> materials;
+    std::vector<double> response;      // numSteps values per material
+    std::vector<int> result;
+    std::vector<Misfit> misfit;
+};
+
+#endif
@@ -130,96 +130,37 @@ Steel02::Steel02(int tag,
 		 double _R0, double _cR1, double _cR2,
 		 double _a1, double _a2, double _a3, double _a4, double sigInit):
   UniaxialMaterial(tag, MAT_TAG_Steel02),
-  Fy(_Fy), E0(_E0), b(_b), R0(_R0), cR1(_cR1), cR2(_cR2), a1(_a1), a2(_a2), a3(_a3), a4(_a4), 
-  sigini(sigInit)
+  theParameters(Parameters{_Fy, _E0, _b, _R0, _cR1, _cR2, _a1, _a2, _a3, _a4, sigInit})
 {
-	EnergyP = 0;	//by SAJalali
-	konP = 0;
   kon = 0;
-  eP = E0;
-  epsP = 0.0;
-  sigP = 0.0;
-  sig = 0.0;
-  eps = 0.0;
-  e = E0;
-
-  epsmaxP = Fy/E0;
-  epsminP = -epsmaxP;
-  epsplP = 0.0;
-  epss0P = 0.0;
-  sigs0P = 0.0;
-  epssrP = 0.0;
-  sigsrP = 0.0;
-
-  if (sigini != 0.0) {
-    epsP = sigini/E0;
-    sigP = sigini;
-  } 
+  this->revertToStart();
 }
 
 Steel02::Steel02(int tag,
 		 double _Fy, double _E0, double _b,
 		 double _R0, double _cR1, double _cR2):
   UniaxialMaterial(tag, MAT_TAG_Steel02),
-  Fy(_Fy), E0(_E0), b(_b), R0(_R0), cR1(_cR1), cR2(_cR2), sigini(0.0)
+  theParameters(Parameters{_Fy, _E0, _b, _R0, _cR1, _cR2, 0.0, 1.0, 0.0, 1.0, 0.0})
 {
-	EnergyP = 0;	//by SAJalali
-	konP = 0;
-
-  // Default values for no isotropic hardening
-  a1 = 0.0;
-  a2 = 1.0;
-  a3 = 0.0;
-  a4 = 1.0;
-
-  eP = E0;
-  epsP = 0.0;
-  sigP = 0.0;
-  sig = 0.0;
-  eps = 0.0;
-  e = E0;
-
-  epsmaxP = Fy/E0;
-  epsminP = -epsmaxP;
-  epsplP = 0.0;
-  epss0P = 0.0;
-  sigs0P = 0.0;
-  epssrP = 0.0;
-  sigsrP = 0.0;
+  kon = 0;
+  this->revertToStart();
 }
 
 Steel02::Steel02(int tag, double _Fy, double _E0, double _b):
   UniaxialMaterial(tag, MAT_TAG_Steel02),
-  Fy(_Fy), E0(_E0), b(_b), sigini(0.0)
+  theParameters(Parameters{_Fy, _E0, _b, 15.0, 0.925, 0.15, 0.0, 1.0, 0.0, 1.0, 0.0})
 {
-	EnergyP = 0;	//by SAJalali
-	konP = 0;
-
-  // Default values for elastic to hardening transitions
-  R0 = 15.0;
-  cR1 = 0.925;
-  cR2 = 0.15;
-
-  // Default values for no isotropic hardening
-  a1 = 0.0;
-  a2 = 1.0;
-  a3 = 0.0;
-  a4 = 1.0;
-
-  eP = E0;
-  epsP = 0.0;
-  sigP = 0.0;
-  sig = 0.0;
-  eps = 0.0;
-  e = E0;
+  kon = 0;
+  this->revertToStart();
+}
 
-  epsmaxP = Fy/E0;
-  epsminP = -epsmaxP;
-  epsplP = 0.0;
-  epss0P = 0.0;
-  sigs0P = 0.0;
-  epssrP = 0.0;
-  sigsrP = 0.0;
+// copies share the parameter block of the material they are made from
+Steel02::Steel02(int tag, const MaterialParameters<Parameters> &parameters):
+  UniaxialMaterial(tag, MAT_TAG_Steel02),
+  theParameters(parameters)
+{
+  kon = 0;
+  this->revertToStart();
 }
 
 Steel02::Steel02(void):
@@ -231,13 +172,12 @@ Steel02::Steel02(void):
 
 Steel02::~Steel02(void)
 {
-  // Does nothing
 }
 
 UniaxialMaterial*
 Steel02::getCopy(void)
 {
-  Steel02 *theCopy = new Steel02(this->getTag(), Fy, E0, b, R0, cR1, cR2, a1, a2, a3, a4, sigini);
+  Steel02 *theCopy = new Steel02(this->getTag(), theParameters);
   
   return theCopy;
 }
@@ -245,18 +185,20 @@ Steel02::getCopy(void)
 double
 Steel02::getInitialTangent(void)
 {
-  return E0;
+  return theParameters->E0;
 }
 
 int
 Steel02::setTrialStrain(double trialStrain, double strainRate)
 {
-  double Esh = b * E0;
-  double epsy = Fy / E0;
+  const Parameters &par = *theParameters;
+
+  double Esh = par.b * par.E0;
+  double epsy = par.Fy / par.E0;
 
   // modified C-P. Lamarche 2006
-  if (sigini != 0.0) {
-    double epsini = sigini/E0;
+  if (par.sigini != 0.0) {
+    double epsini = par.sigini/par.E0;
     eps = trialStrain+epsini;
   } else
     eps = trialStrain;
@@ -278,8 +220,8 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
 
     if (fabs(deps) < 10.0*DBL_EPSILON) {
 
-      e = E0;
-      sig = sigini;                // modified C-P. Lamarche 2006
+      e = par.E0;
+      sig = par.sigini;                // modified C-P. Lamarche 2006
       kon = 3;                     // modified C-P. Lamarche 2006 flag to impose initial stess/strain
       return 0;
 
@@ -290,12 +232,12 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
       if (deps < 0.0) {
 	kon = 2;
 	epss0 = epsmin;
-	sigs0 = -Fy;
+	sigs0 = -par.Fy;
 	epspl = epsmin;
       } else {
 	kon = 1;
 	epss0 = epsmax;
-	sigs0 = Fy;
+	sigs0 = par.Fy;
 	epspl = epsmax;
       }
     }
@@ -318,10 +260,10 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
     //epsmin = min(epsP, epsmin);
     if (epsP < epsmin)
       epsmin = epsP;
-    double d1 = (epsmax - epsmin) / (2.0*(a4 * epsy));
-    double shft = 1.0 + a3 * pow(d1, 0.8);
-    epss0 = (Fy * shft - Esh * epsy * shft - sigr + E0 * epsr) / (E0 - Esh);
-    sigs0 = Fy * shft + Esh * (epss0 - epsy * shft);
+    double d1 = (epsmax - epsmin) / (2.0*(par.a4 * epsy));
+    double shft = 1.0 + par.a3 * pow(d1, 0.8);
+    epss0 = (par.Fy * shft - Esh * epsy * shft - sigr + par.E0 * epsr) / (par.E0 - Esh);
+    sigs0 = par.Fy * shft + Esh * (epss0 - epsy * shft);
     epspl = epsmax;
 
   } else if (kon == 1 && deps < 0.0) {
@@ -340,10 +282,10 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
     if (epsP > epsmax)
       epsmax = epsP;
     
-    double d1 = (epsmax - epsmin) / (2.0*(a2 * epsy));
-    double shft = 1.0 + a1 * pow(d1, 0.8);
-    epss0 = (-Fy * shft + Esh * epsy * shft - sigr + E0 * epsr) / (E0 - Esh);
-    sigs0 = -Fy * shft + Esh * (epss0 + epsy * shft);
+    double d1 = (epsmax - epsmin) / (2.0*(par.a2 * epsy));
+    double shft = 1.0 + par.a1 * pow(d1, 0.8);
+    epss0 = (-par.Fy * shft + Esh * epsy * shft - sigr + par.E0 * epsr) / (par.E0 - Esh);
+    sigs0 = -par.Fy * shft + Esh * (epss0 + epsy * shft);
     epspl = epsmin;
   }
 
@@ -351,15 +293,15 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
   // calculate current stress sig and tangent modulus E 
 
   double xi     = fabs((epspl-epss0)/epsy);
-  double R      = R0*(1.0 - (cR1*xi)/(cR2+xi));
+  double R      = par.R0*(1.0 - (par.cR1*xi)/(par.cR2+xi));
   double epsrat = (eps-epsr)/(epss0-epsr);
   double dum1  = 1.0 + pow(fabs(epsrat),R);
   double dum2  = pow(dum1,(1/R));
 
-  sig   = b*epsrat +(1.0-b)*epsrat/dum2;
+  sig   = par.b*epsrat +(1.0-par.b)*epsrat/dum2;
   sig   = sig*(sigs0-sigr)+sigr;
 
-  e = b + (1.0-b)/(dum1*dum2);
+  e = par.b + (1.0-par.b)/(dum1*dum2);
   e = e*(sigs0-sigr)/(epss0-epsr);
 
   return 0;
@@ -428,16 +370,18 @@ Steel02::revertToLastCommit(void)
 int 
 Steel02::revertToStart(void)
 {
+  const Parameters &par = *theParameters;
+
 	EnergyP = 0;	//by SAJalali
-	eP = E0;
+	eP = par.E0;
   epsP = 0.0;
   sigP = 0.0;
   sig = 0.0;
   eps = 0.0;
-  e = E0;  
+  e = par.E0;  
 
   konP = 0;
-  epsmaxP = Fy/E0;
+  epsmaxP = par.Fy/par.E0;
   epsminP = -epsmaxP;
   epsplP = 0.0;
   epss0P = 0.0;
@@ -445,9 +389,9 @@ Steel02::revertToStart(void)
   epssrP = 0.0;
   sigsrP = 0.0;
 
-  if (sigini != 0.0) {
-	  epsP = sigini/E0;
-	  sigP = sigini;
+  if (par.sigini != 0.0) {
+	  epsP = par.sigini/par.E0;
+	  sigP = par.sigini;
    } 
 
   return 0;
@@ -456,17 +400,19 @@ Steel02::revertToStart(void)
 int 
 Steel02::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(23);
-  data(0) = Fy;
-  data(1) = E0;
-  data(2) = b;
-  data(3) = R0;
-  data(4) = cR1;
-  data(5) = cR2;
-  data(6) = a1;
-  data(7) = a2;
-  data(8) = a3;
-  data(9) = a4;
+  const Parameters &par = *theParameters;
+
+  static thread_local Vector data(23);
+  data(0) = par.Fy;
+  data(1) = par.E0;
+  data(2) = par.b;
+  data(3) = par.R0;
+  data(4) = par.cR1;
+  data(5) = par.cR2;
+  data(6) = par.a1;
+  data(7) = par.a2;
+  data(8) = par.a3;
+  data(9) = par.a4;
   data(10) = epsminP;
   data(11) = epsmaxP;
   data(12) = epsplP;
@@ -479,7 +425,7 @@ Steel02::sendSelf(int commitTag, Channel &theChannel)
   data(19) = sigP;  
   data(20) = eP;    
   data(21) = this->getTag();
-  data(22) = sigini;
+  data(22) = par.sigini;
 
   if (theChannel.sendVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "Steel02::sendSelf() - failed to sendSelf\n";
@@ -492,23 +438,18 @@ int
 Steel02::recvSelf(int commitTag, Channel &theChannel, 
 	     FEM_ObjectBroker &theBroker)
 {
-  static Vector data(23);
+  static thread_local Vector data(23);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "Steel02::recvSelf() - failed to recvSelf\n";
     return -1;
   }
 
-  Fy = data(0);
-  E0 = data(1);
-  b = data(2); 
-  R0 = data(3);
-  cR1 = data(4);
-  cR2 = data(5);
-  a1 = data(6); 
-  a2 = data(7); 
-  a3 = data(8); 
-  a4 = data(9); 
+  // the received constants replace the block, which may be shared
+  theParameters = MaterialParameters<Parameters>(Parameters{data(0), data(1),
+    data(2), data(3), data(4), data(5), data(6), data(7), data(8), data(9),
+    data(22)});
+
   epsminP = data(10);
   epsmaxP = data(11);
   epsplP = data(12); 
@@ -521,7 +462,6 @@ Steel02::recvSelf(int commitTag, Channel &theChannel,
   sigP = data(19);   
   eP   = data(20);   
   this->setTag(int(data(21)));
-  sigini = data(22);
 
   e = eP;
   sig = sigP;
@@ -533,36 +473,38 @@ Steel02::recvSelf(int commitTag, Channel &theChannel,
 void 
 Steel02::Print(OPS_Stream &s, int flag)
 {
+  const Parameters &par = *theParameters;
+
   if (flag == OPS_PRINT_PRINTMODEL_MATERIAL) {      
     //    s << "Steel02:(strain, stress, tangent) " << eps << " " << sig << " " << e << endln;
     s << "Steel02 tag: " << this->getTag() << endln;
-    s << "  fy: " << Fy << ", ";
-    s << "  E0: " << E0 << ", ";
-    s << "   b: " << b << ", ";
-    s << "  R0: " << R0 << ", ";
-    s << " cR1: " << cR1 << ", ";
-    s << " cR2: " << cR2 << ", ";    
-    s << "  a1: " << a1 << ", ";
-    s << "  a2: " << a2 << ", ";
-    s << "  a3: " << a3 << ", ";
-    s << "  a4: " << a4;    
+    s << "  fy: " << par.Fy << ", ";
+    s << "  E0: " << par.E0 << ", ";
+    s << "   b: " << par.b << ", ";
+    s << "  R0: " << par.R0 << ", ";
+    s << " cR1: " << par.cR1 << ", ";
+    s << " cR2: " << par.cR2 << ", ";    
+    s << "  a1: " << par.a1 << ", ";
+    s << "  a2: " << par.a2 << ", ";
+    s << "  a3: " << par.a3 << ", ";
+    s << "  a4: " << par.a4;    
   }
   
   if (flag == OPS_PRINT_PRINTMODEL_JSON) {
     s << "\t\t\t{";
 	s << "\"name\": \"" << this->getTag() << "\", ";
 	s << "\"type\": \"Steel02\", ";
-	s << "\"E\": " << E0 << ", ";
-	s << "\"fy\": " << Fy << ", ";
-    s << "\"b\": " << b << ", ";
-    s << "\"R0\": " << R0 << ", ";
-    s << "\"cR1\": " << cR1 << ", ";
-    s << "\"cR2\": " << cR2 << ", ";
-    s << "\"a1\": " << a1 << ", ";
-    s << "\"a2\": " << a2 << ", ";
-    s << "\"a3\": " << a3 << ", ";
-    s << "\"a4\": " << a4 << ", ";    
-    s << "\"sigini\": " << sigini << "}";
+	s << "\"E\": " << par.E0 << ", ";
+	s << "\"fy\": " << par.Fy << ", ";
+    s << "\"b\": " << par.b << ", ";
+    s << "\"R0\": " << par.R0 << ", ";
+    s << "\"cR1\": " << par.cR1 << ", ";
+    s << "\"cR2\": " << par.cR2 << ", ";
+    s << "\"a1\": " << par.a1 << ", ";
+    s << "\"a2\": " << par.a2 << ", ";
+    s << "\"a3\": " << par.a3 << ", ";
+    s << "\"a4\": " << par.a4 << ", ";    
+    s << "\"sigini\": " << par.sigini << "}";
   }
 }
 
@@ -572,31 +514,31 @@ Steel02::setParameter(const char **argv, int argc, Parameter &param)
 {
 
   if (strcmp(argv[0],"sigmaY") == 0 || strcmp(argv[0],"fy") == 0 || strcmp(argv[0],"Fy") == 0) {
-    param.setValue(Fy);
+    param.setValue(theParameters->Fy);
     return param.addObject(1, this);
   }
   if (strcmp(argv[0],"E") == 0) {
-    param.setValue(E0);
+    param.setValue(theParameters->E0);
     return param.addObject(2, this);
   }
   if (strcmp(argv[0],"b") == 0) {
-    param.setValue(b);
+    param.setValue(theParameters->b);
     return param.addObject(3, this);
   }
   if (strcmp(argv[0],"a1") == 0) {
-    param.setValue(a1);
+    param.setValue(theParameters->a1);
     return param.addObject(4, this);
   }
   if (strcmp(argv[0],"a2") == 0) {
-    param.setValue(a2);
+    param.setValue(theParameters->a2);
     return param.addObject(5, this);
   }
   if (strcmp(argv[0],"a3") == 0) {
-    param.setValue(a3);
+    param.setValue(theParameters->a3);
     return param.addObject(6, this);
   }
   if (strcmp(argv[0],"a4") == 0) {
-    param.setValue(a4);
+    param.setValue(theParameters->a4);
     return param.addObject(7, this);
   }
 
@@ -612,25 +554,25 @@ Steel02::updateParameter(int parameterID, Information &info)
   case -1:
     return -1;
   case 1:
-    this->Fy = info.theDouble;
+    theParameters.edit().Fy = info.theDouble;
     break;
   case 2:
-    this->E0 = info.theDouble;
+    theParameters.edit().E0 = info.theDouble;
     break;
   case 3:
-    this->b = info.theDouble;
+    theParameters.edit().b = info.theDouble;
     break;
   case 4:
-    this->a1 = info.theDouble;
+    theParameters.edit().a1 = info.theDouble;
     break;
   case 5:
-    this->a2 = info.theDouble;
+    theParameters.edit().a2 = info.theDouble;
     break;
   case 6:
-    this->a3 = info.theDouble;
+    theParameters.edit().a3 = info.theDouble;
     break;
   case 7:
-    this->a4 = info.theDouble;
+    theParameters.edit().a4 = info.theDouble;
     break;
   default:
     return -1;
@@ -40,6 +40,7 @@
 #define Steel02_h
 
 #include <UniaxialMaterial.h>
+#include <MaterialParameters.h>
 
 class Steel02 : public UniaxialMaterial
 {
@@ -91,19 +92,26 @@ class Steel02 : public UniaxialMaterial
  protected:
     
  private:
+    // matpar : STEEL FIXED PROPERTIES, shared by all copies
+    struct Parameters {
+      double Fy;  //  = matpar(1)  : yield stress
+      double E0;  //  = matpar(2)  : initial stiffness
+      double b;   //  = matpar(3)  : hardening ratio (Esh/E0)
+      double R0;  //  = matpar(4)  : exp transition elastic-plastic
+      double cR1; //  = matpar(5)  : coefficient for changing R0 to R
+      double cR2; //  = matpar(6)  : coefficient for changing R0 to R
+      double a1;  //  = matpar(7)  : coefficient for isotropic hardening in compression
+      double a2;  //  = matpar(8)  : coefficient for isotropic hardening in compression
+      double a3;  //  = matpar(9)  : coefficient for isotropic hardening in tension
+      double a4;  //  = matpar(10) : coefficient for isotropic hardening in tension
+      double sigini; // initial 
+    };
+
+    Steel02(int tag, const MaterialParameters<Parameters> &parameters);
+
+    MaterialParameters<Parameters> theParameters;
+
 	 double EnergyP; //by SAJalali
-	 // matpar : STEEL FIXED PROPERTIES
-    double Fy;  //  = matpar(1)  : yield stress
-    double E0;  //  = matpar(2)  : initial stiffness
-    double b;   //  = matpar(3)  : hardening ratio (Esh/E0)
-    double R0;  //  = matpar(4)  : exp transition elastic-plastic
-    double cR1; //  = matpar(5)  : coefficient for changing R0 to R
-    double cR2; //  = matpar(6)  : coefficient for changing R0 to R
-    double a1;  //  = matpar(7)  : coefficient for isotropic hardening in compression
-    double a2;  //  = matpar(8)  : coefficient for isotropic hardening in compression
-    double a3;  //  = matpar(9)  : coefficient for isotropic hardening in tension
-    double a4;  //  = matpar(10) : coefficient for isotropic hardening in tension
-    double sigini; // initial 
     // hstvP : STEEL HISTORY VARIABLES
     double epsminP; //  = hstvP(1) : max eps in compression
     double epsmaxP; //  = hstvP(2) : max eps in tension
@@ -76,6 +76,7 @@ class ID
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;
     friend class MPI_Channel;
+    friend class PackedChannel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
     
@@ -143,6 +143,7 @@ class Matrix
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;
     friend class MPI_Channel;
+    friend class PackedChannel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
 
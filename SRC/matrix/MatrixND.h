@@ -29,11 +29,15 @@
 #include <stdexcept>
 #include <functional>
 #include <iostream> // overloading <<
+#include <limits>
+#include <type_traits>
 
 #include "VectorND.h"
 #include "Matrix.h"
 #include "Vector.h"
 #include "blasdecl.h"
+#include "routines/cmx.h"
+#include "routines/SY3.h"
 
 #if __cplusplus < 202000L
 #define consteval
@@ -140,84 +144,411 @@ struct MatrixND {
     return values[0][0] * values[1][1] - values[0][1] * values[1][0];
   }
 
-  int solve(const VectorND<NR> &V, VectorND<NR> &res) const
+  //
+  // Dense kernels
+  //
+  // These are specialized at compile time for the dimensions of the
+  // operands, so that the loops can be fully unrolled and vectorized.
+  // For the small systems formed at the element level they avoid the
+  // call overhead of BLAS/LAPACK and do not touch the heap.
+  //
+
+  // this = thisFact*this + otherFact*A*B
+  template <index_t NK>
+  int
+  addMatrixProduct(T thisFact, const MatrixND<NR,NK,T> &A, const MatrixND<NK,NC,T> &B, T otherFact)
+  {
+    for (index_t j = 0; j < NC; ++j) {
+      // accumulate column j in registers
+      T cj[NR] = {};
+      for (index_t k = 0; k < NK; ++k) {
+        const T bkj = B.values[j][k];
+        for (index_t i = 0; i < NR; ++i)
+          cj[i] += A.values[k][i]*bkj;
+      }
+
+      if (thisFact == 0.0)
+        for (index_t i = 0; i < NR; ++i)
+          values[j][i] = otherFact*cj[i];
+      else
+        for (index_t i = 0; i < NR; ++i)
+          values[j][i] = thisFact*values[j][i] + otherFact*cj[i];
+    }
+    return 0;
+  }
+
+  // this = thisFact*this + otherFact*A'*B
+  template <index_t NK>
+  int
+  addMatrixTransposeProduct(T thisFact, const MatrixND<NK,NR,T> &A, const MatrixND<NK,NC,T> &B, T otherFact)
+  {
+    // Forming A' explicitly lets the product run down contiguous
+    // columns instead of as dot products, which do not vectorize
+    // without reassociation.
+    MatrixND<NR,NK,T> At;
+    for (index_t j = 0; j < NK; ++j)
+      for (index_t i = 0; i < NR; ++i)
+        At.values[j][i] = A.values[i][j];
+
+    return this->addMatrixProduct(thisFact, At, B, otherFact);
+  }
+
+  // this = thisFact*this + otherFact*A'*B*A
+  template <index_t NB>
+  int
+  addMatrixTripleProduct(T thisFact, const MatrixND<NB,NR,T> &A, const MatrixND<NB,NB,T> &B, T otherFact)
     requires(NR == NC)
   {
-    MatrixND<NR,NC> work = *this;
-    int pivot_ind[NR];
-    int nrhs = 1;
-    int nr = NR;
-    int nc = NC;
-    int info = 0;
-    res = V; // X will be overwritten with the solution
-    DGESV(&nr, &nrhs, &work.values[0][0], &nr, pivot_ind, res.values, &nc, &info);
-    return -abs(info);
-  }
-
-  int solve(const Vector &V, Vector &res) const
+    MatrixND<NB,NC,T> BA;
+    BA.addMatrixProduct(0.0, B, A, 1.0);
+    return this->addMatrixTransposeProduct(thisFact, A, BA, otherFact);
+  }
+
+  // this = thisFact*this + otherFact*A'*B*C
+  template <index_t NA, index_t NB>
+  int
+  addMatrixTripleProduct(T thisFact, const MatrixND<NA,NR,T> &A, const MatrixND<NA,NB,T> &B,
+                         const MatrixND<NB,NC,T> &C, T otherFact)
+  {
+    MatrixND<NA,NC,T> BC;
+    BC.addMatrixProduct(0.0, B, C, 1.0);
+    return this->addMatrixTransposeProduct(thisFact, A, BC, otherFact);
+  }
+
+  //
+  // In-place LU factorization with partial pivoting. On return the
+  // strictly lower triangle holds the unit lower factor and the upper
+  // triangle holds U; row i was interchanged with row piv[i]. Returns
+  // -(k+1) if the k-th pivot is zero.
+  //
+  int
+  factorLU(index_t piv[NR])
     requires(NR == NC)
   {
-    MatrixND<NR,NC> work = *this;
-    int pivot_ind[NR];
-    int nrhs = 1;
-    int nr = NR;
-    int nc = NC;
-    int info = 0;
-    res = V; // X will be overwritten with the solution
-    DGESV(&nr, &nrhs, work.values, &nr, &pivot_ind, res.theData, &nc, &info);
-    return -abs(info);
-  }
-
-  int solve(const Matrix &M, Matrix &res)
+    for (index_t k = 0; k < NC; ++k) {
+      index_t p = k;
+      T pmax = fabs(values[k][k]);
+      for (index_t i = k+1; i < NR; ++i)
+        if (fabs(values[k][i]) > pmax) {
+          pmax = fabs(values[k][i]);
+          p = i;
+        }
+
+      piv[k] = p;
+      if (pmax == 0.0)
+        return -(k+1);
+
+      if (p != k)
+        for (index_t j = 0; j < NC; ++j) {
+          const T tmp = values[j][k];
+          values[j][k] = values[j][p];
+          values[j][p] = tmp;
+        }
+
+      const T dinv = 1.0/values[k][k];
+      for (index_t i = k+1; i < NR; ++i)
+        values[k][i] *= dinv;
+
+      // update the trailing block one column at a time
+      for (index_t j = k+1; j < NC; ++j) {
+        const T akj = values[j][k];
+        for (index_t i = k+1; i < NR; ++i)
+          values[j][i] -= values[k][i]*akj;
+      }
+    }
+    return 0;
+  }
+
+  // Forward/back substitution with the factors from factorLU; x holds
+  // the right hand side on entry and the solution on return.
+  void
+  substituteLU(const index_t piv[NR], T x[NR]) const
+    requires(NR == NC)
   {
-    MatrixND<NR,NC> work = *this;
-    int pivot_ind[NR];
-    int *nrhs = M.noCols();
-    int nr = NR;
-    int nc = NC;
-    int info = 0;
-    res = M; // M will be overwritten with the solution
-    DGESV(&nr, &nrhs, &work(0,0), &nr, &pivot_ind, &res(0,0), &nc, &info);
-    return -abs(info);
-  }
-
-#if 0
-  int invert(MatrixND<NR,NC> &res) const
+    for (index_t i = 0; i < NR; ++i)
+      if (piv[i] != i) {
+        const T tmp = x[i];
+        x[i] = x[piv[i]];
+        x[piv[i]] = tmp;
+      }
+
+    for (index_t j = 0; j < NC; ++j) {
+      const T xj = x[j];
+      for (index_t i = j+1; i < NR; ++i)
+        x[i] -= values[j][i]*xj;
+    }
+
+    for (index_t j = NC-1; j >= 0; --j) {
+      x[j] /= values[j][j];
+      const T xj = x[j];
+      for (index_t i = 0; i < j; ++i)
+        x[i] -= values[j][i]*xj;
+    }
+  }
+
+  //
+  // In-place Cholesky factorization A = LL' of a symmetric positive
+  // definite matrix. Only the lower triangle is referenced and
+  // overwritten. Returns -(k+1) if the k-th pivot is not positive.
+  //
+  int
+  factorCholesky()
+    requires(NR == NC)
   {
+    for (index_t j = 0; j < NC; ++j) {
+      T d = values[j][j];
+      for (index_t k = 0; k < j; ++k)
+        d -= values[k][j]*values[k][j];
+      if (d <= 0.0)
+        return -(j+1);
+
+      d = sqrt(d);
+      values[j][j] = d;
+      for (index_t i = j+1; i < NR; ++i) {
+        T s = values[j][i];
+        for (index_t k = 0; k < j; ++k)
+          s -= values[k][i]*values[k][j];
+        values[j][i] = s/d;
+      }
+    }
     return 0;
   }
-  int invert(Matrix &res) const
+
+  // Solve LL'x = b with the factor from factorCholesky; x holds b on entry.
+  void
+  substituteCholesky(T x[NR]) const
+    requires(NR == NC)
+  {
+    for (index_t j = 0; j < NC; ++j) {
+      x[j] /= values[j][j];
+      const T xj = x[j];
+      for (index_t i = j+1; i < NR; ++i)
+        x[i] -= values[j][i]*xj;
+    }
+
+    for (index_t j = NC-1; j >= 0; --j) {
+      T s = x[j];
+      for (index_t i = j+1; i < NR; ++i)
+        s -= values[j][i]*x[i];
+      x[j] = s/values[j][j];
+    }
+  }
+
+  int
+  solve(const VectorND<NR> &V, VectorND<NR> &res) const
+    requires(NR == NC)
   {
+    MatrixND<NR,NC,T> work = *this;
+    index_t piv[NR];
+    int info = work.factorLU(piv);
+    if (info != 0)
+      return info;
+
+    res = V;
+    work.substituteLU(piv, res.values);
     return 0;
   }
-  int invert()
+
+  int
+  solve(const Vector &V, Vector &res) const
+    requires(NR == NC)
   {
+    assert(V.Size() == NR && res.Size() == NR);
+
+    MatrixND<NR,NC,T> work = *this;
+    index_t piv[NR];
+    int info = work.factorLU(piv);
+    if (info != 0)
+      return info;
+
+    res = V;
+    work.substituteLU(piv, &res(0));
     return 0;
   }
 
-  int addMatrix(double alpha, const MatrixND &other, double beta) {
+  int
+  solve(const Matrix &M, Matrix &res) const
+    requires(NR == NC)
+  {
+    assert(M.noRows() == NR && res.noRows() == NR);
+    assert(M.noCols() == res.noCols());
+
+    MatrixND<NR,NC,T> work = *this;
+    index_t piv[NR];
+    int info = work.factorLU(piv);
+    if (info != 0)
+      return info;
+
+    res = M;
+    // Matrix is column-major, so each column is contiguous
+    for (int j = 0; j < M.noCols(); ++j)
+      work.substituteLU(piv, &res(0,j));
+    return 0;
   }
 
-  int addMatrixTranspose(double factThis, const Matrix &other, double factOther)
+  int
+  solveCholesky(const VectorND<NR> &V, VectorND<NR> &res) const
+    requires(NR == NC)
   {
+    MatrixND<NR,NC,T> work = *this;
+    int info = work.factorCholesky();
+    if (info != 0)
+      return info;
+
+    res = V;
+    work.substituteCholesky(res.values);
+    return 0;
   }
-  // AB
-  int addMatrixProduct(double factThis, const Matrix &A, const Matrix &B, double factOther)
+
+  int
+  invert(MatrixND<NR,NC,T> &res) const
+    requires(NR == NC)
   {
+    // the cmx_inv routines do not take const input, and res may be *this
+    MatrixND<NR,NC,T> work = *this;
+
+    // The closed-form routines are only faster than LU up to 4x4
+    if constexpr (NR >= 2 && NR <= 4 && std::is_same<T,double>::value) {
+      int info = 0;
+      if constexpr (NR == 2)
+        cmx_inv2(&work.values[0][0], &res.values[0][0], &info);
+      else if constexpr (NR == 3)
+        cmx_inv3(&work.values[0][0], &res.values[0][0], &info);
+      else
+        cmx_inv4(&work.values[0][0], &res.values[0][0], &info);
+      return info;
+
+    } else {
+      index_t piv[NR];
+      int info = work.factorLU(piv);
+      if (info != 0)
+        return info;
+
+      res.zero();
+      for (index_t j = 0; j < NC; ++j) {
+        res.values[j][j] = 1.0;
+        work.substituteLU(piv, res.values[j]);
+      }
+      return 0;
+    }
   }
-  // A'B
-  int addMatrixTransposeProduct(double factThis, const Matrix &A, const Matrix &B, double factOther)
+
+  int
+  invert(Matrix &res) const
+    requires(NR == NC)
   {
+    assert(res.noRows() == NR && res.noCols() == NC);
+    MatrixND<NR,NC,T> inv;
+    int info = this->invert(inv);
+    for (index_t j = 0; j < NC; ++j)
+      for (index_t i = 0; i < NR; ++i)
+        res(i,j) = inv.values[j][i];
+    return info;
   }
-  // A'BA
-  int addMatrixTripleProduct(double factThis, const Matrix &A, const Matrix &B, double factOther)
+
+  int
+  invert()
+    requires(NR == NC)
   {
+    return this->invert(*this);
   }
-  //A'BC
-  int addMatrixTripleProduct(double factThis, const Matrix &A, const Matrix &B, const Matrix &C, double otherFact)
+
+  //
+  // Eigenvalues and eigenvectors of a symmetric matrix. The eigenvalues
+  // are returned in ascending order and the corresponding (orthonormal)
+  // eigenvectors are stored in the columns of vecs. 3x3 matrices use the
+  // tridiagonal QL routine from matrix/routines; other sizes use cyclic
+  // Jacobi rotations. Returns -1 if the iteration did not converge.
+  //
+  int
+  symeig(VectorND<NR,T> &vals, MatrixND<NR,NC,T> &vecs) const
+    requires(NR == NC)
   {
-  } 
-#endif 
+    if constexpr (NR == 3 && std::is_same<T,double>::value) {
+      double a[3][3], v[3][3];
+      for (index_t j = 0; j < 3; ++j)
+        for (index_t i = 0; i < 3; ++i)
+          a[i][j] = values[j][i];
+
+      // v is row-major with the eigenvectors in its columns
+      cmx_eigSY3(a, v, vals.values);
+      for (index_t j = 0; j < 3; ++j)
+        for (index_t i = 0; i < 3; ++i)
+          vecs.values[j][i] = v[i][j];
+      return 0;
+
+    } else {
+      MatrixND<NR,NC,T> a = *this;
+      vecs.zero();
+      for (index_t i = 0; i < NR; ++i)
+        vecs.values[i][i] = 1.0;
+
+      T norm = 0.0;
+      for (index_t j = 0; j < NC; ++j)
+        for (index_t i = 0; i < NR; ++i)
+          norm += a.values[j][i]*a.values[j][i];
+
+      const T tol = std::numeric_limits<T>::epsilon()*std::numeric_limits<T>::epsilon()*norm;
+      int status = -1;
+      for (int sweep = 0; sweep < 50; ++sweep) {
+        T off = 0.0;
+        for (index_t q = 1; q < NC; ++q)
+          for (index_t p = 0; p < q; ++p)
+            off += a.values[q][p]*a.values[q][p];
+
+        if (off <= tol) {
+          status = 0;
+          break;
+        }
+
+        for (index_t p = 0; p < NR-1; ++p)
+          for (index_t q = p+1; q < NC; ++q) {
+            const T apq = a.values[q][p];
+            if (apq == 0.0)
+              continue;
+
+            // rotation that annihilates a(p,q); Golub & Van Loan 8.5.2
+            const T theta = (a.values[q][q] - a.values[p][p])/(2.0*apq);
+            const T t = (theta >= 0.0 ? 1.0 : -1.0)/(fabs(theta) + sqrt(theta*theta + 1.0));
+            const T c = 1.0/sqrt(t*t + 1.0);
+            const T s = t*c;
+
+            for (index_t k = 0; k < NR; ++k) {
+              const T akp = a.values[p][k], akq = a.values[q][k];
+              a.values[p][k] = c*akp - s*akq;
+              a.values[q][k] = s*akp + c*akq;
+            }
+            for (index_t k = 0; k < NC; ++k) {
+              const T apk = a.values[k][p], aqk = a.values[k][q];
+              a.values[k][p] = c*apk - s*aqk;
+              a.values[k][q] = s*apk + c*aqk;
+            }
+            for (index_t k = 0; k < NR; ++k) {
+              const T vkp = vecs.values[p][k], vkq = vecs.values[q][k];
+              vecs.values[p][k] = c*vkp - s*vkq;
+              vecs.values[q][k] = s*vkp + c*vkq;
+            }
+          }
+      }
+
+      for (index_t i = 0; i < NR; ++i)
+        vals.values[i] = a.values[i][i];
+
+      // sort ascending
+      for (index_t i = 1; i < NR; ++i)
+        for (index_t j = i; j > 0 && vals.values[j] < vals.values[j-1]; --j) {
+          const T tmp = vals.values[j];
+          vals.values[j] = vals.values[j-1];
+          vals.values[j-1] = tmp;
+          for (index_t k = 0; k < NR; ++k) {
+            const T vk = vecs.values[j][k];
+            vecs.values[j][k] = vecs.values[j-1][k];
+            vecs.values[j-1][k] = vk;
+          }
+        }
+      return status;
+    }
+  }
 
   constexpr MatrixND &
   operator=(const Matrix &other)
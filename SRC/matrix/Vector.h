@@ -123,6 +123,7 @@ class Vector
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;    
     friend class MPI_Channel;
+    friend class PackedChannel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
     
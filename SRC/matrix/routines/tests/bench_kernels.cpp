@@ -0,0 +1,263 @@
+//
+// Compares the fixed-size MatrixND kernels against the BLAS/LAPACK
+// call sequences used by the dynamic Matrix class:
+//
+//   Matrix::addMatrixTripleProduct  -> DGEMM("N","N") + DGEMM("T","N")
+//   Matrix::Solve                   -> copy + DGESV
+//   Matrix::Invert                  -> cmx_inv6 (n = 6), DGETRF + DGETRI (n > 6)
+//
+// and checks the results against each other. The sizes are those of
+// the 3D frame transformations (6 -> 7 -> 12) and typical shell and
+// brick element systems.
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <MatrixND.h>
+
+using namespace OpenSees;
+
+// keep the compiler from hoisting a kernel out of the timing loop
+static inline void
+clobber(void *p)
+{
+  asm volatile("" : : "g"(p) : "memory");
+}
+
+static double
+seconds(clock_t start)
+{
+  return double(clock() - start)/CLOCKS_PER_SEC;
+}
+
+template <int NR, int NC>
+static void
+fill(MatrixND<NR,NC> &A)
+{
+  for (int j=0; j<NC; j++)
+    for (int i=0; i<NR; i++)
+      A(i,j) = double(rand())/RAND_MAX - 0.5;
+}
+
+template <int N>
+static void
+fillSPD(MatrixND<N,N> &A)
+{
+  MatrixND<N,N> B;
+  fill(B);
+  A.addMatrixTransposeProduct(0.0, B, B, 1.0);
+  for (int i=0; i<N; i++)
+    A(i,i) += N;
+}
+
+template <int NR, int NC>
+static double
+difference(const MatrixND<NR,NC> &A, const double *B)
+{
+  double err = 0.0;
+  for (int j=0; j<NC; j++)
+    for (int i=0; i<NR; i++)
+      err = fmax(err, fabs(A(i,j) - B[j*NR+i]));
+  return err;
+}
+
+// kg = T'*kl*T
+template <int NB, int N>
+static void
+benchTriple(int iter)
+{
+  MatrixND<NB,N>  T;
+  MatrixND<NB,NB> B;
+  MatrixND<N,N>   K;
+  fill(T);
+  fill(B);
+
+  double work[NB*N], Kb[N*N];
+  double zero = 0.0, one = 1.0;
+  int nb = NB, n = N;
+
+  clock_t start = clock();
+  for (int l=0; l<iter; l++) {
+    B(0,0) += 1.0e-12;
+    DGEMM("N", "N", &nb, &n, &nb, &one, &B(0,0), &nb, &T(0,0), &nb, &zero, work, &nb);
+    DGEMM("T", "N", &n, &n, &nb, &one, &T(0,0), &nb, work, &nb, &zero, Kb, &n);
+  }
+  double tb = seconds(start);
+
+  start = clock();
+  for (int l=0; l<iter; l++) {
+    B(0,0) -= 1.0e-12;
+    K.addMatrixTripleProduct(0.0, T, B, 1.0);
+    clobber(&K);
+  }
+  double tk = seconds(start);
+
+  DGEMM("N", "N", &nb, &n, &nb, &one, &B(0,0), &nb, &T(0,0), &nb, &zero, work, &nb);
+  DGEMM("T", "N", &n, &n, &nb, &one, &T(0,0), &nb, work, &nb, &zero, Kb, &n);
+  K.addMatrixTripleProduct(0.0, T, B, 1.0);
+
+  printf("triple  %2dx%-2d <- %2dx%-2d   blas %8.1f ns   nd %8.1f ns   err %.1e\n",
+         N, N, NB, NB, 1e9*tb/iter, 1e9*tk/iter, difference(K, Kb));
+}
+
+template <int N>
+static void
+benchSolve(int iter)
+{
+  MatrixND<N,N> A;
+  VectorND<N> b, x;
+  fill(A);
+  for (int i=0; i<N; i++)
+    b[i] = double(rand())/RAND_MAX;
+
+  double work[N*N], xb[N];
+  int piv[N], n = N, nrhs = 1, info;
+
+  clock_t start = clock();
+  for (int l=0; l<iter; l++) {
+    for (int i=0; i<N*N; i++)
+      work[i] = (&A(0,0))[i];
+    for (int i=0; i<N; i++)
+      xb[i] = b[i];
+    DGESV(&n, &nrhs, work, &n, piv, xb, &n, &info);
+  }
+  double tb = seconds(start);
+
+  start = clock();
+  for (int l=0; l<iter; l++) {
+    A.solve(b, x);
+    clobber(&x);
+  }
+  double tk = seconds(start);
+
+  double err = 0.0;
+  for (int i=0; i<N; i++)
+    err = fmax(err, fabs(x[i] - xb[i]));
+
+  printf("solve   %2dx%-2d           lapack %6.1f ns   nd %8.1f ns   err %.1e\n",
+         N, N, 1e9*tb/iter, 1e9*tk/iter, err);
+}
+
+template <int N>
+static void
+benchCholesky(int iter)
+{
+  MatrixND<N,N> A;
+  VectorND<N> b, x;
+  fillSPD(A);
+  for (int i=0; i<N; i++)
+    b[i] = double(rand())/RAND_MAX;
+
+  clock_t start = clock();
+  for (int l=0; l<iter; l++) {
+    A.solveCholesky(b, x);
+    clobber(&x);
+  }
+  double tk = seconds(start);
+
+  // residual
+  double err = 0.0;
+  for (int i=0; i<N; i++) {
+    double r = -b[i];
+    for (int j=0; j<N; j++)
+      r += A(i,j)*x[j];
+    err = fmax(err, fabs(r));
+  }
+  printf("chol    %2dx%-2d                            nd %8.1f ns   res %.1e\n",
+         N, N, 1e9*tk/iter, err);
+}
+
+template <int N>
+static void
+benchInvert(int iter)
+{
+  MatrixND<N,N> A, Ainv;
+  fill(A);
+
+  double work[N*N], lwork[N*N];
+  int piv[N], n = N, nw = N*N, info;
+
+  clock_t start = clock();
+  for (int l=0; l<iter; l++) {
+    for (int i=0; i<N*N; i++)
+      work[i] = (&A(0,0))[i];
+    DGETRF(&n, &n, work, &n, piv, &info);
+    DGETRI(&n, work, &n, piv, lwork, &nw, &info);
+  }
+  double tb = seconds(start);
+
+  start = clock();
+  for (int l=0; l<iter; l++) {
+    A.invert(Ainv);
+    clobber(&Ainv);
+  }
+  double tk = seconds(start);
+
+  printf("invert  %2dx%-2d           lapack %6.1f ns   nd %8.1f ns   err %.1e\n",
+         N, N, 1e9*tb/iter, 1e9*tk/iter, difference(Ainv, work));
+
+  if (N == 6) {
+    start = clock();
+    for (int l=0; l<iter; l++) {
+      for (int i=0; i<N*N; i++)
+        work[i] = (&A(0,0))[i];
+      cmx_inv6(work, work, &info);
+    }
+    tb = seconds(start);
+    printf("invert  %2dx%-2d           cmx    %6.1f ns   nd %8.1f ns   err %.1e\n",
+           N, N, 1e9*tb/iter, 1e9*tk/iter, difference(Ainv, work));
+  }
+}
+
+template <int N>
+static void
+benchSymeig(int iter)
+{
+  MatrixND<N,N> A, V;
+  VectorND<N> d;
+  fillSPD(A);
+
+  clock_t start = clock();
+  for (int l=0; l<iter; l++) {
+    A.symeig(d, V);
+    clobber(&V);
+  }
+  double tk = seconds(start);
+
+  // residual |A v - d v|
+  double err = 0.0;
+  for (int k=0; k<N; k++)
+    for (int i=0; i<N; i++) {
+      double r = -d[k]*V(i,k);
+      for (int j=0; j<N; j++)
+        r += A(i,j)*V(j,k);
+      err = fmax(err, fabs(r));
+    }
+  printf("symeig  %2dx%-2d                            nd %8.1f ns   res %.1e\n",
+         N, N, 1e9*tk/iter, err);
+}
+
+int main(int argc, char **argv)
+{
+  const int iter = argc > 1 ? atoi(argv[1]) : 100000;
+
+  benchTriple< 6, 7>(iter);
+  benchTriple< 7,12>(iter);
+  benchTriple<12,12>(iter);
+  benchTriple<24,24>(iter/10);
+
+  benchSolve< 6>(iter);
+  benchSolve<12>(iter);
+  benchSolve<24>(iter/10);
+
+  benchCholesky< 6>(iter);
+  benchCholesky<24>(iter/10);
+
+  benchInvert< 6>(iter);
+  benchInvert<12>(iter);
+
+  benchSymeig< 3>(iter);
+  benchSymeig< 6>(iter);
+  return 0;
+}
@@ -438,12 +438,25 @@ ElementRecorder::record(int commitTag, double timeStamp)
     //
     for (int i=0; i< numEle; i++) {
       if (theResponses[i] != 0) {
+	Information &eleInfo = theResponses[i]->getInformation();
+	eleInfo.outputWritten = false;
+
 	// ask the element for the response
 	int res;
-	if (( res = theResponses[i]->getResponse()) < 0)
+	if (( res = theResponses[i]->getResponse()) < 0) {
 	  result += res;
-	else {
-	  Information &eleInfo = theResponses[i]->getInformation();
+	  if (eleInfo.theOutput != 0)
+	    loc += eleInfo.outputSize;
+	} else if (eleInfo.theOutput != 0) {
+	  // the response was written straight into its columns of data,
+	  // unless the element filled the Information in some other way
+	  if (eleInfo.outputWritten == false) {
+	    const Vector &eleData = eleInfo.getData();
+	    for (int j=0; j<eleInfo.outputSize; j++)
+	      (*data)(loc+j) = (j < eleData.Size()) ? eleData(j) : 0.0;
+	  }
+	  loc += eleInfo.outputSize;
+	} else {
 	  const Vector &eleData = eleInfo.getData();
 	  if (numDOF == 0) {
 	    for (int j=0; j<eleData.Size(); j++)
@@ -942,6 +955,24 @@ ElementRecorder::initialize(void)
     opserr << "ElementRecorder::initialize() - out of memory\n";
     return -1;
   }
+
+  //
+  // if whole responses are recorded, have each write its data straight
+  // into its columns of the data vector
+  //
+
+  if (numDOF == 0) {
+    int loc = (echoTimeFlag == true) ? 1 : 0;
+    for (int i=0; i<numEle; i++) {
+      if (theResponses[i] != 0) {
+	Information &eleInfo = theResponses[i]->getInformation();
+	int dataSize = eleInfo.getData().Size();
+	if (dataSize > 0)
+	  eleInfo.setOutput(&(*data)(loc), dataSize);
+	loc += dataSize;
+      }
+    }
+  }
   
   theOutputHandler->tag("Data");
   initializationDone = true;
@@ -440,13 +440,26 @@ EnvelopeElementRecorder::record(int commitTag, double timeStamp)
     // for each element do a getResponse() & put the result in current data
     for (int i=0; i< numEle; i++) {
       if (theResponses[i] != 0) {
+	Information &eleInfo = theResponses[i]->getInformation();
+	eleInfo.outputWritten = false;
+
 	// ask the element for the response
 	int res;
-	if (( res = theResponses[i]->getResponse()) < 0)
+	if (( res = theResponses[i]->getResponse()) < 0) {
 	  result += res;
-	else {
+	  if (eleInfo.theOutput != 0)
+	    loc += eleInfo.outputSize;
+	} else if (eleInfo.theOutput != 0) {
+	  // the response was written straight into its part of current data,
+	  // unless the element filled the Information in some other way
+	  if (eleInfo.outputWritten == false) {
+	    const Vector &eleData = eleInfo.getData();
+	    for (int j=0; j<eleInfo.outputSize; j++)
+	      (*currentData)(loc+j) = (j < eleData.Size()) ? eleData(j) : 0.0;
+	  }
+	  loc += eleInfo.outputSize;
+	} else {
 	  // from the response determine no of cols for each
-	  Information &eleInfo = theResponses[i]->getInformation();
 	  const Vector &eleData = eleInfo.getData();
 	  //	  for (int j=0; j<eleData.Size(); j++) 
 	  //	    (*currentData)(loc++) = eleData(j);
@@ -1019,6 +1032,24 @@ EnvelopeElementRecorder::initialize(void)
     exit(-1);
   }
 
+  //
+  // if whole responses are recorded, have each write its data straight
+  // into its part of the current data
+  //
+
+  if (numDOF == 0) {
+    int loc = 0;
+    for (int i=0; i<numEle; i++) {
+      if (theResponses[i] != 0) {
+	Information &eleInfo = theResponses[i]->getInformation();
+	int dataSize = eleInfo.getData().Size();
+	if (dataSize > 0)
+	  eleInfo.setOutput(&(*currentData)(loc), dataSize);
+	loc += dataSize;
+      }
+    }
+  }
+
   initializationDone = true;  
   return 0;
 }
@@ -53,7 +53,7 @@
 
 NodeRecorder::NodeRecorder()
 :Recorder(RECORDER_TAGS_NodeRecorder),
- theDofs(0), theNodalTags(0), theNodes(0), response(0),
+ theDofs(0), theNodalTags(0), theNodes(0), theNodalResponses(0), response(0),
  theDomain(0), theOutputHandler(0),
  echoTimeFlag(true), dataFlag(NodeData::DisplTrial), 
  deltaT(0), nextTimeStampToRecord(0.0), 
@@ -76,7 +76,7 @@ NodeRecorder::NodeRecorder(const ID &dofs,
                            bool timeFlag,
                            TimeSeries **theSeries)
 :Recorder(RECORDER_TAGS_NodeRecorder),
- theDofs(0), theNodalTags(0), theNodes(0), response(0),
+ theDofs(0), theNodalTags(0), theNodes(0), theNodalResponses(0), response(0),
  theDomain(&theDom), theOutputHandler(&theOutput),
  echoTimeFlag(timeFlag), dataFlag(_dataFlag), dataIndex(_dataIndex),
  deltaT(dT), relDeltaTTol(relDeltaTTol), nextTimeStampToRecord(0.0), 
@@ -172,6 +172,9 @@ NodeRecorder::~NodeRecorder()
 
   if (theNodes != nullptr)
     delete [] theNodes;
+
+  if (theNodalResponses != nullptr)
+    delete [] theNodalResponses;
 }
 
 
@@ -234,7 +237,22 @@ NodeRecorder::record(int commitTag, double timeStamp)
     //
     // now we go get the responses from the nodes & place them in disp vector
     //
-    if (dataFlag != NodeData::Empty) { // != 10
+    if (theNodalResponses != nullptr) {
+
+      // the responses are read straight from the nodes' response vectors
+      for (int i=0; i<numValidNodes; i++) {
+	const Vector &theResponse = *theNodalResponses[i];
+	int cnt = i*numDOF + timeOffset;
+	for (int j=0; j<numDOF; j++) {
+	  int dof = (*theDofs)(j);
+	  response(cnt++) = (theResponse.Size() > dof) ? theResponse(dof) : 0.0;
+	}
+      }
+
+      // insert the data into the database
+      theOutputHandler->write(response);
+
+    } else if (dataFlag != NodeData::Empty) { // != 10
 
       for (int i=0; i<numValidNodes; i++) {
 
@@ -820,6 +838,37 @@ NodeRecorder::initialize(void)
   response.resize(numValidResponse);
   response.Zero();
 
+  //
+  // responses the nodes hold in vectors of their own, that stay in place
+  // for the life of the node, are read through pointers to those vectors
+  //
+
+  if (theNodalResponses != 0) {
+    delete [] theNodalResponses;
+    theNodalResponses = 0;
+  }
+
+  if (theTimeSeries == nullptr && gradIndex < 0 &&
+      (dataFlag == NodeData::DisplTrial || dataFlag == NodeData::VelocTrial ||
+       dataFlag == NodeData::AccelTrial || dataFlag == NodeData::IncrDisp ||
+       dataFlag == NodeData::IncrDeltaDisp)) {
+
+    theNodalResponses = new const Vector *[numValidNodes];
+    for (int i=0; i<numValidNodes; i++) {
+      Node *theNode = theNodes[i];
+      if (dataFlag == NodeData::DisplTrial)
+	theNodalResponses[i] = &theNode->getTrialDisp();
+      else if (dataFlag == NodeData::VelocTrial)
+	theNodalResponses[i] = &theNode->getTrialVel();
+      else if (dataFlag == NodeData::AccelTrial)
+	theNodalResponses[i] = &theNode->getTrialAccel();
+      else if (dataFlag == NodeData::IncrDisp)
+	theNodalResponses[i] = &theNode->getIncrDisp();
+      else
+	theNodalResponses[i] = &theNode->getIncrDeltaDisp();
+    }
+  }
+
   ID orderResponse(numValidResponse);
 
   //
@@ -82,6 +82,7 @@ class NodeRecorder: public Recorder
     ID *theDofs;
     ID *theNodalTags;
     Node **theNodes;
+    const Vector **theNodalResponses;  // the nodes' own response vectors, if read directly
     Vector response;
 
     Domain *theDomain;
@@ -23,6 +23,7 @@
 // Save all data into paraview format
 
 #include "PVDRecorder.h"
+#include "VtuBinaryWriter.h"
 #include <sstream>
 #include <elementAPI.h>
 #include <OPS_Globals.h>
@@ -62,6 +63,7 @@ OPS_ADD_RUNTIME_VPV(OPS_PVDRecorder)
     std::vector<PVDRecorder::EleData> eledata;
     double dT = 0.0;
     double rTolDt = 0.00001;
+    bool binary = false;
     while(numdata > 0) {
 	const char* type = OPS_GetString();
 	if(strcmp(type, "disp") == 0) {
@@ -141,35 +143,49 @@ OPS_ADD_RUNTIME_VPV(OPS_PVDRecorder)
 		return 0;
 	    }
 	    if (rTolDt < 0) rTolDt = 0;
+	} else if(strcmp(type, "-binary") == 0) {
+	    binary = true;
 	}
 	numdata = OPS_GetNumRemainingInputArgs();
     }
 
     // create recorder
-    return new PVDRecorder(name,nodedata,eledata,indent,precision,dT, rTolDt);
+    return new PVDRecorder(name,nodedata,eledata,indent,precision,dT, rTolDt, binary);
 }
 
 PVDRecorder::PVDRecorder(const char *name, const NodeData& ndata,
 			 const std::vector<EleData>& edata, int ind, int pre,
-			 double dt, double rTolDt)
+			 double dt, double rTolDt, bool bin)
     :Recorder(RECORDER_TAGS_PVDRecorder), indentsize(ind), precision(pre),
      indentlevel(0), pathname(), basename(),
      timestep(), timeparts(), theFile(), quota('\"'), parts(),
      nodedata(ndata), eledata(edata), theDomain(0), partnum(),
-     dT(dt), relDeltaTTol(rTolDt), nextTime(0.0)
+     dT(dt), relDeltaTTol(rTolDt), nextTime(0.0),
+     binary(bin), lastDomainStamp(-1), binaryParts()
 {
     PVDRecorder::setVTKType();
     getfilename(name);
 }
 
 PVDRecorder::PVDRecorder()
-    :Recorder(RECORDER_TAGS_PVDRecorder)
+    :Recorder(RECORDER_TAGS_PVDRecorder),
+     binary(false), lastDomainStamp(-1), binaryParts()
 {
 }
 
 
 PVDRecorder::~PVDRecorder()
 {
+    this->clearBinaryParts();
+}
+
+void
+PVDRecorder::clearBinaryParts()
+{
+    // deleting a writer waits for its pending files
+    for (auto& part : binaryParts)
+	delete part.second.writer;
+    binaryParts.clear();
 }
 
 // PVD
@@ -308,6 +324,15 @@ PVDRecorder::vtu()
     // get parts
     this->getParts();
 
+    // cached binary meshes are only valid while the domain is unchanged
+    if (binary) {
+	int stamp = theDomain->hasDomainChanged();
+	if (stamp != lastDomainStamp) {
+	    this->clearBinaryParts();
+	    lastDomainStamp = stamp;
+	}
+    }
+
     // get background mesh
     VInt gtags;
     TaggedObjectIter& meshes = OPS_getAllMesh();
@@ -345,7 +370,11 @@ PVDRecorder::vtu()
 	// }
 	int no = partno.Size();
 	partno[no] = no;
-	if(this->savePart(no,it->first,nodendf) < 0) return -1;
+	if (binary) {
+	    if(this->savePartBinary(no,it->first,nodendf) < 0) return -1;
+	} else {
+	    if(this->savePart(no,it->first,nodendf) < 0) return -1;
+	}
     }
 
 
@@ -1785,6 +1814,241 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
     return 0;
 }
 
+int
+PVDRecorder::savePartBinary(int partno, int ctag, int nodendf)
+{
+    if (theDomain == 0) {
+	opserr<<"WARNING: setDomain has not been called -- PVDRecorder\n";
+	return -1;
+    }
+
+    // get time and part
+    std::stringstream ss;
+    ss.precision(precision);
+    ss << std::scientific;
+    ss << partno << ' ' << timestep.back();
+    std::string stime, spart;
+    ss >> spart >> stime;
+    std::string vtuname = pathname+basename+"/"+basename+"_T"+stime+"_P"+spart+".vtu";
+
+    const ID& eletags = parts[ctag];
+    if (eletags.Size() == 0)
+	return 0;
+
+    std::map<int,BinaryPart>::iterator found = binaryParts.find(ctag);
+    if (found != binaryParts.end() && found->second.eletags != eletags) {
+	delete found->second.writer;
+	binaryParts.erase(found);
+	found = binaryParts.end();
+    }
+
+    // encode the mesh of this part once
+    if (found == binaryParts.end()) {
+	BinaryPart part;
+	part.eletags = eletags;
+
+	std::vector<Element*> eles(eletags.Size());
+	ID ndtags(0,eletags.Size()*3);
+	int numelenodes = 0;
+	int increlenodes = 1;
+	for(int i=0; i<eletags.Size(); i++) {
+	    eles[i] = theDomain->getElement(eletags(i));
+	    if (eles[i] == 0) {
+		opserr<<"WARNING: element "<<eletags(i)<<" is not defined--pvdRecorder\n";
+		return -1;
+	    }
+	    const ID& elenodes = eles[i]->getExternalNodes();
+	    if(numelenodes == 0) {
+		numelenodes = elenodes.Size();
+		if(ctag==ELE_TAG_PFEMElement2D||
+		   ctag==ELE_TAG_PFEMElement2DCompressible||
+		   ctag==ELE_TAG_PFEMElement2DBubble||
+		   ctag==ELE_TAG_PFEMElement2Dmini ||
+		   ctag==ELE_TAG_MINI ||
+		   ctag==ELE_TAG_PFEMElement2DQuasi) {
+		    numelenodes = 3;
+		    increlenodes = 2;
+		} else if (ctag==ELE_TAG_TaylorHood2D) {
+		    numelenodes = 6;
+		    increlenodes = 1;
+		} else if (ctag==ELE_TAG_PFEMElement3DBubble) {
+		    numelenodes = 4;
+		    increlenodes = 2;
+		}
+	    }
+	    for(int j=0; j<numelenodes; j++) {
+		ndtags.insert(elenodes(j*increlenodes));
+	    }
+	}
+
+	int type = vtktypes[ctag];
+	if (type == 0) {
+	    opserr<<"WARNING: the element type cannot be assigned a VTK type\n";
+	    return -1;
+	}
+
+	part.writer = new VtuBinaryWriter();
+	VtuBinaryWriter& writer = *part.writer;
+	writer.beginMesh(ndtags.Size(), eletags.Size());
+
+	double* points = writer.points();
+	part.nodes.resize(ndtags.Size());
+	for(int i=0; i<ndtags.Size(); i++) {
+	    part.nodes[i] = theDomain->getNode(ndtags(i));
+	    if(part.nodes[i] == 0) {
+		opserr<<"WARNING: Node "<<ndtags(i)<<" is not defined -- pvdRecorder\n";
+		delete part.writer;
+		return -1;
+	    }
+	    const Vector& crds = part.nodes[i]->getCrds();
+	    for(int j=0; j<3 && j<crds.Size(); j++) {
+		points[3*i+j] = crds(j);
+	    }
+	}
+
+	// for 2nd order element, the order of mid nodes is different to VTK
+	int vtkOrder[] = {0,1,2,5,3,4};
+	std::vector<int64_t> cell(numelenodes);
+	for(int i=0; i<eletags.Size(); i++) {
+	    const ID& elenodes = eles[i]->getExternalNodes();
+	    for(int j=0; j<numelenodes; j++) {
+		int k = ctag==ELE_TAG_TaylorHood2D ? vtkOrder[j] : j;
+		cell[j] = ndtags.getLocationOrdered(elenodes(k*increlenodes));
+	    }
+	    writer.addCell(cell.data(), numelenodes, (uint8_t)type);
+	}
+
+	std::vector<int64_t> tags(ndtags.Size());
+	for(int i=0; i<ndtags.Size(); i++) tags[i] = ndtags(i);
+	writer.addStaticPointData("NodeTag", tags);
+	tags.resize(eletags.Size());
+	for(int i=0; i<eletags.Size(); i++) tags[i] = eletags(i);
+	writer.addStaticCellData("ElementTag", tags);
+	writer.endMesh();
+
+	found = binaryParts.insert(std::make_pair(ctag, part)).first;
+    }
+
+    VtuBinaryWriter& writer = *found->second.writer;
+    const std::vector<Node*>& nodes = found->second.nodes;
+    int numNodes = (int)nodes.size();
+
+    // copy the leading components of v into row i of a numComp-wide array
+    auto gather = [](double* data, int i, int numComp, const Vector& v, int size) {
+	for(int j=0; j<numComp && j<size; j++) {
+	    data[numComp*i+j] = v(j);
+	}
+    };
+
+    // point data
+    if(nodedata.vel) {
+	double* data = writer.pointData("Velocity", nodendf);
+	for(int i=0; i<numNodes; i++) {
+	    const Vector& v = nodes[i]->getTrialVel();
+	    gather(data, i, nodendf, v, v.Size());
+	}
+    }
+    if(nodedata.disp) {
+	double* data = writer.pointData("Displacement", 3);
+	for(int i=0; i<numNodes; i++) {
+	    const Vector& v = nodes[i]->getTrialDisp();
+	    int size = nodes[i]->getCrds().Size();
+	    gather(data, i, 3, v, size < v.Size() ? size : v.Size());
+	}
+    }
+    if(nodedata.incrdisp) {
+	double* data = writer.pointData("IncrDisplacement", nodendf);
+	for(int i=0; i<numNodes; i++) {
+	    const Vector& v = nodes[i]->getIncrDisp();
+	    gather(data, i, nodendf, v, v.Size());
+	}
+    }
+    if(nodedata.accel) {
+	double* data = writer.pointData("Acceleration", nodendf);
+	for(int i=0; i<numNodes; i++) {
+	    const Vector& v = nodes[i]->getTrialAccel();
+	    gather(data, i, nodendf, v, v.Size());
+	}
+    }
+    if(nodedata.pressure) {
+	double* data = writer.pointData("Pressure", 1);
+	for(int i=0; i<numNodes; i++) {
+	    Pressure_Constraint* thePC = theDomain->getPressure_Constraint(nodes[i]->getTag());
+	    if(thePC != 0) {
+		data[i] = thePC->getPressure();
+	    }
+	}
+    }
+    if(nodedata.reaction) {
+	double* data = writer.pointData("Reaction", nodendf);
+	for(int i=0; i<numNodes; i++) {
+	    const Vector& v = nodes[i]->getReaction();
+	    gather(data, i, nodendf, v, v.Size());
+	}
+    }
+    if(nodedata.unbalanced) {
+	double* data = writer.pointData("UnbalancedLoad", nodendf);
+	for(int i=0; i<numNodes; i++) {
+	    const Vector& v = nodes[i]->getUnbalancedLoad();
+	    gather(data, i, nodendf, v, v.Size());
+	}
+    }
+    if(nodedata.mass) {
+	double* data = writer.pointData("NodeMass", nodendf);
+	for(int i=0; i<numNodes; i++) {
+	    const Matrix& mat = nodes[i]->getMass();
+	    for(int j=0; j<nodendf && j<mat.noRows(); j++) {
+		data[nodendf*i+j] = mat(j,j);
+	    }
+	}
+    }
+    for(int k=0; k<nodedata.numeigen; k++) {
+	std::stringstream name;
+	name << "EigenVector" << k+1;
+	double* data = writer.pointData(name.str().c_str(), nodendf);
+	for(int i=0; i<numNodes; i++) {
+	    const Matrix& eigens = nodes[i]->getEigenvectors();
+	    if(k >= eigens.noCols()) {
+		opserr<<"WARNING: eigenvector "<<k+1<<" is too large\n";
+		return -1;
+	    }
+	    for(int j=0; j<nodendf && j<eigens.noRows(); j++) {
+		data[nodendf*i+j] = eigens(j,k);
+	    }
+	}
+    }
+
+    // element response
+    for(int i=0; i<(int)eledata.size(); i++) {
+	int argc = (int)eledata[i].size();
+	if(argc == 0) continue;
+	std::vector<const char*> argv(argc);
+	for(int j=0; j<argc; j++) {
+	    argv[j] = eledata[i][j].c_str();
+	}
+	const Vector* data =theDomain->getElementResponse(eletags(0),&(argv[0]),argc);
+	if(data==0) continue;
+	int eressize = data->Size();
+	if(eressize == 0) continue;
+
+	std::string name = theDomain->getElement(eletags(0))->getClassType();
+	for(int j=0; j<argc; j++) {
+	    name += argv[j];
+	}
+	double* cells = writer.cellData(name.c_str(), eressize);
+	for(int j=0; j<eletags.Size(); j++) {
+	    data=theDomain->getElementResponse(eletags(j),&(argv[0]),argc);
+	    if(data==0) {
+		opserr<<"WARNING: can't get response for element "<<eletags(j)<<"\n";
+		return -1;
+	    }
+	    gather(cells, j, eressize, *data, data->Size());
+	}
+    }
+
+    return writer.write(vtuname);
+}
+
 void
 PVDRecorder::indent() {
     for(int i=0; i<indentlevel*indentsize; i++) {
@@ -2042,5 +2306,12 @@ int PVDRecorder::flush(void) {
   if (theFile.is_open() && theFile.good()) {
     theFile.flush();
   }
-  return 0;
+  int res = 0;
+  for (auto& part : binaryParts) {
+    if (part.second.writer->flush() != 0) {
+      opserr << "WARNING: PVDRecorder failed to write a vtu file\n";
+      res = -1;
+    }
+  }
+  return res;
 }
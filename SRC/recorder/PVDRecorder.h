@@ -39,6 +39,7 @@
 
 class Node;
 class Element;
+class VtuBinaryWriter;
 
 class PVDRecorder: public Recorder
 {
@@ -54,7 +55,8 @@ public:
     
 public:
     PVDRecorder(const char *filename, const NodeData& ndata,
-		const std::vector<EleData>& edata, int ind=2, int pre=10, double dt=0, double relDeltaTTol = 0.00001);
+		const std::vector<EleData>& edata, int ind=2, int pre=10, double dt=0, double relDeltaTTol = 0.00001,
+		bool binary=false);
     PVDRecorder();
     ~PVDRecorder();
 
@@ -80,6 +82,7 @@ private:
     virtual int savePart(int partno, int ctag, int ndf);
     virtual int savePart0(int ndf);
     virtual int savePartParticle(int partno, int gtag, int ndf);
+    virtual int savePartBinary(int partno, int ctag, int ndf);
     void getfilename(const char* name);
     
 private:
@@ -97,6 +100,18 @@ private:
     double dT, nextTime;
     double relDeltaTTol;
 
+    // appended-raw output; one writer per element class, each
+    // caching its mesh until the domain changes
+    struct BinaryPart {
+	VtuBinaryWriter* writer;
+	std::vector<Node*> nodes;
+	ID eletags;
+    };
+    bool binary;
+    int  lastDomainStamp;
+    std::map<int,BinaryPart> binaryParts;
+    void clearBinaryParts();
+
 public:
     enum VtkType {
 	VTK_VERTEX=1,VTK_POLY_VERTEX=2,VTK_LINE=3,VTK_POLY_LINE=4,
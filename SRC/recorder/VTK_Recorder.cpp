@@ -21,6 +21,7 @@
 // Save all data into paraview format
 //
 #include "VTK_Recorder.h"
+#include "VtuBinaryWriter.h"
 #include <sstream>
 #include <elementAPI.h>
 #include <OPS_Globals.h>
@@ -85,8 +86,10 @@ VTK_Recorder::OutputData::operator=(const VTK_Recorder::OutputData &other)
     reaction = other.reaction;
     reaction2 = other.reaction2;
     reaction3 = other.reaction3;
+    mass = other.mass;
+    unbalancedLoad = other.unbalancedLoad;
     for (int i=0; i<10; i++) {
-      modes[i] = 0;
+      modes[i] = other.modes[i];
     }
   }
   return *this;
@@ -116,6 +119,7 @@ OPS_ADD_RUNTIME_VPV(OPS_VTK_Recorder)
     std::vector<VTK_Recorder::EleData> eledata;
     double dT = 0.0;
     double rTolDt = 0.00001;
+    bool binary = false;
 
     while(numdata > 0) {
 	const char* type = OPS_GetString();
@@ -223,18 +227,21 @@ OPS_ADD_RUNTIME_VPV(OPS_VTK_Recorder)
 		return 0;
 	    }
 	    if (rTolDt < 0) rTolDt = 0;
+	} else if(strcmp(type, "-binary") == 0) {
+	    binary = true;
 	}
 	numdata = OPS_GetNumRemainingInputArgs();
     }
 
     // create recorder
-    return new VTK_Recorder(name,outputData,eledata,indent,precision,dT, rTolDt);
+    return new VTK_Recorder(name,outputData,eledata,indent,precision,dT, rTolDt, binary);
 }
 
 VTK_Recorder::VTK_Recorder(const char *inputName, 
 			   const OutputData& outData,
 			   const std::vector<EleData>& edata, 
-			   int ind, int pre, double dt, double rTolDt)
+			   int ind, int pre, double dt, double rTolDt,
+			   bool binary)
     :Recorder(RECORDER_TAGS_VTK_Recorder), 
      indentsize(ind), 
      precision(pre),
@@ -245,10 +252,12 @@ VTK_Recorder::VTK_Recorder(const char *inputName,
      deltaT(dt),
      relDeltaTTol(rTolDt),
      counter(0),
+     theWriter(binary ? new VtuBinaryWriter() : nullptr),
      initializationDone(false),
      sendSelfCount(0)
 {
   outputData = outData;
+  eledata = edata;
 
   name = new char[strlen(inputName+1)];
   strcpy(name, inputName);
@@ -309,6 +318,7 @@ VTK_Recorder::VTK_Recorder()
    deltaT(0.0),
    relDeltaTTol(0.00001),
    counter(0),
+   theWriter(nullptr),
    initializationDone(false),
    sendSelfCount(0)   
 {
@@ -326,6 +336,10 @@ VTK_Recorder::VTK_Recorder()
 
 VTK_Recorder::~VTK_Recorder()
 {
+  // wait for pending files
+  if (theWriter != nullptr)
+    delete theWriter;
+
   //
   // write out last bits and close the vtd file
   //
@@ -412,6 +426,12 @@ VTK_Recorder::vtu()
   }
   
   counter ++;
+
+  if (theWriter != nullptr) {
+    int res = this->vtuBinary(filename);
+    delete [] filename;
+    return res;
+  }
   
   std::ofstream theFileVTU;
   theFileVTU.open(filename, std::ios::out);
@@ -893,6 +913,148 @@ VTK_Recorder::vtu()
     return 0;
 }
 
+int
+VTK_Recorder::vtuBinary(const char *filename)
+{
+  VtuBinaryWriter &writer = *theWriter;
+
+  //
+  // mesh - encoded once and reused until the domain changes
+  //
+  if (!writer.hasMesh()) {
+    writer.beginMesh(numNode, numElement);
+
+    double *points = writer.points();
+    for (int i=0; i<numNode; i++) {
+      const Vector &crd = theDomain->getNode(theNodeTags[i])->getCrds();
+      for (int j=0; j<crd.Size() && j<3; j++)
+	points[3*i+j] = crd(j);
+    }
+
+    std::vector<int64_t> cell;
+    for (int i=0; i<numElement; i++) {
+      const ID &theNodes = theDomain->getElement(theEleTags[i])->getExternalNodes();
+      cell.resize(theNodes.Size());
+      for (int j=0; j<theNodes.Size(); j++)
+	cell[j] = theNodeMapping[theNodes(j)];
+      writer.addCell(cell.data(), (int)cell.size(), (uint8_t)theEleVtkTags[i]);
+    }
+
+    writer.addStaticPointData("Node Tag",
+        std::vector<int64_t>(theNodeTags.begin(), theNodeTags.end()));
+    writer.addStaticCellData("Element Tag",
+        std::vector<int64_t>(theEleTags.begin(), theEleTags.end()));
+    writer.addStaticCellData("Element Class",
+        std::vector<int64_t>(theEleClassTags.begin(), theEleClassTags.end()));
+    writer.endMesh();
+  }
+
+  //
+  // point data
+  //
+  enum {Disp, Vel, Accel, Reaction, Unbalance};
+  struct {
+    bool flag; const char *name; int numComp; int kind;
+  } nodal[] = {
+    {outputData.disp,           "Disp",           maxNDF, Disp},
+    {outputData.disp2,          "Disp2",          2,      Disp},
+    {outputData.disp3,          "Disp3",          3,      Disp},
+    {outputData.vel,            "Vel",            maxNDF, Vel},
+    {outputData.vel2,           "Vel2",           2,      Vel},
+    {outputData.vel3,           "Vel3",           3,      Vel},
+    {outputData.accel,          "Accel",          maxNDF, Accel},
+    {outputData.accel2,         "Accel2",         2,      Accel},
+    {outputData.accel3,         "Accel3",         3,      Accel},
+    {outputData.reaction,       "Reaction",       maxNDF, Reaction},
+    {outputData.reaction2,      "Reaction2",      2,      Reaction},
+    {outputData.reaction3,      "Reaction3",      3,      Reaction},
+    {outputData.unbalancedLoad, "UnbalancedLoad", maxNDF, Unbalance}
+  };
+
+  if (outputData.reaction || outputData.reaction2 || outputData.reaction3)
+    theDomain->calculateNodalReactions(0);
+
+  for (auto &field : nodal) {
+    if (!field.flag)
+      continue;
+    double *data = writer.pointData(field.name, field.numComp);
+    for (int i=0; i<numNode; i++) {
+      Node *theNode = theDomain->getNode(theNodeTags[i]);
+      const Vector &output = field.kind == Disp     ? theNode->getDisp()
+                           : field.kind == Vel      ? theNode->getVel()
+                           : field.kind == Accel    ? theNode->getAccel()
+                           : field.kind == Reaction ? theNode->getReaction()
+                           :                          theNode->getUnbalancedLoad();
+      int n = output.Size() < field.numComp ? output.Size() : field.numComp;
+      for (int j=0; j<n; j++)
+	data[field.numComp*i+j] = output(j);
+    }
+  }
+
+  if (outputData.mass) {
+    double *data = writer.pointData("Mass", maxNDF);
+    for (int i=0; i<numNode; i++) {
+      const Matrix &mass = theDomain->getNode(theNodeTags[i])->getMass();
+      for (int j=0; j<mass.noRows() && j<maxNDF; j++)
+	data[maxNDF*i+j] = mass(j,j);
+    }
+  }
+
+  for (int k=0; k<10; k++) {
+    int mode = outputData.modes[k];
+    if (mode <= 0 || (k > 0 && mode == outputData.modes[k-1]))
+      continue;
+    std::string name = "EigenVector" + std::to_string(mode);
+    double *data = writer.pointData(name.c_str(), maxNDF);
+    for (int i=0; i<numNode; i++) {
+      const Matrix &eigens = theDomain->getNode(theNodeTags[i])->getEigenvectors();
+      if (mode > eigens.noCols()) {
+	opserr << "WARNING: eigenvector " << mode << " is not available\n";
+	return -1;
+      }
+      for (int j=0; j<eigens.noRows() && j<maxNDF; j++)
+	data[maxNDF*i+j] = eigens(j,mode-1);
+    }
+  }
+
+  //
+  // cell data - the size of each response is taken from the first element
+  //
+  for (const EleData &edata : eledata) {
+    int argc = (int)edata.size();
+    if (argc == 0 || numElement == 0)
+      continue;
+    std::vector<const char *> argv(argc);
+    for (int j=0; j<argc; j++)
+      argv[j] = edata[j].c_str();
+
+    const Vector *response = theDomain->getElementResponse(theEleTags[0], argv.data(), argc);
+    if (response == nullptr || response->Size() == 0)
+      continue;
+    int numComp = response->Size();
+
+    std::string name;
+    for (int j=0; j<argc; j++)
+      name += edata[j];
+    double *data = writer.cellData(name.c_str(), numComp);
+    for (int i=0; i<numElement; i++) {
+      response = theDomain->getElementResponse(theEleTags[i], argv.data(), argc);
+      if (response == nullptr) {
+	opserr << "WARNING: can't get response for element " << theEleTags[i] << "\n";
+	return -1;
+      }
+      for (int j=0; j<numComp && j<response->Size(); j++)
+	data[numComp*i+j] = (*response)(j);
+    }
+  }
+
+  if (writer.write(filename) != 0) {
+    opserr << "WARNING: Failed to write file " << filename << "\n";
+    return -1;
+  }
+  return 0;
+}
+
 void
 VTK_Recorder::indent() {
     for(int i=0; i<indentlevel*indentsize; i++) {
@@ -1212,6 +1374,10 @@ VTK_Recorder::initialize()
   theEleVtkTags.clear();
   theEleVtkOffsets.clear();
 
+  // the cached binary mesh is rebuilt on the next record
+  if (theWriter != nullptr)
+    theWriter->clearMesh();
+
 
   //
   // create a list of node tags and a mapping for node tags to vtk points
@@ -1304,6 +1470,10 @@ int VTK_Recorder::flush(void) {
   if (thePVDFile.is_open() && thePVDFile.good()) {
     thePVDFile.flush();
   }
+  if (theWriter != nullptr && theWriter->flush() != 0) {
+    opserr << "WARNING: VTK_Recorder failed to write a vtu file\n";
+    return -1;
+  }
   if (theVTUFile.is_open() && theVTUFile.good()) {
     theVTUFile.flush();
   }
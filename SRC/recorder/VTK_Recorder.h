@@ -39,6 +39,7 @@
 
 class Node;
 class Element;
+class VtuBinaryWriter;
 
 
 class VTK_Recorder: public Recorder
@@ -69,7 +70,8 @@ public:
   typedef std::vector<std::string> EleData;
     
   VTK_Recorder(const char *filename, const OutputData& ndata,
-	       const std::vector<EleData>& edata, int ind=2, int pre=10, double dt=0, double rTolDt=0.00001);
+	       const std::vector<EleData>& edata, int ind=2, int pre=10, double dt=0, double rTolDt=0.00001,
+	       bool binary=false);
   VTK_Recorder();
   ~VTK_Recorder();
   
@@ -86,6 +88,7 @@ public:
   bool initDone;
   
   virtual int vtu();
+  virtual int vtuBinary(const char *filename);
   virtual void addEleData(const EleData& edata) {eledata.push_back(edata);}
   std::vector<EleData> eledata;
   
@@ -113,6 +116,10 @@ public:
   
   std::ofstream thePVDFile;
   std::ofstream theVTUFile;
+
+  // appended-raw output; mesh is encoded once and files are
+  // written on a background thread
+  VtuBinaryWriter *theWriter;
   
   std::map<int,int>theNodeMapping; // output requires points indexed at 0
   std::map<int,int>theEleMapping; // output requires points indexed at 0
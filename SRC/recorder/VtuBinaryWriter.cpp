@@ -0,0 +1,318 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: Appended-raw VTU writer with a cached mesh block and
+// a background writer thread. See VtuBinaryWriter.h
+//
+#include "VtuBinaryWriter.h"
+#include <stdio.h>
+#include <sstream>
+#include <OPS_Globals.h>
+
+static const char *
+byteOrder()
+{
+    const uint16_t one = 1;
+    return *reinterpret_cast<const uint8_t*>(&one) == 1 ? "LittleEndian" : "BigEndian";
+}
+
+VtuBinaryWriter::VtuBinaryWriter(int pending)
+  : maxPending(pending > 0 ? pending : 1),
+    busy(false), done(false), failed(false)
+{
+}
+
+VtuBinaryWriter::~VtuBinaryWriter()
+{
+    {
+      std::unique_lock<std::mutex> lock(theMutex);
+      done = true;
+    }
+    queueChanged.notify_all();
+    if (theThread.joinable())
+      theThread.join();
+}
+
+void
+VtuBinaryWriter::appendRaw(std::string &block, const void *data, uint64_t nbytes)
+{
+    // Each appended array is preceded by its size in bytes (header_type UInt64)
+    block.append(reinterpret_cast<const char*>(&nbytes), sizeof(uint64_t));
+    if (nbytes > 0)
+      block.append(reinterpret_cast<const char*>(data), nbytes);
+}
+
+void
+VtuBinaryWriter::beginMesh(int numPoints, int numCells)
+{
+    theMesh = std::make_shared<Mesh>();
+    theMesh->numPoints = numPoints;
+    theMesh->numCells  = numCells;
+
+    thePoints.assign(3*(size_t)numPoints, 0.0);
+    theConnectivity.clear();
+    theOffsets.clear();
+    theOffsets.reserve(numCells);
+    theTypes.clear();
+    theTypes.reserve(numCells);
+}
+
+double *
+VtuBinaryWriter::points()
+{
+    return thePoints.data();
+}
+
+void
+VtuBinaryWriter::addCell(const int64_t *nodes, int n, uint8_t vtkType)
+{
+    theConnectivity.insert(theConnectivity.end(), nodes, nodes+n);
+    theOffsets.push_back((int64_t)theConnectivity.size());
+    theTypes.push_back(vtkType);
+}
+
+void
+VtuBinaryWriter::addStaticPointData(const char *name, const std::vector<int64_t> &data)
+{
+    Array array;
+    array.name    = name;
+    array.type    = "Int64";
+    array.numComp = 1;
+    array.offset  = theMesh->block.size();
+    appendRaw(theMesh->block, data.data(), data.size()*sizeof(int64_t));
+    theMesh->pointArrays.push_back(std::move(array));
+}
+
+void
+VtuBinaryWriter::addStaticCellData(const char *name, const std::vector<int64_t> &data)
+{
+    Array array;
+    array.name    = name;
+    array.type    = "Int64";
+    array.numComp = 1;
+    array.offset  = theMesh->block.size();
+    appendRaw(theMesh->block, data.data(), data.size()*sizeof(int64_t));
+    theMesh->cellArrays.push_back(std::move(array));
+}
+
+void
+VtuBinaryWriter::endMesh()
+{
+    std::string &block = theMesh->block;
+
+    theMesh->pointsOffset = block.size();
+    appendRaw(block, thePoints.data(), thePoints.size()*sizeof(double));
+
+    theMesh->connOffset = block.size();
+    appendRaw(block, theConnectivity.data(), theConnectivity.size()*sizeof(int64_t));
+
+    theMesh->offsetsOffset = block.size();
+    appendRaw(block, theOffsets.data(), theOffsets.size()*sizeof(int64_t));
+
+    theMesh->typesOffset = block.size();
+    appendRaw(block, theTypes.data(), theTypes.size()*sizeof(uint8_t));
+
+    // release the staging arrays; the encoded block is all that is kept
+    std::vector<double>().swap(thePoints);
+    std::vector<int64_t>().swap(theConnectivity);
+    std::vector<int64_t>().swap(theOffsets);
+    std::vector<uint8_t>().swap(theTypes);
+}
+
+double *
+VtuBinaryWriter::pointData(const char *name, int numComp)
+{
+    Array array;
+    array.name    = name;
+    array.type    = "Float64";
+    array.numComp = numComp;
+    array.offset  = 0;
+    array.data.assign((size_t)numComp*theMesh->numPoints, 0.0);
+    stepPointArrays.push_back(std::move(array));
+    return stepPointArrays.back().data.data();
+}
+
+double *
+VtuBinaryWriter::cellData(const char *name, int numComp)
+{
+    Array array;
+    array.name    = name;
+    array.type    = "Float64";
+    array.numComp = numComp;
+    array.offset  = 0;
+    array.data.assign((size_t)numComp*theMesh->numCells, 0.0);
+    stepCellArrays.push_back(std::move(array));
+    return stepCellArrays.back().data.data();
+}
+
+int
+VtuBinaryWriter::write(const std::string &filename)
+{
+    if (theMesh == nullptr) {
+      opserr << "WARNING VtuBinaryWriter::write - mesh has not been set\n";
+      return -1;
+    }
+
+    Job job;
+    job.filename    = filename;
+    job.mesh        = theMesh;
+    job.pointArrays = std::move(stepPointArrays);
+    job.cellArrays  = std::move(stepCellArrays);
+    stepPointArrays.clear();
+    stepCellArrays.clear();
+
+    std::unique_lock<std::mutex> lock(theMutex);
+
+    if (!theThread.joinable())
+      theThread = std::thread(&VtuBinaryWriter::run, this);
+
+    // Bound the memory held by pending steps
+    queueChanged.wait(lock, [this]{return (int)theQueue.size() < maxPending;});
+    theQueue.push_back(std::move(job));
+    int status = failed ? -1 : 0;
+    lock.unlock();
+    queueChanged.notify_all();
+
+    return status;
+}
+
+int
+VtuBinaryWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(theMutex);
+    queueChanged.wait(lock, [this]{return theQueue.empty() && !busy;});
+    if (failed) {
+      failed = false;
+      return -1;
+    }
+    return 0;
+}
+
+void
+VtuBinaryWriter::run()
+{
+    std::unique_lock<std::mutex> lock(theMutex);
+    while (true) {
+      queueChanged.wait(lock, [this]{return done || !theQueue.empty();});
+      if (theQueue.empty())
+        return;
+
+      Job job = std::move(theQueue.front());
+      theQueue.pop_front();
+      busy = true;
+      lock.unlock();
+      queueChanged.notify_all();
+
+      int status = writeJob(job);
+
+      lock.lock();
+      busy = false;
+      if (status != 0)
+        failed = true;
+      queueChanged.notify_all();
+    }
+}
+
+int
+VtuBinaryWriter::writeJob(const Job &job)
+{
+    const Mesh &mesh = *job.mesh;
+
+    // Per-step arrays follow the cached mesh block
+    uint64_t offset = mesh.block.size();
+    std::vector<uint64_t> pointOffsets, cellOffsets;
+    for (const Array &array : job.pointArrays) {
+      pointOffsets.push_back(offset);
+      offset += sizeof(uint64_t) + array.data.size()*sizeof(double);
+    }
+    for (const Array &array : job.cellArrays) {
+      cellOffsets.push_back(offset);
+      offset += sizeof(uint64_t) + array.data.size()*sizeof(double);
+    }
+
+    std::ostringstream xml;
+    auto dataArray = [&xml](const Array &array, uint64_t offset) {
+      xml << "<DataArray type=\"" << array.type << "\" Name=\"" << array.name << "\"";
+      if (array.numComp != 1)
+        xml << " NumberOfComponents=\"" << array.numComp << "\"";
+      xml << " format=\"appended\" offset=\"" << offset << "\"/>\n";
+    };
+
+    xml << "<?xml version=\"1.0\"?>\n";
+    xml << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+        << byteOrder() << "\" header_type=\"UInt64\">\n";
+    xml << "<UnstructuredGrid>\n";
+    xml << "<Piece NumberOfPoints=\"" << mesh.numPoints
+        << "\" NumberOfCells=\"" << mesh.numCells << "\">\n";
+
+    xml << "<PointData>\n";
+    for (const Array &array : mesh.pointArrays)
+      dataArray(array, array.offset);
+    for (size_t i=0; i<job.pointArrays.size(); i++)
+      dataArray(job.pointArrays[i], pointOffsets[i]);
+    xml << "</PointData>\n";
+
+    xml << "<CellData>\n";
+    for (const Array &array : mesh.cellArrays)
+      dataArray(array, array.offset);
+    for (size_t i=0; i<job.cellArrays.size(); i++)
+      dataArray(job.cellArrays[i], cellOffsets[i]);
+    xml << "</CellData>\n";
+
+    xml << "<Points>\n"
+        << "<DataArray type=\"Float64\" Name=\"Points\" NumberOfComponents=\"3\""
+        << " format=\"appended\" offset=\"" << mesh.pointsOffset << "\"/>\n"
+        << "</Points>\n";
+
+    xml << "<Cells>\n"
+        << "<DataArray type=\"Int64\" Name=\"connectivity\" format=\"appended\" offset=\""
+        << mesh.connOffset << "\"/>\n"
+        << "<DataArray type=\"Int64\" Name=\"offsets\" format=\"appended\" offset=\""
+        << mesh.offsetsOffset << "\"/>\n"
+        << "<DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\""
+        << mesh.typesOffset << "\"/>\n"
+        << "</Cells>\n";
+
+    xml << "</Piece>\n</UnstructuredGrid>\n";
+    xml << "<AppendedData encoding=\"raw\">\n_";
+
+    FILE *file = fopen(job.filename.c_str(), "wb");
+    if (file == nullptr)
+      return -1;
+
+    const std::string header = xml.str();
+    fwrite(header.data(), 1, header.size(), file);
+    fwrite(mesh.block.data(), 1, mesh.block.size(), file);
+
+    for (const std::vector<Array> *arrays : {&job.pointArrays, &job.cellArrays})
+      for (const Array &array : *arrays) {
+        uint64_t nbytes = array.data.size()*sizeof(double);
+        fwrite(&nbytes, sizeof(uint64_t), 1, file);
+        fwrite(array.data.data(), sizeof(double), array.data.size(), file);
+      }
+
+    const char footer[] = "\n</AppendedData>\n</VTKFile>\n";
+    fwrite(footer, 1, sizeof(footer)-1, file);
+
+    int status = ferror(file) ? -1 : 0;
+    if (fclose(file) != 0)
+      status = -1;
+    return status;
+}
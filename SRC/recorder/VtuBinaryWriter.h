@@ -0,0 +1,126 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the class definition for
+// VtuBinaryWriter. A VtuBinaryWriter writes VTK UnstructuredGrid
+// (.vtu) files using the "appended raw" encoding. The mesh (points,
+// cells and any other step-invariant arrays) is encoded once into
+// a cached byte block that is reused verbatim for every step; only
+// the point and cell data that change between steps are gathered
+// and appended. Files are written by a background thread so that
+// the analysis does not wait on disk I/O.
+//
+#ifndef VtuBinaryWriter_h
+#define VtuBinaryWriter_h
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <stdint.h>
+
+class VtuBinaryWriter
+{
+public:
+    VtuBinaryWriter(int maxPending = 2);
+    ~VtuBinaryWriter();
+
+    //
+    // Mesh; call beginMesh, fill the arrays and then endMesh.
+    // The mesh is kept until the next call to beginMesh.
+    //
+    void beginMesh(int numPoints, int numCells);
+    double  *points();                            // 3*numPoints
+    void     addCell(const int64_t *nodes, int n, uint8_t vtkType);
+    void     addStaticPointData(const char *name, const std::vector<int64_t> &data);
+    void     addStaticCellData(const char *name, const std::vector<int64_t> &data);
+    void     endMesh();
+    void     clearMesh() {theMesh = nullptr;}
+    bool     hasMesh() const {return theMesh != nullptr;}
+
+    //
+    // Step data; returns a buffer of numPoints*numComp (numCells*numComp)
+    // zero-initialized doubles to be filled by the caller.
+    //
+    double  *pointData(const char *name, int numComp);
+    double  *cellData(const char *name, int numComp);
+
+    // Queue the current step for writing to filename. The step
+    // buffers are handed to the writer thread.
+    int      write(const std::string &filename);
+
+    // Block until all queued files have been written; returns -1
+    // if any write failed since the last call.
+    int      flush();
+
+private:
+    struct Array {
+      std::string name;
+      const char *type;
+      int numComp;
+      uint64_t offset;       // offset into the appended block
+      std::vector<double> data;
+    };
+
+    struct Mesh {
+      int numPoints, numCells;
+      std::vector<Array> pointArrays;  // static point data
+      std::vector<Array> cellArrays;   // static cell data
+      uint64_t pointsOffset, connOffset, offsetsOffset, typesOffset;
+      std::string block;               // encoded appended data
+    };
+
+    struct Job {
+      std::string filename;
+      std::shared_ptr<const Mesh> mesh;
+      std::vector<Array> pointArrays;
+      std::vector<Array> cellArrays;
+    };
+
+    static void appendRaw(std::string &block, const void *data, uint64_t nbytes);
+    static int  writeJob(const Job &job);
+    void        run();
+
+    // mesh under construction
+    std::shared_ptr<Mesh> theMesh;
+    std::vector<double>  thePoints;
+    std::vector<int64_t> theConnectivity;
+    std::vector<int64_t> theOffsets;
+    std::vector<uint8_t> theTypes;
+
+    // current step
+    std::vector<Array> stepPointArrays;
+    std::vector<Array> stepCellArrays;
+
+    // writer thread
+    std::thread             theThread;
+    std::mutex              theMutex;
+    std::condition_variable queueChanged;
+    std::deque<Job>         theQueue;
+    int   maxPending;
+    bool  busy;
+    bool  done;
+    bool  failed;
+};
+
+#endif
@@ -137,12 +137,38 @@ CompositeResponse::getResponse(void)
   // invoke getResponse on all responses & add the data to myInfo
   //
 
+  // with output storage set, have each response write its data straight
+  // into its part of it
+  bool toOutput = (myInfo.theOutput != 0 && myInfo.theType == VectorType &&
+		   myInfo.outputSize == myInfo.theVector->Size());
+
   int currentLoc = 0;
   for (int i=0; i<numResponses; i++) {
     Response *theResponse = theResponses[i];
+    Information&otherType = theResponse->getInformation();
+
+    if (toOutput == true) {
+      int otherSize = 0;
+      if (otherType.theType == DoubleType)
+	otherSize = 1;
+      else if (otherType.theType == VectorType)
+	otherSize = otherType.theVector->Size();
+      if (otherType.theOutput != &myInfo.theOutput[currentLoc] || otherType.outputSize != otherSize)
+	otherType.setOutput(&myInfo.theOutput[currentLoc], otherSize);
+      otherType.outputWritten = false;
+    }
+
     res += theResponse->getResponse();
 
-    Information&otherType = theResponse->getInformation();
+    if (toOutput == true) {
+      if (otherType.outputWritten == false) {
+	const Vector &otherData = otherType.getData();
+	for (int j=0; j<otherType.outputSize; j++)
+	  myInfo.theOutput[currentLoc+j] = (j < otherData.Size()) ? otherData(j) : 0.0;
+      }
+      currentLoc += otherType.outputSize;
+      continue;
+    }
 
     if (otherType.theType == DoubleType || otherType.theType == VectorType) {
       if (otherType.theType == DoubleType)
@@ -163,6 +189,9 @@ CompositeResponse::getResponse(void)
       }    
     }    
   }
+
+  if (toOutput == true)
+    myInfo.outputWritten = true;
   
   return res;
 }
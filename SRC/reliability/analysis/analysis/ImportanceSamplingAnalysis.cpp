@@ -43,6 +43,8 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <MatrixOperations.h>
+#include <ParallelSampling.h>
+#include <Parameter.h>
 
 #include <math.h>
 #include <stdlib.h>
@@ -80,6 +82,10 @@ theOpenSeesDomain(passedOpenSeesDomain)
 	printFlag = passedPrintFlag;
 	strcpy(fileName,passedFileName);
 	analysisTypeTag = passedAnalysisTypeTag;
+
+	useParallelSampling = false;
+	batchSize = 100;
+	samplingSeed = 1;
 }
 
 
@@ -92,9 +98,32 @@ ImportanceSamplingAnalysis::~ImportanceSamplingAnalysis()
 
 
 
+void
+ImportanceSamplingAnalysis::setParallelSampling(int passedBatchSize, unsigned long passedSeed)
+{
+	useParallelSampling = true;
+	batchSize = passedBatchSize;
+	samplingSeed = passedSeed;
+}
+
+
+
+void
+ImportanceSamplingAnalysis::addSampleEvaluator(SampleEvaluator *theEvaluator)
+{
+	theSampleEvaluators.push_back(theEvaluator);
+}
+
+
+
 int 
 ImportanceSamplingAnalysis::analyze(void)
 {
+	// Estimates of pf and of response statistics can be sampled in
+	// independent batches; the g-function output of type 3 is written
+	// sample by sample
+	if (useParallelSampling && (analysisTypeTag == 1 || analysisTypeTag == 2))
+		return this->analyzeParallel();
 
 	// Alert the user that the simulation analysis has started
 	opserr << "ImportanceSampling Analysis is running ... " << endln;
@@ -112,7 +141,6 @@ ImportanceSamplingAnalysis::analyze(void)
 	Vector z(numRV);
 	Vector u(numRV);
 	Vector randomArray(numRV);
-	static NormalRV aStdNormRV(1,0.0,1.0);
 	bool failureHasOccured = false;
 
 	det_covariance = pow(samplingStdv, numRV);
@@ -163,31 +191,10 @@ ImportanceSamplingAnalysis::analyze(void)
 	}
 
     
-    // get starting x values from parameter directly
-    for (int j = 0; j < numRV; j++) {
-        RandomVariable *theRV = theReliabilityDomain->getRandomVariablePtrFromIndex(j);
-        int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
-        Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
-        
-        double rvVal = theRV->getStartValue();
-        if (analysisTypeTag == 2) {
-            rvVal = theRV->getMean();
-            opserr << "NOTE: The startPoint is set to the Mean due to the selected sampling analysis type." << endln;
-        }
-        x(j) = rvVal;
-        
-        // now we should update the parameter value
-        theParam->update(rvVal);
-    }
-    
 	// Transform start point into standard normal space
 	Vector startPointY(numRV);
-	result = theProbabilityTransformation->transform_x_to_u(startPointY);
-	if (result < 0) {
-	    opserr << "ImportanceSamplingAnalysis::analyze() - could not " << endln
-		   << " transform x to u. " << endln;
-	    return -1;
-    }
+	if (this->computeStartPoint(startPointY) < 0)
+		return -1;
 
     
 	// Initial declarations
@@ -476,110 +483,226 @@ ImportanceSamplingAnalysis::analyze(void)
 	opserr << endln;
 
 
-	if (analysisTypeTag != 3) {
+	if (analysisTypeTag != 3)
+		this->printResults(resultsOutputFile, k, q_bar, cov_of_q_bar, responseStdv,
+				   responseCorrelation, failureHasOccured);
 
-		if (!failureHasOccured) {
-			opserr << "WARNING: Failure did not occur for any of the limit-state functions. " << endln;
-		}
 
-		LimitStateFunctionIter &lsfIter = theReliabilityDomain->getLimitStateFunctions();
-		LimitStateFunction *theLimitStateFunction;
-		for (int lsf = 0; lsf < numLsf; lsf++ ) {
-		//while ((theLimitStateFunction = lsfIter()) != 0) {
+	// Print summary of results to screen 
+	opserr << "ImportanceSampling Analysis completed." << endln;
+
+	// Clean up
+	resultsOutputFile.close();
+
+	return 0;
+}
+
+
+
+int
+ImportanceSamplingAnalysis::analyzeParallel(void)
+{
+	// Alert the user that the simulation analysis has started
+	opserr << "ImportanceSampling Analysis is running ... " << endln;
+
+	int numRV = theReliabilityDomain->getNumberOfRandomVariables();
+	int numLsf = theReliabilityDomain->getNumberOfLimitStateFunctions();
+
+	if (printFlag == 2)
+		opserr << "WARNING: restart files are not written by batched sampling." << endln;
+
+	Vector startPointY(numRV);
+	if (this->computeStartPoint(startPointY) < 0)
+		return -1;
+
+	// The first evaluator works on the domain of this analysis; any
+	// further evaluators are expected to own a copy of the model
+	DomainSampleEvaluator theEvaluator(theReliabilityDomain, theOpenSeesDomain,
+					   theProbabilityTransformation, theGFunEvaluator);
+	std::vector<SampleEvaluator*> evaluators(1, &theEvaluator);
+	evaluators.insert(evaluators.end(), theSampleEvaluators.begin(), theSampleEvaluators.end());
+
+	ParallelSampling theSampling(numRV, numLsf, evaluators.data(), evaluators.size());
+	theSampling.setSeed(samplingSeed);
+	theSampling.setBatchSize(batchSize);
+	theSampling.setSamplingDensity(startPointY, samplingStdv);
+
+	if (theSampling.run(analysisTypeTag, numberOfSimulations, targetCOV, printFlag) < 0) {
+		opserr << "ImportanceSamplingAnalysis::analyzeParallel() - sampling failed" << endln;
+		return -1;
+	}
+	opserr << endln;
+
+	const SamplingStatistics &statistics = theSampling.getStatistics();
+	Vector q_bar(numLsf);
+	Vector cov_of_q_bar(numLsf);
+	Vector responseStdv(numLsf);
+	Matrix responseCorrelation(numLsf,numLsf);
+	for (int i = 0; i < numLsf; i++) {
+		q_bar(i) = statistics.getMean(i);
+		cov_of_q_bar(i) = statistics.getCovOfMean(i);
+		responseStdv(i) = sqrt(statistics.getVariance(i));
+		for (int j = i+1; j < numLsf; j++)
+			responseCorrelation(i,j) = statistics.getCorrelation(i,j);
+	}
+
+	ofstream resultsOutputFile( fileName, ios::out );
+	this->printResults(resultsOutputFile, statistics.getCount(), q_bar, cov_of_q_bar,
+			   responseStdv, responseCorrelation, theSampling.hasFailureOccurred());
+	resultsOutputFile.close();
+
+	opserr << "ImportanceSampling Analysis completed." << endln;
+
+	return 0;
+}
+
+
+
+int
+ImportanceSamplingAnalysis::computeStartPoint(Vector &startPointY)
+{
+	int numRV = theReliabilityDomain->getNumberOfRandomVariables();
+
+    // get starting x values from parameter directly
+    for (int j = 0; j < numRV; j++) {
+        RandomVariable *theRV = theReliabilityDomain->getRandomVariablePtrFromIndex(j);
+        int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
+        Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
+        
+        double rvVal = theRV->getStartValue();
+        if (analysisTypeTag == 2) {
+            rvVal = theRV->getMean();
+            opserr << "NOTE: The startPoint is set to the Mean due to the selected sampling analysis type." << endln;
+        }
+        
+        // now we should update the parameter value
+        theParam->update(rvVal);
+    }
+    
+	// Transform start point into standard normal space
+	if (theProbabilityTransformation->transform_x_to_u(startPointY) < 0) {
+	    opserr << "ImportanceSamplingAnalysis::computeStartPoint() - could not " << endln
+		   << " transform x to u. " << endln;
+	    return -1;
+    }
+
+	return 0;
+}
+
+
+
+void
+ImportanceSamplingAnalysis::printResults(ofstream &resultsOutputFile, long int k,
+					 const Vector &q_bar, const Vector &cov_of_q_bar,
+					 const Vector &responseStdv, const Matrix &responseCorrelation,
+					 bool failureHasOccured)
+{
+
+	if (!failureHasOccured) {
+		opserr << "WARNING: Failure did not occur for any of the limit-state functions. " << endln;
+	}
+
+	static NormalRV aStdNormRV(1,0.0,1.0);
+	int numLsf = theReliabilityDomain->getNumberOfLimitStateFunctions();
+
+	LimitStateFunctionIter &lsfIter = theReliabilityDomain->getLimitStateFunctions();
+	LimitStateFunction *theLimitStateFunction;
+	for (int lsf = 0; lsf < numLsf; lsf++ ) {
+	//while ((theLimitStateFunction = lsfIter()) != 0) {
             theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf);
             int lsfTag = theLimitStateFunction->getTag();
 
-			if ( q_bar(lsf) == 0.0 ) {
+		if ( q_bar(lsf) == 0.0 ) {
+
+			resultsOutputFile << "#######################################################################" << endln;
+			resultsOutputFile << "#  SAMPLING ANALYSIS RESULTS, LIMIT-STATE FUNCTION NUMBER   "
+				<<setiosflags(ios::left)<<setprecision(1)<<setw(4)<<lsfTag <<"      #" << endln;
+			resultsOutputFile << "#                                                                     #" << endln;
+			resultsOutputFile << "#  Failure did not occur, or zero response!                           #" << endln;
+			resultsOutputFile << "#                                                                     #" << endln;
+			resultsOutputFile << "#######################################################################" << endln << endln << endln;
+		}
+		else {
+
+			// Some declarations
+			double beta_sim, pf_sim, cov_sim;
+			int num_sim;
+
+
+			// Set tag of "active" limit-state function
+			theReliabilityDomain->setTagOfActiveLimitStateFunction(lsfTag);
+
+
+			// Store results
+			if (analysisTypeTag == 1) {
+				beta_sim = -aStdNormRV.getInverseCDFvalue(q_bar(lsf));
+				pf_sim	 = q_bar(lsf);
+				cov_sim	 = cov_of_q_bar(lsf);
+				num_sim  = k;
+				// Use a recorder -- MHS 10/7/2011
+				/*
+				theLimitStateFunction->setSIM_beta(beta_sim);
+				theLimitStateFunction->setSIM_pfsim(pf_sim);
+				theLimitStateFunction->setSIM_pfcov(cov_sim);
+				theLimitStateFunction->setSIM_numsim(num_sim);
+				*/
+			}
+
 
+			// Print results to the output file
+			if (analysisTypeTag == 1) {
 				resultsOutputFile << "#######################################################################" << endln;
 				resultsOutputFile << "#  SAMPLING ANALYSIS RESULTS, LIMIT-STATE FUNCTION NUMBER   "
 					<<setiosflags(ios::left)<<setprecision(1)<<setw(4)<<lsfTag <<"      #" << endln;
 				resultsOutputFile << "#                                                                     #" << endln;
-				resultsOutputFile << "#  Failure did not occur, or zero response!                           #" << endln;
+				resultsOutputFile << "#  Reliability index beta: ............................ " 
+					<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<beta_sim 
+					<< "  #" << endln;
+				resultsOutputFile << "#  Estimated probability of failure pf_sim: ........... " 
+					<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<pf_sim 
+					<< "  #" << endln;
+				resultsOutputFile << "#  Number of simulations: ............................. " 
+					<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<num_sim 
+					<< "  #" << endln;
+				resultsOutputFile << "#  Coefficient of variation (of pf): .................. " 
+					<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<cov_sim 
+					<< "  #" << endln;
 				resultsOutputFile << "#                                                                     #" << endln;
 				resultsOutputFile << "#######################################################################" << endln << endln << endln;
 			}
 			else {
-
-				// Some declarations
-				double beta_sim, pf_sim, cov_sim;
-				int num_sim;
-
-
-				// Set tag of "active" limit-state function
-				theReliabilityDomain->setTagOfActiveLimitStateFunction(lsfTag);
-
-
-				// Store results
-				if (analysisTypeTag == 1) {
-					beta_sim = -aStdNormRV.getInverseCDFvalue(q_bar(lsf));
-					pf_sim	 = q_bar(lsf);
-					cov_sim	 = cov_of_q_bar(lsf);
-					num_sim  = k;
-					// Use a recorder -- MHS 10/7/2011
-					/*
-					theLimitStateFunction->setSIM_beta(beta_sim);
-					theLimitStateFunction->setSIM_pfsim(pf_sim);
-					theLimitStateFunction->setSIM_pfcov(cov_sim);
-					theLimitStateFunction->setSIM_numsim(num_sim);
-					*/
-				}
-
-
-				// Print results to the output file
-				if (analysisTypeTag == 1) {
-					resultsOutputFile << "#######################################################################" << endln;
-					resultsOutputFile << "#  SAMPLING ANALYSIS RESULTS, LIMIT-STATE FUNCTION NUMBER   "
-						<<setiosflags(ios::left)<<setprecision(1)<<setw(4)<<lsfTag <<"      #" << endln;
-					resultsOutputFile << "#                                                                     #" << endln;
-					resultsOutputFile << "#  Reliability index beta: ............................ " 
-						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<beta_sim 
-						<< "  #" << endln;
-					resultsOutputFile << "#  Estimated probability of failure pf_sim: ........... " 
-						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<pf_sim 
-						<< "  #" << endln;
-					resultsOutputFile << "#  Number of simulations: ............................. " 
-						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<num_sim 
-						<< "  #" << endln;
-					resultsOutputFile << "#  Coefficient of variation (of pf): .................. " 
-						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<cov_sim 
-						<< "  #" << endln;
-					resultsOutputFile << "#                                                                     #" << endln;
-					resultsOutputFile << "#######################################################################" << endln << endln << endln;
-				}
-				else {
-					resultsOutputFile << "#######################################################################" << endln;
-					resultsOutputFile << "#  SAMPLING ANALYSIS RESULTS, LIMIT-STATE FUNCTION NUMBER   "
-						<<setiosflags(ios::left)<<setprecision(1)<<setw(4)<<lsfTag <<"      #" << endln;
-					resultsOutputFile << "#                                                                     #" << endln;
-					resultsOutputFile << "#  Estimated mean: .................................... " 
-						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<q_bar(lsf) 
-						<< "  #" << endln;
-					resultsOutputFile << "#  Estimated standard deviation: ...................... " 
-						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<responseStdv(lsf) 
-						<< "  #" << endln;
-					resultsOutputFile << "#                                                                     #" << endln;
-					resultsOutputFile << "#######################################################################" << endln << endln << endln;
-				}
+				resultsOutputFile << "#######################################################################" << endln;
+				resultsOutputFile << "#  SAMPLING ANALYSIS RESULTS, LIMIT-STATE FUNCTION NUMBER   "
+					<<setiosflags(ios::left)<<setprecision(1)<<setw(4)<<lsfTag <<"      #" << endln;
+				resultsOutputFile << "#                                                                     #" << endln;
+				resultsOutputFile << "#  Estimated mean: .................................... " 
+					<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<q_bar(lsf) 
+					<< "  #" << endln;
+				resultsOutputFile << "#  Estimated standard deviation: ...................... " 
+					<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<responseStdv(lsf) 
+					<< "  #" << endln;
+				resultsOutputFile << "#                                                                     #" << endln;
+				resultsOutputFile << "#######################################################################" << endln << endln << endln;
 			}
 		}
+	}
 
-		if (analysisTypeTag == 2) {
-			resultsOutputFile << "#######################################################################" << endln;
-			resultsOutputFile << "#  RESPONSE CORRELATION COEFFICIENTS                                  #" << endln;
-			resultsOutputFile << "#                                                                     #" << endln;
-			if (numLsf <= 1) {
-				resultsOutputFile << "#  Only one limit-state function!                                     #" << endln;
-			}
-			else {
-				resultsOutputFile << "#   gFun   gFun     Correlation                                       #" << endln;
-				resultsOutputFile.setf(ios::fixed, ios::floatfield);
-
-				LimitStateFunctionIter lsfIterI = theReliabilityDomain->getLimitStateFunctions();
-				LimitStateFunctionIter lsfIterJ = theReliabilityDomain->getLimitStateFunctions();
-				LimitStateFunction *lsfI, *lsfJ;
-				for (int i = 0; i < numLsf; i++) {
-				//while ((lsfI = lsfIterI()) != 0) {
+	if (analysisTypeTag == 2) {
+		resultsOutputFile << "#######################################################################" << endln;
+		resultsOutputFile << "#  RESPONSE CORRELATION COEFFICIENTS                                  #" << endln;
+		resultsOutputFile << "#                                                                     #" << endln;
+		if (numLsf <= 1) {
+			resultsOutputFile << "#  Only one limit-state function!                                     #" << endln;
+		}
+		else {
+			resultsOutputFile << "#   gFun   gFun     Correlation                                       #" << endln;
+			resultsOutputFile.setf(ios::fixed, ios::floatfield);
+
+			LimitStateFunctionIter lsfIterI = theReliabilityDomain->getLimitStateFunctions();
+			LimitStateFunctionIter lsfIterJ = theReliabilityDomain->getLimitStateFunctions();
+			LimitStateFunction *lsfI, *lsfJ;
+			for (int i = 0; i < numLsf; i++) {
+			//while ((lsfI = lsfIterI()) != 0) {
                     lsfI = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(i);
                     int iTag = lsfI->getTag();
 
@@ -594,21 +717,10 @@ ImportanceSamplingAnalysis::analyze(void)
                         resultsOutputFile <<setprecision(7)<<setw(11)<<fabs(responseCorrelation(i,j));
                         resultsOutputFile << "                                      #" << endln;
                     }
-				}
 			}
-			resultsOutputFile << "#                                                                     #" << endln;
-			resultsOutputFile << "#######################################################################" << endln << endln << endln;
 		}
-
+		resultsOutputFile << "#                                                                     #" << endln;
+		resultsOutputFile << "#######################################################################" << endln << endln << endln;
 	}
 
-
-	// Print summary of results to screen 
-	opserr << "ImportanceSampling Analysis completed." << endln;
-
-	// Clean up
-	resultsOutputFile.close();
-
-	return 0;
 }
-
@@ -41,9 +41,12 @@
 #include <FunctionEvaluator.h>
 
 #include <fstream>
+#include <vector>
 #include <tcl.h>
 using std::ofstream;
 
+class SampleEvaluator;
+
 class ImportanceSamplingAnalysis : public ReliabilityAnalysis
 {
 
@@ -65,9 +68,24 @@ public:
 	
 	int analyze(void);
 
+	// Sample failure probabilities and response statistics (types 1
+	// and 2) in batches of batchSize with per-sample random streams
+	// derived from seed. Evaluators added with addSampleEvaluator must
+	// work on their own copy of the model; each is run on a thread of
+	// its own, concurrently with the domain of this analysis.
+	void setParallelSampling(int batchSize, unsigned long seed);
+	void addSampleEvaluator(SampleEvaluator *theEvaluator);
+
 protected:
 	
 private:
+	int  analyzeParallel(void);
+	int  computeStartPoint(Vector &startPointY);
+	void printResults(ofstream &resultsOutputFile, long int k,
+			  const Vector &q_bar, const Vector &cov_of_q_bar,
+			  const Vector &responseStdv, const Matrix &responseCorrelation,
+			  bool failureHasOccured);
+
 	ReliabilityDomain *theReliabilityDomain;
     Domain *theOpenSeesDomain;
 	ProbabilityTransformation *theProbabilityTransformation;
@@ -80,6 +98,11 @@ private:
 	int printFlag;
 	char fileName[256];
 	int analysisTypeTag;
+
+	bool useParallelSampling;
+	int batchSize;
+	unsigned long samplingSeed;
+	std::vector<SampleEvaluator*> theSampleEvaluators;
 };
 
 #endif
@@ -40,6 +40,7 @@
 #include <NormalRV.h>
 #include <Vector.h>
 #include <Matrix.h>
+#include <ParallelSampling.h>
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
@@ -52,6 +53,7 @@ using std::ios;
 //using std::ios;
 MonteCarloResponseAnalysis::MonteCarloResponseAnalysis(
 						ReliabilityDomain *passedReliabilityDomain,
+						Domain *passedOpenSeesDomain,
 						Tcl_Interp *passedTclInterp,
 						ProbabilityTransformation *passedProbabilityTransformation,
 						RandomNumberGenerator *passedRandomNumberGenerator,
@@ -63,6 +65,7 @@ MonteCarloResponseAnalysis::MonteCarloResponseAnalysis(
 						)
 {
 	theReliabilityDomain = passedReliabilityDomain;
+	theOpenSeesDomain = passedOpenSeesDomain;
 	theTclInterp = passedTclInterp;
 	theProbabilityTransformation = passedProbabilityTransformation;
 	theRandomNumberGenerator = passedRandomNumberGenerator;
@@ -77,6 +80,9 @@ MonteCarloResponseAnalysis::MonteCarloResponseAnalysis(
 	}
 	else tclFileToRun = 0;
 
+	useParallelSampling = false;
+	batchSize = 100;
+	samplingSeed = 1;
 }
 
 
@@ -86,8 +92,28 @@ MonteCarloResponseAnalysis::~MonteCarloResponseAnalysis()
 	if (tclFileToRun !=0) delete [] tclFileToRun;
 }
 
+void
+MonteCarloResponseAnalysis::setParallelSampling(int passedBatchSize, unsigned long passedSeed)
+{
+	useParallelSampling = true;
+	batchSize = passedBatchSize;
+	samplingSeed = passedSeed;
+}
+
+
+
+void
+MonteCarloResponseAnalysis::addSampleEvaluator(SampleEvaluator *theEvaluator)
+{
+	theSampleEvaluators.push_back(theEvaluator);
+}
+
+
+
 int MonteCarloResponseAnalysis::analyze(){
 
+	if (useParallelSampling)
+		return this->analyzeParallel();
 
 	opserr << "Monte Carlo Response Analysis is running ... " << endln;
 	
@@ -275,3 +301,58 @@ int MonteCarloResponseAnalysis::analyze(){
 
 
 };
+
+
+
+int
+MonteCarloResponseAnalysis::analyzeParallel()
+{
+	opserr << "Monte Carlo Response Analysis is running ... " << endln;
+
+	if (printFlag == 2)
+		opserr << "WARNING: restart files are not written by batched sampling." << endln;
+
+	int numRV = theReliabilityDomain->getNumberOfRandomVariables();
+
+	// The first evaluator works on the model of this analysis; any
+	// further evaluators are expected to own a copy of the model
+	DomainSampleEvaluator theEvaluator(theReliabilityDomain, theOpenSeesDomain,
+					   theProbabilityTransformation, 0);
+	theEvaluator.setTclFileToRun(theTclInterp, tclFileToRun);
+	std::vector<SampleEvaluator*> evaluators(1, &theEvaluator);
+	evaluators.insert(evaluators.end(), theSampleEvaluators.begin(), theSampleEvaluators.end());
+
+	// there are no limit-state functions to sample; the tcl file
+	// records the responses
+	ParallelSampling theSampling(numRV, 0, evaluators.data(), evaluators.size());
+	theSampling.setSeed(samplingSeed);
+	theSampling.setBatchSize(batchSize);
+
+	if (theSampling.run(ParallelSampling::ResponseStatistics, numberOfSimulations, 0.0, 0) < 0) {
+		opserr << "MonteCarloResponseAnalysis::analyzeParallel() - sampling failed" << endln;
+		return -1;
+	}
+
+	// record x of each sample, in sample order
+	ofstream resultsOutputFile( fileName, ios::out );
+	resultsOutputFile.precision(15);
+
+	Vector u(numRV);
+	Vector x(numRV);
+	long numSamples = theSampling.getStatistics().getCount();
+	for (long kk = 0; kk < numSamples; kk++) {
+		ParallelSampling::standardNormal(samplingSeed, kk, u);
+		if (theProbabilityTransformation->transform_u_to_x(u, x) < 0) {
+			opserr << "MonteCarloResponseAnalysis::analyzeParallel() - could not " << endln
+			       << " transform u to x. " << endln;
+			return -1;
+		}
+		for (int ii=0;ii<numRV;ii++)
+			resultsOutputFile << x(ii)<<endln ;
+	}
+	resultsOutputFile.close();
+
+	opserr << "Simulation Analysis completed." << endln;
+
+	return 0;
+}
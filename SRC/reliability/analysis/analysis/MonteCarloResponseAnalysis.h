@@ -8,12 +8,17 @@
 #include <ReliabilityDomain.h>
 #include <ProbabilityTransformation.h>
 #include <RandomNumberGenerator.h>
+#include <vector>
+#include <tcl.h>
 
+class Domain;
+class SampleEvaluator;
 
 class MonteCarloResponseAnalysis  
 {
 public:
 	MonteCarloResponseAnalysis(ReliabilityDomain *passedReliabilityDomain,
+						Domain *passedOpenSeesDomain,
 						Tcl_Interp *passedTclInterp,
 						ProbabilityTransformation *passedProbabilityTransformation,
 						RandomNumberGenerator *passedRandomNumberGenerator,
@@ -28,8 +33,18 @@ public:
 	virtual ~MonteCarloResponseAnalysis();
 	int analyze();
 
+	// Run the samples in batches of batchSize with per-sample random
+	// streams derived from seed. Evaluators added with
+	// addSampleEvaluator must work on their own copy of the model; they
+	// are run concurrently with the model of this analysis.
+	void setParallelSampling(int batchSize, unsigned long seed);
+	void addSampleEvaluator(SampleEvaluator *theEvaluator);
+
 private:
+	int analyzeParallel();
+
 	ReliabilityDomain *theReliabilityDomain;
+	Domain *theOpenSeesDomain;
 	Tcl_Interp *theTclInterp;
 	ProbabilityTransformation *theProbabilityTransformation;
 	RandomNumberGenerator *theRandomNumberGenerator;
@@ -39,8 +54,10 @@ private:
 	char * tclFileToRun;
 	int seed;
 
-
-
+	bool useParallelSampling;
+	int batchSize;
+	unsigned long samplingSeed;
+	std::vector<SampleEvaluator*> theSampleEvaluators;
 };
 
 #endif 
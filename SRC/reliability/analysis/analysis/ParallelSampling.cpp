@@ -0,0 +1,439 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+
+#include <ParallelSampling.h>
+#include <ReliabilityDomain.h>
+#include <LimitStateFunction.h>
+#include <ProbabilityTransformation.h>
+#include <FunctionEvaluator.h>
+#include <Domain.h>
+#include <Parameter.h>
+#include <OPS_Globals.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <thread>
+
+
+SamplingStatistics::SamplingStatistics(int size)
+:n(0), mean(size), delta(size), comoment(size, size)
+{
+
+}
+
+
+void
+SamplingStatistics::add(const Vector &q)
+{
+	int size = mean.Size();
+
+	n++;
+	for (int i = 0; i < size; i++) {
+		delta(i) = q(i) - mean(i);
+		mean(i) += delta(i)/n;
+	}
+
+	// C_ij += (q_i - old mean_i)(q_j - new mean_j)
+	for (int i = 0; i < size; i++)
+		for (int j = i; j < size; j++) {
+			comoment(i,j) += delta(i)*(q(j) - mean(j));
+			comoment(j,i) = comoment(i,j);
+		}
+}
+
+
+double
+SamplingStatistics::getVariance(int i) const
+{
+	if (n < 2)
+		return 0.0;
+	return comoment(i,i)/(n - 1);
+}
+
+
+double
+SamplingStatistics::getCovOfMean(int i) const
+{
+	// as in the sequential analyses, the variance of the mean is
+	// estimated with the population variance
+	if (n == 0 || mean(i) <= 0.0)
+		return 0.0;
+	return sqrt(comoment(i,i))/n/mean(i);
+}
+
+
+double
+SamplingStatistics::getCorrelation(int i, int j) const
+{
+	double denominator = comoment(i,i)*comoment(j,j);
+	if (denominator <= 0.0)
+		return 0.0;
+	return comoment(i,j)/sqrt(denominator);
+}
+
+
+DomainSampleEvaluator::DomainSampleEvaluator(ReliabilityDomain *passedReliabilityDomain,
+					     Domain *passedOpenSeesDomain,
+					     ProbabilityTransformation *passedProbabilityTransformation,
+					     FunctionEvaluator *passedGFunEvaluator)
+:theReliabilityDomain(passedReliabilityDomain), theOpenSeesDomain(passedOpenSeesDomain),
+ theProbabilityTransformation(passedProbabilityTransformation),
+ theGFunEvaluator(passedGFunEvaluator), theTclInterp(0), tclFileToRun(0),
+ x(passedReliabilityDomain->getNumberOfRandomVariables())
+{
+
+}
+
+
+void
+DomainSampleEvaluator::setTclFileToRun(Tcl_Interp *interp, const char *fileName)
+{
+	theTclInterp = interp;
+	tclFileToRun = fileName;
+}
+
+
+int
+DomainSampleEvaluator::evaluate(const Vector &u, Vector &g)
+{
+	int numRV = theReliabilityDomain->getNumberOfRandomVariables();
+	int numLsf = theReliabilityDomain->getNumberOfLimitStateFunctions();
+
+	// Transform into original space
+	if (theProbabilityTransformation->transform_u_to_x(u, x) < 0) {
+		opserr << "DomainSampleEvaluator::evaluate() - could not transform u to x. " << endln;
+		return -1;
+	}
+
+	// update domain with new x values
+	for (int j = 0; j < numRV; j++) {
+		int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
+		theOpenSeesDomain->getParameterFromIndex(param_indx)->update(x(j));
+	}
+
+	// run the response analysis of the sample
+	if (tclFileToRun != 0) {
+		Tcl_Eval(theTclInterp, "reset");
+		Tcl_Eval(theTclInterp, "wipeAnalysis");
+		if (Tcl_EvalFile(theTclInterp, tclFileToRun) != TCL_OK) {
+			opserr << "DomainSampleEvaluator::evaluate() - the file " << tclFileToRun
+			       << " can not be run!" << endln;
+			return -1;
+		}
+		return 0;
+	}
+
+	// set values in the variable namespace
+	if (theGFunEvaluator->setVariables() < 0) {
+		opserr << "DomainSampleEvaluator::evaluate() - " << endln
+		       << " could not set variables in namespace. " << endln;
+		return -1;
+	}
+
+	int result = 0;
+	if (theGFunEvaluator->runAnalysis() < 0) {
+		opserr << "ERROR DomainSampleEvaluator -- error running analysis" << endln;
+		result = -1;
+	}
+
+	for (int lsf = 0; lsf < numLsf; lsf++) {
+		LimitStateFunction *theLimitStateFunction =
+			theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf);
+		theReliabilityDomain->setTagOfActiveLimitStateFunction(theLimitStateFunction->getTag());
+
+		theGFunEvaluator->setExpression(theLimitStateFunction->getExpression());
+		g(lsf) = theGFunEvaluator->evaluateExpression();
+	}
+
+	return result;
+}
+
+
+ParallelSampling::ParallelSampling(int nrv, int nlsf,
+				   SampleEvaluator **evaluators, int numEvaluators)
+:numRV(nrv), numLsf(nlsf), theEvaluators(evaluators, evaluators + numEvaluators),
+ seed(1), batchSize(100), center(nrv), stdv(1.0), nextSample(0),
+ batchNumber(0), batchFirst(0), batchCount(0), numBusy(0), stopWorkers(false),
+ statistics(nlsf), failures(nlsf, 0), failureHasOccured(false), govCov(999.0)
+{
+
+}
+
+
+ParallelSampling::~ParallelSampling()
+{
+
+}
+
+
+void
+ParallelSampling::setSeed(unsigned long s)
+{
+	seed = s;
+}
+
+
+void
+ParallelSampling::setBatchSize(int size)
+{
+	batchSize = size > 0 ? size : 1;
+}
+
+
+void
+ParallelSampling::setSamplingDensity(const Vector &c, double s)
+{
+	center = c;
+	stdv = s;
+}
+
+
+static inline uint64_t
+splitmix64(uint64_t &state)
+{
+	uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+
+void
+ParallelSampling::standardNormal(unsigned long seed, long sample, Vector &z)
+{
+	// the stream of each sample starts from a hash of (seed, sample)
+	uint64_t state = (uint64_t)seed*0xD1B54A32D192ED03ULL + (uint64_t)sample;
+	state = splitmix64(state);
+
+	static const double twopi = 2.0*acos(-1.0);
+	int n = z.Size();
+	for (int i = 0; i < n; i += 2) {
+		// uniform numbers in (0,1)
+		double u1 = ((splitmix64(state) >> 11) + 0.5)*(1.0/9007199254740992.0);
+		double u2 = ((splitmix64(state) >> 11) + 0.5)*(1.0/9007199254740992.0);
+
+		// Box-Muller
+		double r = sqrt(-2.0*log(u1));
+		z(i) = r*cos(twopi*u2);
+		if (i + 1 < n)
+			z(i+1) = r*sin(twopi*u2);
+	}
+}
+
+
+int
+ParallelSampling::evaluateBatch(int worker, long first, int size, int analysisType)
+{
+	SampleEvaluator *theEvaluator = theEvaluators[worker];
+
+	Vector z(numRV);
+	Vector u(numRV);
+	Vector g(numLsf);
+	const double scale = pow(stdv, numRV);
+
+	long i;
+	while ((i = nextSample++) < size) {
+
+		standardNormal(seed, first + i, z);
+		u = center;
+		u.addVector(1.0, z, stdv);
+
+		g.Zero();
+		status[i] = theEvaluator->evaluate(u, g);
+		if (status[i] < 0) {
+			// register a failed analysis as failure
+			for (int lsf = 0; lsf < numLsf; lsf++)
+				g(lsf) = -1.0;
+		}
+
+		Vector &qi = q[i];
+		if (analysisType == FailureProbability) {
+			// phi(u)/h(u) for h = N(center, stdv^2 I)
+			double weight = scale*exp(-0.5*((u^u) - (z^z)));
+			for (int lsf = 0; lsf < numLsf; lsf++)
+				qi(lsf) = g(lsf) < 0.0 ? weight : 0.0;
+		}
+		else
+			qi = g;
+	}
+
+	return 0;
+}
+
+
+void
+ParallelSampling::work(int worker, int analysisType)
+{
+	// the evaluator is set up on the thread that evaluates it
+	SampleEvaluator *theEvaluator = theEvaluators[worker];
+	bool isSetUp = theEvaluator->setUp() >= 0;
+	if (!isSetUp)
+		opserr << "WARNING ParallelSampling -- could not set up sample evaluator "
+		       << worker << "; its share of the samples goes to the others" << endln;
+
+	long batch = 0;
+	std::unique_lock<std::mutex> lock(theMutex);
+	while (true) {
+		batchStarted.wait(lock, [&]{return stopWorkers || batchNumber != batch;});
+		if (stopWorkers)
+			break;
+		batch = batchNumber;
+		long first = batchFirst;
+		int size = batchCount;
+		lock.unlock();
+
+		if (isSetUp)
+			this->evaluateBatch(worker, first, size, analysisType);
+
+		lock.lock();
+		if (--numBusy == 0)
+			batchDone.notify_all();
+	}
+	lock.unlock();
+
+	theEvaluator->tearDown();
+}
+
+
+int
+ParallelSampling::run(int analysisType, long maxSamples, double targetCov, int printFlag)
+{
+	if (analysisType != FailureProbability && analysisType != ResponseStatistics) {
+		opserr << "ParallelSampling::run() - invalid analysis type " << analysisType << endln;
+		return -1;
+	}
+
+	int numWorkers = theEvaluators.size();
+	if (numWorkers < 1) {
+		opserr << "ParallelSampling::run() - no sample evaluators" << endln;
+		return -1;
+	}
+
+	statistics = SamplingStatistics(numLsf);
+	failures.assign(numLsf, 0);
+	failureHasOccured = false;
+	govCov = 999.0;
+
+	// at least two samples are always taken
+	if (maxSamples < 2)
+		maxSamples = 2;
+
+	// the calling thread works with the first evaluator; the other
+	// evaluators get a thread each for the whole run
+	if (theEvaluators[0]->setUp() < 0) {
+		opserr << "ParallelSampling::run() - could not set up the sample evaluator" << endln;
+		theEvaluators[0]->tearDown();
+		return -1;
+	}
+	batchNumber = 0;
+	stopWorkers = false;
+	std::vector<std::thread> threads;
+	for (int w = 1; w < numWorkers; w++)
+		threads.emplace_back(&ParallelSampling::work, this, w, analysisType);
+
+	long k = 0;
+	while (k < maxSamples && govCov > targetCov) {
+
+		int size = batchSize;
+		if (k + size > maxSamples)
+			size = maxSamples - k;
+
+		q.assign(size, Vector(numLsf));
+		status.assign(size, 0);
+		nextSample = 0;
+
+		{
+			std::lock_guard<std::mutex> lock(theMutex);
+			batchFirst = k;
+			batchCount = size;
+			numBusy = numWorkers - 1;
+			batchNumber++;
+		}
+		batchStarted.notify_all();
+
+		this->evaluateBatch(0, k, size, analysisType);
+
+		{
+			std::unique_lock<std::mutex> lock(theMutex);
+			batchDone.wait(lock, [&]{return numBusy == 0;});
+		}
+
+		// merge in sample order
+		int numFailedAnalyses = 0;
+		for (int i = 0; i < size; i++) {
+			if (status[i] < 0)
+				numFailedAnalyses++;
+
+			if (analysisType == FailureProbability) {
+				for (int lsf = 0; lsf < numLsf; lsf++)
+					if (q[i](lsf) > 0.0) {
+						failures[lsf]++;
+						failureHasOccured = true;
+					}
+			}
+			else
+				failureHasOccured = true;
+
+			statistics.add(q[i]);
+		}
+		k += size;
+
+		if (numFailedAnalyses > 0)
+			opserr << "WARNING ParallelSampling -- " << numFailedAnalyses
+			       << " analyses failed in samples " << k - size + 1 << " to " << k << endln;
+
+		// governing coefficient of variation
+		govCov = 0.0;
+		for (int lsf = 0; lsf < numLsf; lsf++)
+			if (statistics.getCovOfMean(lsf) > govCov)
+				govCov = statistics.getCovOfMean(lsf);
+
+		// the cov is zero until a failure is found, or if only the
+		// same q has been sampled
+		if (!failureHasOccured || govCov == 0.0)
+			govCov = 999.0;
+
+		if (printFlag != 0) {
+			char myString[80];
+			opserr << "Samples 1 to " << k << ":" << endln;
+			for (int lsf = 0; lsf < numLsf; lsf++) {
+				sprintf(myString, " GFun #%d, estimate:%15.10f, cov:%15.10f",
+					lsf + 1, statistics.getMean(lsf), statistics.getCovOfMean(lsf));
+				opserr << myString << endln;
+			}
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(theMutex);
+		stopWorkers = true;
+	}
+	batchStarted.notify_all();
+	for (std::thread &thread : threads)
+		thread.join();
+
+	theEvaluators[0]->tearDown();
+
+	return 0;
+}
@@ -0,0 +1,185 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+
+//
+// Description: ParallelSampling drives a simulation analysis over a
+// set of independent SampleEvaluator objects, one per thread. Each
+// evaluator owns its own finite element domain (or a copy of it), so
+// that samples can be evaluated concurrently. The worker threads live
+// for the whole run, so an evaluator may bind its model to the thread
+// that evaluates it (e.g. a Tcl interpreter) in setUp().
+//
+// Sample i always draws its standard normal numbers from its own
+// counter-based stream, seeded by (seed, i), and the results of each
+// batch are merged into the running statistics in sample order. The
+// estimates, and the sample at which the CoV criterion stops the
+// analysis, therefore do not depend on the number of threads.
+//
+
+#ifndef ParallelSampling_h
+#define ParallelSampling_h
+
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <Vector.h>
+#include <Matrix.h>
+#include <tcl.h>
+
+class ReliabilityDomain;
+class Domain;
+class ProbabilityTransformation;
+class FunctionEvaluator;
+
+class SampleEvaluator
+{
+public:
+	virtual ~SampleEvaluator() {};
+
+	// Called on the thread that evaluates the samples, before the
+	// first and after the last sample of a run; tearDown() is also
+	// called if setUp() failed.
+	virtual int  setUp(void) {return 0;}
+	virtual void tearDown(void) {}
+
+	// Evaluate the limit-state functions at the point u in standard
+	// normal space. Returns a negative value if the analysis failed.
+	virtual int evaluate(const Vector &u, Vector &g) = 0;
+};
+
+
+//
+// Evaluates a sample on a given reliability and finite element domain:
+// the parameters of the random variables are updated to x(u), and then
+// either the limit-state functions are evaluated, or, if a Tcl file is
+// set, the file is run after resetting the model.
+//
+class DomainSampleEvaluator : public SampleEvaluator
+{
+public:
+	DomainSampleEvaluator(ReliabilityDomain *theReliabilityDomain, Domain *theOpenSeesDomain,
+			      ProbabilityTransformation *theProbabilityTransformation,
+			      FunctionEvaluator *theGFunEvaluator);
+
+	void setTclFileToRun(Tcl_Interp *interp, const char *fileName);
+
+	int evaluate(const Vector &u, Vector &g);
+
+private:
+	ReliabilityDomain *theReliabilityDomain;
+	Domain *theOpenSeesDomain;
+	ProbabilityTransformation *theProbabilityTransformation;
+	FunctionEvaluator *theGFunEvaluator;
+	Tcl_Interp *theTclInterp;
+	const char *tclFileToRun;
+	Vector x;
+};
+
+
+//
+// Running mean, variance and correlation of a vector valued sample,
+// updated one sample at a time (Welford).
+//
+class SamplingStatistics
+{
+public:
+	SamplingStatistics(int size);
+
+	void   add(const Vector &q);
+	long   getCount() const {return n;}
+	double getMean(int i) const {return mean(i);}
+	double getVariance(int i) const;    // unbiased sample variance
+	double getCovOfMean(int i) const;   // coefficient of variation of the mean
+	double getCorrelation(int i, int j) const;
+
+private:
+	long   n;
+	Vector mean;
+	Vector delta;
+	Matrix comoment; // sum of (q_i - mean_i)(q_j - mean_j)
+};
+
+
+class ParallelSampling
+{
+public:
+	enum {FailureProbability = 1, ResponseStatistics = 2};
+
+	ParallelSampling(int numRV, int numLsf,
+			 SampleEvaluator **evaluators, int numEvaluators);
+	~ParallelSampling();
+
+	void setSeed(unsigned long seed);
+	void setBatchSize(int size);
+
+	// sample around center with standard deviation stdv in standard
+	// normal space and weight the samples by phi(u)/h(u)
+	void setSamplingDensity(const Vector &center, double stdv);
+
+	int  run(int analysisType, long maxSamples, double targetCov, int printFlag);
+
+	const SamplingStatistics &getStatistics() const {return statistics;}
+	long   getNumberOfFailures(int lsf) const {return failures[lsf];}
+	bool   hasFailureOccurred() const {return failureHasOccured;}
+	double getGoverningCov() const {return govCov;}
+
+	// z = standard normal numbers of stream (seed, sample)
+	static void standardNormal(unsigned long seed, long sample, Vector &z);
+
+private:
+	void work(int worker, int analysisType);
+	int  evaluateBatch(int worker, long first, int size, int analysisType);
+
+	int numRV;
+	int numLsf;
+	std::vector<SampleEvaluator*> theEvaluators;
+
+	unsigned long seed;
+	int    batchSize;
+	Vector center;
+	double stdv;
+
+	// batch results, one row per sample
+	std::vector<Vector> q;
+	std::vector<int>    status;
+	std::atomic<long> nextSample;    // shared counter within a batch
+
+	// hand-over of batches to the worker threads
+	std::mutex theMutex;
+	std::condition_variable batchStarted;
+	std::condition_variable batchDone;
+	long batchNumber;
+	long batchFirst;
+	int  batchCount;
+	int  numBusy;
+	bool stopWorkers;
+
+	SamplingStatistics statistics;
+	std::vector<long>  failures;
+	bool   failureHasOccured;
+	double govCov;
+};
+
+#endif
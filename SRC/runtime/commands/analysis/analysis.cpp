@@ -95,6 +95,8 @@ extern Tcl_CmdProc TclCommand_numFact;
 extern Tcl_CmdProc specifyCTest;
 extern Tcl_CmdProc getCTestNorms;
 extern Tcl_CmdProc getCTestIter;
+// from commands/analysis/recovery.cpp
+extern Tcl_CmdProc TclCommand_recovery;
 
 
 DOF_Numberer* G3Parse_newNumberer(G3_Runtime*, int, G3_Char**const);
@@ -134,6 +136,7 @@ G3_AddTclAnalysisAPI(Tcl_Interp *interp, Domain* domain)
   Tcl_CreateCommand(interp, "printA",            &printA,          builder, nullptr);
   Tcl_CreateCommand(interp, "printB",            &printB,          builder, nullptr);
   Tcl_CreateCommand(interp, "reset",             &resetModel,      builder, nullptr);
+  Tcl_CreateCommand(interp, "recovery",          &TclCommand_recovery, builder, nullptr);
 
   // From algorithm.cpp
   Tcl_CreateCommand(interp, "algorithm", &TclCommand_specifyAlgorithm,  builder, nullptr);
@@ -656,6 +659,10 @@ printA(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const ar
   else if (builder->getTransientIntegrator() != nullptr)
     builder->getTransientIntegrator()->formTangent(0);
 
+  // modal damping is kept out of A until it is asked for
+  if (theSOE->assembleLowRankUpdate() < 0)
+    return TCL_ERROR;
+
   const Matrix *A = theSOE->getA();
   if (A == nullptr) {
     opserr << G3_ERROR_PROMPT << "Could not get matrix from linear system\n";
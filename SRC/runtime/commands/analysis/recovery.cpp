@@ -0,0 +1,229 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: This file implements the recovery command, which
+// configures the AnalysisDriver used by analyze to recover from steps
+// that fail to converge:
+//
+//   recovery add -algorithm {type args...} ?-test {type args...}? ?-label name?
+//   recovery set ?-cut f? ?-grow f? ?-minStep f? ?-maxAttempts n? ?-verbose flag?
+//   recovery log ?-clear?
+//   recovery clear
+//
+// Strategies are tried in the order in which they are added, after the
+// algorithm of the analysis has failed. The log is a list with one
+// dictionary per attempt.
+//
+#include <assert.h>
+#include <string.h>
+#include <vector>
+
+#include <tcl.h>
+#include <G3_Logging.h>
+#include <EquiSolnAlgo.h>
+#include <ConvergenceTest.h>
+#include "runtime/BasicAnalysisBuilder.h"
+#include "runtime/AnalysisDriver.h"
+
+extern "C" int OPS_ResetInputNoBuilder(ClientData clientData,
+                                       Tcl_Interp *interp, int cArg, int mArg,
+                                       TCL_Char ** const argv, Domain *domain);
+
+EquiSolnAlgo *G3Parse_newEquiSolnAlgo(ClientData, Tcl_Interp *, int, TCL_Char ** const);
+ConvergenceTest *TclDispatch_newConvergenceTest(ClientData, Tcl_Interp *, int, TCL_Char ** const);
+
+static const char *actionNames[] = {"converged", "fallback", "cut", "grow", "abandon"};
+
+//
+// Split a command given as a list, e.g. {NewtonLineSearch -type Bisection},
+// into the argv of the command named by name.
+//
+static int
+splitCommand(Tcl_Interp *interp, const char *name, TCL_Char *list,
+             std::vector<TCL_Char *> &words, TCL_Char **&items)
+{
+  int n;
+  if (Tcl_SplitList(interp, list, &n, &items) != TCL_OK)
+    return TCL_ERROR;
+
+  if (n < 1) {
+    Tcl_Free((char *)items);
+    opserr << G3_ERROR_PROMPT << "empty " << name << " given\n";
+    return TCL_ERROR;
+  }
+
+  words.assign(1, name);
+  words.insert(words.end(), items, items + n);
+  return TCL_OK;
+}
+
+static int
+addStrategy(BasicAnalysisBuilder *builder, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  TCL_Char *algorithm = nullptr;
+  TCL_Char *test = nullptr;
+  TCL_Char *label = nullptr;
+
+  for (int argi = 2; argi < argc; argi++) {
+    if (strcmp(argv[argi], "-algorithm") == 0 && argi+1 < argc)
+      algorithm = argv[++argi];
+    else if (strcmp(argv[argi], "-test") == 0 && argi+1 < argc)
+      test = argv[++argi];
+    else if (strcmp(argv[argi], "-label") == 0 && argi+1 < argc)
+      label = argv[++argi];
+    else {
+      opserr << G3_ERROR_PROMPT << "unknown option '" << argv[argi] << "'\n";
+      return TCL_ERROR;
+    }
+  }
+
+  if (algorithm == nullptr) {
+    opserr << G3_ERROR_PROMPT << "want: recovery add -algorithm {type args...} "
+           << "?-test {type args...}? ?-label name?\n";
+    return TCL_ERROR;
+  }
+
+  std::vector<TCL_Char *> words;
+  TCL_Char **items;
+
+  ConvergenceTest *theTest = nullptr;
+  if (test != nullptr) {
+    if (splitCommand(interp, "test", test, words, items) != TCL_OK)
+      return TCL_ERROR;
+    theTest = TclDispatch_newConvergenceTest(builder, interp, (int)words.size(), words.data());
+    Tcl_Free((char *)items);
+    if (theTest == nullptr)
+      return TCL_ERROR;
+  }
+
+  if (splitCommand(interp, "algorithm", algorithm, words, items) != TCL_OK) {
+    delete theTest;
+    return TCL_ERROR;
+  }
+  OPS_ResetInputNoBuilder(nullptr, interp, 2, (int)words.size(), words.data(), nullptr);
+  EquiSolnAlgo *theAlgorithm = G3Parse_newEquiSolnAlgo(builder, interp, (int)words.size(), words.data());
+  Tcl_Free((char *)items);
+  if (theAlgorithm == nullptr) {
+    delete theTest;
+    return TCL_ERROR;
+  }
+
+  AnalysisDriver *theDriver = builder->getDriver();
+  if (theDriver == nullptr) {
+    theDriver = new AnalysisDriver(*builder);
+    builder->set(theDriver);
+  }
+
+  int strategy = theDriver->addStrategy(theAlgorithm, theTest, label != nullptr ? label : algorithm);
+  Tcl_SetObjResult(interp, Tcl_NewIntObj(strategy));
+  return TCL_OK;
+}
+
+static int
+setOptions(BasicAnalysisBuilder *builder, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  AnalysisDriver *theDriver = builder->getDriver();
+  if (theDriver == nullptr) {
+    theDriver = new AnalysisDriver(*builder);
+    builder->set(theDriver);
+  }
+
+  for (int argi = 2; argi < argc; argi++) {
+    if (argi+1 >= argc) {
+      opserr << G3_ERROR_PROMPT << "missing value for '" << argv[argi] << "'\n";
+      return TCL_ERROR;
+    }
+
+    double value;
+    int ivalue;
+    if (strcmp(argv[argi], "-cut") == 0) {
+      if (Tcl_GetDouble(interp, argv[++argi], &value) != TCL_OK || theDriver->setCutFactor(value) < 0)
+        return TCL_ERROR;
+    }
+    else if (strcmp(argv[argi], "-grow") == 0) {
+      if (Tcl_GetDouble(interp, argv[++argi], &value) != TCL_OK || theDriver->setGrowFactor(value) < 0)
+        return TCL_ERROR;
+    }
+    else if (strcmp(argv[argi], "-minStep") == 0) {
+      if (Tcl_GetDouble(interp, argv[++argi], &value) != TCL_OK || theDriver->setMinStep(value) < 0)
+        return TCL_ERROR;
+    }
+    else if (strcmp(argv[argi], "-maxAttempts") == 0) {
+      if (Tcl_GetInt(interp, argv[++argi], &ivalue) != TCL_OK || theDriver->setMaxAttempts(ivalue) < 0)
+        return TCL_ERROR;
+    }
+    else if (strcmp(argv[argi], "-verbose") == 0) {
+      if (Tcl_GetBoolean(interp, argv[++argi], &ivalue) != TCL_OK)
+        return TCL_ERROR;
+      theDriver->setVerbose(ivalue != 0);
+    }
+    else {
+      opserr << G3_ERROR_PROMPT << "unknown option '" << argv[argi] << "'\n";
+      return TCL_ERROR;
+    }
+  }
+  return TCL_OK;
+}
+
+static int
+getLog(BasicAnalysisBuilder *builder, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  AnalysisDriver *theDriver = builder->getDriver();
+
+  Tcl_Obj *result = Tcl_NewListObj(0, nullptr);
+  if (theDriver != nullptr) {
+    for (const AnalysisDriver::Record &entry : theDriver->getLog()) {
+      Tcl_Obj *dict = Tcl_NewDictObj();
+      Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("step", -1),     Tcl_NewIntObj(entry.step));
+      Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("time", -1),     Tcl_NewDoubleObj(entry.time));
+      Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("fraction", -1), Tcl_NewDoubleObj(entry.fraction));
+      Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("strategy", -1), Tcl_NewIntObj(entry.strategy));
+      Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("label", -1),
+                     Tcl_NewStringObj(theDriver->getStrategyLabel(entry.strategy), -1));
+      Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("result", -1),   Tcl_NewIntObj(entry.result));
+      Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("iterations", -1), Tcl_NewIntObj(entry.numIter));
+      Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("action", -1),
+                     Tcl_NewStringObj(actionNames[entry.action], -1));
+      Tcl_ListObjAppendElement(interp, result, dict);
+    }
+
+    if (argc > 2 && strcmp(argv[2], "-clear") == 0)
+      theDriver->clearLog();
+  }
+
+  Tcl_SetObjResult(interp, result);
+  return TCL_OK;
+}
+
+int
+TclCommand_recovery(ClientData clientData, Tcl_Interp *interp, int argc,
+                    TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder *)clientData;
+
+  if (argc < 2) {
+    opserr << G3_ERROR_PROMPT << "want: recovery add|set|log|clear ...\n";
+    return TCL_ERROR;
+  }
+
+  if (strcmp(argv[1], "add") == 0)
+    return addStrategy(builder, interp, argc, argv);
+
+  else if (strcmp(argv[1], "set") == 0)
+    return setOptions(builder, interp, argc, argv);
+
+  else if (strcmp(argv[1], "log") == 0)
+    return getLog(builder, interp, argc, argv);
+
+  else if (strcmp(argv[1], "clear") == 0) {
+    // the builder deletes the driver it holds
+    builder->set((AnalysisDriver *)nullptr);
+    return TCL_OK;
+  }
+
+  opserr << G3_ERROR_PROMPT << "unknown recovery subcommand '" << argv[1] << "'\n";
+  return TCL_ERROR;
+}
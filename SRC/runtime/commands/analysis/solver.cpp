@@ -177,6 +177,60 @@ G3Parse_newLinearSOE(ClientData clientData, Tcl_Interp* interp, int argc, G3_Cha
 }
 
 
+LinearSOE*
+specify_ProfileSPD(G3_Runtime *rt, int argc, G3_Char ** const argv)
+{
+  // system ProfileSPD <-mixed> <-tol $tol> <-maxIter $n> <-print>
+  //                   <-outOfCore $budgetMB> <-scratch $dir>
+  Tcl_Interp *interp = G3_getInterpreter(rt);
+
+  bool mixed = false;
+  double tol = 1.0e-12;
+  int maxIter = 10;
+  int printFlag = 0;
+  double budgetMB = 0.0;
+  const char *scratchDir = nullptr;
+
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "-mixed") == 0) {
+      mixed = true;
+    } else if (strcmp(argv[i], "-tol") == 0 && i+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[++i], &tol) != TCL_OK)
+        return nullptr;
+    } else if (strcmp(argv[i], "-maxIter") == 0 && i+1 < argc) {
+      if (Tcl_GetInt(interp, argv[++i], &maxIter) != TCL_OK)
+        return nullptr;
+    } else if (strcmp(argv[i], "-print") == 0) {
+      printFlag = 1;
+    } else if (strcmp(argv[i], "-outOfCore") == 0 && i+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[++i], &budgetMB) != TCL_OK)
+        return nullptr;
+      if (budgetMB <= 0.0) {
+        opserr << G3_ERROR_PROMPT << "system ProfileSPD - -outOfCore needs a positive memory budget in MB\n";
+        return nullptr;
+      }
+    } else if (strcmp(argv[i], "-scratch") == 0 && i+1 < argc) {
+      scratchDir = argv[++i];
+    }
+    // other arguments are ignored, as they always have been
+  }
+
+  if (mixed && budgetMB > 0.0) {
+    opserr << G3_ERROR_PROMPT << "system ProfileSPD - -mixed and -outOfCore cannot be combined\n";
+    return nullptr;
+  }
+
+  ProfileSPDLinSolver *theSolver;
+  if (budgetMB > 0.0)
+    theSolver = new ProfileSPDLinOutOfCoreSolver(budgetMB*1024.0*1024.0, scratchDir, tol);
+  else if (mixed)
+    theSolver = new ProfileSPDLinMixedSolver(tol, maxIter, printFlag);
+  else
+    theSolver = new ProfileSPDLinDirectSolver();
+
+  return new ProfileSPDLinSOE(*theSolver);
+}
+
 LinearSOE*
 specify_SparseSPD(G3_Runtime *rt, int argc, G3_Char ** const argv)
 {
@@ -184,17 +238,41 @@ specify_SparseSPD(G3_Runtime *rt, int argc, G3_Char ** const argv)
 //         (strcmp(argv[1], "SparseSYM") == 0)) {
     Tcl_Interp *interp = G3_getInterpreter(rt);
 
+    // system SparseSPD <$ordering> <-threads $n>
+    //                  <-mixed> <-tol $tol> <-maxIter $n> <-print>
+    //
     // determine ordering scheme
     //   1 -- MMD
     //   2 -- ND
     //   3 -- RCM
 
     int lSparse = 1;
-    if (argc == 3) {
-      if (Tcl_GetInt(interp, argv[2], &lSparse) != TCL_OK)
+    int numThreads = 1;
+    bool mixed = false;
+    double tol = 1.0e-12;
+    int maxIter = 10;
+    int printFlag = 0;
+    for (int i = 2; i < argc; i++) {
+      if (strcmp(argv[i], "-threads") == 0 && i+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++i], &numThreads) != TCL_OK)
+          return nullptr;
+      } else if (strcmp(argv[i], "-mixed") == 0) {
+        mixed = true;
+      } else if (strcmp(argv[i], "-tol") == 0 && i+1 < argc) {
+        if (Tcl_GetDouble(interp, argv[++i], &tol) != TCL_OK)
+          return nullptr;
+      } else if (strcmp(argv[i], "-maxIter") == 0 && i+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++i], &maxIter) != TCL_OK)
+          return nullptr;
+      } else if (strcmp(argv[i], "-print") == 0) {
+        printFlag = 1;
+      } else if (Tcl_GetInt(interp, argv[i], &lSparse) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "system SparseSPD - unknown option '" << argv[i] << "'\n";
         return nullptr;
+      }
     }
-    SymSparseLinSolver *theSolver = new SymSparseLinSolver();
+    SymSparseLinSolver *theSolver = 
+      new SymSparseLinSolver(numThreads, mixed, tol, maxIter, printFlag);
     return new SymSparseLinSOE(*theSolver, lSparse);
 }
 
@@ -29,6 +29,8 @@
 //
 #include <ProfileSPDLinSOE.h>
 #include <ProfileSPDLinDirectSolver.h>
+#include <ProfileSPDLinMixedSolver.h>
+#include <ProfileSPDLinOutOfCoreSolver.h>
 #include <DistributedProfileSPDLinSOE.h>
 //
 #include <DiagonalSOE.h>
@@ -94,6 +96,7 @@ typedef LinearSOE*(G3_SysOfEqnSpecifier)(G3_Runtime*, int, G3_Char**);
 
 // Specifiers defined in solver.cpp
 G3_SysOfEqnSpecifier specify_SparseSPD;
+G3_SysOfEqnSpecifier specify_ProfileSPD;
 G3_SysOfEqnSpecifier specifySparseGen;
 TclDispatch<LinearSOE*> TclDispatch_newMumpsLinearSOE;
 // TclDispatch<LinearSOE*> TclDispatch_newUmfpackLinearSOE;
@@ -160,7 +163,7 @@ std::unordered_map<std::string, struct soefps> soe_table = {
      MP_SOE(SProfileSPDLinSolver,        SProfileSPDLinSOE)}},
 
   {"profilespd", {
-     G3_SOE(ProfileSPDLinDirectSolver,   ProfileSPDLinSOE),
+     specify_ProfileSPD,
      SP_SOE(ProfileSPDLinDirectSolver,   DistributedProfileSPDLinSOE),
      MP_SOE(ProfileSPDLinDirectSolver,   DistributedProfileSPDLinSOE)}},
 
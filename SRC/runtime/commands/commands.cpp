@@ -65,10 +65,8 @@
 //
 // Global variables
 //
-class ModelBuilder;
 StaticAnalysis        *theStaticAnalysis = nullptr;
 ConstraintHandler     *theHandler = nullptr;
-ModelBuilder          *theBuilder         = nullptr;
 EquiSolnAlgo          *theAlgorithm       = nullptr;
 DOF_Numberer          *theGlobalNumberer      = nullptr;
 LinearSOE             *theSOE                 = nullptr;
@@ -91,6 +89,8 @@ extern "C" int OPS_ResetInputNoBuilder(ClientData clientData,
 Tcl_CmdProc TclCommand_record;
 Tcl_CmdProc TclCommand_setLoadConst;
 Tcl_CmdProc TclCommand_setCreep;
+Tcl_CmdProc TclCommand_setIncrementalUpdate;
+Tcl_CmdProc TclCommand_setMaterialBatch;
 
 
 // TODO: reimplement defaultUnits and setParameter
@@ -110,6 +110,7 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
 
   Tcl_CreateCommand(interp, "recorder",          &TclAddRecorder,  domain, nullptr);
   Tcl_CreateCommand(interp, "region",              &addRegion,     domain, nullptr);
+  Tcl_CreateCommand(interp, "contact",             &addContact,    domain, nullptr);
 
 
   Tcl_CreateCommand(interp, "printGID",            &printModelGID, domain, nullptr);
@@ -117,12 +118,16 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
   Tcl_CreateCommand(interp, "setTime",             &TclCommand_setTime,  domain, nullptr);
   Tcl_CreateCommand(interp, "getTime",             &TclCommand_getTime,  domain, nullptr);
   Tcl_CreateCommand(interp, "setCreep",            &TclCommand_setCreep, nullptr, nullptr);
+  Tcl_CreateCommand(interp, "incrementalUpdate",   &TclCommand_setIncrementalUpdate, domain, nullptr);
+  Tcl_CreateCommand(interp, "materialBatch",       &TclCommand_setMaterialBatch, domain, nullptr);
 
   // DAMPING
   Tcl_CreateCommand(interp, "rayleigh",            &rayleighDamping, domain, nullptr);
 
   Tcl_CreateCommand(interp, "setElementRayleighDampingFactors", &TclCommand_addElementRayleigh, domain, nullptr);
   Tcl_CreateCommand(interp, "setElementRayleighFactors",        &TclCommand_addElementRayleigh, domain, nullptr);
+  Tcl_CreateCommand(interp, "activateElements",    &elementActivate,     domain, nullptr);
+  Tcl_CreateCommand(interp, "deactivateElements",  &elementDeactivate,   domain, nullptr);
   Tcl_CreateCommand(interp, "getLoadFactor",       &getLoadFactor, domain, nullptr);
   Tcl_CreateCommand(interp, "localForce",          &localForce,    domain, nullptr);
   Tcl_CreateCommand(interp, "eleType",             &eleType,       domain, nullptr);
@@ -145,6 +150,7 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
   Tcl_CreateCommand(interp, "nodePressure",        &nodePressure,        domain, nullptr);
   Tcl_CreateCommand(interp, "nodeBounds",          &nodeBounds,          domain, nullptr);
   Tcl_CreateCommand(interp, "findNodeWithID",      &findID,              domain, nullptr);
+  Tcl_CreateCommand(interp, "findNodes",           &findNodes,           domain, nullptr);
   Tcl_CreateCommand(interp, "nodeUnbalance",       &nodeUnbalance,       domain, nullptr);
   Tcl_CreateCommand(interp, "nodeEigenvector",     &nodeEigenvector,     domain, nullptr);
 
@@ -167,6 +173,7 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
   Tcl_CreateObjCommand(interp, "constrainedDOFs",     &constrainedDOFs,     domain, nullptr);
   Tcl_CreateObjCommand(interp, "domainChange",        &domainChange,        domain, nullptr);
   Tcl_CreateObjCommand(interp, "remove",              &removeObject,        domain, nullptr);
+  Tcl_CreateObjCommand(interp, "reorder",             &reorderDomain,       domain, nullptr);
   Tcl_CreateCommand(interp, "retainedNodes",       &retainedNodes,       domain, nullptr);
   Tcl_CreateCommand(interp, "retainedDOFs",        &retainedDOFs,        domain, nullptr);
 
@@ -186,6 +193,7 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
 
   Tcl_CreateCommand(interp, "recorderValue",       &OPS_recorderValue,   domain, nullptr);
   Tcl_CreateCommand(interp, "record",              &TclCommand_record,   domain, nullptr);
+  Tcl_CreateCommand(interp, "database",            &addDatabase,         domain, nullptr);
 
   Tcl_CreateCommand(interp, "updateElementDomain", &updateElementDomain, nullptr, nullptr);
 
@@ -196,7 +204,6 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
 //   Tcl_CreateCommand(interp, "setParameter", &setParameter, nullptr, nullptr);
 
   // Tcl_CreateCommand(interp, "sdfResponse",      &sdfResponse, nullptr, nullptr);
-  // Tcl_CreateCommand(interp, "database", &addDatabase, nullptr, nullptr);
 
   // wipeAnalysis(0, interp, 0, 0);
   return TCL_OK;
@@ -1486,3 +1493,14 @@ addRegion(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const
   return TclAddMeshRegion(clientData, interp, argc, argv, *the_domain);
 }
 
+extern int TclAddContactManager(ClientData clientData, Tcl_Interp *interp, int argc,
+                                TCL_Char ** const argv, Domain &theDomain);
+
+int
+addContact(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  Domain *the_domain = (Domain*)clientData;
+  return TclAddContactManager(clientData, interp, argc, argv, *the_domain);
+}
+
@@ -8,6 +8,8 @@
 
 // domain/element.cpp
 Tcl_CmdProc TclCommand_addElementRayleigh;
+Tcl_CmdProc elementActivate;
+Tcl_CmdProc elementDeactivate;
 //
 
 Tcl_CmdProc getNumElements;
@@ -47,6 +49,7 @@ Tcl_CmdProc eleDynamicalForce;
 Tcl_CmdProc eleResponse;
 
 Tcl_CmdProc findID;
+Tcl_CmdProc findNodes;
 
 Tcl_CmdProc nodeDisp;
 
@@ -95,6 +98,7 @@ Tcl_ObjCmdProc constrainedNodes;
 Tcl_ObjCmdProc fixedDOFs;
 Tcl_ObjCmdProc constrainedDOFs;
 Tcl_ObjCmdProc domainChange;
+Tcl_ObjCmdProc reorderDomain;
 
 Tcl_CmdProc retainedDOFs;
 Tcl_CmdProc nodeDOFs;
@@ -130,6 +134,7 @@ Tcl_CmdProc modalDamping;
 Tcl_CmdProc modalDampingQ;
 
 Tcl_CmdProc addRegion;
+Tcl_CmdProc addContact;
 
 Tcl_CmdProc sectionForce;
 
@@ -44,6 +44,7 @@
 
 // known databases
 #include <FileDatastore.h>
+#include <PackedDatastore.h>
 
 // linked list of struct for other types of
 // databases that can be added dynamically
@@ -60,7 +61,6 @@ typedef struct databasePackageCommand {
 
 // static variables
 static DatabasePackageCommand *theDatabasePackageCommands = NULL;
-static bool createdDatabaseCommands = false;
 
 int save(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv);
 
@@ -72,21 +72,16 @@ int
 TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv,
                Domain &theDomain, FEM_ObjectBroker &theBroker)
 {
-  if (createdDatabaseCommands == false) {
-
-    // create the commands to commit and reset
-    Tcl_CreateCommand(interp, "save", save, (ClientData)NULL,
-                      (Tcl_CmdDeleteProc *)NULL);
-    Tcl_CreateCommand(interp, "restore", restore, (ClientData)NULL,
-                      (Tcl_CmdDeleteProc *)NULL);
-
-    createdDatabaseCommands = true;
-  }
+  // create the commands to commit and reset in this interpreter
+  Tcl_CreateCommand(interp, "save", save, (ClientData)NULL,
+                    (Tcl_CmdDeleteProc *)NULL);
+  Tcl_CreateCommand(interp, "restore", restore, (ClientData)NULL,
+                    (Tcl_CmdDeleteProc *)NULL);
 
   // make sure at least one other argument to contain integrator
   if (argc < 2) {
     opserr << "WARNING need to specify a Database type; valid type File, "
-              "MySQL, BerkeleyDB \n";
+              "Packed, MySQL, BerkeleyDB \n";
     return TCL_ERROR;
   }
 
@@ -115,6 +110,20 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **
     }
 
     return TCL_OK;
+
+  // a File Database packing each commit into one file
+  } else if (strcmp(argv[1], "Packed") == 0) {
+    if (argc < 3) {
+      opserr << "WARNING database Packed fileBase? ";
+      return TCL_ERROR;
+    }
+
+    if (theDatabase != 0)
+      delete theDatabase;
+
+    theDatabase = new PackedDatastore(argv[2], theDomain, theBroker);
+    return TCL_OK;
+
   } else {
 
     //
@@ -1,3 +1,15 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: This file contains the function invoked for the
+// 'database' command; the Domain is passed as the clientData.
+//
+#include <assert.h>
+#include <tcl.h>
+#include <Domain.h>
+#include <TclPackageClassBroker.h>
 
 extern int TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc,
                           TCL_Char ** const argv, Domain &theDomain,
@@ -7,6 +19,11 @@ int
 addDatabase(ClientData clientData, Tcl_Interp *interp, int argc,
             TCL_Char ** const argv)
 {
-  return TclAddDatabase(clientData, interp, argc, argv, theDomain, theBroker);
-}
+  assert(clientData != nullptr);
+  Domain *theDomain = (Domain*)clientData;
+
+  // the broker the database uses to create the objects it restores
+  static TclPackageClassBroker theBroker;
 
+  return TclAddDatabase(clientData, interp, argc, argv, *theDomain, theBroker);
+}
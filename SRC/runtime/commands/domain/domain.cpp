@@ -32,6 +32,8 @@
 
 #include <Node.h>
 #include <Vector.h>
+#include <ID.h>
+#include <RCM.h>
 
 #define MAX_NDF 6
 
@@ -302,6 +304,56 @@ removeObject(ClientData clientData, Tcl_Interp *interp, int argc,
   return TCL_OK;
 }
 
+//
+// reorder -spaceFilling
+// reorder -graph
+// reorder -elements tag1? tag2? ...
+//
+int
+reorderDomain(ClientData clientData, Tcl_Interp *interp, int argc,
+              Tcl_Obj *const *objv)
+{
+  assert(clientData != nullptr);
+  Domain *domain = (Domain*)clientData;
+
+  if (argc < 2) {
+    opserr << "WARNING want - reorder -spaceFilling|-graph|-elements tag? ...\n";
+    return TCL_ERROR;
+  }
+
+  ID eleTags;
+  const char *option = Tcl_GetString(objv[1]);
+  if (strcmp(option, "-spaceFilling") == 0) {
+    domain->getSpaceFillingOrder(eleTags);
+
+  } else if (strcmp(option, "-graph") == 0) {
+    RCM theRCM;
+    if (domain->getGraphOrder(theRCM, eleTags) < 0)
+      return TCL_ERROR;
+
+  } else if (strcmp(option, "-elements") == 0) {
+    eleTags.resize(argc-2);
+    for (int i=2; i<argc; i++) {
+      int tag;
+      if (Tcl_GetIntFromObj(interp, objv[i], &tag) != TCL_OK) {
+        opserr << "WARNING reorder -elements - invalid element tag "
+               << Tcl_GetString(objv[i]) << "\n";
+        return TCL_ERROR;
+      }
+      eleTags(i-2) = tag;
+    }
+
+  } else {
+    opserr << "WARNING reorder - unknown option " << option << "\n";
+    return TCL_ERROR;
+  }
+
+  if (domain->reorder(eleTags) < 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
 
 int
 fixedNodes(ClientData clientData, Tcl_Interp *interp, int argc, Tcl_Obj *const *objv)
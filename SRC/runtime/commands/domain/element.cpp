@@ -8,6 +8,7 @@
 #include <tcl.h>
 #include <Domain.h>
 #include <Element.h>
+#include <ID.h>
 #include <Vector.h>
 #include <G3_Logging.h>
 
@@ -401,3 +402,71 @@ eleType(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const a
   return TCL_OK;
 }
 
+
+
+//
+// Element birth and death:
+//
+//   activateElements   eleTag? ...
+//   deactivateElements eleTag? ...
+//
+// Tags may be given as separate arguments or as lists. The elements stay
+// in the model, so switching them does not renumber or resize the system
+// of equations.
+//
+static int
+readElementTags(Tcl_Interp *interp, int argc, TCL_Char ** const argv, ID &tags)
+{
+  for (int i = 1; i < argc; i++) {
+    int numTags;
+    TCL_Char **items;
+    if (Tcl_SplitList(interp, argv[i], &numTags, &items) != TCL_OK)
+      return TCL_ERROR;
+
+    for (int j = 0; j < numTags; j++) {
+      int tag;
+      if (Tcl_GetInt(interp, items[j], &tag) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "invalid element tag " << items[j] << "\n";
+        Tcl_Free((char *)items);
+        return TCL_ERROR;
+      }
+      tags[tags.Size()] = tag;
+    }
+    Tcl_Free((char *)items);
+  }
+  return TCL_OK;
+}
+
+int
+elementActivate(ClientData clientData, Tcl_Interp *interp, int argc,
+                TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  Domain *the_domain = (Domain*)clientData;
+
+  ID tags(0, argc);
+  if (readElementTags(interp, argc, argv, tags) != TCL_OK)
+    return TCL_ERROR;
+
+  if (the_domain->activateElements(tags) != 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
+int
+elementDeactivate(ClientData clientData, Tcl_Interp *interp, int argc,
+                  TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  Domain *the_domain = (Domain*)clientData;
+
+  ID tags(0, argc);
+  if (readElementTags(interp, argc, argv, tags) != TCL_OK)
+    return TCL_ERROR;
+
+  if (the_domain->deactivateElements(tags) != 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
@@ -7,6 +7,7 @@
 // in the domain.
 //
 #include <math.h>
+#include <string.h>
 #include <assert.h>
 #include <tcl.h>
 #include <OPS_Globals.h>
@@ -42,6 +43,82 @@ getNodeTags(ClientData clientData, Tcl_Interp *interp, int argc,
   return TCL_OK;
 }
 
+extern int TclGetBox(Tcl_Interp *interp, int argc, TCL_Char ** const argv,
+                     int &loc, Vector &lo, Vector &hi);
+
+//
+// findNodes -box xmin? ymin? <zmin?> xmax? ymax? <zmax?>
+// findNodes -sphere x? y? <z?> radius?
+// findNodes -nearest x? y? <z?>
+//
+int
+findNodes(ClientData clientData, Tcl_Interp *interp, int argc,
+          TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  Domain *the_domain = (Domain*)clientData;
+
+  if (argc < 3) {
+    opserr << "WARNING want - findNodes -box|-sphere|-nearest ...\n";
+    return TCL_ERROR;
+  }
+
+  ID found;
+  int loc = 2;
+
+  if (strcmp(argv[1], "-box") == 0) {
+    Vector lo, hi;
+    if (TclGetBox(interp, argc, argv, loc, lo, hi) != 0) {
+      opserr << "WARNING findNodes -box xmin? .. xmax? .. - invalid box\n";
+      return TCL_ERROR;
+    }
+    the_domain->findNodesInBox(lo, hi, found);
+
+  } else if (strcmp(argv[1], "-sphere") == 0 || strcmp(argv[1], "-nearest") == 0) {
+    bool sphere = strcmp(argv[1], "-sphere") == 0;
+    int n = argc - 2 - (sphere ? 1 : 0);
+    if (n < 1 || n > 3) {
+      opserr << "WARNING findNodes " << argv[1] << " x? <y?> <z?>"
+             << (sphere ? " radius?" : "") << " - invalid number of arguments\n";
+      return TCL_ERROR;
+    }
+
+    Vector x(n);
+    for (int i = 0; i < n; i++)
+      if (Tcl_GetDouble(interp, argv[2 + i], &x(i)) != TCL_OK) {
+        opserr << "WARNING findNodes - invalid coordinate " << argv[2 + i] << "\n";
+        return TCL_ERROR;
+      }
+
+    if (sphere) {
+      double radius;
+      if (Tcl_GetDouble(interp, argv[argc - 1], &radius) != TCL_OK) {
+        opserr << "WARNING findNodes -sphere - invalid radius " << argv[argc - 1] << "\n";
+        return TCL_ERROR;
+      }
+      the_domain->findNodesInSphere(x, radius, found);
+    } else {
+      int tag = the_domain->findNearestNode(x);
+      if (tag != -1) {
+        found.resize(1);
+        found(0) = tag;
+      }
+    }
+
+  } else {
+    opserr << "WARNING findNodes - unknown option " << argv[1] << "\n";
+    return TCL_ERROR;
+  }
+
+  char buffer[20];
+  for (int i = 0; i < found.Size(); i++) {
+    sprintf(buffer, "%d ", found(i));
+    Tcl_AppendResult(interp, buffer, NULL);
+  }
+
+  return TCL_OK;
+}
+
 int
 findID(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
 {
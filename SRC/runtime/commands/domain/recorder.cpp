@@ -76,6 +76,9 @@
 #include <RemoveRecorder.h>
 
 #define MAX_NDF 6
+extern int TclGetBox(Tcl_Interp *interp, int argc, TCL_Char ** const argv,
+                     int &loc, Vector &lo, Vector &hi);
+
 extern FE_Datastore    *theDatabase;
 extern FEM_ObjectBroker theBroker;
 
@@ -502,6 +505,21 @@ TclCreateRecorder(ClientData clientData, Tcl_Interp *interp, int argc,
         loc += 3;
       }
 
+      else if (strcmp(argv[loc], "-eleBox") == 0) {
+        // elements whose bounding box overlaps the box
+        loc++;
+        Vector lo, hi;
+        if (TclGetBox(interp, argc, argv, loc, lo, hi) != 0) {
+          opserr << "WARNING recorder Element -eleBox xmin? .. xmax? .. - invalid box\n";
+          return TCL_ERROR;
+        }
+        ID found;
+        domain->findElementsInBox(lo, hi, found);
+
+        eleIDs = new ID(found);
+        numEle = found.Size();
+      }
+
       else if (strcmp(argv[loc], "-region") == 0) {
         // allow user to specif elements via a region
         if (argc < loc + 2) {
@@ -1727,6 +1745,22 @@ createNodeRecorder(ClientData clientData, Tcl_Interp *interp, int argc,
       pos += 3;
     }
 
+    else if (strcmp(argv[pos], "-nodeBox") == 0) {
+      // nodes within the box
+      pos++;
+      Vector lo, hi;
+      if (TclGetBox(interp, argc, argv, pos, lo, hi) != 0) {
+        opserr << G3_ERROR_PROMPT << "recorder " << argv[1]
+               << " -nodeBox xmin? .. xmax? .. - invalid box\n";
+        return TCL_ERROR;
+      }
+      ID found;
+      domain->findNodesInBox(lo, hi, found);
+
+      theNodes = new ID(found);
+      numNodes = found.Size();
+    }
+
     else if (strcmp(argv[pos], "-region") == 0) {
       // allow user to specif elements via a region
       if (argc < pos + 2) {
@@ -92,3 +92,44 @@ TclCommand_getTime(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char
   return TCL_OK;
 }
 
+
+int
+TclCommand_setIncrementalUpdate(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  // incrementalUpdate flag?
+  assert(clientData != nullptr);
+  Domain* domain = (Domain*)clientData;
+
+  if (argc < 2) {
+    opserr << "WARNING illegal command - incrementalUpdate flag? \n";
+    return TCL_ERROR;
+  }
+  int flag;
+  if (Tcl_GetBoolean(interp, argv[1], &flag) != TCL_OK) {
+    opserr << "WARNING reading flag - incrementalUpdate flag? \n";
+    return TCL_ERROR;
+  }
+  domain->setIncrementalUpdate(flag != 0);
+  return TCL_OK;
+}
+
+
+int
+TclCommand_setMaterialBatch(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  // materialBatch numThreads?
+  assert(clientData != nullptr);
+  Domain* domain = (Domain*)clientData;
+
+  if (argc < 2) {
+    opserr << "WARNING illegal command - materialBatch numThreads? \n";
+    return TCL_ERROR;
+  }
+  int numThreads;
+  if (Tcl_GetInt(interp, argv[1], &numThreads) != TCL_OK || numThreads < 0) {
+    opserr << "WARNING reading numThreads - materialBatch numThreads? \n";
+    return TCL_ERROR;
+  }
+  domain->setMaterialBatch(numThreads);
+  return TCL_OK;
+}
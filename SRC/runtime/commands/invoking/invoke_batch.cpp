@@ -0,0 +1,266 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the implementation of the
+// uniaxialBatch command, which runs many instances of one
+// UniaxialMaterial model, each built from its own parameter set,
+// through a common strain or stress history in a single call:
+//
+//   uniaxialBatch type -parameters {{p...} ...} (-strain|-stress) {history}
+//                 ?-measured {response}? ?-threads n? ?-tolerance tol maxIter?
+//                 ?-misfit?
+//
+// Each parameter set holds the arguments that follow the tag in the
+// corresponding uniaxialMaterial command. The result is a list with one
+// dictionary per set holding its status, its response (stress for a
+// strain history, strain for a stress history) and, when a measured
+// response is given, the misfit metrics of UniaxialMaterialBatch.
+// With -misfit the response histories are left out. Only the
+// Elastic, Steel01, Steel02, Concrete01, IMKPeakOriented, Bilin and
+// Pinching4 models are supported.
+//
+// Written: cmp
+//
+#include <assert.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+#include <iterator>
+
+#include <tcl.h>
+#include <G3_Logging.h>
+#include <runtimeAPI.h>
+#include <UniaxialMaterial.h>
+#include <UniaxialMaterialBatch.h>
+#include <runtime/BasicModelBuilder.h>
+
+extern "C" int OPS_ResetInputNoBuilder(ClientData clientData,
+                                       Tcl_Interp *interp, int cArg, int mArg,
+                                       TCL_Char ** const argv, Domain *domain);
+
+extern OPS_Routine OPS_ElasticMaterial;
+extern OPS_Routine OPS_Steel01;
+extern OPS_Routine OPS_Steel02;
+extern OPS_Routine OPS_Concrete01;
+extern OPS_Routine OPS_IMKPeakOriented;
+extern OPS_Routine OPS_Bilin;
+extern UniaxialMaterial *TclDispatch_newUniaxialPinching4(G3_Runtime*, int, TCL_Char ** const);
+
+// Models whose state determination (revertToStart, setTrialStrain,
+// getStress, getTangent and commitState) is reentrant, i.e. touches
+// only the instance it is called on, so that the batch workers may
+// run different instances concurrently. A model is either read with
+// the OPS_ parser or, like Pinching4, with a Tcl parser of its own.
+static const struct {
+  const char  *type;
+  OPS_Routine *parse;
+  UniaxialMaterial *(*parseTcl)(G3_Runtime*, int, TCL_Char ** const);
+} batchParsers[] = {
+  {"Elastic",         OPS_ElasticMaterial, nullptr                         },
+  {"Steel01",         OPS_Steel01,         nullptr                         },
+  {"Steel02",         OPS_Steel02,         nullptr                         },
+  {"Concrete01",      OPS_Concrete01,      nullptr                         },
+  {"IMKPeakOriented", OPS_IMKPeakOriented, nullptr                         },
+  {"Bilin",           OPS_Bilin,           nullptr                         },
+  {"Pinching4",       nullptr,             TclDispatch_newUniaxialPinching4},
+};
+
+//
+// Build a new UniaxialMaterial from the arguments of a uniaxialMaterial
+// command with the tag left out, i.e. argv[0] is the material type.
+// The parser is called directly, so the instance is not added to the
+// model and is owned by the caller.
+//
+UniaxialMaterial *
+G3_NewUniaxialMaterial(Tcl_Interp *interp, BasicModelBuilder *builder,
+                       int argc, TCL_Char ** const argv)
+{
+  const auto *model = &batchParsers[0];
+  for ( ; model != std::end(batchParsers); model++)
+    if (strcmp(model->type, argv[0]) == 0)
+      break;
+
+  if (model == std::end(batchParsers)) {
+    opserr << G3_ERROR_PROMPT << "uniaxial material type '" << argv[0]
+           << "' cannot be run in a batch; want one of";
+    for (const auto &entry : batchParsers)
+      opserr << " " << entry.type;
+    opserr << "\n";
+    return nullptr;
+  }
+
+  // lay the words out as the uniaxialMaterial command would, with a
+  // placeholder tag
+  std::vector<TCL_Char *> words;
+  words.push_back("uniaxialMaterial");
+  words.push_back(argv[0]);
+  words.push_back("0");
+  words.insert(words.end(), argv + 1, argv + argc);
+
+  G3_Runtime *rt = G3_getRuntime(interp);
+  if (model->parseTcl != nullptr)
+    return model->parseTcl(rt, (int)words.size(), words.data());
+
+  OPS_ResetInputNoBuilder(builder, interp, 2, (int)words.size(), words.data(), builder->getDomain());
+  return (UniaxialMaterial *)model->parse(rt, (int)words.size(), words.data());
+}
+
+static int
+readList(Tcl_Interp *interp, TCL_Char *list, std::vector<double> &values)
+{
+  int n;
+  TCL_Char **items;
+  if (Tcl_SplitList(interp, list, &n, &items) != TCL_OK)
+    return TCL_ERROR;
+
+  values.resize(n);
+  for (int i = 0; i < n; i++) {
+    if (Tcl_GetDouble(interp, items[i], &values[i]) != TCL_OK) {
+      Tcl_Free((char *)items);
+      return TCL_ERROR;
+    }
+  }
+  Tcl_Free((char *)items);
+  return TCL_OK;
+}
+
+int
+TclCommand_uniaxialBatch(ClientData clientData, Tcl_Interp *interp,
+                         int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  BasicModelBuilder *builder = (BasicModelBuilder *)clientData;
+
+  if (argc < 2) {
+    opserr << G3_ERROR_PROMPT << "bad arguments - want: uniaxialBatch type "
+           << "-parameters {{p...} ...} -strain|-stress {history} ?options?\n";
+    return TCL_ERROR;
+  }
+
+  TCL_Char *type = argv[1];
+  TCL_Char *parameters = nullptr;
+  UniaxialMaterialBatch::Control control = UniaxialMaterialBatch::StrainControl;
+  std::vector<double> history, measured;
+  int numThreads = (int)std::thread::hardware_concurrency();
+  double tol = 1.0e-8;
+  int maxIter = 25;
+  bool misfitOnly = false;
+
+  for (int argi = 2; argi < argc; argi++) {
+    if (strcmp(argv[argi], "-parameters") == 0 && argi+1 < argc) {
+      parameters = argv[++argi];
+    }
+    else if ((strcmp(argv[argi], "-strain") == 0 || strcmp(argv[argi], "-stress") == 0)
+             && argi+1 < argc) {
+      control = (strcmp(argv[argi], "-strain") == 0) ? UniaxialMaterialBatch::StrainControl
+                                                     : UniaxialMaterialBatch::StressControl;
+      if (readList(interp, argv[++argi], history) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "could not read history\n";
+        return TCL_ERROR;
+      }
+    }
+    else if (strcmp(argv[argi], "-measured") == 0 && argi+1 < argc) {
+      if (readList(interp, argv[++argi], measured) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "could not read measured response\n";
+        return TCL_ERROR;
+      }
+    }
+    else if (strcmp(argv[argi], "-threads") == 0 && argi+1 < argc) {
+      if (Tcl_GetInt(interp, argv[++argi], &numThreads) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "could not read number of threads\n";
+        return TCL_ERROR;
+      }
+    }
+    else if (strcmp(argv[argi], "-tolerance") == 0 && argi+2 < argc) {
+      if (Tcl_GetDouble(interp, argv[argi+1], &tol) != TCL_OK ||
+          Tcl_GetInt(interp, argv[argi+2], &maxIter) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "want -tolerance tol? maxIter?\n";
+        return TCL_ERROR;
+      }
+      argi += 2;
+    }
+    else if (strcmp(argv[argi], "-misfit") == 0) {
+      misfitOnly = true;
+    }
+    else {
+      opserr << G3_ERROR_PROMPT << "unknown option '" << argv[argi] << "'\n";
+      return TCL_ERROR;
+    }
+  }
+
+  if (parameters == nullptr || history.empty()) {
+    opserr << G3_ERROR_PROMPT << "uniaxialBatch requires -parameters and a -strain or -stress history\n";
+    return TCL_ERROR;
+  }
+
+  UniaxialMaterialBatch batch(control);
+  batch.setTolerance(tol, maxIter);
+  if (batch.setHistory(history.data(), (int)history.size()) < 0)
+    return TCL_ERROR;
+  if (!measured.empty() && batch.setMeasured(measured.data(), (int)measured.size()) < 0)
+    return TCL_ERROR;
+
+  // build one material per parameter set; the parsers read through
+  // the interpreter and so this stays on this thread
+  int numSets;
+  TCL_Char **sets;
+  if (Tcl_SplitList(interp, parameters, &numSets, &sets) != TCL_OK)
+    return TCL_ERROR;
+
+  for (int i = 0; i < numSets; i++) {
+    int numArgs;
+    TCL_Char **args;
+    if (Tcl_SplitList(interp, sets[i], &numArgs, &args) != TCL_OK) {
+      Tcl_Free((char *)sets);
+      return TCL_ERROR;
+    }
+
+    std::vector<TCL_Char *> words(1, type);
+    words.insert(words.end(), args, args + numArgs);
+    UniaxialMaterial *theMaterial = G3_NewUniaxialMaterial(interp, builder, (int)words.size(), words.data());
+    Tcl_Free((char *)args);
+
+    if (theMaterial == nullptr) {
+      opserr << G3_ERROR_PROMPT << "could not build " << type
+             << " from parameter set " << i << ": {" << sets[i] << "}\n";
+      Tcl_Free((char *)sets);
+      return TCL_ERROR;
+    }
+    batch.addMaterial(theMaterial);
+  }
+  Tcl_Free((char *)sets);
+  Tcl_ResetResult(interp);
+
+  // failures are reported per set through the status entry
+  batch.run(numThreads);
+
+  const int numSteps = (int)history.size();
+  Tcl_Obj *result = Tcl_NewListObj(0, nullptr);
+  for (int i = 0; i < numSets; i++) {
+    Tcl_Obj *entry = Tcl_NewDictObj();
+    Tcl_DictObjPut(interp, entry, Tcl_NewStringObj("status", -1), Tcl_NewIntObj(batch.getResult(i)));
+
+    if (!misfitOnly) {
+      const double *response = batch.getResponse(i);
+      Tcl_Obj *values = Tcl_NewListObj(0, nullptr);
+      for (int j = 0; j < numSteps; j++)
+        Tcl_ListObjAppendElement(interp, values, Tcl_NewDoubleObj(response[j]));
+      Tcl_DictObjPut(interp, entry, Tcl_NewStringObj("response", -1), values);
+    }
+
+    if (!measured.empty()) {
+      const UniaxialMaterialBatch::Misfit &fit = batch.getMisfit(i);
+      Tcl_DictObjPut(interp, entry, Tcl_NewStringObj("rms", -1),           Tcl_NewDoubleObj(fit.rms));
+      Tcl_DictObjPut(interp, entry, Tcl_NewStringObj("normalizedRms", -1), Tcl_NewDoubleObj(fit.normalizedRms));
+      Tcl_DictObjPut(interp, entry, Tcl_NewStringObj("maxError", -1),      Tcl_NewDoubleObj(fit.maxError));
+      Tcl_DictObjPut(interp, entry, Tcl_NewStringObj("energyError", -1),   Tcl_NewDoubleObj(fit.energyError));
+    }
+    Tcl_ListObjAppendElement(interp, result, entry);
+  }
+
+  Tcl_SetObjResult(interp, result);
+  return TCL_OK;
+}
@@ -56,7 +56,7 @@
 
 
 
-LoadPattern *theTclLoadPattern = nullptr;
+thread_local LoadPattern *theTclLoadPattern = nullptr;
 // MultiSupportPattern *theTclMultiSupportPattern = 0;
 
 Tcl_CmdProc TclCommand_addSP;
@@ -74,6 +74,7 @@ Tcl_CmdProc TclCommand_addNDMaterial;
 
 // invoking.cpp
 Tcl_CmdProc TclCommand_invoke;
+Tcl_CmdProc TclCommand_uniaxialBatch;
 
 // printing.cpp
 Tcl_CmdProc TclCommand_print;
@@ -104,6 +105,7 @@ struct char_cmd {
 // //
   {"with",                 TclCommand_invoke},
   {"invoke",               TclCommand_invoke},
+  {"uniaxialBatch",        TclCommand_uniaxialBatch},
 // Materials & sections
   {"uniaxialMaterial",     TclCommand_addUniaxialMaterial},
   {"nDMaterial",           TclCommand_addNDMaterial},
@@ -0,0 +1,176 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: This file contains the function that is invoked
+// by the interpreter when the command 'contact' is invoked by the
+// user.
+//
+//   contact tag -primary n1 n2 .. -secondary m1 m2 .. -gap tol
+//               -eleTag start -Kn Kn -Kt Kt -mu mu
+//               <-c c> <-dir dir> <-normal nx ny>
+//
+// In two dimensional models the pairs are ZeroLengthContact2D
+// elements with the given normal (default 0 1); in three dimensional
+// models they are ZeroLengthContact3D elements with contact direction
+// dir (default 3) and cohesion c.
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <tcl.h>
+#include <Domain.h>
+#include <Node.h>
+#include <ID.h>
+#include <Vector.h>
+#include <ContactManager.h>
+#include <ZeroLengthContact2D.h>
+#include <ZeroLengthContact3D.h>
+
+static int
+readNodeList(Tcl_Interp *interp, int argc, TCL_Char ** const argv, int &loc, ID &nodes)
+{
+  int numNodes = 0;
+  int nodeTag;
+  while (loc < argc && argv[loc][0] != '-' &&
+         Tcl_GetInt(interp, argv[loc], &nodeTag) == TCL_OK) {
+    nodes[numNodes++] = nodeTag;
+    loc++;
+  }
+  return numNodes;
+}
+
+int
+TclAddContactManager(ClientData clientData, Tcl_Interp *interp, int argc,
+                     TCL_Char ** const argv, Domain &theDomain)
+{
+  int tag;
+  ID primary(0, 64);
+  ID secondary(0, 64);
+  double gapTol = 0.0;
+  int eleTag = -1;
+  double Kn = 0.0, Kt = 0.0, mu = 0.0, c = 0.0;
+  int direction = 3;
+  Vector normal(2);
+  normal(1) = 1.0;
+
+  if (argc < 2) {
+    opserr << "WARNING contact tag? - no tag specified\n";
+    return TCL_ERROR;
+  }
+
+  if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
+    opserr << "WARNING contact tag? .. - invalid tag " << argv[1] << endln;
+    return TCL_ERROR;
+  }
+
+  int loc = 2;
+  while (loc < argc) {
+    const char *flag = argv[loc++];
+
+    if (strcmp(flag, "-primary") == 0) {
+      if (readNodeList(interp, argc, argv, loc, primary) == 0) {
+        opserr << "WARNING contact " << tag << " -primary n1? .. - no nodes specified\n";
+        return TCL_ERROR;
+      }
+
+    } else if (strcmp(flag, "-secondary") == 0) {
+      if (readNodeList(interp, argc, argv, loc, secondary) == 0) {
+        opserr << "WARNING contact " << tag << " -secondary n1? .. - no nodes specified\n";
+        return TCL_ERROR;
+      }
+
+    } else if (strcmp(flag, "-normal") == 0) {
+      if (loc + 1 >= argc ||
+          Tcl_GetDouble(interp, argv[loc], &normal(0)) != TCL_OK ||
+          Tcl_GetDouble(interp, argv[loc + 1], &normal(1)) != TCL_OK) {
+        opserr << "WARNING contact " << tag << " -normal nx? ny? - invalid normal\n";
+        return TCL_ERROR;
+      }
+      loc += 2;
+
+    } else if (strcmp(flag, "-eleTag") == 0 || strcmp(flag, "-dir") == 0) {
+      int *value = (strcmp(flag, "-eleTag") == 0) ? &eleTag : &direction;
+      if (loc >= argc || Tcl_GetInt(interp, argv[loc], value) != TCL_OK) {
+        opserr << "WARNING contact " << tag << " " << flag << " - invalid value\n";
+        return TCL_ERROR;
+      }
+      loc++;
+
+    } else {
+      double *value = nullptr;
+      if (strcmp(flag, "-gap") == 0)
+        value = &gapTol;
+      else if (strcmp(flag, "-Kn") == 0)
+        value = &Kn;
+      else if (strcmp(flag, "-Kt") == 0)
+        value = &Kt;
+      else if (strcmp(flag, "-mu") == 0)
+        value = &mu;
+      else if (strcmp(flag, "-c") == 0)
+        value = &c;
+      else {
+        opserr << "WARNING contact " << tag << " - unknown option " << flag << endln;
+        return TCL_ERROR;
+      }
+
+      if (loc >= argc || Tcl_GetDouble(interp, argv[loc], value) != TCL_OK) {
+        opserr << "WARNING contact " << tag << " " << flag << " - invalid value\n";
+        return TCL_ERROR;
+      }
+      loc++;
+    }
+  }
+
+  if (primary.Size() == 0 || secondary.Size() == 0) {
+    opserr << "WARNING contact " << tag << " - both -primary and -secondary nodes are required\n";
+    return TCL_ERROR;
+  }
+  if (gapTol <= 0.0) {
+    opserr << "WARNING contact " << tag << " - a positive -gap tolerance is required\n";
+    return TCL_ERROR;
+  }
+  if (eleTag < 0) {
+    opserr << "WARNING contact " << tag << " - -eleTag start? is required\n";
+    return TCL_ERROR;
+  }
+  if (theDomain.getContactManager(tag) != nullptr) {
+    opserr << "WARNING contact " << tag << " - a contact with this tag already exists\n";
+    return TCL_ERROR;
+  }
+
+  Node *theNode = theDomain.getNode(primary(0));
+  if (theNode == nullptr) {
+    opserr << "WARNING contact " << tag << " - node " << primary(0) << " does not exist\n";
+    return TCL_ERROR;
+  }
+  int ndm = theNode->getCrds().Size();
+
+  ContactManager::ElementFactory factory;
+  if (ndm == 2)
+    factory = [=](int eTag, int primaryNode, int secondaryNode) -> Element * {
+      return new ZeroLengthContact2D(eTag, secondaryNode, primaryNode, Kn, Kt, mu, normal);
+    };
+  else if (ndm == 3)
+    factory = [=](int eTag, int primaryNode, int secondaryNode) -> Element * {
+      return new ZeroLengthContact3D(eTag, secondaryNode, primaryNode, direction,
+                                     Kn, Kt, mu, c, 0.0, 0.0);
+    };
+  else {
+    opserr << "WARNING contact " << tag << " - only 2 and 3 dimensional models are supported\n";
+    return TCL_ERROR;
+  }
+
+  ContactManager *theManager =
+      new ContactManager(tag, primary, secondary, gapTol, eleTag, factory);
+
+  theDomain.addContactManager(*theManager);
+
+  if (theManager->update() < 0) {
+    opserr << "WARNING contact " << tag << " - could not create the initial contact pairs\n";
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
@@ -17,6 +17,7 @@
 #include <Domain.h>
 #include <FE_Datastore.h>
 
+#include <G3_Runtime.h>
 #include "runtime/BasicModelBuilder.h"
 
 #ifdef _PARALLEL_PROCESSING
@@ -25,8 +26,8 @@
 #endif
 
 
-extern ModelBuilder *theBuilder;
-bool builtModel = false;
+// only read through OPS_builtModel; buildModel uses the flag of the runtime
+thread_local bool builtModel = false;
 
 FE_Datastore *theDatabase = nullptr;
 
@@ -64,10 +65,10 @@ TclCommand_specifyModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL
     return TCL_ERROR;
   }
 
-  // invoke the descructor on the old builder
-  if (theBuilder != nullptr) {
-    delete theBuilder;
-    theBuilder = nullptr;
+  // invoke the descructor on the old builder of this interpreter
+  if (rt->m_builder != nullptr) {
+    delete rt->m_builder;
+    rt->m_builder = nullptr;
   }
 
   // check argv[1] for type of ModelBuilder and create the object
@@ -165,7 +166,6 @@ TclCommand_specifyModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL
     G3_setDomain(rt, theNewDomain);
     // create the model builder
     theNewBuilder = new BasicModelBuilder(*theNewDomain, interp, ndm, ndf);
-    theBuilder = theNewBuilder;
     G3_setModelBuilder(rt, theNewBuilder);
   }
 
@@ -295,17 +295,14 @@ buildModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char *argv[]
 {
   G3_Runtime *rt = G3_getRuntime(interp);
   ModelBuilder* builder = (ModelBuilder*)G3_getModelBuilder(rt);
-  if (!builder)
-    builder = theBuilder;
 
-  // TODO: Remove `builtModel` var.
   // to build the model make sure the ModelBuilder has been constructed
   // and that the model has not already been constructed
-  if (builder != 0 && builtModel == false) {
-    builtModel = true;
+  if (builder != 0 && rt->model_is_built == false) {
+    rt->model_is_built = builtModel = true;
     return builder->buildFE_Model();
 
-  } else if (builder != 0 && builtModel == true) {
+  } else if (builder != 0 && rt->model_is_built == true) {
     opserr << G3_ERROR_PROMPT << "Model has already been built - not built again \n";
     return TCL_ERROR;
 
@@ -16,6 +16,36 @@
 #include <Domain.h>
 #include <MeshRegion.h>
 #include <ID.h>
+#include <Vector.h>
+
+//
+// Read a box given as the lower and upper corners, e.g.
+//   xmin ymin xmax ymax  or  xmin ymin zmin xmax ymax zmax
+// starting at argv[loc]. On return loc points past the last number.
+//
+int
+TclGetBox(Tcl_Interp *interp, int argc, TCL_Char ** const argv, int &loc,
+          Vector &lo, Vector &hi)
+{
+  double x[6];
+  int n = 0;
+  while (n < 6 && loc < argc && Tcl_GetDouble(interp, argv[loc], &x[n]) == TCL_OK) {
+    n++;
+    loc++;
+  }
+  Tcl_ResetResult(interp);
+
+  if (n == 0 || n % 2 != 0)
+    return -1;
+
+  lo.resize(n/2);
+  hi.resize(n/2);
+  for (int i = 0; i < n/2; i++) {
+    lo(i) = x[i];
+    hi(i) = x[i + n/2];
+  }
+  return 0;
+}
 
 int
 TclAddMeshRegion(ClientData clientData, Tcl_Interp *interp, int argc,
@@ -187,6 +217,44 @@ TclAddMeshRegion(ClientData clientData, Tcl_Interp *interp, int argc,
 
       loc += 3;
 
+    } else if (strcmp(argv[loc], "-nodeBox") == 0 ||
+               strcmp(argv[loc], "-nodeOnlyBox") == 0 ||
+               strcmp(argv[loc], "-eleBox") == 0 ||
+               strcmp(argv[loc], "-eleOnlyBox") == 0) {
+
+      //
+      // select the nodes, or the elements whose bounding box overlaps,
+      // within the box [lo, hi]
+      //
+      bool eleBox = strncmp(argv[loc], "-ele", 4) == 0;
+      if (strcmp(argv[loc], "-nodeOnlyBox") == 0)
+        nodeOnly = true;
+      if (strcmp(argv[loc], "-eleOnlyBox") == 0)
+        eleOnly = true;
+
+      loc++;
+      Vector lo, hi;
+      if (TclGetBox(interp, argc, argv, loc, lo, hi) != 0) {
+        opserr << "WARNING region tag? " << argv[loc - 1]
+               << " xmin? .. xmax? .. - invalid box\n";
+        return TCL_ERROR;
+      }
+
+      ID found;
+      if (eleBox) {
+        theDomain.findElementsInBox(lo, hi, found);
+        if (theElements == 0)
+          theElements = new ID(0, found.Size());
+        for (int i = 0; i < found.Size(); i++)
+          (*theElements)[numElements++] = found(i);
+      } else {
+        theDomain.findNodesInBox(lo, hi, found);
+        if (theNodes == 0)
+          theNodes = new ID(0, found.Size());
+        for (int i = 0; i < found.Size(); i++)
+          (*theNodes)[numNodes++] = found(i);
+      }
+
     } else if (strcmp(argv[loc], "-rayleigh") == 0) {
 
       // ensure no segmentation fault if user messes up
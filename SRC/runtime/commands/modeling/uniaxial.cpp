@@ -952,11 +952,10 @@ TclDispatch_LegacyUniaxials(ClientData clientData, Tcl_Interp* interp, int argc,
 }
 
 #include <Pinching4Material.h>       // NM
-static int
-TclDispatch_newUniaxialPinching4(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char ** const argv)
+UniaxialMaterial *
+TclDispatch_newUniaxialPinching4(G3_Runtime* rt, int argc, TCL_Char ** const argv)
 {
-   assert(clientData != nullptr);
-   BasicModelBuilder *builder = (BasicModelBuilder*)clientData;
+   Tcl_Interp *interp = G3_getInterpreter(rt);
    UniaxialMaterial* theMaterial = nullptr;
 
    if (strcmp(argv[1], "Pinching4") == 0) {
@@ -970,7 +969,7 @@ TclDispatch_newUniaxialPinching4(ClientData clientData, Tcl_Interp* interp, int
                   "gammaK4? gammaKLimit? gammaD1? gammaD2? gammaD3? gammaD4? "
                << "\ngammaDLimit? gammaF1? gammaF2? gammaF3? gammaF4? "
                   "gammaFLimit? gammaE? CycleOrEnergyDamage? ";
-        return TCL_ERROR;
+        return nullptr;
       }
 
       int tag, tDmg;
@@ -988,225 +987,225 @@ TclDispatch_newUniaxialPinching4(ClientData clientData, Tcl_Interp* interp, int
 
       if (Tcl_GetInt(interp, argv[i++], &tag) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid uniaxialMaterial Pinching4 tag" << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       if (Tcl_GetDouble(interp, argv[i++], &stress1p) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid stress1p\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       if (Tcl_GetDouble(interp, argv[i++], &strain1p) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid strain1p\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       if (Tcl_GetDouble(interp, argv[i++], &stress2p) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid stress2p\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       if (Tcl_GetDouble(interp, argv[i++], &strain2p) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid strain2p\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       if (Tcl_GetDouble(interp, argv[i++], &stress3p) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid stress3p\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       if (Tcl_GetDouble(interp, argv[i++], &strain3p) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid strain3p\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       if (Tcl_GetDouble(interp, argv[i++], &stress4p) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid stress4p\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       if (Tcl_GetDouble(interp, argv[i++], &strain4p) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid strain4p\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       if (argc == 42) {
         if (Tcl_GetDouble(interp, argv[i++], &stress1n) != TCL_OK) {
           opserr << G3_ERROR_PROMPT << "invalid stress1n\n";
           opserr << "Pinching4 material: " << tag << endln;
-          return TCL_ERROR;
+          return nullptr;
         }
 
         if (Tcl_GetDouble(interp, argv[i++], &strain1n) != TCL_OK) {
           opserr << G3_ERROR_PROMPT << "invalid strain1n\n";
           opserr << "Pinching4 material: " << tag << endln;
-          return TCL_ERROR;
+          return nullptr;
         }
 
         if (Tcl_GetDouble(interp, argv[i++], &stress2n) != TCL_OK) {
           opserr << G3_ERROR_PROMPT << "invalid stress2n\n";
           opserr << "Pinching4 material: " << tag << endln;
-          return TCL_ERROR;
+          return nullptr;
         }
 
         if (Tcl_GetDouble(interp, argv[i++], &strain2n) != TCL_OK) {
           opserr << G3_ERROR_PROMPT << "invalid strain2n\n";
           opserr << "Pinching4 material: " << tag << endln;
-          return TCL_ERROR;
+          return nullptr;
         }
 
         if (Tcl_GetDouble(interp, argv[i++], &stress3n) != TCL_OK) {
           opserr << G3_ERROR_PROMPT << "invalid stress3n\n";
           opserr << "Pinching4 material: " << tag << endln;
-          return TCL_ERROR;
+          return nullptr;
         }
 
         if (Tcl_GetDouble(interp, argv[i++], &strain3n) != TCL_OK) {
           opserr << G3_ERROR_PROMPT << "invalid strain3n\n";
           opserr << "Pinching4 material: " << tag << endln;
-          return TCL_ERROR;
+          return nullptr;
         }
 
         if (Tcl_GetDouble(interp, argv[i++], &stress4n) != TCL_OK) {
           opserr << G3_ERROR_PROMPT << "invalid stress4n\n";
           opserr << "Pinching4 material: " << tag << endln;
-          return TCL_ERROR;
+          return nullptr;
         }
 
         if (Tcl_GetDouble(interp, argv[i++], &strain4n) != TCL_OK) {
           opserr << G3_ERROR_PROMPT << "invalid strain4n\n";
           opserr << "Pinching4 material: " << tag << endln;
-          return TCL_ERROR;
+          return nullptr;
         }
       }
 
       if (Tcl_GetDouble(interp, argv[i++], &rDispP) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid rDispP\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       if (Tcl_GetDouble(interp, argv[i++], &rForceP) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid rForceP\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       if (Tcl_GetDouble(interp, argv[i++], &uForceP) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid uForceP\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       if (argc == 42) {
         if (Tcl_GetDouble(interp, argv[i++], &rDispN) != TCL_OK) {
           opserr << G3_ERROR_PROMPT << "invalid rDispN\n";
           opserr << "Pinching4 material: " << tag << endln;
-          return TCL_ERROR;
+          return nullptr;
         }
 
         if (Tcl_GetDouble(interp, argv[i++], &rForceN) != TCL_OK) {
           opserr << G3_ERROR_PROMPT << "invalid rForceN\n";
           opserr << "Pinching4 material: " << tag << endln;
-          return TCL_ERROR;
+          return nullptr;
         }
 
         if (Tcl_GetDouble(interp, argv[i++], &uForceN) != TCL_OK) {
           opserr << G3_ERROR_PROMPT << "invalid uForceN\n";
           opserr << "Pinching4 material: " << tag << endln;
-          return TCL_ERROR;
+          return nullptr;
         }
       }
 
       if (Tcl_GetDouble(interp, argv[i++], &gammaK1) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid gammaK1\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
       if (Tcl_GetDouble(interp, argv[i++], &gammaK2) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid gammaK2\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
       if (Tcl_GetDouble(interp, argv[i++], &gammaK3) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid gammaK3\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
       if (Tcl_GetDouble(interp, argv[i++], &gammaK4) != TCL_OK) {
         opserr << G3_ERROR_PROMPT << "invalid gammaK4\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
       if (Tcl_GetDouble(interp, argv[i++], &gammaKLimit) != TCL_OK) {
         opserr << "WARNING invalid gammaKLimit\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
       if (Tcl_GetDouble(interp, argv[i++], &gammaD1) != TCL_OK) {
         opserr << "WARNING invalid gammaD1\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
       if (Tcl_GetDouble(interp, argv[i++], &gammaD2) != TCL_OK) {
         opserr << "WARNING invalid gammaD2\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
       if (Tcl_GetDouble(interp, argv[i++], &gammaD3) != TCL_OK) {
         opserr << "WARNING invalid gammaD3\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
       if (Tcl_GetDouble(interp, argv[i++], &gammaD4) != TCL_OK) {
         opserr << "WARNING invalid gammaD4\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
       if (Tcl_GetDouble(interp, argv[i++], &gammaDLimit) != TCL_OK) {
         opserr << "WARNING invalid gammaDLimit\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
       if (Tcl_GetDouble(interp, argv[i++], &gammaF1) != TCL_OK) {
         opserr << "WARNING invalid gammaF1\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
       if (Tcl_GetDouble(interp, argv[i++], &gammaF2) != TCL_OK) {
         opserr << "WARNING invalid gammaF2\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
       if (Tcl_GetDouble(interp, argv[i++], &gammaF3) != TCL_OK) {
         opserr << "WARNING invalid gammaF3\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
       if (Tcl_GetDouble(interp, argv[i++], &gammaF4) != TCL_OK) {
         opserr << "WARNING invalid gammaF4\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
       if (Tcl_GetDouble(interp, argv[i++], &gammaFLimit) != TCL_OK) {
         opserr << "WARNING invalid gammaFLimit\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       if (Tcl_GetDouble(interp, argv[i++], &gammaE) != TCL_OK) {
         opserr << "WARNING invalid gammaE\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       int y;
@@ -1224,7 +1223,7 @@ TclDispatch_newUniaxialPinching4(ClientData clientData, Tcl_Interp* interp, int
       } else {
         opserr << "WARNING invalid type of damage calculation specified\n";
         opserr << "Pinching4 material: " << tag << endln;
-        return TCL_ERROR;
+        return nullptr;
       }
 
       // allocate the pinching material
@@ -1246,12 +1245,7 @@ TclDispatch_newUniaxialPinching4(ClientData clientData, Tcl_Interp* interp, int
             gammaE, tDmg);
       }
   }
-  if (!theMaterial || (builder->addUniaxialMaterial(theMaterial) != TCL_OK)) {
-    opserr << G3_ERROR_PROMPT << "Could not add uniaxialMaterial to the model builder.\n";
-    delete theMaterial;
-    return TCL_ERROR;
-  }
-  return TCL_OK;
+  return theMaterial;
 }
 
 
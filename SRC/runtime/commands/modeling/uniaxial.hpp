@@ -139,13 +139,13 @@ TclDispatch_UniaxialMaterial G3Parse_newUniaxialConcrete07;
 TclDispatch_UniaxialMaterial TclCommand_ReinforcingSteel;
 TclDispatch_UniaxialMaterial G3Parse_newParallelMaterial;
 TclDispatch_UniaxialMaterial G3Parse_newUniaxialBoucWen;
+TclDispatch_UniaxialMaterial TclDispatch_newUniaxialPinching4;
 // TclDispatch_UniaxialMaterial TclCommand_AxialSp;
 // TclDispatch_UniaxialMaterial TclCommand_AxialSpHD;
 static Tcl_CmdProc TclCommand_newFatigueMaterial;
 
 
 // typedef int (TclCommand_UniaxialMaterial)(ClientData, Tcl_Interp*, int, TCL_Char ** const);
-static Tcl_CmdProc TclDispatch_newUniaxialPinching4;
 static Tcl_CmdProc TclDispatch_LegacyUniaxials;
 
 template <OPS_Routine fn> static int
@@ -154,6 +154,8 @@ dispatch(ClientData clientData, Tcl_Interp* interp, int argc, G3_Char** const ar
   BasicModelBuilder *builder = (BasicModelBuilder*)clientData;
   G3_Runtime *rt = G3_getRuntime(interp);
   UniaxialMaterial* theMaterial = (UniaxialMaterial*)fn( rt, argc, argv );
+  if (theMaterial == nullptr)
+    return TCL_ERROR;
 
   if (builder->addUniaxialMaterial(theMaterial) != TCL_OK) {
     opserr << G3_ERROR_PROMPT << "Could not add uniaxialMaterial to the model builder.\n";
@@ -170,6 +172,8 @@ dispatch(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** const a
   BasicModelBuilder *builder = (BasicModelBuilder*)clientData;
   G3_Runtime *rt = G3_getRuntime(interp);
   UniaxialMaterial* theMaterial = fn( rt, argc, argv );
+  if (theMaterial == nullptr)
+    return TCL_ERROR;
 
   if (builder->addUniaxialMaterial(theMaterial) != TCL_OK) {
     opserr << G3_ERROR_PROMPT << "Could not add uniaxialMaterial to the model builder.\n";
@@ -434,7 +438,7 @@ std::unordered_map<std::string, Tcl_CmdProc*> uniaxial_dispatch {
 
     {"TDConcreteMC10NL",       dispatch<OPS_TDConcreteMC10NL>          },
 
-    {"Pinching4",             TclDispatch_newUniaxialPinching4         },
+    {"Pinching4",              dispatch<TclDispatch_newUniaxialPinching4>},
 
     {"Elastic2",               TclDispatch_LegacyUniaxials             },
     {"ENT",                    TclDispatch_LegacyUniaxials             },
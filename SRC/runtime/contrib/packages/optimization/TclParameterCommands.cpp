@@ -40,7 +40,7 @@ class TclBasicBuilder;
 #include <RVParameter.h>
 #include <ReliabilityDomain.h>
 
-extern ReliabilityDomain *theReliabilityDomain;
+extern thread_local ReliabilityDomain *theReliabilityDomain;
 
 #endif
 
@@ -124,6 +124,7 @@ using std::setw;
 #include <GFunVisualizationAnalysis.h>
 #include <OutCrossingAnalysis.h>
 #include <ImportanceSamplingAnalysis.h>
+#include <ParallelSampling.h>
 #include <SORMAnalysis.h>
 #include <SystemAnalysis.h>
 #include <PCM.h>
@@ -160,6 +161,7 @@ using std::setw;
 //---Quan
 
 #include <TclReliabilityBuilder.h>
+#include <g3_api.h>
 /////////////////////////////////////////////////////////
 /// S added by K Fujimura for Random Vibration Analysis ///
 /////////////////////////////////////////////////////////
@@ -211,44 +213,46 @@ extern Integrator* theSensitivityIntegrator;
 
 //
 // SOME STATIC POINTERS USED IN THE FUNCTIONS INVOKED BY THE INTERPRETER
+// (one set per thread, so that each sampling thread can hold a model of
+// its own in its own interpreter)
 //
 
 // Quan --
 // ---------------- define global pointer for SNOPT ----------
-MonteCarloResponseAnalysis *theMonteCarloResponseAnalysis = 0;
-SamplingAnalysis *theSamplingAnalysis = 0;
+thread_local MonteCarloResponseAnalysis *theMonteCarloResponseAnalysis = 0;
+thread_local SamplingAnalysis *theSamplingAnalysis = 0;
 // --- Quan
 
-ReliabilityDomain *theReliabilityDomain = 0;
-static Domain *theStructuralDomain = 0;
+thread_local ReliabilityDomain *theReliabilityDomain = 0;
+static thread_local Domain *theStructuralDomain = 0;
 
 // base class static pointers
-static FunctionEvaluator *theFunctionEvaluator = 0;
-static GradientEvaluator *theGradientEvaluator = 0;
-static StepSizeRule *theStepSizeRule = 0;
-static SearchDirection *theSearchDirection = 0;
-static HessianEvaluator *theHessianEvaluator = 0;
-static MeritFunctionCheck *theMeritFunctionCheck = 0;
-static ProbabilityTransformation *theProbabilityTransformation = 0;
-static ReliabilityConvergenceCheck *theReliabilityConvergenceCheck = 0;
-static RootFinding *theRootFindingAlgorithm = 0;
-static FindCurvatures *theFindCurvatures = 0;
-static FindDesignPointAlgorithm *theFindDesignPointAlgorithm = 0;
-RandomNumberGenerator *theRandomNumberGenerator = 0;
+static thread_local FunctionEvaluator *theFunctionEvaluator = 0;
+static thread_local GradientEvaluator *theGradientEvaluator = 0;
+static thread_local StepSizeRule *theStepSizeRule = 0;
+static thread_local SearchDirection *theSearchDirection = 0;
+static thread_local HessianEvaluator *theHessianEvaluator = 0;
+static thread_local MeritFunctionCheck *theMeritFunctionCheck = 0;
+static thread_local ProbabilityTransformation *theProbabilityTransformation = 0;
+static thread_local ReliabilityConvergenceCheck *theReliabilityConvergenceCheck = 0;
+static thread_local RootFinding *theRootFindingAlgorithm = 0;
+static thread_local FindCurvatures *theFindCurvatures = 0;
+static thread_local FindDesignPointAlgorithm *theFindDesignPointAlgorithm = 0;
+thread_local RandomNumberGenerator *theRandomNumberGenerator = 0;
 
 // mixed pointers
-static PolakHeSearchDirectionAndMeritFunction *thePolakHeDualPurpose = 0;
-static SQPsearchDirectionMeritFunctionAndHessian *theSQPtriplePurpose = 0;
+static thread_local PolakHeSearchDirectionAndMeritFunction *thePolakHeDualPurpose = 0;
+static thread_local SQPsearchDirectionMeritFunctionAndHessian *theSQPtriplePurpose = 0;
 
 // analysis base class pointers
-static GFunVisualizationAnalysis *theGFunVisualizationAnalysis = 0;
-static FORMAnalysis *theFORMAnalysis = 0;
-static FOSMAnalysis *theFOSMAnalysis = 0;
+static thread_local GFunVisualizationAnalysis *theGFunVisualizationAnalysis = 0;
+static thread_local FORMAnalysis *theFORMAnalysis = 0;
+static thread_local FOSMAnalysis *theFOSMAnalysis = 0;
 // static ParametricReliabilityAnalysis *theParametricReliabilityAnalysis = 0;
-static OutCrossingAnalysis *theOutCrossingAnalysis = 0;
-static SORMAnalysis *theSORMAnalysis = 0;
-static ImportanceSamplingAnalysis *theImportanceSamplingAnalysis = 0;
-static SystemAnalysis *theSystemAnalysis = 0;
+static thread_local OutCrossingAnalysis *theOutCrossingAnalysis = 0;
+static thread_local SORMAnalysis *theSORMAnalysis = 0;
+static thread_local ImportanceSamplingAnalysis *theImportanceSamplingAnalysis = 0;
+static thread_local SystemAnalysis *theSystemAnalysis = 0;
 
 /////////////////////////////////////////////////////////
 /// S added by K Fujimura for Random Vibration Analysis ///
@@ -268,6 +272,140 @@ static RandomVibrationAnalysis *theRandomVibrationAnalysis = 0;
 /////////////////////////////////////////////////////////
 
 #define MAX_FILENAMELENGTH 200
+
+extern "C" int Openseesrt_Init(Tcl_Interp *interp);
+
+//
+// Evaluates samples on a model of its own: setUp() creates an
+// interpreter on the sampling thread and sources a model file in it,
+// which builds the structural model and, after a call to reliability,
+// the reliability model (random variables, limit-state functions,
+// probability transformation and function evaluator). The model file
+// must not itself run the analysis.
+//
+class TclSampleEvaluator : public SampleEvaluator
+{
+public:
+  TclSampleEvaluator(const char *modelFile, const char *tclFileToRun, int numRV);
+  ~TclSampleEvaluator();
+
+  int  setUp(void);
+  void tearDown(void);
+  int  evaluate(const Vector &u, Vector &g);
+
+private:
+  static int reliability(ClientData, Tcl_Interp *, int, TCL_Char ** const);
+
+  char *modelFile;
+  char *tclFileToRun;
+  int numRV;
+  Tcl_Interp *theInterp;
+  TclReliabilityBuilder *theBuilder;
+  DomainSampleEvaluator *theEvaluator;
+};
+
+TclSampleEvaluator::TclSampleEvaluator(const char *model, const char *file,
+                                       int nrv)
+    : modelFile(0), tclFileToRun(0), numRV(nrv), theInterp(0),
+      theBuilder(0), theEvaluator(0)
+{
+  modelFile = new char[strlen(model) + 1];
+  strcpy(modelFile, model);
+  if (file != 0) {
+    tclFileToRun = new char[strlen(file) + 1];
+    strcpy(tclFileToRun, file);
+  }
+}
+
+TclSampleEvaluator::~TclSampleEvaluator()
+{
+  delete[] modelFile;
+  if (tclFileToRun != 0)
+    delete[] tclFileToRun;
+}
+
+int
+TclSampleEvaluator::reliability(ClientData clientData, Tcl_Interp *interp,
+                                int argc, TCL_Char ** const argv)
+{
+  TclSampleEvaluator *theEvaluator = (TclSampleEvaluator *)clientData;
+  if (theEvaluator->theBuilder != 0)
+    return TCL_ERROR;
+
+  Domain *theDomain = G3_getDomain(G3_getRuntime(interp));
+  if (theDomain == 0) {
+    opserr << "WARNING reliability - the model must be built first" << endln;
+    return TCL_ERROR;
+  }
+
+  theEvaluator->theBuilder = new TclReliabilityBuilder(*theDomain, interp);
+  return TCL_OK;
+}
+
+int
+TclSampleEvaluator::setUp(void)
+{
+  // the reliability pointers of this file are those of the calling
+  // thread, which are filled in by the model file
+  theInterp = Tcl_CreateInterp();
+  if (Openseesrt_Init(theInterp) != TCL_OK) {
+    opserr << "TclSampleEvaluator::setUp() - could not initialize interpreter"
+           << endln;
+    return -1;
+  }
+  Tcl_CreateCommand(theInterp, "reliability", TclSampleEvaluator::reliability,
+                    (ClientData)this, NULL);
+
+  if (Tcl_EvalFile(theInterp, modelFile) != TCL_OK) {
+    opserr << "TclSampleEvaluator::setUp() - the file " << modelFile
+           << " can not be run: " << Tcl_GetStringResult(theInterp) << endln;
+    return -1;
+  }
+
+  if (theBuilder == 0 || theProbabilityTransformation == 0 ||
+      (tclFileToRun == 0 && theFunctionEvaluator == 0)) {
+    opserr << "TclSampleEvaluator::setUp() - the file " << modelFile
+           << " does not define a complete reliability model" << endln;
+    return -1;
+  }
+  if (theReliabilityDomain->getNumberOfRandomVariables() != numRV) {
+    opserr << "TclSampleEvaluator::setUp() - the file " << modelFile
+           << " defines " << theReliabilityDomain->getNumberOfRandomVariables()
+           << " random variables instead of " << numRV << endln;
+    return -1;
+  }
+
+  theEvaluator = new DomainSampleEvaluator(
+      theReliabilityDomain, theStructuralDomain, theProbabilityTransformation,
+      theFunctionEvaluator);
+  if (tclFileToRun != 0)
+    theEvaluator->setTclFileToRun(theInterp, tclFileToRun);
+
+  return 0;
+}
+
+void
+TclSampleEvaluator::tearDown(void)
+{
+  if (theEvaluator != 0)
+    delete theEvaluator;
+  theEvaluator = 0;
+
+  if (theBuilder != 0)
+    delete theBuilder;
+  theBuilder = 0;
+
+  if (theInterp != 0)
+    Tcl_DeleteInterp(theInterp);
+  theInterp = 0;
+}
+
+int
+TclSampleEvaluator::evaluate(const Vector &u, Vector &g)
+{
+  return theEvaluator->evaluate(u, g);
+}
+
 //
 // THE PROTOTYPES OF THE FUNCTIONS INVOKED BY THE INTERPRETER
 //
@@ -4446,9 +4584,17 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
   //     -print 1   (print to screen)
   //     -print 2   (print to restart file)
   //
+  //     -batch 100 ........................... sample in batches with
+  //     -seed 1                                per-sample random streams
+  //                                            (types 1 and 2)
+  //
+  //     -threads 1 -model model.tcl .......... evaluate the samples on
+  //                                            this many threads; each
+  //                                            extra thread builds its own
+  //                                            model from model.tcl
+  //
 
-  if (argc != 2 && argc != 4 && argc != 6 && argc != 8 && argc != 10 &&
-      argc != 12) {
+  if (argc < 2 || argc % 2 != 0) {
     opserr << "ERROR: Wrong number of arguments to Sampling analysis" << endln;
     return TCL_ERROR;
   }
@@ -4459,6 +4605,11 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
   double samplingVariance = 1.0;
   int printFlag = 0;
   int analysisTypeTag = 1;
+  bool useBatches = false;
+  int batchSize = 100;
+  int seed = 1;
+  int numThreads = 1;
+  TCL_Char *modelFile = 0;
 
   for (int i = 2; i < argc; i = i + 2) {
 
@@ -4521,12 +4672,43 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
         opserr << "ERROR: invalid input: printFlag \n";
         return TCL_ERROR;
       }
+    } else if (strcmp(argv[i], "-batch") == 0) {
+      if (Tcl_GetInt(interp, argv[i + 1], &batchSize) != TCL_OK || batchSize < 1) {
+        opserr << "ERROR: invalid input: batch \n";
+        return TCL_ERROR;
+      }
+      useBatches = true;
+    } else if (strcmp(argv[i], "-seed") == 0) {
+      if (Tcl_GetInt(interp, argv[i + 1], &seed) != TCL_OK) {
+        opserr << "ERROR: invalid input: seed \n";
+        return TCL_ERROR;
+      }
+      useBatches = true;
+    } else if (strcmp(argv[i], "-threads") == 0) {
+      if (Tcl_GetInt(interp, argv[i + 1], &numThreads) != TCL_OK || numThreads < 1) {
+        opserr << "ERROR: invalid input: threads \n";
+        return TCL_ERROR;
+      }
+      useBatches = true;
+    } else if (strcmp(argv[i], "-model") == 0) {
+      modelFile = argv[i + 1];
     } else {
       opserr << "ERROR: invalid input to sampling analysis. " << endln;
       return TCL_ERROR;
     }
   }
 
+  if (numThreads > 1 && modelFile == 0) {
+    opserr << "ERROR:: -threads needs a -model file to build the model " << endln
+           << " of each thread. " << endln;
+    return TCL_ERROR;
+  }
+  if (numThreads > 1 && analysisTypeTag != 1 && analysisTypeTag != 2) {
+    opserr << "ERROR:: -threads is only available for the failureProbability "
+           << endln << " and responseStatistics types. " << endln;
+    return TCL_ERROR;
+  }
+
   // Warn about illegal combinations
   if (analysisTypeTag == 2 && printFlag == 2) {
     opserr << "ERROR:: The restart option of the sampling analysis cannot be "
@@ -4546,9 +4728,24 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
     return TCL_ERROR;
   }
 
+  // The first thread evaluates samples on the model of this
+  // interpreter, every other thread on a model of its own
+  std::vector<TclSampleEvaluator *> evaluators;
+  if (useBatches) {
+    theImportanceSamplingAnalysis->setParallelSampling(batchSize, seed);
+    for (int i = 1; i < numThreads; i++) {
+      evaluators.push_back(new TclSampleEvaluator(
+          modelFile, 0, theReliabilityDomain->getNumberOfRandomVariables()));
+      theImportanceSamplingAnalysis->addSampleEvaluator(evaluators.back());
+    }
+  }
+
   // Now run analysis
   theImportanceSamplingAnalysis->analyze();
 
+  for (TclSampleEvaluator *theEvaluator : evaluators)
+    delete theEvaluator;
+
   return TCL_OK;
 }
 
@@ -5429,7 +5626,8 @@ TclReliabilityModelBuilder_printReliability(ClientData clientData,
 // ---------- Quan Gu ------------------------
 
 /// Command:  runMonteCarloResponseAnalysis  -outPutFile  m.out -maxNum 1000
-/// -print 1 -tclFileToRun test.tcl <-seed 1>
+/// -print 1 -tclFileToRun test.tcl <-seed 1> <-batch 100>
+/// <-threads 1 -model model.tcl>
 int
 TclReliabilityModelBuilder_runMonteCarloResponseAnalysis(ClientData clientData,
                                                          Tcl_Interp *interp,
@@ -5477,6 +5675,10 @@ TclReliabilityModelBuilder_runMonteCarloResponseAnalysis(ClientData clientData,
   int printFlag = 0;
   char outPutFile[25] = "";
   char *tclFileName = 0;
+  bool useBatches = false;
+  int batchSize = 100;
+  int numThreads = 1;
+  TCL_Char *modelFile = 0;
 
   int argvCounter = 1;
   while (argc > argvCounter) {
@@ -5534,6 +5736,36 @@ TclReliabilityModelBuilder_runMonteCarloResponseAnalysis(ClientData clientData,
       argvCounter++;
     } // else if
 
+    else if (strcmp(argv[argvCounter], "-batch") == 0) {
+      argvCounter++;
+
+      if (Tcl_GetInt(interp, argv[argvCounter], &batchSize) != TCL_OK ||
+          batchSize < 1) {
+        opserr << "ERROR: invalid input: batch \n";
+        return TCL_ERROR;
+      }
+      useBatches = true;
+      argvCounter++;
+    } // else if
+
+    else if (strcmp(argv[argvCounter], "-threads") == 0) {
+      argvCounter++;
+
+      if (Tcl_GetInt(interp, argv[argvCounter], &numThreads) != TCL_OK ||
+          numThreads < 1) {
+        opserr << "ERROR: invalid input: threads \n";
+        return TCL_ERROR;
+      }
+      useBatches = true;
+      argvCounter++;
+    } // else if
+
+    else if (strcmp(argv[argvCounter], "-model") == 0) {
+      argvCounter++;
+      modelFile = argv[argvCounter];
+      argvCounter++;
+    } // else if
+
     else {
       opserr << "warning: unknown command: " << argv[argvCounter] << endln;
       argvCounter++;
@@ -5542,8 +5774,16 @@ TclReliabilityModelBuilder_runMonteCarloResponseAnalysis(ClientData clientData,
 
   }; // while
 
+  if (numThreads > 1 && (modelFile == 0 || tclFileName == 0)) {
+    opserr << "ERROR: -threads needs a -model file to build the model of "
+              "each thread and a -tclFileToRun file"
+           << endln;
+    return TCL_ERROR;
+  }
+
   theMonteCarloResponseAnalysis = new MonteCarloResponseAnalysis(
-      theReliabilityDomain, interp, theProbabilityTransformation,
+      theReliabilityDomain, theStructuralDomain, interp,
+      theProbabilityTransformation,
       theRandomNumberGenerator, numberOfSimulations, printFlag, outPutFile,
       tclFileName, seed);
 
@@ -5552,12 +5792,28 @@ TclReliabilityModelBuilder_runMonteCarloResponseAnalysis(ClientData clientData,
     return TCL_ERROR;
   }
 
+  // The first thread runs the samples on the model of this interpreter,
+  // every other thread on a model of its own
+  std::vector<TclSampleEvaluator *> evaluators;
+  if (useBatches) {
+    theMonteCarloResponseAnalysis->setParallelSampling(batchSize, seed);
+    for (int i = 1; i < numThreads; i++) {
+      evaluators.push_back(new TclSampleEvaluator(
+          modelFile, tclFileName,
+          theReliabilityDomain->getNumberOfRandomVariables()));
+      theMonteCarloResponseAnalysis->addSampleEvaluator(evaluators.back());
+    }
+  }
+
   if (tclFileName != 0)
     delete[] tclFileName;
 
   // Now run analysis
   theMonteCarloResponseAnalysis->analyze();
 
+  for (TclSampleEvaluator *theEvaluator : evaluators)
+    delete theEvaluator;
+
   return TCL_OK;
 }
 
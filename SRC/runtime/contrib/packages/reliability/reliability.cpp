@@ -12,7 +12,7 @@
 
 #ifdef _RELIABILITY
 // AddingSensitivity:BEGIN /////////////////////////////////////////////
-static TclReliabilityBuilder *theReliabilityBuilder = 0;
+static thread_local TclReliabilityBuilder *theReliabilityBuilder = 0;
 
 Integrator *theSensitivityAlgorithm = 0;
 Integrator *theSensitivityIntegrator = 0;
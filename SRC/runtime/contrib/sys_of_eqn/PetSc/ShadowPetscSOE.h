@@ -55,6 +55,7 @@ class ShadowPetscSOE : public LinearSOE
     ~ShadowPetscSOE();
 
     int solve(void);    
+    bool usesDefaultSolve(void) {return false;}
 
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
@@ -33,15 +33,15 @@ extern StaticIntegrator          *theStaticIntegrator;
 extern DirectIntegrationAnalysis *theTransientAnalysis;
 extern TransientIntegrator       *theTransientIntegrator;
 extern VariableTimeStepDirectIntegrationAnalysis *theVariableTimeStepTransientAnalysis;
-extern bool builtModel;
+extern thread_local bool builtModel;
 extern FE_Datastore *theDatabase;
 
-static Tcl_Interp *theInterp       = nullptr;
-static TclBuilder *theModelBuilder = nullptr;
+static thread_local Tcl_Interp *theInterp       = nullptr;
+static thread_local TclBuilder *theModelBuilder = nullptr;
 
-static TCL_Char **currentArgv      = nullptr;
-static int currentArg = 0;
-static int maxArg = 0;
+static thread_local TCL_Char **currentArgv      = nullptr;
+static thread_local int currentArg = 0;
+static thread_local int maxArg = 0;
 
 modelState theModelState;
 
@@ -10,19 +10,30 @@
 #include <pybind11/stl.h>
 namespace py = pybind11;
 
+#include <thread>
+
 #include <G3_Runtime.h>
 #include <elementAPI.h> // G3_getRuntime/SafeBuilder
 #include "runtime/BasicModelBuilder.h"
+#include "runtime/BulkModelBuilder.h"
 
 #include <Domain.h>
 #include <Vector.h>
+#include <ID.h>
 #include <Node.h>
 #include <Element.h>
+#include <RCM.h>
 #include <SectionForceDeformation.h>
 #include <UniaxialMaterial.h>
+#include <UniaxialMaterialBatch.h>
 #include <NDMaterial.h>
 #include <HystereticBackbone.h>
 #include <ManderBackbone.h>
+#include <ElementIter.h>
+#include <Truss.h>
+#include <ZeroLength.h>
+#include <FourNodeQuad.h>
+#include <classTags.h>
 
 // 
 // ANALYSIS
@@ -44,6 +55,15 @@ namespace py = pybind11;
 #define ARRAY_FLAGS py::array::c_style|py::array::forcecast
 
 
+template <typename T>
+static void
+check_size(const py::array_t<T, ARRAY_FLAGS> &array, py::ssize_t size, const char *name)
+{
+  if (array.size() != size)
+    throw std::invalid_argument(std::string("expected ") + std::to_string(size)
+                                + " values in " + name + ", got " + std::to_string(array.size()));
+}
+
 std::unique_ptr<G3_Runtime, py::nodelete> 
 getRuntime(py::object interpaddr) {
       void *interp_addr;
@@ -72,6 +92,178 @@ get_builder(py::object interpaddr) {
     return std::unique_ptr<BasicModelBuilder, py::nodelete>((BasicModelBuilder*)builder_addr);
 } // , py::return_value_policy::reference
 
+//
+// The classes whose state determination keeps no scratch shared between
+// threads; an analysis may only release the GIL while its domain holds
+// nothing else. Uniaxial and nD material class tags overlap, so they are
+// kept apart.
+//
+struct ClassEntry {int classTag; const char *name;};
+
+static const ClassEntry reentrantElements[] = {
+  {ELE_TAG_Truss,         "Truss"        },
+  {ELE_TAG_ZeroLength,    "ZeroLength"   },
+  {ELE_TAG_ElasticBeam2d, "ElasticBeam2d"},
+  {ELE_TAG_ElasticBeam3d, "ElasticBeam3d"},
+  {ELE_TAG_FourNodeQuad,  "FourNodeQuad" },
+};
+
+static const ClassEntry reentrantUniaxials[] = {
+  {MAT_TAG_ElasticMaterial, "Elastic"   },
+  {MAT_TAG_Steel01,         "Steel01"   },
+  {MAT_TAG_Steel02,         "Steel02"   },
+  {MAT_TAG_Concrete01,      "Concrete01"},
+};
+
+static const ClassEntry reentrantNDMaterials[] = {
+  {ND_TAG_ElasticIsotropicPlaneStrain2d, "ElasticIsotropicPlaneStrain2D"},
+  {ND_TAG_ElasticIsotropicPlaneStress2d, "ElasticIsotropicPlaneStress2D"},
+};
+
+template <int n>
+static bool
+in_table(const ClassEntry (&table)[n], int classTag)
+{
+  for (const ClassEntry &entry : table)
+    if (entry.classTag == classTag)
+      return true;
+  return false;
+}
+
+// Throw unless every element of the domain, and every material held by
+// those elements, is of a reentrant class
+static void
+check_reentrant(Domain &domain)
+{
+  ElementIter &theElements = domain.getElements();
+  Element *theElement;
+  while ((theElement = theElements()) != nullptr) {
+    const std::string which = std::string("release_gil=True, but element ")
+                            + std::to_string(theElement->getTag());
+    if (!in_table(reentrantElements, theElement->getClassTag()))
+      throw std::invalid_argument(which + " is a " + theElement->getClassType()
+                                  + ", which is not reentrant");
+
+    bool reentrant = true;
+    switch (theElement->getClassTag()) {
+      case ELE_TAG_Truss:
+        reentrant = in_table(reentrantUniaxials, ((Truss *)theElement)->getMaterial()->getClassTag());
+        break;
+      case ELE_TAG_ZeroLength: {
+        ZeroLength *theZeroLength = (ZeroLength *)theElement;
+        for (int i = 0; i < theZeroLength->getNumMaterials(); i++)
+          reentrant = reentrant && in_table(reentrantUniaxials, theZeroLength->getMaterial(i)->getClassTag());
+        break;
+      }
+      case ELE_TAG_FourNodeQuad:
+        for (int i = 0; i < 4; i++)
+          reentrant = reentrant && in_table(reentrantNDMaterials, ((FourNodeQuad *)theElement)->getMaterial(i)->getClassTag());
+        break;
+    }
+    if (!reentrant)
+      throw std::invalid_argument(which + " holds a material that is not reentrant");
+  }
+}
+
+// invoking/invoke_batch.cpp
+UniaxialMaterial *G3_NewUniaxialMaterial(Tcl_Interp *, BasicModelBuilder *, int, TCL_Char ** const);
+
+//
+// Run one UniaxialMaterial type with each row of parameters (the
+// arguments after the tag of the uniaxialMaterial command) through a
+// strain or stress history; see UniaxialMaterialBatch.
+//
+py::dict
+uniaxial_batch(py::object interpaddr, std::string type,
+               py::array_t<double, ARRAY_FLAGS> parameters,
+               py::array_t<double, ARRAY_FLAGS> history,
+               std::string control, py::object measured,
+               int threads, double tolerance, int max_iter)
+{
+    Tcl_Interp *interp = (Tcl_Interp*)PyLong_AsVoidPtr(interpaddr.ptr());
+    std::unique_ptr<BasicModelBuilder, py::nodelete> builder = get_builder(interpaddr);
+    if (!builder)
+      throw std::runtime_error("no model builder in this interpreter");
+
+    if (parameters.ndim() != 2)
+      throw std::invalid_argument("parameters must be a two-dimensional array");
+    if (control != "strain" && control != "stress")
+      throw std::invalid_argument("control must be 'strain' or 'stress'");
+
+    UniaxialMaterialBatch batch(control == "strain" ? UniaxialMaterialBatch::StrainControl
+                                                    : UniaxialMaterialBatch::StressControl);
+    batch.setTolerance(tolerance, max_iter);
+    const int numSteps = (int)history.size();
+    if (batch.setHistory(history.data(), numSteps) < 0)
+      throw std::invalid_argument("empty history");
+
+    bool haveMeasured = !measured.is_none();
+    if (haveMeasured) {
+      auto values = measured.cast<py::array_t<double, ARRAY_FLAGS>>();
+      check_size(values, numSteps, "measured");
+      batch.setMeasured(values.data(), numSteps);
+    }
+
+    const int numSets   = (int)parameters.shape(0);
+    const int numParams = (int)parameters.shape(1);
+    std::vector<std::string> words(numParams + 1);
+    std::vector<const char *> argv(numParams + 1);
+    words[0] = type;
+    char buffer[32];
+    for (int i = 0; i < numSets; i++) {
+      for (int j = 0; j < numParams; j++) {
+        snprintf(buffer, sizeof(buffer), "%.17g", parameters.at(i, j));
+        words[j+1] = buffer;
+      }
+      for (int j = 0; j <= numParams; j++)
+        argv[j] = words[j].c_str();
+
+      UniaxialMaterial *theMaterial = G3_NewUniaxialMaterial(interp, builder.get(), numParams+1, argv.data());
+      if (theMaterial == nullptr)
+        throw std::runtime_error("could not build " + type + " from parameter set " + std::to_string(i));
+      batch.addMaterial(theMaterial);
+    }
+
+    if (threads <= 0)
+      threads = (int)std::thread::hardware_concurrency();
+
+    {
+      py::gil_scoped_release release;
+      batch.run(threads);
+    }
+
+    py::array_t<int>    status(numSets);
+    py::array_t<double> response({numSets, numSteps});
+    auto s = status.mutable_unchecked<1>();
+    auto r = response.mutable_unchecked<2>();
+    for (int i = 0; i < numSets; i++) {
+      s(i) = batch.getResult(i);
+      const double *values = batch.getResponse(i);
+      for (int j = 0; j < numSteps; j++)
+        r(i, j) = values[j];
+    }
+
+    py::dict result;
+    result["status"]   = status;
+    result["response"] = response;
+
+    if (haveMeasured) {
+      py::array_t<double> rms(numSets), nrms(numSets), maxError(numSets), energyError(numSets);
+      for (int i = 0; i < numSets; i++) {
+        const UniaxialMaterialBatch::Misfit &fit = batch.getMisfit(i);
+        rms.mutable_at(i)         = fit.rms;
+        nrms.mutable_at(i)        = fit.normalizedRms;
+        maxError.mutable_at(i)    = fit.maxError;
+        energyError.mutable_at(i) = fit.energyError;
+      }
+      result["rms"]           = rms;
+      result["normalizedRms"] = nrms;
+      result["maxError"]      = maxError;
+      result["energyError"]   = energyError;
+    }
+    return result;
+}
+
 class Channel;
 class FEM_ObjectBroker;
 class PyUniaxialMaterial : public UniaxialMaterial {
@@ -195,6 +387,16 @@ copy_vector(Vector vector)
   return array;
 }
 
+py::array_t<int>
+copy_id(const ID &id)
+{
+  py::array_t<int> array(id.Size());
+  int *ptr = static_cast<int*>(array.request().ptr);
+  for (int i=0; i<id.Size(); i++)
+    ptr[i] = id(i);
+  return array;
+}
+
 Vector *
 new_vector(py::array_t<double> array)
 {
@@ -489,6 +691,79 @@ init_obj_module(py::module &m)
     .def ("getHystereticBackbone", [](BasicModelBuilder& builder, std::string tag){
         return std::unique_ptr<HystereticBackbone, py::nodelete>(builder.getHystereticBackbone(tag));
     })
+    //
+    // Bulk model construction; each takes flat (or row-major 2D) arrays
+    //
+    .def ("reserve", [](BasicModelBuilder& builder, int nodes, int elements){
+        return BulkModelBuilder(builder).reserve(nodes, elements);
+    }, py::arg("nodes"), py::arg("elements"))
+    .def ("addNodes", [](BasicModelBuilder& builder,
+                         py::array_t<int,    ARRAY_FLAGS> tags,
+                         py::array_t<double, ARRAY_FLAGS> coords,
+                         py::object mass){
+        int n = tags.size();
+        check_size(coords, n*builder.getNDM(), "coords");
+        if (mass.is_none())
+          return BulkModelBuilder(builder).addNodes(n, tags.data(), coords.data());
+
+        auto m = mass.cast<py::array_t<double, ARRAY_FLAGS>>();
+        check_size(m, n*builder.getNDF(), "mass");
+        return BulkModelBuilder(builder).addNodes(n, tags.data(), coords.data(), m.data());
+    }, py::arg("tags"), py::arg("coords"), py::arg("mass")=py::none())
+    .def ("fixNodes", [](BasicModelBuilder& builder,
+                         py::array_t<int, ARRAY_FLAGS> tags,
+                         py::array_t<int, ARRAY_FLAGS> fixity){
+        int n = tags.size();
+        check_size(fixity, n*builder.getNDF(), "fixity");
+        return BulkModelBuilder(builder).fixNodes(n, tags.data(), fixity.data());
+    }, py::arg("tags"), py::arg("fixity"))
+    .def ("addTrusses", [](BasicModelBuilder& builder,
+                           py::array_t<int,    ARRAY_FLAGS> tags,
+                           py::array_t<int,    ARRAY_FLAGS> nodes,
+                           py::array_t<int,    ARRAY_FLAGS> materials,
+                           py::array_t<double, ARRAY_FLAGS> areas){
+        int n = tags.size();
+        check_size(nodes, 2*n, "nodes");
+        check_size(materials, n, "materials");
+        check_size(areas, n, "areas");
+        return BulkModelBuilder(builder).addTrusses(n, tags.data(), nodes.data(),
+                                                    materials.data(), areas.data());
+    }, py::arg("tags"), py::arg("nodes"), py::arg("materials"), py::arg("areas"))
+    .def ("addQuads", [](BasicModelBuilder& builder,
+                         py::array_t<int, ARRAY_FLAGS> tags,
+                         py::array_t<int, ARRAY_FLAGS> nodes,
+                         py::array_t<int, ARRAY_FLAGS> materials,
+                         double thickness, std::string type){
+        int n = tags.size();
+        check_size(nodes, 4*n, "nodes");
+        check_size(materials, n, "materials");
+        return BulkModelBuilder(builder).addQuads(n, tags.data(), nodes.data(),
+                                                  materials.data(), thickness, type.c_str());
+    }, py::arg("tags"), py::arg("nodes"), py::arg("materials"),
+       py::arg("thickness"), py::arg("type")="PlaneStrain")
+    .def ("addBricks", [](BasicModelBuilder& builder,
+                          py::array_t<int, ARRAY_FLAGS> tags,
+                          py::array_t<int, ARRAY_FLAGS> nodes,
+                          py::array_t<int, ARRAY_FLAGS> materials){
+        int n = tags.size();
+        check_size(nodes, 8*n, "nodes");
+        check_size(materials, n, "materials");
+        return BulkModelBuilder(builder).addBricks(n, tags.data(), nodes.data(), materials.data());
+    }, py::arg("tags"), py::arg("nodes"), py::arg("materials"))
+    .def ("addFrames", [](BasicModelBuilder& builder,
+                          py::array_t<int, ARRAY_FLAGS> tags,
+                          py::array_t<int, ARRAY_FLAGS> nodes,
+                          py::array_t<int, ARRAY_FLAGS> sections,
+                          py::array_t<int, ARRAY_FLAGS> transforms,
+                          int nip, bool force){
+        int n = tags.size();
+        check_size(nodes, 2*n, "nodes");
+        check_size(sections, n, "sections");
+        check_size(transforms, n, "transforms");
+        return BulkModelBuilder(builder).addFrames(n, tags.data(), nodes.data(), sections.data(),
+                                                   transforms.data(), nip, force);
+    }, py::arg("tags"), py::arg("nodes"), py::arg("sections"), py::arg("transforms"),
+       py::arg("nip")=5, py::arg("force")=false)
   ;
 
   py::class_<Domain>(m, "_Domain")
@@ -502,6 +777,46 @@ init_obj_module(py::module &m)
       return copy_vector(*domain.getNodeResponse(node, typ));
     })
     .def ("getTime", &Domain::getCurrentTime)
+    //
+    // Geometric queries; coordinates are given as sequences of length ndm
+    //
+    .def ("findNodesInBox", [](Domain& domain, std::vector<double> lo, std::vector<double> hi) {
+        ID tags;
+        domain.findNodesInBox(Vector(lo.data(), (int)lo.size()), Vector(hi.data(), (int)hi.size()), tags);
+        return copy_id(tags);
+    }, py::arg("lo"), py::arg("hi"))
+    .def ("findNodesInSphere", [](Domain& domain, std::vector<double> center, double radius) {
+        ID tags;
+        domain.findNodesInSphere(Vector(center.data(), (int)center.size()), radius, tags);
+        return copy_id(tags);
+    }, py::arg("center"), py::arg("radius"))
+    .def ("findNearestNode", [](Domain& domain, std::vector<double> x) {
+        return domain.findNearestNode(Vector(x.data(), (int)x.size()));
+    }, py::arg("x"))
+    .def ("findElementsInBox", [](Domain& domain, std::vector<double> lo, std::vector<double> hi) {
+        ID tags;
+        domain.findElementsInBox(Vector(lo.data(), (int)lo.size()), Vector(hi.data(), (int)hi.size()), tags);
+        return copy_id(tags);
+    }, py::arg("lo"), py::arg("hi"))
+    //
+    // Traversal order; "spaceFilling", "graph", or an explicit list of element tags
+    //
+    .def ("reorder", [](Domain& domain, std::string method) {
+        ID tags;
+        if (method == "spaceFilling")
+          domain.getSpaceFillingOrder(tags);
+        else if (method == "graph") {
+          RCM theRCM;
+          if (domain.getGraphOrder(theRCM, tags) < 0)
+            throw std::runtime_error("failed to order the element graph");
+        } else
+          throw std::invalid_argument("unknown ordering " + method);
+        return domain.reorder(tags);
+    }, py::arg("method"))
+    .def ("reorder", [](Domain& domain, std::vector<int> eleTags) {
+        ID tags(eleTags.data(), (int)eleTags.size());
+        return domain.reorder(tags);
+    }, py::arg("elements"))
   ;
   
   py::class_<G3_Runtime>(m, "_Runtime")
@@ -511,7 +826,16 @@ init_obj_module(py::module &m)
     .def (py::init([](G3_Runtime *runtime, G3_Config  conf) {
       return *((StaticAnalysis*)runtime->newStaticAnalysis(conf));
     }))
-    .def ("analyze", &StaticAnalysis::analyze)
+    // with release_gil other Python threads can run their own models
+    // while this one steps; it is refused unless the model only holds
+    // the classes listed in reentrant_elements and reentrant_materials
+    .def ("analyze", [](StaticAnalysis &analysis, int numSteps, bool release_gil) {
+      if (!release_gil)
+        return analysis.analyze(numSteps);
+      check_reentrant(*analysis.getDomainPtr());
+      py::gil_scoped_release release;
+      return analysis.analyze(numSteps);
+    }, py::arg("steps"), py::arg("release_gil")=false)
   ;
 
   py::class_<TransientAnalysis>(m, "TransientAnalysis");
@@ -519,14 +843,34 @@ init_obj_module(py::module &m)
     .def (py::init([](G3_Runtime *runtime, G3_Config  conf) {
       return *((DirectIntegrationAnalysis*)runtime->newTransientAnalysis(conf));
     }))
-    .def ("analyze", &TransientAnalysis::analyze)
+    .def ("analyze", [](TransientAnalysis &analysis, int numSteps, double dT, bool release_gil) {
+      if (!release_gil)
+        return analysis.analyze(numSteps, dT);
+      check_reentrant(*analysis.getDomainPtr());
+      py::gil_scoped_release release;
+      return analysis.analyze(numSteps, dT);
+    }, py::arg("steps"), py::arg("dt"), py::arg("release_gil")=false)
   ;
 
   //
   // Module-Level Functions
   //
+  py::list elements, materials;
+  for (const auto &entry : reentrantElements)
+    elements.append(entry.name);
+  for (const auto &entry : reentrantUniaxials)
+    materials.append(entry.name);
+  for (const auto &entry : reentrantNDMaterials)
+    materials.append(entry.name);
+  m.attr("reentrant_elements")  = elements;
+  m.attr("reentrant_materials") = materials;
+
   m.def ("get_builder", &get_builder);
   m.def ("getRuntime",  &getRuntime);
+  m.def ("uniaxial_batch", &uniaxial_batch,
+         py::arg("interp"), py::arg("type"), py::arg("parameters"), py::arg("history"),
+         py::arg("control")="strain", py::arg("measured")=py::none(), py::arg("threads")=0,
+         py::arg("tolerance")=1.0e-8, py::arg("max_iter")=25);
   m.def ("get_domain", [](G3_Runtime *rt)->std::unique_ptr<Domain, py::nodelete>{
       Domain *domain_addr = rt->m_domain;
       return std::unique_ptr<Domain, py::nodelete>((Domain*)domain_addr);
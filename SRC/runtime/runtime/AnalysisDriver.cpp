@@ -0,0 +1,271 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: This file contains the implementation of
+// AnalysisDriver; see AnalysisDriver.h
+//
+#include "AnalysisDriver.h"
+#include "BasicAnalysisBuilder.h"
+#include <G3_Logging.h>
+#include <Domain.h>
+#include <EquiSolnAlgo.h>
+#include <ConvergenceTest.h>
+#include <StaticIntegrator.h>
+
+// fractions of a step closer than this to 1 complete the step
+static const double fractionTol = 1.0e-10;
+
+static const char *actionNames[] = {"converged", "fallback", "cut", "grow", "abandon"};
+
+AnalysisDriver::AnalysisDriver(BasicAnalysisBuilder &theBuilder)
+  : builder(theBuilder),
+    cutFactor(0.5), growFactor(2.0), minStep(1.0e-3), maxAttempts(50),
+    verbose(false), numSteps(0)
+{
+
+}
+
+AnalysisDriver::~AnalysisDriver()
+{
+  for (Strategy &strategy : strategies) {
+    delete strategy.algorithm;
+    if (strategy.test != nullptr)
+      delete strategy.test;
+  }
+}
+
+int
+AnalysisDriver::addStrategy(EquiSolnAlgo *algorithm, ConvergenceTest *test, const char *label)
+{
+  if (algorithm == nullptr) {
+    opserr << "AnalysisDriver::addStrategy - no algorithm given\n";
+    return -1;
+  }
+
+  Strategy strategy;
+  strategy.algorithm = algorithm;
+  strategy.test = test;
+  strategy.label = (label != nullptr) ? label : "";
+  strategies.push_back(strategy);
+
+  return (int)strategies.size();
+}
+
+int
+AnalysisDriver::getNumStrategies(void) const
+{
+  return (int)strategies.size();
+}
+
+const char *
+AnalysisDriver::getStrategyLabel(int strategy) const
+{
+  if (strategy < 1 || strategy > (int)strategies.size())
+    return "";
+  return strategies[strategy-1].label.c_str();
+}
+
+int
+AnalysisDriver::setCutFactor(double factor)
+{
+  if (factor <= 0.0 || factor >= 1.0) {
+    opserr << "AnalysisDriver::setCutFactor - factor must be in (0,1)\n";
+    return -1;
+  }
+  cutFactor = factor;
+  return 0;
+}
+
+int
+AnalysisDriver::setGrowFactor(double factor)
+{
+  if (factor < 1.0) {
+    opserr << "AnalysisDriver::setGrowFactor - factor must be at least 1\n";
+    return -1;
+  }
+  growFactor = factor;
+  return 0;
+}
+
+int
+AnalysisDriver::setMinStep(double fraction)
+{
+  if (fraction <= 0.0 || fraction > 1.0) {
+    opserr << "AnalysisDriver::setMinStep - fraction must be in (0,1]\n";
+    return -1;
+  }
+  minStep = fraction;
+  return 0;
+}
+
+int
+AnalysisDriver::setMaxAttempts(int attempts)
+{
+  if (attempts < 1) {
+    opserr << "AnalysisDriver::setMaxAttempts - at least one attempt is needed\n";
+    return -1;
+  }
+  maxAttempts = attempts;
+  return 0;
+}
+
+void
+AnalysisDriver::setVerbose(bool flag)
+{
+  verbose = flag;
+}
+
+const std::vector<AnalysisDriver::Record> &
+AnalysisDriver::getLog(void) const
+{
+  return log;
+}
+
+void
+AnalysisDriver::clearLog(void)
+{
+  log.clear();
+}
+
+int
+AnalysisDriver::attempt(int strategy, double dT)
+{
+  EquiSolnAlgo *theAlgorithm = builder.getAlgorithm();
+  ConvergenceTest *theTest = builder.getConvergenceTest();
+
+  if (strategy > 0) {
+    Strategy &fallback = strategies[strategy-1];
+    theAlgorithm = fallback.algorithm;
+    if (fallback.test != nullptr)
+      theTest = fallback.test;
+  }
+
+  return builder.analyzeStep(theAlgorithm, theTest, dT);
+}
+
+void
+AnalysisDriver::record(int step, double time, double fraction, int strategy,
+                       int result, int numIter, Action action)
+{
+  Record entry;
+  entry.step     = step;
+  entry.time     = time;
+  entry.fraction = fraction;
+  entry.strategy = strategy;
+  entry.result   = result;
+  entry.numIter  = numIter;
+  entry.action   = action;
+  log.push_back(entry);
+
+  if (verbose) {
+    opserr << "AnalysisDriver - step " << step << " at " << entry.time
+           << ", fraction " << fraction << ", strategy " << strategy;
+    if (strategy > 0 && !strategies[strategy-1].label.empty())
+      opserr << " (" << strategies[strategy-1].label.c_str() << ")";
+    opserr << ": " << numIter << " iterations, " << actionNames[action] << endln;
+  }
+}
+
+int
+AnalysisDriver::analyze(int numIncr, double dT)
+{
+  StaticIntegrator *theIntegrator = nullptr;
+  if (builder.CurrentAnalysisFlag == BasicAnalysisBuilder::CURRENT_STATIC_ANALYSIS) {
+    theIntegrator = builder.getStaticIntegrator();
+    if (theIntegrator == nullptr) {
+      opserr << "AnalysisDriver::analyze - no StaticIntegrator\n";
+      return -1;
+    }
+  } else if (builder.CurrentAnalysisFlag != BasicAnalysisBuilder::CURRENT_TRANSIENT_ANALYSIS) {
+    opserr << G3_ERROR_PROMPT << "No Analysis type has been specified \n";
+    return -1;
+  }
+
+  const int numStrategies = (int)strategies.size() + 1;
+
+  // the step size carries over from one step to the next
+  double fraction = 1.0;
+
+  for (int i = 0; i < numIncr; i++, numSteps++) {
+
+    // a static step is cut through the increment of the integrator, so
+    // integrators without one can only switch strategies
+    double increment = 0.0;
+    if (theIntegrator != nullptr)
+      increment = theIntegrator->getIncrement();
+    bool canCut = (theIntegrator == nullptr || increment != 0.0);
+    if (!canCut)
+      fraction = 1.0;
+
+    double done = 0.0;
+    double applied = 1.0;
+    int failures = 0;
+
+    while (done < 1.0 - fractionTol) {
+      double size = (fraction < 1.0 - done) ? fraction : 1.0 - done;
+
+      if (theIntegrator != nullptr && size != applied) {
+        theIntegrator->setIncrement(size*increment);
+        applied = size;
+      }
+
+      int result = -1;
+      int strategy = 0;
+      for ( ; strategy < numStrategies; strategy++) {
+        double time = builder.getDomain()->getCurrentTime();
+        result = this->attempt(strategy, size*dT);
+
+        ConvergenceTest *theTest = builder.getConvergenceTest();
+        if (strategy > 0 && strategies[strategy-1].test != nullptr)
+          theTest = strategies[strategy-1].test;
+        int numIter = (theTest != nullptr) ? theTest->getNumTests() : 0;
+
+        if (result >= 0) {
+          done += size;
+          bool grow = (fraction < 1.0 && growFactor > 1.0);
+          this->record(numSteps, time, size, strategy, result, numIter, grow ? Grow : Converged);
+          if (grow) {
+            fraction *= growFactor;
+            if (fraction > 1.0)
+              fraction = 1.0;
+          }
+          break;
+        }
+
+        failures++;
+        if (failures >= maxAttempts) {
+          this->record(numSteps, time, size, strategy, result, numIter, Abandon);
+          break;
+        }
+        if (strategy < numStrategies - 1) {
+          this->record(numSteps, time, size, strategy, result, numIter, Fallback);
+          continue;
+        }
+        if (!canCut || size*cutFactor < minStep) {
+          this->record(numSteps, time, size, strategy, result, numIter, Abandon);
+          break;
+        }
+        this->record(numSteps, time, size, strategy, result, numIter, Cut);
+      }
+
+      if (result < 0) {
+        if (failures >= maxAttempts || !canCut || size*cutFactor < minStep) {
+          if (theIntegrator != nullptr && applied != 1.0)
+            theIntegrator->setIncrement(increment);
+          opserr << "AnalysisDriver::analyze - step " << numSteps
+                 << " failed after " << failures << " attempts\n";
+          return result;
+        }
+        fraction = size*cutFactor;
+      }
+    }
+
+    // restore the nominal increment for the next step
+    if (theIntegrator != nullptr && applied != 1.0)
+      theIntegrator->setIncrement(increment);
+  }
+
+  return 0;
+}
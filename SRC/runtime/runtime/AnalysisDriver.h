@@ -0,0 +1,99 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: This file contains the class definition for
+// AnalysisDriver. An AnalysisDriver runs the steps of the current
+// analysis of a BasicAnalysisBuilder and recovers from steps that fail
+// to converge. A step is first attempted with the algorithm and test of
+// the analysis; when that fails, the fallback strategies are tried in
+// the order in which they were added. When all of them fail, the step is
+// cut by the cut factor and attempted again, down to the minimum step
+// fraction or until the maximum number of attempts for the step is
+// reached. After a converged substep the step size grows by the grow
+// factor until the full step is restored.
+//
+// The strategy objects are built once, are owned by the driver and are
+// linked to the analysis only when they are used. Every decision is
+// appended to a log that can be inspected after the analysis.
+//
+// Steps are cut through StaticIntegrator::setIncrement() for a static
+// analysis and by dividing the time step of a transient one.
+//
+#ifndef AnalysisDriver_h
+#define AnalysisDriver_h
+
+#include <string>
+#include <vector>
+
+class BasicAnalysisBuilder;
+class EquiSolnAlgo;
+class ConvergenceTest;
+
+class AnalysisDriver
+{
+  public:
+    enum Action {
+      Converged,   // the attempt converged and the substep was committed
+      Fallback,    // the attempt failed and the next strategy is tried
+      Cut,         // all strategies failed and the step is cut
+      Grow,        // the step is grown after a converged substep
+      Abandon      // the step could not be completed
+    };
+
+    struct Record {
+      int    step;       // nominal step, counted over all calls to analyze()
+      double time;       // domain time (load factor) before the attempt
+      double fraction;   // size of the attempt as a fraction of the step
+      int    strategy;   // 0 is the analysis algorithm, i>0 fallback i
+      int    result;     // return value of the attempt
+      int    numIter;    // iterations taken by the algorithm
+      Action action;
+    };
+
+    AnalysisDriver(BasicAnalysisBuilder &builder);
+    ~AnalysisDriver();
+
+    // the driver takes ownership of the algorithm and of the test; with
+    // a null test the test of the analysis is used.
+    int addStrategy(EquiSolnAlgo *algorithm, ConvergenceTest *test, const char *label);
+    int getNumStrategies(void) const;
+    const char *getStrategyLabel(int strategy) const;
+
+    int setCutFactor(double factor);
+    int setGrowFactor(double factor);
+    int setMinStep(double fraction);
+    int setMaxAttempts(int attempts);
+    void setVerbose(bool verbose);
+
+    int analyze(int numSteps, double dT = 0.0);
+
+    const std::vector<Record> &getLog(void) const;
+    void clearLog(void);
+
+  private:
+    struct Strategy {
+      EquiSolnAlgo    *algorithm;
+      ConvergenceTest *test;
+      std::string      label;
+    };
+
+    int attempt(int strategy, double dT);
+    void record(int step, double time, double fraction, int strategy,
+                int result, int numIter, Action action);
+
+    BasicAnalysisBuilder &builder;
+    std::vector<Strategy> strategies;
+
+    double cutFactor;
+    double growFactor;
+    double minStep;
+    int    maxAttempts;
+    bool   verbose;
+
+    int numSteps;              // nominal steps taken so far
+    std::vector<Record> log;
+};
+
+#endif
@@ -6,6 +6,7 @@
 // Written: Minjie Zhu, Claudio Perez
 //
 #include "BasicAnalysisBuilder.h"
+#include "AnalysisDriver.h"
 #include <Domain.h>
 #include <assert.h>
 #include <stdio.h>
@@ -92,6 +93,11 @@ void BasicAnalysisBuilder::wipe()
         resetTransient();
     }
     theVariableTimeStepTransientAnalysis = nullptr;
+
+    if (theDriver != nullptr) {
+        delete theDriver;
+        theDriver = nullptr;
+    }
 }
 
 void BasicAnalysisBuilder::resetStatic()
@@ -217,6 +223,12 @@ int
 BasicAnalysisBuilder::analyze(int num_steps, double size_steps)
 {
 
+  if (theDriver != nullptr) {
+    if (this->CurrentAnalysisFlag == CURRENT_TRANSIENT_ANALYSIS)
+      ops_Dt = size_steps;
+    return theDriver->analyze(num_steps, size_steps);
+  }
+
   switch (this->CurrentAnalysisFlag) {
 
     case CURRENT_STATIC_ANALYSIS:
@@ -312,6 +324,33 @@ BasicAnalysisBuilder::analyzeTransient(int num_steps, double size_steps)
   return -1;
 }
 
+//
+// Take one step of the current analysis using the given algorithm and
+// test in place of those of the analysis; the step itself, including
+// any change of the domain, is taken by the analysis.
+//
+int
+BasicAnalysisBuilder::analyzeStep(EquiSolnAlgo* algorithm, ConvergenceTest* test, double dT)
+{
+  if (algorithm == nullptr) {
+    opserr << "BasicAnalysisBuilder::analyzeStep - no algorithm\n";
+    return -1;
+  }
+
+  switch (this->CurrentAnalysisFlag) {
+    case CURRENT_STATIC_ANALYSIS:
+      return theStaticAnalysis->analyzeStep(algorithm, test, dT);
+
+    case CURRENT_TRANSIENT_ANALYSIS:
+      ops_Dt = dT;
+      return theTransientAnalysis->analyzeStep(algorithm, test, dT);
+
+    default:
+      opserr << G3_ERROR_PROMPT << "No Analysis type has been specified \n";
+      return -1;
+  }
+}
+
 void BasicAnalysisBuilder::set(ConstraintHandler* obj) {
 
     if (obj == nullptr)
@@ -397,6 +436,15 @@ BasicAnalysisBuilder::set(LinearSOE* obj)
 
 }
 
+void
+BasicAnalysisBuilder::set(AnalysisDriver* obj)
+{
+    if (theDriver != nullptr && theDriver != obj)
+      delete theDriver;
+
+    theDriver = obj;
+}
+
 LinearSOE*
 BasicAnalysisBuilder::getLinearSOE() {
   return theSOE;
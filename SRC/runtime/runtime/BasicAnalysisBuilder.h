@@ -33,6 +33,7 @@ class StaticAnalysis;
 class DirectIntegrationAnalysis;
 class VariableTimeStepDirectIntegrationAnalysis;
 class Integrator;
+class AnalysisDriver;
 
 class BasicAnalysisBuilder
 {
@@ -87,6 +88,13 @@ public:
     int analyze(int num_steps, double size_steps=0.0);
     int analyzeStatic(int num_steps);
     int analyzeTransient(int num_steps, double size_steps=0.0);
+    // one step of the current analysis with the given algorithm and test
+    int analyzeStep(EquiSolnAlgo* algorithm, ConvergenceTest* test, double size_step=0.0);
+
+    // when set, analyze() runs its steps through the driver, which is
+    // then owned by the builder
+    void set(AnalysisDriver* obj);
+    AnalysisDriver* getDriver() {return theDriver;}
 
     void wipe();
     void resetStatic();
@@ -110,8 +118,9 @@ private:
     StaticAnalysis            *theStaticAnalysis;
     DirectIntegrationAnalysis *theTransientAnalysis;
     VariableTimeStepDirectIntegrationAnalysis *theVariableTimeStepTransientAnalysis;
+    AnalysisDriver            *theDriver = nullptr;
 
-    int domainStamp;
+    int domainStamp = 0;
     int numEigen = 0;
 };
 
@@ -0,0 +1,281 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: This file implements the BulkModelBuilder class; see
+// BulkModelBuilder.h
+//
+// Written: cmp
+//
+#include <vector>
+#include "BulkModelBuilder.h"
+#include "BasicModelBuilder.h"
+#include <OPS_Globals.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Matrix.h>
+#include <SP_Constraint.h>
+#include <UniaxialMaterial.h>
+#include <NDMaterial.h>
+#include <SectionForceDeformation.h>
+#include <CrdTransf.h>
+#include <Truss.h>
+#include <FourNodeQuad.h>
+#include <Brick.h>
+#include <DispBeamColumn2d.h>
+#include <DispBeamColumn3d.h>
+#include <ForceBeamColumn2d.h>
+#include <ForceBeamColumn3d.h>
+#include <LobattoBeamIntegration.h>
+#include <LegendreBeamIntegration.h>
+
+//
+// Element arrays usually reference a handful of tags repeatedly, so
+// remember the last lookup instead of going through the builder's
+// string-keyed tables for every element.
+//
+template <typename T, typename F>
+static T *
+lookup(int tag, int &lastTag, T *&last, F get)
+{
+  if (last == nullptr || tag != lastTag) {
+    last = get(tag);
+    lastTag = tag;
+  }
+  return last;
+}
+
+BulkModelBuilder::BulkModelBuilder(BasicModelBuilder &builder)
+  : builder(builder), domain(*builder.getDomain()),
+    ndm(builder.getNDM()), ndf(builder.getNDF())
+{
+
+}
+
+int
+BulkModelBuilder::reserve(int numNodes, int numElements)
+{
+  return domain.reserve(numNodes, numElements);
+}
+
+int
+BulkModelBuilder::addNodes(int numNodes, const int *tags, const double *coords,
+                           const double *mass)
+{
+  Matrix nodeMass(ndf, ndf);
+
+  for (int i = 0; i < numNodes; i++) {
+    const double *x = &coords[i*ndm];
+    Node *theNode = nullptr;
+    switch (ndm) {
+      case 1:
+        theNode = new Node(tags[i], ndf, x[0]);
+        break;
+      case 2:
+        theNode = new Node(tags[i], ndf, x[0], x[1]);
+        break;
+      case 3:
+        theNode = new Node(tags[i], ndf, x[0], x[1], x[2]);
+        break;
+      default:
+        opserr << "BulkModelBuilder::addNodes - unsupported model dimension\n";
+        return -1;
+    }
+
+    if (mass != nullptr) {
+      for (int j = 0; j < ndf; j++)
+        nodeMass(j, j) = mass[i*ndf + j];
+      theNode->setMass(nodeMass);
+    }
+
+    if (domain.addNode(theNode) == false) {
+      opserr << "BulkModelBuilder::addNodes - could not add node " << tags[i] << "\n";
+      delete theNode;
+      return -1;
+    }
+  }
+  return 0;
+}
+
+int
+BulkModelBuilder::fixNodes(int numNodes, const int *tags, const int *fixity)
+{
+  std::vector<SP_Constraint *> constraints;
+  constraints.reserve(numNodes);
+
+  for (int i = 0; i < numNodes; i++)
+    for (int j = 0; j < ndf; j++)
+      if (fixity[i*ndf + j] != 0)
+        constraints.push_back(new SP_Constraint(tags[i], j, 0.0, true));
+
+  int numAdded = domain.addSP_Constraints((int)constraints.size(), constraints.data());
+  if (numAdded == (int)constraints.size())
+    return 0;
+
+  // release the constraints the domain rejected
+  for (SP_Constraint *sp : constraints)
+    if (sp->getDomain() == nullptr)
+      delete sp;
+
+  opserr << "BulkModelBuilder::fixNodes - could not add "
+         << (int)constraints.size() - numAdded << " constraints\n";
+  return -1;
+}
+
+int
+BulkModelBuilder::addTrusses(int numElements, const int *tags, const int *nodes,
+                             const int *matTags, const double *areas)
+{
+  int lastTag = 0;
+  UniaxialMaterial *material = nullptr;
+
+  for (int e = 0; e < numElements; e++) {
+    UniaxialMaterial *theMaterial = lookup(matTags[e], lastTag, material,
+        [this](int tag) {return builder.getUniaxialMaterial(tag);});
+    if (theMaterial == nullptr) {
+      opserr << "BulkModelBuilder::addTrusses - no uniaxialMaterial with tag "
+             << matTags[e] << " for element " << tags[e] << "\n";
+      return -1;
+    }
+
+    const int *nd = &nodes[e*2];
+    Element *theElement = new Truss(tags[e], ndm, nd[0], nd[1], *theMaterial, areas[e]);
+    if (domain.addElement(theElement) == false) {
+      opserr << "BulkModelBuilder::addTrusses - could not add element " << tags[e] << "\n";
+      delete theElement;
+      return -1;
+    }
+  }
+  return 0;
+}
+
+int
+BulkModelBuilder::addQuads(int numElements, const int *tags, const int *nodes,
+                           const int *matTags, double thickness, const char *type)
+{
+  int lastTag = 0;
+  NDMaterial *material = nullptr;
+
+  for (int e = 0; e < numElements; e++) {
+    NDMaterial *theMaterial = lookup(matTags[e], lastTag, material,
+        [this](int tag) {return builder.getNDMaterial(tag);});
+    if (theMaterial == nullptr) {
+      opserr << "BulkModelBuilder::addQuads - no nDMaterial with tag "
+             << matTags[e] << " for element " << tags[e] << "\n";
+      return -1;
+    }
+
+    const int *nd = &nodes[e*4];
+    Element *theElement = new FourNodeQuad(tags[e], nd[0], nd[1], nd[2], nd[3],
+                                           *theMaterial, type, thickness);
+    if (domain.addElement(theElement) == false) {
+      opserr << "BulkModelBuilder::addQuads - could not add element " << tags[e] << "\n";
+      delete theElement;
+      return -1;
+    }
+  }
+  return 0;
+}
+
+int
+BulkModelBuilder::addBricks(int numElements, const int *tags, const int *nodes,
+                            const int *matTags)
+{
+  int lastTag = 0;
+  NDMaterial *material = nullptr;
+
+  for (int e = 0; e < numElements; e++) {
+    NDMaterial *theMaterial = lookup(matTags[e], lastTag, material,
+        [this](int tag) {return builder.getNDMaterial(tag);});
+    if (theMaterial == nullptr) {
+      opserr << "BulkModelBuilder::addBricks - no nDMaterial with tag "
+             << matTags[e] << " for element " << tags[e] << "\n";
+      return -1;
+    }
+
+    const int *nd = &nodes[e*8];
+    Element *theElement = new Brick(tags[e], nd[0], nd[1], nd[2], nd[3],
+                                    nd[4], nd[5], nd[6], nd[7], *theMaterial);
+    if (domain.addElement(theElement) == false) {
+      opserr << "BulkModelBuilder::addBricks - could not add element " << tags[e] << "\n";
+      delete theElement;
+      return -1;
+    }
+  }
+  return 0;
+}
+
+int
+BulkModelBuilder::addFrames(int numElements, const int *tags, const int *nodes,
+                            const int *secTags, const int *transfTags,
+                            int numSections, bool forceFormulation)
+{
+  if (ndm != 2 && ndm != 3) {
+    opserr << "BulkModelBuilder::addFrames - unsupported model dimension\n";
+    return -1;
+  }
+  if (numSections < 1) {
+    opserr << "BulkModelBuilder::addFrames - invalid number of sections\n";
+    return -1;
+  }
+
+  // the elements copy the integration rule, sections and transformation
+  LobattoBeamIntegration  lobatto;
+  LegendreBeamIntegration legendre;
+  BeamIntegration &integration = forceFormulation
+                               ? (BeamIntegration&)lobatto
+                               : (BeamIntegration&)legendre;
+
+  std::vector<SectionForceDeformation *> sections(numSections);
+
+  int lastSecTag = 0, lastTransfTag = 0;
+  SectionForceDeformation *section = nullptr;
+  CrdTransf *transf = nullptr;
+
+  for (int e = 0; e < numElements; e++) {
+    SectionForceDeformation *theSection = lookup(secTags[e], lastSecTag, section,
+        [this](int tag) {return builder.getSection(tag);});
+    if (theSection == nullptr) {
+      opserr << "BulkModelBuilder::addFrames - no section with tag "
+             << secTags[e] << " for element " << tags[e] << "\n";
+      return -1;
+    }
+
+    CrdTransf *theTransf = lookup(transfTags[e], lastTransfTag, transf,
+        [this](int tag) {return builder.getCrdTransf(tag);});
+    if (theTransf == nullptr) {
+      opserr << "BulkModelBuilder::addFrames - no transformation with tag "
+             << transfTags[e] << " for element " << tags[e] << "\n";
+      return -1;
+    }
+
+    for (int i = 0; i < numSections; i++)
+      sections[i] = theSection;
+
+    const int *nd = &nodes[e*2];
+    Element *theElement;
+    if (ndm == 2) {
+      if (forceFormulation)
+        theElement = new ForceBeamColumn2d(tags[e], nd[0], nd[1], numSections, sections.data(),
+                                           integration, *theTransf);
+      else
+        theElement = new DispBeamColumn2d(tags[e], nd[0], nd[1], numSections, sections.data(),
+                                          integration, *theTransf);
+    } else {
+      if (forceFormulation)
+        theElement = new ForceBeamColumn3d(tags[e], nd[0], nd[1], numSections, sections.data(),
+                                           integration, *theTransf);
+      else
+        theElement = new DispBeamColumn3d(tags[e], nd[0], nd[1], numSections, sections.data(),
+                                          integration, *theTransf);
+    }
+
+    if (domain.addElement(theElement) == false) {
+      opserr << "BulkModelBuilder::addFrames - could not add element " << tags[e] << "\n";
+      delete theElement;
+      return -1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,68 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+** ****************************************************************** */
+//
+// Description: This file contains the class definition for
+// BulkModelBuilder. A BulkModelBuilder populates the Domain of a
+// BasicModelBuilder from flat arrays of node coordinates, element
+// connectivity and material/section tags, without going through the
+// interpreter. All arrays are row-major, i.e. the coordinates of node
+// i are coords[i*ndm ... i*ndm+ndm-1] and the nodes of element e are
+// nodes[e*nen ... e*nen+nen-1].
+//
+// Each method returns 0 on success and a negative value if any object
+// could not be created; objects created before the failure remain in
+// the Domain.
+//
+// Written: cmp
+//
+#ifndef BulkModelBuilder_h
+#define BulkModelBuilder_h
+
+class BasicModelBuilder;
+class Domain;
+
+class BulkModelBuilder {
+public:
+  BulkModelBuilder(BasicModelBuilder &builder);
+
+  // Size the Domain containers for the objects about to be added
+  int reserve(int numNodes, int numElements);
+
+  // Nodes; mass is an optional array of ndf lumped masses per node
+  int addNodes(int numNodes, const int *tags, const double *coords,
+               const double *mass = nullptr);
+
+  // Homogeneous single-point constraints; fixity holds ndf 0/1 flags per node
+  int fixNodes(int numNodes, const int *tags, const int *fixity);
+
+  // Two node Truss elements with per-element material tag and area
+  int addTrusses(int numElements, const int *tags, const int *nodes,
+                 const int *matTags, const double *areas);
+
+  // Four node FourNodeQuad elements with per-element NDMaterial tag
+  int addQuads(int numElements, const int *tags, const int *nodes,
+               const int *matTags, double thickness,
+               const char *type = "PlaneStrain");
+
+  // Eight node Brick elements with per-element NDMaterial tag
+  int addBricks(int numElements, const int *tags, const int *nodes,
+                const int *matTags);
+
+  // Two node frame elements with numSections integration points of
+  // section secTags[e] along element e and transformation transfTags[e].
+  // Force formulations use Lobatto and displacement formulations use
+  // Legendre integration, matching the element command defaults.
+  int addFrames(int numElements, const int *tags, const int *nodes,
+                const int *secTags, const int *transfTags,
+                int numSections, bool forceFormulation = false);
+
+private:
+  BasicModelBuilder &builder;
+  Domain            &domain;
+  int ndm;
+  int ndf;
+};
+
+#endif // BulkModelBuilder_h
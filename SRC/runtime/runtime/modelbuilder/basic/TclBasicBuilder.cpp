@@ -89,9 +89,9 @@ extern int OPS_ResetInput(ClientData clientData, Tcl_Interp *interp, int cArg,
 //
 // SOME STATIC POINTERS USED IN THE FUNCTIONS INVOKED BY THE INTERPRETER
 //
-static Domain *theTclDomain = nullptr;
-static TclBasicBuilder *theTclBuilder = nullptr;
-extern LoadPattern *theTclLoadPattern;
+static thread_local Domain *theTclDomain = nullptr;
+static thread_local TclBasicBuilder *theTclBuilder = nullptr;
+extern thread_local LoadPattern *theTclLoadPattern;
 // static int nodeLoadTag = 0;
 
 //
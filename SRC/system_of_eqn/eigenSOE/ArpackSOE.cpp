@@ -100,7 +100,7 @@ ArpackSOE::setSize(Graph &theGraph)
       // recv ax n from P0
       //
 
-      static ID data(1);
+      static thread_local ID data(1);
       
       data(0) = maxVertexTag;
       Channel *theChannel = theChannels[0];
@@ -114,7 +114,7 @@ ArpackSOE::setSize(Graph &theGraph)
       // from each distributed soe recv it's max n and compare; return max n to all
       //
       
-      static ID data(1);
+      static thread_local ID data(1);
       FEM_ObjectBroker theBroker;
 
       for (int j=0; j<numChannels; j++) {
@@ -391,7 +391,7 @@ ArpackSOE::checkSameInt(int value)
 	if (processID == -1)
 		return 1;
 
-	static ID idData(1);
+	static thread_local ID idData(1);
     if (processID != 0) {
     
 		Channel *theChannel = theChannels[0];
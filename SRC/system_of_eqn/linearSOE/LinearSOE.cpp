@@ -32,15 +32,35 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include<Matrix.h>
+#include<Vector.h>
+#include<OPS_Globals.h>
+
+#ifdef _WIN32
+extern "C" int  DGETRF(int *M, int *N, double *A, int *LDA, int *iPiv, int *INFO);
+
+extern "C" int  DGETRS(char *TRANS,
+			       int *N, int *NRHS, double *A, int *LDA, 
+			       int *iPiv, double *B, int *LDB, int *INFO);
+#else
+extern "C" int dgetrf_(int *M, int *N, double *A, int *LDA, int *iPiv, int *INFO);
+
+extern "C" int dgetrs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA, 
+		       int *iPiv, double *B, int *LDB, int *INFO);
+#endif
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
-    :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
+    :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver),
+     lowRankU(0), lowRankD(0), lowRankZ(0), lowRankS(0), lowRankPivot(0),
+     lowRankFactored(false), lowRankActive(false)
 {
 
 }
 
 LinearSOE::LinearSOE(int classtag)
-:MovableObject(classtag), theModel(0), theSolver(0)
+:MovableObject(classtag), theModel(0), theSolver(0),
+     lowRankU(0), lowRankD(0), lowRankZ(0), lowRankS(0), lowRankPivot(0),
+     lowRankFactored(false), lowRankActive(false)
 {
 
 }
@@ -50,17 +70,213 @@ LinearSOE::~LinearSOE()
 {
   if (theSolver != 0)
     delete theSolver;
+
+  if (lowRankU != 0)
+    delete lowRankU;
+  if (lowRankD != 0)
+    delete lowRankD;
+  if (lowRankZ != 0)
+    delete lowRankZ;
+  if (lowRankS != 0)
+    delete lowRankS;
+  if (lowRankPivot != 0)
+    delete [] lowRankPivot;
 }
 
 int 
 LinearSOE::solve(void)
+{
+  if (theSolver == 0)
+    return -1;
+
+  if (lowRankActive == false)
+    return theSolver->solve();
+
+  return this->solveLowRank();
+}
+
+int
+LinearSOE::setLowRankUpdate(const Matrix *U, const Vector *d)
+{
+  lowRankFactored = false;
+
+  if (U == 0 || d == 0 || U->noCols() == 0) {
+    lowRankActive = false;
+    return 0;
+  }
+
+  if (U->noRows() != this->getNumEqn() || U->noCols() != d->Size()) {
+    opserr << "LinearSOE::setLowRankUpdate() - U is " << U->noRows() << " x " << U->noCols()
+           << " for " << this->getNumEqn() << " equations and " << d->Size() << " factors\n";
+    lowRankActive = false;
+    return -1;
+  }
+
+  lowRankActive = false;
+  if (this->usesDefaultSolve() == false)
+    return this->addLowRankA(*U, *d);
+
+  int n = U->noRows();
+  int m = U->noCols();
+
+  if (lowRankU == 0 || lowRankU->noRows() != n || lowRankU->noCols() != m) {
+    if (lowRankU != 0)
+      delete lowRankU;
+    if (lowRankD != 0)
+      delete lowRankD;
+    if (lowRankZ != 0)
+      delete lowRankZ;
+    if (lowRankS != 0)
+      delete lowRankS;
+    if (lowRankPivot != 0)
+      delete [] lowRankPivot;
+
+    lowRankU = new Matrix(n, m);
+    lowRankD = new Vector(m);
+    lowRankZ = new Matrix(n, m);
+    lowRankS = new Matrix(m, m);
+    lowRankPivot = new int[m];
+  }
+
+  *lowRankU = *U;
+  *lowRankD = *d;
+  lowRankActive = true;
+
+  return 0;
+}
+
+int
+LinearSOE::assembleLowRankUpdate(void)
+{
+  if (lowRankActive == false)
+    return 0;
+
+  lowRankActive = false;
+  lowRankFactored = false;
+
+  return this->addLowRankA(*lowRankU, *lowRankD);
+}
+
+int
+LinearSOE::addLowRankA(const Matrix &U, const Vector &d)
+{
+  int n = U.noRows();
+  int m = U.noCols();
+
+  // column j of U diag(d) U' is U diag(d) times row j of U
+  Vector col(n);
+  Vector y(m);
+  for (int j = 0; j < n; j++) {
+    bool zeroCol = true;
+    for (int k = 0; k < m; k++) {
+      y(k) = d(k) * U(j,k);
+      if (y(k) != 0.0)
+        zeroCol = false;
+    }
+    if (zeroCol == true)
+      continue;
+
+    col.addMatrixVector(0.0, U, y, 1.0);
+    if (this->addColA(col, j) < 0) {
+      opserr << "LinearSOE::setLowRankUpdate() - the system can neither solve with nor assemble the low rank term\n";
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+//
+// (A + U D U')x = b is solved as x = x0 - Z y, where x0 = inv(A) b,
+// Z = inv(A) U and (I + D U'Z) y = D U'x0. Z and the LU factors of the
+// m x m matrix are formed with one block solve after each new A.
+//
+int
+LinearSOE::solveLowRank(void)
+{
+  int m = lowRankU->noCols();
+
+  Vector b(this->getB());
+
+  int result = theSolver->solve();
+  if (result < 0)
+    return result;
+
+  Vector x(this->getX());
+
+  if (lowRankFactored == false) {
+    // the block solve goes through solve() for solvers without a
+    // dedicated multiple right-hand side path
+    lowRankActive = false;
+    result = this->solveMultiple(*lowRankU, *lowRankZ);
+    lowRankActive = true;
+    if (result < 0)
+      return result;
+
+    // S = I + D U'Z
+    Matrix &S = *lowRankS;
+    S.addMatrixTransposeProduct(0.0, *lowRankU, *lowRankZ, 1.0);
+    for (int i = 0; i < m; i++) {
+      for (int j = 0; j < m; j++)
+        S(i,j) *= (*lowRankD)(i);
+      S(i,i) += 1.0;
+    }
+
+    int info = 0;
+#ifdef _WIN32
+    DGETRF(&m, &m, &S(0,0), &m, lowRankPivot, &info);
+#else
+    dgetrf_(&m, &m, &S(0,0), &m, lowRankPivot, &info);
+#endif
+    if (info != 0) {
+      opserr << "LinearSOE::solve() - the low rank update makes the system singular\n";
+      this->setB(b);
+      return -1;
+    }
+    lowRankFactored = true;
+  }
+
+  // y = inv(S) D U'x0
+  Vector y(m);
+  y.addMatrixTransposeVector(0.0, *lowRankU, x, 1.0);
+  for (int i = 0; i < m; i++)
+    y(i) *= (*lowRankD)(i);
+
+  int nrhs = 1;
+  int info = 0;
+  char trans[] = "N";
+#ifdef _WIN32
+  DGETRS(trans, &m, &nrhs, &(*lowRankS)(0,0), &m, lowRankPivot, &y(0), &m, &info);
+#else
+  dgetrs_(trans, &m, &nrhs, &(*lowRankS)(0,0), &m, lowRankPivot, &y(0), &m, &info);
+#endif
+
+  x.addMatrixVector(1.0, *lowRankZ, y, -1.0);
+
+  this->setB(b);
+  this->setX(x);
+
+  return 0;
+}
+
+int
+LinearSOE::solveMultiple(const Matrix &B, Matrix &X)
 {
   if (theSolver != 0)
-    return (theSolver->solve());
+    return theSolver->solveMultiple(*this, B, X);
   else 
     return -1;
 }
 
+bool
+LinearSOE::hasSolveMultiple(void)
+{
+  if (theSolver == 0 || lowRankActive == true || this->usesDefaultSolve() == false)
+    return false;
+
+  return theSolver->hasSolveMultiple();
+}
+
 int
 LinearSOE::formAp(const Vector &p, Vector &Ap)
 {
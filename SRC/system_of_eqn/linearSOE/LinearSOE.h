@@ -56,6 +56,12 @@ class LinearSOE : public MovableObject
     virtual ~LinearSOE();
 
     virtual int solve(void);    
+
+    // solve A X = B for the columns of B, reusing the factorization
+    // of A; the B and X vectors of the system may be overwritten
+    virtual int solveMultiple(const Matrix &B, Matrix &X);
+    // true if solveMultiple() is cheaper than one solve() per column
+    bool hasSolveMultiple(void);
     virtual int setLinks(AnalysisModel &theModel);    
 
     // pure virtual functions
@@ -74,6 +80,20 @@ class LinearSOE : public MovableObject
 
     virtual int formAp(const Vector &p, Vector &Ap);
 
+    // add the symmetric rank-m term U diag(d) U' to A without assembling
+    // it; solve() then accounts for it with the Sherman-Morrison-Woodbury
+    // formula, reusing the factorization of A. The term is removed by
+    // passing null pointers. Systems that do not use the default solve()
+    // have the term assembled into A column by column instead.
+    int setLowRankUpdate(const Matrix *U, const Vector *d);
+    // assemble a pending low rank term into A, e.g. before getA()
+    int assembleLowRankUpdate(void);
+
+    // false for systems whose solve() does more than call the solver,
+    // e.g. the distributed systems, which first gather A and b; the
+    // low rank update and solveMultiple() bypass that work
+    virtual bool usesDefaultSolve(void) {return true;}
+
     virtual const Vector &getX(void) = 0;
     virtual const Vector &getB(void) = 0;    
     virtual const Matrix *getA(void) {return 0;};    
@@ -90,7 +110,20 @@ class LinearSOE : public MovableObject
     AnalysisModel* theModel;
     
   private:
+    int solveLowRank(void);
+    int addLowRankA(const Matrix &U, const Vector &d);
+
     LinearSOESolver *theSolver;    
+
+    // low rank term U diag(d) U' and, once A is factored, Z = inv(A) U
+    // and the LU factors of S = I + diag(d) U'Z
+    Matrix *lowRankU;
+    Vector *lowRankD;
+    Matrix *lowRankZ;
+    Matrix *lowRankS;
+    int    *lowRankPivot;
+    bool    lowRankFactored;
+    bool    lowRankActive;
 };
 
 
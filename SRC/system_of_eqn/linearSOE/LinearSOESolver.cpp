@@ -35,6 +35,9 @@
 // What: "@(#) LinearSOESolver.C, revA"
 
 #include <LinearSOESolver.h>
+#include <LinearSOE.h>
+#include <Matrix.h>
+#include <Vector.h>
 
 
 LinearSOESolver::LinearSOESolver(int classtag)
@@ -48,6 +51,26 @@ LinearSOESolver::~LinearSOESolver()
     
 }
 
+int
+LinearSOESolver::solveMultiple(LinearSOE &theSOE, const Matrix &B, Matrix &X)
+{
+    int numEqn = B.noRows();
+    int numRHS = B.noCols();
+    Vector b(numEqn);
+
+    for (int j=0; j<numRHS; j++) {
+	for (int i=0; i<numEqn; i++)
+	    b(i) = B(i,j);
+	theSOE.setB(b);
 
+	int result = theSOE.solve();
+	if (result < 0)
+	    return result;
 
+	const Vector &x = theSOE.getX();
+	for (int i=0; i<numEqn; i++)
+	    X(i,j) = x(i);
+    }
 
+    return 0;
+}
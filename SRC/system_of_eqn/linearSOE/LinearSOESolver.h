@@ -39,6 +39,7 @@
 
 #include <MovableObject.h>
 class LinearSOE;
+class Matrix;
 
 class LinearSOESolver : public MovableObject
 {
@@ -48,6 +49,13 @@ class LinearSOESolver : public MovableObject
 
     virtual int solve(void) = 0;
     virtual int setSize(void) = 0;
+
+    // solve for the columns of B; the default solves the columns
+    // one at a time through the LinearSOE
+    virtual int solveMultiple(LinearSOE &theSOE, const Matrix &B, Matrix &X);
+    // true if solveMultiple() handles all the columns in one pass
+    virtual bool hasSolveMultiple(void) {return false;}
+
     virtual double getDeterminant(void) {return 1.0;};
     
   protected:
@@ -38,6 +38,7 @@
 #include <BandGenLinLapackSolver.h>
 #include <BandGenLinSOE.h>
 #include <math.h>
+#include <Matrix.h>
 
 void* OPS_BandGenLinLapack()
 {
@@ -97,22 +98,56 @@ BandGenLinLapackSolver::solve(void)
 	return -1;
     }	    
 
+    // first copy B into X
+    double *Xptr = theSOE->X;
+    double *Bptr = theSOE->B;
+    for (int i=0; i<n; i++)
+	*(Xptr++) = *(Bptr++);
+
+    return this->solve(1, theSOE->X);
+}
+
+int
+BandGenLinLapackSolver::solveMultiple(LinearSOE &theLinearSOE, const Matrix &B, Matrix &X)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING BandGenLinLapackSolver::solveMultiple()- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    int n = theSOE->size;    
+    // check iPiv is large enough
+    if (iPivSize < n) {
+	opserr << "WARNING BandGenLinLapackSolver::solveMultiple()- ";
+	opserr << " iPiv not large enough - has setSize() been called?\n";
+	return -1;
+    }	    
+
+    int nrhs = B.noCols();
+    if (B.noRows() != n || X.noRows() != n || X.noCols() != nrhs) {
+	opserr << "WARNING BandGenLinLapackSolver::solveMultiple()- ";
+	opserr << " B and X do not match the size of the system\n";
+	return -1;
+    }
+    if (n == 0 || nrhs == 0)
+	return 0;
+
+    X = B;
+    return this->solve(nrhs, &X(0,0));
+}
+
+int
+BandGenLinLapackSolver::solve(int nrhs, double *Xptr)
+{
+    int n = theSOE->size;
     int kl = theSOE->numSubD;
     int ku = theSOE->numSuperD;
     int ldA = 2*kl + ku +1;
-    int nrhs = 1;
     int ldB = n;
     int info;
     double *Aptr = theSOE->A;
-    double *Xptr = theSOE->X;
-    double *Bptr = theSOE->B;
     int    *iPIV = iPiv;
-    
-    // first copy B into X
-    for (int i=0; i<n; i++) {
-	*(Xptr++) = *(Bptr++);
-    }
-    Xptr = theSOE->X;
 
     // now solve AX = B
 
@@ -47,6 +47,8 @@ class BandGenLinLapackSolver : public BandGenLinSolver
     ~BandGenLinLapackSolver();
 
     int solve(void);
+    int solveMultiple(LinearSOE &theLinearSOE, const Matrix &B, Matrix &X);
+    bool hasSolveMultiple(void) {return true;}
     int setSize(void);
 
     int sendSelf(int commitTag, Channel &theChannel);
@@ -56,6 +58,7 @@ class BandGenLinLapackSolver : public BandGenLinSolver
   protected:
 
   private:
+    int solve(int nrhs, double *X);
     int *iPiv;
     int iPivSize;
 };
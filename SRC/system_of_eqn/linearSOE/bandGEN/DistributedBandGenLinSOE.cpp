@@ -90,7 +90,7 @@ DistributedBandGenLinSOE::setSize(Graph &theGraph)
     Channel *theChannel = theChannels[0];
     theGraph.sendSelf(0, *theChannel);
     
-    static ID data(3);
+    static thread_local ID data(3);
     theChannel->recvID(0, 0, data);
     size = data(0);
     numSubD = data(1);
@@ -160,7 +160,7 @@ DistributedBandGenLinSOE::setSize(Graph &theGraph)
     }
     numSubD *= -1;
     
-    static ID data(3);
+    static thread_local ID data(3);
     data(0) = size;
     data(1) = numSubD;
     data(2) = numSuperD;
@@ -390,7 +390,7 @@ DistributedBandGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
 int 
 DistributedBandGenLinSOE::solve(void)
 {
-  static ID result(1);
+  static thread_local ID result(1);
 
   //
   // if subprocess send B and A and receive back result X, B & result
@@ -55,6 +55,7 @@ class DistributedBandGenLinSOE : public BandGenLinSOE
     void zeroB(void);
     const Vector &getB(void);
     int solve(void);
+    bool usesDefaultSolve(void) {return false;}
 
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
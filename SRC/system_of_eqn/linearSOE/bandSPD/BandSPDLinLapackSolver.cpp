@@ -34,6 +34,7 @@
 #include <BandSPDLinSOE.h>
 //#include <f2c.h>
 #include <math.h>
+#include <Matrix.h>
 
 void* OPS_BandSPDLinLapack()
 {
@@ -86,20 +87,49 @@ BandSPDLinLapackSolver::solve(void)
 	return -1;
     }
 
+    int n = theSOE->size;
+
+    // first copy B into X
+    double *Xptr = theSOE->X;
+    double *Bptr = theSOE->B;
+    for (int i=0; i<n; i++)
+	*(Xptr++) = *(Bptr++);
+
+    return this->solve(1, theSOE->X);
+}
+
+int
+BandSPDLinLapackSolver::solveMultiple(LinearSOE &theLinearSOE, const Matrix &B, Matrix &X)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING BandSPDLinLapackSolver::solveMultiple()- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    int n = theSOE->size;
+    int nrhs = B.noCols();
+    if (B.noRows() != n || X.noRows() != n || X.noCols() != nrhs) {
+	opserr << "WARNING BandSPDLinLapackSolver::solveMultiple()- ";
+	opserr << " B and X do not match the size of the system\n";
+	return -1;
+    }
+    if (n == 0 || nrhs == 0)
+	return 0;
+
+    X = B;
+    return this->solve(nrhs, &X(0,0));
+}
+
+int
+BandSPDLinLapackSolver::solve(int nrhs, double *Xptr)
+{
     int n = theSOE->size;
     int kd = theSOE->half_band -1;
     int ldA = kd +1;
-    int nrhs = 1;
     int ldB = n;
     int info;
     double *Aptr = theSOE->A;
-    double *Xptr = theSOE->X;
-    double *Bptr = theSOE->B;
-
-    // first copy B into X
-    for (int i=0; i<n; i++)
-	*(Xptr++) = *(Bptr++);
-    Xptr = theSOE->X;
 
     // now solve AX = Y
 
@@ -45,6 +45,8 @@ class BandSPDLinLapackSolver : public BandSPDLinSolver
     ~BandSPDLinLapackSolver();
 
     int solve(void);
+    int solveMultiple(LinearSOE &theLinearSOE, const Matrix &B, Matrix &X);
+    bool hasSolveMultiple(void) {return true;}
     int setSize(void);
     
     int sendSelf(int commitTag, Channel &theChannel);
@@ -54,6 +56,7 @@ class BandSPDLinLapackSolver : public BandSPDLinSolver
   protected:
 
   private:
+    int solve(int nrhs, double *X);
 
 };
 
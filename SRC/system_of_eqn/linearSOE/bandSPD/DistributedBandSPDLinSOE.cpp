@@ -91,7 +91,7 @@ DistributedBandSPDLinSOE::setSize(Graph &theGraph)
     Channel *theChannel = theChannels[0];
     theGraph.sendSelf(0, *theChannel);
     
-    static ID data(2);
+    static thread_local ID data(2);
     theChannel->recvID(0, 0, data);
     size = data(0);
     half_band = data(1);
@@ -149,7 +149,7 @@ DistributedBandSPDLinSOE::setSize(Graph &theGraph)
     }
     half_band += 1; // include the diagonal
     
-    static ID data(2);
+    static thread_local ID data(2);
     data(0) = size;
     data(1) = half_band;
 
@@ -347,7 +347,7 @@ int
 DistributedBandSPDLinSOE::solve(void)
 {
 
-  static ID result(1);
+  static thread_local ID result(1);
 
   //
   // if subprocess send B and A and receive back result X, B & result
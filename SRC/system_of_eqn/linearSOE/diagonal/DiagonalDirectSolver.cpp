@@ -155,7 +155,7 @@ int
 DiagonalDirectSolver::sendSelf(int cTag,
 			       Channel &theChannel)
 {
-  static Vector data(1);
+  static thread_local Vector data(1);
   data(0) = minDiagTol;
   return theChannel.sendVector(0, cTag, data);
 }
@@ -166,7 +166,7 @@ DiagonalDirectSolver::recvSelf(int cTag,
 			       Channel &theChannel, 
 			       FEM_ObjectBroker &theBroker)
 {
-  static Vector data(1);
+  static thread_local Vector data(1);
   theChannel.recvVector(0, cTag, data);
 
   minDiagTol = data(0);
@@ -111,7 +111,7 @@ DistributedDiagonalSOE::setSize(Graph &theGraph)
     count++;
   }
 
-  static ID otherSize(1);
+  static thread_local ID otherSize(1);
   ID otherDOFS(0, size/10);
 
   if (processID != 0) {
@@ -114,7 +114,7 @@ DistributedDiagonalSolver::solve(void)
     } 
     else {
 
-      static Vector otherShared(1);
+      static thread_local Vector otherShared(1);
       otherShared.resize(2*numShared);
       for (int i=0; i<numChannels; i++) {
 	Channel *theChannel = theChannels[i];
@@ -158,7 +158,7 @@ int
 DistributedDiagonalSolver::sendSelf(int cTag,
 			       Channel &theChannel)
 {
-  static Vector data(1);
+  static thread_local Vector data(1);
   data(0) = minDiagTol;
   return theChannel.sendVector(0, cTag, data);
 }
@@ -169,7 +169,7 @@ DistributedDiagonalSolver::recvSelf(int cTag,
 			       Channel &theChannel, 
 			       FEM_ObjectBroker &theBroker)
 {
-  static Vector data(1);
+  static thread_local Vector data(1);
   theChannel.recvVector(0, cTag, data);
 
   minDiagTol = data(0);
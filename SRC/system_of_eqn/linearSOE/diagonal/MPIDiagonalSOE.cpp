@@ -139,7 +139,7 @@ MPIDiagonalSOE::setSize(Graph &theGraph)
     int vertexTag = theVertex->getTag();
     myDOFsArray[count++] = vertexTag;
   }
-  static ID otherSize(1);
+  static thread_local ID otherSize(1);
   delete &theGraph;
   
 
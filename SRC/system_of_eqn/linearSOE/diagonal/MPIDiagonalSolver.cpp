@@ -67,8 +67,8 @@ MPIDiagonalSolver::solve(void)
   //MPI_Request requests[2*numNeighbours];
   //MPI_Status statuses[2*numNeighbours];
   bool debug_on = false;
-  static int size = theSOE->size;
-  static int numShared = theSOE->numShared;
+  static thread_local int size = theSOE->size;
+  static thread_local int numShared = theSOE->numShared;
   bool isAfactored = theSOE->isAfactored;
   ID &myDOFs = theSOE->myDOFs;
   ID &myDOFsShared = theSOE->myDOFsShared;
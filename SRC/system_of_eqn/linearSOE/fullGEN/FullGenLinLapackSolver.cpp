@@ -35,6 +35,7 @@
 #include <FullGenLinLapackSolver.h>
 #include <FullGenLinSOE.h>
 #include <math.h>
+#include <Matrix.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 
@@ -93,19 +94,59 @@ FullGenLinLapackSolver::solve(void)
 	return -1;
     }	
 	
+    // first copy B into X
+    double *Xptr = theSOE->X;
+    double *Bptr = theSOE->B;
+    for (int i=0; i<n; i++)
+	*(Xptr++) = *(Bptr++);
+
+    return this->solve(1, theSOE->X);
+}
+
+int
+FullGenLinLapackSolver::solveMultiple(LinearSOE &theLinearSOE, const Matrix &B, Matrix &X)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING FullGenLinLapackSolver::solveMultiple()- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+    
+    int n = theSOE->size;
+    
+    // check for quick return
+    if (n == 0)
+	return 0;
+    
+    // check iPiv is large enough
+    if (sizeIpiv < n) {
+	opserr << "WARNING FullGenLinLapackSolver::solveMultiple()- ";
+	opserr << " iPiv not large enough - has setSize() been called?\n";
+	return -1;
+    }	
+	
+    int nrhs = B.noCols();
+    if (B.noRows() != n || X.noRows() != n || X.noCols() != nrhs) {
+	opserr << "WARNING FullGenLinLapackSolver::solveMultiple()- ";
+	opserr << " B and X do not match the size of the system\n";
+	return -1;
+    }
+    if (nrhs == 0)
+	return 0;
+
+    X = B;
+    return this->solve(nrhs, &X(0,0));
+}
+
+int
+FullGenLinLapackSolver::solve(int nrhs, double *Xptr)
+{
+    int n = theSOE->size;
     int ldA = n;
-    int nrhs = 1;
     int ldB = n;
     int info;
     double *Aptr = theSOE->A;
-    double *Xptr = theSOE->X;
-    double *Bptr = theSOE->B;
     int *iPIV = iPiv;
-    
-    // first copy B into X
-    for (int i=0; i<n; i++)
-	*(Xptr++) = *(Bptr++);
-    Xptr = theSOE->X;
 
     // now solve AX = Y
 
@@ -47,6 +47,8 @@ class FullGenLinLapackSolver : public FullGenLinSolver
     ~FullGenLinLapackSolver();
 
     int solve(void);
+    int solveMultiple(LinearSOE &theLinearSOE, const Matrix &B, Matrix &X);
+    bool hasSolveMultiple(void) {return true;}
     int setSize(void);
     
     int sendSelf(int commitTag, Channel &theChannel);
@@ -56,6 +58,7 @@ class FullGenLinLapackSolver : public FullGenLinSolver
   protected:
 
   private:
+    int solve(int nrhs, double *X);
     int *iPiv;
     int sizeIpiv;
 };
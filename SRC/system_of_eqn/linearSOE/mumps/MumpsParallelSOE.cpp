@@ -114,7 +114,7 @@ MumpsParallelSOE::setSize(Graph &theGraph)
     // if subprocess, send local max vertexTag (n)
     // recv ax n from P0
     //
-    static ID data(1);
+    static thread_local ID data(1);
 
     data(0) = maxVertexTag;
     Channel *theChannel = theChannels[0];
@@ -129,7 +129,7 @@ MumpsParallelSOE::setSize(Graph &theGraph)
     // from each distributed soe recv it's max n and compare; return max n to all
     //
 
-    static ID data(1);
+    static thread_local ID data(1);
     FEM_ObjectBroker theBroker;
     for (int j=0; j<numChannels; j++) {
       Channel *theChannel = theChannels[j];
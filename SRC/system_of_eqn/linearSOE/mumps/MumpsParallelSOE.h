@@ -60,6 +60,7 @@ class MumpsParallelSOE : public MumpsSOE
     const Vector &getB(void);
     void zeroB(void);
     int solve(void);
+    bool usesDefaultSolve(void) {return false;}
 
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
@@ -220,7 +220,7 @@ PetscSOE::setSize(Graph &theGraph)
 
   PETSCSOE_DEBUGOUT << "        + PetscSOE::setSize() [" << processID <<  "] : Determining global maximum dof tag\n";
   isFactored = 0;
-  static ID data(1);
+  static thread_local ID data(1);
   if (processID != 0)
   {
     Channel *theChannel = theChannels[0];
@@ -114,7 +114,7 @@ PetscSolver::solve(void)
 
 
     // Everyone sends the assembled vector B to the rank 0 processor. Which sends it back...
-    static Vector recvVector(1);
+    static thread_local Vector recvVector(1);
 
 
     Vector *vectX = theSOE->vectX;
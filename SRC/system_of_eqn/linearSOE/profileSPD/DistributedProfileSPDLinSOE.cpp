@@ -95,7 +95,7 @@ DistributedProfileSPDLinSOE::setSize(Graph &theGraph)
 
     theGraph.sendSelf(0, *theChannel);
     
-    static ID data(1);
+    static thread_local ID data(1);
     theChannel->recvID(0, 0, data);
     size = data(0);
 
@@ -216,7 +216,7 @@ DistributedProfileSPDLinSOE::setSize(Graph &theGraph)
     for (int j=1; j<size; j++)
 	iDiagLoc[j] = iDiagLoc[j] + 1 + iDiagLoc[j-1];
 
-    static ID data(1);
+    static thread_local ID data(1);
     data(0) = size;
 
     ID iLoc(iDiagLoc, size);
@@ -230,7 +230,7 @@ DistributedProfileSPDLinSOE::setSize(Graph &theGraph)
       theChannel->sendID(0, 0, iLoc);
 
 
-      static ID remoteLocalSize(1);
+      static thread_local ID remoteLocalSize(1);
       ID *subMap = localCol[j];
       theChannel->recvID(0, 0, *subMap);
       theChannel->recvID(0, 0, remoteLocalSize);
@@ -428,7 +428,7 @@ DistributedProfileSPDLinSOE::addA(const Matrix &m, const ID &id, double fact)
 int 
 DistributedProfileSPDLinSOE::solve(void)
 {
-  static ID result(1);
+  static thread_local ID result(1);
 
   //
   // if subprocess send B and A and receive back result X, B & result
@@ -54,6 +54,7 @@ class DistributedProfileSPDLinSOE : public ProfileSPDLinSOE
     void zeroB(void);
     int setSize(Graph &theGraph);
     int solve(void);
+    bool usesDefaultSolve(void) {return false;}
     const Vector &getB(void);
 
     int sendSelf(int commitTag, Channel &theChannel);
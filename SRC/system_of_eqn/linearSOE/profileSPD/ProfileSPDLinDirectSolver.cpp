@@ -31,6 +31,7 @@
 #include <ProfileSPDLinDirectSolver.h>
 #include <ProfileSPDLinSOE.h>
 #include <math.h>
+#include <Matrix.h>
 #include <stdlib.h>
 
 #include <Channel.h>
@@ -302,6 +303,82 @@ ProfileSPDLinDirectSolver::solve(void)
     return 0;
 }
 
+int
+ProfileSPDLinDirectSolver::solveMultiple(LinearSOE &theLinearSOE, const Matrix &B, Matrix &X)
+{
+    if (theSOE == 0) {
+	opserr << "ProfileSPDLinDirectSolver::solveMultiple(): ";
+	opserr << " - No ProfileSPDSOE has been assigned\n";
+	return -1;
+    }
+
+    int theSize = theSOE->size;
+    int nrhs = B.noCols();
+    if (B.noRows() != theSize || X.noRows() != theSize || X.noCols() != nrhs) {
+	opserr << "ProfileSPDLinDirectSolver::solveMultiple(): ";
+	opserr << " - B and X do not match the size of the system\n";
+	return -1;
+    }
+
+    if (theSize == 0 || nrhs == 0)
+	return 0;
+
+    // if the matrix has not been factored, factor it while solving
+    // for the first column
+    int first = 0;
+    if (theSOE->isAfactored == false) {
+	for (int i=0; i<theSize; i++)
+	    theSOE->B[i] = B(i,0);
+	int result = this->solve();
+	if (result < 0)
+	    return result;
+	for (int i=0; i<theSize; i++)
+	    X(i,0) = theSOE->X[i];
+	first = 1;
+    }
+
+    for (int r=first; r<nrhs; r++)
+	for (int i=0; i<theSize; i++)
+	    X(i,r) = B(i,r);
+
+    // do forward substitution; each column of [U] is used for all
+    // the right-hand sides while it is in cache
+    for (int i=1; i<theSize; i++) {
+	int rowitop = RowTop[i];
+	int len = i - rowitop;
+	double *ajiPtr = topRowPtr[i];
+	for (int r=first; r<nrhs; r++) {
+	    double *bjPtr = &X(rowitop,r);
+	    double tmp = 0;
+	    for (int j=0; j<len; j++)
+		tmp -= ajiPtr[j] * bjPtr[j];
+	    X(i,r) += tmp;
+	}
+    }
+
+    // divide by diag term
+    for (int r=first; r<nrhs; r++) {
+	double *bjPtr = &X(0,r);
+	for (int j=0; j<theSize; j++)
+	    bjPtr[j] *= invD[j];
+    }
+
+    // now do the back substitution
+    for (int k=(theSize-1); k>0; k--) {
+	int rowktop = RowTop[k];
+	int len = k - rowktop;
+	double *ajiPtr = topRowPtr[k];
+	for (int r=first; r<nrhs; r++) {
+	    double *bjPtr = &X(rowktop,r);
+	    double bk = X(k,r);
+	    for (int j=0; j<len; j++)
+		bjPtr[j] -= ajiPtr[j] * bk;
+	}
+    }
+
+    return 0;
+}
+
 double
 ProfileSPDLinDirectSolver::getDeterminant(void) 
 {
@@ -50,6 +50,8 @@ class ProfileSPDLinDirectSolver : public ProfileSPDLinSolver
     virtual ~ProfileSPDLinDirectSolver();
 
     virtual int solve(void);        
+    virtual int solveMultiple(LinearSOE &theLinearSOE, const Matrix &B, Matrix &X);
+    virtual bool hasSolveMultiple(void) {return true;}
     virtual int setSize(void);    
     double getDeterminant(void);
 
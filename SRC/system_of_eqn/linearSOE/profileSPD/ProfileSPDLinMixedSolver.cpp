@@ -0,0 +1,361 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the implementation for 
+// ProfileSPDLinMixedSolver.
+//
+// The factorization follows ProfileSPDLinDirectSolver, with the
+// factors stored in single precision and the inner products
+// accumulated in double precision. Each solve is
+//
+//   x = inv(F) b,   repeat { r = b - A x;  x += inv(F) r }
+//
+// until the correction is below tol relative to x. Each step must at
+// least halve the correction, otherwise the refinement has stalled.
+//
+#include <ProfileSPDLinMixedSolver.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <ProfileSPDLinSOE.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+
+ProfileSPDLinMixedSolver::ProfileSPDLinMixedSolver(double t, int max, int flag)
+:ProfileSPDLinSolver(SOLVER_TAGS_ProfileSPDLinMixedSolver),
+ tol(t), maxIter(max), printFlag(flag),
+ size(0), RowTop(0), F(0), topRowPtr(0), invD(0), work(0),
+ isFactored(false), useDouble(false), numIter(0), numFallback(0),
+ theDirectSolver(0)
+{
+
+}
+
+    
+ProfileSPDLinMixedSolver::~ProfileSPDLinMixedSolver()
+{
+    if (RowTop != 0) delete [] RowTop;
+    if (F != 0) delete [] F;
+    if (topRowPtr != 0) free((void *)topRowPtr);
+    if (invD != 0) delete [] invD;
+    if (work != 0) delete [] work;
+    if (theDirectSolver != 0) delete theDirectSolver;
+}
+
+
+int
+ProfileSPDLinMixedSolver::setLinearSOE(ProfileSPDLinSOE &theNewSOE)
+{
+    if (theDirectSolver != 0)
+	theDirectSolver->setProfileSOE(theNewSOE);
+    return this->ProfileSPDLinSolver::setLinearSOE(theNewSOE);
+}
+
+
+int
+ProfileSPDLinMixedSolver::setSize(void)
+{
+    if (theSOE == 0) {
+	opserr << "ProfileSPDLinMixedSolver::setSize()";
+	opserr << " No system has been set\n";
+	return -1;
+    }
+
+    isFactored = false;
+    useDouble = false;
+
+    // check for quick return 
+    if (theSOE->size == 0)
+	return 0;
+
+    if (theDirectSolver != 0 && theDirectSolver->setSize() < 0)
+	return -1;
+    
+    size = theSOE->size;
+    int profileSize = theSOE->iDiagLoc[size-1];
+    
+    if (RowTop != 0) delete [] RowTop;
+    if (F != 0) delete [] F;
+    if (topRowPtr != 0) free((void *)topRowPtr);
+    if (invD != 0) delete [] invD;
+    if (work != 0) delete [] work;
+
+    RowTop = new int[size];
+    F = new float[profileSize];
+    topRowPtr = (float **)malloc(size *sizeof(float *));
+    invD = new float[size]; 
+    work = new double[2*size];
+	
+    if (RowTop == 0 || F == 0 || topRowPtr == 0 || invD == 0 || work == 0) {
+	opserr << "Warning :ProfileSPDLinMixedSolver::setSize() :";
+	opserr << " ran out of memory for work areas \n";
+	return -1;
+    }
+
+    int *iDiagLoc = theSOE->iDiagLoc;
+
+    RowTop[0] = 0;
+    topRowPtr[0] = F;
+    for (int j=1; j<size; j++) {
+	int icolsz = iDiagLoc[j] - iDiagLoc[j-1];
+	RowTop[j] = j - icolsz +  1;
+	topRowPtr[j] = &F[iDiagLoc[j-1]]; // FORTRAN array indexing in iDiagLoc
+    }
+
+    return 0;
+}
+
+
+int
+ProfileSPDLinMixedSolver::factor(void)
+{
+    int profileSize = theSOE->iDiagLoc[size-1];
+    double *A = theSOE->A;
+    for (int i=0; i<profileSize; i++)
+	F[i] = (float)A[i];
+
+    if (F[0] <= 0.0f)
+	return -2;
+    invD[0] = 1.0f/F[0];
+
+    for (int i=1; i<size; i++) {
+
+	int rowitop = RowTop[i];
+	float *ajiPtr = topRowPtr[i];
+
+	for (int j=rowitop; j<i; j++) {
+	    double tmp = *ajiPtr;
+	    int rowjtop = RowTop[j];
+	    int top = (rowitop > rowjtop) ? rowitop : rowjtop;
+	    float *akjPtr = topRowPtr[j] + (top-rowjtop);
+	    float *akiPtr = topRowPtr[i] + (top-rowitop);
+
+	    for (int k=top; k<j; k++) 
+		tmp -= (double)*akjPtr++ * *akiPtr++;
+
+	    *ajiPtr++ = (float)tmp;
+	}
+
+	// now form i'th col of [U] and determine [dii]
+	double aii = A[theSOE->iDiagLoc[i] -1]; // FORTRAN ARRAY INDEXING
+	ajiPtr = topRowPtr[i];
+	for (int jj=rowitop; jj<i; jj++) {
+	    double aji = *ajiPtr;
+	    double lij = aji * invD[jj];
+	    *ajiPtr++ = (float)lij;
+	    aii -= lij*aji;
+	}
+
+	// a pivot lost to single precision round off is left to the
+	// double precision fallback
+	if (aii <= 0.0 || (float)aii == 0.0f)
+	    return -2;
+
+	invD[i] = (float)(1.0/aii);
+    }
+
+    return 0;
+}
+
+
+void
+ProfileSPDLinMixedSolver::backSolve(double *x)
+{
+    // forward substitution
+    for (int i=1; i<size; i++) {
+	int rowitop = RowTop[i];	    
+	float *ajiPtr = topRowPtr[i];
+	double *bjPtr  = &x[rowitop];  
+	double tmp = 0;	    
+	for (int j=rowitop; j<i; j++) 
+	    tmp -= *ajiPtr++ * *bjPtr++; 
+	x[i] += tmp;
+    }
+
+    // divide by diag term 
+    for (int j=0; j<size; j++) 
+	x[j] *= invD[j];
+
+    // back substitution
+    for (int k=(size-1); k>0; k--) {
+	int rowktop = RowTop[k];
+	double bk = x[k];
+	float *ajiPtr = topRowPtr[k]; 		
+	for (int j=rowktop; j<k; j++) 
+	    x[j] -= *ajiPtr++ * bk;
+    }   	 
+}
+
+
+void
+ProfileSPDLinMixedSolver::formResidual(const double *x, double *r)
+{
+    // r = B - A x, A stored by columns of its upper triangle
+    double *A = theSOE->A;
+    double *B = theSOE->B;
+    int *iDiagLoc = theSOE->iDiagLoc;
+
+    for (int i=0; i<size; i++)
+	r[i] = B[i];
+
+    r[0] -= A[0]*x[0];
+    for (int i=1; i<size; i++) {
+	int rowitop = RowTop[i];
+	double *ajiPtr = &A[iDiagLoc[i-1]];
+	double xi = x[i];
+	double tmp = 0.0;
+	for (int j=rowitop; j<i; j++) {
+	    double aji = *ajiPtr++;
+	    tmp += aji * x[j];
+	    r[j] -= aji * xi;
+	}
+	r[i] -= tmp + *ajiPtr * xi;
+    }
+}
+
+
+int 
+ProfileSPDLinMixedSolver::solve(void)
+{
+    if (theSOE == 0) {
+	opserr << "ProfileSPDLinMixedSolver::solve(void): ";
+	opserr << " - No ProfileSPDSOE has been assigned\n";
+	return -1;
+    }
+    
+    if (theSOE->size == 0)
+	return 0;
+
+    if (theSOE->isAfactored == false) {
+	isFactored = false;
+	useDouble = false;
+    }
+
+    if (useDouble == true)
+	return this->solveDouble();
+
+    if (isFactored == false) {
+	if (this->factor() < 0) {
+	    if (printFlag != 0)
+		opserr << "ProfileSPDLinMixedSolver::solve() - single precision factorization failed, using double precision\n";
+	    useDouble = true;
+	    numIter = -1;
+	    numFallback++;
+	    return this->solveDouble();
+	}
+	isFactored = true;
+
+	// the SOE matrix itself is left unfactored
+	theSOE->isAfactored = true;
+	theSOE->numInt = 0;
+    }
+
+    double *X = theSOE->X;
+    double *B = theSOE->B;
+    double *r = work;
+
+    for (int i=0; i<size; i++)
+	X[i] = B[i];
+    this->backSolve(X);
+
+    double lastNorm = 0.0;
+    for (numIter=1; numIter<=maxIter; numIter++) {
+	this->formResidual(X, r);
+	this->backSolve(r);
+
+	double dxNorm = 0.0;
+	double xNorm = 0.0;
+	for (int i=0; i<size; i++) {
+	    X[i] += r[i];
+	    if (fabs(r[i]) > dxNorm) dxNorm = fabs(r[i]);
+	    if (fabs(X[i]) > xNorm) xNorm = fabs(X[i]);
+	}
+
+	if (dxNorm <= tol*xNorm) {
+	    if (printFlag != 0)
+		opserr << "ProfileSPDLinMixedSolver::solve() - " << numIter << " refinement steps\n";
+	    return 0;
+	}
+
+	if (numIter > 1 && dxNorm > 0.5*lastNorm)
+	    break;
+	lastNorm = dxNorm;
+    }
+
+    // refinement stalled; factor the double precision matrix instead
+    if (numIter > maxIter)
+	numIter = maxIter;
+    if (printFlag != 0)
+	opserr << "ProfileSPDLinMixedSolver::solve() - refinement stalled after " << numIter << " steps, using double precision\n";
+
+    useDouble = true;
+    isFactored = false;
+    numIter = -1;
+    numFallback++;
+    theSOE->isAfactored = false;
+    return this->solveDouble();
+}
+
+
+int
+ProfileSPDLinMixedSolver::solveDouble(void)
+{
+    if (theDirectSolver == 0) {
+	theDirectSolver = new ProfileSPDLinDirectSolver();
+	theDirectSolver->setProfileSOE(*theSOE);
+	if (theDirectSolver->setSize() < 0) {
+	    opserr << "ProfileSPDLinMixedSolver::solve() - failed to set up the double precision solver\n";
+	    delete theDirectSolver;
+	    theDirectSolver = 0;
+	    return -1;
+	}
+    }
+
+    return theDirectSolver->solve();
+}
+
+
+double
+ProfileSPDLinMixedSolver::getDeterminant(void) 
+{
+    if (useDouble == true)
+	return theDirectSolver->getDeterminant();
+
+    double determinant = 1.0;
+    for (int i=0; i<size; i++)
+	determinant *= invD[i];
+    return 1.0/determinant;
+}
+
+
+int
+ProfileSPDLinMixedSolver::sendSelf(int cTag, Channel &theChannel)
+{
+    return 0;
+}
+
+
+int 
+ProfileSPDLinMixedSolver::recvSelf(int cTag, Channel &theChannel, 
+				   FEM_ObjectBroker &theBroker)
+{
+    return 0;
+}
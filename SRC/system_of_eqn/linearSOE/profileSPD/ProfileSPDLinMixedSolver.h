@@ -0,0 +1,82 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the class definition for 
+// ProfileSPDLinMixedSolver. ProfileSPDLinMixedSolver is a subclass 
+// of ProfileSPDLinSolver. It factors a single precision copy of the
+// ProfileSPDLinSOE matrix into U^t D U and recovers a double precision
+// solution by iterative refinement against the (unfactored) double
+// precision matrix held by the SOE. If the refinement does not reach
+// the tolerance, or stalls, the solver falls back to the double
+// precision ProfileSPDLinDirectSolver for that matrix; the direct
+// solver and its work areas are only allocated on the first fallback.
+//
+#ifndef ProfileSPDLinMixedSolver_h
+#define ProfileSPDLinMixedSolver_h
+
+#include "ProfileSPDLinSolver.h"
+
+class ProfileSPDLinSOE;
+class ProfileSPDLinDirectSolver;
+
+class ProfileSPDLinMixedSolver : public ProfileSPDLinSolver
+{
+  public:
+    ProfileSPDLinMixedSolver(double tol=1.0e-12, int maxIter=10, int printFlag=0);
+    virtual ~ProfileSPDLinMixedSolver();
+
+    virtual int solve(void);        
+    virtual int setSize(void);    
+    virtual int setLinearSOE(ProfileSPDLinSOE &theSOE);
+    double getDeterminant(void);
+
+    // refinement steps taken by the last solve, -1 if it fell back
+    // to the double precision factorization
+    int getNumIterations(void) const {return numIter;}
+    int getNumFallbacks(void) const {return numFallback;}
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+    
+  private:
+    int factor(void);
+    int solveDouble(void);
+    void backSolve(double *x);
+    void formResidual(const double *x, double *r);
+
+    double tol;
+    int maxIter;
+    int printFlag;
+
+    int size;
+    int *RowTop;
+    float *F;              // single precision U^t D U factors
+    float **topRowPtr, *invD;
+    double *work;          // residual and correction, 2*size
+
+    bool isFactored;       // F holds the factors of the current A
+    bool useDouble;        // current A was factored in double precision
+    int numIter;
+    int numFallback;
+
+    ProfileSPDLinDirectSolver *theDirectSolver;
+};
+
+#endif
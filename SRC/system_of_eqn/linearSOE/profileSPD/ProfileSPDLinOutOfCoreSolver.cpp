@@ -0,0 +1,433 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the implementation for 
+// ProfileSPDLinOutOfCoreSolver.
+//
+// Columns are grouped into panels of about a quarter of the memory
+// budget. Column i of the factor reads columns RowTop[i] to i-1, so
+// once panel p is factored every panel ending at or below the lowest
+// RowTop of the columns still to come can be written back and dropped.
+// Panels are only dropped while more than the budget is resident; a
+// profile whose envelope alone exceeds the budget is still factored
+// correctly, with the kernel paging in what the budget cannot hold.
+// The prefetch is madvise(MADV_WILLNEED), which starts the read of the
+// next panel and returns, so it overlaps with work on the current one.
+//
+#include <ProfileSPDLinOutOfCoreSolver.h>
+#include <ProfileSPDLinSOE.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+
+ProfileSPDLinOutOfCoreSolver::ProfileSPDLinOutOfCoreSolver(double memoryBudget,
+							   const char *dir,
+							   double tol)
+:ProfileSPDLinSolver(SOLVER_TAGS_ProfileSPDLinOutOfCoreSolver),
+ minDiagTol(tol), budget(memoryBudget), scratchDir(0),
+ size(0), RowTop(0), topRowPtr(0), invD(0),
+ numPanels(0), panelStart(0), panelNeed(0), isResident(0), residentBytes(0)
+{
+    if (dir == 0)
+	dir = getenv("TMPDIR");
+    if (dir == 0)
+	dir = "/tmp";
+    scratchDir = new char[strlen(dir)+1];
+    strcpy(scratchDir, dir);
+}
+
+    
+ProfileSPDLinOutOfCoreSolver::~ProfileSPDLinOutOfCoreSolver()
+{
+    if (scratchDir != 0) delete [] scratchDir;
+    if (RowTop != 0) delete [] RowTop;
+    if (topRowPtr != 0) free((void *)topRowPtr);
+    if (invD != 0) delete [] invD;
+    if (panelStart != 0) delete [] panelStart;
+    if (panelNeed != 0) delete [] panelNeed;
+    if (isResident != 0) delete [] isResident;
+}
+
+
+int
+ProfileSPDLinOutOfCoreSolver::setLinearSOE(ProfileSPDLinSOE &theNewSOE)
+{
+    theNewSOE.setScratchDirectory(scratchDir);
+    return this->ProfileSPDLinSolver::setLinearSOE(theNewSOE);
+}
+
+
+int
+ProfileSPDLinOutOfCoreSolver::setSize(void)
+{
+    if (theSOE == 0) {
+	opserr << "ProfileSPDLinOutOfCoreSolver::setSize()";
+	opserr << " No system has been set\n";
+	return -1;
+    }
+
+    // check for quick return 
+    if (theSOE->size == 0)
+	return 0;
+    
+    size = theSOE->size;
+    
+    if (RowTop != 0) delete [] RowTop;
+    if (topRowPtr != 0) free((void *)topRowPtr);
+    if (invD != 0) delete [] invD;
+    if (panelStart != 0) delete [] panelStart;
+    if (panelNeed != 0) delete [] panelNeed;
+    if (isResident != 0) delete [] isResident;
+
+    RowTop = new int[size];
+    topRowPtr = (double **)malloc(size *sizeof(double *));
+    invD = new double[size]; 
+    panelStart = new int[size+1];
+    panelNeed = new int[size];
+    isResident = new bool[size];
+	
+    if (RowTop == 0 || topRowPtr == 0 || invD == 0 ||
+	panelStart == 0 || panelNeed == 0 || isResident == 0) {
+	opserr << "Warning :ProfileSPDLinOutOfCoreSolver::setSize() :";
+	opserr << " ran out of memory for work areas \n";
+	return -1;
+    }
+
+    double *A = theSOE->A;
+    int *iDiagLoc = theSOE->iDiagLoc;
+
+    RowTop[0] = 0;
+    topRowPtr[0] = A;
+    for (int j=1; j<size; j++) {
+	int icolsz = iDiagLoc[j] - iDiagLoc[j-1];
+	RowTop[j] = j - icolsz +  1;
+	topRowPtr[j] = &A[iDiagLoc[j-1]]; // FORTRAN array indexing in iDiagLoc
+    }
+
+    // cut the columns into panels of about a quarter of the budget
+    double panelTarget = budget/4.0;
+    numPanels = 0;
+    panelStart[0] = 0;
+    double bytes = 0;
+    for (int j=0; j<size; j++) {
+	int icolsz = (j == 0) ? 1 : iDiagLoc[j] - iDiagLoc[j-1];
+	double colBytes = icolsz * sizeof(double);
+	if (bytes > 0 && bytes + colBytes > panelTarget) {
+	    panelStart[++numPanels] = j;
+	    bytes = 0;
+	}
+	bytes += colBytes;
+    }
+    panelStart[++numPanels] = size;
+
+    // lowest column read by the columns after each panel
+    int need = size;
+    int p = numPanels-1;
+    for (int j=size-1; j>=0; j--) {
+	if (j == panelStart[p+1]-1) 
+	    panelNeed[p--] = need;
+	if (RowTop[j] < need)
+	    need = RowTop[j];
+    }
+
+    for (int i=0; i<numPanels; i++)
+	isResident[i] = false;
+    residentBytes = 0;
+
+    return 0;
+}
+
+
+size_t
+ProfileSPDLinOutOfCoreSolver::panelBytes(int panel)
+{
+    double *start = topRowPtr[panelStart[panel]];
+    double *end = (panel+1 < numPanels) ?
+	topRowPtr[panelStart[panel+1]] : theSOE->A + theSOE->profileSize;
+    return (end - start) * sizeof(double);
+}
+
+
+void
+ProfileSPDLinOutOfCoreSolver::prefetch(int panel)
+{
+    if (theSOE->scratchFd < 0 || panel < 0 || panel >= numPanels)
+	return;
+    if (isResident[panel] == true)
+	return;
+
+    isResident[panel] = true;
+    size_t numBytes = this->panelBytes(panel);
+    residentBytes += numBytes;
+
+#ifndef _WIN32
+    // round the start down to a page, madvise wants it aligned
+    size_t pageSize = sysconf(_SC_PAGESIZE);
+    size_t start = (size_t)topRowPtr[panelStart[panel]];
+    size_t first = start - start % pageSize;
+    madvise((void *)first, numBytes + (start-first), MADV_WILLNEED);
+#endif
+}
+
+
+void
+ProfileSPDLinOutOfCoreSolver::release(int panel)
+{
+    if (theSOE->scratchFd < 0 || isResident[panel] == false)
+	return;
+
+    isResident[panel] = false;
+    size_t numBytes = this->panelBytes(panel);
+    residentBytes -= numBytes;
+
+#ifndef _WIN32
+    // only the pages wholly inside the panel are dropped; the ones it
+    // shares with its neighbours go with them
+    size_t pageSize = sysconf(_SC_PAGESIZE);
+    size_t start = (size_t)topRowPtr[panelStart[panel]];
+    size_t end = start + numBytes;
+    size_t first = start + (pageSize - start % pageSize) % pageSize;
+    size_t last = end - end % pageSize;
+    if (last <= first)
+	return;
+
+    size_t offset = first - (size_t)theSOE->A;
+    msync((void *)first, last-first, MS_SYNC);
+    madvise((void *)first, last-first, MADV_DONTNEED);
+    posix_fadvise(theSOE->scratchFd, offset, last-first, POSIX_FADV_DONTNEED);
+#endif
+}
+
+
+void
+ProfileSPDLinOutOfCoreSolver::releaseAll(void)
+{
+    for (int p=0; p<numPanels; p++) {
+	isResident[p] = true;
+	this->release(p);
+    }
+    residentBytes = 0;
+}
+
+
+int 
+ProfileSPDLinOutOfCoreSolver::solve(void)
+{
+    // check for quick returns
+    if (theSOE == 0) {
+	opserr << "ProfileSPDLinOutOfCoreSolver::solve(void): ";
+	opserr << " - No ProfileSPDSOE has been assigned\n";
+	return -1;
+    }
+    
+    if (theSOE->size == 0)
+	return 0;
+
+    // set some pointers
+    double *B = theSOE->B;
+    double *X = theSOE->X;
+    int theSize = theSOE->size;
+
+    // copy B into X
+    for (int ii=0; ii<theSize; ii++)
+	X[ii] = B[ii];
+
+    bool isMapped = (theSOE->scratchFd >= 0);
+    
+    if (theSOE->isAfactored == false)  {
+
+	// the assembled matrix is resident in whole or in part; if it is
+	// over the budget write it back and start the sweep from disk
+	if (isMapped) {
+	    if (theSOE->profileSize * sizeof(double) > budget)
+		this->releaseAll();
+	    else {
+		for (int p=0; p<numPanels; p++)
+		    isResident[p] = true;
+		residentBytes = theSOE->profileSize * sizeof(double);
+	    }
+	}
+
+	// FACTOR & SOLVE
+	this->prefetch(0);
+	double a00 = theSOE->A[0];
+	if (a00 <= 0.0) {
+	  opserr << "ProfileSPDLinOutOfCoreSolver::solve() - ";
+	  opserr << " aii < 0 (i, aii): (0,0)\n"; 
+	  return(-2);
+	}    
+	
+        invD[0] = 1.0/a00;	
+	
+	int firstKept = 0;
+	for (int p=0; p<numPanels; p++) {
+
+	    this->prefetch(p);
+	    this->prefetch(p+1);
+
+	    int iStart = (panelStart[p] == 0) ? 1 : panelStart[p];
+	    for (int i=iStart; i<panelStart[p+1]; i++) {
+
+		int rowitop = RowTop[i];
+		double *ajiPtr = topRowPtr[i];
+
+		for (int j=rowitop; j<i; j++) {
+		    double tmp = *ajiPtr;
+		    int rowjtop = RowTop[j];
+		    int top = (rowitop > rowjtop) ? rowitop : rowjtop;
+		    double *akjPtr = topRowPtr[j] + (top-rowjtop);
+		    double *akiPtr = topRowPtr[i] + (top-rowitop);
+
+		    for (int k=top; k<j; k++) 
+			tmp -= *akjPtr++ * *akiPtr++ ;
+
+		    *ajiPtr++ = tmp;
+		}
+
+		// now form i'th col of [U] and determine [dii]
+		double aii = theSOE->A[theSOE->iDiagLoc[i] -1]; // FORTRAN ARRAY INDEXING
+		ajiPtr = topRowPtr[i];
+		double *bjPtr  = &X[rowitop];  
+		double tmp = 0;	    
+	    
+		for (int jj=rowitop; jj<i; jj++) {
+		    double aji = *ajiPtr;
+		    double lij = aji * invD[jj];
+		    tmp -= lij * *bjPtr++; 		
+		    *ajiPtr++ = lij;
+		    aii = aii - lij*aji;
+		}
+	    
+		// check that the diag > the tolerance specified
+		if (aii == 0.0) {
+		    opserr << "ProfileSPDLinOutOfCoreSolver::solve() - ";
+		    opserr << " aii < 0 (i, aii): (" << i << ", " << aii << ")\n"; 
+		    return(-2);
+		}
+		if (fabs(aii) <= minDiagTol) {
+		    opserr << "ProfileSPDLinOutOfCoreSolver::solve() - ";
+		    opserr << " aii < minDiagTol (i, aii): (" << i;
+		    opserr << ", " << aii << ")\n"; 
+		    return(-2);
+		}		
+		invD[i] = 1.0/aii; 
+		X[i] += tmp;	    
+	    }
+
+	    // drop the panels no column still to come reads
+	    while (firstKept <= p && residentBytes > budget &&
+		   panelStart[firstKept+1] <= panelNeed[p])
+		this->release(firstKept++);
+	}
+
+	theSOE->isAfactored = true;
+	theSOE->numInt = 0;
+    }
+
+    else {
+
+	// JUST DO SOLVE
+
+	// do forward substitution 
+	for (int p=0; p<numPanels; p++) {
+
+	    this->prefetch(p);
+	    this->prefetch(p+1);
+
+	    int iStart = (panelStart[p] == 0) ? 1 : panelStart[p];
+	    for (int i=iStart; i<panelStart[p+1]; i++) {
+		int rowitop = RowTop[i];	    
+		double *ajiPtr = topRowPtr[i];
+		double *bjPtr  = &X[rowitop];  
+		double tmp = 0;	    
+	    
+		for (int j=rowitop; j<i; j++) 
+		    tmp -= *ajiPtr++ * *bjPtr++; 
+	    
+		X[i] += tmp;
+	    }
+
+	    if (residentBytes > budget)
+		this->release(p);
+	}
+    }
+
+    // divide by diag term 
+    for (int j=0; j<theSize; j++) 
+	X[j] *= invD[j];
+
+    // now do the back substitution storing result in X, sweeping the
+    // panels in reverse
+    for (int p=numPanels-1; p>=0; p--) {
+
+	this->prefetch(p);
+	this->prefetch(p-1);
+
+	int kEnd = (panelStart[p] == 0) ? 1 : panelStart[p];
+	for (int k=panelStart[p+1]-1; k>=kEnd; k--) {
+	    int rowktop = RowTop[k];
+	    double bk = X[k];
+	    double *ajiPtr = topRowPtr[k]; 		
+
+	    for (int j=rowktop; j<k; j++) 
+		X[j] -= *ajiPtr++ * bk;
+	}
+
+	if (residentBytes > budget)
+	    this->release(p);
+    }
+
+    return 0;
+}
+
+
+double
+ProfileSPDLinOutOfCoreSolver::getDeterminant(void) 
+{
+   int theSize = theSOE->size;
+   double determinant = 1.0;
+   for (int i=0; i<theSize; i++)
+     determinant *= invD[i];
+   determinant = 1.0/determinant;
+   return determinant;
+}
+
+
+int
+ProfileSPDLinOutOfCoreSolver::sendSelf(int cTag, Channel &theChannel)
+{
+    return 0;
+}
+
+
+int 
+ProfileSPDLinOutOfCoreSolver::recvSelf(int cTag, Channel &theChannel, 
+				       FEM_ObjectBroker &theBroker)
+{
+    return 0;
+}
@@ -0,0 +1,78 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the class definition for 
+// ProfileSPDLinOutOfCoreSolver. ProfileSPDLinOutOfCoreSolver is a
+// subclass of ProfileSPDLinSolver for systems whose skyline does not
+// fit in memory. The SOE is asked to keep A in a memory-mapped scratch
+// file; the factorization and solves then sweep A in block columns
+// (panels) sized from a memory budget, asking the kernel to read the
+// next panel ahead while the current one is worked on, and writing
+// back and dropping panels no longer needed once the budget is used.
+// The arithmetic is that of ProfileSPDLinDirectSolver.
+//
+#ifndef ProfileSPDLinOutOfCoreSolver_h
+#define ProfileSPDLinOutOfCoreSolver_h
+
+#include "ProfileSPDLinSolver.h"
+
+class ProfileSPDLinSOE;
+
+class ProfileSPDLinOutOfCoreSolver : public ProfileSPDLinSolver
+{
+  public:
+    // memoryBudget in bytes; scratchDir defaults to $TMPDIR or /tmp
+    ProfileSPDLinOutOfCoreSolver(double memoryBudget, 
+				 const char *scratchDir = 0,
+				 double tol = 1.0e-12);
+    virtual ~ProfileSPDLinOutOfCoreSolver();
+
+    virtual int solve(void);        
+    virtual int setSize(void);    
+    virtual int setLinearSOE(ProfileSPDLinSOE &theSOE);
+    double getDeterminant(void);
+
+    int getNumPanels(void) const {return numPanels;}
+    
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+  private:
+    void prefetch(int panel);
+    void release(int panel);
+    void releaseAll(void);
+    size_t panelBytes(int panel);
+
+    double minDiagTol;
+    double budget;
+    char *scratchDir;
+    
+    int size;
+    int *RowTop;
+    double **topRowPtr, *invD;
+
+    int numPanels;
+    int *panelStart;       // first column of each panel, numPanels+1
+    int *panelNeed;        // lowest column read after each panel is factored
+    bool *isResident;
+    double residentBytes;
+};
+
+#endif
@@ -40,6 +40,13 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 
+#include <string.h>
+#include <stdio.h>
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
 #include <iostream>
 using std::nothrow;
 
@@ -48,7 +55,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(ProfileSPDLinSolver &the_Solver)
 :LinearSOE(the_Solver, LinSOE_TAGS_ProfileSPDLinSOE),
  size(0), profileSize(0), A(0), B(0), X(0), vectX(0), vectB(0),
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
- numInt(0) 
+ numInt(0), scratchDir(0), scratchFd(-1) 
 {
     the_Solver.setLinearSOE(*this);
 }
@@ -58,7 +65,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(int classTag)
 :LinearSOE(classTag),
  size(0), profileSize(0), A(0), B(0), X(0), vectX(0), vectB(0),
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
- numInt(0) 
+ numInt(0), scratchDir(0), scratchFd(-1) 
 {
 
 }
@@ -68,7 +75,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(ProfileSPDLinSolver &the_Solver, int classTag
 :LinearSOE(the_Solver, classTag),
  size(0), profileSize(0), A(0), B(0), X(0), vectX(0), vectB(0),
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
- numInt(0) 
+ numInt(0), scratchDir(0), scratchFd(-1) 
 {
     the_Solver.setLinearSOE(*this);
 }
@@ -79,12 +86,12 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(int N, int *iLoc,
 :LinearSOE(the_Solver, LinSOE_TAGS_ProfileSPDLinSOE),
  size(0), profileSize(0), A(0), B(0), X(0), vectX(0), vectB(0),
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
- numInt(0)
+ numInt(0), scratchDir(0), scratchFd(-1)
 {
     size = N;
     profileSize = iLoc[N-1];
     
-    A = new (nothrow) double[iLoc[N-1]];
+    A = this->newA(iLoc[N-1]);
 	
     if (A == 0) {
 	opserr << "FATAL:BandSPDLinSOE::BandSPDLinSOE :";
@@ -133,7 +140,8 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(int N, int *iLoc,
     
 ProfileSPDLinSOE::~ProfileSPDLinSOE()
 {
-    if (A != 0) delete [] A;
+    this->deleteA();
+    if (scratchDir != 0) delete [] scratchDir;
     if (B != 0) delete [] B;
     if (X != 0) delete [] X;
     if (iDiagLoc != 0) delete [] iDiagLoc;
@@ -215,11 +223,10 @@ ProfileSPDLinSOE::setSize(Graph &theGraph)
     if (profileSize > Asize) { 
 
 	// delete old space
-	if (A != 0)
-	    delete [] A;
+	this->deleteA();
 	
 	// get new space
-	A = new (nothrow) double[profileSize];
+	A = this->newA(profileSize);
 	
         if (A == 0) {
             opserr << "ProfileSPDLinSOE::ProfileSPDLinSOE :";
@@ -233,8 +240,11 @@ ProfileSPDLinSOE::setSize(Graph &theGraph)
     }
 
     // zero the matrix
-    for (int k=0; k<profileSize; k++)
-	A[k] = 0;
+    if (scratchFd >= 0)
+	this->clearA();
+    else
+	for (int k=0; k<profileSize; k++)
+	    A[k] = 0;
 
     isAfactored = false;
     isAcondensed = false;    
@@ -486,9 +496,13 @@ ProfileSPDLinSOE::setB(const Vector &v, double fact)
 void 
 ProfileSPDLinSOE::zeroA(void)
 {
-    double *Aptr = A;
-    for (int i=0; i<Asize; i++)
-	*Aptr++ = 0;
+    if (scratchFd >= 0)
+	this->clearA();
+    else {
+	double *Aptr = A;
+	for (int i=0; i<Asize; i++)
+	    *Aptr++ = 0;
+    }
     
     isAfactored = false;
 }
@@ -567,6 +581,104 @@ ProfileSPDLinSOE::setProfileSPDSolver(ProfileSPDLinSolver &newSolver)
 }
 
 
+int
+ProfileSPDLinSOE::setScratchDirectory(const char *dir)
+{
+#ifdef _WIN32
+    if (dir != 0) {
+	opserr << "WARNING ProfileSPDLinSOE::setScratchDirectory() - ";
+	opserr << " memory-mapped storage is not available, A stays on the heap\n";
+	return -1;
+    }
+#endif
+    if (scratchDir != 0)
+	delete [] scratchDir;
+    scratchDir = 0;
+
+    if (dir != 0) {
+	scratchDir = new char[strlen(dir)+1];
+	strcpy(scratchDir, dir);
+    }
+    return 0;
+}
+
+
+double *
+ProfileSPDLinSOE::newA(int n)
+{
+#ifndef _WIN32
+    if (scratchDir != 0) {
+	// the file is unlinked as soon as it is open, so it goes away
+	// with the mapping however the process ends
+	char *fileName = new char[strlen(scratchDir)+32];
+	sprintf(fileName, "%s/ProfileSPDLinSOE.XXXXXX", scratchDir);
+	int fd = mkstemp(fileName);
+	if (fd >= 0)
+	    unlink(fileName);
+	delete [] fileName;
+
+	size_t numBytes = (size_t)n * sizeof(double);
+	if (fd < 0 || ftruncate(fd, numBytes) != 0) {
+	    opserr << "WARNING ProfileSPDLinSOE::newA() - ";
+	    opserr << " could not create a scratch file of " << n;
+	    opserr << " doubles in " << scratchDir << endln;
+	    if (fd >= 0)
+		close(fd);
+	    return 0;
+	}
+
+	void *mem = mmap(0, numBytes, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+	if (mem == MAP_FAILED) {
+	    opserr << "WARNING ProfileSPDLinSOE::newA() - ";
+	    opserr << " could not map the scratch file\n";
+	    close(fd);
+	    return 0;
+	}
+
+	scratchFd = fd;
+	return (double *)mem;
+    }
+#endif
+    return new (nothrow) double[n];
+}
+
+
+void
+ProfileSPDLinSOE::deleteA(void)
+{
+    if (A == 0)
+	return;
+#ifndef _WIN32
+    if (scratchFd >= 0) {
+	munmap((void *)A, (size_t)Asize * sizeof(double));
+	close(scratchFd);
+	scratchFd = -1;
+	A = 0;
+	return;
+    }
+#endif
+    delete [] A;
+    A = 0;
+}
+
+
+void
+ProfileSPDLinSOE::clearA(void)
+{
+#ifndef _WIN32
+    // truncating the file drops its pages, so zeroing a mapped A costs
+    // nothing and does not bring the matrix into memory
+    size_t numBytes = (size_t)Asize * sizeof(double);
+    if (ftruncate(scratchFd, 0) != 0 || ftruncate(scratchFd, numBytes) != 0) {
+	opserr << "WARNING ProfileSPDLinSOE::clearA() - ";
+	opserr << " could not reset the scratch file, zeroing in place\n";
+	for (int i=0; i<Asize; i++)
+	    A[i] = 0;
+    }
+#endif
+}
+
+
 int 
 ProfileSPDLinSOE::sendSelf(int cTag, Channel &theChannel)
 {
@@ -68,11 +68,19 @@ class ProfileSPDLinSOE : public LinearSOE
     virtual double normRHS(void);
 
     virtual int setProfileSPDSolver(ProfileSPDLinSolver &newSolver);    
+
+    // keep A in a memory-mapped scratch file created in the directory
+    // given, rather than on the heap; a null directory reverts to the
+    // heap. Takes effect when A is next allocated.
+    int setScratchDirectory(const char *dir);
+    
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
 
     friend class ProfileSPDLinSolver;    
     friend class ProfileSPDLinDirectSolver;
+    friend class ProfileSPDLinMixedSolver;
+    friend class ProfileSPDLinOutOfCoreSolver;
     friend class ProfileSPDLinDirectBlockSolver;
     friend class ProfileSPDLinDirectThreadSolver;    
     friend class ProfileSPDLinDirectSkypackSolver;    
@@ -88,8 +96,14 @@ class ProfileSPDLinSOE : public LinearSOE
     int Asize, Bsize;
     bool isAfactored, isAcondensed;
     int numInt;
+
+    char *scratchDir;
+    int scratchFd;         // file backing A, -1 if A is on the heap
     
   private:
+    double *newA(int n);
+    void deleteA(void);
+    void clearA(void);
 };
 
 
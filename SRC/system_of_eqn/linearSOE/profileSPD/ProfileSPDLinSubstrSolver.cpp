@@ -61,6 +61,12 @@ ProfileSPDLinSubstrSolver::solve()
     return this->ProfileSPDLinDirectSolver::solve();
 }
 
+int
+ProfileSPDLinSubstrSolver::solveMultiple(LinearSOE &theLinearSOE, const Matrix &B, Matrix &X)
+{
+    return this->ProfileSPDLinDirectSolver::solveMultiple(theLinearSOE, B, X);
+}
+
 int
 ProfileSPDLinSubstrSolver::setSize(void)
 {
@@ -92,7 +92,7 @@ DistributedSparseGenColLinSOE::setSize(Graph &theGraph)
     Channel *theChannel = theChannels[0];
     theGraph.sendSelf(0, *theChannel);
     
-    static ID data(2);
+    static thread_local ID data(2);
     theChannel->recvID(0, 0, data);
     size = data(0);
     nnz = data(1);
@@ -178,7 +178,7 @@ DistributedSparseGenColLinSOE::setSize(Graph &theGraph)
 	nnz += theAdjacency.Size() +1; // the +1 is for the diag entry
     }
 
-    static ID data(2);
+    static thread_local ID data(2);
     data(0) = size;
     data(1) = nnz;
 
@@ -499,7 +499,7 @@ DistributedSparseGenColLinSOE::zeroB(void)
 int 
 DistributedSparseGenColLinSOE::solve(void)
 {
-  static ID result(1);
+  static thread_local ID result(1);
 
   //
   // if subprocess send B and A and receive back result X, B & result
@@ -56,6 +56,7 @@ class DistributedSparseGenColLinSOE : public SparseGenColLinSOE
     const Vector &getB(void);
     void zeroB(void);
     int solve(void);
+    bool usesDefaultSolve(void) {return false;}
 
 
     int sendSelf(int commitTag, Channel &theChannel);
@@ -94,7 +94,7 @@ DistributedSparseGenRowLinSOE::setSize(Graph &theGraph)
     count++;
   }
 
-  static ID otherSize(1);
+  static thread_local ID otherSize(1);
   ID otherDOFS(0, size/10);
 
   if (processID != 0) {
@@ -247,7 +247,7 @@ DistributedSparseGenRowLinSOE::setSize(Graph &theGraph)
   // each process sends local, n is max of them all
   n = myN;
   for (int i=0; i<numP; i++) {
-    static ID rankSendRecv(1);
+    static thread_local ID rankSendRecv(1);
     if (rank == i) {
       rankSendRecv = myN;
       theChannel->sendID(0,0,rankSendRecv);
@@ -127,7 +127,7 @@ DistributedSuperLU::solve(void)
     int nnz = theSOE->nnz;
     int ldb = n;
     int nrhs = 1;
-    static double berr[1];
+    static thread_local double berr[1];
 
     // first copy B into X
     double *Xptr = theSOE->X;
@@ -164,14 +164,14 @@ DistributedSuperLU::solve(void)
   /*
   // synch processes again
   if (processID != 0) {
-    static ID idData(1); 
+    static thread_local ID idData(1); 
     idData(0) = info;
     Channel *theChannel = theChannels[0];
     theChannel->sendID(0, 0, idData);
   } 
   else {
     for (int j=0; j<numChannels; j++) {
-      static ID idData(1);
+      static thread_local ID idData(1);
       Channel *theChannel = theChannels[j];
       theChannel->recvID(0, 0, idData);
     }
@@ -328,7 +328,7 @@ DistributedSuperLU::sendSelf(int cTag, Channel &theChannel)
   } else 
     sendID = processID;
     opserr << "DistributedSuperLU::sendSelf(int cTag, Channel &theChannel) - 5\n";
-  static ID idData(3);
+  static thread_local ID idData(3);
   idData(0) = sendID;
   idData(1) = npRow;
   idData(2) = npCol;
@@ -347,7 +347,7 @@ DistributedSuperLU::recvSelf(int cTag,
 			     FEM_ObjectBroker &theBroker)
 {
   opserr << "DistributedSuperLU::recvSelf(int cTag, Channel &theChannel) - START\n";
-  static ID idData(3);
+  static thread_local ID idData(3);
 
   int res = theChannel.recvID(0, cTag, idData);
   if (res < 0) {
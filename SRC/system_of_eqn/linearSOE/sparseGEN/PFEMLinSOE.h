@@ -56,6 +56,7 @@ class PFEMLinSOE : public LinearSOE
     virtual ~PFEMLinSOE();
 
     virtual int solve(void);
+    virtual bool usesDefaultSolve(void) {return false;}
 
     virtual int getNumEqn(void) const;
     virtual int setSize(Graph& theGraph);
@@ -21,6 +21,7 @@ struct offdblk
 	struct offdblk  *bnext ;
 	struct offdblk  *next  ;
 	double          *nz    ;
+	float           *fnz   ;
 };
 
 typedef  struct offdblk  OFFDBLK;
@@ -37,6 +38,8 @@ typedef  struct offdblk  OFFDBLK;
  *  struct .beg - beginning column of i th row segment
  *  struct .bnext - pointer to next row segment in this column block
  *  struct .nz   - pointer to coefficients of L in rowsegment i
+ *  struct .fnz  - the same in single precision, used instead of nz
+ *		   when the factor is stored in single precision
  *  struct .next - pointer to next row segment with the same row number 
  *		   this row segment if it exists, other wise the row segment
  *		   with the next highest row number
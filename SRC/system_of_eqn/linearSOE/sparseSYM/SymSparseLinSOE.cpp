@@ -31,6 +31,7 @@ extern "C" {
 }
 
 #include <iostream>
+#include <algorithm>
 using std::nothrow;
 
 SymSparseLinSOE::SymSparseLinSOE(SymSparseLinSolver &the_Solver, int lSparse)
@@ -39,7 +40,8 @@ SymSparseLinSOE::SymSparseLinSOE(SymSparseLinSolver &the_Solver, int lSparse)
  vectX(0), vectB(0), 
  Bsize(0), factored(false),
  nblks(0), xblk(0), invp(0), diag(0), penv(0), rowblks(0),
- begblk(0), first(0) 
+ begblk(0), first(0),
+ mixed(false), fdiag(0), fenv(0), aDiag(0), aVal(0), aLower(0)
 {
     the_Solver.setLinearSOE(*this);
     this->LSPARSE = lSparse;
@@ -64,6 +66,15 @@ SymSparseLinSOE::~SymSparseLinSOE()
         free(penv);
     } 
 
+    // or their single precision counterparts
+    if (fdiag != NULL) free(fdiag);
+    if (fenv != NULL) {
+	if (fenv[0] != NULL) {
+	    free(fenv[0]);
+	}
+        free(fenv);
+    } 
+
     // free the row segments.
     OFFDBLK *blkPtr = first;
     OFFDBLK *tempBlk;
@@ -79,7 +90,11 @@ SymSparseLinSOE::~SymSparseLinSOE()
 
       tempBlk = blkPtr->next;
       if (blkPtr->row != curRow) {
-	if (blkPtr->nz != NULL) {
+	// with single precision factors nz is left to the solver
+	if (mixed) {
+	  if (blkPtr->fnz != NULL)
+	    free(blkPtr->fnz);
+	} else if (blkPtr->nz != NULL) {
 	  free(blkPtr->nz);
 	}
 	curRow = blkPtr->row;
@@ -102,6 +117,9 @@ SymSparseLinSOE::~SymSparseLinSOE()
     if (vectB != 0) delete vectB;
     if (rowStartA != 0) delete [] rowStartA;
     if (colA != 0) delete [] colA;
+    if (aDiag != 0) delete [] aDiag;
+    if (aVal != 0) delete [] aVal;
+    if (aLower != 0) delete [] aLower;
 }
 
 
@@ -228,9 +246,53 @@ int SymSparseLinSOE::setSize(Graph &theGraph)
 	}
     }
     
+    if (mixed) {
+        // A is held on the adjacency, the factor in single precision
+        if (aDiag != 0) delete [] aDiag;
+        if (aVal != 0) delete [] aVal;
+        if (aLower != 0) delete [] aLower;
+
+        aLower = new (nothrow) int[size+1];
+        aDiag = new (nothrow) double[size];
+        if (aLower == 0 || aDiag == 0) {
+            opserr << "WARNING SymSparseLinSOE::setSize :";
+            opserr << " ran out of memory for A (size) (" << size << ") \n";
+            size = 0;
+            return -1;
+        }
+
+        aLower[0] = 0;
+        for (int a=0; a<size; a++) {
+            int k = rowStartA[a];
+            while (k < rowStartA[a+1] && colA[k] < a)
+                k++;
+            aLower[a+1] = aLower[a] + k - rowStartA[a];
+            aDiag[a] = 0.0;
+        }
+
+        aVal = new (nothrow) double[aLower[size]+1];
+        if (aVal == 0) {
+            opserr << "WARNING SymSparseLinSOE::setSize :";
+            opserr << " ran out of memory for A (nnz) (" << aLower[size] << ") \n";
+            size = 0;
+            return -1;
+        }
+        for (int k=0; k<aLower[size]; k++)
+            aVal[k] = 0.0;
+    }
+
     // call "C" function to form elimination tree and to do the symbolic factorization.
-    nblks = symFactorization(rowStartA, colA, size, this->LSPARSE,
-			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag);
+    if (mixed)
+        nblks = symFactorization_f(rowStartA, colA, size, this->LSPARSE,
+                                   &xblk, &invp, &rowblks, &begblk, &first, &fenv, &fdiag);
+    else
+        nblks = symFactorization(rowStartA, colA, size, this->LSPARSE,
+                                 &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag);
+
+    // let the solver update any data it keeps on the block structure
+    LinearSOESolver *theSolver = this->getSolver();
+    if (theSolver != 0)
+        theSolver->setSize();
 
     return result;
 }
@@ -284,6 +346,35 @@ int SymSparseLinSOE::addA(const Matrix &in_m, const ID &in_id, double fact)
        }
    }
 
+   // with single precision factors, assemble A on the adjacency
+   if (mixed) {
+       for (int ii = 0; ii < idSize; ii++) {
+	   int row = id[ii];
+	   aDiag[row] += m[ii*idSize + ii] * fact;
+
+	   int *colBeg = &colA[rowStartA[row]];
+	   int *colEnd = colBeg + (aLower[row+1] - aLower[row]);
+	   for (int jj = 0; jj < idSize; jj++) {
+	       int col = id[jj];
+	       if (col >= row)
+		   continue;
+	       int *loc = std::lower_bound(colBeg, colEnd, col);
+	       if (loc == colEnd || *loc != col) {
+		   opserr << "SymSparseLinSOE::addA() ";
+		   opserr << " - entry (" << row << ", " << col << ") not in the graph\n";
+		   delete [] m;
+		   delete [] id;
+		   return -1;
+	       }
+	       aVal[aLower[row] + (loc - colBeg)] += m[ii*idSize + jj] * fact;
+	   }
+       }
+
+       delete [] m;
+       delete [] id;
+       return 0;
+   }
+
    // forming the new id based on invp.
 
    int *newID = new (nothrow) int[idSize];
@@ -505,6 +596,13 @@ SymSparseLinSOE::setB(const Vector &v, double fact)
  */
 void SymSparseLinSOE::zeroA(void)
 {
+    if (mixed) {
+	memset(aDiag, 0, size*sizeof(double));
+	memset(aVal, 0, aLower[size]*sizeof(double));
+	factored = false;
+	return;
+    }
+
     memset(diag, 0, size*sizeof(double));
 
     int profileSize = penv[size] - penv[0];
@@ -582,7 +680,8 @@ SymSparseLinSOE::normRHS(void)
  */
 int SymSparseLinSOE::setSymSparseLinSolver(SymSparseLinSolver &newSolver)
 {
-    newSolver.setLinearSOE(*this);
+    if (newSolver.setLinearSOE(*this) < 0)
+	return -1;
     
     if (size != 0) {
         int solverOK = newSolver.setSize();
@@ -14,6 +14,13 @@
 //
 // Almost all the information (Matrix A and Vector B) is stored as 
 // global variables in the file "symbolic.h".
+//
+// When the solver factors in single precision (SparseSPD -mixed), A is
+// not assembled into the structure of the factor. It is kept in double
+// precision on the adjacency (rowStartA, colA): the diagonal in aDiag
+// and, for each row i, the entries of the row left of the diagonal in
+// aVal[aLower[i]], ... The structure of the factor (fdiag, fenv and the
+// fnz of the row segments) is then single precision.
 
 
 #ifndef SymSparseLinSOE_h
@@ -81,6 +88,11 @@ class SymSparseLinSOE : public LinearSOE
     OFFDBLK  **begblk;
     OFFDBLK  *first;
 
+    // single precision factor and the double precision A it refines against
+    bool     mixed;
+    float    *fdiag, **fenv;
+    double   *aDiag, *aVal;
+    int      *aLower;
 };
 
 #endif
@@ -14,9 +14,15 @@
 #include "SymSparseLinSOE.h"
 #include "SymSparseLinSolver.h"
 #include <math.h>
+#include <string.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
 
 extern "C" {
 #include "nmat.h"
@@ -30,21 +36,57 @@ void* OPS_SymSparseLinSolver()
     //   2 -- ND
     //   3 -- RCM
     int lSparse = 1;
+    int numThreads = 1;
+    bool mixed = false;
+    double tol = 1.0e-12;
+    int maxIter = 10;
+    int printFlag = 0;
     int numdata = 1;
-    if (OPS_GetNumRemainingInputArgs() > 0) {
-	if (OPS_GetIntInput(&numdata, &lSparse) < 0) {
-	    opserr << "WARNING SparseSPD failed to read lSparse\n";
-	    return 0;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *opt = OPS_GetString();
+	if (strcmp(opt, "-threads") == 0) {
+	    if (OPS_GetNumRemainingInputArgs() < 1 ||
+		OPS_GetIntInput(&numdata, &numThreads) < 0) {
+		opserr << "WARNING SparseSPD failed to read numThreads\n";
+		return 0;
+	    }
+	} else if (strcmp(opt, "-mixed") == 0) {
+	    mixed = true;
+	} else if (strcmp(opt, "-tol") == 0) {
+	    if (OPS_GetNumRemainingInputArgs() < 1 ||
+		OPS_GetDoubleInput(&numdata, &tol) < 0) {
+		opserr << "WARNING SparseSPD failed to read tol\n";
+		return 0;
+	    }
+	} else if (strcmp(opt, "-maxIter") == 0) {
+	    if (OPS_GetNumRemainingInputArgs() < 1 ||
+		OPS_GetIntInput(&numdata, &maxIter) < 0) {
+		opserr << "WARNING SparseSPD failed to read maxIter\n";
+		return 0;
+	    }
+	} else if (strcmp(opt, "-print") == 0) {
+	    printFlag = 1;
+	} else {
+	    OPS_ResetCurrentInputArg(-1);
+	    if (OPS_GetIntInput(&numdata, &lSparse) < 0) {
+		opserr << "WARNING SparseSPD unknown option " << opt << "\n";
+		return 0;
+	    }
 	}
     }
 
-    SymSparseLinSolver *theSolver = new SymSparseLinSolver();
+    SymSparseLinSolver *theSolver = 
+	new SymSparseLinSolver(numThreads, mixed, tol, maxIter, printFlag);
     return new SymSparseLinSOE(*theSolver, lSparse);  
 }
 
-SymSparseLinSolver::SymSparseLinSolver()
+SymSparseLinSolver::SymSparseLinSolver(int nThreads, bool mix,
+				       double t, int max, int flag)
 :LinearSOESolver(SOLVER_TAGS_SymSparseLinSolver),
- theSOE(0)
+ theSOE(0), numThreads(nThreads), 
+ mixed(mix), tol(t), maxIter(max), printFlag(flag),
+ useDouble(false), numIter(0), numFallback(0), work(0),
+ dblDiag(0), dblEnv(0), dblNZ(0), graphFormed(false)
 {
     // nothing to do.
 }
@@ -52,7 +94,121 @@ SymSparseLinSolver::SymSparseLinSolver()
 
 SymSparseLinSolver::~SymSparseLinSolver()
 { 
-    // nothing to do.
+    this->freeDouble();
+    if (work != 0) delete [] work;
+}
+
+//
+// Set A, held by the SOE on the adjacency, into the structure of the
+// factor (diag, penv and the row segments' storage seg), permuting it
+// on the way.
+//
+template <typename T>
+static void
+scatterA(int n, const int *invp, const int *xblk, const int *rowblks,
+         OFFDBLK *first, const int *rowStartA, const int *colA,
+         const double *aDiag, const double *aVal, const int *aLower,
+         T *diag, T **penv, T *OFFDBLK::*seg)
+{
+    for (int i=0; i<n; i++)
+        diag[i] = 0;
+    for (T *loc = penv[0]; loc < penv[n]; loc++)
+        *loc = 0;
+
+    // the row segments of a row follow one another in the "next" list
+    std::vector<OFFDBLK *> rowFirst(n, (OFFDBLK *)0);
+    for (OFFDBLK *js = first; js->beg < n; js = js->next) {
+        T *nz = js->*seg;
+        int len = xblk[rowblks[js->beg]+1] - js->beg;
+        for (int k=0; k<len; k++)
+            nz[k] = 0;
+        if (rowFirst[js->row] == 0)
+            rowFirst[js->row] = js;
+    }
+
+    for (int i=0; i<n; i++) {
+        int p = invp[i];
+        diag[p] += (T)aDiag[i];
+
+        const int *col = &colA[rowStartA[i]];
+        for (int k=aLower[i]; k<aLower[i+1]; k++, col++) {
+            int q = invp[*col];
+            int row = (p > q) ? p : q;
+            int column = (p > q) ? q : p;
+
+            if (column >= xblk[rowblks[row]])  // diagonal block (profile)
+                *(penv[row+1] - row + column) += (T)aVal[k];
+            else {                               // row segment
+                OFFDBLK *js = rowFirst[row];
+                while (column >= (js->next)->beg && (js->next)->row == row)
+                    js = js->next;
+                (js->*seg)[column - js->beg] += (T)aVal[k];
+            }
+        }
+    }
+}
+
+//
+// Run task(i) for i = 0..numTasks-1 on numThreads threads, where task i
+// may start once the tasks it depends on are done; numDeps[i] is the
+// number of those and next[i] the tasks that depend on i. Stops at the
+// first task returning non-zero and returns that value.
+//
+template <typename Task>
+static int
+runBlockTasks(int numTasks, const std::vector<int> &numDeps,
+              const std::vector<std::vector<int> > &next,
+              int numThreads, Task task)
+{
+    std::vector<int> count(numDeps);
+    std::deque<int> ready;
+    for (int i=0; i<numTasks; i++)
+        if (count[i] == 0)
+            ready.push_back(i);
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    int numDone = 0;
+    int error = 0;
+
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mtx);
+        while (true) {
+            cv.wait(lock, [&]() {
+                return !ready.empty() || numDone == numTasks || error != 0;
+            });
+            if (error != 0 || numDone == numTasks)
+                return;
+
+            int i = ready.front();
+            ready.pop_front();
+
+            lock.unlock();
+            int result = task(i);
+            lock.lock();
+
+            if (result != 0) {
+                error = result;
+                cv.notify_all();
+                return;
+            }
+
+            numDone++;
+            for (int j : next[i])
+                if (--count[j] == 0)
+                    ready.push_back(j);
+            cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t=1; t<numThreads; t++)
+        threads.emplace_back(worker);
+    worker();
+    for (std::thread &thread : threads)
+        thread.join();
+
+    return error;
 }
 
 /*
@@ -65,21 +221,14 @@ extern "C" void pfsslv(int neqns, double *diag, double **penv, int nblks,
 
 int
 SymSparseLinSolver::solve(void)
-{ 
+{
     if (theSOE == 0) {
 	opserr << "WARNING SymSparseLinSolver::solve(void)- ";
 	opserr << " No LinearSOE object has been set\n";
 	return -1;
     }
 
-    int      nblks = theSOE->nblks;
-    int      *xblk = theSOE->xblk;
     int      *invp = theSOE->invp;
-    double   *diag = theSOE->diag;
-    double   **penv = theSOE->penv;
-    int      *rowblks = theSOE->rowblks;
-    OFFDBLK  **begblk = theSOE->begblk;
-    OFFDBLK  *first = theSOE->first;
 
     int neq = theSOE->size;
 
@@ -87,30 +236,36 @@ SymSparseLinSolver::solve(void)
     if (neq == 0)
 	return 0;
 
-    // first copy B into X
+    if (numThreads > 1 && graphFormed == false)
+        this->formBlockGraph();
 
-    for (int i=0; i<neq; i++) {
-        theSOE->X[i] = theSOE->B[i];
-    }
     double *Xptr = theSOE->X;
 
-    if (theSOE->factored == false) {
+    if (mixed) {
+        if (this->solveMixed() < 0)
+            return -1;
 
-        //factor the matrix
-        //call the "C" function to do the numerical factorization.
-        int factor;
-	factor = pfsfct(neq, diag, penv, nblks, xblk, begblk, first, rowblks);
-	if (factor > 0) {
-	    opserr << "In SymSparseLinSolver: error in factorization.\n";
-	    return -1;
-	}
-	theSOE->factored = true;
-    }
+    } else {
+
+        // first copy B into X
+
+        for (int i=0; i<neq; i++) {
+            theSOE->X[i] = theSOE->B[i];
+        }
 
-    // do forward and backward substitution.
-    // call the "C" function.
+        if (theSOE->factored == false) {
 
-    pfsslv(neq, diag, penv, nblks, xblk, Xptr, begblk);
+            //factor the matrix
+            //call the "C" function to do the numerical factorization.
+            if (this->factor(theSOE->diag, theSOE->penv) != 0)
+                return -1;
+            theSOE->factored = true;
+        }
+
+        // do forward and backward substitution.
+        // call the "C" function.
+        this->backSolve(theSOE->diag, theSOE->penv, Xptr);
+    }
 
     // Since the X we get by solving AX=B is P*X, we need to reordering
     // the Xptr to ge the wanted X.
@@ -120,25 +275,382 @@ SymSparseLinSolver::solve(void)
         opserr << "WARNING SymSparseLinSover::SymSparseLinSolver :";
 	opserr << " ran out of memory for vectors (tempX) ";
 	return -1;
-    } 
+    }
 
     for (int m=0; m<neq; m++) {
         tempX[m] = Xptr[invp[m]];
     }
-	
+
     for (int k=0; k<neq; k++) {
         Xptr[k] = tempX[k];
     }
-	
+
     delete [] tempX;
     return 0;
 }
 
 
+int
+SymSparseLinSolver::factor(double *diag, double **penv)
+{
+    int      nblks = theSOE->nblks;
+    int      *xblk = theSOE->xblk;
+    int      *rowblks = theSOE->rowblks;
+    OFFDBLK  **begblk = theSOE->begblk;
+
+    int factor;
+    if (numThreads > 1) {
+        std::vector<int> numDeps(nblks);
+        for (int i=0; i<nblks; i++)
+            numDeps[i] = blockPred[i].size();
+
+        factor = runBlockTasks(nblks, numDeps, blockSucc, numThreads,
+            [&](int blk) {
+                OFFDBLK *js = rowStart[blk];
+                return pfsfct_block(blk, diag, penv, xblk, begblk, &js, rowblks);
+            });
+    } else
+        factor = pfsfct(theSOE->size, diag, penv, nblks, xblk, begblk,
+                        theSOE->first, rowblks);
+
+    if (factor > 0) {
+        opserr << "In SymSparseLinSolver: error in factorization.\n";
+        return -1;
+    }
+    return 0;
+}
+
+
+void
+SymSparseLinSolver::backSolve(double *diag, double **penv, double *x)
+{
+    int      nblks = theSOE->nblks;
+    int      *xblk = theSOE->xblk;
+    int      *rowblks = theSOE->rowblks;
+    OFFDBLK  **begblk = theSOE->begblk;
+
+    if (numThreads > 1) {
+        std::vector<int> numDeps(nblks);
+        for (int i=0; i<nblks; i++)
+            numDeps[i] = blockPred[i].size();
+
+        runBlockTasks(nblks, numDeps, blockSucc, numThreads,
+            [&](int blk) {
+                pfsslv_fwd_block(blk, diag, penv, xblk, x, rowStart[blk], rowblks);
+                return 0;
+            });
+
+        // the backward solve runs over the reversed graph
+        for (int i=0; i<nblks; i++)
+            numDeps[i] = blockSucc[i].size();
+
+        runBlockTasks(nblks, numDeps, blockPred, numThreads,
+            [&](int blk) {
+                pfsslv_bwd_block(blk, diag, penv, xblk, x, begblk);
+                return 0;
+            });
+    } else
+        pfsslv(theSOE->size, diag, penv, nblks, xblk, x, begblk);
+}
+
+
+int
+SymSparseLinSolver::factorSingle(void)
+{
+    int      nblks = theSOE->nblks;
+    int      *xblk = theSOE->xblk;
+    int      *rowblks = theSOE->rowblks;
+    OFFDBLK  **begblk = theSOE->begblk;
+    float    *diag = theSOE->fdiag;
+    float    **penv = theSOE->fenv;
+
+    scatterA(theSOE->size, theSOE->invp, xblk, rowblks, theSOE->first,
+             theSOE->rowStartA, theSOE->colA,
+             theSOE->aDiag, theSOE->aVal, theSOE->aLower,
+             diag, penv, &OFFDBLK::fnz);
+
+    if (numThreads > 1) {
+        std::vector<int> numDeps(nblks);
+        for (int i=0; i<nblks; i++)
+            numDeps[i] = blockPred[i].size();
+
+        return runBlockTasks(nblks, numDeps, blockSucc, numThreads,
+            [&](int blk) {
+                OFFDBLK *js = rowStart[blk];
+                return pfsfct_block_f(blk, diag, penv, xblk, begblk, &js, rowblks);
+            });
+    }
+
+    return pfsfct_f(theSOE->size, diag, penv, nblks, xblk, begblk,
+                    theSOE->first, rowblks);
+}
+
+
+void
+SymSparseLinSolver::backSolveSingle(double *x)
+{
+    int      nblks = theSOE->nblks;
+    int      *xblk = theSOE->xblk;
+    int      *rowblks = theSOE->rowblks;
+    OFFDBLK  **begblk = theSOE->begblk;
+    float    *diag = theSOE->fdiag;
+    float    **penv = theSOE->fenv;
+
+    if (numThreads > 1) {
+        std::vector<int> numDeps(nblks);
+        for (int i=0; i<nblks; i++)
+            numDeps[i] = blockPred[i].size();
+
+        runBlockTasks(nblks, numDeps, blockSucc, numThreads,
+            [&](int blk) {
+                pfsslv_fwd_block_f(blk, diag, penv, xblk, x, rowStart[blk], rowblks);
+                return 0;
+            });
+
+        for (int i=0; i<nblks; i++)
+            numDeps[i] = blockSucc[i].size();
+
+        runBlockTasks(nblks, numDeps, blockPred, numThreads,
+            [&](int blk) {
+                pfsslv_bwd_block_f(blk, diag, penv, xblk, x, begblk);
+                return 0;
+            });
+    } else
+        pfsslv_f(theSOE->size, diag, penv, nblks, xblk, x, begblk);
+}
+
+
+void
+SymSparseLinSolver::formResidual(const double *x, double *r)
+{
+    // r = B - A x, in the permuted numbering of B and x; A is held
+    // left of the diagonal on the adjacency, in the original numbering
+    int n = theSOE->size;
+    int *invp = theSOE->invp;
+    int *rowStartA = theSOE->rowStartA;
+    int *colA = theSOE->colA;
+    double *aDiag = theSOE->aDiag;
+    double *aVal = theSOE->aVal;
+    int *aLower = theSOE->aLower;
+    double *B = theSOE->B;
+
+    for (int i=0; i<n; i++)
+	r[i] = B[i];
+
+    for (int i=0; i<n; i++) {
+	int p = invp[i];
+	double xp = x[p];
+	double tmp = aDiag[i]*xp;
+	const int *col = &colA[rowStartA[i]];
+	for (int k=aLower[i]; k<aLower[i+1]; k++, col++) {
+	    int q = invp[*col];
+	    tmp += aVal[k]*x[q];
+	    r[q] -= aVal[k]*xp;
+	}
+	r[p] -= tmp;
+    }
+}
+
+
+int
+SymSparseLinSolver::solveMixed(void)
+{
+    int n = theSOE->size;
+    double *X = theSOE->X;
+    double *B = theSOE->B;
+
+    if (theSOE->factored == false) {
+	useDouble = false;
+	if (this->factorSingle() != 0) {
+	    if (printFlag != 0)
+		opserr << "SymSparseLinSolver::solve() - single precision factorization failed, using double precision\n";
+	    return this->solveDouble();
+	}
+	theSOE->factored = true;
+    }
+
+    if (useDouble == true) {
+	for (int i=0; i<n; i++)
+	    X[i] = B[i];
+	this->backSolve(dblDiag, dblEnv, X);
+	return 0;
+    }
+
+    double *r = work;
+
+    for (int i=0; i<n; i++)
+	X[i] = B[i];
+    this->backSolveSingle(X);
+
+    double lastNorm = 0.0;
+    for (numIter=1; numIter<=maxIter; numIter++) {
+	this->formResidual(X, r);
+	this->backSolveSingle(r);
+
+	double dxNorm = 0.0;
+	double xNorm = 0.0;
+	for (int i=0; i<n; i++) {
+	    X[i] += r[i];
+	    if (fabs(r[i]) > dxNorm) dxNorm = fabs(r[i]);
+	    if (fabs(X[i]) > xNorm) xNorm = fabs(X[i]);
+	}
+
+	if (dxNorm <= tol*xNorm) {
+	    if (printFlag != 0)
+		opserr << "SymSparseLinSolver::solve() - " << numIter << " refinement steps\n";
+	    return 0;
+	}
+
+	if (numIter > 1 && dxNorm > 0.5*lastNorm)
+	    break;
+	lastNorm = dxNorm;
+    }
+
+    // refinement stalled; factor the double precision matrix instead
+    if (numIter > maxIter)
+	numIter = maxIter;
+    if (printFlag != 0)
+	opserr << "SymSparseLinSolver::solve() - refinement stalled after " << numIter << " steps, using double precision\n";
+
+    return this->solveDouble();
+}
+
+
+int
+SymSparseLinSolver::solveDouble(void)
+{
+    int n = theSOE->size;
+    float **fenv = theSOE->fenv;
+    int *xblk = theSOE->xblk;
+    int *rowblks = theSOE->rowblks;
+
+    useDouble = true;
+    numIter = -1;
+    numFallback++;
+
+    // give the structure of the factor double precision storage
+    if (dblDiag == 0) {
+	int numNZ = 0;
+	for (OFFDBLK *js = theSOE->first; js->beg < n; js = js->next)
+	    numNZ += xblk[rowblks[js->beg]+1] - js->beg;
+
+	dblDiag = new (std::nothrow) double[n];
+	dblEnv = new (std::nothrow) double *[n+1];
+	dblNZ = new (std::nothrow) double[numNZ+1];
+	if (dblEnv != 0)
+	    dblEnv[0] = new (std::nothrow) double[fenv[n]-fenv[0]+1];
+	if (dblDiag == 0 || dblEnv == 0 || dblNZ == 0 || dblEnv[0] == 0) {
+	    opserr << "WARNING SymSparseLinSolver::solve() - ";
+	    opserr << " ran out of memory for the double precision factor\n";
+	    this->freeDouble();
+	    return -1;
+	}
+
+	for (int i=0; i<n; i++)
+	    dblEnv[i+1] = dblEnv[i] + (fenv[i+1] - fenv[i]);
+
+	double *nz = dblNZ;
+	for (OFFDBLK *js = theSOE->first; js->beg < n; js = js->next) {
+	    js->nz = nz;
+	    nz += xblk[rowblks[js->beg]+1] - js->beg;
+	}
+    }
+
+    scatterA(n, theSOE->invp, xblk, rowblks, theSOE->first,
+             theSOE->rowStartA, theSOE->colA,
+             theSOE->aDiag, theSOE->aVal, theSOE->aLower,
+             dblDiag, dblEnv, &OFFDBLK::nz);
+
+    if (this->factor(dblDiag, dblEnv) != 0)
+	return -1;
+    theSOE->factored = true;
+
+    double *X = theSOE->X;
+    double *B = theSOE->B;
+    for (int i=0; i<n; i++)
+	X[i] = B[i];
+    this->backSolve(dblDiag, dblEnv, X);
+
+    return 0;
+}
+
+
+void
+SymSparseLinSolver::freeDouble(void)
+{
+    if (dblDiag != 0) delete [] dblDiag;
+    if (dblEnv != 0) {
+	if (dblEnv[0] != 0) delete [] dblEnv[0];
+	delete [] dblEnv;
+    }
+    if (dblNZ != 0) delete [] dblNZ;
+    dblDiag = 0;
+    dblEnv = 0;
+    dblNZ = 0;
+}
+
+
 int
 SymSparseLinSolver::setSize()
 {
-    // nothing to do
+    // the symbolic factorization has changed
+    graphFormed = false;
+
+    if (mixed) {
+	useDouble = false;
+	this->freeDouble();
+	if (work != 0) delete [] work;
+	work = 0;
+	if (theSOE != 0 && theSOE->size > 0) {
+	    work = new (std::nothrow) double[theSOE->size];
+	    if (work == 0) {
+		opserr << "WARNING SymSparseLinSolver::setSize() - ";
+		opserr << " ran out of memory for work areas\n";
+		return -1;
+	    }
+	}
+    }
+    return 0;
+}
+
+
+int
+SymSparseLinSolver::setNumThreads(int n)
+{
+    numThreads = (n > 0) ? n : 1;
+    return 0;
+}
+
+
+int
+SymSparseLinSolver::formBlockGraph(void)
+{
+    int      nblks = theSOE->nblks;
+    int      *xblk = theSOE->xblk;
+    int      *rowblks = theSOE->rowblks;
+    OFFDBLK  *js = theSOE->first;
+
+    rowStart.assign(nblks, 0);
+    blockPred.assign(nblks, std::vector<int>());
+    blockSucc.assign(nblks, std::vector<int>());
+
+    // the row segments are linked by increasing row, so those of each
+    // block follow one another
+    std::vector<int> marker(nblks, -1);
+    for (int blk=0; blk<nblks; blk++) {
+        rowStart[blk] = js;
+        int blkend = xblk[blk+1];
+        for ( ; js->row < blkend; js = js->next) {
+            int jblk = rowblks[js->beg];
+            if (marker[jblk] != blk) {
+                marker[jblk] = blk;
+                blockPred[blk].push_back(jblk);
+                blockSucc[jblk].push_back(blk);
+            }
+        }
+    }
+
+    graphFormed = true;
     return 0;
 }
 
@@ -146,6 +658,15 @@ SymSparseLinSolver::setSize()
 int
 SymSparseLinSolver::setLinearSOE(SymSparseLinSOE &theLinearSOE)
 {
+    // the SOE gives the factor single precision storage for a mixed
+    // solver, which can only be chosen before its structure is set up
+    if (theLinearSOE.size != 0 && theLinearSOE.mixed != mixed) {
+	opserr << "WARNING SymSparseLinSolver::setLinearSOE() - ";
+	opserr << " the system was set up for a solver with different precision\n";
+	return -1;
+    }
+    theLinearSOE.mixed = mixed;
+
     theSOE = &theLinearSOE;
     return 0;
 }
@@ -11,6 +11,21 @@
 // some "C" functions. The solver used here is generalized sparse
 // solver. The user can choose three different ordering schema.
 //
+// With more than one thread the numerical factorization and the
+// triangular solves are scheduled block by block over the dependency
+// graph of the partitioning blocks (xblk): a block can be processed
+// once the blocks holding the columns of its row segments are done.
+// Each block performs the same operations as in the serial code, so
+// the factors do not depend on the number of threads.
+//
+// With mixed set the factor is held in single precision, with the
+// inner products accumulated in double precision, and each solution
+// is refined against the double precision A the SOE keeps on the
+// adjacency, until the correction is below tol relative to x. If the
+// single precision factorization fails, or the refinement stalls, A
+// is factored in double precision instead; the storage for that is
+// only allocated on the first fallback.
+//
 // What: "@(#) SymSparseLinSolver.h, revA"
 
 
@@ -18,6 +33,11 @@
 #define SymSparseLinSolver_h
 
 #include <LinearSOESolver.h>
+#include <vector>
+
+extern "C" {
+#include "FeStructs.h"
+}
 
 
 class SymSparseLinSOE;
@@ -25,13 +45,20 @@ class SymSparseLinSOE;
 class SymSparseLinSolver : public LinearSOESolver
 {
   public:
-    SymSparseLinSolver();     
+    SymSparseLinSolver(int numThreads = 1, bool mixed = false,
+		       double tol = 1.0e-12, int maxIter = 10, int printFlag = 0);
     ~SymSparseLinSolver();
 
     int solve(void);
     int setSize(void);
 
     int setLinearSOE(SymSparseLinSOE &theSOE); 
+    int setNumThreads(int numThreads);
+
+    // refinement steps taken by the last solve, -1 if it fell back
+    // to the double precision factorization
+    int getNumIterations(void) const {return numIter;}
+    int getNumFallbacks(void) const {return numFallback;}
 	
     int sendSelf(int cTag, Channel &theChannel);
     int recvSelf(int cTag, 
@@ -40,8 +67,37 @@ class SymSparseLinSolver : public LinearSOESolver
   protected:
 
   private:
+    int formBlockGraph(void);
+    int factor(double *diag, double **penv);
+    void backSolve(double *diag, double **penv, double *x);
+
+    int solveMixed(void);
+    int solveDouble(void);
+    int factorSingle(void);
+    void backSolveSingle(double *x);
+    void formResidual(const double *x, double *r);
+    void freeDouble(void);
 
     SymSparseLinSOE *theSOE;
+
+    int numThreads;
+
+    bool mixed;
+    double tol;
+    int maxIter;
+    int printFlag;
+
+    bool useDouble;        // current A was factored in double precision
+    int numIter;
+    int numFallback;
+    double *work;          // residual and correction
+    double *dblDiag, **dblEnv, *dblNZ;   // double precision factor, fallback
+
+    // block dependency graph, formed after each symbolic factorization
+    bool graphFormed;
+    std::vector<OFFDBLK *> rowStart;         // first row segment of each block
+    std::vector<std::vector<int> > blockPred; // column blocks of its row segments
+    std::vector<std::vector<int> > blockSucc; // blocks with row segments under it
     
 };
 
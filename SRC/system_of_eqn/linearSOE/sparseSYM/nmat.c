@@ -17,6 +17,7 @@
 
 #include <stdio.h>
 #include <math.h>
+#include <float.h>
 #include <assert.h>
 #include <stdlib.h>
 #include "FeStructs.h"
@@ -27,6 +28,14 @@ static int  pfefct(int neqns, double **penv, double *diag);
 static void pflslv(int neqns, double **penv, double *diag, double *rhs);
 static void pfuslv(int neqns, double **penv, double *diag, double *rhs);
 
+static int  pfefct_f(int neqns, float **penv, float *diag);
+static void pflslv_f(int neqns, float **penv, float *diag, float *rhs);
+static void pflslv_m(int neqns, float **penv, float *diag, double *rhs);
+static void pfuslv_m(int neqns, float **penv, float *diag, double *rhs);
+
+/* a pivot lost to single precision round off */
+#define LOST_PIVOT(x)   (!(fabs(x) >= FLT_MIN) || fabs(x) > FLT_MAX)
+
 #define MAX(x,y)   (((x) < (y)) ? (y) : (x))
 
 /***************************************************************
@@ -66,102 +75,134 @@ int pfsfct(int neqns, double *diag, double **penv, int nblks,
 /*************************************************************** 
  ***************************************************************/
 {  
-   int blk, nextblk, jbeg, iflag ;
-   int iband, blkbeg, blkend, blksze ;
-   int jrow, krow ;
-   int jblk, jb, kb, pos ;
-   OFFDBLK *marker, *ks, *js, *ls ;
-   double *work;
-   int ii;
+   int blk, iflag ;
+   OFFDBLK *js ;
    
    if  ( neqns <= 0 )  return 0;
-   marker = begblk[0];
 
-   marker = first;
-   js = marker;
+   js = first;
 /* ----------------------------------------------------------
    for each block blk, do ...
    ----------------------------------------------------------*/
    for (blk = 0; blk < nblks; blk++) {  
-      nextblk = blk + 1 ;
-      blkbeg = xblk[blk] ;
-      blkend = xblk[nextblk]  ;
-      blksze = blkend - blkbeg ;
-/*    --------------------------------------------------------
-      update rows from row segments
-      The function Dotrows();
-      -------------------------------------------------------*/
-      while( js->row < blkend) {
-	 jrow = js->row;
-	 jbeg = js->beg;
+      iflag = pfsfct_block(blk, diag, penv, xblk, begblk, &js, rowblks) ;
+      if (iflag) return iflag;
+   }
+
+   return 0;
+}
+
+/***************************************************************
+ ****     pfsfct_block ..... factor one partitioning block   ****
+ ***************************************************************
+ 
+   purpose - this routine performs the work of pfsfct for block
+        blk: it updates the row segments and the diagonal block
+        of blk from the row segments of blk's rows, factors the
+        diagonal block and backsolves the row segments under it.
+        blk only writes its own rows and the segments under it,
+        so blocks whose row segments do not lie under each other
+        may be factored concurrently.
  
-	 jblk = rowblks[jbeg];
-         ls = begblk[blk] ;
-         ks = js->bnext ;
+   input parameters -
+        pjs   - the first row segment whose row lies in blk, in
+                the "next" list. on return, the first row segment
+                of the following block.
+   return value -
+        0, or the error flag of pfsfct.
+ 
+ ***************************************************************/
+int pfsfct_block(int blk, double *diag, double **penv, int *xblk, 
+		 OFFDBLK **begblk, OFFDBLK **pjs, int *rowblks)
+{  
+   int nextblk, jbeg, iflag ;
+   int iband, blkbeg, blkend, blksze ;
+   int jrow, krow ;
+   int jblk, jb, kb, pos ;
+   OFFDBLK *ks, *js, *ls ;
+   double *work;
+   int ii;
+   
+   js = *pjs;
+   nextblk = blk + 1 ;
+   blkbeg = xblk[blk] ;
+   blkend = xblk[nextblk]  ;
+   blksze = blkend - blkbeg ;
+/* --------------------------------------------------------
+   update rows from row segments
+   The function Dotrows();
+   -------------------------------------------------------*/
+   while( js->row < blkend) {
+      jrow = js->row;
+      jbeg = js->beg;
+ 
+      jblk = rowblks[jbeg];
+      ls = begblk[blk] ;
+      ks = js->bnext ;
 /*    -------------------------------------------------------
       update the diagonals from the off diagonal row segments
       ------------------------------------------------------*/
 	 
-	 iband = xblk[jblk+1] - jbeg;
-	 work = (double*) calloc(iband, sizeof(double)); 
-	 for (ii = 0; ii < iband; ii++) {
-	     work[ii] = js->nz[ii];
-	     js->nz[ii] /= diag[ii + jbeg]; 	    
-	 }
-	 diag[jrow] -= dot_real(js->nz, work, iband);
-	 if (diag[jrow] == 0) {
-	     printf("!!!pfsfct(): The diagonal entry %d is zero !!!\n", jrow);
-	     return 1;
-	 }
-	 free (work);
+      iband = xblk[jblk+1] - jbeg;
+      work = (double*) calloc(iband, sizeof(double)); 
+      for (ii = 0; ii < iband; ii++) {
+	  work[ii] = js->nz[ii];
+	  js->nz[ii] /= diag[ii + jbeg]; 	    
+      }
+      diag[jrow] -= dot_real(js->nz, work, iband);
+      free (work);
+      if (diag[jrow] == 0) {
+	  printf("!!!pfsfct(): The diagonal entry %d is zero !!!\n", jrow);
+	  return 1;
+      }
 	 
-	 if (ks->row < blkend )
-	 {  /* part of envelop block*/
-	    for ( ; ks->row < blkend ; ks = ks->bnext)
-	    {
-	       krow = ks->row ;
-	       pos = MAX(jbeg, ks->beg) ;
-	       iband = xblk[jblk+1] - pos;
-	       jb = pos - jbeg ;
-	       kb = pos - ks->beg ;
-	       pos = jrow - krow + (penv[krow + 1] - penv[krow]) ;
-	       *(penv[krow] + pos) -= 
-		   dot_real(js->nz+jb, ks->nz+kb, iband);
-            }
-         }
-	 for ( ; ks->beg < blkend ; ks = ks->bnext)
+      if (ks->row < blkend )
+      {  /* part of envelop block*/
+	 for ( ; ks->row < blkend ; ks = ks->bnext)
 	 {
 	    krow = ks->row ;
-	    pos = MAX(jbeg, ks->beg);
+	    pos = MAX(jbeg, ks->beg) ;
 	    iband = xblk[jblk+1] - pos;
 	    jb = pos - jbeg ;
 	    kb = pos - ks->beg ;
-	    /* part of another row segment */
-	    while ( ls->row != krow) ls = ls->bnext ;
-	    pos = jrow - ls->beg ;
-	    ls->nz[pos] -= 
-	        dot_real(js->nz+jb, ks->nz+kb, iband) ;
-         }
-
-	 js = js->next ;
+	    pos = jrow - krow + (penv[krow + 1] - penv[krow]) ;
+	    *(penv[krow] + pos) -= 
+		dot_real(js->nz+jb, ks->nz+kb, iband);
+	 }
       }
-/*    -------------------------------------------------------
-      perform envelope fct on diag block blk.
-      -------------------------------------------------------
+      for ( ; ks->beg < blkend ; ks = ks->bnext)
+      {
+	 krow = ks->row ;
+	 pos = MAX(jbeg, ks->beg);
+	 iband = xblk[jblk+1] - pos;
+	 jb = pos - jbeg ;
+	 kb = pos - ks->beg ;
+	 /* part of another row segment */
+	 while ( ls->row != krow) ls = ls->bnext ;
+	 pos = jrow - ls->beg ;
+	 ls->nz[pos] -= 
+	     dot_real(js->nz+jb, ks->nz+kb, iband) ;
+      }
+
+      js = js->next ;
+   }
+   *pjs = js;
+/* -------------------------------------------------------
+   perform envelope fct on diag block blk.
+   -------------------------------------------------------
 */
-      iflag = pfefct(blksze, penv+blkbeg, diag+ blkbeg) ;
-      if (iflag) return nextblk;
+   iflag = pfefct(blksze, penv+blkbeg, diag+ blkbeg) ;
+   if (iflag) return nextblk;
 
-/*    -------------------------------------------------------
-      for each row "node" in this block, do
-         update row segments under block blk with a backsolve
-      -------------------------------------------------------
+/* -------------------------------------------------------
+   for each row "node" in this block, do
+      update row segments under block blk with a backsolve
+   -------------------------------------------------------
 */
-      for (ks = begblk[blk]; ks->beg < blkend ; ks = ks->bnext ) {
-         jbeg = ks->beg ;
-         iband = blkend - jbeg ;
-         pflslv(iband, (penv + jbeg), (diag + jbeg), ks->nz);
-      }
+   for (ks = begblk[blk]; ks->beg < blkend ; ks = ks->bnext ) {
+      jbeg = ks->beg ;
+      iband = blkend - jbeg ;
+      pflslv(iband, (penv + jbeg), (diag + jbeg), ks->nz);
    }
 
    return 0;
@@ -260,7 +301,7 @@ void pfsslv(int neqns, double *diag, double **penv, int nblks,
 /***************************************************************
  
  ***************************************************************/
-{  int ii, j, irow, blk ;
+{  int j, irow, blk ;
    int nextblk, blkbeg, blkend, blksze ;
    OFFDBLK *is ;
    double *ptr ;
@@ -299,31 +340,7 @@ void pfsslv(int neqns, double *diag, double **penv, int nblks,
    --------------------------------------------------------------
 */
    for (blk = nblks-1; blk >= 0; blk--)
-   {  
-      nextblk = blk + 1 ;
-      blkbeg = xblk[blk] ;
-      blkend = xblk[nextblk] ;
-      blksze = blkend - blkbeg ;
-/*    ----------------------------------------------------------
-      update the rhs,
-      ----------------------------------------------------------
-*/
-      for (ii = blkbeg; ii < blkend; ii++) {
-	 rhs[ii] /= diag[ii];
-      }
-      
-      for (is=begblk[blk] ; is->beg < blkend ; is = is->bnext ) 
-      {  ptr = is->nz ;
-         j = is->beg ;
-         irow = is->row ;
-	 saxpy((rhs+j), ptr, -rhs[irow], (blkend-is->beg)) ;
-      }
-/*    ----------------------------------------------------------
-           then upper solve using diag block.
-      ----------------------------------------------------------
-*/
-      pfuslv( blksze, penv+blkbeg, diag+blkbeg, rhs+blkbeg ) ;
-   }
+      pfsslv_bwd_block(blk, diag, penv, xblk, rhs, begblk) ;
 
    return ;
 }
@@ -414,3 +431,351 @@ void pfuslv(int neqns, double **penv, double *diag, double *rhs)
    }
    return ;
 }
+
+/***************************************************************
+ *****  pfsslv_fwd_block ..... forward solve for one block  *****
+ ***************************************************************
+ 
+   purpose - the forward substitution of pfsslv for block blk,
+        arranged so that blk only writes its own rows: the row
+        segments of blk's rows are applied first, then the lower
+        solve with the diagonal block. the blocks holding the
+        columns of those segments must have been done.
+ 
+   input parameters -
+        js    - the first row segment whose row lies in blk, in
+                the "next" list.
+ 
+ ***************************************************************/
+void pfsslv_fwd_block(int blk, double *diag, double **penv, int *xblk,
+		      double *rhs, OFFDBLK *js, int *rowblks)
+{  
+   int blkbeg, blkend, j ;
+
+   blkbeg = xblk[blk] ;
+   blkend = xblk[blk+1] ;
+
+   for ( ; js->row < blkend ; js = js->next )
+   {  j = js->beg ;
+      rhs[js->row] -= dot_real(js->nz, (rhs+j), (xblk[rowblks[j]+1]-j)) ;
+   }
+
+   pflslv( blkend-blkbeg, penv+blkbeg, diag+blkbeg, rhs+blkbeg ) ;
+}
+
+/***************************************************************
+ *****  pfsslv_bwd_block ..... backward solve for one block  ****
+ ***************************************************************
+ 
+   purpose - the backward substitution of pfsslv for block blk.
+        blk only writes its own rows, and reads the rows of the
+        row segments under it, which must have been done.
+ 
+ ***************************************************************/
+void pfsslv_bwd_block(int blk, double *diag, double **penv, int *xblk,
+		      double *rhs, OFFDBLK **begblk)
+{  
+   int ii, blkbeg, blkend ;
+   OFFDBLK *is ;
+
+   blkbeg = xblk[blk] ;
+   blkend = xblk[blk+1] ;
+/* ----------------------------------------------------------
+   update the rhs,
+   ----------------------------------------------------------
+*/
+   for (ii = blkbeg; ii < blkend; ii++) {
+      rhs[ii] /= diag[ii];
+   }
+      
+   for (is=begblk[blk] ; is->beg < blkend ; is = is->bnext ) 
+   {  
+      saxpy((rhs+is->beg), is->nz, -rhs[is->row], (blkend-is->beg)) ;
+   }
+/* ----------------------------------------------------------
+   then upper solve using diag block.
+   ----------------------------------------------------------
+*/
+   pfuslv( blkend-blkbeg, penv+blkbeg, diag+blkbeg, rhs+blkbeg ) ;
+}
+
+
+/***************************************************************
+ ****     single precision factors                           ****
+ ***************************************************************
+ 
+   The routines below are pfsfct, pfsslv and their block parts
+   for a factor held in single precision: diag and penv are
+   float, and the row segments use fnz in place of nz. The
+   inner products are accumulated in double precision, and the
+   right hand side of the solves is double precision. A zero,
+   denormal or non-finite pivot is reported as an error, with
+   no message, so that the caller may fall back to a double
+   precision factorization.
+ 
+ ***************************************************************/
+int pfsfct_f(int neqns, float *diag, float **penv, int nblks, 
+	     int *xblk, OFFDBLK **begblk, OFFDBLK *first, int *rowblks)
+{  
+   int blk, iflag ;
+   OFFDBLK *js ;
+   
+   if  ( neqns <= 0 )  return 0;
+
+   js = first;
+   for (blk = 0; blk < nblks; blk++) {  
+      iflag = pfsfct_block_f(blk, diag, penv, xblk, begblk, &js, rowblks) ;
+      if (iflag) return iflag;
+   }
+
+   return 0;
+}
+
+
+int pfsfct_block_f(int blk, float *diag, float **penv, int *xblk, 
+		   OFFDBLK **begblk, OFFDBLK **pjs, int *rowblks)
+{  
+   int nextblk, jbeg, iflag ;
+   int iband, blkbeg, blkend, blksze ;
+   int jrow, krow ;
+   int jblk, jb, kb, pos ;
+   OFFDBLK *ks, *js, *ls ;
+   float *work;
+   int ii;
+   
+   js = *pjs;
+   nextblk = blk + 1 ;
+   blkbeg = xblk[blk] ;
+   blkend = xblk[nextblk]  ;
+   blksze = blkend - blkbeg ;
+
+   while( js->row < blkend) {
+      jrow = js->row;
+      jbeg = js->beg;
+ 
+      jblk = rowblks[jbeg];
+      ls = begblk[blk] ;
+      ks = js->bnext ;
+	 
+      iband = xblk[jblk+1] - jbeg;
+      work = (float*) calloc(iband, sizeof(float)); 
+      for (ii = 0; ii < iband; ii++) {
+	  work[ii] = js->fnz[ii];
+	  js->fnz[ii] /= diag[ii + jbeg]; 	    
+      }
+      diag[jrow] = (float)(diag[jrow] - dot_float(js->fnz, work, iband));
+      free (work);
+      if (LOST_PIVOT(diag[jrow]))
+	  return 1;
+	 
+      if (ks->row < blkend )
+      {  /* part of envelop block*/
+	 for ( ; ks->row < blkend ; ks = ks->bnext)
+	 {
+	    krow = ks->row ;
+	    pos = MAX(jbeg, ks->beg) ;
+	    iband = xblk[jblk+1] - pos;
+	    jb = pos - jbeg ;
+	    kb = pos - ks->beg ;
+	    pos = jrow - krow + (penv[krow + 1] - penv[krow]) ;
+	    *(penv[krow] + pos) -= 
+		dot_float(js->fnz+jb, ks->fnz+kb, iband);
+	 }
+      }
+      for ( ; ks->beg < blkend ; ks = ks->bnext)
+      {
+	 krow = ks->row ;
+	 pos = MAX(jbeg, ks->beg);
+	 iband = xblk[jblk+1] - pos;
+	 jb = pos - jbeg ;
+	 kb = pos - ks->beg ;
+	 /* part of another row segment */
+	 while ( ls->row != krow) ls = ls->bnext ;
+	 pos = jrow - ls->beg ;
+	 ls->fnz[pos] -= 
+	     dot_float(js->fnz+jb, ks->fnz+kb, iband) ;
+      }
+
+      js = js->next ;
+   }
+   *pjs = js;
+
+   iflag = pfefct_f(blksze, penv+blkbeg, diag+ blkbeg) ;
+   if (iflag) return nextblk;
+
+   for (ks = begblk[blk]; ks->beg < blkend ; ks = ks->bnext ) {
+      jbeg = ks->beg ;
+      iband = blkend - jbeg ;
+      pflslv_f(iband, (penv + jbeg), (diag + jbeg), ks->fnz);
+   }
+
+   return 0;
+}
+
+
+static
+int pfefct_f(int neqns, float **penv, float *diag)
+{  
+   float *ptenv ; 
+   int iband, i, jj, ifirst ;
+   float *work;
+   
+   if ( neqns > 0 && LOST_PIVOT(diag[0]) )
+      return (1);
+
+   for (i=1; i < neqns ; i++)
+   {  
+      ptenv = penv[i] ;
+      iband = penv[i+1] - ptenv ;
+      work = (float *)calloc(iband, sizeof(float));
+
+      if ( iband > 0 )
+      {  
+	 ifirst = i - iband ;
+
+         pflslv_f( iband, penv+ifirst, diag+ifirst, ptenv );
+	 for (jj = 0; jj < iband; jj++) {
+	     work[jj] = ptenv[jj];
+	     ptenv[jj] = ptenv[jj] / diag[i+jj-iband]; 
+	 }
+	 
+         diag[i] = (float)(diag[i] - dot_float(ptenv, work, iband ));
+      }
+      
+      free (work);
+
+      if (LOST_PIVOT(diag[i]))
+	  return (1); 
+   }
+
+   return(0) ;
+}
+
+
+void pfsslv_f(int neqns, float *diag, float **penv, int nblks, 
+	      int *xblk, double *rhs, OFFDBLK **begblk)
+{  int j, irow, blk ;
+   int nextblk, blkbeg, blkend, blksze ;
+   OFFDBLK *is ;
+ 
+   if  ( neqns <= 0 )  return ;
+
+   for (blk = 0; blk < nblks ; blk++)
+   {  nextblk = blk + 1 ;
+      blkbeg = xblk[blk] ;
+      blkend = xblk[nextblk] ;
+      blksze = blkend - blkbeg ;
+
+      pflslv_m( blksze, penv+blkbeg, diag+blkbeg, rhs+blkbeg ) ;
+
+      for (is = begblk[blk] ; is->beg < blkend ; is = is->bnext ) 
+      {  j = is->beg ;
+         irow = is->row ;
+         rhs[irow] -= dot_mixed(is->fnz, (rhs+j), (blkend-j)) ;
+      }
+   }
+
+   for (blk = nblks-1; blk >= 0; blk--)
+      pfsslv_bwd_block_f(blk, diag, penv, xblk, rhs, begblk) ;
+
+   return ;
+}
+
+
+/* lower solve on a single precision rhs, used in the factorization */
+static
+void pflslv_f (int neqns, float **penv, float *diag, float *rhs)
+{ 
+  int i, iband ;
+
+   if ( neqns <= 1 )  return ;
+   for (i = 1; i < neqns; i++)
+   {  
+      iband = penv[i+1] - penv[i] ;
+      if (iband > i) iband = i ;
+      if (iband > 0)
+      {
+         rhs[i] = (float)(rhs[i] - dot_float(penv[i+1] - iband, rhs+i-iband, iband)) ;
+      }
+   }
+
+   return ;
+}
+
+
+static
+void pflslv_m (int neqns, float **penv, float *diag, double *rhs)
+{ 
+  int i, iband ;
+
+   if ( neqns <= 1 )  return ;
+   for (i = 1; i < neqns; i++)
+   {  
+      iband = penv[i+1] - penv[i] ;
+      if (iband > i) iband = i ;
+      if (iband > 0)
+      {
+         rhs[i] -= dot_mixed(penv[i+1] - iband, rhs+i-iband, iband) ;
+      }
+   }
+
+   return ;
+}
+
+
+static 
+void pfuslv_m(int neqns, float **penv, float *diag, double *rhs)
+{  int i, k ;
+   double s ;
+   float *ptr ;
+
+   for (i=neqns-1; i >= 0 ;i--)
+   {
+      if  ( rhs[i] == 0.0e0 )  continue ;
+      s = rhs[i] ;
+      k = i-1 ;
+      for (ptr = penv[i+1]-1; ptr >= penv[i] ; ptr--,k--) {
+         rhs[k] -= ( *ptr * s) ;
+      }
+   }
+   return ;
+}
+
+
+void pfsslv_fwd_block_f(int blk, float *diag, float **penv, int *xblk,
+			double *rhs, OFFDBLK *js, int *rowblks)
+{  
+   int blkbeg, blkend, j ;
+
+   blkbeg = xblk[blk] ;
+   blkend = xblk[blk+1] ;
+
+   for ( ; js->row < blkend ; js = js->next )
+   {  j = js->beg ;
+      rhs[js->row] -= dot_mixed(js->fnz, (rhs+j), (xblk[rowblks[j]+1]-j)) ;
+   }
+
+   pflslv_m( blkend-blkbeg, penv+blkbeg, diag+blkbeg, rhs+blkbeg ) ;
+}
+
+
+void pfsslv_bwd_block_f(int blk, float *diag, float **penv, int *xblk,
+			double *rhs, OFFDBLK **begblk)
+{  
+   int ii, blkbeg, blkend ;
+   OFFDBLK *is ;
+
+   blkbeg = xblk[blk] ;
+   blkend = xblk[blk+1] ;
+
+   for (ii = blkbeg; ii < blkend; ii++) {
+      rhs[ii] /= diag[ii];
+   }
+      
+   for (is=begblk[blk] ; is->beg < blkend ; is = is->bnext ) 
+   {  
+      saxpy_mixed((rhs+is->beg), is->fnz, -rhs[is->row], (blkend-is->beg)) ;
+   }
+
+   pfuslv_m( blkend-blkbeg, penv+blkbeg, diag+blkbeg, rhs+blkbeg ) ;
+}
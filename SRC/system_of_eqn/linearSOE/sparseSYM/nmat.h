@@ -23,4 +23,31 @@ int  pfsfct(int neqns, double *diag, double **penv, int nblks,
 void pfsslv(int neqns, double *diag, double **penv, int nblks, 
             int *xblk, double *rhs, OFFDBLK **begblk);
 
+/* the work of pfsfct and pfsslv for a single block */
+int  pfsfct_block(int blk, double *diag, double **penv, int *xblk, 
+                  OFFDBLK **begblk, OFFDBLK **pjs, int *rowblks);
+
+void pfsslv_fwd_block(int blk, double *diag, double **penv, int *xblk,
+                      double *rhs, OFFDBLK *js, int *rowblks);
+
+void pfsslv_bwd_block(int blk, double *diag, double **penv, int *xblk,
+                      double *rhs, OFFDBLK **begblk);
+
+/* the same, with the factor in single precision (diag, penv and the
+   fnz of the row segments) and a double precision rhs */
+int  pfsfct_f(int neqns, float *diag, float **penv, int nblks, 
+              int *xblk, OFFDBLK **begblk, OFFDBLK *first, int *rowblks);
+
+void pfsslv_f(int neqns, float *diag, float **penv, int nblks, 
+              int *xblk, double *rhs, OFFDBLK **begblk);
+
+int  pfsfct_block_f(int blk, float *diag, float **penv, int *xblk, 
+                    OFFDBLK **begblk, OFFDBLK **pjs, int *rowblks);
+
+void pfsslv_fwd_block_f(int blk, float *diag, float **penv, int *xblk,
+                        double *rhs, OFFDBLK *js, int *rowblks);
+
+void pfsslv_bwd_block_f(int blk, float *diag, float **penv, int *xblk,
+                        double *rhs, OFFDBLK **begblk);
+
 #endif
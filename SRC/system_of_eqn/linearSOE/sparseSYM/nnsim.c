@@ -42,6 +42,10 @@ void zeroi(int, int *);
           padj         - adjancency structure of original ordering
           ancstr       - ancstr of each node in the ordered tree
 
+          single         - if non-zero the row segments are given
+                           single precision storage (fnz), else
+                           double precision storage (nz)
+
        Output:
           pnzbeg, pnzsub - structure of matrix factor l
           nonz           - number of nonzeros in l
@@ -53,7 +57,7 @@ void zeroi(int, int *);
 
 int nodfac(int *perm, int *invp, int **padj, int *ancstr , int *list, int neqns, 
 	   int nblks, int *xblk, int *envlen, OFFDBLK **segfirst, 
-	   OFFDBLK **first, int *rowblks )
+	   OFFDBLK **first, int *rowblks, int single )
 { 
    int i, node, nbr, qm, m, nnext ;
    int bcount, knz, cnz ;
@@ -107,6 +111,8 @@ int nodfac(int *perm, int *invp, int **padj, int *ancstr , int *list, int neqns,
 	 assert (p != NULL) ;
          p->row = node ;
          p->beg = nbr ;
+         p->nz  = NULL ;
+         p->fnz = NULL ;
 	 po->next = p ;
 	 po = p ;
          nbrblk = rowblks[nbr] ;
@@ -131,7 +137,19 @@ int nodfac(int *perm, int *invp, int **padj, int *ancstr , int *list, int neqns,
       /* part of the diagonal envelop block */
       envlen[node] = node - nbr ;
 /*    should now allocate space for row and set up pointers */
-      if (knz > 0) 
+      if (knz > 0 && single)
+      {  
+	 nbeg->fnz = (float *)calloc(knz, sizeof(float)) ;
+         assert(nbeg->fnz != NULL) ;
+         if ( bcount < count) bcount++ ;
+         m = bcount ;
+         while (bcount < count)
+         {  (nbeg->next)->fnz = nbeg->fnz + len[bcount - m] ;
+            nbeg = nbeg->next ;
+            bcount++ ;
+         }
+      }
+      else if (knz > 0) 
       {  
 	 nbeg->nz = (double *)calloc(knz, sizeof(double)) ;
          assert(nbeg->nz != NULL) ;
@@ -210,3 +228,30 @@ int setenvlpe(int neqns, double **penv, int *envlen)
 
    return(knz);
 }
+
+
+/************************************************************************
+ ************  setenvlpe_f ..... single precision envelope  *************
+ ************************************************************************
+ 
+    purpose - as setenvlpe, with single precision storage.
+ 
+ ************************************************************************/
+     
+int setenvlpe_f(int neqns, float **penv, int *envlen)
+{
+   int i, knz ;
+
+   knz = 0 ;
+   for (i=1; i<neqns; i++)
+      knz += envlen[i] ;
+
+   penv[0] = (float *)calloc(knz+1,sizeof(float)) ;
+   assert(penv[0] != NULL ) ;
+   for (i=0;i<neqns;i++)
+   { 
+       penv[i+1] = penv[i] + envlen[i] ;
+   }
+
+   return(knz);
+}
@@ -52,25 +52,28 @@ int  pfordr(int neqns, int **padj, int *perm, int *invp, int *parent, int *fchil
 // from nnsim.c
 int nodfac(int *perm, int *invp, int **padj, int *ancstr , int *list, int neqns, 
 	   int nblks, int *xblk, int *envlen, OFFDBLK **segfirst, 
-	   OFFDBLK **first, int *rowblks );
+	   OFFDBLK **first, int *rowblks, int single );
 
 int setenvlpe(int neqns, double **penv, int *envlen);
+int setenvlpe_f(int neqns, float **penv, int *envlen);
 
 
 
 /* int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE) */
 
-
-int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE, 
-		     int **xblkMY,
-		     int **invpMY, int **rowblksMY, OFFDBLK ***begblkMY,
-		     OFFDBLK **firstMY, double ***penvMY, double **diagMY)
+static
+int symFactor(int *fxadj, int *adjncy, int neq, int LSPARSE, 
+	      int **xblkMY,
+	      int **invpMY, int **rowblksMY, OFFDBLK ***begblkMY,
+	      OFFDBLK **firstMY, double ***penvMY, double **diagMY,
+	      float ***fenvMY, float **fdiagMY)
 {
     int delta, maxint;
     int nofsub, kdx;
     int ndnz;
     int *marker;
     int *winvp, *wperm;
+    int *wadj;
     int *perm, *parent, *fchild, *sibling;
     int **padj;
 
@@ -82,6 +85,8 @@ int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE,
     OFFDBLK *first;
     double **penv;
     double *diag;
+    float **fenv;
+    float *fdiag;
 
  /* set up storage space and pointers */ 
 
@@ -122,14 +127,20 @@ int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE,
     switch (LSPARSE)
     {
        case 1:
-   /* Now call minimum degree ordering  ( a fortran subroutine) */
+   /* Now call minimum degree ordering  ( a fortran subroutine).
+      It destroys the adjacency structure it is given, and the
+      caller's (fxadj, adjncy) are kept, so it works on a copy. */
+         wadj = (int *)calloc(fxadj[neq], sizeof(int)) ;
+         assert(wadj != NULL) ;
+         copyi(fxadj[neq]-1, adjncy, wadj);
 #ifdef WIN32 
-	 MYGENMMD( &neq, fxadj, adjncy, winvp, wperm, &delta, fchild, parent,
+	 MYGENMMD( &neq, fxadj, wadj, winvp, wperm, &delta, fchild, parent,
 		   sibling, marker, &maxint, &nofsub, &kdx ) ;
 #else
-	 mygenmmd_( &neq, fxadj, adjncy, winvp, wperm, &delta, fchild, parent,
+	 mygenmmd_( &neq, fxadj, wadj, winvp, wperm, &delta, fchild, parent,
 		    sibling, marker, &maxint, &nofsub, &kdx ) ;
 #endif
+         free(wadj) ;
          /* reset subscripts for c rather than fortran */
          for (int i=0; i<=neq; i++) {
             winvp[i]-- ;
@@ -198,7 +209,7 @@ int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE,
 */  
            
    nodfac(perm, invp, padj, parent, fchild , neq, nblks,
-	  xblk, marker, begblk, &first, rowblks) ;
+	  xblk, marker, begblk, &first, rowblks, fdiagMY != NULL) ;
 
    free(perm) ;
    free(parent) ;
@@ -206,10 +217,21 @@ int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE,
    free(padj[0]) ;
    free(padj);
 
-   penv = (double **)calloc(neq + 1, sizeof(double *)) ;
-   diag = (double *) calloc(neq + 1, sizeof(double )) ;
-   assert (penv && diag != NULL) ;
-   ndnz = setenvlpe(neq, penv, marker) ;
+   if (fdiagMY != NULL) {
+      fenv = (float **)calloc(neq + 1, sizeof(float *)) ;
+      fdiag = (float *) calloc(neq + 1, sizeof(float )) ;
+      assert (fenv && fdiag != NULL) ;
+      ndnz = setenvlpe_f(neq, fenv, marker) ;
+      *fenvMY    = fenv;
+      *fdiagMY   = fdiag;
+   } else {
+      penv = (double **)calloc(neq + 1, sizeof(double *)) ;
+      diag = (double *) calloc(neq + 1, sizeof(double )) ;
+      assert (penv && diag != NULL) ;
+      ndnz = setenvlpe(neq, penv, marker) ;
+      *penvMY    = penv;
+      *diagMY    = diag;
+   }
         
    free(marker);
 
@@ -218,8 +240,6 @@ int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE,
    *rowblksMY = rowblks;
    *begblkMY  = begblk;
    *firstMY   = first;
-   *penvMY    = penv;
-   *diagMY    = diag;
 
 
    for (int i=0; i<=neq; i++)
@@ -233,6 +253,24 @@ int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE,
 }
 
 
+int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE, 
+		     int **xblkMY,
+		     int **invpMY, int **rowblksMY, OFFDBLK ***begblkMY,
+		     OFFDBLK **firstMY, double ***penvMY, double **diagMY)
+{
+   return symFactor(fxadj, adjncy, neq, LSPARSE, xblkMY, invpMY, rowblksMY,
+		    begblkMY, firstMY, penvMY, diagMY, NULL, NULL);
+}
 
 
-
+/* as symFactorization, with the diagonal, the envelope and the row
+ * segments (fnz) of the factor given single precision storage.
+ */
+int symFactorization_f(int *fxadj, int *adjncy, int neq, int LSPARSE, 
+		       int **xblkMY,
+		       int **invpMY, int **rowblksMY, OFFDBLK ***begblkMY,
+		       OFFDBLK **firstMY, float ***fenvMY, float **fdiagMY)
+{
+   return symFactor(fxadj, adjncy, neq, LSPARSE, xblkMY, invpMY, rowblksMY,
+		    begblkMY, firstMY, NULL, NULL, fenvMY, fdiagMY);
+}
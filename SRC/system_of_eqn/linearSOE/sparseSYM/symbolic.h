@@ -3,3 +3,8 @@ extern "C" int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE,
                                 int **xblkMY, int **invpMY, int **rowblksMY, 
                                 OFFDBLK ***begblkMY, OFFDBLK **firstMY, 
                                 double ***penvMY, double **diagMY);
+
+extern "C" int symFactorization_f(int *fxadj, int *adjncy, int neq, int LSPARSE, 
+                                  int **xblkMY, int **invpMY, int **rowblksMY, 
+                                  OFFDBLK ***begblkMY, OFFDBLK **firstMY, 
+                                  float ***fenvMY, float **fdiagMY);
@@ -41,6 +41,34 @@ double  dot_real(double *vect_1, double *vect_2, int n)
 }
 /************************* end of function *************************/
 
+double  dot_float(float *vect_1, float *vect_2, int n)
+{
+	float *fstop ;
+	double  sum    ;
+
+	sum = 0.0  ;
+	fstop = vect_1 + n ;
+	for( ; vect_1 <fstop ; vect_1++, vect_2++ )
+		sum += ((double)*vect_1 * *vect_2) ;
+
+	return(sum) ;
+}
+/************************* end of function *************************/
+
+double  dot_mixed(float *vect_1, double *vect_2, int n)
+{
+	float *fstop ;
+	double  sum    ;
+
+	sum = 0.0  ;
+	fstop = vect_1 + n ;
+	for( ; vect_1 <fstop ; vect_1++, vect_2++ )
+		sum += (*vect_1 * *vect_2) ;
+
+	return(sum) ;
+}
+/************************* end of function *************************/
+
 int  i_greater(int *p1, int *p2)
 {
 	return ( (int)(*p1 - *p2) );
@@ -88,6 +116,23 @@ void  saxpy(double *v1, double *v2, double alpha, int n)
 }
 /************************* end of function *************************/
 
+void  saxpy_mixed(double *v1, float *v2, double alpha, int n)
+{
+	double  *end;
+
+	end = v1 + n;
+	if(n <= 0)
+	{
+		printf(" n %d\n", n);
+		exit(1);
+	}
+	for( ; v1 < end ; v1++, v2++)
+		*v1 += *v2 * alpha;
+   
+	return;
+}
+/************************* end of function *************************/
+
 void  copyi(int n, int *from, int *to)
 {
 	int  i;
@@ -39,6 +39,19 @@ void  clear_real(double *array, int n);
 double  dot_real( double *vect_1, double *vect_2, int n );
 
 
+/*
+ * Function:  dot_float, dot_mixed
+ * ===============================
+ *
+ * Notes:  As dot_real, for single precision vectors and for a single
+ *         with a double precision vector. The sum is accumulated in
+ *         double precision.
+ * Used in ... nmat.c
+ */
+double  dot_float( float *vect_1, float *vect_2, int n );
+double  dot_mixed( float *vect_1, double *vect_2, int n );
+
+
 /*
  * Function:  i_greater
  * ====================
@@ -76,6 +89,16 @@ void  minoni( int n, int *v );
 void  saxpy( double *v1, double *v2, double alpha, int n );
 
 
+/*
+ * Function:  saxpy_mixed
+ * ======================
+ *
+ * Notes:  as saxpy, with v2 in single precision
+ * Used in ... nmat.c
+ */
+void  saxpy_mixed( double *v1, float *v2, double alpha, int n );
+
+
 /*
  * Function:  copyi
  * ================
@@ -89,10 +89,13 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
 	nnz += theAdjacency.Size() +1; // the +1 is for the diag entry
     }
 
-    // resize A, B, X
+    // resize A, B, X; the structure is rebuilt from scratch when the
+    // domain changes
+    Ap.clear();
+    Ai.clear();
     Ap.reserve(size+1);
     Ai.reserve(nnz);
-    Ax.resize(nnz,0.0);
+    Ax.assign(nnz,0.0);
     B.resize(size);
     B.Zero();
     X.resize(size);
@@ -67,6 +67,13 @@ MapOfTaggedObjects::addComponent(TaggedObject *newComponent)
     MAP_TAGGED_ITERATOR theEle;
     int tag = newComponent->getTag();
 
+    // components are commonly added in increasing tag order; in that
+    // case insert at the end without searching the tree
+    if (!theMap.empty() && tag > theMap.rbegin()->first) {
+      theMap.insert(theMap.end(), MAP_TAGGED_TYPE(tag,newComponent));
+      return true;
+    }
+
     // check if the ele already in map, if not we add
     std::pair<MAP_TAGGED_ITERATOR,bool> res = theMap.insert(MAP_TAGGED_TYPE(tag,newComponent));    
     if (res.second == false) {
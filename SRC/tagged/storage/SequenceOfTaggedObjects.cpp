@@ -0,0 +1,205 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the implementation of the
+// SequenceOfTaggedObjects class.
+//
+#include <TaggedObject.h>
+#include <SequenceOfTaggedObjects.h>
+#include <ID.h>
+#include <OPS_Globals.h>
+
+SequenceOfTaggedObjects::SequenceOfTaggedObjects()
+ :numComponents(0), myIter(*this)
+{
+
+}
+
+SequenceOfTaggedObjects::~SequenceOfTaggedObjects()
+{
+    this->clearAll();
+}
+
+int
+SequenceOfTaggedObjects::setSize(int newSize)
+{
+    if (newSize < 0) {
+	opserr << "SequenceOfTaggedObjects::setSize - invalid size " << newSize << "\n";
+	return -1;
+    }
+
+    theSequence.reserve(newSize);
+    theLocations.reserve(newSize);
+    return 0;
+}
+
+bool
+SequenceOfTaggedObjects::addComponent(TaggedObject *newComponent)
+{
+    int tag = newComponent->getTag();
+    if (theLocations.find(tag) != theLocations.end()) {
+	opserr << "SequenceOfTaggedObjects::addComponent - not adding as one with similar tag exists, tag: "
+	       << tag << "\n";
+	return false;
+    }
+
+    // squeeze out the holes once they make up most of the sequence
+    if (theSequence.size() > 16 && 2*numComponents < int(theSequence.size()))
+	this->compact();
+
+    theLocations[tag] = int(theSequence.size());
+    theSequence.push_back(newComponent);
+    numComponents++;
+
+    return true;
+}
+
+TaggedObject *
+SequenceOfTaggedObjects::removeComponent(int tag)
+{
+    auto p = theLocations.find(tag);
+    if (p == theLocations.end())
+	return nullptr;
+
+    // leave a hole so that an iter in use stays valid
+    TaggedObject *removed = theSequence[p->second];
+    theSequence[p->second] = nullptr;
+    theLocations.erase(p);
+    numComponents--;
+
+    return removed;
+}
+
+int
+SequenceOfTaggedObjects::getNumComponents(void) const
+{
+    return numComponents;
+}
+
+TaggedObject *
+SequenceOfTaggedObjects::getComponentPtr(int tag)
+{
+    auto p = theLocations.find(tag);
+    if (p == theLocations.end())
+	return nullptr;
+
+    return theSequence[p->second];
+}
+
+TaggedObjectIter &
+SequenceOfTaggedObjects::getComponents()
+{
+    myIter.reset();
+    return myIter;
+}
+
+SequenceOfTaggedObjectsIter
+SequenceOfTaggedObjects::getIter()
+{
+    return SequenceOfTaggedObjectsIter(*this);
+}
+
+TaggedObjectStorage *
+SequenceOfTaggedObjects::getEmptyCopy(void)
+{
+    return new SequenceOfTaggedObjects();
+}
+
+void
+SequenceOfTaggedObjects::clearAll(bool invokeDestructor)
+{
+    if (invokeDestructor == true) {
+	for (TaggedObject *theObject : theSequence)
+	    if (theObject != nullptr)
+		delete theObject;
+    }
+
+    theSequence.clear();
+    theLocations.clear();
+    numComponents = 0;
+}
+
+int
+SequenceOfTaggedObjects::reorder(const ID &tags)
+{
+    // check the whole list before moving anything, so that a bad tag
+    // leaves the sequence as it was
+    int numTags = tags.Size();
+    std::vector<char> listed(theSequence.size(), 0);
+    for (int i=0; i<numTags; i++) {
+	auto p = theLocations.find(tags(i));
+	if (p == theLocations.end()) {
+	    opserr << "SequenceOfTaggedObjects::reorder - no component with tag "
+		   << tags(i) << "\n";
+	    return -1;
+	}
+	if (listed[p->second] != 0) {
+	    opserr << "SequenceOfTaggedObjects::reorder - tag " << tags(i)
+		   << " listed more than once\n";
+	    return -1;
+	}
+	listed[p->second] = 1;
+    }
+
+    std::vector<TaggedObject *> newSequence;
+    newSequence.reserve(numComponents);
+
+    // the listed components first, in the order given
+    for (int i=0; i<numTags; i++)
+	newSequence.push_back(theSequence[theLocations[tags(i)]]);
+
+    // then the remaining ones in their current order
+    int size = int(theSequence.size());
+    for (int i=0; i<size; i++)
+	if (theSequence[i] != nullptr && listed[i] == 0)
+	    newSequence.push_back(theSequence[i]);
+
+    theSequence.swap(newSequence);
+    size = int(theSequence.size());
+    for (int i=0; i<size; i++)
+	theLocations[theSequence[i]->getTag()] = i;
+
+    return 0;
+}
+
+void
+SequenceOfTaggedObjects::compact(void)
+{
+    int loc = 0;
+    for (TaggedObject *theObject : theSequence) {
+	if (theObject != nullptr) {
+	    theLocations[theObject->getTag()] = loc;
+	    theSequence[loc++] = theObject;
+	}
+    }
+    theSequence.resize(loc);
+}
+
+void
+SequenceOfTaggedObjects::Print(OPS_Stream &s, int flag)
+{
+    for (TaggedObject *theObject : theSequence) {
+	if (theObject == nullptr)
+	    continue;
+	theObject->Print(s, flag);
+	if (flag == OPS_PRINT_PRINTMODEL_JSON)
+	    s << ",\n";
+    }
+}
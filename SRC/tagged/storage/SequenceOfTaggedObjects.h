@@ -0,0 +1,75 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the class definition for
+// SequenceOfTaggedObjects. SequenceOfTaggedObjects is a storage class
+// which keeps the pointers to its TaggedObjects in a contiguous array,
+// in an order that can be chosen with reorder(), together with a hash
+// map from tag to position. The iter returns the objects in that order,
+// so a Domain can arrange for its elements and nodes to be visited in
+// a locality-friendly sequence.
+//
+#ifndef SequenceOfTaggedObjects_h
+#define SequenceOfTaggedObjects_h
+
+#include <vector>
+#include <unordered_map>
+#include <TaggedObjectStorage.h>
+#include <SequenceOfTaggedObjectsIter.h>
+
+class ID;
+
+class SequenceOfTaggedObjects : public TaggedObjectStorage
+{
+  public:
+    SequenceOfTaggedObjects();
+    ~SequenceOfTaggedObjects();
+
+    // public methods to populate a domain
+    int  setSize(int newSize);
+    bool addComponent(TaggedObject *newComponent);
+    TaggedObject *removeComponent(int tag);
+    int getNumComponents(void) const;
+
+    TaggedObject     *getComponentPtr(int tag);
+    TaggedObjectIter &getComponents();
+
+    SequenceOfTaggedObjectsIter getIter();
+
+    TaggedObjectStorage *getEmptyCopy(void);
+    void clearAll(bool invokeDestructor = true);
+
+    // moves the components with the given tags, in the given order, to
+    // the front of the sequence; the others follow in their current order
+    int reorder(const ID &tags);
+
+    void Print(OPS_Stream &s, int flag =0);
+    friend class SequenceOfTaggedObjectsIter;
+
+  private:
+    void compact(void);
+
+    std::vector<TaggedObject *> theSequence;   // objects in traversal order, 0 for removed
+    std::unordered_map<int, int> theLocations; // tag -> position in theSequence
+    int numComponents;
+    SequenceOfTaggedObjectsIter myIter;
+};
+
+#endif
@@ -0,0 +1,55 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the implementation of
+// SequenceOfTaggedObjectsIter.
+//
+#include <SequenceOfTaggedObjectsIter.h>
+#include <SequenceOfTaggedObjects.h>
+
+SequenceOfTaggedObjectsIter::SequenceOfTaggedObjectsIter(SequenceOfTaggedObjects &theComponents)
+ :currentLoc(0)
+{
+    theSequence = &(theComponents.theSequence);
+}
+
+SequenceOfTaggedObjectsIter::~SequenceOfTaggedObjectsIter()
+{
+
+}
+
+void
+SequenceOfTaggedObjectsIter::reset(void)
+{
+    currentLoc = 0;
+}
+
+TaggedObject *
+SequenceOfTaggedObjectsIter::operator()(void)
+{
+    // skip over the holes left by removed components
+    size_t size = theSequence->size();
+    while (currentLoc < size) {
+	TaggedObject *result = (*theSequence)[currentLoc++];
+	if (result != nullptr)
+	    return result;
+    }
+    return nullptr;
+}
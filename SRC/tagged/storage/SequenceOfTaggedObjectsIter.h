@@ -0,0 +1,49 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the class definition for
+// SequenceOfTaggedObjectsIter. A SequenceOfTaggedObjectsIter is an iter
+// for returning the TaggedObjects of a storage object of type
+// SequenceOfTaggedObjects in their stored order.
+//
+#ifndef SequenceOfTaggedObjectsIter_h
+#define SequenceOfTaggedObjectsIter_h
+
+#include <TaggedObjectIter.h>
+#include <stddef.h>
+#include <vector>
+
+class SequenceOfTaggedObjects;
+
+class SequenceOfTaggedObjectsIter: public TaggedObjectIter
+{
+  public:
+    SequenceOfTaggedObjectsIter(SequenceOfTaggedObjects &theComponents);
+    virtual ~SequenceOfTaggedObjectsIter();
+
+    virtual void reset(void);
+    virtual TaggedObject *operator()(void);
+
+  private:
+    std::vector<TaggedObject *> *theSequence;
+    size_t currentLoc;
+};
+
+#endif